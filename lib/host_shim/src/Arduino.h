@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Stream.h"
+#include "esp_sleep.h"
+#include "esp_system.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "host.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/time.h>
+#include <time.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PI 3.1415926535897932384626433832795
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#define sq(x) ((x) * (x))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define RTC_DATA_ATTR __attribute__((section("rtc_data")))
+#define RTC_NOINIT_ATTR
+#define IRAM_ATTR
+
+// esp32-hal-log.h, with the level cut of CORE_DEBUG_LEVEL
+#define ARDUHAL_LOG_LEVEL_NONE 0
+#define ARDUHAL_LOG_LEVEL_ERROR 1
+#define ARDUHAL_LOG_LEVEL_WARN 2
+#define ARDUHAL_LOG_LEVEL_INFO 3
+#define ARDUHAL_LOG_LEVEL_DEBUG 4
+#define ARDUHAL_LOG_LEVEL_VERBOSE 5
+#ifndef CORE_DEBUG_LEVEL
+#define CORE_DEBUG_LEVEL ARDUHAL_LOG_LEVEL_INFO
+#endif
+
+int log_printf(const char *format, ...) __attribute__((format(printf, 1, 2)));
+#define ARDUHAL_LOG(letter, format, ...)                                                                   \
+    log_printf("[%6lu][" letter "][%s:%u] %s(): " format "\r\n", millis(), __FILE__, __LINE__, __FUNCTION__, \
+               ##__VA_ARGS__)
+#if CORE_DEBUG_LEVEL >= ARDUHAL_LOG_LEVEL_ERROR
+#define log_e(format, ...) ARDUHAL_LOG("E", format, ##__VA_ARGS__)
+#else
+#define log_e(format, ...)
+#endif
+#if CORE_DEBUG_LEVEL >= ARDUHAL_LOG_LEVEL_WARN
+#define log_w(format, ...) ARDUHAL_LOG("W", format, ##__VA_ARGS__)
+#else
+#define log_w(format, ...)
+#endif
+#if CORE_DEBUG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO
+#define log_i(format, ...) ARDUHAL_LOG("I", format, ##__VA_ARGS__)
+#else
+#define log_i(format, ...)
+#endif
+#if CORE_DEBUG_LEVEL >= ARDUHAL_LOG_LEVEL_DEBUG
+#define log_d(format, ...) ARDUHAL_LOG("D", format, ##__VA_ARGS__)
+#else
+#define log_d(format, ...)
+#endif
+#if CORE_DEBUG_LEVEL >= ARDUHAL_LOG_LEVEL_VERBOSE
+#define log_v(format, ...) ARDUHAL_LOG("V", format, ##__VA_ARGS__)
+#else
+#define log_v(format, ...)
+#endif
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+// the battery divider reads as a full battery, HOST_BATTERY_MV overrides it
+uint16_t analogRead(uint8_t pin);
+
+#if !defined(__GLIBC__) || !__GLIBC_PREREQ(2, 38)
+extern "C" size_t strlcpy(char *dst, const char *src, size_t size);
+#endif
+
+void *ps_malloc(size_t size);
+void *ps_calloc(size_t count, size_t size);
+
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char *server1,
+                const char *server2 = nullptr, const char *server3 = nullptr);
+bool getLocalTime(struct tm *info, uint32_t ms = 5000);
+
+class HardwareSerial : public Stream {
+  public:
+    void begin(unsigned long baud) {}
+    void end() {}
+    size_t write(uint8_t c) override { return fwrite(&c, 1, 1, stdout); }
+    size_t write(const uint8_t *buffer, size_t size) override { return fwrite(buffer, 1, size, stdout); }
+    void flush() override { fflush(stdout); }
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+};
+
+extern HardwareSerial Serial;
+
+// the host has no memory limits, these are the sizes of an ESP32 with 4 MB of PSRAM
+class EspClass {
+  public:
+    uint32_t getHeapSize();
+    uint32_t getFreeHeap();
+    uint32_t getPsramSize();
+    uint32_t getFreePsram();
+    uint32_t getCpuFreqMHz() { return 240; }
+    void restart();
+};
+
+extern EspClass ESP;
+
+void setup();
+void loop();
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "WiFiClientSecure.h"
+#include <Arduino.h>
+#include <vector>
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED (-4)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_NO_STREAM (-6)
+#define HTTPC_ERROR_NO_HTTP_SERVER (-7)
+#define HTTPC_ERROR_TOO_LESS_RAM (-8)
+#define HTTPC_ERROR_ENCODING (-9)
+#define HTTPC_ERROR_STREAM_WRITE (-10)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+#define HTTP_CODE_OK 200
+#define HTTP_CODE_TOO_MANY_REQUESTS 429
+
+// The GET path of the Arduino HTTPClient: the request goes out on the client given to begin(), the
+// response headers are parsed and the body is left on the stream, chunked or not, as on the device
+class HTTPClient {
+  public:
+    bool begin(WiFiClient &client, const char *host, uint16_t port, const char *uri = "/",
+               bool https = false);
+    void end();
+    void setReuse(bool reuse) { this->reuse = reuse; }
+    void setTimeout(uint16_t timeoutMs) { this->timeoutMs = timeoutMs; }
+    void collectHeaders(const char *headerKeys[], const size_t headerKeysCount);
+    int GET();
+    String header(const char *name);
+    int getSize() { return size; }
+    WiFiClient &getStream() { return *client; }
+    WiFiClient *getStreamPtr() { return client; }
+    static String errorToString(int error);
+
+  private:
+    struct Header {
+        String Key;
+        String Value;
+    };
+
+    WiFiClient *client = nullptr;
+    String host, uri;
+    uint16_t port = 80;
+    bool reuse = true;
+    bool keepAlive = false;
+    uint16_t timeoutMs = 5000;
+    int size = -1;
+    std::vector<Header> headers;
+
+    bool readLine(String &line);
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "WString.h"
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size) {
+        size_t n = 0;
+        while(size-- && write(*buffer++))
+            n++;
+        return n;
+    }
+    size_t write(const char *text) { return write((const uint8_t *)text, strlen(text)); }
+    virtual void flush() {}
+
+    size_t print(const char *text) { return write(text); }
+    size_t print(const String &text) { return write(text.c_str()); }
+    size_t print(int value) { return printf("%d", value); }
+    size_t println(const char *text = "") { return print(text) + print("\r\n"); }
+    size_t println(const String &text) { return print(text) + print("\r\n"); }
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+// Reads time out after setTimeout() ms of real time, whatever the virtual clock does
+class Stream : public Print {
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual size_t readBytes(char *buffer, size_t length);
+    size_t readBytes(uint8_t *buffer, size_t length) { return readBytes((char *)buffer, length); }
+    void setTimeout(unsigned long ms) { timeoutMs = ms; }
+    unsigned long getTimeout() const { return timeoutMs; }
+
+  protected:
+    unsigned long timeoutMs = 1000;
+    int timedRead();
+};
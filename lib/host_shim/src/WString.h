@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+// The parts of the Arduino String the firmware and ArduinoJson use
+class String {
+  public:
+    String(const char *text = "") : s(text ? text : "") {}
+    String(const std::string &text) : s(text) {}
+    explicit String(char c) : s(1, c) {}
+    explicit String(int value, unsigned char base = 10) : s(Number(value, base)) {}
+    explicit String(unsigned int value, unsigned char base = 10) : s(Number(value, base)) {}
+    explicit String(long value, unsigned char base = 10) : s(Number(value, base)) {}
+    explicit String(unsigned long value, unsigned char base = 10) : s(Number(value, base)) {}
+    explicit String(float value, unsigned int decimals = 2) : s(Fixed(value, decimals)) {}
+    explicit String(double value, unsigned int decimals = 2) : s(Fixed(value, decimals)) {}
+
+    const char *c_str() const { return s.c_str(); }
+    unsigned int length() const { return s.size(); }
+    bool isEmpty() const { return s.empty(); }
+    bool reserve(unsigned int size) {
+        s.reserve(size);
+        return true;
+    }
+    char charAt(unsigned int index) const { return index < s.size() ? s[index] : 0; }
+    char operator[](unsigned int index) const { return charAt(index); }
+
+    String &operator=(const char *text) {
+        s = text ? text : "";
+        return *this;
+    }
+    bool concat(const String &other) {
+        s += other.s;
+        return true;
+    }
+    bool concat(const char *text) {
+        s += text ? text : "";
+        return true;
+    }
+    bool concat(char c) {
+        s += c;
+        return true;
+    }
+    String &operator+=(const String &other) { return concat(other), *this; }
+    String &operator+=(const char *text) { return concat(text), *this; }
+    String &operator+=(char c) { return concat(c), *this; }
+
+    friend String operator+(const String &a, const String &b) { return String(a.s + b.s); }
+    friend String operator+(const String &a, const char *b) { return String(a.s + (b ? b : "")); }
+    friend String operator+(const char *a, const String &b) { return String((a ? a : "") + b.s); }
+    friend String operator+(const String &a, char b) { return String(a.s + b); }
+
+    bool equals(const String &other) const { return s == other.s; }
+    bool equals(const char *text) const { return s == (text ? text : ""); }
+    bool operator==(const String &other) const { return equals(other); }
+    bool operator==(const char *text) const { return equals(text); }
+    bool operator!=(const String &other) const { return !equals(other); }
+    bool operator!=(const char *text) const { return !equals(text); }
+    bool operator<(const String &other) const { return s < other.s; }
+    int compareTo(const String &other) const { return s.compare(other.s); }
+
+    bool startsWith(const String &prefix) const { return s.compare(0, prefix.s.size(), prefix.s) == 0; }
+    bool endsWith(const String &suffix) const {
+        size_t n = suffix.s.size();
+        return s.size() >= n && s.compare(s.size() - n, n, suffix.s) == 0;
+    }
+    int indexOf(char c, unsigned int from = 0) const { return Position(s.find(c, from)); }
+    int indexOf(const String &text, unsigned int from = 0) const { return Position(s.find(text.s, from)); }
+    int lastIndexOf(char c) const { return Position(s.rfind(c)); }
+    String substring(unsigned int from) const { return from < s.size() ? String(s.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const {
+        if(from > to)
+            std::swap(from, to);
+        return from < s.size() ? String(s.substr(from, to - from)) : String();
+    }
+    void replace(const String &from, const String &to) {
+        if(from.s.empty())
+            return;
+        for(size_t at = s.find(from.s); at != std::string::npos; at = s.find(from.s, at + to.s.size()))
+            s.replace(at, from.s.size(), to.s);
+    }
+    void remove(unsigned int index, unsigned int count = (unsigned int)-1) {
+        if(index < s.size())
+            s.erase(index, count);
+    }
+    void toUpperCase() {
+        for(char &c : s)
+            c = toupper((unsigned char)c);
+    }
+    void toLowerCase() {
+        for(char &c : s)
+            c = tolower((unsigned char)c);
+    }
+    void trim() {
+        size_t first = s.find_first_not_of(" \t\r\n");
+        size_t last = s.find_last_not_of(" \t\r\n");
+        s = first == std::string::npos ? "" : s.substr(first, last - first + 1);
+    }
+    long toInt() const { return atol(s.c_str()); }
+    float toFloat() const { return atof(s.c_str()); }
+
+  private:
+    std::string s;
+
+    static int Position(size_t at) { return at == std::string::npos ? -1 : (int)at; }
+    template <typename T> static std::string Number(T value, unsigned char base) {
+        if(base == 10)
+            return std::to_string(value);
+        bool negative = value < 0;
+        unsigned long long magnitude = (unsigned long long)value;
+        if(negative)
+            magnitude = 0ULL - magnitude;
+        std::string digits;
+        do {
+            digits.insert(digits.begin(), "0123456789abcdefghijklmnopqrstuvwxyz"[magnitude % base]);
+            magnitude /= base;
+        } while(magnitude);
+        return negative ? "-" + digits : digits;
+    }
+    static std::string Fixed(double value, unsigned int decimals) {
+        char buffer[48];
+        snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+        return buffer;
+    }
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "IPAddress.h"
+#include "WiFiClient.h"
+#include <Arduino.h>
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_SCAN_COMPLETED = 2,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6,
+    WL_NO_SHIELD = 255,
+} wl_status_t;
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+// Association takes HostWifiConnectMs of virtual time, or fails after the timeout when
+// HostSetWifiAvailable(false) took the network away
+constexpr uint32_t HostWifiConnectMs = 1200;
+
+class WiFiClass {
+  public:
+    wl_status_t begin(const char *ssid, const char *passphrase = nullptr);
+    uint8_t waitForConnectResult(unsigned long timeoutLength = 60000);
+    bool disconnect(bool wifioff = false);
+    bool mode(wifi_mode_t mode);
+    bool setAutoConnect(bool autoConnect) { return true; }
+    bool setAutoReconnect(bool autoReconnect) { return true; }
+    wl_status_t status();
+    int8_t RSSI();
+    IPAddress localIP();
+    int hostByName(const char *host, IPAddress &result);
+
+  private:
+    wl_status_t state = WL_DISCONNECTED;
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "IPAddress.h"
+#include "Stream.h"
+#include <memory>
+
+// A TCP connection through a POSIX socket, after the redirects of HostRedirect(). Copies share the socket
+// like the Arduino client.
+class WiFiClient : public Stream {
+  public:
+    WiFiClient();
+    virtual ~WiFiClient();
+
+    virtual int connect(const char *host, uint16_t port);
+    virtual int connect(const char *host, uint16_t port, int32_t timeoutMs);
+    virtual int connect(IPAddress ip, uint16_t port);
+    virtual void stop();
+    virtual uint8_t connected();
+    explicit operator bool() { return connected(); }
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+    int available() override;
+    int read() override;
+    int read(uint8_t *buffer, size_t size);
+    int peek() override;
+    size_t readBytes(char *buffer, size_t length) override;
+
+  protected:
+    struct Socket;
+    std::shared_ptr<Socket> socket;
+};
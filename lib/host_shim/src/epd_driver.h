@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+
+// The panel of LilyGo-EPD47 as a memory buffer (see HostPanel()), with the font types of the library
+#define EPD_WIDTH 960
+#define EPD_HEIGHT 540
+
+typedef struct {
+    int x;
+    int y;
+    int width;
+    int height;
+} Rect_t;
+
+typedef struct {
+    uint8_t width;
+    uint8_t height;
+    uint8_t advance_x;
+    int16_t left;
+    int16_t top;
+    uint16_t compressed_size;
+    uint32_t data_offset;
+} GFXglyph;
+
+typedef struct {
+    uint32_t first;
+    uint32_t last;
+    uint32_t offset;
+} UnicodeInterval;
+
+typedef struct {
+    uint8_t *bitmap;
+    GFXglyph *glyph;
+    UnicodeInterval *intervals;
+    uint32_t interval_count;
+    bool compressed;
+    uint8_t advance_y;
+    int ascender;
+    int descender;
+} GFXfont;
+
+void epd_init();
+void epd_poweron();
+void epd_poweroff();
+void epd_poweroff_all();
+Rect_t epd_full_screen();
+void epd_clear();
+void epd_clear_area(Rect_t area);
+// data is 4 bit, rows of area.width pixels padded to whole bytes
+void epd_draw_grayscale_image(Rect_t area, uint8_t *data);
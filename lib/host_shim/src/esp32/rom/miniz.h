@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstddef>
+
+// the one call of the ROM inflater the fonts need, done with the zlib of the host
+#define TINFL_FLAG_PARSE_ZLIB_HEADER 1
+#define TINFL_DECOMPRESS_MEM_TO_MEM_FAILED ((size_t)(-1))
+
+size_t tinfl_decompress_mem_to_mem(void *out, size_t outSize, const void *src, size_t srcSize, int flags);
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <sys/time.h>
+
+// configTime() syncs at once to the world time of the shim and calls the notification
+typedef void (*sntp_sync_time_cb_t)(struct timeval *tv);
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback);
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+
+// Control of the host shim, the Arduino and ESP-IDF interfaces of the firmware on Linux.
+//
+// Time is virtual: delay(), vTaskDelay() and deep sleep move the clock without waiting, everything else
+// runs in real time unless the clock is frozen, when only those calls move it. The wall clock of the
+// device starts unset at 1970 like the RTC after power on, NTP sets it to the world time, which starts at
+// HOST_EPOCH or the time of the host. The network is the host's, host names and ports can be redirected
+// to a stand-in server (tools/owm_server.py) and WiFi can be switched off. The panel is a 4 bit buffer.
+
+// Clock
+int64_t HostUptimeUs();                 // since the current boot, what esp_timer_get_time() returns
+void HostAdvanceUs(int64_t us);         // moves the clock of the device and the world
+void HostFreezeClock(bool frozen);      // only delays and sleep move the clock, for reproducible runs
+time_t HostWorldTime();                 // the time NTP and the stand-in network agree on
+void HostSetWorldTime(time_t now);
+void HostSetDriftPpm(int ppm);          // how much faster the device clock runs than the world
+
+// Everything the clocks are, to carry them into another process, e.g. from a wake run in a child
+typedef struct {
+    int64_t ClockUs;                    // the virtual clock, of which the uptime is a part
+    int64_t WorldUs;                    // world time
+    int64_t DeviceUs;                   // device wall clock
+    int DriftPpm;
+} Host_clock_state_type;
+
+Host_clock_state_type HostClockState();
+void HostRestoreClockState(const Host_clock_state_type &state); // freezes the clock
+
+// Deep sleep ends the wake in the handler, which must not return. The default one exits the process. A
+// handler that runs more wakes moves the clock over the sleep and calls HostBoot() before setup().
+typedef void (*Host_sleep_handler_type)(uint64_t sleepUs);
+void HostOnDeepSleep(Host_sleep_handler_type handler);
+void HostBoot(bool coldBoot);           // starts a wake, a cold boot also resets the RTC and its memory
+void HostRtcMemory(uint8_t **start, size_t *size); // RTC_DATA_ATTR variables, kept across deep sleep
+
+// Network
+void HostSetWifiAvailable(bool available);
+void HostRedirect(const char *from, const char *to); // "host:port" to "address:port", see HOST_REDIRECT
+
+// Panel, 4 bits per pixel with even x in the low nibble like the framebuffer
+const uint8_t *HostPanel();
+bool HostPanelWritePgm(const char *path);
+uint32_t HostPanelUpdates();            // images drawn and areas cleared since boot
+int64_t HostPanelBusyUs();              // time the panel spent driving them
+
+// Heap of the whole process, the shim replaces malloc() so the allocations of libraries and of the C++
+// runtime count too. Sizes are what the allocator handed out, including its rounding.
+typedef struct {
+    uint64_t Allocations;               // since start, a realloc() that moves or grows counts
+    size_t Live;                        // bytes allocated now
+    size_t Peak;                        // most bytes allocated at once since start or HostHeapResetPeak()
+} Host_heap_type;
+
+Host_heap_type HostHeap();
+void HostHeapResetPeak();               // to the live bytes, to measure the peak of some code
@@ -0,0 +1,91 @@
+#include "esp_sleep.h"
+#include "esp_system.h"
+#include "host.h"
+#include "host_internal.h"
+#include <Arduino.h>
+#include <cstring>
+#include <vector>
+
+// RTC_DATA_ATTR variables, the linker marks the bounds of their section
+extern uint8_t __start_rtc_data[] __attribute__((weak));
+extern uint8_t __stop_rtc_data[] __attribute__((weak));
+
+namespace {
+
+esp_reset_reason_t resetReason = ESP_RST_POWERON;
+uint64_t sleepTimerUs = 0;
+
+// the RTC memory as the program starts, a cold boot goes back to it; built on first use because the
+// constructor below can run before the initializers of this file
+std::vector<uint8_t> &RtcImage() {
+    static std::vector<uint8_t> image;
+    return image;
+}
+
+__attribute__((constructor)) void SaveRtcImage() { RtcImage().assign(__start_rtc_data, __stop_rtc_data); }
+
+void ExitOnSleep(uint64_t sleepUs) {
+    const char *panel = getenv("HOST_PANEL");
+    if(panel && !HostPanelWritePgm(panel))
+        fprintf(stderr, "host: cannot write the panel to %s\n", panel);
+    fprintf(stderr, "host: deep sleep for %llu s after %lld ms awake\n",
+            (unsigned long long)(sleepUs / 1000000), (long long)(HostUptimeUs() / 1000));
+    fflush(stdout);
+    exit(0);
+}
+
+Host_sleep_handler_type sleepHandler = ExitOnSleep;
+
+} // namespace
+
+const char *HostEnv(const char *name, const char *fallback) {
+    const char *value = getenv(name);
+    return value ? value : fallback;
+}
+
+void HostOnDeepSleep(Host_sleep_handler_type handler) { sleepHandler = handler ? handler : ExitOnSleep; }
+
+void HostBoot(bool coldBoot) {
+    HostClockBoot(coldBoot);
+    resetReason = coldBoot ? ESP_RST_POWERON : ESP_RST_DEEPSLEEP;
+    if(coldBoot && !RtcImage().empty())
+        memcpy(__start_rtc_data, RtcImage().data(), RtcImage().size());
+}
+
+void HostRtcMemory(uint8_t **start, size_t *size) {
+    *start = __start_rtc_data;
+    *size = __stop_rtc_data - __start_rtc_data;
+}
+
+esp_reset_reason_t esp_reset_reason() { return resetReason; }
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() {
+    return resetReason == ESP_RST_DEEPSLEEP ? ESP_SLEEP_WAKEUP_TIMER : ESP_SLEEP_WAKEUP_UNDEFINED;
+}
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t time_in_us) {
+    sleepTimerUs = time_in_us;
+    return ESP_OK;
+}
+
+void esp_deep_sleep_start() {
+    sleepHandler(sleepTimerUs);
+    fprintf(stderr, "host: the deep sleep handler returned\n");
+    abort();
+}
+
+// a restart is a cold boot that keeps nothing, which a single process cannot do
+void esp_restart() {
+    fprintf(stderr, "host: restart after %lld ms\n", (long long)(HostUptimeUs() / 1000));
+    fflush(stdout);
+    exit(2);
+}
+
+void EspClass::restart() { esp_restart(); }
+
+// Runs the sketch like the Arduino core; tests and tools linking the firmware bring their own main()
+__attribute__((weak)) int main() {
+    setup();
+    for(;;)
+        loop();
+}
@@ -0,0 +1,191 @@
+#include "esp_sntp.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "host.h"
+#include "host_internal.h"
+#include <Arduino.h>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+// the ROM and the bootloader run before the uptime reaches setup()
+constexpr int64_t BootloaderUs = 300000;
+
+std::mutex clockLock;
+int64_t advancedUs = 0;    // by delays, sleep and HostAdvanceUs()
+int64_t realOriginUs = -1; // real time counts from here, unless frozen
+bool frozen = false;
+
+int64_t worldOriginUs = 0; // world time at clock 0
+int64_t deviceBaseUs = 0;  // device wall clock when it was last set
+int64_t deviceSetUs = 0;   // clock at that moment
+int driftPpm = 0;
+int64_t bootUs = -BootloaderUs;
+
+sntp_sync_time_cb_t syncCallback = nullptr;
+
+int64_t HostTimeUs(clockid_t clock) {
+    timespec ts;
+    clock_gettime(clock, &ts);
+    return ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+}
+
+int64_t MonotonicUs() { return HostTimeUs(CLOCK_MONOTONIC); }
+
+int64_t ClockLocked() {
+    if(realOriginUs < 0) {
+        // the first reading starts the clock, and the world at HOST_EPOCH or the time of the host
+        realOriginUs = MonotonicUs();
+        const char *epoch = getenv("HOST_EPOCH");
+        worldOriginUs = epoch ? strtoll(epoch, nullptr, 10) * 1000000LL : HostTimeUs(CLOCK_REALTIME);
+    }
+    return advancedUs + (frozen ? 0 : MonotonicUs() - realOriginUs);
+}
+
+int64_t DeviceTimeUs() {
+    std::lock_guard<std::mutex> lock(clockLock);
+    return deviceBaseUs + (ClockLocked() - deviceSetUs) * (1000000 + driftPpm) / 1000000;
+}
+
+void SetDeviceTimeUs(int64_t us) {
+    std::lock_guard<std::mutex> lock(clockLock);
+    deviceBaseUs = us;
+    deviceSetUs = ClockLocked();
+}
+
+} // namespace
+
+int64_t HostClockUs() {
+    std::lock_guard<std::mutex> lock(clockLock);
+    return ClockLocked();
+}
+
+void HostAdvanceToUs(int64_t clockUs) {
+    {
+        std::lock_guard<std::mutex> lock(clockLock);
+        int64_t now = ClockLocked();
+        if(clockUs > now)
+            advancedUs += clockUs - now;
+    }
+    std::this_thread::yield();
+}
+
+void HostAdvanceUs(int64_t us) {
+    std::lock_guard<std::mutex> lock(clockLock);
+    advancedUs += us;
+}
+
+void HostFreezeClock(bool freeze) {
+    std::lock_guard<std::mutex> lock(clockLock);
+    int64_t now = ClockLocked();
+    if(freeze == frozen)
+        return;
+    frozen = freeze;
+    realOriginUs = MonotonicUs();
+    advancedUs = now;
+}
+
+int64_t HostUptimeUs() { return HostClockUs() - bootUs; }
+
+time_t HostWorldTime() {
+    std::lock_guard<std::mutex> lock(clockLock);
+    return (worldOriginUs + ClockLocked()) / 1000000;
+}
+
+void HostSetWorldTime(time_t now) {
+    std::lock_guard<std::mutex> lock(clockLock);
+    worldOriginUs = now * 1000000LL - ClockLocked();
+}
+
+void HostSetDriftPpm(int ppm) {
+    int64_t now = DeviceTimeUs();
+    SetDeviceTimeUs(now);
+    std::lock_guard<std::mutex> lock(clockLock);
+    driftPpm = ppm;
+}
+
+Host_clock_state_type HostClockState() {
+    std::lock_guard<std::mutex> lock(clockLock);
+    int64_t now = ClockLocked();
+    return {now, worldOriginUs + now, deviceBaseUs + (now - deviceSetUs) * (1000000 + driftPpm) / 1000000,
+            driftPpm};
+}
+
+void HostRestoreClockState(const Host_clock_state_type &state) {
+    std::lock_guard<std::mutex> lock(clockLock);
+    ClockLocked();
+    frozen = true;
+    advancedUs = state.ClockUs;
+    worldOriginUs = state.WorldUs - state.ClockUs;
+    deviceBaseUs = state.DeviceUs;
+    deviceSetUs = state.ClockUs;
+    driftPpm = state.DriftPpm;
+}
+
+void HostClockBoot(bool coldBoot) {
+    bootUs = HostClockUs() - BootloaderUs;
+    if(coldBoot)
+        SetDeviceTimeUs(0); // the RTC starts again at 1970
+}
+
+// The wall clock of the device, in place of the one of the C library
+extern "C" time_t time(time_t *out) noexcept {
+    time_t now = DeviceTimeUs() / 1000000;
+    if(out)
+        *out = now;
+    return now;
+}
+
+extern "C" int gettimeofday(struct timeval *tv, void *tz) noexcept {
+    int64_t now = DeviceTimeUs();
+    tv->tv_sec = now / 1000000;
+    tv->tv_usec = now % 1000000;
+    return 0;
+}
+
+extern "C" int settimeofday(const struct timeval *tv, const struct timezone *tz) noexcept {
+    if(tv)
+        SetDeviceTimeUs(tv->tv_sec * 1000000LL + tv->tv_usec);
+    return 0;
+}
+
+int64_t esp_timer_get_time() { return HostUptimeUs(); }
+
+unsigned long millis() { return HostUptimeUs() / 1000; }
+
+unsigned long micros() { return HostUptimeUs(); }
+
+void delay(uint32_t ms) { HostAdvanceToUs(HostClockUs() + ms * 1000LL); }
+
+void delayMicroseconds(uint32_t us) { HostAdvanceToUs(HostClockUs() + us); }
+
+void vTaskDelay(TickType_t ticks) { delay(ticks * portTICK_PERIOD_MS); }
+
+TickType_t xTaskGetTickCount() { return millis() / portTICK_PERIOD_MS; }
+
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback) { syncCallback = callback; }
+
+// An NTP round trip, when there is a network. The time zone is left to the firmware, which sets TZ itself.
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char *server1, const char *server2,
+                const char *server3) {
+    if(!HostWifiConnected())
+        return;
+    delay(40);
+    struct timeval tv = {HostWorldTime(), 0};
+    settimeofday(&tv, nullptr);
+    if(syncCallback)
+        syncCallback(&tv);
+}
+
+bool getLocalTime(struct tm *info, uint32_t ms) {
+    uint32_t start = millis();
+    time_t now;
+    while((now = time(nullptr)) < 1451602800) { // 2016, as the Arduino core checks
+        if(millis() - start > ms)
+            return false;
+        delay(10);
+    }
+    localtime_r(&now, info);
+    return true;
+}
@@ -0,0 +1,98 @@
+#include "epd_driver.h"
+#include "host.h"
+#include "host_internal.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+// The time the driver takes, modeled on the panel: the waveform passes scale with the rows of the area
+constexpr int64_t FullClearUs = 900000;
+constexpr int64_t FullImageUs = 550000;
+constexpr int RowBytes = EPD_WIDTH / 2;
+
+uint8_t panel[RowBytes * EPD_HEIGHT];
+uint32_t updates = 0;
+int64_t busyUs = 0;
+bool initialized = false;
+
+void Init() {
+    if(!initialized)
+        memset(panel, 0xFF, sizeof(panel)), initialized = true;
+}
+
+uint8_t PixelAt(const uint8_t *data, int rowBytes, int x, int y) {
+    uint8_t byte = data[y * rowBytes + x / 2];
+    return (x & 1) ? byte >> 4 : byte & 0x0F;
+}
+
+void SetPixel(int x, int y, uint8_t shade) {
+    uint8_t &byte = panel[y * RowBytes + x / 2];
+    byte = (x & 1) ? (byte & 0x0F) | shade << 4 : (byte & 0xF0) | shade;
+}
+
+void Busy(int64_t fullUs, int rows) {
+    HostAdvanceToUs(HostClockUs() + fullUs * rows / EPD_HEIGHT);
+    busyUs += fullUs * rows / EPD_HEIGHT;
+    updates++;
+}
+
+} // namespace
+
+void epd_init() { Init(); }
+
+void epd_poweron() {}
+
+void epd_poweroff() {}
+
+void epd_poweroff_all() {}
+
+Rect_t epd_full_screen() { return {0, 0, EPD_WIDTH, EPD_HEIGHT}; }
+
+void epd_clear() { epd_clear_area(epd_full_screen()); }
+
+void epd_clear_area(Rect_t area) {
+    Init();
+    int x0 = std::max(area.x, 0), x1 = std::min(area.x + area.width, EPD_WIDTH);
+    int y0 = std::max(area.y, 0), y1 = std::min(area.y + area.height, EPD_HEIGHT);
+    for(int y = y0; y < y1; y++)
+        for(int x = x0; x < x1; x++)
+            SetPixel(x, y, 0x0F);
+    Busy(FullClearUs, std::max(y1 - y0, 0));
+}
+
+// pixels only get darker, the driver drives white pixels of the image as no change
+void epd_draw_grayscale_image(Rect_t area, uint8_t *data) {
+    Init();
+    int rowBytes = (area.width + 1) / 2;
+    int y0 = std::max(area.y, 0), y1 = std::min(area.y + area.height, EPD_HEIGHT);
+    for(int y = y0; y < y1; y++)
+        for(int x = std::max(area.x, 0); x < std::min(area.x + area.width, EPD_WIDTH); x++) {
+            uint8_t shade = PixelAt(data, rowBytes, x - area.x, y - area.y);
+            if(shade < PixelAt(panel, RowBytes, x, y))
+                SetPixel(x, y, shade);
+        }
+    Busy(FullImageUs, std::max(y1 - y0, 0));
+}
+
+const uint8_t *HostPanel() {
+    Init();
+    return panel;
+}
+
+bool HostPanelWritePgm(const char *path) {
+    Init();
+    FILE *file = fopen(path, "wb");
+    if(!file)
+        return false;
+    fprintf(file, "P5\n%d %d\n15\n", EPD_WIDTH, EPD_HEIGHT);
+    for(int y = 0; y < EPD_HEIGHT; y++)
+        for(int x = 0; x < EPD_WIDTH; x++)
+            fputc(PixelAt(panel, RowBytes, x, y), file);
+    return fclose(file) == 0;
+}
+
+uint32_t HostPanelUpdates() { return updates; }
+
+int64_t HostPanelBusyUs() { return busyUs; }
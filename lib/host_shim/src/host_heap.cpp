@@ -0,0 +1,92 @@
+#include "host.h"
+#include <atomic>
+#include <cerrno>
+#include <malloc.h>
+
+// glibc lets a program replace malloc() as a whole, calls from shared libraries included. The replacement
+// forwards to the allocator of glibc and counts. See "Replacing malloc" in the glibc manual.
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void __libc_free(void *ptr);
+void *__libc_memalign(size_t alignment, size_t size);
+}
+
+namespace {
+
+std::atomic<uint64_t> allocationCount(0);
+std::atomic<size_t> liveBytes(0);
+std::atomic<size_t> peakBytes(0);
+
+void *Counted(void *ptr) {
+    if(!ptr)
+        return ptr;
+    size_t size = malloc_usable_size(ptr);
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    size_t live = liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    size_t peak = peakBytes.load(std::memory_order_relaxed);
+    while(live > peak && !peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+    return ptr;
+}
+
+void Uncounted(void *ptr) {
+    if(ptr)
+        liveBytes.fetch_sub(malloc_usable_size(ptr), std::memory_order_relaxed);
+}
+
+} // namespace
+
+extern "C" {
+
+void *malloc(size_t size) noexcept { return Counted(__libc_malloc(size)); }
+
+void *calloc(size_t count, size_t size) noexcept { return Counted(__libc_calloc(count, size)); }
+
+void *realloc(void *ptr, size_t size) noexcept {
+    if(!ptr)
+        return malloc(size);
+    if(!size) {
+        free(ptr);
+        return nullptr;
+    }
+    size_t before = malloc_usable_size(ptr);
+    void *moved = __libc_realloc(ptr, size);
+    if(!moved)
+        return nullptr;
+    if(moved == ptr && malloc_usable_size(moved) <= before) {
+        liveBytes.fetch_sub(before - malloc_usable_size(moved), std::memory_order_relaxed);
+        return moved;
+    }
+    liveBytes.fetch_sub(before, std::memory_order_relaxed);
+    return Counted(moved);
+}
+
+void free(void *ptr) noexcept {
+    Uncounted(ptr);
+    __libc_free(ptr);
+}
+
+void *memalign(size_t alignment, size_t size) noexcept { return Counted(__libc_memalign(alignment, size)); }
+
+void *aligned_alloc(size_t alignment, size_t size) noexcept { return memalign(alignment, size); }
+
+int posix_memalign(void **ptr, size_t alignment, size_t size) noexcept {
+    void *aligned = memalign(alignment, size);
+    if(!aligned)
+        return ENOMEM;
+    *ptr = aligned;
+    return 0;
+}
+}
+
+Host_heap_type HostHeap() {
+    return {allocationCount.load(std::memory_order_relaxed), liveBytes.load(std::memory_order_relaxed),
+            peakBytes.load(std::memory_order_relaxed)};
+}
+
+void HostHeapResetPeak() {
+    peakBytes.store(liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
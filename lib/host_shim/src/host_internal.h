@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+// Shared between the parts of the shim, not for the firmware
+
+// The virtual clock since the process started. Delays move it to their end, so delays running at the
+// same time in several tasks move it once.
+int64_t HostClockUs();
+void HostAdvanceToUs(int64_t clockUs);
+void HostClockBoot(bool coldBoot);
+
+bool HostWifiAvailable();
+bool HostWifiConnected();
+
+// getenv() with a default
+const char *HostEnv(const char *name, const char *fallback);
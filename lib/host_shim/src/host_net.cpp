@@ -0,0 +1,412 @@
+#include "HTTPClient.h"
+#include "WiFi.h"
+#include "host.h"
+#include "host_internal.h"
+#include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
+#include <fcntl.h>
+#include <map>
+#include <mutex>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <string>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+WiFiClass WiFi;
+
+namespace {
+
+std::atomic<bool> wifiAvailable{true};
+std::atomic<bool> wifiConnected{false};
+
+std::mutex redirectLock;
+std::map<std::string, std::string> redirects; // "host:port" -> "address:port"
+bool redirectsLoaded = false;
+
+// HOST_REDIRECT is a comma separated list of from=to pairs
+void LoadRedirects() {
+    if(redirectsLoaded)
+        return;
+    redirectsLoaded = true;
+    std::string list = HostEnv("HOST_REDIRECT", "");
+    size_t start = 0;
+    while(start < list.size()) {
+        size_t end = list.find(',', start);
+        if(end == std::string::npos)
+            end = list.size();
+        std::string pair = list.substr(start, end - start);
+        size_t equals = pair.find('=');
+        if(equals != std::string::npos)
+            redirects[pair.substr(0, equals)] = pair.substr(equals + 1);
+        start = end + 1;
+    }
+}
+
+void Redirect(std::string &host, uint16_t &port) {
+    std::lock_guard<std::mutex> lock(redirectLock);
+    LoadRedirects();
+    auto found = redirects.find(host + ":" + std::to_string(port));
+    if(found == redirects.end())
+        return;
+    size_t colon = found->second.rfind(':');
+    host = found->second.substr(0, colon);
+    if(colon != std::string::npos)
+        port = atoi(found->second.c_str() + colon + 1);
+}
+
+// the address of a redirect for any port of host, for the DNS lookup that comes before the connection
+bool RedirectedAddress(const std::string &host, std::string &address) {
+    std::lock_guard<std::mutex> lock(redirectLock);
+    LoadRedirects();
+    for(const auto &redirect : redirects)
+        if(redirect.first.compare(0, host.size() + 1, host + ":") == 0) {
+            address = redirect.second.substr(0, redirect.second.rfind(':'));
+            return true;
+        }
+    return false;
+}
+
+bool Resolve(const std::string &host, uint16_t port, sockaddr_in *address) {
+    addrinfo hints = {};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo *result;
+    if(getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &result) != 0)
+        return false;
+    *address = *(sockaddr_in *)result->ai_addr;
+    freeaddrinfo(result);
+    return true;
+}
+
+} // namespace
+
+bool HostWifiAvailable() { return wifiAvailable; }
+
+bool HostWifiConnected() { return wifiConnected && wifiAvailable; }
+
+void HostSetWifiAvailable(bool available) { wifiAvailable = available; }
+
+void HostRedirect(const char *from, const char *to) {
+    std::lock_guard<std::mutex> lock(redirectLock);
+    LoadRedirects();
+    redirects[from] = to;
+}
+
+String IPAddress::toString() const {
+    char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", bytes[0], bytes[1], bytes[2], bytes[3]);
+    return String(text);
+}
+
+wl_status_t WiFiClass::begin(const char *ssid, const char *passphrase) {
+    state = WL_DISCONNECTED;
+    return state;
+}
+
+uint8_t WiFiClass::waitForConnectResult(unsigned long timeoutLength) {
+    if(state == WL_DISCONNECTED) {
+        bool up = wifiAvailable;
+        delay(up ? HostWifiConnectMs : timeoutLength);
+        state = up ? WL_CONNECTED : WL_NO_SSID_AVAIL;
+        wifiConnected = up;
+    }
+    return status();
+}
+
+bool WiFiClass::disconnect(bool wifioff) {
+    state = WL_DISCONNECTED;
+    wifiConnected = false;
+    return true;
+}
+
+bool WiFiClass::mode(wifi_mode_t mode) {
+    if(mode == WIFI_OFF)
+        disconnect(true);
+    return true;
+}
+
+wl_status_t WiFiClass::status() {
+    if(state == WL_CONNECTED && !wifiAvailable)
+        state = WL_CONNECTION_LOST;
+    return state;
+}
+
+int8_t WiFiClass::RSSI() { return status() == WL_CONNECTED ? -60 : 0; }
+
+IPAddress WiFiClass::localIP() { return status() == WL_CONNECTED ? IPAddress(192, 168, 1, 50) : IPAddress(); }
+
+int WiFiClass::hostByName(const char *host, IPAddress &result) {
+    if(!HostWifiConnected())
+        return 0;
+    std::string name = host;
+    RedirectedAddress(host, name);
+    sockaddr_in address;
+    if(!Resolve(name, 0, &address))
+        return 0;
+    const uint8_t *bytes = (const uint8_t *)&address.sin_addr.s_addr;
+    result = IPAddress(bytes[0], bytes[1], bytes[2], bytes[3]);
+    return 1;
+}
+
+struct WiFiClient::Socket {
+    int fd = -1;
+    std::string buffer; // received, not yet read
+    size_t position = 0;
+
+    ~Socket() {
+        if(fd >= 0)
+            close(fd);
+    }
+
+    size_t Buffered() const { return buffer.size() - position; }
+
+    // false once the peer closed the connection or it failed
+    bool Fill(int timeoutMs) {
+        if(Buffered())
+            return true;
+        if(fd < 0)
+            return false;
+        pollfd waiting = {fd, POLLIN, 0};
+        if(poll(&waiting, 1, timeoutMs) <= 0)
+            return true;
+        char data[4096];
+        ssize_t n = recv(fd, data, sizeof(data), MSG_DONTWAIT);
+        if(n <= 0)
+            return n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+        buffer.erase(0, position);
+        position = 0;
+        buffer.append(data, n);
+        return true;
+    }
+};
+
+WiFiClient::WiFiClient() {}
+
+WiFiClient::~WiFiClient() {}
+
+int WiFiClient::connect(const char *host, uint16_t port) { return connect(host, port, 3000); }
+
+int WiFiClient::connect(const char *host, uint16_t port, int32_t timeoutMs) {
+    stop();
+    if(!HostWifiConnected())
+        return 0;
+    std::string name = host;
+    Redirect(name, port);
+    sockaddr_in address;
+    if(!Resolve(name, port, &address))
+        return 0;
+    auto connection = std::make_shared<Socket>();
+    connection->fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    if(connection->fd < 0)
+        return 0;
+    // connect with a timeout like lwIP, then back to blocking
+    int flags = fcntl(connection->fd, F_GETFL);
+    fcntl(connection->fd, F_SETFL, flags | O_NONBLOCK);
+    if(::connect(connection->fd, (sockaddr *)&address, sizeof(address)) < 0) {
+        pollfd waiting = {connection->fd, POLLOUT, 0};
+        int error = 0;
+        socklen_t length = sizeof(error);
+        if(errno != EINPROGRESS || poll(&waiting, 1, timeoutMs) <= 0
+           || getsockopt(connection->fd, SOL_SOCKET, SO_ERROR, &error, &length) < 0 || error)
+            return 0;
+    }
+    fcntl(connection->fd, F_SETFL, flags);
+    int noDelay = 1;
+    setsockopt(connection->fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+    socket = connection;
+    return 1;
+}
+
+int WiFiClient::connect(IPAddress ip, uint16_t port) { return connect(ip.toString().c_str(), port); }
+
+void WiFiClient::stop() { socket.reset(); }
+
+uint8_t WiFiClient::connected() {
+    if(!socket)
+        return false;
+    if(!socket->Fill(0)) {
+        socket.reset();
+        return false;
+    }
+    return true;
+}
+
+size_t WiFiClient::write(uint8_t c) { return write(&c, 1); }
+
+size_t WiFiClient::write(const uint8_t *buffer, size_t size) {
+    if(!socket || !HostWifiConnected())
+        return 0;
+    size_t sent = 0;
+    while(sent < size) {
+        ssize_t n = send(socket->fd, buffer + sent, size - sent, MSG_NOSIGNAL);
+        if(n <= 0)
+            break;
+        sent += n;
+    }
+    return sent;
+}
+
+int WiFiClient::available() {
+    if(!socket || !socket->Fill(0))
+        return 0;
+    return socket->Buffered();
+}
+
+int WiFiClient::read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+// like the Arduino client, reads do not wait for data
+int WiFiClient::read(uint8_t *buffer, size_t size) {
+    if(!socket || !HostWifiConnected() || !socket->Fill(0) || !socket->Buffered())
+        return -1;
+    size_t n = std::min(size, socket->Buffered());
+    memcpy(buffer, socket->buffer.data() + socket->position, n);
+    socket->position += n;
+    return n;
+}
+
+int WiFiClient::peek() {
+    if(!socket || !socket->Fill(0) || !socket->Buffered())
+        return -1;
+    return (uint8_t)socket->buffer[socket->position];
+}
+
+// waits up to the stream timeout for the data, in real time
+size_t WiFiClient::readBytes(char *buffer, size_t length) {
+    using namespace std::chrono;
+    auto deadline = steady_clock::now() + milliseconds(timeoutMs);
+    size_t done = 0;
+    while(done < length && socket) {
+        int left = duration_cast<milliseconds>(deadline - steady_clock::now()).count();
+        if(left < 0 || !socket->Fill(left))
+            break;
+        int n = read((uint8_t *)buffer + done, length - done);
+        if(n > 0)
+            done += n;
+    }
+    return done;
+}
+
+bool HTTPClient::begin(WiFiClient &client, const char *host, uint16_t port, const char *uri, bool https) {
+    this->client = &client;
+    this->host = host;
+    this->port = port;
+    this->uri = uri;
+    return true;
+}
+
+void HTTPClient::collectHeaders(const char *headerKeys[], const size_t headerKeysCount) {
+    headers.clear();
+    for(size_t i = 0; i < headerKeysCount; i++)
+        headers.push_back({headerKeys[i], ""});
+}
+
+bool HTTPClient::readLine(String &line) {
+    line = "";
+    char c;
+    while(client->readBytes(&c, 1) == 1) {
+        if(c == '\n') {
+            line.trim();
+            return true;
+        }
+        line += c;
+    }
+    return false;
+}
+
+int HTTPClient::GET() {
+    if(!client)
+        return HTTPC_ERROR_NOT_CONNECTED;
+    if(!client->connected() && !client->connect(host.c_str(), port))
+        return HTTPC_ERROR_CONNECTION_REFUSED;
+    String request = String("GET ") + uri + " HTTP/1.1\r\nHost: " + host + "\r\n"
+        + "User-Agent: ESP32HTTPClient\r\nConnection: " + (reuse ? "keep-alive" : "close") + "\r\n"
+        + "Accept-Encoding: identity;q=1,chunked;q=0.1,*;q=0\r\n\r\n";
+    if(client->write((const uint8_t *)request.c_str(), request.length()) != request.length())
+        return HTTPC_ERROR_SEND_HEADER_FAILED;
+
+    client->setTimeout(timeoutMs);
+    String line;
+    if(!readLine(line))
+        return HTTPC_ERROR_READ_TIMEOUT;
+    int code = line.startsWith("HTTP/1.") ? line.substring(9, 12).toInt() : 0;
+    if(code <= 0)
+        return HTTPC_ERROR_NO_HTTP_SERVER;
+    size = -1;
+    keepAlive = reuse && line.startsWith("HTTP/1.1");
+    for(Header &header : headers)
+        header.Value = "";
+    while(readLine(line) && line.length()) {
+        int colon = line.indexOf(':');
+        if(colon < 0)
+            continue;
+        String key = line.substring(0, colon);
+        String value = line.substring(colon + 1);
+        value.trim();
+        if(strcasecmp(key.c_str(), "Content-Length") == 0)
+            size = value.toInt();
+        else if(strcasecmp(key.c_str(), "Connection") == 0)
+            keepAlive = reuse && strcasecmp(value.c_str(), "close") != 0;
+        for(Header &header : headers)
+            if(strcasecmp(key.c_str(), header.Key.c_str()) == 0)
+                header.Value = value;
+    }
+    return code;
+}
+
+String HTTPClient::header(const char *name) {
+    for(const Header &header : headers)
+        if(strcasecmp(name, header.Key.c_str()) == 0)
+            return header.Value;
+    return String();
+}
+
+// a kept connection drops what is left of the body, as the Arduino client does
+void HTTPClient::end() {
+    if(client && client->connected()) {
+        if(reuse && keepAlive) {
+            uint8_t rest[512];
+            while(client->read(rest, sizeof(rest)) > 0)
+                ;
+        } else {
+            client->stop();
+        }
+    }
+    client = nullptr;
+}
+
+String HTTPClient::errorToString(int error) {
+    switch(error) {
+    case HTTPC_ERROR_CONNECTION_REFUSED:
+        return "connection refused";
+    case HTTPC_ERROR_SEND_HEADER_FAILED:
+        return "send header failed";
+    case HTTPC_ERROR_SEND_PAYLOAD_FAILED:
+        return "send payload failed";
+    case HTTPC_ERROR_NOT_CONNECTED:
+        return "not connected";
+    case HTTPC_ERROR_CONNECTION_LOST:
+        return "connection lost";
+    case HTTPC_ERROR_NO_STREAM:
+        return "no stream";
+    case HTTPC_ERROR_NO_HTTP_SERVER:
+        return "no HTTP server";
+    case HTTPC_ERROR_TOO_LESS_RAM:
+        return "too less ram";
+    case HTTPC_ERROR_ENCODING:
+        return "Transfer-Encoding not supported";
+    case HTTPC_ERROR_STREAM_WRITE:
+        return "Stream write error";
+    case HTTPC_ERROR_READ_TIMEOUT:
+        return "read Timeout";
+    default:
+        return String();
+    }
+}
@@ -0,0 +1,117 @@
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <pthread.h>
+#include <thread>
+#include <vector>
+
+namespace {
+
+thread_local BaseType_t taskCore = 1; // setup() and loop() run on core 1 in the Arduino core
+
+struct Queue {
+    std::mutex lock;
+    std::condition_variable changed;
+    std::deque<std::vector<uint8_t>> items;
+    UBaseType_t length;
+    UBaseType_t itemSize;
+};
+
+// waits in real time, the tasks on the other side of the queue run in real time too
+bool WaitFor(Queue *queue, std::unique_lock<std::mutex> &lock, TickType_t wait, bool (*ready)(Queue *)) {
+    auto check = [queue, ready] { return ready(queue); };
+    if(wait == portMAX_DELAY) {
+        queue->changed.wait(lock, check);
+        return true;
+    }
+    return queue->changed.wait_for(lock, std::chrono::milliseconds(wait * portTICK_PERIOD_MS), check);
+}
+
+} // namespace
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char *name, uint32_t stackDepth,
+                                   void *parameter, UBaseType_t priority, TaskHandle_t *created,
+                                   BaseType_t core) {
+    std::thread([=] {
+        taskCore = core == tskNO_AFFINITY ? 0 : core;
+        code(parameter);
+    }).detach();
+    if(created)
+        *created = nullptr;
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, uint32_t stackDepth, void *parameter,
+                       UBaseType_t priority, TaskHandle_t *created) {
+    return xTaskCreatePinnedToCore(code, name, stackDepth, parameter, priority, created, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    if(task) {
+        fprintf(stderr, "host: vTaskDelete() of another task is not supported\n");
+        abort();
+    }
+    pthread_exit(nullptr);
+}
+
+BaseType_t xPortGetCoreID() { return taskCore; }
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    Queue *queue = new Queue;
+    queue->length = length;
+    queue->itemSize = itemSize;
+    return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t handle, const void *item, TickType_t wait) {
+    Queue *queue = (Queue *)handle;
+    std::unique_lock<std::mutex> lock(queue->lock);
+    if(!WaitFor(queue, lock, wait, [](Queue *q) { return q->items.size() < q->length; }))
+        return pdFAIL;
+    const uint8_t *bytes = (const uint8_t *)item;
+    queue->items.emplace_back(bytes, bytes + queue->itemSize);
+    queue->changed.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t handle, void *item, TickType_t wait) {
+    Queue *queue = (Queue *)handle;
+    std::unique_lock<std::mutex> lock(queue->lock);
+    if(!WaitFor(queue, lock, wait, [](Queue *q) { return !q->items.empty(); }))
+        return pdFAIL;
+    if(queue->itemSize)
+        memcpy(item, queue->items.front().data(), queue->itemSize);
+    queue->items.pop_front();
+    queue->changed.notify_all();
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t handle) {
+    Queue *queue = (Queue *)handle;
+    std::lock_guard<std::mutex> lock(queue->lock);
+    return queue->items.size();
+}
+
+void vQueueDelete(QueueHandle_t handle) { delete (Queue *)handle; }
+
+SemaphoreHandle_t xSemaphoreCreateBinary() { return xQueueCreate(1, 0); }
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t maxCount, UBaseType_t initialCount) {
+    QueueHandle_t queue = xQueueCreate(maxCount, 0);
+    while(initialCount--)
+        xQueueSend(queue, nullptr, 0);
+    return queue;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t wait) {
+    return xQueueReceive(semaphore, nullptr, wait);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) { return xQueueSend(semaphore, nullptr, 0); }
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore) { vQueueDelete(semaphore); }
@@ -0,0 +1,280 @@
+#include "esp32/rom/miniz.h"
+#include "esp_adc_cal.h"
+#include "esp_heap_caps.h"
+#include "esp_partition.h"
+#include "host_internal.h"
+#include "zlib/zlib.h"
+#include <Arduino.h>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+namespace {
+
+// free heap after the Arduino core and WiFi started, and the PSRAM of a 4 MB module
+constexpr size_t InternalHeap = 280 * 1024;
+constexpr size_t PsramHeap = 4192 * 1024;
+
+struct Heap_type {
+    size_t Total;
+    size_t Used;
+    size_t Peak;
+};
+
+std::mutex heapLock;
+Heap_type internalHeap = {InternalHeap, 0, 0};
+Heap_type psramHeap = {PsramHeap, 0, 0};
+std::map<void *, std::pair<size_t, Heap_type *>> allocations;
+
+Heap_type &HeapOf(uint32_t caps) { return (caps & MALLOC_CAP_SPIRAM) ? psramHeap : internalHeap; }
+
+void *Track(void *ptr, size_t size, uint32_t caps) {
+    if(!ptr)
+        return ptr;
+    std::lock_guard<std::mutex> lock(heapLock);
+    Heap_type &heap = HeapOf(caps);
+    heap.Used += size;
+    heap.Peak = std::max(heap.Peak, heap.Used);
+    allocations[ptr] = {size, &heap};
+    return ptr;
+}
+
+bool Fits(size_t size, uint32_t caps) {
+    std::lock_guard<std::mutex> lock(heapLock);
+    Heap_type &heap = HeapOf(caps);
+    return heap.Used + size <= heap.Total;
+}
+
+struct Partition_type {
+    esp_partition_t Info;
+    std::vector<uint8_t> Data;
+};
+
+std::map<std::string, Partition_type> partitions;
+
+} // namespace
+
+#if !defined(__GLIBC__) || !__GLIBC_PREREQ(2, 38)
+extern "C" size_t strlcpy(char *dst, const char *src, size_t size) {
+    size_t length = strlen(src);
+    if(size) {
+        size_t n = std::min(length, size - 1);
+        memcpy(dst, src, n);
+        dst[n] = 0;
+    }
+    return length;
+}
+#endif
+
+int log_printf(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    int n = vprintf(format, args);
+    va_end(args);
+    return n;
+}
+
+size_t Print::printf(const char *format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if(n < 0)
+        return 0;
+    if((size_t)n < sizeof(buffer))
+        return write((const uint8_t *)buffer, n);
+    std::vector<char> large(n + 1);
+    va_start(args, format);
+    vsnprintf(large.data(), large.size(), format, args);
+    va_end(args);
+    return write((const uint8_t *)large.data(), n);
+}
+
+int Stream::timedRead() {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    do {
+        int c = read();
+        if(c >= 0)
+            return c;
+        std::this_thread::yield();
+    } while(std::chrono::steady_clock::now() < deadline);
+    return -1;
+}
+
+size_t Stream::readBytes(char *buffer, size_t length) {
+    size_t n = 0;
+    while(n < length) {
+        int c = timedRead();
+        if(c < 0)
+            break;
+        buffer[n++] = c;
+    }
+    return n;
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps) {
+    return Fits(size, caps) ? Track(malloc(size), size, caps) : nullptr;
+}
+
+void *heap_caps_calloc(size_t count, size_t size, uint32_t caps) {
+    return Fits(count * size, caps) ? Track(calloc(count, size), count * size, caps) : nullptr;
+}
+
+void heap_caps_free(void *ptr) {
+    {
+        std::lock_guard<std::mutex> lock(heapLock);
+        auto found = allocations.find(ptr);
+        if(found != allocations.end()) {
+            found->second.second->Used -= found->second.first;
+            allocations.erase(found);
+        }
+    }
+    free(ptr);
+}
+
+size_t heap_caps_get_total_size(uint32_t caps) { return HeapOf(caps).Total; }
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+    std::lock_guard<std::mutex> lock(heapLock);
+    return HeapOf(caps).Total - HeapOf(caps).Used;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+    std::lock_guard<std::mutex> lock(heapLock);
+    return HeapOf(caps).Total - HeapOf(caps).Peak;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) { return heap_caps_get_free_size(caps); }
+
+void *ps_malloc(size_t size) { return heap_caps_malloc(size, MALLOC_CAP_SPIRAM); }
+
+void *ps_calloc(size_t count, size_t size) { return heap_caps_calloc(count, size, MALLOC_CAP_SPIRAM); }
+
+uint32_t EspClass::getHeapSize() { return heap_caps_get_total_size(MALLOC_CAP_INTERNAL); }
+
+uint32_t EspClass::getFreeHeap() { return heap_caps_get_free_size(MALLOC_CAP_INTERNAL); }
+
+uint32_t EspClass::getPsramSize() { return heap_caps_get_total_size(MALLOC_CAP_SPIRAM); }
+
+uint32_t EspClass::getFreePsram() { return heap_caps_get_free_size(MALLOC_CAP_SPIRAM); }
+
+const char *esp_err_to_name(esp_err_t code) {
+    switch(code) {
+    case ESP_OK:
+        return "ESP_OK";
+    case ESP_FAIL:
+        return "ESP_FAIL";
+    case ESP_ERR_NO_MEM:
+        return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG:
+        return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_NOT_FOUND:
+        return "ESP_ERR_NOT_FOUND";
+    default:
+        return "UNKNOWN ERROR";
+    }
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char *label) {
+    auto found = partitions.find(label);
+    if(found == partitions.end()) {
+        std::string path = std::string(HostEnv("HOST_PARTITIONS", ".")) + "/" + label + ".bin";
+        FILE *file = fopen(path.c_str(), "rb");
+        if(!file)
+            return nullptr;
+        Partition_type &partition = partitions[label];
+        uint8_t block[4096];
+        size_t n;
+        while((n = fread(block, 1, sizeof(block), file)) > 0)
+            partition.Data.insert(partition.Data.end(), block, block + n);
+        fclose(file);
+        partition.Info = {type, subtype, 0, (uint32_t)partition.Data.size(), {}, false};
+        snprintf(partition.Info.label, sizeof(partition.Info.label), "%s", label);
+        found = partitions.find(label);
+    }
+    return &found->second.Info;
+}
+
+static const Partition_type *PartitionOf(const esp_partition_t *info) {
+    for(const auto &partition : partitions)
+        if(&partition.second.Info == info)
+            return &partition.second;
+    return nullptr;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *info, size_t offset, void *dst, size_t size) {
+    const Partition_type *partition = PartitionOf(info);
+    if(!partition || offset + size > partition->Data.size())
+        return ESP_ERR_INVALID_ARG;
+    memcpy(dst, partition->Data.data() + offset, size);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t *info, size_t offset, size_t size,
+                             spi_flash_mmap_memory_t memory, const void **out,
+                             spi_flash_mmap_handle_t *handle) {
+    const Partition_type *partition = PartitionOf(info);
+    if(!partition || offset + size > partition->Data.size())
+        return ESP_ERR_INVALID_ARG;
+    *out = partition->Data.data() + offset;
+    *handle = 0;
+    return ESP_OK;
+}
+
+void spi_flash_munmap(spi_flash_mmap_handle_t handle) {}
+
+esp_adc_cal_value_t esp_adc_cal_characterize(adc_unit_t unit, adc_atten_t atten, adc_bits_width_t width,
+                                             uint32_t defaultVref, esp_adc_cal_characteristics_t *chars) {
+    *chars = {unit, atten, width, 0, 0, defaultVref};
+    return ESP_ADC_CAL_VAL_DEFAULT_VREF;
+}
+
+// the reading of the battery divider of the board for HOST_BATTERY_MV, at the default 1100 mV reference
+uint16_t analogRead(uint8_t pin) {
+    float mv = atof(HostEnv("HOST_BATTERY_MV", "4150"));
+    return std::min(4095.0f, mv / 1000.0f / 6.566f / 1.1f * 4096.0f);
+}
+
+// The ROM inflater keeps its state on the stack, so zlib gets a static arena instead of the heap and the
+// text drawing allocates as little on the host as on the device. Room for the state and a 32 KB window.
+typedef struct {
+    alignas(16) uint8_t Memory[48 * 1024];
+    size_t Used;
+} Inflate_arena_type;
+
+static voidpf ArenaAlloc(voidpf opaque, uInt items, uInt size) {
+    Inflate_arena_type *arena = (Inflate_arena_type *)opaque;
+    size_t bytes = ((size_t)items * size + 15) & ~(size_t)15;
+    if(arena->Used + bytes > sizeof(arena->Memory))
+        return Z_NULL;
+    arena->Used += bytes;
+    return arena->Memory + arena->Used - bytes;
+}
+
+static void ArenaFree(voidpf opaque, voidpf address) {}
+
+size_t tinfl_decompress_mem_to_mem(void *out, size_t outSize, const void *src, size_t srcSize, int flags) {
+    thread_local Inflate_arena_type arena;
+    arena.Used = 0;
+    z_stream stream = {};
+    stream.next_in = (Bytef *)src;
+    stream.avail_in = srcSize;
+    stream.next_out = (Bytef *)out;
+    stream.avail_out = outSize;
+    stream.zalloc = ArenaAlloc;
+    stream.zfree = ArenaFree;
+    stream.opaque = &arena;
+    if(inflateInit2(&stream, flags & TINFL_FLAG_PARSE_ZLIB_HEADER ? MAX_WBITS : -MAX_WBITS) != Z_OK)
+        return TINFL_DECOMPRESS_MEM_TO_MEM_FAILED;
+    int status = inflate(&stream, Z_FINISH);
+    inflateEnd(&stream);
+    return status == Z_STREAM_END ? stream.total_out : TINFL_DECOMPRESS_MEM_TO_MEM_FAILED;
+}
@@ -0,0 +1,159 @@
+#include "bench.h"
+#include "fixtures.h"
+#include "host.h"
+#include <ArduinoJson.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+std::vector<Bench_result_type> results;
+
+int64_t CpuNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+int64_t RealNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+typedef struct {
+    int64_t Real;
+    int64_t Cpu;
+} Batch_type;
+
+Batch_type TimeBatch(const std::function<void()> &body, int64_t iterations) {
+    int64_t real = RealNs(), cpu = CpuNs();
+    for(int64_t i = 0; i < iterations; i++)
+        body();
+    return {RealNs() - real, CpuNs() - cpu};
+}
+
+std::string GitCommit() {
+    std::string commit;
+    std::string command = "git -C '" + ProjectPath("") + "' rev-parse --short HEAD 2>/dev/null";
+    if(FILE *git = popen(command.c_str(), "r")) {
+        char line[64];
+        if(fgets(line, sizeof(line), git))
+            commit.assign(line, strcspn(line, "\n"));
+        pclose(git);
+    }
+    return commit;
+}
+
+// names are ASCII without quotes or backslashes, as the benchmarks choose them
+void Field(std::string &json, const char *name, const std::string &value, const char *separator = ",") {
+    json += std::string("      \"") + name + "\": \"" + value + "\"" + separator + "\n";
+}
+
+void Field(std::string &json, const char *name, double value, const char *separator = ",") {
+    char text[32];
+    snprintf(text, sizeof(text), "%.17g", value);
+    json += std::string("      \"") + name + "\": " + text + separator + "\n";
+}
+
+} // namespace
+
+Bench_result_type *BenchRun(const std::string &name, const std::function<void()> &body, double items,
+                            double bytes) {
+    const char *filter = getenv("BENCH_FILTER");
+    if(filter && name.find(filter) == std::string::npos)
+        return nullptr;
+
+    // the first call warms the caches and the lazy allocations up, the second one measures the heap
+    body();
+    Host_heap_type before = HostHeap();
+    HostHeapResetPeak();
+    body();
+    Host_heap_type after = HostHeap();
+
+    int64_t iterations = 1;
+    Batch_type batch = TimeBatch(body, iterations);
+    while(batch.Real < BenchMinBatchUs * 1000 && iterations < (1LL << 40)) {
+        iterations *= 2;
+        batch = TimeBatch(body, iterations);
+    }
+    Batch_type best = batch;
+    for(int i = 1; i < BenchBatches; i++) {
+        batch = TimeBatch(body, iterations);
+        if(batch.Real < best.Real)
+            best = batch;
+    }
+
+    Bench_result_type result;
+    result.Name = name;
+    result.Iterations = iterations;
+    result.RealNs = (double)best.Real / iterations;
+    result.CpuNs = (double)best.Cpu / iterations;
+    result.Allocations = after.Allocations - before.Allocations;
+    result.PeakBytes = after.Peak - before.Live;
+    if(items)
+        result.Counters.push_back({"items_per_second", items * 1e9 / result.RealNs});
+    if(bytes)
+        result.Counters.push_back({"bytes_per_second", bytes * 1e9 / result.RealNs});
+    printf("%-40s %12.0f ns %10.1f allocs %10zu peak bytes", name.c_str(), result.RealNs, result.Allocations,
+           result.PeakBytes);
+    for(const auto &counter : result.Counters)
+        printf("  %s %.4g", counter.first.c_str(), counter.second);
+    printf("\n");
+    results.push_back(result);
+    return &results.back();
+}
+
+const std::vector<Bench_result_type> &BenchResults() { return results; }
+
+bool BenchWriteJson(const std::string &path) {
+    // the time of the host, not the virtual one of the shim
+    char date[32], host[64] = "";
+    struct timespec now;
+    struct tm local;
+    clock_gettime(CLOCK_REALTIME, &now);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", localtime_r(&now.tv_sec, &local));
+    gethostname(host, sizeof(host) - 1);
+    std::string json = "{\n  \"context\": {\n";
+    Field(json, "date", date);
+    Field(json, "host_name", host);
+    Field(json, "commit", GitCommit());
+    Field(json, "num_cpus", std::thread::hardware_concurrency());
+    // the decode numbers and the goldens depend on the parser lib_deps resolved to
+#ifdef ARDUINOJSON_VERSION
+    Field(json, "arduinojson_version", ARDUINOJSON_VERSION);
+#else
+    Field(json, "arduinojson_version", "unknown");
+#endif
+#ifdef NDEBUG
+    Field(json, "library_build_type", "release", "");
+#else
+    Field(json, "library_build_type", "debug", "");
+#endif
+    json += "  },\n  \"benchmarks\": [\n";
+    for(size_t i = 0; i < results.size(); i++) {
+        const Bench_result_type &result = results[i];
+        json += "    {\n";
+        Field(json, "name", result.Name);
+        Field(json, "run_name", result.Name);
+        Field(json, "run_type", "iteration");
+        Field(json, "repetitions", 1);
+        Field(json, "threads", 1);
+        Field(json, "iterations", result.Iterations);
+        Field(json, "real_time", result.RealNs);
+        Field(json, "cpu_time", result.CpuNs);
+        Field(json, "time_unit", "ns");
+        for(const auto &counter : result.Counters)
+            Field(json, counter.first.c_str(), counter.second);
+        Field(json, "allocs_per_iter", result.Allocations);
+        Field(json, "peak_bytes", result.PeakBytes, "");
+        json += i + 1 < results.size() ? "    },\n" : "    }\n";
+    }
+    json += "  ]\n}\n";
+    return WriteFile(path, json);
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Micro-benchmarks on the host, a small stand-in for Google Benchmark that only needs the shim.
+//
+// BenchRun() calls the body in batches that double in size until one takes BenchMinBatchUs, then keeps
+// the fastest of BenchBatches batches of that size. One more call measures the heap: every result has the
+// allocations per call and the peak bytes one call had allocated at once. BenchWriteJson() saves the
+// results in the JSON format of Google Benchmark, which tools/bench_compare.py compares between commits.
+//
+// BENCH_FILTER runs only the benchmarks whose name contains it.
+constexpr int64_t BenchMinBatchUs = 20000;
+constexpr int BenchBatches = 5;
+
+typedef struct {
+    std::string Name;
+    int64_t Iterations;                // of the fastest batch
+    double RealNs;                     // per iteration
+    double CpuNs;
+    double Allocations;                // per iteration
+    size_t PeakBytes;
+    std::vector<std::pair<std::string, double>> Counters; // written as they are
+} Bench_result_type;
+
+// The result stays valid until the next BenchRun(), counters can be added to it. Returns nullptr when the
+// benchmark is filtered out. Items and bytes are per call of the body, they become the items_per_second
+// and bytes_per_second counters.
+Bench_result_type *BenchRun(const std::string &name, const std::function<void()> &body, double items = 0,
+                            double bytes = 0);
+
+const std::vector<Bench_result_type> &BenchResults();
+bool BenchWriteJson(const std::string &path);
+
+// keeps the compiler from dropping a result nobody reads
+template <typename T> inline void BenchKeep(const T &value) { asm volatile("" : : "g"(&value) : "memory"); }
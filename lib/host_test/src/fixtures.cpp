@@ -0,0 +1,87 @@
+#include "fixtures.h"
+#include <Arduino.h>
+#include <algorithm>
+#include <dirent.h>
+#include <sys/stat.h>
+
+// from the firmware
+bool DecodeWeather(Stream &json, const bool forecast);
+void SetupTimezone();
+void SampleFrameReadings();
+extern struct tm timeinfo;
+extern int wifi_signal;
+
+// the project directory is three levels above the one of this file
+std::string ProjectPath(const std::string &path) {
+    std::string file = __FILE__;
+    for(int up = 0; up < 4; up++) {
+        size_t slash = file.find_last_of('/');
+        file = slash == std::string::npos ? "." : file.substr(0, slash);
+    }
+    return file + "/" + path;
+}
+
+std::string ReadFile(const std::string &path) {
+    std::string text;
+    FILE *file = fopen(path.c_str(), "rb");
+    if(!file)
+        return text;
+    char block[4096];
+    size_t n;
+    while((n = fread(block, 1, sizeof(block), file)) > 0)
+        text.append(block, n);
+    fclose(file);
+    return text;
+}
+
+bool WriteFile(const std::string &path, const std::string &text) {
+    CreateDirectories(path);
+    FILE *file = fopen(path.c_str(), "wb");
+    if(!file)
+        return false;
+    bool written = fwrite(text.data(), 1, text.size(), file) == text.size();
+    return fclose(file) == 0 && written;
+}
+
+void CreateDirectories(const std::string &path) {
+    for(size_t slash = path.find('/', 1); slash != std::string::npos; slash = path.find('/', slash + 1))
+        mkdir(path.substr(0, slash).c_str(), 0755);
+}
+
+std::vector<std::string> FixtureNames() {
+    std::vector<std::string> names;
+    DIR *directory = opendir(ProjectPath("test/fixtures/owm").c_str());
+    if(!directory)
+        return names;
+    while(dirent *entry = readdir(directory))
+        if(entry->d_name[0] != '.')
+            names.push_back(entry->d_name);
+    closedir(directory);
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+bool LoadFixture(const std::string &name) {
+    std::string directory = ProjectPath("test/fixtures/owm/" + name + "/");
+    std::string onecall = ReadFile(directory + "onecall.json");
+    std::string forecast = ReadFile(directory + "forecast.json");
+    size_t dt = onecall.find("\"dt\":");
+    if(onecall.empty() || forecast.empty() || dt == std::string::npos)
+        return false;
+    struct timeval tv = {strtol(onecall.c_str() + dt + 5, nullptr, 10), 0};
+    settimeofday(&tv, nullptr);
+    SetupTimezone();
+    localtime_r(&tv.tv_sec, &timeinfo);
+    wifi_signal = -60;
+    FixtureStream current(onecall), list(forecast);
+    bool decoded = DecodeWeather(current, false) && DecodeWeather(list, true);
+    SampleFrameReadings(); // as setup() does before it draws
+    return decoded;
+}
+
+size_t FixtureStream::readBytes(char *buffer, size_t length) {
+    size_t n = std::min(length, size - position);
+    memcpy(buffer, data + position, n);
+    position += n;
+    return n;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <Stream.h>
+#include <string>
+#include <vector>
+
+// The recorded OWM responses of test/fixtures/owm, one directory per weather with onecall.json and
+// forecast.json, as the tests and benchmarks of the native environment use them.
+
+// a path from the project directory
+std::string ProjectPath(const std::string &path);
+std::string ReadFile(const std::string &path);
+bool WriteFile(const std::string &path, const std::string &text); // creates the missing directories
+void CreateDirectories(const std::string &path);                  // the ones path is in
+
+std::vector<std::string> FixtureNames(); // sorted
+
+// Decodes both responses of a fixture into the firmware, with the clock set to the observation time so
+// the date, the sun and the moon on the screen follow the data. Needs the firmware linked in, which
+// test_build_src in platformio.ini does.
+bool LoadFixture(const std::string &name);
+
+// text as the stream an HTTP response body is, which DecodeWeather() reads
+class FixtureStream : public Stream {
+  public:
+    FixtureStream(const char *data, size_t size) : data(data), size(size) {}
+    explicit FixtureStream(const std::string &text) : FixtureStream(text.data(), text.size()) {}
+    int available() override { return size - position; }
+    int read() override { return position < size ? (uint8_t)data[position++] : -1; }
+    int peek() override { return position < size ? (uint8_t)data[position] : -1; }
+    size_t readBytes(char *buffer, size_t length) override;
+    size_t write(uint8_t) override { return 0; }
+
+  private:
+    const char *data;
+    size_t size;
+    size_t position = 0;
+};
@@ -0,0 +1,591 @@
+#include "canvas.h"
+
+#include "esp32/rom/miniz.h"
+#include <climits>
+
+constexpr size_t GlyphBufferSize = 2048; // largest decompressed glyph, OpenSans26B needs 1053 bytes
+
+// palette formats hold every Color level, 3 bit adds shades in between for the glyph edges
+constexpr uint8_t Palette3[8] = {0x0, 0x2, 0x4, 0x6, 0x8, 0xB, 0xD, 0xF};
+constexpr uint8_t Palette2[4] = {0x0, 0x4, 0x8, 0xF};
+
+constexpr int Distance(int a, int b) { return a > b ? a - b : b - a; }
+
+template <size_t N> constexpr uint8_t NearestIndex(const uint8_t (&palette)[N], uint8_t shade) {
+    uint8_t best = 0;
+    for(uint8_t i = 1; i < N; i++)
+        if(Distance(palette[i], shade) < Distance(palette[best], shade))
+            best = i;
+    return best;
+}
+
+template <size_t N> struct Quantizer {
+    uint8_t Index[16];
+    constexpr Quantizer(const uint8_t (&palette)[N]) : Index() {
+        for(uint8_t shade = 0; shade < 16; shade++)
+            Index[shade] = NearestIndex(palette, shade);
+    }
+};
+
+constexpr Quantizer<8> Quantize3(Palette3);
+constexpr Quantizer<4> Quantize2(Palette2);
+
+// pairs of palette indices map to one byte of the panel format, the first pixel in the low nibble
+template <size_t N> struct PairTable {
+    uint8_t Byte[N * N];
+    constexpr PairTable(const uint8_t (&palette)[N]) : Byte() {
+        for(size_t i = 0; i < N * N; i++)
+            Byte[i] = palette[i % N] | palette[i / N] << 4;
+    }
+};
+
+constexpr PairTable<8> Pairs3(Palette3);
+constexpr PairTable<4> Pairs2(Palette2);
+
+typedef struct {
+    uint8_t *Buffer;
+    int Top;
+    int Height;
+    CanvasFormat Format;
+    size_t RowBytes;
+} Canvas_target_type;
+
+Canvas_target_type target = {nullptr, 0, 0, CanvasFormat::Gray4, EPD_WIDTH / 2};
+uint8_t glyphBuffer[GlyphBufferSize];
+uint32_t bytesTouched = 0;
+
+void CanvasSetTarget(uint8_t *buffer, int top, int height, CanvasFormat format) {
+    target = {buffer, top, height, format, CanvasRowBytes(format)};
+}
+
+void CanvasExpandRow(CanvasFormat format, const uint8_t *src, uint8_t *dst) {
+    switch(format) {
+    case CanvasFormat::Palette3:
+        for(int x = 0; x < EPD_WIDTH; x += 8, src += 3, dst += 4) {
+            uint32_t group = src[0] | src[1] << 8 | src[2] << 16;
+            dst[0] = Pairs3.Byte[group & 0x3F];
+            dst[1] = Pairs3.Byte[(group >> 6) & 0x3F];
+            dst[2] = Pairs3.Byte[(group >> 12) & 0x3F];
+            dst[3] = Pairs3.Byte[group >> 18];
+        }
+        break;
+    case CanvasFormat::Palette2:
+        for(int x = 0; x < EPD_WIDTH; x += 4, src++, dst += 2) {
+            dst[0] = Pairs2.Byte[*src & 0x0F];
+            dst[1] = Pairs2.Byte[*src >> 4];
+        }
+        break;
+    default:
+        memcpy(dst, src, EPD_WIDTH / 2);
+    }
+}
+
+bool CanvasRowsVisible(int y0, int y1) {
+    if(y0 > y1)
+        std::swap(y0, y1);
+    return y1 >= target.Top && y0 < target.Top + target.Height;
+}
+
+uint32_t CanvasBytesTouched() { return bytesTouched; }
+
+// x and y are known to be inside the target, shades run from 0 (black) to 15 (white)
+static inline void PutShade(int x, int y, uint8_t shade) {
+    uint8_t *row = target.Buffer + (y - target.Top) * target.RowBytes;
+    bytesTouched++;
+    switch(target.Format) {
+    case CanvasFormat::Gray4: {
+        uint8_t *p = row + x / 2;
+        *p = (x & 1) ? (*p & 0x0F) | shade << 4 : (*p & 0xF0) | shade;
+        break;
+    }
+    case CanvasFormat::Palette3: {
+        // an index may straddle two bytes, the last one of a row never does
+        int bit = x * 3;
+        uint8_t *p = row + bit / 8;
+        int shift = bit % 8;
+        uint16_t v = p[0] | (shift > 5 ? p[1] << 8 : 0);
+        v = (v & ~(0x07 << shift)) | Quantize3.Index[shade] << shift;
+        p[0] = v;
+        if(shift > 5) {
+            p[1] = v >> 8;
+            bytesTouched++;
+        }
+        break;
+    }
+    case CanvasFormat::Palette2: {
+        uint8_t *p = row + x / 4;
+        int shift = (x & 3) * 2;
+        *p = (*p & ~(0x03 << shift)) | Quantize2.Index[shade] << shift;
+        break;
+    }
+    }
+}
+
+static inline uint8_t GetShade(int x, int y) {
+    const uint8_t *row = target.Buffer + (y - target.Top) * target.RowBytes;
+    switch(target.Format) {
+    case CanvasFormat::Palette3: {
+        int bit = x * 3;
+        const uint8_t *p = row + bit / 8;
+        int shift = bit % 8;
+        uint16_t v = p[0] | (shift > 5 ? p[1] << 8 : 0);
+        return Palette3[(v >> shift) & 0x07];
+    }
+    case CanvasFormat::Palette2:
+        return Palette2[(row[x / 4] >> ((x & 3) * 2)) & 0x03];
+    default:
+        return (x & 1) ? row[x / 2] >> 4 : row[x / 2] & 0x0F;
+    }
+}
+
+static inline void PutPixel(int x, int y, uint8_t color) { PutShade(x, y, color >> 4); }
+
+void CanvasDrawPixel(int x, int y, uint8_t color) {
+    if(x < 0 || x >= EPD_WIDTH || y < target.Top || y >= target.Top + target.Height)
+        return;
+    PutPixel(x, y, color);
+}
+
+void CanvasDrawHLine(int x, int y, int length, uint8_t color) {
+    if(y < target.Top || y >= target.Top + target.Height)
+        return;
+    int x1 = std::min(x + length, EPD_WIDTH);
+    x = std::max(x, 0);
+    if(x >= x1)
+        return;
+    if(target.Format != CanvasFormat::Gray4) {
+        for(; x < x1; x++)
+            PutPixel(x, y, color);
+        return;
+    }
+    if(x & 1)
+        PutPixel(x++, y, color);
+    if(x1 & 1)
+        PutPixel(--x1, y, color);
+    // whole bytes in between
+    if(x < x1) {
+        memset(target.Buffer + (y - target.Top) * target.RowBytes + x / 2, (color & 0xF0) | (color >> 4),
+               (x1 - x) / 2);
+        bytesTouched += (x1 - x) / 2;
+    }
+}
+
+void CanvasDrawVLine(int x, int y, int length, uint8_t color) {
+    if(x < 0 || x >= EPD_WIDTH)
+        return;
+    int y1 = std::min(y + length, target.Top + target.Height);
+    for(y = std::max(y, target.Top); y < y1; y++)
+        PutPixel(x, y, color);
+}
+
+void CanvasDrawLine(int x0, int y0, int x1, int y1, uint8_t color) {
+    if(!CanvasRowsVisible(y0, y1))
+        return;
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if(steep) {
+        std::swap(x0, y0);
+        std::swap(x1, y1);
+    }
+    if(x0 > x1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+    int dx = x1 - x0;
+    int dy = abs(y1 - y0);
+    int err = dx / 2;
+    int ystep = y0 < y1 ? 1 : -1;
+    for(; x0 <= x1; x0++) {
+        if(steep)
+            CanvasDrawPixel(y0, x0, color);
+        else
+            CanvasDrawPixel(x0, y0, color);
+        err -= dy;
+        if(err < 0) {
+            y0 += ystep;
+            err += dx;
+        }
+    }
+}
+
+void CanvasDrawCircle(int x0, int y0, int r, uint8_t color) {
+    if(!CanvasRowsVisible(y0 - r, y0 + r))
+        return;
+    int f = 1 - r;
+    int ddF_x = 1;
+    int ddF_y = -2 * r;
+    int x = 0;
+    int y = r;
+    CanvasDrawPixel(x0, y0 + r, color);
+    CanvasDrawPixel(x0, y0 - r, color);
+    CanvasDrawPixel(x0 + r, y0, color);
+    CanvasDrawPixel(x0 - r, y0, color);
+    while(x < y) {
+        if(f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        CanvasDrawPixel(x0 + x, y0 + y, color);
+        CanvasDrawPixel(x0 - x, y0 + y, color);
+        CanvasDrawPixel(x0 + x, y0 - y, color);
+        CanvasDrawPixel(x0 - x, y0 - y, color);
+        CanvasDrawPixel(x0 + y, y0 + x, color);
+        CanvasDrawPixel(x0 - y, y0 + x, color);
+        CanvasDrawPixel(x0 + y, y0 - x, color);
+        CanvasDrawPixel(x0 - y, y0 - x, color);
+    }
+}
+
+void CanvasFillCircle(int x0, int y0, int r, uint8_t color) {
+    if(!CanvasRowsVisible(y0 - r, y0 + r))
+        return;
+    // same spans as epd_fill_circle(), drawn as vertical lines
+    CanvasDrawVLine(x0, y0 - r, 2 * r + 1, color);
+    int f = 1 - r;
+    int ddF_x = 1;
+    int ddF_y = -2 * r;
+    int x = 0;
+    int y = r;
+    int px = x;
+    int py = y;
+    while(x < y) {
+        if(f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        if(x < (y + 1)) {
+            CanvasDrawVLine(x0 + x, y0 - y, 2 * y + 1, color);
+            CanvasDrawVLine(x0 - x, y0 - y, 2 * y + 1, color);
+        }
+        if(y != py) {
+            CanvasDrawVLine(x0 + py, y0 - px, 2 * px + 1, color);
+            CanvasDrawVLine(x0 - py, y0 - px, 2 * px + 1, color);
+            py = y;
+        }
+        px = x;
+    }
+}
+
+void CanvasDrawRect(int x, int y, int w, int h, uint8_t color) {
+    if(!CanvasRowsVisible(y, y + h - 1))
+        return;
+    CanvasDrawHLine(x, y, w, color);
+    CanvasDrawHLine(x, y + h - 1, w, color);
+    CanvasDrawVLine(x, y, h, color);
+    CanvasDrawVLine(x + w - 1, y, h, color);
+}
+
+void CanvasFillRect(int x, int y, int w, int h, uint8_t color) {
+    int y1 = std::min(y + h, target.Top + target.Height);
+    for(y = std::max(y, target.Top); y < y1; y++)
+        CanvasDrawHLine(x, y, w, color);
+}
+
+void CanvasFillTriangle(int x0, int y0, int x1, int y1, int x2, int y2, uint8_t color) {
+    // sort by y, y2 >= y1 >= y0
+    if(y0 > y1) {
+        std::swap(y0, y1);
+        std::swap(x0, x1);
+    }
+    if(y1 > y2) {
+        std::swap(y2, y1);
+        std::swap(x2, x1);
+    }
+    if(y0 > y1) {
+        std::swap(y0, y1);
+        std::swap(x0, x1);
+    }
+    if(!CanvasRowsVisible(y0, y2))
+        return;
+
+    int a, b, y;
+    if(y0 == y2) {
+        a = b = x0;
+        a = std::min(a, std::min(x1, x2));
+        b = std::max(b, std::max(x1, x2));
+        CanvasDrawHLine(a, y0, b - a + 1, color);
+        return;
+    }
+    int dx01 = x1 - x0, dy01 = y1 - y0;
+    int dx02 = x2 - x0, dy02 = y2 - y0;
+    int dx12 = x2 - x1, dy12 = y2 - y1;
+    int32_t sa = 0, sb = 0;
+    // the upper part includes y1 only if the lower part is flat
+    int last = (y1 == y2) ? y1 : y1 - 1;
+    for(y = y0; y <= last; y++) {
+        a = x0 + sa / dy01;
+        b = x0 + sb / dy02;
+        sa += dx01;
+        sb += dx02;
+        if(a > b)
+            std::swap(a, b);
+        CanvasDrawHLine(a, y, b - a + 1, color);
+    }
+    sa = (int32_t)dx12 * (y - y1);
+    sb = (int32_t)dx02 * (y - y0);
+    for(; y <= y2; y++) {
+        a = x1 + sa / dy12;
+        b = x0 + sb / dy02;
+        sa += dx12;
+        sb += dx02;
+        if(a > b)
+            std::swap(a, b);
+        CanvasDrawHLine(a, y, b - a + 1, color);
+    }
+}
+
+void CanvasDrawImage(int x, int y, int width, int height, const uint8_t *data) {
+    const int stride = (width + 1) / 2;
+    int row0 = std::max(0, target.Top - y);
+    int row1 = std::min(height, target.Top + target.Height - y);
+    int col0 = std::max(0, -x);
+    int col1 = std::min(width, EPD_WIDTH - x);
+    for(int row = row0; row < row1; row++) {
+        const uint8_t *src = data + row * stride;
+        for(int col = col0; col < col1; col++) {
+            // source and destination nibbles differ whenever x is odd
+            uint8_t shade = (col & 1) ? src[col / 2] >> 4 : src[col / 2] & 0x0F;
+            if(shade < GetShade(x + col, y + row))
+                PutShade(x + col, y + row, shade);
+        }
+    }
+}
+
+static uint32_t NextCodepoint(const char **text) {
+    const uint8_t *s = (const uint8_t *)*text;
+    uint32_t cp = *s++;
+    int extra = 0;
+    if(cp >= 0xF0) {
+        cp &= 0x07;
+        extra = 3;
+    } else if(cp >= 0xE0) {
+        cp &= 0x0F;
+        extra = 2;
+    } else if(cp >= 0xC0) {
+        cp &= 0x1F;
+        extra = 1;
+    }
+    while(extra-- && (*s & 0xC0) == 0x80)
+        cp = (cp << 6) | (*s++ & 0x3F);
+    *text = (const char *)s;
+    return cp;
+}
+
+static const GFXglyph *FontGlyph(const Canvas_font_type *font, uint32_t cp) {
+    if(cp >= DirectFirst && cp <= DirectLast) {
+        uint16_t index = font->Direct[cp - DirectFirst];
+        return index == NoGlyph ? nullptr : &font->Font->glyph[index];
+    }
+    for(uint32_t i = 0; i < font->Font->interval_count; i++) {
+        const UnicodeInterval &interval = font->Font->intervals[i];
+        if(cp < interval.first)
+            return nullptr;
+        if(cp <= interval.last)
+            return &font->Font->glyph[interval.offset + (cp - interval.first)];
+    }
+    return nullptr;
+}
+
+// source is the font the glyph's bitmap belongs to
+static const GFXglyph *FindGlyph(const Canvas_font_type *font, uint32_t cp, const GFXfont **source) {
+    *source = font->Font;
+    const GFXglyph *glyph = FontGlyph(font, cp);
+    if(!glyph && font->Fallback && cp > ' ')
+        glyph = font->Fallback(cp, source);
+    return glyph;
+}
+
+void CanvasTextBounds(const Canvas_font_type *font, const char *text, int x, int y, int *x1, int *y1, int *w,
+                      int *h) {
+    int minx = INT_MAX, miny = INT_MAX, maxx = INT_MIN, maxy = INT_MIN;
+    int cursor = x;
+    while(*text) {
+        const GFXfont *source;
+        const GFXglyph *glyph = FindGlyph(font, NextCodepoint(&text), &source);
+        if(!glyph)
+            continue;
+        int gx = cursor + glyph->left;
+        int gy = y + glyph->top - glyph->height;
+        minx = std::min(minx, gx);
+        miny = std::min(miny, gy);
+        maxx = std::max(maxx, gx + glyph->width);
+        maxy = std::max(maxy, gy + glyph->height);
+        cursor += glyph->advance_x;
+    }
+    if(maxx == INT_MIN) {
+        *x1 = x;
+        *y1 = y;
+        *w = *h = 0;
+        return;
+    }
+    *x1 = std::min(x, minx);
+    *y1 = miny;
+    *w = maxx - *x1;
+    *h = maxy - miny;
+}
+
+static void DrawGlyph(const GFXfont *font, const GFXglyph *glyph, int x, int y) {
+    int top = y - glyph->top;
+    if(glyph->width == 0 || !CanvasRowsVisible(top, top + glyph->height - 1))
+        return;
+    int byteWidth = (glyph->width + 1) / 2;
+    size_t size = byteWidth * glyph->height;
+    const uint8_t *bitmap = font->bitmap + glyph->data_offset;
+    if(font->compressed) {
+        if(size > GlyphBufferSize) {
+            log_w("Glyph of %u bytes does not fit the glyph buffer", size);
+            return;
+        }
+        if(tinfl_decompress_mem_to_mem(glyphBuffer, size, bitmap, glyph->compressed_size,
+                                       TINFL_FLAG_PARSE_ZLIB_HEADER)
+           == TINFL_DECOMPRESS_MEM_TO_MEM_FAILED) {
+            log_e("Glyph decompression failed");
+            return;
+        }
+        bitmap = glyphBuffer;
+    }
+    int left = x + glyph->left;
+    int row0 = std::max(0, target.Top - top);
+    int row1 = std::min<int>(glyph->height, target.Top + target.Height - top);
+    int col0 = std::max(0, -left);
+    int col1 = std::min<int>(glyph->width, EPD_WIDTH - left);
+    for(int row = row0; row < row1; row++) {
+        const uint8_t *src = bitmap + row * byteWidth;
+        for(int col = col0; col < col1; col++) {
+            // 4 bit coverage, 0 leaves the background untouched
+            uint8_t coverage = (col & 1) ? src[col / 2] >> 4 : src[col / 2] & 0x0F;
+            if(coverage)
+                PutShade(left + col, top + row, 15 - coverage);
+        }
+    }
+}
+
+bool CanvasLayoutText(const Canvas_font_type *font, const char *text, size_t length,
+                      Canvas_text_type *layout) {
+    int minx = INT_MAX, miny = INT_MAX, maxx = INT_MIN, maxy = INT_MIN;
+    int cursor = 0;
+    const char *end = length == SIZE_MAX ? nullptr : text + length;
+    bool complete = true;
+    layout->Count = 0;
+    while(*text && text != end) {
+        uint32_t cp = NextCodepoint(&text);
+        if(cp == '\n' || layout->Count == TextMaxGlyphs) {
+            complete = false;
+            break;
+        }
+        const GFXfont *source;
+        const GFXglyph *glyph = FindGlyph(font, cp, &source);
+        if(!glyph)
+            continue;
+        layout->Sources[layout->Count] = source;
+        layout->Glyphs[layout->Count++] = glyph;
+        int gx = cursor + glyph->left;
+        int gy = glyph->top - glyph->height;
+        minx = std::min(minx, gx);
+        miny = std::min(miny, gy);
+        maxx = std::max(maxx, gx + glyph->width);
+        maxy = std::max(maxy, gy + glyph->height);
+        cursor += glyph->advance_x;
+    }
+    if(layout->Count == 0) {
+        layout->X1 = layout->Y1 = layout->Width = layout->Height = 0;
+        return complete;
+    }
+    // same bounds as CanvasTextBounds() with the cursor at the origin
+    layout->X1 = std::min(0, minx);
+    layout->Y1 = miny;
+    layout->Width = maxx - layout->X1;
+    layout->Height = maxy - miny;
+    return complete;
+}
+
+void CanvasDrawText(const Canvas_text_type *layout, int x, int y) {
+    for(size_t i = 0; i < layout->Count; i++) {
+        DrawGlyph(layout->Sources[i], layout->Glyphs[i], x, y);
+        x += layout->Glyphs[i]->advance_x;
+    }
+}
+
+static int TextAdvance(const Canvas_font_type *font, const char *text) {
+    int advance = 0;
+    while(*text) {
+        const GFXfont *source;
+        const GFXglyph *glyph = FindGlyph(font, NextCodepoint(&text), &source);
+        advance += glyph ? glyph->advance_x : 0;
+    }
+    return advance;
+}
+
+int CanvasWrapText(const Canvas_font_type *font, const char *text, int width, Canvas_line_type *lines,
+                   int maxLines) {
+    const char *start = text;
+    const int ellipsisWidth = TextAdvance(font, CanvasEllipsis);
+    int count = 0;
+    while(*text && count < maxLines) {
+        while(*text == ' ')
+            text++;
+        const char *line = text;
+        const char *lineEnd = nullptr; // the last space seen, where the line can be broken
+        const char *next = nullptr; // where the following line starts
+        const char *fit = line;     // on the last line, the end that leaves room for the ellipsis
+        bool last = count == maxLines - 1;
+        bool full = false;
+        int cursor = 0;
+        while(*text && *text != '\n') {
+            const char *at = text;
+            uint32_t cp = NextCodepoint(&text);
+            const GFXfont *source;
+            const GFXglyph *glyph = FindGlyph(font, cp, &source);
+            cursor += glyph ? glyph->advance_x : 0;
+            if(last && cursor + ellipsisWidth <= width)
+                fit = text;
+            if(cp == ' ') {
+                lineEnd = at;
+                next = text;
+            } else if(cursor > width && !last) {
+                // a word wider than the whole line is broken before the glyph that does not fit
+                if(!lineEnd)
+                    lineEnd = next = at > line ? at : text;
+                full = true;
+                break;
+            }
+        }
+        if(!full) {
+            lineEnd = text;
+            next = *text == '\n' ? text + 1 : text;
+        }
+        bool truncated = last && (cursor > width || *next);
+        if(truncated)
+            lineEnd = fit;
+        while(lineEnd > line && lineEnd[-1] == ' ')
+            lineEnd--;
+        lines[count++] = {(uint16_t)(line - start), (uint16_t)(lineEnd - line), truncated};
+        text = next;
+    }
+    return count;
+}
+
+void CanvasWriteString(const Canvas_font_type *font, const char *text, int *x, int *y) {
+    int lineStart = *x;
+    while(*text) {
+        uint32_t cp = NextCodepoint(&text);
+        if(cp == '\n') {
+            *x = lineStart;
+            *y += font->Font->advance_y;
+            continue;
+        }
+        const GFXfont *source;
+        const GFXglyph *glyph = FindGlyph(font, cp, &source);
+        if(!glyph)
+            continue;
+        DrawGlyph(source, glyph, *x, *y);
+        *x += glyph->advance_x;
+    }
+}
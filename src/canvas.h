@@ -0,0 +1,107 @@
+#pragma once
+
+#include "epd_driver.h"
+#include <Arduino.h>
+
+// Drawing primitives on a render target that holds the full screen width and rows [top, top + height),
+// either the whole screen or one horizontal band of it. Everything outside the target is clipped, so the
+// same layout code can be run once per band. Colors use the 0x00 (black) to 0xFF (white) scale of epd_driver.
+//
+// Gray4 is the panel format, two pixels per byte with even x in the low nibble. The palette formats store
+// 3 or 2 bit indices, lowest x in the lowest bits, and quantize every shade to the nearest palette entry.
+// CanvasExpandRow() turns one of their rows back into the panel format.
+enum class CanvasFormat : uint8_t { Gray4, Palette3, Palette2 };
+
+constexpr size_t CanvasRowBytes(CanvasFormat format) {
+    return format == CanvasFormat::Palette3 ? EPD_WIDTH * 3 / 8
+        : format == CanvasFormat::Palette2  ? EPD_WIDTH / 4
+                                            : EPD_WIDTH / 2;
+}
+
+void CanvasSetTarget(uint8_t *buffer, int top, int height, CanvasFormat format = CanvasFormat::Gray4);
+void CanvasExpandRow(CanvasFormat format, const uint8_t *src, uint8_t *dst);
+bool CanvasRowsVisible(int y0, int y1);
+
+// Framebuffer bytes written since boot, a byte written twice counts twice. The difference across some
+// drawing is the memory traffic it cost.
+uint32_t CanvasBytesTouched();
+
+void CanvasDrawPixel(int x, int y, uint8_t color);
+void CanvasDrawHLine(int x, int y, int length, uint8_t color);
+void CanvasDrawVLine(int x, int y, int length, uint8_t color);
+void CanvasDrawLine(int x0, int y0, int x1, int y1, uint8_t color);
+void CanvasDrawCircle(int x0, int y0, int r, uint8_t color);
+void CanvasFillCircle(int x0, int y0, int r, uint8_t color);
+void CanvasDrawRect(int x, int y, int w, int h, uint8_t color);
+void CanvasFillRect(int x, int y, int w, int h, uint8_t color);
+void CanvasFillTriangle(int x0, int y0, int x1, int y1, int x2, int y2, uint8_t color);
+
+// 4 bit image packed like the target, rows padded to whole bytes. Pixels only get darker, the way the
+// panel combines images drawn on top of each other.
+void CanvasDrawImage(int x, int y, int width, int height, const uint8_t *data);
+
+// A font plus the glyph index of every codepoint in [DirectFirst, DirectLast], so the text the display
+// shows never has to search the intervals. Build one with CanvasFont() into a constexpr variable.
+// Codepoints the font has no glyph for go to the optional fallback, which returns the glyph and the font
+// its bitmap belongs to (see glyphpack.h).
+constexpr uint32_t DirectFirst = 0x20;
+constexpr uint32_t DirectLast = 0xFF;
+constexpr uint16_t NoGlyph = 0xFFFF;
+
+typedef const GFXglyph *(*Canvas_fallback_type)(uint32_t cp, const GFXfont **source);
+
+struct Canvas_font_type {
+    const GFXfont *Font;
+    uint16_t Direct[DirectLast - DirectFirst + 1];
+    Canvas_fallback_type Fallback;
+};
+
+template <size_t N>
+constexpr Canvas_font_type CanvasFont(const GFXfont &font, const UnicodeInterval (&intervals)[N],
+                                      Canvas_fallback_type fallback = nullptr) {
+    Canvas_font_type result{&font, {}, fallback};
+    for(uint32_t cp = DirectFirst; cp <= DirectLast; cp++) {
+        result.Direct[cp - DirectFirst] = NoGlyph;
+        for(size_t i = 0; i < N; i++)
+            if(cp >= intervals[i].first && cp <= intervals[i].last)
+                result.Direct[cp - DirectFirst] = intervals[i].offset + (cp - intervals[i].first);
+    }
+    return result;
+}
+
+// text is UTF-8, y is the baseline; bounds follow get_text_bounds() of epd_driver
+void CanvasTextBounds(const Canvas_font_type *font, const char *text, int x, int y, int *x1, int *y1, int *w,
+                      int *h);
+void CanvasWriteString(const Canvas_font_type *font, const char *text, int *x, int *y);
+
+// One line of text decoded once: the glyphs to draw and their bounds relative to the cursor, which is
+// all alignment needs. Layout stops at length bytes or the end of the string. CanvasLayoutText() returns
+// false when the text has a newline or more glyphs than TextMaxGlyphs, the layout then holds what came
+// before. Callers fall back to CanvasTextBounds() and CanvasWriteString() or draw the part that fit.
+constexpr size_t TextMaxGlyphs = 96;
+
+struct Canvas_text_type {
+    const GFXfont *Sources[TextMaxGlyphs];
+    const GFXglyph *Glyphs[TextMaxGlyphs];
+    size_t Count;
+    int X1, Y1, Width, Height;
+};
+
+bool CanvasLayoutText(const Canvas_font_type *font, const char *text, size_t length,
+                      Canvas_text_type *layout);
+void CanvasDrawText(const Canvas_text_type *layout, int x, int y);
+
+// Breaks text into at most maxLines lines whose advance widths fit width pixels, at spaces where possible
+// and always at newlines. Lines are byte ranges of text, without the spaces they were broken at. When the
+// text does not fit, the last line is cut short to leave room for CanvasEllipsis and marked Truncated, the
+// caller draws the ellipsis after it. Returns the number of lines.
+constexpr const char *CanvasEllipsis = "...";
+
+struct Canvas_line_type {
+    uint16_t Start;
+    uint16_t Length;
+    bool Truncated;
+};
+
+int CanvasWrapText(const Canvas_font_type *font, const char *text, int width, Canvas_line_type *lines,
+                   int maxLines);
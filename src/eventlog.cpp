@@ -0,0 +1,91 @@
+#include "eventlog.h"
+
+#include "freertos/FreeRTOS.h"
+#include <esp_timer.h>
+
+// a record is a header word, the time in ms and the arguments; positions only grow and wrap in the ring
+constexpr int HeaderWords = 2;
+
+uint32_t eventRing[EventLogWords];
+uint32_t eventHead = 0, eventTail = 0, eventsDropped = 0;
+portMUX_TYPE eventLock = portMUX_INITIALIZER_UNLOCKED;
+
+static inline uint32_t RecordWords(uint32_t header) { return HeaderWords + (header >> 16); }
+
+void EventLogPut(EventId id, const uint32_t *args, int count) {
+    uint32_t ms = esp_timer_get_time() / 1000;
+    uint32_t words = HeaderWords + count;
+    portENTER_CRITICAL(&eventLock);
+    while(EventLogWords - (eventHead - eventTail) < words) {
+        eventTail += RecordWords(eventRing[eventTail % EventLogWords]);
+        eventsDropped++;
+    }
+    eventRing[eventHead++ % EventLogWords] = (uint32_t)count << 16 | (uint16_t)id;
+    eventRing[eventHead++ % EventLogWords] = ms;
+    for(int i = 0; i < count; i++)
+        eventRing[eventHead++ % EventLogWords] = args[i];
+    portEXIT_CRITICAL(&eventLock);
+}
+
+int EventLogFormat(EventId id, const uint32_t *args, char *out, size_t size) {
+    const char *format = (int)id < (int)EventId::Count ? EventFormats[(int)id] : "unknown event";
+    size_t n = 0;
+    auto append = [&](int written) { n = std::min(n + std::max(written, 0), size - 1); };
+    while(*format && n + 1 < size) {
+        if(*format != '%') {
+            out[n++] = *format++;
+            continue;
+        }
+        // one conversion at a time, without length modifiers since every argument is a 32 bit word
+        char spec[16];
+        size_t length = 0;
+        spec[length++] = *format++;
+        while(*format && !strchr("diuxXcfeEgG%", *format)) {
+            if(*format != 'l' && *format != 'h' && length < sizeof(spec) - 2)
+                spec[length++] = *format;
+            format++;
+        }
+        char conversion = *format;
+        if(!conversion)
+            break;
+        format++;
+        spec[length++] = conversion;
+        spec[length] = 0;
+        if(conversion == '%') {
+            out[n++] = '%';
+        } else if(strchr("feEgG", conversion)) {
+            float value;
+            memcpy(&value, args++, sizeof(value));
+            append(snprintf(out + n, size - n, spec, (double)value));
+        } else {
+            append(snprintf(out + n, size - n, spec, *args++));
+        }
+    }
+    out[n] = 0;
+    return n;
+}
+
+void EventLogDump() {
+    constexpr char Levels[] = " EWIDV";
+    portENTER_CRITICAL(&eventLock);
+    uint32_t head = eventHead, tail = eventTail, dropped = eventsDropped;
+    eventTail = eventHead;
+    eventsDropped = 0;
+    portEXIT_CRITICAL(&eventLock);
+    // records written while printing may overwrite the ones not printed yet, this runs once the work is done
+    if(dropped)
+        log_printf("[%c] %u older events dropped\r\n", Levels[(int)EventLevel::Warn], dropped);
+    char text[128];
+    uint32_t args[EventMaxArgs];
+    while(tail != head) {
+        uint32_t header = eventRing[tail++ % EventLogWords];
+        uint32_t ms = eventRing[tail++ % EventLogWords];
+        int count = header >> 16;
+        for(int i = 0; i < count; i++)
+            args[i] = eventRing[tail++ % EventLogWords];
+        EventId id = (EventId)(header & 0xFFFF);
+        EventLogFormat(id, args, text, sizeof(text));
+        char level = (int)id < (int)EventId::Count ? Levels[(int)EventLevels[(int)id]] : '?';
+        log_printf("[%6u][%c] %s\r\n", ms, level, text);
+    }
+}
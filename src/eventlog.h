@@ -0,0 +1,72 @@
+#pragma once
+
+#include "events.h"
+#include <Arduino.h>
+#include <cstring>
+#include <type_traits>
+
+// Log messages kept as binary records, the message id and its raw arguments, in a RAM ring and formatted
+// only when the ring is dumped, once the timing no longer matters. LOG_EVENT() takes a message of
+// events.h and its arguments. Messages above EVENT_LOG_LEVEL are removed at compile time together with
+// the evaluation of their arguments. When the ring is full the oldest records are dropped.
+#ifndef EVENT_LOG_LEVEL
+#define EVENT_LOG_LEVEL CORE_DEBUG_LEVEL
+#endif
+
+constexpr size_t EventLogWords = 1024;
+constexpr int EventMaxArgs = 8;
+
+// same values as the ARDUHAL_LOG_LEVEL_ constants
+enum class EventLevel : uint8_t { Error = 1, Warn, Info, Debug, Verbose };
+
+#define EVENT_ID(name, level, format) name,
+enum class EventId : uint16_t { EVENT_MESSAGES(EVENT_ID) Count };
+#undef EVENT_ID
+
+#define EVENT_LEVEL(name, level, format) EventLevel::level,
+constexpr EventLevel EventLevels[] = {EVENT_MESSAGES(EVENT_LEVEL)};
+#undef EVENT_LEVEL
+
+#define EVENT_FORMAT(name, level, format) format,
+constexpr const char *EventFormats[] = {EVENT_MESSAGES(EVENT_FORMAT)};
+#undef EVENT_FORMAT
+
+constexpr int EventFormatArgs(const char *format) {
+    int count = 0;
+    for(; *format; format++)
+        if(*format == '%' && *++format != '%')
+            count++;
+    return count;
+}
+
+template <typename T> inline uint32_t EventWord(T value) {
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "events store numbers only");
+    if constexpr(std::is_floating_point<T>::value) {
+        float f = value;
+        uint32_t word;
+        memcpy(&word, &f, sizeof(word));
+        return word;
+    } else {
+        return (uint32_t)value;
+    }
+}
+
+void EventLogPut(EventId id, const uint32_t *args, int count);
+
+template <EventId Id, typename... Args> inline void EventLogWrite(Args... args) {
+    static_assert(EventFormatArgs(EventFormats[(int)Id]) == sizeof...(Args), "one argument per conversion");
+    static_assert(sizeof...(Args) <= EventMaxArgs, "too many arguments");
+    const uint32_t words[] = {EventWord(args)..., 0};
+    EventLogPut(Id, words, sizeof...(Args));
+}
+
+#define LOG_EVENT(id, ...)                                                                                 \
+    do {                                                                                                   \
+        if constexpr((int)EventLevels[(int)EventId::id] <= EVENT_LOG_LEVEL)                                \
+            EventLogWrite<EventId::id>(__VA_ARGS__);                                                       \
+    } while(0)
+
+// Formats one record into out, returns the length like snprintf()
+int EventLogFormat(EventId id, const uint32_t *args, char *out, size_t size);
+// Prints and empties the ring
+void EventLogDump();
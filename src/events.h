@@ -0,0 +1,28 @@
+#pragma once
+
+// The messages of the event log (see eventlog.h): name, level and printf format. Arguments are stored as
+// 32 bit words, so the format may only convert integers (%d, %u, %x, %c) and floats (%f, %e, %g), no strings.
+// Append new messages at the end to keep the ids of the others.
+#define EVENT_MESSAGES(X)                                                                                  \
+    X(DecodeSunrise, Verbose, "   SRis: %d")                                                               \
+    X(DecodeSunset, Verbose, "   SSet: %d")                                                                \
+    X(DecodeTemperature, Verbose, "   Temp: %.2f")                                                         \
+    X(DecodeFeelsLike, Verbose, "   FLik: %.2f")                                                           \
+    X(DecodePressure, Verbose, "   Pres: %.2f")                                                            \
+    X(DecodeHumidity, Verbose, "   Humi: %.2f")                                                            \
+    X(DecodeDewPoint, Verbose, "   DPoi: %.2f")                                                            \
+    X(DecodeUVIndex, Verbose, "   UVin: %.2f")                                                             \
+    X(DecodeCloudCover, Verbose, "   CCov: %d")                                                            \
+    X(DecodeVisibility, Verbose, "   Visi: %d")                                                            \
+    X(DecodeWindSpeed, Verbose, "   WSpd: %.2f")                                                           \
+    X(DecodeWindDirection, Verbose, "   WDir: %.2f")                                                       \
+    X(DecodeForecast, Debug, "Receiving Forecast period - ")                                               \
+    X(DecodePeriod, Verbose, "   Period-%d--------------")                                                 \
+    X(DecodeLow, Verbose, "   TLow: %.2f")                                                                 \
+    X(DecodeHigh, Verbose, "   THig: %.2f")                                                                \
+    X(DecodeRain, Verbose, "   Rain: %.2f")                                                                \
+    X(DecodeSnow, Verbose, "   Snow: %.2f")                                                                \
+    X(Visibility, Verbose, "Visibility: %d")                                                               \
+    X(BatteryVref, Debug, "eFuse Vref:%u mV")                                                              \
+    X(BatteryVoltage, Debug, "Voltage: %.2f")                                                              \
+    X(Bands, Info, "%u bands in %d ms: render %d ms (%d ms stalled), push %d ms (%d ms idle), overlap %d%%")
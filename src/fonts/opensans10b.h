@@ -0,0 +1,528 @@
+// Generated by tools/fontsubset.py from ../Font Files/opensans10b.h, do not edit
+#pragma once
+#include "epd_driver.h"
+const uint8_t OpenSans10BBitmaps[6497] = {
+    0x78, 0x9C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 0x9C, 0x01, 0x1E, 0x00, 0xE1, 0xFF, 0xFB,
+    0xCF, 0xFB, 0xBF, 0xFA, 0xAF, 0xF9, 0x9F, 0xF8, 0x8F, 0xF7, 0x7F, 0xF6, 0x6F, 0xF5, 0x6F, 0xF5,
+    0x5F, 0xC3, 0x3C, 0x00, 0x00, 0x60, 0x06, 0xFA, 0x9F, 0xFB, 0xBF, 0xE4, 0x4E, 0x53, 0x50, 0x13,
+    0xCA, 0x78, 0x9C, 0xFB, 0xA9, 0xFF, 0xA5, 0xFF, 0x87, 0xFC, 0xE7, 0xFC, 0x6F, 0xFC, 0x1F, 0xE3,
+    0xBF, 0xF2, 0x7D, 0xF0, 0xFF, 0xC2, 0xFB, 0x40, 0x1F, 0x00, 0x83, 0xF3, 0x0B, 0xCC, 0x78, 0x9C,
+    0x63, 0x60, 0xF8, 0x24, 0x7F, 0x21, 0x9E, 0x81, 0x81, 0xE1, 0x2B, 0xDF, 0x47, 0x7D, 0x20, 0xF5,
+    0x83, 0xFB, 0x0B, 0x1F, 0x90, 0xFA, 0xCD, 0xF1, 0x9D, 0x9B, 0xE1, 0xC0, 0x7F, 0x10, 0x90, 0x87,
+    0x52, 0x02, 0x49, 0xFF, 0x8D, 0xFE, 0xAB, 0x30, 0x31, 0x14, 0x9C, 0x37, 0xF8, 0x0F, 0x54, 0x31,
+    0x61, 0x7E, 0xC2, 0x7D, 0xA0, 0x72, 0xB0, 0x1C, 0x1B, 0x94, 0x52, 0xFC, 0xA2, 0xFF, 0x29, 0x5E,
+    0x09, 0x68, 0x16, 0xEF, 0x27, 0x79, 0xA0, 0x92, 0x9F, 0x5C, 0xDF, 0x40, 0x66, 0xFD, 0x61, 0xFF,
+    0xC9, 0xC5, 0xC0, 0x00, 0x00, 0x19, 0x08, 0x30, 0x8F, 0x78, 0x9C, 0x63, 0x60, 0xD8, 0xC0, 0xCD,
+    0x00, 0x04, 0x60, 0xB2, 0xF1, 0xCF, 0xFB, 0x1E, 0x66, 0x87, 0xFF, 0x40, 0xC0, 0x7D, 0xE1, 0xFF,
+    0xDB, 0x75, 0x7F, 0x59, 0x3F, 0xFC, 0xDF, 0xC0, 0xAD, 0xC0, 0xF0, 0xE0, 0xFF, 0x49, 0xA0, 0x6C,
+    0xC2, 0xFF, 0xFF, 0x71, 0x40, 0x35, 0x4F, 0xFF, 0xFF, 0xCF, 0x03, 0x52, 0x57, 0xFF, 0xFF, 0xE7,
+    0x00, 0xEA, 0x9A, 0xF3, 0x5F, 0xDE, 0x01, 0xA8, 0xF7, 0xBF, 0xFE, 0xC7, 0x7D, 0x37, 0xF6, 0xFE,
+    0xE7, 0xFB, 0x08, 0xD2, 0xCB, 0x1A, 0x70, 0xF3, 0xDF, 0x7D, 0x49, 0x98, 0x99, 0x60, 0x12, 0x00,
+    0x48, 0x06, 0x2D, 0xF5, 0x78, 0x9C, 0x63, 0x78, 0x75, 0x9E, 0x99, 0x81, 0xE1, 0x1F, 0x07, 0x03,
+    0xC3, 0x86, 0xFF, 0xFF, 0xF9, 0x18, 0x0A, 0xDE, 0x33, 0x32, 0x30, 0x7C, 0x5C, 0xFF, 0xB5, 0x9E,
+    0xE1, 0x63, 0x3D, 0x03, 0x03, 0xC3, 0x17, 0xFF, 0x07, 0xEB, 0x19, 0x7E, 0xF2, 0x02, 0x59, 0x5F,
+    0xED, 0x2F, 0xEC, 0x57, 0xF8, 0xCF, 0x0A, 0x11, 0xDB, 0xBF, 0xE1, 0x3C, 0x90, 0x01, 0x56, 0xF7,
+    0xD9, 0xFE, 0xCA, 0x7B, 0x0E, 0x86, 0x05, 0xFF, 0xFF, 0xCB, 0xFF, 0xB1, 0xFA, 0xFF, 0x1F, 0xA8,
+    0xE7, 0xE5, 0xF9, 0xE0, 0xFF, 0x93, 0xFE, 0x6F, 0x79, 0x0F, 0x52, 0xF0, 0x60, 0xFE, 0x81, 0xF3,
+    0x09, 0xFF, 0x99, 0x80, 0xAC, 0xEF, 0x72, 0x17, 0xF6, 0x07, 0xFC, 0x07, 0xDA, 0x24, 0xF0, 0x9F,
+    0x1D, 0x24, 0x06, 0x64, 0x4D, 0xB8, 0xCF, 0x30, 0xE1, 0xFF, 0xE6, 0xFF, 0x40, 0xC9, 0x4F, 0xF1,
+    0x0C, 0x0A, 0xFF, 0xFF, 0xCF, 0x07, 0xB2, 0x7E, 0xF1, 0x30, 0x30, 0x1C, 0x01, 0x9A, 0x07, 0x00,
+    0x94, 0x86, 0x42, 0x2D, 0x78, 0x9C, 0x63, 0x50, 0xB8, 0x75, 0x5F, 0x8B, 0x01, 0x08, 0x3E, 0xFF,
+    0xFF, 0xFF, 0x9F, 0x09, 0x48, 0xFF, 0xDE, 0x7F, 0xFC, 0x3F, 0x27, 0x90, 0xFE, 0x2B, 0x6F, 0xF0,
+    0x9F, 0x0B, 0xC4, 0xF7, 0x9F, 0xF0, 0x9F, 0x0D, 0x48, 0x7F, 0x7D, 0xFF, 0xE7, 0x3E, 0x48, 0xDD,
+    0x82, 0xFF, 0xFF, 0x65, 0x40, 0xF4, 0xF7, 0xFF, 0xEF, 0x19, 0x1D, 0xFE, 0xF3, 0x17, 0xFC, 0xBF,
+    0xFF, 0x5F, 0x6F, 0xC1, 0x7F, 0xAE, 0x07, 0xFF, 0x39, 0x7E, 0xBD, 0xFF, 0xFA, 0x9F, 0xF9, 0xE3,
+    0x7F, 0xA6, 0x09, 0xFF, 0xFF, 0xAF, 0x67, 0xF8, 0xF8, 0x9F, 0x9D, 0xE1, 0xE7, 0x7F, 0x39, 0x86,
+    0x03, 0xFF, 0xCF, 0x9F, 0xFA, 0xFF, 0xDF, 0x9E, 0x41, 0xE1, 0xDF, 0x7F, 0x10, 0x60, 0x66, 0x68,
+    0xFC, 0xFB, 0x3E, 0x7B, 0xC2, 0x7F, 0x7F, 0x00, 0xD4, 0x04, 0x3D, 0xEE, 0x78, 0x9C, 0xFB, 0xA9,
+    0xFF, 0x43, 0xFE, 0x1B, 0xFF, 0x57, 0xBE, 0x2F, 0xBC, 0x00, 0x20, 0x06, 0x05, 0x49, 0x78, 0x9C,
+    0x63, 0x48, 0xF8, 0xCF, 0xC4, 0xF0, 0xA9, 0x9F, 0x81, 0xE1, 0x17, 0x3F, 0x83, 0xC2, 0x7F, 0x4E,
+    0x86, 0x82, 0xFF, 0xCC, 0x0C, 0x1B, 0xFE, 0x33, 0x30, 0x7C, 0x38, 0x0F, 0xC4, 0xEB, 0x19, 0x18,
+    0x3E, 0xCE, 0x87, 0x60, 0x10, 0x1B, 0x24, 0x06, 0x92, 0x6B, 0x00, 0xAA, 0x01, 0xA9, 0x65, 0xF8,
+    0xCD, 0xCF, 0x00, 0xD6, 0x0B, 0x34, 0x03, 0x00, 0xD2, 0x5C, 0x1A, 0x56, 0x78, 0x9C, 0xFB, 0xD8,
+    0xCF, 0xC0, 0x50, 0xF0, 0x9F, 0x99, 0x81, 0xE1, 0x1F, 0x0F, 0x03, 0xC3, 0x0F, 0x7B, 0x06, 0x86,
+    0x4F, 0xF3, 0x19, 0x18, 0x1E, 0xDC, 0x67, 0x60, 0x58, 0xF0, 0x9F, 0x81, 0x61, 0xC2, 0x7F, 0x26,
+    0xB0, 0x24, 0x08, 0x83, 0xD8, 0x0B, 0xFE, 0x33, 0x82, 0xE5, 0x40, 0x6A, 0xBE, 0xFB, 0x83, 0xF5,
+    0x24, 0xFC, 0x67, 0x61, 0xF8, 0x08, 0x34, 0x03, 0x00, 0xC6, 0xB3, 0x1A, 0x4C, 0x78, 0x9C, 0x63,
+    0x60, 0xF8, 0xC9, 0xCF, 0x00, 0x04, 0xDF, 0xF9, 0x18, 0x18, 0x04, 0x18, 0xBE, 0xF2, 0x30, 0x30,
+    0x7E, 0xEC, 0xF9, 0x9E, 0xF3, 0x8A, 0xE3, 0xF3, 0x7F, 0x20, 0xE0, 0x4A, 0x9C, 0xFE, 0xFF, 0x7C,
+    0x05, 0x0B, 0x43, 0xC3, 0xFF, 0xF7, 0x8C, 0x0C, 0x0C, 0x5F, 0xE2, 0xFF, 0x71, 0x31, 0x30, 0xFC,
+    0xE5, 0xFB, 0x1E, 0xCF, 0xC0, 0x30, 0x91, 0xFD, 0x00, 0x2B, 0x03, 0x04, 0x00, 0x00, 0x44, 0x2B,
+    0x17, 0xB5, 0x78, 0x9C, 0x63, 0x60, 0xF8, 0x24, 0xCF, 0x00, 0x04, 0xE8, 0xE4, 0xC7, 0xFF, 0x40,
+    0x20, 0x0F, 0x21, 0x0D, 0x8C, 0xBF, 0xC6, 0x1B, 0x33, 0x63, 0xAA, 0x61, 0x60, 0x30, 0x00, 0x8A,
+    0x02, 0x00, 0xC8, 0x53, 0x13, 0xB0, 0x78, 0x9C, 0x4B, 0xF8, 0xCF, 0x39, 0xE1, 0x3F, 0xCB, 0x81,
+    0xF7, 0x0C, 0x1F, 0xFA, 0x19, 0x3E, 0xEB, 0x33, 0x00, 0x00, 0x3F, 0xCD, 0x07, 0x4C, 0x78, 0x9C,
+    0xFB, 0xF6, 0xFF, 0x3F, 0xD3, 0x37, 0x20, 0x9E, 0x3C, 0x73, 0x26, 0x23, 0x00, 0x3A, 0x88, 0x07,
+    0xB3, 0x78, 0x9C, 0x4B, 0x60, 0xFB, 0x35, 0xFF, 0xF7, 0xFE, 0x27, 0x7E, 0x00, 0x14, 0x68, 0x04,
+    0xEC, 0x78, 0x9C, 0x63, 0x60, 0x28, 0xF8, 0xCF, 0xC6, 0xC0, 0x70, 0xE1, 0x3F, 0x03, 0x03, 0xC3,
+    0xE7, 0xF5, 0x40, 0xE2, 0xA7, 0x3F, 0x90, 0xF8, 0xC7, 0xC7, 0xC0, 0x10, 0xF0, 0x9F, 0x83, 0x81,
+    0x61, 0xC3, 0x7F, 0x26, 0x06, 0x86, 0x8F, 0xE7, 0x81, 0x42, 0xDF, 0xF3, 0x81, 0xC4, 0x1F, 0x79,
+    0x06, 0x06, 0x85, 0xFF, 0x5C, 0x0C, 0x0C, 0x0D, 0xFF, 0x59, 0x18, 0x18, 0x1E, 0xBC, 0x07, 0x0A,
+    0x7D, 0xE9, 0x07, 0x12, 0xBF, 0xF4, 0x81, 0x04, 0x00, 0x4F, 0x66, 0x15, 0xAB, 0x78, 0x9C, 0x63,
+    0x48, 0xF8, 0x73, 0x9E, 0x95, 0x81, 0xE1, 0xD7, 0xFF, 0xFF, 0xFD, 0x0C, 0x01, 0xFF, 0xD7, 0xFF,
+    0xFA, 0xCF, 0xBC, 0xE1, 0x3F, 0xC7, 0x84, 0xFF, 0x5C, 0x1F, 0xFE, 0x33, 0x19, 0xFC, 0xE7, 0xFB,
+    0xF8, 0x9F, 0x81, 0xE1, 0xBF, 0xFC, 0xE7, 0xF7, 0x40, 0x52, 0x1F, 0x44, 0xFE, 0xB3, 0x07, 0xB3,
+    0xED, 0x21, 0xE2, 0x60, 0x35, 0xFC, 0x0B, 0xFE, 0x73, 0x34, 0xFC, 0xE7, 0x76, 0x00, 0xE9, 0x65,
+    0x61, 0xF8, 0xF9, 0xFF, 0xFF, 0x7A, 0x06, 0x06, 0xA0, 0x99, 0x6C, 0x0C, 0x00, 0x8F, 0xD4, 0x2F,
+    0xBD, 0x78, 0x9C, 0x63, 0x60, 0xF8, 0xB1, 0x9E, 0x61, 0xE3, 0xFF, 0xF5, 0x06, 0xFF, 0xFE, 0xAF,
+    0xFF, 0xFA, 0xFF, 0xCF, 0xFA, 0x2F, 0xF1, 0xDF, 0xD7, 0x27, 0x30, 0x7F, 0x5F, 0xCF, 0xC0, 0x00,
+    0xC2, 0x3F, 0xF0, 0x62, 0x00, 0xE9, 0x50, 0x1E, 0x62, 0x78, 0x9C, 0x63, 0x68, 0x7C, 0x73, 0x9F,
+    0x83, 0x21, 0xE1, 0xFF, 0xFF, 0xFF, 0xF7, 0x19, 0x2F, 0xFC, 0xDF, 0xF7, 0xFB, 0x3F, 0xA7, 0x42,
+    0x1D, 0x43, 0xC1, 0x7F, 0x5E, 0x06, 0x06, 0x06, 0x07, 0x30, 0xD9, 0xF0, 0x9F, 0x0B, 0x48, 0x3E,
+    0xFC, 0xCF, 0xCC, 0xC0, 0x20, 0xF0, 0x77, 0x3E, 0x90, 0x79, 0xE0, 0x3F, 0x37, 0x90, 0xFC, 0xB3,
+    0x1E, 0xCC, 0xE4, 0x04, 0x31, 0xFB, 0xC1, 0xCC, 0xF5, 0xAB, 0x56, 0x59, 0x7D, 0x02, 0x9A, 0xF3,
+    0x3F, 0x1E, 0x42, 0x02, 0x00, 0xBF, 0x8B, 0x28, 0xFE, 0x78, 0x9C, 0x63, 0xD8, 0xF6, 0xEF, 0x9C,
+    0x38, 0xC3, 0x85, 0xFF, 0xFF, 0xFF, 0xBF, 0x67, 0x2C, 0xF8, 0x3F, 0xFB, 0xF7, 0x7F, 0x4E, 0x06,
+    0x76, 0x86, 0x86, 0xFF, 0xDC, 0x0C, 0x0C, 0x0C, 0x05, 0xFF, 0x39, 0x18, 0x18, 0x04, 0x9E, 0xBE,
+    0x67, 0x64, 0x78, 0xF0, 0xFF, 0xBF, 0x14, 0x03, 0x90, 0x7C, 0xEF, 0xC5, 0xC0, 0x90, 0xD0, 0xFE,
+    0xFB, 0x3F, 0x3B, 0x50, 0x36, 0xE1, 0x3F, 0x3F, 0x90, 0x34, 0xF8, 0xAF, 0x6F, 0xC8, 0x00, 0x54,
+    0xCF, 0xFF, 0x79, 0xED, 0x8C, 0x3F, 0xFF, 0xB9, 0x3E, 0x03, 0xCD, 0xB9, 0xCF, 0x98, 0x70, 0xFB,
+    0xFF, 0x3E, 0x36, 0x06, 0x00, 0x5C, 0xCD, 0x29, 0xDF, 0x78, 0x9C, 0x63, 0x60, 0x60, 0xF8, 0x76,
+    0x9F, 0x81, 0x81, 0x41, 0xE1, 0x3F, 0x88, 0xBC, 0x00, 0x26, 0x7F, 0xFC, 0x03, 0x92, 0x0E, 0xFF,
+    0xBF, 0x03, 0xC9, 0x87, 0xEB, 0x3F, 0x03, 0xC9, 0x5F, 0xBC, 0x40, 0x32, 0xE1, 0x3F, 0xF3, 0x97,
+    0xFB, 0x0C, 0x9F, 0xEA, 0x19, 0x80, 0xE4, 0xCF, 0xFF, 0x40, 0xB0, 0xFE, 0x17, 0x98, 0x2C, 0x29,
+    0x2F, 0xFF, 0xF9, 0xDE, 0x1D, 0xA8, 0xED, 0x0B, 0x48, 0x2F, 0x82, 0x04, 0x00, 0xCD, 0x34, 0x2D,
+    0x73, 0x78, 0x9C, 0xFB, 0xF4, 0xFF, 0xFF, 0x7F, 0x7E, 0x86, 0xCF, 0x60, 0xF2, 0xCB, 0xFB, 0xDD,
+    0xBB, 0xB9, 0x19, 0xBE, 0xCD, 0x67, 0x00, 0x82, 0xEF, 0xF5, 0x20, 0xF2, 0xC7, 0xFB, 0xFF, 0xBD,
+    0x8C, 0x0C, 0x3F, 0x81, 0xB2, 0xB2, 0x0C, 0x47, 0x66, 0xDF, 0xFA, 0x0F, 0x96, 0xFA, 0xF5, 0x1E,
+    0x44, 0x7E, 0xFE, 0x0F, 0x25, 0x59, 0x81, 0x22, 0xE7, 0x19, 0xFE, 0x03, 0x65, 0xE3, 0x19, 0x80,
+    0x0A, 0xFF, 0x73, 0x32, 0x2C, 0xFD, 0xFB, 0xDE, 0x8B, 0x81, 0x01, 0x00, 0x27, 0xF1, 0x2C, 0x18,
+    0x78, 0x9C, 0x01, 0x5A, 0x00, 0xA5, 0xFF, 0x00, 0x00, 0x93, 0xFD, 0xFF, 0x03, 0x00, 0xA0, 0xFF,
+    0xFF, 0xFF, 0x04, 0x00, 0xFA, 0xFF, 0x8B, 0x98, 0x02, 0x40, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0xA0,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0xE0, 0xDF, 0xB2, 0xFF, 0x4C, 0x00, 0xF1, 0xCF, 0xFE, 0xFF, 0xFF,
+    0x05, 0xF3, 0xFF, 0x9F, 0xD7, 0xFF, 0x0E, 0xF3, 0xFF, 0x04, 0x10, 0xFF, 0x3F, 0xF2, 0xEF, 0x00,
+    0x00, 0xFC, 0x4F, 0xF1, 0xFF, 0x00, 0x00, 0xFD, 0x4F, 0xC0, 0xFF, 0x08, 0x20, 0xFF, 0x1F, 0x50,
+    0xFF, 0xBF, 0xE9, 0xFF, 0x0B, 0x00, 0xF8, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x40, 0xEB, 0xDF, 0x19,
+    0x00, 0x52, 0x7F, 0x2F, 0xFB, 0x78, 0x9C, 0xFB, 0xFE, 0x1F, 0x08, 0xE2, 0xBF, 0x83, 0xC9, 0x25,
+    0xAB, 0x56, 0xED, 0xFA, 0x2F, 0xCF, 0xC0, 0xC0, 0x90, 0xF0, 0x9F, 0x0B, 0x48, 0x5E, 0xF8, 0xCF,
+    0x0C, 0x24, 0xBF, 0x9E, 0x07, 0x12, 0x0C, 0x7F, 0xE2, 0x81, 0x84, 0xC3, 0x7F, 0x3E, 0x20, 0xB9,
+    0xE1, 0x3F, 0x3B, 0x90, 0xFC, 0xF4, 0x9F, 0x11, 0x48, 0xFE, 0x9C, 0x0F, 0x24, 0x04, 0xFE, 0xEB,
+    0x03, 0xC9, 0x86, 0xFF, 0xDC, 0x40, 0xF2, 0xC1, 0x7F, 0x16, 0x20, 0xF9, 0xFD, 0x3E, 0x90, 0x00,
+    0x00, 0x5D, 0x89, 0x21, 0xDD, 0x78, 0x9C, 0x01, 0x5A, 0x00, 0xA5, 0xFF, 0x00, 0x70, 0xEC, 0xDF,
+    0x17, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xEF, 0x01, 0x90, 0xFF, 0x6D, 0xD6, 0xFF, 0x09, 0xC0, 0xFF,
+    0x04, 0x40, 0xFF, 0x0C, 0xA0, 0xFF, 0x06, 0x60, 0xFF, 0x09, 0x30, 0xFF, 0x7F, 0xF7, 0xFF, 0x02,
+    0x00, 0xF5, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0xC2, 0xFF, 0xFF, 0x1A, 0x00, 0x30, 0xFF, 0xBF, 0xFD,
+    0xEF, 0x02, 0xD0, 0xFF, 0x05, 0x80, 0xFF, 0x0D, 0xF2, 0xCF, 0x00, 0x00, 0xFC, 0x2F, 0xF3, 0xDF,
+    0x00, 0x00, 0xFD, 0x3F, 0xF0, 0xFF, 0x6B, 0xB6, 0xFF, 0x0E, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x04,
+    0x00, 0xA3, 0xFD, 0xDF, 0x29, 0x00, 0xDE, 0xA2, 0x32, 0x3F, 0x78, 0x9C, 0x01, 0x5A, 0x00, 0xA5,
+    0xFF, 0x00, 0x81, 0xFD, 0xBE, 0x04, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x8F, 0x00, 0xB0, 0xFF, 0x9F,
+    0xFB, 0xFF, 0x04, 0xF1, 0xFF, 0x03, 0x80, 0xFF, 0x0C, 0xF4, 0xDF, 0x00, 0x00, 0xFF, 0x1F, 0xF4,
+    0xCF, 0x00, 0x00, 0xFE, 0x2F, 0xF3, 0xFF, 0x01, 0x40, 0xFF, 0x3F, 0xE0, 0xFF, 0x7D, 0xF9, 0xFF,
+    0x3F, 0x50, 0xFF, 0xFF, 0xEF, 0xFC, 0x1F, 0x00, 0xC5, 0xFF, 0x2B, 0xFD, 0x0E, 0x00, 0x00, 0x00,
+    0x20, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0x04, 0x30, 0x79, 0xB8, 0xFF, 0xAF, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x30, 0xFF, 0xDF, 0x39, 0x00, 0x00, 0xC0, 0x50, 0x2E, 0x67, 0x78,
+    0x9C, 0x7B, 0xEA, 0xF7, 0x67, 0xFF, 0xCF, 0xF9, 0x09, 0x6C, 0x0C, 0x50, 0x90, 0xC0, 0xF6, 0x6B,
+    0xFE, 0xEF, 0xFD, 0x4F, 0xFC, 0x00, 0x7C, 0xAC, 0x09, 0xD8, 0x78, 0x9C, 0x0B, 0x78, 0xC7, 0x72,
+    0xE0, 0x3F, 0xF7, 0x84, 0xFF, 0x9C, 0x0C, 0x69, 0x0C, 0x98, 0x20, 0xE1, 0x3F, 0xE7, 0x84, 0xFF,
+    0x2C, 0x07, 0xDE, 0x33, 0x7C, 0xE8, 0x67, 0xF8, 0xAC, 0xCF, 0x00, 0x00, 0x0C, 0xB6, 0x0C, 0x56,
+    0x78, 0x9C, 0x63, 0x60, 0x80, 0x81, 0x04, 0x39, 0x10, 0xF1, 0x4F, 0x1E, 0x44, 0xBC, 0xE7, 0x00,
+    0x11, 0xEC, 0x40, 0xE2, 0x3E, 0x2B, 0x03, 0xC3, 0xC7, 0xFF, 0x5C, 0x40, 0xA9, 0x09, 0xFF, 0xDF,
+    0x4B, 0x00, 0xA9, 0xC2, 0x7F, 0xFF, 0xBD, 0x80, 0x54, 0xC0, 0x9F, 0xFF, 0xBC, 0x40, 0xCA, 0xE0,
+    0xB7, 0x3C, 0x48, 0xAF, 0x82, 0x24, 0x00, 0xA7, 0x84, 0x14, 0x0A, 0x78, 0x9C, 0xFB, 0xF8, 0x1F,
+    0x08, 0xE4, 0x3F, 0x82, 0x49, 0x07, 0x17, 0x20, 0x60, 0x81, 0x90, 0x1F, 0x91, 0xC4, 0x01, 0xB0,
+    0x2F, 0x16, 0xD9, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x81, 0x87, 0x6C, 0x20, 0xF2, 0xE3, 0x7B, 0x10,
+    0xD5, 0xF0, 0x0F, 0x4C, 0x15, 0x40, 0xA8, 0x80, 0xBF, 0x60, 0x6A, 0xC1, 0x7F, 0x79, 0x06, 0x86,
+    0xC6, 0x7F, 0xFF, 0x39, 0x19, 0x96, 0xFC, 0x7F, 0x2F, 0xCE, 0x70, 0xE1, 0xFF, 0x79, 0x56, 0xA0,
+    0xFA, 0xF5, 0xCC, 0x40, 0xA9, 0x89, 0x4C, 0x20, 0xBD, 0x00, 0xEB, 0xF5, 0x15, 0xAD, 0x78, 0x9C,
+    0x0B, 0x78, 0xF5, 0x3E, 0x87, 0xE1, 0xF7, 0xFF, 0xFF, 0xFF, 0xB9, 0xBF, 0xAE, 0x5B, 0xF1, 0x3F,
+    0x3E, 0x80, 0x81, 0xE1, 0x47, 0x3D, 0x03, 0x03, 0xC3, 0xAF, 0x7C, 0x06, 0x86, 0x82, 0xFF, 0x72,
+    0x40, 0xC6, 0x7B, 0x66, 0x86, 0x05, 0xFF, 0x65, 0x18, 0x18, 0x3E, 0xDE, 0x07, 0x0A, 0x7F, 0x9A,
+    0xCF, 0x00, 0x05, 0x0E, 0xEA, 0x40, 0xE2, 0xEB, 0x7B, 0x20, 0xF1, 0xFD, 0x3F, 0x90, 0xB8, 0xD8,
+    0xCF, 0xC0, 0x00, 0x00, 0xE4, 0x3D, 0x1B, 0xA8, 0x78, 0x9C, 0x15, 0xCE, 0x31, 0x0E, 0x82, 0x40,
+    0x14, 0x84, 0xE1, 0x11, 0x5D, 0x16, 0x5C, 0x0B, 0x2B, 0x4A, 0xA5, 0xB3, 0xB0, 0xC0, 0xC2, 0x83,
+    0x70, 0x03, 0x0B, 0x7B, 0xA3, 0xF7, 0x31, 0xC6, 0xC6, 0xD2, 0x78, 0x02, 0x83, 0x37, 0x90, 0xD8,
+    0x98, 0xD8, 0x78, 0x03, 0x69, 0x24, 0x02, 0xE1, 0xED, 0xC8, 0x4E, 0xF9, 0x37, 0xDF, 0x00, 0xE9,
+    0x8B, 0xE7, 0x01, 0x80, 0x85, 0x90, 0xBC, 0xF7, 0x80, 0xF2, 0x1D, 0x61, 0x67, 0x27, 0x88, 0x19,
+    0x76, 0xF9, 0x91, 0x21, 0xCF, 0xF0, 0xE4, 0x75, 0x49, 0xEF, 0x3B, 0xBD, 0xB1, 0x60, 0xD0, 0x06,
+    0xB5, 0xA9, 0x56, 0x10, 0x5D, 0x0F, 0x45, 0xDB, 0x10, 0xD6, 0xFF, 0x8D, 0x6C, 0x44, 0x05, 0xFA,
+    0x95, 0xB1, 0x8A, 0x2A, 0xA6, 0x6A, 0x02, 0xD1, 0x62, 0x8E, 0x9C, 0xB1, 0xDF, 0x98, 0x92, 0x14,
+    0x5E, 0x50, 0x26, 0x69, 0x7B, 0xD8, 0x7E, 0x42, 0xE4, 0x8E, 0x71, 0x8B, 0xB9, 0xF1, 0xC6, 0xEB,
+    0xB9, 0x63, 0x3A, 0x9C, 0x89, 0x6B, 0x27, 0x29, 0xF6, 0xDD, 0x9F, 0x3F, 0x85, 0x7A, 0x45, 0xD0,
+    0x78, 0x9C, 0x1D, 0xCC, 0xC1, 0x0D, 0x44, 0x50, 0x00, 0x84, 0xE1, 0x61, 0x11, 0x07, 0xD9, 0xE8,
+    0xC0, 0x5D, 0x13, 0x74, 0x42, 0x25, 0x94, 0x62, 0xCF, 0x12, 0x35, 0xEC, 0x76, 0xA0, 0x04, 0x3A,
+    0x78, 0x44, 0xD6, 0xAE, 0x08, 0x63, 0x9E, 0xFF, 0xF2, 0x5D, 0x26, 0x03, 0x8C, 0x2C, 0x60, 0x5B,
+    0xF8, 0xBE, 0xDD, 0x0C, 0x1D, 0xEB, 0x59, 0x31, 0x10, 0x39, 0x53, 0x46, 0xF2, 0x45, 0xFF, 0x48,
+    0xE4, 0x44, 0xE7, 0x5F, 0xCB, 0x6F, 0x8F, 0x65, 0x90, 0x7B, 0xAD, 0x07, 0x17, 0x31, 0x6D, 0x21,
+    0xCA, 0xDB, 0x27, 0x3E, 0xEC, 0xDA, 0x96, 0x19, 0x66, 0x3E, 0xB4, 0x69, 0xF0, 0x33, 0xDA, 0xAE,
+    0x06, 0x47, 0x23, 0x67, 0x7A, 0x17, 0x27, 0x3E, 0x34, 0x47, 0x78, 0x9C, 0xFB, 0xF8, 0xFF, 0xFF,
+    0xFB, 0x6C, 0x86, 0x8F, 0xFF, 0x81, 0x80, 0xE7, 0xE3, 0xFF, 0x59, 0xAF, 0xFE, 0xE7, 0x7F, 0xFC,
+    0xCF, 0xC8, 0xF0, 0x77, 0x3E, 0x88, 0xFC, 0xDD, 0x0F, 0x24, 0x03, 0xFE, 0xFB, 0x83, 0x65, 0xD9,
+    0x41, 0xE4, 0x79, 0x96, 0x8F, 0xFF, 0x3B, 0x4E, 0xFE, 0x8F, 0x07, 0xC9, 0xFE, 0xBC, 0x0F, 0x22,
+    0xBF, 0xFE, 0x07, 0x91, 0xBF, 0xDE, 0x7F, 0xFC, 0xBF, 0xEA, 0xD6, 0xFF, 0xF9, 0x60, 0x95, 0x32,
+    0x40, 0xF2, 0x7D, 0x0E, 0x03, 0x00, 0x8C, 0x93, 0x40, 0xFD, 0x78, 0x9C, 0x63, 0x10, 0x38, 0xFE,
+    0x6F, 0x1F, 0x1B, 0xC3, 0x93, 0xFF, 0xFF, 0xFF, 0xD7, 0x1B, 0xFC, 0xFF, 0xBF, 0xFA, 0xAF, 0xFC,
+    0x85, 0xFF, 0xB2, 0x0C, 0x0A, 0x6C, 0x5F, 0xFE, 0x33, 0x31, 0x30, 0x30, 0xFC, 0xDC, 0x0F, 0x24,
+    0x18, 0x7E, 0xF5, 0x83, 0xC8, 0x3F, 0xF5, 0x20, 0xF2, 0x37, 0x98, 0x0D, 0x11, 0xFF, 0xF6, 0x9F,
+    0x11, 0x48, 0x7E, 0xFC, 0x2F, 0xCD, 0xC0, 0xC0, 0x52, 0x00, 0xD4, 0xFB, 0x47, 0x9E, 0xE1, 0x07,
+    0xD0, 0x1C, 0x79, 0x06, 0x83, 0x5B, 0xFF, 0xF7, 0xB2, 0x01, 0x00, 0xDC, 0x3E, 0x26, 0x0D, 0x78,
+    0x9C, 0xFB, 0xF8, 0xFF, 0xFF, 0x3D, 0x4B, 0x06, 0x86, 0x8F, 0xFF, 0x81, 0x80, 0x0B, 0x48, 0xCD,
+    0x7A, 0xF5, 0x7F, 0x3F, 0x90, 0x62, 0x64, 0xF8, 0xFE, 0x9F, 0x0D, 0x44, 0x4D, 0xF8, 0xCF, 0x0B,
+    0xA2, 0x0C, 0xFE, 0xEB, 0x83, 0x28, 0x86, 0xFF, 0xFE, 0x48, 0x94, 0xC0, 0x7F, 0x7B, 0x10, 0xE5,
+    0xF0, 0x5F, 0x1E, 0x44, 0x6D, 0x80, 0xA8, 0xFC, 0xF9, 0x9F, 0xF5, 0xE3, 0xFF, 0x55, 0xBF, 0xFF,
+    0xAF, 0x87, 0x98, 0xC9, 0x01, 0xA2, 0xCE, 0x69, 0x30, 0x30, 0x00, 0x00, 0x8D, 0x3C, 0x3B, 0xBD,
+    0x78, 0x9C, 0xFB, 0xF8, 0xFF, 0xFF, 0xFF, 0xFE, 0x8F, 0x10, 0x62, 0xD6, 0xCC, 0xC8, 0x8F, 0xFF,
+    0x19, 0x19, 0x18, 0x90, 0x89, 0xFF, 0xFF, 0xF5, 0xA1, 0xC4, 0xAC, 0x99, 0x92, 0x18, 0xB2, 0xAB,
+    0x56, 0x45, 0x7D, 0x84, 0x1B, 0x00, 0x00, 0x44, 0x90, 0x30, 0x2B, 0x78, 0x9C, 0xFB, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFA, 0x8F, 0x10, 0x62, 0xE6, 0x4C, 0xCF, 0x8F, 0xFF, 0x19, 0x18, 0x18, 0x90, 0x89,
+    0xFF, 0xFF, 0xE5, 0xA1, 0xC4, 0xCC, 0x99, 0x9C, 0x18, 0xB2, 0x28, 0x04, 0x00, 0x03, 0xDF, 0x28,
+    0xFB, 0x78, 0x9C, 0x63, 0x60, 0x58, 0xFA, 0xEF, 0x7E, 0x36, 0x23, 0xC3, 0xE5, 0xFF, 0x40, 0xC0,
+    0xA2, 0xF0, 0xFF, 0xFF, 0xBE, 0xDB, 0xF7, 0x19, 0x2E, 0xFC, 0x8F, 0x67, 0x60, 0x30, 0x64, 0xF8,
+    0xF2, 0x9F, 0x95, 0x01, 0x08, 0x7E, 0xDE, 0x07, 0x91, 0x0C, 0xBF, 0xE7, 0x83, 0xA9, 0x3F, 0xF5,
+    0x0C, 0xDF, 0xFE, 0xFF, 0xE7, 0xF8, 0xDD, 0x0F, 0xA6, 0x7E, 0xEE, 0x67, 0x58, 0x72, 0xEB, 0x3F,
+    0xC7, 0xD7, 0xFF, 0x4C, 0x0C, 0x13, 0xFE, 0x73, 0x7C, 0xF8, 0x2F, 0x03, 0xA2, 0x12, 0xFE, 0xFF,
+    0x5F, 0xFD, 0xE6, 0x3F, 0x07, 0xC3, 0x77, 0x90, 0x99, 0x1C, 0x0C, 0x0A, 0x37, 0xFF, 0xDF, 0xAB,
+    0x62, 0x04, 0x00, 0x9C, 0xBB, 0x35, 0xD2, 0x78, 0x9C, 0xFB, 0xF8, 0x9F, 0x91, 0x81, 0xE1, 0xBF,
+    0xFE, 0x47, 0x62, 0x28, 0x10, 0x40, 0x50, 0xAB, 0x56, 0xAD, 0x22, 0x52, 0x1F, 0x98, 0x02, 0x00,
+    0x81, 0x2B, 0x36, 0xC7, 0x78, 0x9C, 0xFB, 0xF8, 0x9F, 0xF1, 0x23, 0xD1, 0x08, 0x00, 0xAC, 0x24,
+    0x1D, 0x20, 0x78, 0x9C, 0x63, 0x10, 0xF8, 0x2F, 0xCF, 0x40, 0x3A, 0xE6, 0x67, 0x30, 0x00, 0xE2,
+    0x86, 0xFF, 0xBC, 0xDB, 0xFF, 0xFC, 0xE7, 0xF8, 0xF9, 0xFF, 0x3E, 0xE3, 0xF7, 0xF7, 0x92, 0x0C,
+    0x00, 0x7C, 0x30, 0x1A, 0xD0, 0x78, 0x9C, 0x1D, 0xCB, 0xCB, 0x0D, 0x40, 0x40, 0x14, 0x05, 0xD0,
+    0xFB, 0xD8, 0x4C, 0x88, 0xA5, 0xA5, 0x1E, 0xA8, 0x48, 0x09, 0x4A, 0xD0, 0x82, 0x8E, 0xB4, 0xA0,
+    0x03, 0x9F, 0x06, 0x26, 0xB3, 0x21, 0x42, 0x72, 0xBD, 0x6B, 0x75, 0x56, 0x27, 0xD1, 0xB0, 0x33,
+    0x24, 0xE7, 0x9D, 0xE1, 0x4C, 0x6C, 0xC4, 0xC9, 0xCC, 0xE9, 0xD8, 0xC3, 0x39, 0x18, 0xC4, 0xB3,
+    0x42, 0x90, 0xB9, 0x88, 0xAC, 0x44, 0xCD, 0x51, 0xD8, 0xF5, 0x07, 0x5B, 0x58, 0x8A, 0x96, 0x83,
+    0xC0, 0x1D, 0x4D, 0x6C, 0x2C, 0x3E, 0xE6, 0x57, 0x38, 0x83, 0x78, 0x9C, 0xFB, 0xF8, 0x9F, 0x91,
+    0x81, 0x81, 0xE1, 0x23, 0x15, 0xC8, 0x55, 0xAB, 0x56, 0x31, 0x7E, 0xFC, 0x0F, 0x04, 0x4C, 0x10,
+    0x12, 0x00, 0xA9, 0x23, 0x25, 0x1A, 0x78, 0x9C, 0x25, 0xCD, 0xC1, 0x0D, 0x40, 0x40, 0x14, 0x45,
+    0xD1, 0xB7, 0xB0, 0x61, 0xF1, 0xB5, 0xA0, 0x04, 0x1D, 0x28, 0x41, 0x09, 0x5A, 0x50, 0x82, 0x68,
+    0x40, 0x09, 0x4A, 0x98, 0x12, 0xE8, 0xC2, 0x92, 0x0E, 0x64, 0x22, 0x11, 0x24, 0xE6, 0xF9, 0xDF,
+    0xEC, 0x4E, 0xEE, 0xE6, 0x7A, 0x36, 0x00, 0x6E, 0x8A, 0xA7, 0x53, 0x04, 0x03, 0x81, 0x92, 0x8A,
+    0x95, 0x09, 0xBA, 0x3D, 0x88, 0x77, 0x4C, 0xB1, 0x8D, 0x5A, 0xDC, 0x23, 0x38, 0x6A, 0xC5, 0x74,
+    0x56, 0xB8, 0xC4, 0xE0, 0x07, 0xBC, 0xA9, 0x61, 0x5E, 0x4B, 0x26, 0x86, 0x96, 0xFD, 0x0E, 0x43,
+    0xC1, 0xC5, 0xFD, 0xC0, 0x1B, 0xEA, 0x88, 0x8B, 0x79, 0xC4, 0xC1, 0x2C, 0x62, 0xD3, 0x09, 0xE5,
+    0x03, 0x37, 0x5F, 0x4B, 0x90, 0x78, 0x9C, 0xFB, 0xF8, 0xDF, 0x9E, 0x81, 0x61, 0xC1, 0x7F, 0xE6,
+    0x8F, 0xFF, 0xCF, 0x43, 0xE9, 0xFF, 0xAC, 0x50, 0x9A, 0x0F, 0x4C, 0xCF, 0xFF, 0x5B, 0x0F, 0xA6,
+    0xD7, 0x7F, 0xFD, 0xCF, 0x08, 0xA2, 0xF7, 0x6F, 0xF8, 0xCF, 0x05, 0xA6, 0x15, 0xFE, 0xDB, 0x83,
+    0x69, 0x86, 0x9F, 0xE7, 0x21, 0xF4, 0xC7, 0xFF, 0xD3, 0xC0, 0x74, 0xC1, 0xFF, 0x79, 0x60, 0x9A,
+    0xE1, 0xEF, 0x7F, 0x08, 0xFD, 0x05, 0x4A, 0x6F, 0x80, 0xD2, 0x0A, 0x40, 0x1A, 0x00, 0x90, 0xA7,
+    0x45, 0x9E, 0x78, 0x9C, 0x63, 0x50, 0x38, 0xF1, 0xEF, 0x1C, 0x3B, 0x03, 0x03, 0xC3, 0xB7, 0xFF,
+    0xFF, 0xFF, 0xBF, 0x67, 0x66, 0x08, 0xF8, 0xFF, 0x7F, 0xF5, 0x9F, 0xFF, 0xFA, 0x0C, 0x0F, 0xFE,
+    0xCB, 0x30, 0x18, 0xFC, 0xDF, 0xCF, 0xF0, 0xF5, 0x3F, 0x13, 0x48, 0x8E, 0xF1, 0xE7, 0x79, 0xA0,
+    0x9A, 0x8F, 0xFF, 0x59, 0x7F, 0xCF, 0x07, 0xD2, 0x0F, 0xFE, 0xB3, 0xFD, 0xE9, 0x07, 0xD2, 0x17,
+    0xFE, 0xB3, 0xC3, 0xF8, 0x50, 0x79, 0x16, 0xB0, 0xFA, 0xEF, 0xFF, 0x19, 0x1F, 0xFC, 0x97, 0x65,
+    0x70, 0xF8, 0xBF, 0x1E, 0x64, 0xDE, 0x9E, 0xBF, 0x40, 0xF3, 0x60, 0xE6, 0x33, 0x28, 0xDC, 0xF8,
+    0xBF, 0x0F, 0x68, 0x1F, 0x00, 0x13, 0x2E, 0x3B, 0x1E, 0x78, 0x9C, 0xFB, 0xF8, 0xFF, 0xFF, 0x7D,
+    0x09, 0x86, 0x8F, 0xFF, 0xFF, 0xFF, 0x7F, 0xCF, 0xF4, 0xF1, 0xFF, 0xAC, 0x3F, 0xFF, 0x79, 0x3E,
+    0xFE, 0x67, 0x4C, 0xF8, 0x2F, 0x0F, 0x24, 0x19, 0xFE, 0xDB, 0x03, 0x49, 0x01, 0x30, 0xD9, 0xF0,
+    0x9F, 0xFF, 0xE3, 0xFF, 0x55, 0x7F, 0xFF, 0x73, 0x81, 0x54, 0x9E, 0x67, 0x04, 0x92, 0xE7, 0xD8,
+    0x18, 0x40, 0x6A, 0x18, 0x70, 0x92, 0x00, 0x30, 0xEC, 0x31, 0x89, 0x78, 0x9C, 0x63, 0x50, 0x38,
+    0xF1, 0xEF, 0x1C, 0x3B, 0x03, 0x03, 0xC3, 0xB7, 0xFF, 0xFF, 0xFF, 0xBF, 0x67, 0x66, 0x08, 0xF8,
+    0xFF, 0x7F, 0xF5, 0x9F, 0xFF, 0xFA, 0x0C, 0x0F, 0xFE, 0xCB, 0x30, 0x18, 0xFC, 0x5F, 0xCF, 0xF0,
+    0xF5, 0x3F, 0x13, 0x48, 0x8E, 0xF1, 0xE7, 0x79, 0xA0, 0x9A, 0x8F, 0xFF, 0x59, 0x7E, 0xCF, 0x07,
+    0xD2, 0x0F, 0xFE, 0xB3, 0xFD, 0xE9, 0x07, 0xD2, 0x17, 0xFE, 0xB3, 0xC3, 0xF8, 0x30, 0x79, 0xB0,
+    0xFA, 0xEF, 0xFF, 0x19, 0x1F, 0xFC, 0x97, 0x65, 0x70, 0x00, 0xEA, 0x07, 0x9A, 0xB7, 0xE7, 0xEF,
+    0x7F, 0x39, 0x88, 0xF9, 0xF7, 0x99, 0x19, 0x18, 0x14, 0x6E, 0xFC, 0x07, 0x1A, 0x0F, 0x02, 0x02,
+    0x7F, 0xEF, 0x33, 0x82, 0x19, 0x8F, 0x80, 0x6A, 0x41, 0x40, 0xE1, 0xDF, 0x7D, 0x46, 0x00, 0xDE,
+    0xBD, 0x41, 0x3E, 0x78, 0x9C, 0xFB, 0xF8, 0xFF, 0xFF, 0x39, 0x09, 0x06, 0x86, 0x8F, 0xFF, 0xFF,
+    0xFF, 0x7F, 0xCF, 0x04, 0xA4, 0x56, 0xFD, 0xF9, 0xCF, 0x03, 0xA4, 0x18, 0x13, 0xFE, 0xCB, 0x83,
+    0x28, 0x86, 0xFF, 0xF6, 0x20, 0x4A, 0xE0, 0xBF, 0x3E, 0x88, 0x3A, 0x0C, 0x96, 0x03, 0x02, 0x66,
+    0x30, 0xA5, 0x03, 0xD2, 0xB7, 0xF2, 0xBF, 0x1C, 0x88, 0x62, 0xFC, 0xB5, 0x1E, 0x4C, 0x3D, 0xFC,
+    0xCF, 0x0A, 0xA2, 0x02, 0x20, 0x1A, 0x18, 0x7E, 0x9D, 0x07, 0x53, 0x0F, 0xFF, 0xB3, 0x03, 0x00,
+    0x7E, 0x99, 0x3A, 0x13, 0x78, 0x9C, 0x63, 0x28, 0xF8, 0xF3, 0x3E, 0x8A, 0x81, 0xE1, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xD9, 0x1B, 0xFE, 0xEF, 0xBF, 0xFD, 0x9F, 0xF1, 0xC0, 0x7F, 0x76, 0x86, 0x40, 0x86,
+    0x0B, 0xFF, 0xD9, 0x18, 0x18, 0x18, 0x16, 0xFC, 0xCF, 0x07, 0x92, 0x0A, 0xFF, 0xFF, 0xE7, 0x02,
+    0xA9, 0xCB, 0xFF, 0xFF, 0xEB, 0x02, 0xA9, 0x6B, 0xFF, 0xDF, 0x33, 0x02, 0xA9, 0x6F, 0xFF, 0x39,
+    0x80, 0x64, 0xC3, 0x7F, 0xEE, 0x05, 0xCC, 0x0C, 0x13, 0xFE, 0x73, 0x7D, 0x78, 0xBF, 0xFA, 0xCF,
+    0x7F, 0xD6, 0x0F, 0x40, 0x63, 0xE6, 0x33, 0x38, 0xDC, 0xFC, 0xB7, 0x8F, 0x85, 0x01, 0x00, 0x85,
+    0x03, 0x2A, 0xC9, 0x78, 0x9C, 0xFB, 0xF9, 0x1F, 0x08, 0xF6, 0xFF, 0x04, 0x93, 0x4B, 0x57, 0xFD,
+    0x7D, 0xBF, 0xAA, 0x8A, 0x81, 0xE1, 0xC7, 0x7A, 0x06, 0x06, 0xCA, 0x49, 0x00, 0xE5, 0xA0, 0x23,
+    0x9C, 0x78, 0x9C, 0xFB, 0xFC, 0x9F, 0x81, 0x41, 0xE0, 0xBF, 0xFC, 0x67, 0x0A, 0x28, 0x85, 0xFF,
+    0xF2, 0x9F, 0xFE, 0x33, 0x31, 0x38, 0xFC, 0xE7, 0x7F, 0xF0, 0x9F, 0x9B, 0xE1, 0xE0, 0x7F, 0xEE,
+    0x82, 0xFF, 0xEF, 0x4F, 0xFF, 0xFF, 0xCF, 0xC2, 0xF0, 0xF3, 0xFF, 0xFF, 0xFF, 0xF9, 0x0C, 0x0C,
+    0x0E, 0xAF, 0xFE, 0xCF, 0x65, 0x62, 0x00, 0x00, 0x1B, 0x46, 0x32, 0x9F, 0x78, 0x9C, 0x15, 0xCC,
+    0xD1, 0x0D, 0x43, 0x50, 0x00, 0x86, 0xD1, 0x4F, 0x22, 0x6D, 0x52, 0x22, 0x36, 0x60, 0x03, 0x2B,
+    0x74, 0x83, 0xDA, 0x80, 0x0D, 0x74, 0x83, 0x0E, 0x61, 0x80, 0xDA, 0xC0, 0x08, 0x6C, 0xA0, 0x6F,
+    0xC6, 0xA8, 0xDB, 0x04, 0x09, 0xEA, 0xE7, 0x3E, 0x9D, 0xB7, 0xF3, 0xCF, 0x80, 0xF5, 0x35, 0xD7,
+    0x10, 0x2A, 0xF9, 0x09, 0x52, 0xF9, 0x1F, 0xB9, 0x54, 0xBA, 0x3E, 0x75, 0x63, 0x90, 0x13, 0x2B,
+    0x60, 0xEC, 0x60, 0x7B, 0xB0, 0x14, 0x30, 0xBF, 0xD9, 0x23, 0x30, 0xDF, 0xBB, 0x7C, 0x68, 0x55,
+    0xEA, 0x02, 0xB9, 0x7A, 0x39, 0xB6, 0x58, 0x9B, 0xF3, 0x63, 0x53, 0x61, 0x99, 0x14, 0x59, 0x8C,
+    0x3C, 0x38, 0x00, 0x7C, 0x1E, 0x2B, 0x3B, 0x78, 0x9C, 0x0D, 0xCD, 0x61, 0x0D, 0x82, 0x60, 0x1C,
+    0x84, 0xF1, 0x47, 0xA6, 0x6E, 0xB8, 0xBD, 0x8E, 0x06, 0x44, 0x30, 0x82, 0x34, 0xD0, 0x06, 0x44,
+    0x30, 0x82, 0x34, 0xD0, 0x06, 0x44, 0x20, 0x82, 0x34, 0x80, 0x06, 0x44, 0x00, 0x1C, 0x08, 0x08,
+    0x78, 0xFE, 0x3F, 0xDD, 0x6F, 0xBB, 0xED, 0x6E, 0x3D, 0xC3, 0x50, 0x40, 0x23, 0x6F, 0xBA, 0xC3,
+    0x2C, 0x78, 0xD7, 0xF4, 0x2F, 0x90, 0xB6, 0x7C, 0x32, 0xDA, 0x9A, 0x48, 0xF2, 0xF9, 0xDE, 0x28,
+    0xE5, 0x25, 0x9A, 0x1D, 0xBF, 0x13, 0x4F, 0xED, 0xF3, 0x62, 0x0C, 0x03, 0x1D, 0xB9, 0xEA, 0xD0,
+    0xA4, 0x5D, 0x6C, 0x41, 0x20, 0xD7, 0xC5, 0x6D, 0x6A, 0x25, 0xAC, 0xE1, 0x18, 0xE6, 0x55, 0x2E,
+    0x0F, 0xA6, 0xCB, 0xE2, 0x12, 0xD9, 0x10, 0xF4, 0x0F, 0xF9, 0x91, 0x86, 0xCC, 0xD8, 0x16, 0xDA,
+    0xA1, 0x25, 0x36, 0x96, 0xD2, 0x86, 0x45, 0xA1, 0x31, 0x51, 0x05, 0xA3, 0x9C, 0x31, 0x52, 0x0A,
+    0x9D, 0x5D, 0xF3, 0x07, 0x43, 0xB2, 0x4E, 0x2E, 0x78, 0x9C, 0x15, 0x8A, 0x41, 0x0A, 0x82, 0x60,
+    0x18, 0x05, 0xA7, 0xC0, 0x95, 0x12, 0x9D, 0xC0, 0xBC, 0x99, 0xD1, 0xAA, 0x9D, 0x1D, 0xA1, 0x1B,
+    0x78, 0x05, 0x6F, 0xF0, 0x77, 0x83, 0xBA, 0x4A, 0xFB, 0x40, 0x30, 0xC4, 0x28, 0x6B, 0xFC, 0xDA,
+    0xCC, 0x83, 0x37, 0x33, 0xBA, 0x66, 0x6B, 0x7D, 0x31, 0xA7, 0x33, 0xAF, 0xAC, 0x79, 0xBA, 0x62,
+    0xEA, 0xF9, 0x36, 0x70, 0xF3, 0x68, 0x01, 0x95, 0x7D, 0x54, 0xF0, 0xB2, 0x0D, 0x46, 0xB0, 0xFB,
+    0xCF, 0x6C, 0x0A, 0x9E, 0x7C, 0x98, 0xC1, 0xE0, 0xC1, 0x12, 0x3E, 0x2D, 0x73, 0x62, 0xEF, 0x26,
+    0x8E, 0xEC, 0x1E, 0xE2, 0x6C, 0xF9, 0xBE, 0x46, 0xF6, 0x4B, 0x0B, 0xD0, 0x60, 0x2F, 0x5D, 0x78,
+    0x9C, 0xFB, 0xBD, 0x9F, 0x81, 0x61, 0xC2, 0x7F, 0xDE, 0xCF, 0xFF, 0x99, 0x19, 0x3E, 0xFE, 0x67,
+    0x59, 0xF0, 0x9F, 0x9B, 0xE1, 0xE7, 0x7E, 0x06, 0x85, 0xFF, 0xF6, 0x02, 0xFF, 0xED, 0x19, 0x80,
+    0xCC, 0x09, 0xFF, 0xB9, 0x18, 0x80, 0x12, 0x5F, 0xFF, 0x33, 0x31, 0x30, 0x34, 0xFC, 0xFF, 0x3F,
+    0x9F, 0x01, 0x08, 0xFE, 0xFD, 0x97, 0x07, 0x51, 0xDF, 0xFE, 0xB3, 0x83, 0xA8, 0x0F, 0x20, 0x29,
+    0x22, 0x28, 0x00, 0x58, 0x1D, 0x27, 0x60, 0x78, 0x9C, 0xFB, 0xF2, 0x1F, 0x08, 0xEA, 0xBF, 0x80,
+    0xC9, 0x45, 0xAB, 0x56, 0x9D, 0xFA, 0xAF, 0xCF, 0xC0, 0xC0, 0x70, 0xE1, 0x3F, 0x3B, 0x90, 0xFC,
+    0x79, 0x1E, 0x48, 0x04, 0xFC, 0x97, 0x07, 0x92, 0x0F, 0xFF, 0xB3, 0x02, 0xC9, 0xDF, 0xEB, 0x81,
+    0x44, 0xC2, 0x7F, 0x39, 0x20, 0xF9, 0xE9, 0x3F, 0x0B, 0x90, 0xFC, 0x33, 0x1F, 0x48, 0x34, 0xFC,
+    0xE7, 0x05, 0x92, 0x9F, 0xFF, 0xAF, 0x59, 0xB5, 0x2A, 0xEB, 0x07, 0xC8, 0x9C, 0xF5, 0x10, 0x12,
+    0x00, 0x10, 0x0A, 0x2D, 0xA3, 0x78, 0x9C, 0xFB, 0xF1, 0x3F, 0xFF, 0x07, 0x10, 0xF9, 0x0B, 0xFD,
+    0xD0, 0x67, 0x20, 0x8C, 0x80, 0xCA, 0xC0, 0xEA, 0x01, 0xDE, 0x1D, 0x1A, 0x1F, 0x78, 0x9C, 0xFB,
+    0xAD, 0xCF, 0xC0, 0xC0, 0xF0, 0xB5, 0x1F, 0x48, 0x3C, 0x78, 0x0F, 0x24, 0x26, 0xFC, 0x67, 0x61,
+    0x60, 0x30, 0xF8, 0xCF, 0x05, 0x64, 0xFE, 0xE5, 0x07, 0x12, 0xDF, 0xF3, 0x81, 0xC4, 0xC7, 0xF3,
+    0x40, 0x62, 0xC3, 0x7F, 0x26, 0x06, 0x86, 0x80, 0xFF, 0xEC, 0x40, 0xE6, 0x3F, 0x5E, 0x20, 0xF1,
+    0xD3, 0x1E, 0x48, 0x7C, 0x9E, 0x0F, 0x24, 0x2E, 0xFC, 0x07, 0x12, 0x05, 0xFF, 0x59, 0x01, 0x39,
+    0x88, 0x15, 0x9B, 0x78, 0x9C, 0xFB, 0xFE, 0xBF, 0xFE, 0xFB, 0xFF, 0x7A, 0xC5, 0xAF, 0xF5, 0x0C,
+    0x9F, 0x09, 0x23, 0xA0, 0xB2, 0xEF, 0x60, 0xF5, 0x00, 0x3D, 0xD0, 0x1E, 0x57, 0x78, 0x9C, 0x63,
+    0x60, 0xF8, 0xC5, 0xC2, 0xC0, 0xC0, 0x20, 0xF0, 0x9F, 0x07, 0x48, 0x36, 0xFC, 0x8F, 0x07, 0x92,
+    0x1F, 0xD6, 0xDF, 0x07, 0x92, 0xDF, 0x79, 0xFE, 0xB1, 0x32, 0x30, 0xFC, 0x63, 0xFB, 0xCE, 0xCB,
+    0x10, 0xF0, 0x9E, 0xE1, 0x63, 0x3C, 0xC3, 0x81, 0x7E, 0x86, 0x86, 0xFB, 0x0C, 0x9F, 0xF5, 0x81,
+    0x6A, 0x59, 0x7F, 0x73, 0x33, 0x30, 0xFC, 0xE4, 0x05, 0x00, 0x2B, 0xB7, 0x14, 0x03, 0x78, 0x9C,
+    0x2B, 0x28, 0x2F, 0x2F, 0x77, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x1F, 0x92, 0x06, 0xB9,
+    0x78, 0x9C, 0x7B, 0xF2, 0x9F, 0x85, 0x41, 0xE1, 0x8F, 0x3D, 0x03, 0x43, 0xC1, 0x7B, 0x26, 0x00,
+    0x22, 0x67, 0x04, 0xA4, 0x78, 0x9C, 0x63, 0x98, 0xFC, 0xF7, 0xBD, 0x15, 0x03, 0xC3, 0xDF, 0xFF,
+    0xFF, 0xFF, 0xB3, 0x30, 0x3C, 0xCD, 0x3C, 0xFA, 0x9F, 0x97, 0x81, 0x81, 0x41, 0xE1, 0x3F, 0x3F,
+    0x90, 0x64, 0xF8, 0x2F, 0xCF, 0x30, 0xF9, 0xCD, 0xFF, 0xFF, 0xF2, 0x09, 0xFF, 0xFF, 0xDF, 0xFB,
+    0x2F, 0xFF, 0xE1, 0xBF, 0x24, 0x50, 0xE4, 0xE3, 0x7F, 0x26, 0x03, 0x10, 0xDB, 0xEB, 0xF9, 0x7F,
+    0xF9, 0x09, 0xFF, 0xFF, 0xDF, 0xFF, 0x2D, 0xCF, 0x70, 0xE3, 0xBD, 0xE4, 0x17, 0x79, 0x00, 0x15,
+    0x6F, 0x26, 0x37, 0x78, 0x9C, 0xFB, 0x7A, 0x9E, 0x01, 0x08, 0xBE, 0x62, 0x92, 0xFB, 0x37, 0xFD,
+    0xD7, 0x06, 0xB2, 0xFF, 0xFD, 0x7F, 0xCF, 0xF4, 0xF5, 0xFF, 0xFC, 0x9F, 0xFF, 0xB9, 0xBE, 0xFE,
+    0x67, 0x4E, 0xF8, 0xCF, 0xFF, 0xF5, 0x3D, 0x03, 0xC3, 0x7F, 0x7B, 0x90, 0x9A, 0x7F, 0xF1, 0x50,
+    0x12, 0x22, 0xF2, 0x9F, 0xA5, 0x00, 0x28, 0xFB, 0x7F, 0xFD, 0x2F, 0xA0, 0xCA, 0xF3, 0xFF, 0x41,
+    0xBA, 0xEC, 0x37, 0x03, 0x4D, 0x00, 0x00, 0xE6, 0xF9, 0x33, 0xB3, 0x78, 0x9C, 0x63, 0x70, 0x78,
+    0xFD, 0xBE, 0x86, 0x81, 0xE1, 0xFB, 0xFF, 0xFF, 0xF7, 0x19, 0x1C, 0xFE, 0x9F, 0x5F, 0x59, 0xC7,
+    0xB0, 0xE0, 0x3F, 0x37, 0x03, 0x03, 0xC3, 0x83, 0xFF, 0xAC, 0x40, 0xF2, 0xC3, 0x7F, 0x26, 0x24,
+    0x92, 0x05, 0x48, 0x1E, 0x00, 0xCA, 0x1A, 0x30, 0x04, 0x00, 0x55, 0x9E, 0x65, 0x60, 0xF8, 0xF5,
+    0xFF, 0xFF, 0x79, 0x06, 0x86, 0x84, 0x3F, 0xEF, 0xBD, 0x19, 0x00, 0x75, 0xDD, 0x1E, 0xEE, 0x78,
+    0x9C, 0x63, 0x60, 0x60, 0x60, 0xF8, 0xBE, 0x9E, 0x01, 0x93, 0x6C, 0xF8, 0x97, 0xFB, 0x6D, 0x3D,
+    0xC3, 0x9F, 0xFF, 0xFF, 0xFF, 0xAC, 0x4F, 0xF8, 0x7F, 0xFE, 0xE6, 0xFF, 0xF5, 0x07, 0xFE, 0x73,
+    0x33, 0xFC, 0x59, 0xFF, 0xE1, 0x3F, 0x0B, 0xC3, 0x37, 0x20, 0xC9, 0xC4, 0xF0, 0x05, 0x4E, 0x82,
+    0x44, 0x0E, 0xFC, 0xE7, 0x62, 0xF8, 0x0D, 0x54, 0xB9, 0xFF, 0xC4, 0x7F, 0xB0, 0xAE, 0x9F, 0xEB,
+    0x19, 0x26, 0xFE, 0x8B, 0x79, 0xB0, 0x1E, 0x00, 0xCF, 0xB5, 0x35, 0x73, 0x78, 0x9C, 0x63, 0x70,
+    0x78, 0xFD, 0x5E, 0x93, 0x81, 0xE1, 0xFB, 0xFF, 0xFF, 0xEF, 0x99, 0x0D, 0xFE, 0xD7, 0x4F, 0xF9,
+    0xCF, 0xBB, 0xE0, 0x3F, 0x07, 0xC3, 0x1F, 0xFB, 0x07, 0xFF, 0x59, 0x18, 0xBE, 0xE7, 0x7F, 0xF8,
+    0x0F, 0x04, 0xF5, 0x60, 0xB2, 0xFF, 0xC1, 0x7F, 0x11, 0x41, 0x41, 0xC6, 0x05, 0xFF, 0x39, 0x19,
+    0x18, 0x18, 0x0C, 0xFE, 0xAF, 0x4F, 0xDB, 0xCE, 0xCB, 0xF0, 0x0D, 0x28, 0xCE, 0xCB, 0x60, 0xF0,
+    0xEA, 0xFF, 0x3A, 0x16, 0x00, 0xD2, 0x0E, 0x28, 0x1B, 0x78, 0x9C, 0x63, 0x28, 0xF8, 0xFB, 0x9E,
+    0x8B, 0xE1, 0xDB, 0xFF, 0xFF, 0xDC, 0x0C, 0xBF, 0xEF, 0xCF, 0x60, 0x65, 0xF8, 0xEB, 0xCF, 0xC0,
+    0xB0, 0xE8, 0xFF, 0xFF, 0xFF, 0x0C, 0x3F, 0x41, 0x44, 0xF0, 0xBF, 0xFE, 0x50, 0x06, 0xB0, 0x18,
+    0xB1, 0x04, 0x00, 0xB8, 0x1C, 0x1E, 0x9F, 0x78, 0x9C, 0x63, 0x58, 0xFC, 0xEF, 0xFF, 0xFF, 0xF5,
+    0x0E, 0xFF, 0x81, 0x20, 0xEF, 0xC2, 0x7F, 0xD6, 0x4F, 0xFF, 0x19, 0x3E, 0xFC, 0x67, 0xD8, 0xF0,
+    0x9F, 0x19, 0x4C, 0xB2, 0x1C, 0xF8, 0xCF, 0xF6, 0xE9, 0x3F, 0xA3, 0x01, 0x50, 0xB2, 0x9E, 0x81,
+    0xE1, 0xC7, 0xFF, 0x7D, 0x2C, 0x0C, 0x01, 0xFF, 0x19, 0x19, 0x18, 0x18, 0x1A, 0xFE, 0x77, 0x77,
+    0xA8, 0x31, 0x28, 0x00, 0xB5, 0xFE, 0xE7, 0x6C, 0x00, 0x91, 0xF6, 0x3F, 0xF3, 0x19, 0x04, 0x7E,
+    0xE5, 0xFF, 0xE3, 0x65, 0x60, 0xF8, 0x96, 0xFF, 0x37, 0x5F, 0xB0, 0xE8, 0xBF, 0xFC, 0x57, 0x90,
+    0x99, 0x2C, 0x06, 0xAF, 0xFE, 0x9F, 0x13, 0x67, 0x00, 0x00, 0x6D, 0x59, 0x3B, 0x54, 0x78, 0x9C,
+    0xFB, 0x7A, 0x9E, 0x01, 0x08, 0xBE, 0x62, 0x92, 0xFB, 0x37, 0xFD, 0xCF, 0x05, 0xB2, 0xFF, 0xFD,
+    0xFF, 0xCF, 0xF6, 0xF5, 0xFF, 0xFA, 0x97, 0xFF, 0xF9, 0xBE, 0xFE, 0x67, 0x35, 0xF8, 0xAF, 0xFF,
+    0xF5, 0x3F, 0x03, 0xC3, 0x7F, 0x7B, 0x90, 0x9A, 0x7F, 0x44, 0x91, 0x00, 0xBB, 0x92, 0x2F, 0xD2,
+    0x78, 0x9C, 0xBB, 0x54, 0xFF, 0xFD, 0xFE, 0xE3, 0x7E, 0x06, 0x86, 0xAF, 0xE7, 0xB1, 0x43, 0x00,
+    0x91, 0xAA, 0x19, 0xCA, 0x78, 0x9C, 0x63, 0x50, 0xF8, 0xCB, 0xCE, 0x50, 0xF0, 0x9F, 0x97, 0xC1,
+    0xE0, 0x1F, 0x07, 0x03, 0x08, 0x04, 0xFC, 0xE7, 0x21, 0x19, 0x37, 0xFC, 0xE7, 0x9E, 0xFC, 0xF3,
+    0x3F, 0xC7, 0xD7, 0xFF, 0xFF, 0x99, 0x9E, 0xBC, 0xD7, 0x66, 0x00, 0x00, 0x60, 0xD8, 0x1E, 0x86,
+    0x78, 0x9C, 0xFB, 0x7A, 0x9E, 0x01, 0x04, 0xBE, 0xE2, 0xA0, 0x0C, 0xFE, 0xC7, 0x83, 0xA8, 0x47,
+    0xFF, 0xD9, 0x80, 0x94, 0xC0, 0xBF, 0x7E, 0xA0, 0xE0, 0xFE, 0x03, 0xFF, 0xB9, 0x80, 0xD4, 0xFA,
+    0x5F, 0x20, 0x45, 0x5F, 0xDF, 0xFF, 0xCF, 0x07, 0x51, 0xFF, 0xFF, 0xFF, 0x67, 0x02, 0x51, 0x33,
+    0xFE, 0xF3, 0x80, 0xF5, 0xFD, 0xED, 0x07, 0x53, 0x5F, 0xFE, 0xB3, 0x80, 0xA8, 0x09, 0xFF, 0xE5,
+    0xC0, 0x66, 0xFE, 0x5B, 0xCF, 0x00, 0x00, 0xF1, 0xD0, 0x31, 0x23, 0x78, 0x9C, 0xFB, 0x7A, 0xFE,
+    0x2B, 0x5E, 0x08, 0x00, 0xD3, 0x7F, 0x1C, 0x41, 0x78, 0x9C, 0xFB, 0xAA, 0xBF, 0xF9, 0xBF, 0x8F,
+    0xC2, 0xEB, 0xF3, 0xAC, 0x0C, 0x5F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF1, 0x0C,
+    0x5F, 0xFF, 0xAF, 0xFF, 0xF9, 0xFF, 0xFF, 0xAC, 0xFF, 0xE7, 0x81, 0x2C, 0xD6, 0x86, 0xFF, 0xF5,
+    0x40, 0x8A, 0xE1, 0xEB, 0x7B, 0x06, 0x87, 0xFF, 0xF2, 0x0C, 0x9F, 0x80, 0xAC, 0xF3, 0x0C, 0x06,
+    0xFF, 0xF9, 0x19, 0x3E, 0x42, 0x59, 0x7C, 0xE4, 0xB1, 0x00, 0xF9, 0x19, 0x42, 0xAF, 0x78, 0x9C,
+    0xFB, 0xAA, 0xBF, 0xF9, 0x5F, 0x2E, 0xC3, 0xD7, 0xF5, 0xFF, 0xFF, 0xFF, 0x67, 0xFF, 0xFA, 0x7F,
+    0xFD, 0x8B, 0xFF, 0x7C, 0x5F, 0xFF, 0xB3, 0x1A, 0xFC, 0xD7, 0xFF, 0xFA, 0x9F, 0x81, 0xE1, 0xBF,
+    0xFD, 0xD7, 0xF3, 0x0C, 0x0C, 0xFF, 0x88, 0x22, 0x01, 0x28, 0x5D, 0x28, 0x13, 0x78, 0x9C, 0x63,
+    0x70, 0x78, 0xFD, 0xDE, 0x8A, 0x81, 0x81, 0xE1, 0xFB, 0xFF, 0xFF, 0xFF, 0xD9, 0x18, 0x0C, 0xFE,
+    0x9F, 0x3F, 0xF9, 0x5F, 0x9F, 0x61, 0xC1, 0x7F, 0x2E, 0x86, 0xDF, 0xF3, 0x19, 0x1E, 0xFC, 0x67,
+    0x61, 0xF8, 0xF2, 0x9E, 0xE1, 0xC3, 0x7F, 0x26, 0x86, 0x4F, 0xFF, 0xC1, 0xD4, 0xE7, 0xFF, 0x30,
+    0xC1, 0x05, 0xFF, 0xB9, 0x19, 0x7E, 0xAF, 0x87, 0x68, 0xB0, 0x67, 0x60, 0xF8, 0x06, 0xD4, 0xCE,
+    0xCE, 0xC0, 0x60, 0xF0, 0x0A, 0x64, 0x18, 0x00, 0x20, 0x2E, 0x2A, 0x6E, 0x78, 0x9C, 0xFB, 0x1A,
+    0xBF, 0xE9, 0xBF, 0x36, 0xC3, 0xD7, 0xFD, 0xFF, 0xFE, 0xBF, 0x67, 0xFA, 0xFA, 0x7F, 0xFE, 0xCF,
+    0xFF, 0x5C, 0x5F, 0xFF, 0x33, 0x07, 0xFC, 0xE7, 0xFF, 0xFA, 0x9E, 0x81, 0xE1, 0xBF, 0xFD, 0xD7,
+    0xF3, 0x0C, 0x0C, 0xFF, 0xE2, 0xC1, 0xA4, 0x3F, 0x54, 0xE4, 0x3F, 0x4B, 0x02, 0x50, 0xF6, 0xFF,
+    0xFA, 0x5F, 0x40, 0x95, 0xF7, 0xFF, 0xFF, 0x7F, 0xCF, 0xF8, 0x75, 0xFF, 0xE6, 0xF7, 0x5A, 0x0C,
+    0x20, 0x35, 0x0C, 0x38, 0x49, 0x00, 0x33, 0xBB, 0x35, 0x55, 0x78, 0x9C, 0x63, 0x68, 0xF8, 0x97,
+    0xFB, 0x71, 0x3D, 0xC3, 0x9F, 0xFF, 0xFF, 0x7F, 0xAD, 0x4F, 0xF8, 0x7F, 0xFE, 0xE6, 0xFF, 0xF5,
+    0x07, 0xFE, 0x73, 0x33, 0xFC, 0x59, 0xFF, 0xE1, 0x3F, 0x0B, 0xC3, 0x37, 0x20, 0xC9, 0xC4, 0xF0,
+    0x05, 0x4E, 0xB2, 0x30, 0x7C, 0x05, 0xCA, 0x72, 0x31, 0xFC, 0x06, 0xAA, 0xDC, 0xBF, 0xE3, 0x3F,
+    0x58, 0xD7, 0xEF, 0xF5, 0x0C, 0x13, 0xFF, 0xC5, 0x7C, 0x5F, 0xCF, 0x00, 0x04, 0xB8, 0x49, 0x00,
+    0x9A, 0x72, 0x37, 0x1A, 0x78, 0x9C, 0xFB, 0x2A, 0x3F, 0xF1, 0x1F, 0xC3, 0xD7, 0xFC, 0xBF, 0xFF,
+    0x19, 0xBE, 0xFE, 0xFF, 0x7F, 0x1F, 0x48, 0xD8, 0x30, 0x00, 0x09, 0x26, 0x20, 0x71, 0x9F, 0x01,
+    0x48, 0x9C, 0xC7, 0x47, 0x00, 0x00, 0xAA, 0x13, 0x1A, 0x68, 0x78, 0x9C, 0x63, 0xD8, 0xFA, 0xEF,
+    0x9C, 0x78, 0xC3, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFC, 0x8F, 0x38, 0xCE, 0xFB, 0xE1, 0x3F, 0x0B,
+    0x03, 0xC3, 0x85, 0xFF, 0xEB, 0x99, 0x19, 0x1C, 0xFE, 0xFF, 0x3F, 0xCF, 0xC4, 0x30, 0xF1, 0xFF,
+    0x7F, 0x7D, 0x06, 0x20, 0xD9, 0x2F, 0xC0, 0xC0, 0xF0, 0x73, 0xFE, 0x87, 0xEA, 0x90, 0xBF, 0xF5,
+    0x1F, 0x80, 0x8A, 0x65, 0x0B, 0xFE, 0xFC, 0xEF, 0x65, 0x04, 0x00, 0x02, 0x48, 0x21, 0xC6, 0x78,
+    0x9C, 0x63, 0x48, 0x60, 0x67, 0x60, 0x60, 0xF8, 0x2C, 0x0F, 0x24, 0x7E, 0x02, 0x89, 0x89, 0xFF,
+    0xFF, 0xFF, 0x67, 0xFD, 0x01, 0x22, 0x82, 0xFE, 0xE7, 0x87, 0x32, 0x32, 0xFC, 0x07, 0x49, 0x60,
+    0x25, 0xF4, 0x81, 0xC4, 0xDF, 0xFB, 0x33, 0x58, 0x19, 0xBE, 0xFF, 0xFF, 0xCF, 0xCE, 0xD0, 0xF0,
+    0xEF, 0x1C, 0x33, 0x00, 0xCA, 0xBC, 0x1A, 0xBD, 0x78, 0x9C, 0xFB, 0xB6, 0x9F, 0x81, 0xE1, 0xBF,
+    0xFE, 0x37, 0x62, 0xC8, 0xF3, 0x0C, 0x0A, 0xFF, 0xF5, 0xBF, 0xFE, 0x67, 0x68, 0xF8, 0xAF, 0xFF,
+    0xE9, 0x7F, 0xEF, 0xEF, 0xFF, 0xFA, 0x0B, 0xFE, 0xFF, 0x7F, 0xFF, 0x5B, 0x9F, 0xE1, 0xC5, 0x7B,
+    0xA9, 0xAF, 0xFA, 0x00, 0x44, 0x90, 0x27, 0x5E, 0x78, 0x9C, 0x01, 0x48, 0x00, 0xB7, 0xFF, 0xFD,
+    0x6F, 0x00, 0x00, 0xF7, 0xCF, 0xF7, 0xBF, 0x00, 0x00, 0xFC, 0x6F, 0xF1, 0xFF, 0x01, 0x10, 0xFF,
+    0x1F, 0xB0, 0xFF, 0x06, 0x70, 0xFF, 0x0A, 0x50, 0xFF, 0x0B, 0xC0, 0xFF, 0x04, 0x00, 0xFF, 0x0F,
+    0xF1, 0xEF, 0x00, 0x00, 0xFA, 0x5F, 0xF6, 0x9F, 0x00, 0x00, 0xF4, 0x9F, 0xFA, 0x3F, 0x00, 0x00,
+    0xE0, 0xDF, 0xFD, 0x0D, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0xFC, 0xCF, 0x00, 0x00, 0x31, 0xC1, 0x21, 0x9F, 0x78, 0x9C, 0x0D, 0xC4, 0xC1,
+    0x0D, 0xC1, 0x00, 0x00, 0x40, 0xD1, 0x9F, 0x90, 0x20, 0x41, 0xDC, 0x1D, 0x3A, 0x02, 0x23, 0x98,
+    0xC0, 0xC9, 0xBD, 0x23, 0xD4, 0x06, 0x3D, 0x3A, 0xB2, 0x01, 0x1B, 0xB0, 0x41, 0x07, 0x70, 0x68,
+    0x37, 0xA8, 0xC4, 0x02, 0x1A, 0xB4, 0x51, 0xD5, 0xAF, 0xEF, 0xF0, 0xEA, 0x98, 0xCC, 0x09, 0xE5,
+    0xB9, 0x4C, 0x28, 0x0C, 0xF8, 0x86, 0x85, 0xBC, 0xDB, 0x90, 0x36, 0xC8, 0xEC, 0x7D, 0xAE, 0xFB,
+    0xA5, 0xE3, 0x83, 0x83, 0xDF, 0x2E, 0xDD, 0x3A, 0x5C, 0x39, 0x77, 0xE3, 0xC5, 0x3E, 0xAE, 0x9D,
+    0x79, 0x17, 0x9A, 0x38, 0xA7, 0xAD, 0x12, 0xA8, 0xD2, 0x23, 0x75, 0x13, 0xC1, 0xD3, 0x88, 0xCA,
+    0x05, 0xDC, 0xBA, 0x5E, 0x4E, 0xE1, 0xD4, 0xF5, 0x70, 0xC4, 0x1F, 0x33, 0x8D, 0x3A, 0xE6, 0x78,
+    0x9C, 0x15, 0xC9, 0xCB, 0x0D, 0x40, 0x40, 0x00, 0x45, 0xD1, 0x17, 0x41, 0x26, 0x11, 0x2D, 0xA0,
+    0x83, 0x69, 0x41, 0x07, 0x5A, 0x50, 0x8A, 0x0E, 0x94, 0xA2, 0x04, 0x3A, 0xA0, 0x03, 0x3A, 0x10,
+    0x16, 0x32, 0x3E, 0x71, 0x8D, 0xD5, 0x59, 0x9C, 0x83, 0x40, 0x6F, 0xAB, 0x81, 0xA4, 0x21, 0x55,
+    0x41, 0xB5, 0x13, 0x4A, 0x6E, 0xBE, 0x3B, 0x49, 0x13, 0x64, 0x9E, 0x12, 0x22, 0x4F, 0x0D, 0xC6,
+    0xB3, 0x81, 0xF5, 0x5C, 0x9D, 0x1B, 0xFF, 0xB2, 0x0B, 0xB1, 0x16, 0x4C, 0x4D, 0xAE, 0x73, 0x95,
+    0x9E, 0x5E, 0x1F, 0x6E, 0xDA, 0x26, 0x3D, 0x78, 0x9C, 0xFB, 0x3B, 0x9F, 0x81, 0xE1, 0xE7, 0xF9,
+    0x6F, 0xEF, 0x19, 0x18, 0xFE, 0xE6, 0x7F, 0xFC, 0xCF, 0xAC, 0xF0, 0x5F, 0x7E, 0xC1, 0x7F, 0x8E,
+    0x82, 0xFF, 0x5C, 0x0E, 0xFF, 0x79, 0x0F, 0xFC, 0x67, 0x65, 0xF8, 0xA7, 0xFF, 0x11, 0x28, 0xF5,
+    0xA3, 0xFE, 0x1B, 0x50, 0xD9, 0xA7, 0xFD, 0xBF, 0xEC, 0x19, 0x18, 0x0E, 0xBC, 0xFF, 0xCB, 0xCB,
+    0xC0, 0x90, 0xF0, 0xFF, 0x3F, 0x07, 0x03, 0x03, 0xC3, 0xFF, 0xFF, 0x4C, 0x40, 0xF2, 0xD7, 0x79,
+    0x06, 0x10, 0x99, 0x0F, 0x24, 0x0C, 0xFE, 0xCB, 0x33, 0x30, 0x34, 0xFD, 0x04, 0x49, 0x7E, 0xF9,
+    0x0F, 0x12, 0x7E, 0x7C, 0x9F, 0x1D, 0x48, 0x02, 0x00, 0xE4, 0x18, 0x2B, 0xC6, 0x78, 0x9C, 0xFB,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xFA, 0x4F, 0x20, 0x22, 0x21, 0x6D, 0xDA, 0x7F, 0x7D, 0x06, 0x86, 0x0B,
+    0xFF, 0xD9, 0x18, 0x18, 0x7E, 0xEE, 0x67, 0x60, 0x70, 0xF8, 0x2F, 0xCF, 0xC0, 0xF0, 0x00, 0xC1,
+    0x93, 0x63, 0x60, 0x78, 0xF8, 0x3F, 0x2B, 0xCD, 0xEC, 0x1B, 0x50, 0xF1, 0xFA, 0xEF, 0x20, 0x02,
+    0x00, 0xF7, 0x40, 0x21, 0x77, 0x78, 0x9C, 0x63, 0x10, 0xB8, 0x99, 0xCF, 0xB0, 0xE1, 0x7F, 0x3D,
+    0xC3, 0x87, 0xFF, 0xEA, 0x0C, 0x1F, 0xF7, 0x33, 0x30, 0x7C, 0x5C, 0x0F, 0xC1, 0x9F, 0xD6, 0x33,
+    0x24, 0xFF, 0xAD, 0x67, 0xF8, 0x7D, 0x9F, 0x83, 0xE1, 0xF7, 0x7B, 0x0E, 0x86, 0x24, 0x20, 0x9B,
+    0xE1, 0xF3, 0x7A, 0x84, 0x3C, 0x48, 0xED, 0x87, 0xFF, 0x1A, 0x60, 0xBD, 0x40, 0x33, 0x00, 0x8F,
+    0x98, 0x1F, 0xEE, 0x78, 0x9C, 0xFB, 0xCA, 0xF7, 0x95, 0x48, 0x08, 0x00, 0xD2, 0x7D, 0x15, 0x40,
+    0x78, 0x9C, 0xFB, 0xB4, 0x8F, 0x99, 0xE1, 0xD3, 0x7F, 0x79, 0x86, 0x84, 0xBF, 0xFE, 0x0C, 0x0C,
+    0xDF, 0xE2, 0x11, 0xF8, 0x6B, 0x3E, 0x03, 0xC3, 0xA7, 0xF7, 0xEE, 0x0C, 0x01, 0x7F, 0xFE, 0x03,
+    0x25, 0xFF, 0x33, 0x7C, 0x7E, 0x6F, 0xCE, 0xF0, 0xB5, 0x1E, 0x45, 0x4D, 0xC2, 0x3F, 0x7F, 0xB0,
+    0xDE, 0x4F, 0x40, 0x33, 0x00, 0x64, 0x62, 0x1E, 0x9E, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x01, 0x85,
+    0x3F, 0xB5, 0x0C, 0x0C, 0xA2, 0x0F, 0xFE, 0xFF, 0xEF, 0x6F, 0x91, 0xFF, 0xE8, 0xF1, 0xE3, 0xFF,
+    0x7F, 0xBE, 0x40, 0x06, 0x81, 0x1B, 0xE7, 0x99, 0xC0, 0x92, 0x0C, 0x00, 0xDF, 0xB1, 0x0C, 0x06,
+    0x78, 0x9C, 0x63, 0xB8, 0x7A, 0x9F, 0x95, 0x21, 0xE1, 0xFF, 0xFF, 0x78, 0x86, 0x07, 0xF1, 0x09,
+    0xF7, 0x19, 0x3E, 0xF0, 0x33, 0xFC, 0x87, 0xB0, 0x80, 0x62, 0xF9, 0x0C, 0x0C, 0x20, 0x59, 0x00,
+    0x26, 0x9E, 0x0F, 0xF7, 0x78, 0x9C, 0x63, 0x78, 0xFC, 0x9F, 0x95, 0x81, 0x81, 0x41, 0xE0, 0x8F,
+    0x3D, 0x90, 0x64, 0x28, 0xF8, 0xCF, 0xC4, 0x00, 0x05, 0x93, 0xFF, 0xBE, 0xB7, 0x62, 0x60, 0xF8,
+    0xFB, 0xFF, 0xFF, 0x7F, 0x16, 0x86, 0xA7, 0x99, 0x47, 0xFF, 0xF3, 0x02, 0xC5, 0x14, 0xFE, 0xF3,
+    0x83, 0xA4, 0xFE, 0xCB, 0x33, 0x4C, 0x7E, 0xF3, 0xFF, 0xBF, 0x7C, 0xC2, 0xFF, 0xFF, 0xF7, 0xFE,
+    0xCB, 0x7F, 0xF8, 0x2F, 0x09, 0x14, 0xF9, 0xF8, 0x9F, 0xC9, 0x00, 0xC4, 0xF6, 0x7A, 0xFE, 0x5F,
+    0x7E, 0xC2, 0xFF, 0xFF, 0xF7, 0x7F, 0xCB, 0x33, 0xDC, 0x78, 0x2F, 0xF9, 0x45, 0x1E, 0x00, 0xB0,
+    0x0E, 0x2A, 0xDA, 0x78, 0x9C, 0x63, 0x60, 0x60, 0xF8, 0xF6, 0x9E, 0x99, 0x81, 0xC1, 0xE1, 0xBF,
+    0x34, 0x03, 0x03, 0xC3, 0xE7, 0x7A, 0x06, 0x18, 0x70, 0x78, 0xFD, 0x5E, 0x93, 0x81, 0xE1, 0xFB,
+    0xFF, 0xFF, 0xEF, 0x99, 0x0D, 0xFE, 0xD7, 0x4F, 0xF9, 0xCF, 0xBB, 0xE0, 0x3F, 0x07, 0xC3, 0x1F,
+    0xFB, 0x07, 0xFF, 0x59, 0x18, 0xBE, 0xE7, 0x7F, 0xF8, 0x0F, 0x04, 0xF5, 0x60, 0xB2, 0xFF, 0xC1,
+    0x7F, 0x11, 0x41, 0x41, 0xC6, 0x05, 0xFF, 0x39, 0x81, 0x9A, 0x0C, 0xFE, 0xAF, 0x4F, 0xDB, 0xCE,
+    0xCB, 0xF0, 0x0D, 0x28, 0xCE, 0xCB, 0x60, 0xF0, 0xEA, 0xFF, 0x3A, 0x16, 0x00, 0x6E, 0x57, 0x2C,
+    0xCF,
+};
+const GFXglyph OpenSans10BGlyphs[] = {
+    { 0, 0, 5, 0, 0, 8, 0 }, //  
+    { 4, 15, 6, 1, 15, 41, 8 }, // !
+    { 8, 5, 10, 1, 15, 29, 49 }, // "
+    { 14, 15, 14, 0, 15, 91, 78 }, // #
+    { 12, 17, 12, 0, 16, 91, 169 }, // $
+    { 19, 15, 19, 0, 15, 144, 260 }, // %
+    { 16, 15, 16, 0, 15, 120, 404 }, // &
+    { 4, 5, 6, 1, 15, 18, 524 }, // '
+    { 7, 18, 7, 0, 15, 62, 542 }, // (
+    { 7, 18, 7, 0, 15, 65, 604 }, // )
+    { 11, 11, 11, 0, 16, 69, 669 }, // *
+    { 12, 11, 12, 0, 13, 36, 738 }, // +
+    { 5, 5, 6, 0, 2, 24, 774 }, // ,
+    { 7, 3, 7, 0, 7, 19, 798 }, // -
+    { 4, 4, 6, 1, 4, 16, 817 }, // .
+    { 9, 15, 9, 0, 15, 76, 833 }, // /
+    { 12, 15, 12, 0, 15, 84, 909 }, // 0
+    { 8, 15, 12, 1, 15, 40, 993 }, // 1
+    { 12, 15, 12, 0, 15, 80, 1033 }, // 2
+    { 12, 15, 12, 0, 15, 96, 1113 }, // 3
+    { 12, 15, 12, 0, 15, 72, 1209 }, // 4
+    { 11, 15, 12, 1, 15, 79, 1281 }, // 5
+    { 12, 15, 12, 0, 15, 101, 1360 }, // 6
+    { 12, 15, 12, 0, 15, 80, 1461 }, // 7
+    { 12, 15, 12, 0, 15, 101, 1541 }, // 8
+    { 12, 15, 12, 0, 15, 101, 1642 }, // 9
+    { 4, 12, 6, 1, 12, 27, 1743 }, // :
+    { 5, 15, 6, 0, 12, 38, 1770 }, // ;
+    { 12, 12, 12, 0, 14, 59, 1808 }, // <
+    { 12, 6, 12, 0, 11, 24, 1867 }, // =
+    { 12, 12, 12, 0, 14, 59, 1891 }, // >
+    { 10, 15, 10, 0, 15, 74, 1950 }, // ?
+    { 17, 17, 19, 1, 15, 152, 2024 }, // @
+    { 15, 15, 14, 0, 15, 106, 2176 }, // A
+    { 12, 15, 14, 1, 15, 80, 2282 }, // B
+    { 12, 15, 13, 1, 15, 85, 2362 }, // C
+    { 14, 15, 16, 1, 15, 81, 2447 }, // D
+    { 10, 15, 12, 1, 15, 43, 2528 }, // E
+    { 10, 15, 12, 1, 15, 38, 2571 }, // F
+    { 13, 15, 15, 1, 15, 102, 2609 }, // G
+    { 14, 15, 16, 1, 15, 29, 2711 }, // H
+    { 5, 15, 7, 1, 15, 14, 2740 }, // I
+    { 8, 19, 7, -2, 15, 35, 2754 }, // J
+    { 13, 15, 14, 1, 15, 85, 2789 }, // K
+    { 11, 15, 12, 1, 15, 28, 2874 }, // L
+    { 17, 15, 20, 1, 15, 111, 2902 }, // M
+    { 15, 15, 17, 1, 15, 77, 3013 }, // N
+    { 15, 15, 17, 1, 15, 103, 3090 }, // O
+    { 12, 15, 13, 1, 15, 66, 3193 }, // P
+    { 15, 18, 17, 1, 15, 120, 3259 }, // Q
+    { 13, 15, 14, 1, 15, 81, 3379 }, // R
+    { 11, 15, 12, 0, 15, 95, 3460 }, // S
+    { 12, 15, 12, 0, 15, 30, 3555 }, // T
+    { 14, 15, 16, 1, 15, 59, 3585 }, // U
+    { 14, 15, 14, 0, 15, 107, 3644 }, // V
+    { 21, 15, 20, 0, 15, 145, 3751 }, // W
+    { 14, 15, 14, 0, 15, 103, 3896 }, // X
+    { 14, 15, 13, 0, 15, 72, 3999 }, // Y
+    { 12, 15, 12, 0, 15, 78, 4071 }, // Z
+    { 6, 18, 7, 1, 15, 24, 4149 }, // [
+    { 9, 15, 9, 0, 15, 70, 4173 }, // <backslash>
+    { 6, 18, 7, 0, 15, 26, 4243 }, // ]
+    { 12, 10, 11, 0, 15, 65, 4269 }, // ^
+    { 10, 2, 9, -1, -1, 18, 4334 }, // _
+    { 7, 3, 13, 3, 16, 20, 4352 }, // `
+    { 12, 12, 13, 0, 12, 79, 4372 }, // a
+    { 12, 16, 13, 1, 16, 72, 4451 }, // b
+    { 11, 12, 11, 0, 12, 68, 4523 }, // c
+    { 12, 16, 13, 0, 16, 77, 4591 }, // d
+    { 12, 12, 12, 0, 12, 77, 4668 }, // e
+    { 10, 16, 8, 0, 16, 46, 4745 }, // f
+    { 12, 17, 12, 0, 12, 103, 4791 }, // g
+    { 12, 16, 14, 1, 16, 50, 4894 }, // h
+    { 4, 16, 6, 1, 16, 20, 4944 }, // i
+    { 7, 21, 6, -2, 16, 44, 4964 }, // j
+    { 13, 16, 13, 1, 16, 75, 5008 }, // k
+    { 4, 16, 6, 1, 16, 13, 5083 }, // l
+    { 19, 12, 21, 1, 12, 70, 5096 }, // m
+    { 12, 12, 14, 1, 12, 47, 5166 }, // n
+    { 13, 12, 13, 0, 12, 79, 5213 }, // o
+    { 12, 17, 13, 1, 12, 78, 5292 }, // p
+    { 12, 17, 13, 0, 12, 74, 5370 }, // q
+    { 9, 12, 10, 1, 12, 38, 5444 }, // r
+    { 10, 12, 10, 0, 12, 69, 5482 }, // s
+    { 9, 15, 9, 0, 15, 57, 5551 }, // t
+    { 12, 12, 14, 1, 12, 48, 5608 }, // u
+    { 12, 12, 12, 0, 12, 83, 5656 }, // v
+    { 18, 12, 18, 0, 12, 116, 5739 }, // w
+    { 13, 12, 12, 0, 12, 88, 5855 }, // x
+    { 12, 17, 12, 0, 12, 102, 5943 }, // y
+    { 10, 12, 10, 0, 12, 56, 6045 }, // z
+    { 8, 18, 8, 0, 15, 62, 6101 }, // {
+    { 3, 21, 12, 4, 16, 13, 6163 }, // |
+    { 8, 18, 8, 0, 15, 57, 6176 }, // }
+    { 12, 6, 12, 0, 10, 39, 6233 }, // ~
+    { 9, 7, 9, 0, 15, 36, 6272 }, // °
+    { 12, 16, 13, 0, 16, 95, 6308 }, // à
+    { 12, 16, 12, 0, 16, 94, 6403 }, // é
+};
+constexpr UnicodeInterval OpenSans10BIntervals[] = {
+    { 0x20, 0x7E, 0x0 },
+    { 0xB0, 0xB0, 0x5F },
+    { 0xE0, 0xE0, 0x60 },
+    { 0xE9, 0xE9, 0x61 },
+};
+const GFXfont OpenSans10B = {
+    (uint8_t*)OpenSans10BBitmaps,
+    (GFXglyph*)OpenSans10BGlyphs,
+    (UnicodeInterval*)OpenSans10BIntervals,
+    4,
+    1,
+    28,
+    23,
+    -7,
+};
@@ -1,1226 +1,1227 @@
-#pragma once
-#include "epd_driver.h"
-const uint8_t OpenSans12BBitmaps[16231] = {
-    0x78, 0x9C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 0x9C, 0xFB, 0xFE, 0x9F, 0xEB, 0xFB, 0x7F,
-    0xCE, 0x6F, 0xFF, 0x39, 0xBF, 0xFE, 0xE7, 0xF8, 0xF2, 0x9F, 0xFD, 0xF3, 0x7F, 0xB6, 0x4F, 0xFF,
-    0x59, 0x3F, 0xFE, 0x67, 0x01, 0xA2, 0x0F, 0xFF, 0x99, 0x3F, 0xFC, 0x67, 0x5A, 0x70, 0x86, 0x91,
-    0x01, 0x08, 0x18, 0x19, 0x1E, 0xBD, 0x67, 0xFE, 0x01, 0x56, 0xBC, 0xF1, 0x3C, 0x13, 0x00, 0x95,
-    0xED, 0x1E, 0x71, 0x78, 0x9C, 0x01, 0x1E, 0x00, 0xE1, 0xFF, 0xF5, 0xFF, 0x20, 0xFF, 0x2F, 0xF4,
-    0xEF, 0x10, 0xFF, 0x0F, 0xF2, 0xDF, 0x00, 0xFF, 0x0F, 0xF1, 0xBF, 0x00, 0xFE, 0x0E, 0xF0, 0xAF,
-    0x00, 0xFD, 0x0C, 0xE0, 0x9F, 0x00, 0xFC, 0x0B, 0x1D, 0xC2, 0x11, 0x0D, 0x78, 0x9C, 0x63, 0x60,
-    0x30, 0xF8, 0xCF, 0xFE, 0xB1, 0x9F, 0x81, 0x81, 0x21, 0xE1, 0x3F, 0xCB, 0x97, 0x78, 0x20, 0x3D,
-    0xE1, 0x3F, 0xE3, 0x77, 0x7D, 0x20, 0x7D, 0xE0, 0x3D, 0xC3, 0x2F, 0x7E, 0x20, 0xFD, 0x61, 0x3F,
-    0xC3, 0x5F, 0x1E, 0xA0, 0x28, 0x18, 0xCC, 0x87, 0xD1, 0x01, 0x33, 0xFF, 0xCC, 0x3F, 0xF9, 0x7F,
-    0x66, 0x24, 0x03, 0xC3, 0x6F, 0xBE, 0x05, 0xFF, 0x81, 0xCA, 0x18, 0xFE, 0x73, 0x3F, 0xD8, 0xCF,
-    0xC0, 0xF0, 0x1D, 0x22, 0xCF, 0x03, 0xA3, 0x9B, 0x4F, 0xFC, 0xEF, 0xF8, 0x33, 0xBF, 0x83, 0x8D,
-    0x61, 0xC3, 0x7F, 0x86, 0xDF, 0x20, 0xE3, 0x1E, 0x9C, 0x67, 0xF8, 0xC7, 0x03, 0x32, 0x76, 0x3E,
-    0xC3, 0x7F, 0x2E, 0x20, 0xFD, 0x39, 0x1F, 0xE8, 0x00, 0x20, 0xFD, 0xD5, 0x1F, 0xE8, 0x00, 0x06,
-    0x06, 0x00, 0x54, 0xCE, 0x46, 0xB2, 0x78, 0x9C, 0x63, 0x60, 0x58, 0xC0, 0xCF, 0x00, 0x02, 0x10,
-    0x6A, 0xF2, 0xDF, 0xF7, 0x6B, 0xC4, 0x18, 0x1A, 0xFE, 0x03, 0xC1, 0x7D, 0x86, 0x6F, 0x20, 0xAA,
-    0x9E, 0xE1, 0xCF, 0xFF, 0xAD, 0xF2, 0x2D, 0xB2, 0x0C, 0xFF, 0xEE, 0x83, 0x95, 0xFC, 0xFE, 0xBF,
-    0x03, 0x44, 0x7D, 0xF9, 0xFF, 0xDF, 0x1E, 0x48, 0x25, 0x00, 0x55, 0xC4, 0x00, 0xE9, 0x45, 0x40,
-    0x5A, 0x1A, 0x48, 0x1F, 0xFC, 0xFF, 0xFF, 0x3C, 0xC8, 0x30, 0xFF, 0x7F, 0xFF, 0x99, 0x18, 0x81,
-    0x66, 0x7E, 0xFB, 0xCF, 0xB2, 0x4F, 0x6D, 0x81, 0xFC, 0xEF, 0xFF, 0x4C, 0xFF, 0x40, 0x86, 0x9D,
-    0x67, 0x00, 0x53, 0x32, 0x0C, 0x89, 0xA7, 0xFE, 0xBD, 0x8F, 0x46, 0x58, 0x0B, 0xA1, 0x00, 0x7A,
-    0xF8, 0x3F, 0x41, 0x78, 0x9C, 0x35, 0x8E, 0x4D, 0x0E, 0xC1, 0x40, 0x00, 0x85, 0x9F, 0x14, 0x49,
-    0xAB, 0x88, 0x1B, 0xF4, 0x06, 0xBA, 0x27, 0x99, 0xAE, 0x6C, 0xB9, 0x81, 0x23, 0xB8, 0xC2, 0x24,
-    0xD6, 0xF4, 0x08, 0x7A, 0x83, 0x4E, 0xE2, 0x00, 0x2C, 0x2C, 0x2D, 0xDC, 0xA0, 0x47, 0xF0, 0x53,
-    0x1A, 0xA5, 0xE6, 0x99, 0x8A, 0xD9, 0xBD, 0xBC, 0x7C, 0xF9, 0xDE, 0xC3, 0x81, 0x23, 0x00, 0xCF,
-    0x05, 0x10, 0x91, 0x74, 0x10, 0xB0, 0x0B, 0xEC, 0x79, 0x64, 0x07, 0x09, 0x9B, 0xC0, 0x85, 0x03,
-    0xF6, 0x91, 0xEF, 0x0C, 0x74, 0x3B, 0x43, 0x0B, 0x54, 0xC2, 0xC4, 0x3C, 0xC3, 0x47, 0x44, 0xF4,
-    0x6C, 0x7B, 0x62, 0x03, 0x7F, 0xB6, 0x88, 0xA5, 0x5E, 0x41, 0x19, 0x83, 0xAF, 0x7B, 0x6F, 0xD2,
-    0x0B, 0x8D, 0x77, 0xC9, 0x09, 0x53, 0x0A, 0x6C, 0x39, 0xBE, 0x66, 0x92, 0x6E, 0x19, 0x1B, 0x1C,
-    0xE5, 0x3C, 0x61, 0xBB, 0xA8, 0xD5, 0x01, 0x7D, 0xC5, 0xD6, 0xA3, 0x8E, 0x8A, 0x8E, 0x6D, 0xEF,
-    0x29, 0x2C, 0x5B, 0x0D, 0x11, 0x72, 0xC3, 0x29, 0x30, 0xA3, 0x0B, 0xBC, 0x68, 0xFE, 0xE1, 0xB7,
-    0x2A, 0xF5, 0x1A, 0x5F, 0xB5, 0x91, 0x5B, 0xCC, 0x78, 0x9C, 0x1D, 0x8D, 0xC1, 0x09, 0xC2, 0x40,
-    0x14, 0x44, 0x87, 0x68, 0xC0, 0x08, 0x6A, 0x4A, 0x48, 0x09, 0xC1, 0x06, 0xAC, 0x40, 0xB6, 0x03,
-    0xB5, 0x10, 0x41, 0xB1, 0x81, 0x34, 0x20, 0x58, 0x4A, 0xEC, 0xC0, 0x1A, 0xA2, 0x07, 0xC1, 0x93,
-    0x07, 0x35, 0x87, 0x4D, 0xF6, 0xF9, 0x37, 0xEF, 0x32, 0x0F, 0xFE, 0x67, 0x46, 0xE5, 0x8B, 0xBD,
-    0x22, 0x2D, 0x30, 0xB3, 0x2C, 0x20, 0x50, 0x99, 0xEC, 0x70, 0x79, 0xA8, 0x07, 0x59, 0xA8, 0xBB,
-    0x98, 0x94, 0x1C, 0x8E, 0xB8, 0xF8, 0xEC, 0xE9, 0x99, 0x46, 0x69, 0x20, 0x5E, 0x94, 0x7B, 0x98,
-    0xE8, 0xCD, 0xFC, 0x6A, 0x35, 0x5B, 0x7D, 0xC9, 0x5A, 0xD6, 0x81, 0xD4, 0x93, 0xF4, 0x24, 0x77,
-    0x2A, 0x6A, 0x81, 0x8A, 0x00, 0x2B, 0x93, 0x44, 0x0F, 0xC8, 0xAC, 0x66, 0xB3, 0x7C, 0x42, 0xAA,
-    0x0F, 0x03, 0xCE, 0xB6, 0x8C, 0x1B, 0x8C, 0x75, 0xEA, 0x38, 0x8F, 0x7E, 0xB8, 0x3F, 0xB7, 0x76,
-    0x57, 0xD4, 0x78, 0x9C, 0xFB, 0xFA, 0x9F, 0xE1, 0xCB, 0x7B, 0x86, 0x4F, 0xF7, 0x19, 0x3E, 0xEE,
-    0x67, 0xF8, 0xB0, 0x9E, 0xE1, 0xC1, 0x7C, 0x06, 0x00, 0x6D, 0xE0, 0x0A, 0x77, 0x78, 0x9C, 0x25,
-    0x8C, 0xCB, 0x0D, 0x40, 0x40, 0x00, 0x44, 0x9F, 0x8B, 0x13, 0x35, 0x6D, 0x09, 0x4A, 0xA0, 0x03,
-    0x3A, 0x50, 0x0A, 0x1D, 0xD1, 0x01, 0x35, 0x10, 0x2B, 0xF1, 0x1B, 0x23, 0x0E, 0x93, 0xCC, 0x9F,
-    0x5E, 0x29, 0xDB, 0x00, 0x4F, 0xA0, 0x52, 0xCE, 0x68, 0xB9, 0x28, 0x21, 0x4E, 0x70, 0x74, 0x70,
-    0xB5, 0x8E, 0x4A, 0x50, 0xF1, 0xE3, 0xE3, 0x77, 0x0D, 0xA7, 0xB3, 0xDD, 0xB3, 0x55, 0x30, 0x7B,
-    0xD3, 0x28, 0x73, 0x21, 0x40, 0xB4, 0xE9, 0xCF, 0x17, 0x29, 0x86, 0x22, 0xDF, 0x78, 0x9C, 0x7B,
-    0xF0, 0x9F, 0x89, 0x21, 0xE0, 0x3F, 0x0F, 0x03, 0xC3, 0x9F, 0x7C, 0x06, 0x86, 0xAF, 0xF7, 0x19,
-    0x18, 0x1E, 0xFC, 0x67, 0x61, 0x98, 0xF0, 0x9F, 0x0B, 0x28, 0xC8, 0xC7, 0xA0, 0xF0, 0x5F, 0x9E,
-    0x81, 0xE1, 0xBF, 0x3F, 0x03, 0xC3, 0xBF, 0x78, 0x06, 0x86, 0xBF, 0xF9, 0x10, 0x0C, 0x62, 0x03,
-    0xC5, 0x04, 0xFE, 0xEB, 0x83, 0xD5, 0x80, 0xD4, 0x3E, 0xF8, 0xCF, 0xCA, 0xF0, 0xF5, 0x3D, 0xD0,
-    0x8C, 0x7A, 0xA0, 0x10, 0x2F, 0x90, 0xCB, 0xC4, 0x00, 0x00, 0xC9, 0xE0, 0x21, 0x75, 0x78, 0x9C,
-    0x63, 0x60, 0xD8, 0xF0, 0x9F, 0x95, 0x01, 0x08, 0x16, 0xFC, 0x67, 0x06, 0x51, 0x0D, 0xFF, 0x99,
-    0x18, 0x18, 0x12, 0x58, 0x12, 0xFE, 0x33, 0x04, 0xB2, 0x3C, 0xF8, 0xBF, 0xFA, 0xFF, 0x8D, 0xFF,
-    0x9C, 0x1F, 0xFF, 0x83, 0x00, 0x77, 0xE1, 0x8C, 0xDF, 0xFF, 0xD7, 0x77, 0xB2, 0x31, 0x30, 0xFC,
-    0xFA, 0xEF, 0x0F, 0x54, 0x98, 0xF0, 0xFF, 0xE7, 0x7B, 0x46, 0x06, 0x86, 0x4F, 0xFF, 0x9B, 0xFE,
-    0x73, 0x33, 0x30, 0x7C, 0xDF, 0x2F, 0xF0, 0x5F, 0x8F, 0x81, 0x41, 0xC1, 0x9B, 0x61, 0x26, 0x23,
-    0x03, 0x14, 0x00, 0x00, 0xC2, 0x2E, 0x23, 0x96, 0x78, 0x9C, 0x63, 0x60, 0x38, 0x14, 0xC3, 0x00,
-    0x02, 0x9F, 0xEB, 0x71, 0x51, 0xFF, 0xFE, 0x83, 0x00, 0x33, 0x94, 0x5A, 0xB9, 0xEA, 0xF7, 0xFD,
-    0x55, 0xAB, 0x98, 0xF0, 0x69, 0x60, 0x60, 0x48, 0x54, 0x03, 0x12, 0x00, 0x8A, 0x3E, 0x1D, 0xB1,
-    0x78, 0x9C, 0x13, 0xF8, 0x5F, 0xEF, 0xF0, 0xDF, 0xBE, 0xE0, 0x3F, 0xDF, 0x82, 0xFF, 0x1C, 0x0F,
-    0xFE, 0x33, 0x7E, 0x5C, 0xCF, 0x00, 0x00, 0x5B, 0xF7, 0x09, 0xB1, 0x78, 0x9C, 0xFB, 0xF2, 0xFF,
-    0xBF, 0xFF, 0x17, 0x28, 0x16, 0x10, 0x14, 0x64, 0x04, 0x00, 0x6A, 0x0C, 0x09, 0xF7, 0x78, 0x9C,
-    0x63, 0x60, 0x64, 0x78, 0xF4, 0x9E, 0xF9, 0xC7, 0x7F, 0xAE, 0xEF, 0xFF, 0x39, 0x37, 0x9E, 0x67,
-    0x02, 0x00, 0x34, 0xAA, 0x07, 0x58, 0x78, 0x9C, 0x15, 0xCA, 0xCB, 0x0D, 0x40, 0x50, 0x00, 0x44,
-    0xD1, 0x47, 0x22, 0x24, 0x42, 0x74, 0x40, 0x27, 0x4A, 0xA0, 0x13, 0x4A, 0xD0, 0x89, 0x12, 0xE8,
-    0x40, 0x09, 0x94, 0xA0, 0x03, 0x11, 0x9F, 0xC4, 0x27, 0xC6, 0x7D, 0xB3, 0x38, 0x9B, 0xB9, 0xC6,
-    0x98, 0x43, 0x86, 0x3D, 0x1D, 0x24, 0x2A, 0xB0, 0x56, 0x8C, 0x93, 0x02, 0xDC, 0xE4, 0xE2, 0x35,
-    0xDA, 0xE4, 0xAB, 0xA0, 0x54, 0x8A, 0xBD, 0x42, 0x5C, 0xE5, 0xE1, 0xB9, 0xD8, 0xF3, 0x6D, 0x21,
-    0x53, 0x8E, 0x8D, 0x22, 0x9C, 0xE5, 0xE3, 0x2E, 0x07, 0xEF, 0xC1, 0x26, 0x3F, 0x8B, 0x1B, 0x1E,
-    0x94, 0x78, 0x9C, 0x63, 0x60, 0x38, 0xFE, 0xBF, 0x97, 0x91, 0x81, 0xE1, 0xE2, 0xFF, 0xFF, 0xFF,
-    0xF5, 0x18, 0x18, 0x7E, 0x03, 0xA9, 0xFB, 0x0C, 0x06, 0xFF, 0xEF, 0x0B, 0xFD, 0xFA, 0xCF, 0x36,
-    0xE1, 0xBF, 0x3D, 0xC3, 0x83, 0xFF, 0x3C, 0x07, 0xFE, 0xF3, 0x31, 0x2C, 0xF8, 0xCF, 0xFF, 0xE1,
-    0x3F, 0x0F, 0x43, 0xC3, 0x7F, 0xFB, 0x0F, 0xFF, 0xB9, 0x19, 0x12, 0xFE, 0xFB, 0x7F, 0xFC, 0xCF,
-    0x05, 0xA4, 0xE2, 0xA1, 0x14, 0x54, 0xF0, 0x01, 0x44, 0x09, 0x44, 0x83, 0x7C, 0x03, 0x58, 0x3B,
-    0xAF, 0x02, 0xD8, 0x30, 0x0E, 0x86, 0x5F, 0x40, 0xA3, 0xDF, 0x33, 0x32, 0x1C, 0x00, 0x52, 0xF6,
-    0x0C, 0x0C, 0x0C, 0xC7, 0xFE, 0xCF, 0x65, 0x64, 0x00, 0x00, 0xB7, 0xEA, 0x43, 0x29, 0x78, 0x9C,
-    0x63, 0x60, 0x48, 0xF8, 0x1F, 0xCF, 0xC0, 0xF0, 0x13, 0x48, 0x1C, 0xFC, 0xFF, 0x3F, 0xDE, 0xE0,
-    0x1F, 0x90, 0xF8, 0xFC, 0xBF, 0xEF, 0x7F, 0xFC, 0x81, 0xFB, 0x49, 0xFF, 0xE3, 0x05, 0x38, 0xC1,
-    0xB2, 0x60, 0xA2, 0x80, 0x44, 0x02, 0x00, 0xA8, 0xE8, 0x27, 0x9D, 0x78, 0x9C, 0x63, 0x50, 0x38,
-    0xF1, 0x6F, 0x1D, 0x33, 0x03, 0xC3, 0xCF, 0xFF, 0xFF, 0xFF, 0xF7, 0x33, 0x1C, 0xF8, 0x0F, 0x02,
-    0xAC, 0x0E, 0xFF, 0xEB, 0x8C, 0x7F, 0xFD, 0xE7, 0x61, 0x98, 0xC6, 0xC0, 0xF0, 0xE0, 0x3F, 0x1F,
-    0x03, 0x10, 0x1C, 0x80, 0x50, 0x1F, 0xFE, 0x73, 0x83, 0xA8, 0x1F, 0xFF, 0x59, 0x81, 0xA4, 0xC3,
-    0xFF, 0xF3, 0x20, 0xCE, 0xE7, 0xFF, 0x72, 0x40, 0xD2, 0xE0, 0xDF, 0x7B, 0x26, 0x20, 0xF5, 0xF8,
-    0xBF, 0x1E, 0x98, 0x73, 0x1F, 0xC2, 0x91, 0x85, 0xC8, 0x28, 0x2B, 0x29, 0x09, 0x3D, 0x00, 0x1B,
-    0x5D, 0xFF, 0x01, 0x85, 0x02, 0x00, 0x8A, 0x09, 0x3B, 0x37, 0x78, 0x9C, 0x63, 0x28, 0x7C, 0xFD,
-    0x7F, 0x2D, 0x0B, 0x43, 0xC3, 0x7F, 0x20, 0x58, 0x0F, 0xA1, 0xFE, 0xB3, 0x31, 0xDC, 0x55, 0x57,
-    0xFC, 0xF5, 0x9F, 0x9B, 0x81, 0x91, 0x81, 0xE1, 0x03, 0x90, 0x02, 0x82, 0x8F, 0xFF, 0xD9, 0x81,
-    0xA4, 0xE3, 0x9F, 0xFB, 0x0C, 0x0C, 0x0E, 0x40, 0x15, 0x9C, 0x60, 0x6A, 0x3D, 0x2B, 0x90, 0x7A,
-    0xF7, 0xFF, 0xFF, 0x7D, 0x26, 0xA0, 0x9C, 0xC2, 0xCF, 0xFF, 0xBC, 0x20, 0x95, 0x07, 0xFE, 0xDB,
-    0x83, 0xA8, 0x0D, 0xFF, 0xFD, 0x41, 0xD4, 0x83, 0xFF, 0xF6, 0x0F, 0x3C, 0x19, 0x0D, 0x7F, 0xFF,
-    0xE7, 0xFB, 0x00, 0x31, 0x1A, 0x4C, 0xD5, 0x33, 0x18, 0x1C, 0xFF, 0xFB, 0xBE, 0x87, 0x89, 0x01,
-    0x00, 0x85, 0xEF, 0x3B, 0xA4, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x50, 0xF8, 0xBF, 0x9F, 0x01, 0x08,
-    0x0E, 0x40, 0xA8, 0xEF, 0x60, 0xCA, 0xE0, 0x3F, 0x98, 0xBA, 0xF0, 0xFE, 0x1F, 0x88, 0xFA, 0x91,
-    0xFF, 0x17, 0x48, 0x39, 0xFC, 0xE7, 0x01, 0xF1, 0x1E, 0xFC, 0x67, 0x02, 0xC9, 0xFD, 0xAA, 0x67,
-    0x00, 0x52, 0x01, 0xFF, 0x79, 0x40, 0xD4, 0xC3, 0xFF, 0x4C, 0x20, 0xEA, 0xC7, 0x7F, 0x10, 0x78,
-    0xFF, 0x13, 0x42, 0x41, 0x78, 0xF7, 0x41, 0x86, 0x42, 0x8C, 0xC6, 0xA4, 0x00, 0x7F, 0x74, 0x3C,
-    0xC4, 0x78, 0x9C, 0x3B, 0xF0, 0x1F, 0x08, 0xF8, 0x18, 0x2E, 0x40, 0xA8, 0x0F, 0x30, 0xCA, 0xD2,
-    0xD8, 0x98, 0x89, 0xE1, 0xE3, 0x7F, 0x36, 0x06, 0x20, 0xF8, 0xF4, 0x9F, 0x05, 0x44, 0x7D, 0xF9,
-    0xFF, 0xF7, 0xBD, 0x37, 0x03, 0xC3, 0x57, 0x90, 0x12, 0x0E, 0x08, 0x15, 0xCF, 0xA0, 0xA0, 0xAA,
-    0x78, 0xF5, 0xFF, 0x79, 0x90, 0xB4, 0xC0, 0xFF, 0xFF, 0x20, 0x8A, 0xE1, 0xF7, 0x7F, 0x46, 0x10,
-    0xF5, 0xE7, 0x3F, 0x23, 0x23, 0x48, 0xF0, 0x3D, 0xC3, 0x1E, 0x33, 0xA0, 0x92, 0xF9, 0x40, 0x01,
-    0x20, 0x90, 0x03, 0x53, 0xF7, 0x99, 0x18, 0x9A, 0xDE, 0xFC, 0xDF, 0x07, 0x34, 0x1C, 0x00, 0x5D,
-    0x0A, 0x3F, 0x41, 0x78, 0x9C, 0x63, 0x60, 0x50, 0x38, 0xF1, 0xEF, 0x3D, 0x13, 0x03, 0xC3, 0xCF,
-    0xFF, 0xFF, 0xFF, 0x33, 0x33, 0x1C, 0xF8, 0x0F, 0xA6, 0x7E, 0xFC, 0xF7, 0x66, 0x14, 0x60, 0x10,
-    0xF8, 0x5F, 0xCF, 0x00, 0x04, 0x05, 0xFF, 0x79, 0x41, 0xD4, 0x86, 0xFF, 0x12, 0xAF, 0xDE, 0x4B,
-    0x32, 0x3C, 0xF8, 0xFF, 0xE2, 0xFF, 0xFF, 0xF7, 0x4C, 0x1F, 0x40, 0x0A, 0xFF, 0xF3, 0x7C, 0xFC,
-    0xBF, 0x9E, 0xF1, 0xD1, 0x7F, 0xFD, 0x8F, 0x40, 0x25, 0x09, 0xFF, 0xF3, 0x3F, 0xFC, 0xE7, 0x62,
-    0x30, 0xF8, 0x5F, 0xFF, 0xE0, 0x3F, 0x0F, 0x83, 0xC3, 0xFF, 0xFC, 0x05, 0xFF, 0xF5, 0x19, 0x1A,
-    0xFE, 0xFB, 0x3B, 0xFC, 0xBF, 0x2F, 0xFC, 0xF5, 0x3F, 0x3F, 0xC3, 0x2F, 0x90, 0x06, 0x76, 0xA0,
-    0x31, 0xFF, 0xFF, 0xCF, 0x07, 0x1A, 0xB7, 0xF5, 0xDF, 0x3E, 0x16, 0x06, 0x00, 0x30, 0x95, 0x43,
-    0x9C, 0x78, 0x9C, 0xFB, 0xFA, 0x1F, 0x04, 0xEA, 0xBF, 0x22, 0x53, 0xF9, 0x0A, 0x4A, 0x4A, 0x4A,
-    0x87, 0xFE, 0xF3, 0x33, 0x00, 0xC1, 0xA7, 0xFF, 0x1C, 0x20, 0xEA, 0xE7, 0x7F, 0x26, 0x20, 0x29,
-    0xF0, 0x7F, 0x3F, 0x88, 0x53, 0xF0, 0xDF, 0x1F, 0x44, 0x3D, 0xF8, 0xCF, 0x0B, 0xA2, 0xBE, 0xFD,
-    0x67, 0x03, 0x51, 0x7F, 0xDF, 0x83, 0x48, 0x87, 0xFF, 0xFD, 0x20, 0xEA, 0xC0, 0x7F, 0x79, 0x10,
-    0xF5, 0xF9, 0x3F, 0x17, 0x88, 0xFA, 0xF5, 0x9F, 0x19, 0xAC, 0xF9, 0x3C, 0x88, 0xD3, 0xF0, 0x3F,
-    0x1E, 0x44, 0x7D, 0xF8, 0xCF, 0x07, 0x24, 0x01, 0xC9, 0xC5, 0x30, 0x43, 0x78, 0x9C, 0x1D, 0x8B,
-    0xBD, 0x0D, 0x82, 0x60, 0x00, 0x05, 0x9F, 0x44, 0xD4, 0x88, 0x3F, 0x2B, 0x7C, 0x13, 0x50, 0xD2,
-    0xCA, 0x04, 0xE2, 0x06, 0x8C, 0xA0, 0x95, 0xB5, 0x23, 0x38, 0x89, 0x32, 0x81, 0x71, 0x01, 0x42,
-    0xA2, 0x15, 0x24, 0x14, 0xB8, 0x00, 0x10, 0x43, 0x45, 0xF0, 0xFC, 0xB4, 0x7C, 0x77, 0xF7, 0x64,
-    0x72, 0x2E, 0x63, 0xA9, 0x03, 0xAE, 0x32, 0x50, 0xC2, 0xE4, 0xC0, 0x5E, 0x6F, 0x16, 0x27, 0xD6,
-    0xBA, 0xB3, 0xDC, 0x11, 0xA9, 0x62, 0xAE, 0x0F, 0xC1, 0x80, 0xA3, 0x97, 0x2D, 0xB7, 0xFA, 0xA5,
-    0xB5, 0x23, 0x3D, 0xFF, 0xCB, 0x50, 0x1F, 0xC1, 0x4D, 0xF0, 0xF5, 0x60, 0xD5, 0x30, 0x53, 0x48,
-    0xD4, 0x32, 0xB5, 0x22, 0x6E, 0x2C, 0x4C, 0xD8, 0x9C, 0x21, 0x05, 0x4F, 0xBD, 0x3D, 0x64, 0x23,
-    0x85, 0x05, 0x37, 0x57, 0x5F, 0x75, 0xD0, 0x46, 0xE4, 0x78, 0x9C, 0x1D, 0x8C, 0xCD, 0x0D, 0x01,
-    0x51, 0x00, 0x06, 0x87, 0x10, 0x1B, 0x84, 0x16, 0x28, 0xC0, 0x4F, 0x07, 0x2E, 0xEE, 0x5B, 0xC2,
-    0x2A, 0x40, 0x62, 0x3B, 0x20, 0x51, 0x00, 0x0D, 0x48, 0x74, 0xF4, 0x5C, 0xDD, 0x74, 0xB0, 0xAC,
-    0x88, 0x44, 0x6C, 0xC6, 0x3E, 0x97, 0x6F, 0x2E, 0x33, 0x1F, 0xA3, 0x6B, 0xB1, 0x06, 0x5E, 0xEA,
-    0x84, 0x79, 0xBD, 0x16, 0x9C, 0x3D, 0x8C, 0x3F, 0x26, 0x77, 0xFB, 0x5C, 0x1C, 0x94, 0x26, 0xEC,
-    0x9C, 0x95, 0x76, 0x58, 0x99, 0x3E, 0xEC, 0x72, 0x74, 0x73, 0x33, 0xE3, 0x6D, 0x96, 0xC7, 0xC0,
-    0x94, 0xAF, 0x6E, 0x5D, 0x90, 0x57, 0x61, 0xE9, 0xB0, 0xBE, 0xAB, 0x95, 0x5E, 0xC4, 0xD3, 0x36,
-    0x0D, 0xF6, 0x06, 0x88, 0xE2, 0xF4, 0x8F, 0xD0, 0x84, 0xAA, 0x38, 0xB5, 0xE0, 0x07, 0x45, 0x49,
-    0x41, 0xF6, 0x78, 0x9C, 0x3B, 0x78, 0x9E, 0xE9, 0xFB, 0x7F, 0xCE, 0x1F, 0xFF, 0xB9, 0x1E, 0xBD,
-    0x67, 0x66, 0x60, 0x64, 0x40, 0x01, 0x8C, 0x0C, 0x40, 0x41, 0xA0, 0x14, 0x50, 0xC1, 0xC6, 0xF3,
-    0x4C, 0x00, 0x45, 0x4A, 0x0E, 0xBF, 0x78, 0x9C, 0x13, 0xF8, 0xA3, 0x53, 0xF0, 0x7F, 0x7E, 0xC3,
-    0xFF, 0xF5, 0x0A, 0xFF, 0xEC, 0x18, 0x04, 0x18, 0x30, 0x81, 0xC0, 0xFF, 0x7A, 0x87, 0xFF, 0xF6,
-    0x05, 0xFF, 0xF9, 0x16, 0xFC, 0xE7, 0x78, 0xF0, 0x9F, 0xF1, 0xE3, 0x7A, 0x06, 0x00, 0x93, 0x15,
-    0x10, 0x91, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x82, 0x02, 0x26, 0x30, 0xF9, 0x8F, 0x19, 0x4C, 0xFE,
-    0x67, 0x06, 0x93, 0x75, 0x60, 0x32, 0x17, 0x4C, 0xFA, 0x00, 0x25, 0xFE, 0xFE, 0xB7, 0x06, 0xA9,
-    0xFA, 0xF7, 0x3F, 0x1A, 0x44, 0x2D, 0xFE, 0xFF, 0xBF, 0x8E, 0x11, 0x48, 0x37, 0xFE, 0xFB, 0xBF,
-    0x9E, 0x05, 0x48, 0x27, 0xFC, 0xFD, 0x7F, 0x1F, 0xC4, 0x77, 0xF8, 0x0D, 0xD2, 0xCE, 0xC0, 0xA0,
-    0xF0, 0x13, 0x4C, 0x31, 0x08, 0x30, 0x00, 0x00, 0xF7, 0x4D, 0x1E, 0x57, 0x78, 0x9C, 0xFB, 0xF7,
-    0x1F, 0x04, 0x98, 0xFF, 0x41, 0xA8, 0x95, 0xAB, 0x40, 0x80, 0x89, 0x01, 0x02, 0xA0, 0xBC, 0x7F,
-    0x28, 0x4A, 0x00, 0x2D, 0xE6, 0x1F, 0xEB, 0x78, 0x9C, 0x93, 0x60, 0x00, 0x83, 0x7F, 0x92, 0x10,
-    0xEA, 0x3F, 0x98, 0x3E, 0xFA, 0x1F, 0x42, 0x6F, 0x81, 0xD2, 0x8B, 0xA0, 0xF4, 0xC4, 0xFF, 0xFF,
-    0x99, 0x80, 0xD4, 0xE4, 0xFF, 0xFF, 0x99, 0x19, 0x18, 0x8E, 0xFD, 0xFF, 0xEF, 0xC3, 0xA0, 0xF0,
-    0xE2, 0xFF, 0x7F, 0x2B, 0x06, 0x86, 0xDF, 0xFF, 0xDF, 0x4B, 0x80, 0xB4, 0xDF, 0x67, 0x03, 0x29,
-    0xDB, 0xC7, 0x02, 0x36, 0x8C, 0x09, 0x62, 0x34, 0x00, 0xB0, 0x91, 0x1C, 0xC3, 0x78, 0x9C, 0x53,
-    0xD8, 0xFE, 0xEF, 0xBE, 0x04, 0xC3, 0xCF, 0xFF, 0xFF, 0xFF, 0xBF, 0x67, 0xFE, 0x0E, 0x24, 0xFF,
-    0xF3, 0x3E, 0x88, 0x66, 0xDC, 0xF4, 0xDF, 0x9E, 0x81, 0x81, 0xC1, 0xE1, 0xBF, 0x3F, 0x90, 0x2C,
-    0xF8, 0xAF, 0x0F, 0x24, 0xBF, 0xFE, 0xE7, 0x61, 0x60, 0x68, 0xF8, 0x7F, 0x9F, 0x91, 0x01, 0xA8,
-    0x56, 0x1A, 0x24, 0xD7, 0xCF, 0x00, 0x12, 0x00, 0x8A, 0x32, 0x4C, 0xF8, 0xCF, 0xC9, 0x00, 0x07,
-    0x82, 0x0C, 0x60, 0x3D, 0x5C, 0x40, 0xF2, 0x03, 0x58, 0xE7, 0x03, 0x30, 0x19, 0xF0, 0x8F, 0x83,
-    0x81, 0x01, 0x00, 0xCE, 0x39, 0x25, 0x7C, 0x78, 0x9C, 0x2D, 0x8E, 0xBB, 0x0E, 0x01, 0x51, 0x18,
-    0x84, 0x87, 0xB8, 0x6C, 0x14, 0x56, 0xA5, 0x5D, 0x6F, 0x60, 0xDF, 0x00, 0x89, 0x4A, 0x43, 0x23,
-    0x4A, 0x95, 0x46, 0x23, 0xD1, 0x0B, 0x6F, 0xE0, 0x11, 0x2C, 0xBD, 0xCB, 0x0B, 0xA0, 0x44, 0x45,
-    0xA2, 0x54, 0xAC, 0x44, 0xA2, 0xA0, 0x58, 0xB7, 0xB8, 0xED, 0x3A, 0xE3, 0x1C, 0x31, 0xC5, 0xFC,
-    0x5F, 0x31, 0xF3, 0x67, 0x00, 0xD4, 0x8F, 0x9C, 0xC4, 0xA1, 0xD4, 0xA5, 0x52, 0x48, 0x92, 0x29,
-    0x9C, 0x6A, 0x71, 0xC6, 0xA1, 0xC4, 0x2B, 0x35, 0xE9, 0x6B, 0xE5, 0x22, 0xAF, 0x52, 0x31, 0x91,
-    0x44, 0x8B, 0x61, 0xF3, 0xC0, 0xB1, 0x76, 0xEB, 0xE0, 0x64, 0xE3, 0x21, 0x5B, 0xC6, 0xCA, 0xC1,
-    0xAD, 0x59, 0x60, 0x3B, 0xEB, 0xE9, 0x16, 0x7D, 0xCF, 0xD4, 0x8A, 0x01, 0x78, 0x7A, 0x8B, 0xFE,
-    0xB7, 0x71, 0xB6, 0x81, 0x8F, 0x44, 0x9F, 0xAB, 0x5F, 0xA6, 0x00, 0xA3, 0x16, 0xE1, 0xEA, 0xB2,
-    0x98, 0x66, 0x74, 0x3B, 0xC5, 0xCB, 0x18, 0x31, 0xB7, 0x67, 0xED, 0x95, 0xC7, 0xBD, 0x6C, 0xCA,
-    0x5F, 0x1B, 0x32, 0x82, 0xCB, 0x12, 0x3D, 0xD1, 0x48, 0x78, 0x0D, 0xC0, 0x62, 0x18, 0x7F, 0x25,
-    0x44, 0x5B, 0x9D, 0x8C, 0xB2, 0x1D, 0x07, 0xA5, 0xCA, 0xC2, 0xF9, 0x6D, 0x72, 0xD5, 0x72, 0xFB,
-    0x17, 0x31, 0xE7, 0xC2, 0xE9, 0x07, 0x25, 0x7C, 0x01, 0x2A, 0xE5, 0x64, 0x2F, 0x78, 0x9C, 0x25,
-    0xCC, 0xDB, 0x0D, 0x82, 0x50, 0x10, 0x84, 0xE1, 0x89, 0x97, 0xA8, 0x11, 0x91, 0x0E, 0x48, 0xA8,
-    0xC0, 0xD8, 0x80, 0x2D, 0xD0, 0xC1, 0xA1, 0x13, 0x4A, 0xD0, 0x0E, 0xA4, 0x03, 0x5B, 0xB0, 0x03,
-    0x5B, 0x30, 0x34, 0x80, 0x31, 0x20, 0x09, 0x8A, 0xBF, 0x67, 0x8F, 0xF3, 0x32, 0xDF, 0xC3, 0xEE,
-    0x48, 0xFA, 0x92, 0xCA, 0xB2, 0x83, 0x32, 0xE0, 0x04, 0xB7, 0x80, 0x3B, 0x03, 0x13, 0x43, 0x4B,
-    0xCD, 0xD2, 0x30, 0x34, 0x15, 0x1B, 0x03, 0xE7, 0x9C, 0x83, 0xEF, 0x1C, 0x97, 0x70, 0xF4, 0xA8,
-    0xD8, 0xEA, 0xD3, 0x78, 0x3C, 0x88, 0xD4, 0x33, 0x93, 0x5E, 0x2C, 0xF4, 0x64, 0x25, 0xBD, 0xB1,
-    0xC4, 0x4A, 0x42, 0xE3, 0x54, 0xFC, 0x71, 0xD1, 0x15, 0x97, 0x65, 0x7B, 0xF0, 0x77, 0xB1, 0xAD,
-    0x33, 0xEF, 0xED, 0x41, 0x1D, 0xEB, 0x91, 0x69, 0x18, 0x4B, 0x7F, 0x2B, 0x3D, 0x49, 0x7E, 0x78,
-    0x9C, 0xFB, 0xF3, 0xFF, 0xFF, 0xFB, 0x39, 0x2C, 0x0C, 0x7F, 0xFE, 0x03, 0xC1, 0x7E, 0x08, 0xF5,
-    0x9F, 0xF3, 0xCF, 0x7F, 0x41, 0xA7, 0x5F, 0xFF, 0xF9, 0xFE, 0xFC, 0x67, 0x60, 0xF8, 0xF0, 0x9F,
-    0x1F, 0x42, 0x81, 0x78, 0x0A, 0x3F, 0xFF, 0x73, 0x80, 0x95, 0x9C, 0x87, 0xA8, 0x94, 0x86, 0x6A,
-    0x60, 0x05, 0xC9, 0x7D, 0xFF, 0x2F, 0x0F, 0x52, 0xB9, 0xE0, 0x7F, 0x3C, 0x88, 0x6A, 0xF8, 0x5F,
-    0x0F, 0xA2, 0x36, 0xFC, 0xCF, 0xFF, 0xF3, 0x5F, 0xC9, 0xE8, 0xE7, 0x7F, 0x7D, 0x88, 0x4A, 0x6E,
-    0x24, 0x8B, 0xD6, 0xB1, 0x30, 0x00, 0x00, 0xA7, 0xE2, 0x56, 0x8D, 0x78, 0x9C, 0x63, 0x60, 0x48,
-    0x78, 0xFD, 0x7F, 0x2D, 0x2B, 0x03, 0x83, 0xC1, 0xBF, 0xFF, 0xFF, 0xFF, 0xDF, 0x67, 0x60, 0xF8,
-    0x0A, 0xA4, 0xFE, 0xF7, 0x33, 0x08, 0xFC, 0xFB, 0x1F, 0x63, 0x7C, 0x4C, 0x9F, 0x61, 0xC1, 0xFF,
-    0xFD, 0x0C, 0x0C, 0x0C, 0x4C, 0x0C, 0x1F, 0xFE, 0xCB, 0x33, 0x80, 0xC0, 0x97, 0xFF, 0x5C, 0x60,
-    0xFA, 0xFB, 0x7F, 0x76, 0x30, 0xFD, 0xE3, 0x3F, 0x2B, 0x0A, 0xFD, 0xFD, 0x3F, 0x1B, 0x98, 0xFE,
-    0xFA, 0x9F, 0x13, 0x4C, 0x7F, 0xFC, 0xCF, 0x07, 0xA6, 0x0F, 0xFC, 0x9F, 0x0F, 0xA6, 0x1D, 0xFE,
-    0xFF, 0x8F, 0x36, 0x6A, 0x8D, 0x65, 0x60, 0xF8, 0x09, 0xB2, 0x27, 0x9F, 0x81, 0xA1, 0x01, 0x4A,
-    0x33, 0x34, 0xBD, 0x79, 0x0F, 0x74, 0x07, 0x00, 0xCF, 0x69, 0x36, 0xD8, 0x78, 0x9C, 0xFB, 0xF3,
-    0xFF, 0xFF, 0xFB, 0x6A, 0x46, 0x06, 0x86, 0x3F, 0xFF, 0x81, 0xA0, 0x1F, 0x4A, 0xFF, 0xE7, 0x06,
-    0xD2, 0x82, 0x4E, 0x3F, 0xFF, 0xCF, 0x07, 0xD2, 0x0C, 0x0C, 0x0E, 0xFF, 0xFF, 0x33, 0x81, 0x68,
-    0x86, 0x9F, 0xFF, 0x39, 0xC0, 0xF4, 0xA7, 0xFF, 0x3C, 0x60, 0xFA, 0xC3, 0x7F, 0x7E, 0x30, 0xFD,
-    0x00, 0x8D, 0xFE, 0xF0, 0x9F, 0x0F, 0x4C, 0x7F, 0xFE, 0xCF, 0x0D, 0xA6, 0x7F, 0xFD, 0x67, 0x07,
-    0xD1, 0x09, 0xFF, 0xFF, 0x33, 0xFE, 0xF9, 0xAF, 0x14, 0xF4, 0xFB, 0x7F, 0x3D, 0xD4, 0x1E, 0x4E,
-    0x08, 0x9D, 0x07, 0xB6, 0xF7, 0x5E, 0x16, 0x50, 0x29, 0x00, 0x6D, 0x42, 0x51, 0xA2, 0x78, 0x9C,
-    0xFB, 0xF3, 0x1F, 0x08, 0x38, 0xFE, 0xA0, 0x90, 0x82, 0x82, 0x82, 0x0C, 0x7F, 0xFE, 0x33, 0x00,
-    0x01, 0x2A, 0x09, 0x04, 0x8C, 0xA8, 0x24, 0x2E, 0x95, 0x4A, 0x4A, 0x4A, 0x8C, 0x7F, 0x30, 0x4C,
-    0x06, 0x00, 0xD3, 0x8C, 0x3F, 0x8C, 0x78, 0x9C, 0xFB, 0xF3, 0x1F, 0x08, 0xD8, 0xFF, 0xA0, 0x90,
-    0x82, 0x82, 0x82, 0x0C, 0x7F, 0xFE, 0x33, 0x00, 0x01, 0x36, 0x12, 0x08, 0xD0, 0x48, 0xFC, 0xEA,
-    0x11, 0x24, 0x00, 0x41, 0x00, 0x36, 0x10, 0x78, 0x9C, 0x63, 0x60, 0x30, 0x38, 0xF1, 0xEF, 0x7E,
-    0x35, 0x13, 0x83, 0xC2, 0x9F, 0xFF, 0x40, 0xC0, 0xC7, 0xF0, 0x18, 0x44, 0xFD, 0x67, 0x17, 0xF8,
-    0xF7, 0x7F, 0xBE, 0x4A, 0xF0, 0x2F, 0xC6, 0x09, 0xFF, 0xDF, 0x33, 0x33, 0x00, 0xC1, 0x87, 0xFF,
-    0xFE, 0x20, 0x8A, 0xE1, 0xCB, 0x7F, 0x1E, 0x30, 0xFD, 0xED, 0x3F, 0x07, 0x98, 0xFE, 0xF1, 0x9F,
-    0x8D, 0x01, 0xA8, 0x5E, 0xFE, 0xC7, 0x7F, 0x56, 0x30, 0xFD, 0xFD, 0x3F, 0x3B, 0x98, 0xFE, 0xFA,
-    0x9F, 0x8B, 0x41, 0x69, 0xD1, 0x7F, 0xF9, 0x8F, 0xFF, 0xE5, 0x19, 0x18, 0x26, 0xFC, 0x97, 0xDF,
-    0xF0, 0x7F, 0x3D, 0x98, 0x76, 0xF8, 0xFF, 0x3F, 0xC6, 0xF8, 0x08, 0x50, 0xF0, 0x07, 0xD8, 0x1E,
-    0x79, 0x86, 0x02, 0x28, 0xCD, 0x50, 0xF8, 0xE6, 0xFF, 0xB9, 0x2C, 0x26, 0x00, 0x1C, 0x3E, 0x4A,
-    0x0B, 0x78, 0x9C, 0xFB, 0xF3, 0x9F, 0x81, 0x81, 0xE1, 0xC1, 0x7F, 0xBE, 0x3F, 0x24, 0xD3, 0x60,
-    0x80, 0x85, 0x56, 0x52, 0x52, 0x7A, 0x44, 0x8E, 0x79, 0x10, 0x1A, 0x00, 0xF4, 0xC2, 0x50, 0x0D,
-    0x78, 0x9C, 0xFB, 0xF3, 0x9F, 0xE1, 0x0F, 0xE9, 0x08, 0x00, 0xE6, 0x70, 0x23, 0xA7, 0x78, 0x9C,
-    0x63, 0x60, 0xF8, 0xF3, 0x9F, 0x81, 0x81, 0xEA, 0xC4, 0x5F, 0x20, 0x21, 0xF0, 0xFF, 0x3E, 0x83,
-    0xC9, 0x91, 0xFF, 0xF3, 0x81, 0x9C, 0xFF, 0xFA, 0x20, 0x82, 0x8D, 0xE1, 0xF7, 0x7B, 0x2B, 0x06,
-    0x06, 0x00, 0x6B, 0x52, 0x30, 0x7B, 0x78, 0x9C, 0x3D, 0xCD, 0xCB, 0x0D, 0x40, 0x40, 0x18, 0x04,
-    0xE0, 0x3F, 0x59, 0x11, 0x9C, 0x54, 0x40, 0x09, 0x4A, 0x51, 0x02, 0x25, 0xE8, 0x40, 0x0B, 0x3A,
-    0xA1, 0x04, 0x1D, 0x28, 0x45, 0x64, 0x0F, 0x22, 0x1E, 0x63, 0x67, 0x22, 0x4E, 0xDF, 0x65, 0x1E,
-    0x17, 0xCC, 0xF2, 0x07, 0xEE, 0x0A, 0xCE, 0x68, 0x8C, 0x1E, 0x48, 0x69, 0x8B, 0xC5, 0xA8, 0x47,
-    0x41, 0x43, 0x2A, 0xA2, 0x13, 0x7A, 0xA3, 0x3B, 0x32, 0x89, 0xDF, 0x5A, 0x8E, 0x58, 0xA5, 0x3B,
-    0x91, 0xA8, 0xBF, 0xA1, 0x92, 0xDD, 0xB7, 0x67, 0x37, 0x62, 0xE9, 0x51, 0xCA, 0x01, 0xA3, 0xE4,
-    0xC3, 0x0B, 0x43, 0x04, 0x4A, 0x09, 0x78, 0x9C, 0xFB, 0xF3, 0x9F, 0x01, 0x08, 0xFE, 0x50, 0x99,
-    0x54, 0x52, 0x52, 0x62, 0xFA, 0xF3, 0x1F, 0x08, 0xFC, 0x91, 0x49, 0x00, 0x3E, 0x9A, 0x2D, 0xF3,
-    0x78, 0x9C, 0x25, 0xCD, 0xC1, 0x0D, 0x82, 0x40, 0x14, 0x45, 0xD1, 0xA7, 0x21, 0x1A, 0x03, 0xB1,
-    0x05, 0xDC, 0xBB, 0x40, 0x17, 0xAC, 0xB5, 0x04, 0x3A, 0xA0, 0x84, 0xB1, 0x13, 0xEC, 0x40, 0x3A,
-    0xA0, 0x84, 0xB1, 0x03, 0x4A, 0xC0, 0x12, 0x34, 0x12, 0x93, 0x09, 0x64, 0x9E, 0xFF, 0xF3, 0xEF,
-    0xEA, 0xEC, 0xEE, 0xCC, 0x06, 0x12, 0x59, 0xCF, 0x1C, 0x04, 0xD5, 0x22, 0xAE, 0x81, 0xD6, 0xB4,
-    0x05, 0xDE, 0x2A, 0xCF, 0x0C, 0x18, 0xBD, 0xA8, 0x61, 0x0E, 0x04, 0xA7, 0x9A, 0x1C, 0x10, 0x0B,
-    0xD1, 0xE3, 0xE7, 0x71, 0xE5, 0x51, 0xF5, 0x21, 0xEE, 0x2C, 0x55, 0x4F, 0x26, 0x2F, 0x9E, 0x45,
-    0xDD, 0x8D, 0xBB, 0xAF, 0x3F, 0xA9, 0x0E, 0xDC, 0x07, 0xB7, 0x08, 0xF1, 0x12, 0x73, 0x53, 0xE8,
-    0x99, 0x9A, 0x46, 0x72, 0x63, 0x92, 0xE9, 0xCA, 0xD4, 0xB2, 0x87, 0xA9, 0xA2, 0x53, 0xFD, 0x01,
-    0x62, 0xBF, 0x69, 0xD3, 0x78, 0x9C, 0x35, 0xCC, 0x41, 0x0D, 0x80, 0x30, 0x0C, 0x05, 0xD0, 0xC2,
-    0x65, 0x07, 0x44, 0x6C, 0x8E, 0x90, 0x80, 0x05, 0x1C, 0x20, 0x01, 0x09, 0x95, 0xC0, 0x1C, 0x2D,
-    0x48, 0x20, 0x0C, 0x12, 0x92, 0x8D, 0x4F, 0xD3, 0xB2, 0xDB, 0x3B, 0xBD, 0x82, 0x91, 0x88, 0x2E,
-    0x74, 0x05, 0xA9, 0x01, 0xAE, 0xC1, 0x1B, 0x12, 0xD8, 0xB0, 0x54, 0xF4, 0x8A, 0x35, 0x63, 0x50,
-    0x70, 0xC4, 0x64, 0x08, 0x12, 0x28, 0xE8, 0x81, 0xCB, 0x82, 0x8D, 0x76, 0x78, 0xC3, 0x0C, 0x3E,
-    0x15, 0x54, 0x71, 0x1B, 0x32, 0x5E, 0x43, 0x04, 0x0C, 0xA1, 0x41, 0x82, 0x1F, 0x87, 0xE0, 0x03,
-    0xF0, 0xEC, 0x5E, 0x0A, 0x78, 0x9C, 0x63, 0x60, 0x28, 0x7C, 0xFD, 0x7F, 0x1F, 0x1B, 0x03, 0x03,
-    0x43, 0xC2, 0x7F, 0x20, 0x78, 0xCF, 0xC2, 0xC0, 0xF0, 0x1D, 0xC4, 0xF8, 0x1F, 0xCF, 0x60, 0xF0,
-    0xFF, 0x7F, 0x8E, 0xF1, 0xB5, 0xFF, 0xFF, 0x99, 0x36, 0xFC, 0xDF, 0x0F, 0x94, 0xFF, 0xF3, 0x9F,
-    0xF3, 0xE3, 0x7F, 0x79, 0x20, 0xE3, 0xD3, 0x7F, 0xFE, 0xAF, 0xFF, 0xB9, 0x81, 0x8C, 0x03, 0xFF,
-    0xED, 0xBF, 0xFF, 0xE7, 0x00, 0x32, 0x26, 0xFC, 0x8F, 0xFF, 0xF1, 0x9F, 0x1D, 0xC8, 0x68, 0xF8,
-    0x9F, 0x0F, 0x67, 0xC0, 0xA5, 0xBE, 0xC0, 0x14, 0xC3, 0xB5, 0xC3, 0x0D, 0x84, 0x5B, 0x01, 0xB7,
-    0x14, 0xE1, 0x0C, 0x98, 0xC3, 0x00, 0x07, 0x93, 0x51, 0x70, 0x78, 0x9C, 0xFB, 0xF3, 0xFF, 0xFF,
-    0xFB, 0x68, 0x06, 0x86, 0x3F, 0xFF, 0x81, 0x40, 0x06, 0x42, 0xED, 0x07, 0x52, 0x82, 0xCD, 0xFF,
-    0xFF, 0x33, 0xFF, 0xF9, 0xCF, 0xC0, 0xF0, 0xF3, 0x3F, 0x3B, 0x88, 0xFA, 0xFA, 0x9F, 0x03, 0x89,
-    0xFA, 0xF5, 0x9F, 0x0D, 0xA8, 0x64, 0xC9, 0xFF, 0xFF, 0x8C, 0x60, 0x0D, 0xFD, 0x10, 0x7D, 0x9C,
-    0x20, 0xEA, 0xBE, 0x25, 0xC8, 0x30, 0x06, 0x10, 0x20, 0x82, 0x02, 0x00, 0x68, 0x90, 0x42, 0xAD,
-    0x78, 0x9C, 0x63, 0x60, 0x28, 0x7C, 0xFD, 0x7F, 0x1F, 0x1B, 0x03, 0x03, 0x43, 0xC2, 0x7F, 0x20,
-    0x78, 0xCF, 0xC2, 0xC0, 0xF0, 0x1D, 0xC4, 0xF8, 0x1F, 0xCF, 0x60, 0xF0, 0xFF, 0x7F, 0x8E, 0xF1,
-    0xB5, 0xFF, 0xFF, 0x99, 0x36, 0xFC, 0xDF, 0x0F, 0x94, 0xFF, 0xF3, 0x9F, 0xF3, 0xE3, 0x7F, 0x79,
-    0x20, 0xE3, 0xD3, 0x7F, 0xFE, 0xAF, 0xFF, 0xB9, 0x81, 0x8C, 0x03, 0xFF, 0xED, 0xBF, 0xFF, 0xE7,
-    0x00, 0x32, 0x26, 0xFC, 0x8F, 0xFF, 0xF1, 0x9F, 0x1D, 0xC8, 0x68, 0xF8, 0x9F, 0x0F, 0x67, 0xC0,
-    0xA5, 0xBE, 0xC0, 0x14, 0xC3, 0xB5, 0xC3, 0x0D, 0x84, 0x5B, 0x01, 0xB5, 0x34, 0x1F, 0xE6, 0x0C,
-    0x56, 0xA0, 0x3C, 0xD0, 0x61, 0x40, 0x57, 0x80, 0x41, 0xC0, 0xFF, 0xFF, 0xCC, 0x10, 0xD6, 0x8F,
-    0xFF, 0x7A, 0x10, 0xC6, 0x86, 0xFF, 0xEF, 0x19, 0xC1, 0x0C, 0x81, 0xBF, 0xFF, 0x65, 0x01, 0x30,
-    0xDF, 0x5B, 0x59, 0x78, 0x9C, 0x2D, 0xCC, 0xBB, 0x0D, 0x80, 0x30, 0x0C, 0x04, 0x50, 0x13, 0xF1,
-    0x2B, 0x28, 0xC8, 0x00, 0x2C, 0xC6, 0x12, 0x20, 0x16, 0xA0, 0x60, 0x00, 0xD8, 0x30, 0x23, 0x20,
-    0x04, 0x12, 0x05, 0x81, 0xC3, 0x9F, 0xB8, 0x79, 0xB2, 0xEE, 0xEC, 0x08, 0x84, 0x9E, 0x88, 0x22,
-    0x78, 0xBA, 0x64, 0x10, 0xFD, 0x02, 0xE4, 0x2C, 0xD1, 0x8D, 0x4A, 0xBD, 0x50, 0xA7, 0xBD, 0x14,
-    0x27, 0x20, 0xB3, 0xFE, 0x60, 0x77, 0x7B, 0x61, 0xAE, 0xFA, 0xCF, 0x3F, 0x70, 0x22, 0x1D, 0x68,
-    0xD4, 0x11, 0xB3, 0x4A, 0x2F, 0x07, 0xE2, 0xC9, 0x81, 0xB8, 0x71, 0x20, 0xB6, 0x1F, 0xDC, 0x0F,
-    0x74, 0xB1, 0x4E, 0xCB, 0x78, 0x9C, 0x63, 0x68, 0xFC, 0xF3, 0xBE, 0x87, 0xD9, 0xE0, 0xDF, 0xFF,
-    0xFF, 0xFF, 0xEB, 0x1F, 0x02, 0x89, 0xFF, 0xFA, 0xDF, 0xFE, 0xFB, 0x04, 0xDF, 0xE0, 0xF9, 0xF9,
-    0x9F, 0x89, 0x81, 0x81, 0xE1, 0xE7, 0x7F, 0x66, 0x20, 0xF9, 0xED, 0xBF, 0x1F, 0x90, 0x7C, 0xF0,
-    0xFF, 0xBF, 0x0F, 0x03, 0x83, 0x02, 0x50, 0xA5, 0x0D, 0x03, 0xC3, 0x44, 0xA0, 0x4A, 0x56, 0x06,
-    0x86, 0x49, 0x40, 0xF5, 0x40, 0xA9, 0x43, 0xFF, 0xFB, 0x81, 0xA4, 0xC0, 0xFF, 0xFD, 0xA2, 0x40,
-    0xEA, 0xFF, 0xFE, 0xBF, 0x59, 0xCA, 0x5B, 0xFE, 0xF7, 0xFF, 0x05, 0x99, 0x26, 0x07, 0x22, 0xDF,
-    0x33, 0x17, 0xBE, 0xFE, 0xBF, 0x8F, 0x9D, 0x01, 0x00, 0x58, 0x8A, 0x3A, 0x16, 0x78, 0x9C, 0xFB,
-    0xF1, 0x1F, 0x0C, 0x7E, 0xA0, 0x50, 0x8A, 0x4A, 0x9B, 0xFE, 0xFB, 0x2B, 0x29, 0x31, 0x30, 0x2C,
-    0xF8, 0xAF, 0xCF, 0xC0, 0x40, 0x43, 0x0A, 0x00, 0x5D, 0x16, 0x30, 0xA2, 0x78, 0x9C, 0xFB, 0xF7,
-    0x9E, 0x81, 0x81, 0xE1, 0xC3, 0x7F, 0x9E, 0x7F, 0x54, 0xA6, 0xFF, 0x42, 0x68, 0xEE, 0x3F, 0xFF,
-    0x19, 0x19, 0x18, 0x3E, 0xFF, 0xE7, 0xFA, 0xF9, 0x9F, 0x9D, 0x81, 0x01, 0x48, 0x7C, 0xFE, 0x3F,
-    0xDF, 0x64, 0xC9, 0xFF, 0xFF, 0x8C, 0x13, 0xFE, 0x83, 0x40, 0x3E, 0x48, 0x0C, 0x08, 0xD8, 0x18,
-    0x18, 0x0C, 0x6E, 0xFE, 0x3F, 0xA7, 0xCE, 0xC0, 0x00, 0x00, 0x72, 0x01, 0x4A, 0x2F, 0x78, 0x9C,
-    0x1D, 0xCE, 0x5B, 0x0D, 0xC2, 0x40, 0x14, 0x84, 0xE1, 0xBF, 0x84, 0x4B, 0x08, 0x04, 0x70, 0x50,
-    0x9C, 0x80, 0x04, 0x1C, 0x20, 0xA1, 0x75, 0x02, 0x12, 0x70, 0x80, 0x84, 0x56, 0x02, 0x0E, 0x8A,
-    0x04, 0xBA, 0x21, 0x34, 0x5C, 0xDA, 0x61, 0x76, 0xE7, 0xE5, 0xCC, 0xCB, 0x77, 0x32, 0xBD, 0x70,
-    0xBE, 0xCA, 0x3A, 0x8D, 0x61, 0xA3, 0x8A, 0xA0, 0x39, 0x1C, 0x54, 0x70, 0xD3, 0x0A, 0x2E, 0xCA,
-    0x29, 0xB5, 0x83, 0x87, 0x16, 0x6C, 0x75, 0x82, 0xA7, 0xA6, 0xD0, 0x37, 0xF0, 0x56, 0x06, 0x9D,
-    0x46, 0x0C, 0x95, 0x5F, 0x04, 0xCD, 0xF6, 0x46, 0x50, 0x6B, 0x79, 0x36, 0xC2, 0x2C, 0xBF, 0x1B,
-    0x61, 0x56, 0x84, 0x88, 0xE0, 0x77, 0x7D, 0x45, 0x64, 0xD6, 0x7C, 0x22, 0x82, 0x56, 0xC3, 0x31,
-    0x95, 0x5A, 0x5A, 0xA7, 0x52, 0x2A, 0xA1, 0x38, 0x46, 0x13, 0x9F, 0x3F, 0x19, 0xFD, 0x3D, 0xDE,
-    0x78, 0x9C, 0x25, 0x8F, 0xC1, 0x0D, 0x82, 0x40, 0x14, 0x44, 0x87, 0xA8, 0x51, 0x13, 0x92, 0xA5,
-    0x04, 0x0A, 0xB0, 0x07, 0x4A, 0x80, 0x1A, 0x6C, 0xC0, 0x12, 0x28, 0x01, 0x2E, 0xD6, 0x61, 0x09,
-    0x94, 0x00, 0x47, 0x6F, 0x94, 0x80, 0x24, 0x62, 0x80, 0x0D, 0x3B, 0xCE, 0x0F, 0x87, 0xDD, 0x9F,
-    0x9D, 0xFC, 0xBC, 0x37, 0x1B, 0x7A, 0x00, 0x1B, 0x75, 0xAD, 0xC4, 0xC2, 0x08, 0x09, 0x79, 0x04,
-    0x42, 0x8B, 0x49, 0xB3, 0x20, 0x2F, 0x48, 0x59, 0x61, 0xD4, 0xAC, 0xC9, 0x58, 0x49, 0x8E, 0x4E,
-    0xB3, 0x63, 0x70, 0x4A, 0xF6, 0x33, 0x0E, 0x7E, 0x4F, 0x0B, 0x66, 0xF8, 0x35, 0x73, 0x85, 0x8F,
-    0xF6, 0x13, 0x96, 0x58, 0xCB, 0xA9, 0xC7, 0xD7, 0x88, 0xDB, 0x0B, 0x21, 0x1F, 0x19, 0xCD, 0xE6,
-    0x5A, 0x86, 0x94, 0xAE, 0xE3, 0xC9, 0xB7, 0x7A, 0x4C, 0xBC, 0x33, 0xAE, 0x79, 0x95, 0x06, 0x12,
-    0x3D, 0x79, 0x2E, 0x78, 0x93, 0x06, 0x42, 0xBE, 0x79, 0x48, 0xF8, 0x90, 0x02, 0x12, 0x79, 0x1A,
-    0x46, 0x1A, 0x58, 0xB1, 0x46, 0x18, 0xAB, 0x07, 0xAB, 0x5C, 0x1A, 0xC6, 0x34, 0xF6, 0x99, 0xCC,
-    0x30, 0xA6, 0xB1, 0x0D, 0x67, 0x18, 0xD3, 0xFC, 0x01, 0x3B, 0x3D, 0x6E, 0xA6, 0x78, 0x9C, 0x25,
-    0x8C, 0x61, 0x0D, 0xC2, 0x50, 0x0C, 0x84, 0x0F, 0xC8, 0xFB, 0x01, 0x19, 0x64, 0x0A, 0x16, 0x9C,
-    0x80, 0x03, 0x2C, 0xCC, 0x01, 0x48, 0xC0, 0x01, 0x38, 0x18, 0x0E, 0xC0, 0x01, 0x38, 0x00, 0x0B,
-    0x53, 0xB0, 0x00, 0x0B, 0x24, 0xCB, 0xDE, 0x3E, 0xDA, 0x47, 0x93, 0xE6, 0xBE, 0xF6, 0xDA, 0x6B,
-    0x99, 0x4B, 0x4B, 0x1A, 0x9D, 0xD8, 0x4A, 0x17, 0x36, 0xCA, 0x07, 0x46, 0x6A, 0x99, 0x49, 0x1F,
-    0xA6, 0x8A, 0x36, 0xE8, 0xC6, 0x6A, 0xE7, 0xB6, 0x1D, 0xDE, 0x6B, 0x32, 0x03, 0x7D, 0x89, 0x8C,
-    0x1D, 0x1E, 0x70, 0x70, 0xD5, 0x1A, 0x8F, 0xB2, 0x3A, 0x42, 0x91, 0xE0, 0x0D, 0xD7, 0x04, 0xB1,
-    0xE9, 0x08, 0xA6, 0x16, 0x52, 0x27, 0xEF, 0x45, 0x56, 0x72, 0x36, 0xE8, 0x99, 0x58, 0x07, 0x95,
-    0x54, 0xBE, 0x2D, 0xF4, 0x64, 0x21, 0xED, 0xCD, 0xFB, 0x7F, 0x0C, 0x84, 0x1F, 0xAE, 0xE0, 0x43,
-    0xD7, 0x78, 0x9C, 0x95, 0xCB, 0xC1, 0x09, 0x83, 0x40, 0x00, 0x00, 0xC1, 0x0D, 0x22, 0x01, 0x51,
-    0xB0, 0x02, 0x49, 0x07, 0xB1, 0xA3, 0xB3, 0x14, 0x3B, 0x48, 0x0B, 0x96, 0x60, 0x07, 0x96, 0x62,
-    0x3A, 0x90, 0x70, 0x0F, 0x91, 0x03, 0x57, 0xAF, 0x84, 0xEC, 0x67, 0x5E, 0x9B, 0x2C, 0x61, 0x36,
-    0x44, 0x1B, 0x88, 0xD6, 0x93, 0x01, 0x92, 0xC5, 0xCB, 0x95, 0xDE, 0x05, 0x0E, 0xCB, 0xD9, 0x37,
-    0xFC, 0x6C, 0xA2, 0x15, 0x8C, 0x86, 0xE4, 0x03, 0xDA, 0x73, 0xF3, 0xC3, 0xDD, 0xAE, 0x5D, 0xF6,
-    0xAB, 0xCF, 0xEC, 0xE0, 0x96, 0xA1, 0xCD, 0xF7, 0xDF, 0x5E, 0x78, 0x2B, 0x34, 0x12, 0x78, 0x9C,
-    0xFB, 0xF4, 0x1F, 0x04, 0xD6, 0x7F, 0x42, 0xA6, 0xFA, 0x15, 0x94, 0x94, 0x94, 0xBE, 0xFC, 0xE7,
-    0x65, 0x00, 0x82, 0x3F, 0xFF, 0x99, 0x81, 0x64, 0xC1, 0xFF, 0x7E, 0x10, 0xE7, 0x33, 0x44, 0xEC,
-    0x2F, 0x58, 0xAC, 0xE1, 0x7F, 0x3D, 0x44, 0x8C, 0x07, 0x22, 0xC6, 0x04, 0x24, 0x27, 0xFC, 0xCF,
-    0x07, 0x71, 0xBE, 0xFC, 0xE7, 0x06, 0x92, 0x02, 0xFF, 0xFE, 0x33, 0x02, 0xA9, 0x05, 0xFF, 0xEB,
-    0x81, 0xC6, 0x09, 0x7D, 0x01, 0x1B, 0xFD, 0xFE, 0x1B, 0x0A, 0x05, 0x00, 0x0F, 0x81, 0x41, 0x6D,
-    0x78, 0x9C, 0xFB, 0xF2, 0xFF, 0x3F, 0xD7, 0x17, 0x30, 0x9E, 0xC9, 0xF6, 0xE5, 0x3D, 0x03, 0x03,
-    0x45, 0x18, 0x64, 0x06, 0xD4, 0x3C, 0x00, 0x5F, 0x26, 0x2F, 0x45, 0x78, 0x9C, 0xFB, 0xB5, 0x9F,
-    0x01, 0x08, 0xBE, 0xFC, 0x67, 0x04, 0x92, 0x0F, 0xFE, 0xB3, 0x03, 0xC9, 0x09, 0xFF, 0x79, 0x81,
-    0xA4, 0xC1, 0x7F, 0x7B, 0x90, 0xC4, 0xDF, 0xF9, 0x20, 0xF2, 0xFB, 0x7B, 0x10, 0xF9, 0xF1, 0x3F,
-    0x0B, 0x90, 0xDC, 0xF0, 0x9F, 0x0B, 0x48, 0x06, 0xFC, 0x97, 0x07, 0x09, 0xFD, 0xCF, 0x07, 0x91,
-    0x3F, 0xCF, 0x83, 0xC8, 0xCF, 0xFF, 0x99, 0x80, 0xE4, 0x85, 0xFF, 0x1C, 0x40, 0xB2, 0xE1, 0x3F,
-    0x1F, 0x90, 0x54, 0xF8, 0xEF, 0x0F, 0x92, 0xF8, 0xB3, 0x1E, 0x44, 0x7E, 0xFB, 0xCF, 0x00, 0x00,
-    0xAF, 0x1F, 0x1E, 0xD7, 0x78, 0x9C, 0xFB, 0xF6, 0xFF, 0x3F, 0xC7, 0x37, 0x20, 0x9E, 0x7C, 0xF3,
-    0x3F, 0x07, 0xC3, 0x02, 0xCA, 0x30, 0xC8, 0x8C, 0x6F, 0x50, 0xF3, 0x00, 0x89, 0xC3, 0x2B, 0x47,
-    0x78, 0x9C, 0x63, 0x60, 0x38, 0x50, 0xCF, 0x00, 0x02, 0x9F, 0xDF, 0x83, 0xA9, 0x5F, 0xFF, 0xD9,
-    0x81, 0xA4, 0xC2, 0xFF, 0xFF, 0x7C, 0x40, 0x6A, 0xC2, 0xFF, 0xAF, 0x20, 0xC9, 0x0F, 0xEB, 0x0F,
-    0x80, 0x24, 0xBF, 0xDB, 0x3B, 0x80, 0x24, 0xFF, 0xF1, 0x32, 0xFC, 0xE5, 0x63, 0x08, 0xF8, 0xCF,
-    0xC6, 0x00, 0x94, 0x3C, 0xF0, 0x9F, 0x81, 0xE1, 0xC2, 0x7B, 0x86, 0xCF, 0xF3, 0x19, 0x18, 0x12,
-    0xFE, 0xB3, 0xFF, 0xB2, 0x07, 0x2A, 0xFB, 0xC7, 0x07, 0x00, 0x91, 0x45, 0x1D, 0xB5, 0x78, 0x9C,
-    0xDB, 0xB0, 0x1B, 0x08, 0xAC, 0x3F, 0xFC, 0x07, 0x82, 0x78, 0x00, 0x39, 0x9C, 0x09, 0x23, 0x78,
-    0x9C, 0xFB, 0xF5, 0x9F, 0x93, 0xA1, 0xE1, 0x7F, 0x3C, 0x03, 0xC3, 0xD7, 0xFF, 0x4C, 0x0C, 0x06,
-    0x7F, 0x79, 0x01, 0x43, 0x18, 0x07, 0x11, 0x78, 0x9C, 0x63, 0x98, 0xF2, 0xE7, 0x7F, 0x0D, 0x03,
-    0x43, 0xC1, 0x7F, 0x20, 0xD0, 0x63, 0x10, 0xF8, 0xFF, 0xFE, 0xCF, 0xFF, 0xFD, 0x0C, 0x0C, 0xE9,
-    0x8C, 0x0C, 0x7F, 0xFE, 0x33, 0x32, 0x00, 0xC1, 0x8F, 0xFF, 0xCC, 0x0C, 0x93, 0xEF, 0xFC, 0xFB,
-    0xFF, 0x9F, 0x79, 0x01, 0x48, 0xC9, 0x7F, 0xE6, 0xEF, 0xFF, 0xFB, 0x4C, 0x7E, 0xFE, 0x67, 0xFE,
-    0x0B, 0x14, 0x07, 0xCA, 0xFD, 0x7B, 0xCF, 0xC0, 0xF0, 0x1B, 0xC4, 0x63, 0x4A, 0x00, 0xCA, 0xFD,
-    0xFA, 0x7F, 0xFE, 0x2F, 0x90, 0xFA, 0x04, 0x54, 0xF7, 0xE4, 0x3F, 0xB3, 0xC2, 0xAB, 0xF7, 0x5A,
-    0x13, 0xFE, 0x33, 0x03, 0x00, 0xC1, 0xCA, 0x3B, 0x0D, 0x78, 0x9C, 0xFB, 0xF0, 0x9F, 0x8B, 0x01,
-    0x08, 0x3E, 0xE0, 0xA7, 0x5E, 0xBC, 0x97, 0x04, 0x52, 0xB7, 0xFE, 0xFF, 0x7F, 0xCF, 0xF8, 0xE1,
-    0x3F, 0x08, 0x70, 0x7F, 0xF8, 0xBF, 0x9F, 0xE9, 0xEB, 0x7F, 0xFD, 0x0F, 0xFF, 0xF9, 0x19, 0x1A,
-    0xFE, 0xE7, 0x7F, 0xF8, 0xCF, 0xC3, 0x60, 0xF0, 0x7F, 0x3E, 0x48, 0x83, 0xC2, 0xFF, 0xF5, 0x1F,
-    0xFE, 0x73, 0x43, 0x28, 0x1E, 0x06, 0x07, 0x90, 0xA0, 0x3C, 0xC3, 0x04, 0x90, 0x92, 0xF3, 0xCC,
-    0x60, 0x0D, 0x20, 0xC0, 0xF5, 0xE1, 0xFF, 0x8B, 0xFF, 0xFF, 0xEF, 0x03, 0x0D, 0x13, 0x78, 0x09,
-    0x34, 0x1A, 0x00, 0x0B, 0x74, 0x49, 0xEE, 0x78, 0x9C, 0x63, 0x70, 0x78, 0xF5, 0x7E, 0x2E, 0x0B,
-    0xC3, 0xEF, 0xFF, 0xFF, 0xFF, 0xF3, 0x2E, 0x00, 0x12, 0xFF, 0xD9, 0x3F, 0xFF, 0x8F, 0x17, 0x5C,
-    0xC2, 0xF8, 0xE3, 0x3F, 0x1B, 0x03, 0x03, 0xC3, 0x9F, 0xFF, 0x8C, 0x40, 0xF2, 0xEF, 0x7F, 0x06,
-    0x38, 0x09, 0x11, 0xF9, 0x09, 0x96, 0xFD, 0x0A, 0x54, 0x39, 0x99, 0xF3, 0x00, 0x48, 0x17, 0x97,
-    0xC2, 0x5F, 0x10, 0xC9, 0x50, 0xF0, 0xE6, 0x7F, 0x2F, 0x23, 0x00, 0xE7, 0xAF, 0x29, 0x28, 0x78,
-    0x9C, 0x63, 0x60, 0x60, 0x60, 0xB8, 0xF0, 0x9F, 0x8F, 0x01, 0x1F, 0xB5, 0xE8, 0x5F, 0xEF, 0x81,
-    0xFF, 0x7C, 0x06, 0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0x9F, 0xEF, 0xC2, 0x7F, 0x10, 0xE0, 0xFB, 0xFA,
-    0xDF, 0xCF, 0xF0, 0xCF, 0x7F, 0xBE, 0x9F, 0xFF, 0xD9, 0x18, 0x3E, 0xFE, 0xE7, 0xFB, 0xF3, 0x9F,
-    0x91, 0x61, 0xC3, 0x7F, 0xBE, 0xBF, 0xFF, 0x19, 0x18, 0x26, 0x00, 0xA9, 0xF7, 0x60, 0xEA, 0x0F,
-    0x90, 0xB7, 0x01, 0xA4, 0x84, 0x95, 0xE1, 0x01, 0x58, 0x83, 0xC2, 0x2F, 0xB8, 0x76, 0x90, 0x61,
-    0xDD, 0x60, 0xA3, 0x6B, 0x15, 0xFE, 0xF3, 0x01, 0x00, 0x08, 0x42, 0x45, 0x62, 0x78, 0x9C, 0x1D,
-    0x8A, 0xB1, 0x0D, 0x40, 0x60, 0x14, 0x06, 0x3F, 0x05, 0x09, 0x66, 0x91, 0x68, 0x2D, 0x21, 0xB6,
-    0xD1, 0x18, 0xC2, 0x08, 0x96, 0x30, 0x85, 0x84, 0x5E, 0x43, 0xAF, 0x90, 0x90, 0x08, 0xE1, 0xCF,
-    0x79, 0x5C, 0x73, 0xC5, 0x9D, 0x8A, 0x65, 0xAD, 0x24, 0xDD, 0x40, 0xA2, 0x86, 0xA9, 0x63, 0xD2,
-    0x46, 0xA8, 0x03, 0xFF, 0xC4, 0xD3, 0x4C, 0xF8, 0x25, 0x88, 0xDC, 0xAF, 0xD8, 0x51, 0x1A, 0xFE,
-    0x63, 0xCD, 0x38, 0x09, 0x3E, 0xED, 0xE4, 0x52, 0xAB, 0x1A, 0x7A, 0xB7, 0x4A, 0x97, 0x8D, 0xA6,
-    0x74, 0x64, 0xC8, 0xF4, 0x02, 0x24, 0xD6, 0x37, 0xD3, 0x78, 0x9C, 0x63, 0x60, 0x38, 0xFE, 0xFF,
-    0x1C, 0x1B, 0xC3, 0x86, 0xFF, 0xFF, 0xFF, 0xB3, 0x33, 0x7C, 0x06, 0x92, 0x4C, 0x0C, 0xDF, 0xFE,
-    0x73, 0x2A, 0x30, 0x30, 0x7C, 0xFF, 0xCF, 0xC2, 0xC0, 0x50, 0xF0, 0xEF, 0xFF, 0xFF, 0x7E, 0x86,
-    0x1F, 0xFF, 0x41, 0xE4, 0xB1, 0x7F, 0xFF, 0xCF, 0xE6, 0x40, 0xC5, 0x29, 0x21, 0x01, 0x4A, 0xAE,
-    0x30, 0x92, 0x78, 0x9C, 0x63, 0x48, 0x78, 0xFD, 0xFF, 0xFF, 0xFF, 0xFB, 0x0C, 0xBF, 0x81, 0xE4,
-    0xFF, 0xF3, 0x05, 0xFF, 0xD7, 0x97, 0xFE, 0x7F, 0xCF, 0x7C, 0xE0, 0x3F, 0x2F, 0xC3, 0xF7, 0xFF,
-    0x8C, 0x0F, 0xFE, 0x73, 0x33, 0x7C, 0xF9, 0xCF, 0x02, 0xE1, 0x31, 0x25, 0xFC, 0x5F, 0x9F, 0x02,
-    0x54, 0xC8, 0xF0, 0x13, 0xA8, 0x50, 0x8F, 0x81, 0xE1, 0xD1, 0xFF, 0xFF, 0x35, 0x8C, 0x0C, 0x0C,
-    0xFF, 0x78, 0x19, 0x80, 0xC0, 0xE1, 0xBF, 0x2E, 0x88, 0x52, 0x00, 0x19, 0xD2, 0xCB, 0xC8, 0xF0,
-    0x0D, 0x44, 0xF3, 0x16, 0xFC, 0x03, 0x51, 0xF5, 0xDF, 0xDF, 0xB3, 0x30, 0x38, 0xFC, 0x5B, 0xFF,
-    0x37, 0x1F, 0xA8, 0xE0, 0xD7, 0xFC, 0x7F, 0xFD, 0x0C, 0x0C, 0x06, 0xFF, 0xE3, 0x7F, 0xFD, 0xAF,
-    0x6E, 0xFF, 0xF3, 0x9F, 0xF7, 0x22, 0x48, 0xC5, 0x7E, 0x46, 0x86, 0x6D, 0xFF, 0xDE, 0xCF, 0x61,
-    0x66, 0x00, 0x00, 0xA6, 0xB5, 0x50, 0x7D, 0x78, 0x9C, 0xFB, 0xF0, 0x9F, 0x8B, 0x01, 0x08, 0x3E,
-    0xE0, 0xA5, 0x38, 0x6F, 0xBC, 0xF7, 0x06, 0x52, 0x37, 0xFF, 0xFF, 0xFF, 0xCF, 0xF6, 0xE1, 0x3F,
-    0x08, 0xC8, 0x7F, 0xF8, 0x7F, 0x9F, 0xF9, 0xF1, 0xFF, 0xF8, 0x0F, 0xFF, 0xF5, 0x19, 0x12, 0xFE,
-    0xF7, 0x7F, 0xF8, 0xCF, 0xCB, 0x60, 0x00, 0xA2, 0xB8, 0x19, 0x14, 0x40, 0x14, 0x17, 0x69, 0x14,
-    0x00, 0xB3, 0xC1, 0x43, 0xCE, 0x78, 0x9C, 0x9B, 0xF0, 0x9E, 0xE5, 0xD3, 0x7F, 0x9E, 0x8F, 0xFF,
-    0xB9, 0x1D, 0x3A, 0x19, 0x19, 0x18, 0x18, 0x3E, 0xFC, 0xE7, 0x22, 0x12, 0x01, 0x00, 0xA7, 0x7B,
-    0x21, 0xE4, 0x78, 0x9C, 0x63, 0x60, 0xF8, 0xE9, 0xC7, 0xA0, 0xF0, 0xFF, 0x3C, 0x83, 0xC0, 0xFF,
-    0xFD, 0x0C, 0x0C, 0x53, 0x24, 0x18, 0xC0, 0xE0, 0xFF, 0x7A, 0xB2, 0xB1, 0xC2, 0xFF, 0xF5, 0x82,
-    0x13, 0xFE, 0xF7, 0xFF, 0xFC, 0xFF, 0xDF, 0x1F, 0x88, 0xB9, 0x9E, 0xFF, 0xCF, 0x61, 0x00, 0x00,
-    0x6D, 0xB0, 0x2B, 0x78, 0x78, 0x9C, 0xFB, 0xF0, 0x9F, 0x8B, 0x01, 0x04, 0x3E, 0x10, 0x41, 0x17,
-    0xFC, 0xDF, 0x0F, 0xA6, 0xBF, 0xFE, 0xE7, 0x01, 0xD1, 0x0E, 0xFF, 0xEF, 0x33, 0x82, 0xE8, 0xCF,
-    0xFF, 0xF5, 0x40, 0xF2, 0x92, 0xFF, 0xFE, 0x33, 0x83, 0xE8, 0x13, 0xFF, 0xFD, 0xC1, 0xEA, 0xFF,
-    0xFD, 0xD7, 0x07, 0xD3, 0xFF, 0xFF, 0x9F, 0x07, 0xD3, 0xF7, 0x7F, 0xFD, 0xE7, 0x00, 0xD1, 0xBC,
-    0x17, 0xFE, 0xDB, 0x83, 0xCD, 0x33, 0xF8, 0xFF, 0x1E, 0xAC, 0x9F, 0xE1, 0x07, 0x10, 0x83, 0xE8,
-    0x03, 0xFF, 0xF3, 0xC1, 0xB4, 0xC2, 0xFF, 0xFF, 0x4C, 0x00, 0x53, 0xB0, 0x44, 0x3E, 0x78, 0x9C,
-    0xFB, 0xF0, 0x9F, 0xEB, 0x03, 0x59, 0x08, 0x00, 0x50, 0x76, 0x25, 0x7C, 0x78, 0x9C, 0xFB, 0xF0,
-    0x5E, 0xE0, 0xE5, 0x7B, 0x2B, 0x86, 0x63, 0xFF, 0x6B, 0x19, 0x3E, 0xFC, 0x7F, 0xFA, 0xFF, 0xFF,
-    0xFF, 0x25, 0x40, 0xCC, 0xFD, 0xE1, 0x3F, 0x0C, 0xF8, 0x7F, 0xF8, 0x7F, 0x9E, 0xE9, 0xEB, 0xFF,
-    0xFF, 0x62, 0x07, 0xFF, 0xF7, 0x7F, 0xF8, 0x2F, 0xCF, 0x70, 0xE0, 0xFF, 0x7C, 0x06, 0x87, 0xFF,
-    0xEB, 0x3F, 0xFC, 0xE7, 0x65, 0x98, 0xF0, 0xDF, 0x9F, 0x41, 0x00, 0xC4, 0xE4, 0x66, 0x68, 0xF8,
-    0x6F, 0xCF, 0xC0, 0xF0, 0x7F, 0xFF, 0x87, 0xFF, 0x5C, 0x40, 0xA6, 0x3E, 0x75, 0x98, 0x00, 0xCB,
-    0x04, 0x59, 0x3A, 0x78, 0x9C, 0xFB, 0xF0, 0x5E, 0xE0, 0xE6, 0x7F, 0x6F, 0x86, 0x0F, 0xFF, 0x9F,
-    0xFE, 0xFF, 0xFF, 0x9F, 0xFD, 0xC3, 0x7F, 0x10, 0x90, 0xFF, 0xF0, 0xFF, 0x3C, 0xF3, 0xE5, 0xFF,
-    0xF9, 0x1F, 0xFE, 0xEB, 0x33, 0x24, 0xFC, 0xEF, 0xFF, 0xF0, 0x9F, 0x97, 0xC1, 0x00, 0x44, 0x71,
-    0x33, 0x28, 0x80, 0x28, 0x2E, 0xD2, 0x28, 0x00, 0x25, 0x86, 0x39, 0xF6, 0x78, 0x9C, 0x63, 0x70,
-    0x78, 0xF5, 0xBE, 0x86, 0x91, 0x81, 0xE1, 0xD7, 0xFF, 0xFF, 0xFF, 0xED, 0x18, 0x16, 0x00, 0xC9,
-    0xFF, 0xEF, 0x19, 0x3F, 0xFF, 0xF7, 0x53, 0xF8, 0xF5, 0x9F, 0xF3, 0xC7, 0x7F, 0x56, 0x86, 0x0B,
-    0xFF, 0xF9, 0xFF, 0xFC, 0x67, 0x60, 0x98, 0xF0, 0xDF, 0xFE, 0x2F, 0x90, 0x2A, 0xF8, 0xEF, 0x0F,
-    0xA2, 0x1A, 0xFE, 0xC7, 0xFF, 0xFE, 0xCF, 0x08, 0x12, 0xFC, 0xFE, 0x9F, 0x8D, 0xE1, 0xC1, 0x7F,
-    0xFE, 0x4F, 0xFF, 0xFD, 0x04, 0x7E, 0xFE, 0xE7, 0x6A, 0x00, 0x69, 0xFF, 0xCF, 0xC4, 0xF0, 0x13,
-    0x6C, 0x18, 0x83, 0xC3, 0xAD, 0xFF, 0x3D, 0x8C, 0x0C, 0x00, 0xF9, 0x02, 0x38, 0x4C, 0x78, 0x9C,
-    0x8D, 0x8C, 0xB1, 0x11, 0x40, 0x50, 0x14, 0x04, 0x1F, 0xA1, 0x6F, 0x46, 0x20, 0x21, 0xA2, 0x03,
-    0x3A, 0x53, 0x02, 0x9D, 0x28, 0x41, 0x09, 0x4A, 0x90, 0x49, 0x7F, 0xCA, 0x08, 0x5C, 0x22, 0x5E,
-    0xDF, 0x50, 0x80, 0x4B, 0x76, 0xE6, 0xE6, 0xF6, 0x44, 0xB4, 0x9D, 0xA5, 0x89, 0x15, 0xCE, 0x48,
-    0x3C, 0x71, 0x62, 0x8E, 0x2F, 0x1A, 0x91, 0xD9, 0x40, 0x2F, 0x52, 0x6B, 0x19, 0x45, 0x62, 0x35,
-    0x93, 0x70, 0x2F, 0xBE, 0xB2, 0x0A, 0x93, 0x4E, 0x2C, 0xF9, 0x45, 0xF5, 0xEA, 0x89, 0x38, 0xC0,
-    0x87, 0xB3, 0x72, 0xF7, 0x85, 0x3D, 0x5E, 0xC8, 0x0F, 0xDC, 0x0F, 0x58, 0x4B, 0xC5, 0x78, 0x9C,
-    0x63, 0x58, 0xF4, 0xAF, 0x37, 0xE0, 0x3F, 0x9F, 0xC1, 0xFF, 0xFF, 0xFF, 0xE7, 0xFE, 0xE7, 0xBB,
-    0xF0, 0x1F, 0x04, 0xF8, 0xBE, 0xFE, 0x8F, 0x33, 0xFC, 0xF3, 0x9F, 0xEF, 0xE7, 0x7F, 0x36, 0x86,
-    0x8F, 0xFF, 0xF9, 0xFE, 0xFC, 0x67, 0x64, 0xD8, 0xF0, 0x9F, 0xEF, 0xEF, 0x7F, 0x06, 0x86, 0x09,
-    0x70, 0xEA, 0x0F, 0x90, 0xDA, 0x00, 0x52, 0xC2, 0xC2, 0xF0, 0x00, 0xA4, 0xC1, 0x4E, 0xE0, 0x27,
-    0x5C, 0x3B, 0xC8, 0xB0, 0xD3, 0xFF, 0xF9, 0x18, 0x16, 0xFD, 0xAB, 0xBD, 0x00, 0xA4, 0x80, 0x80,
-    0x38, 0x0A, 0x00, 0x7C, 0x37, 0x47, 0x9D, 0x78, 0x9C, 0xFB, 0xF0, 0x9E, 0xE1, 0xDA, 0xFE, 0x0F,
-    0xFF, 0x17, 0xFE, 0x07, 0x12, 0xBF, 0xFF, 0xAF, 0xFF, 0xF0, 0xFF, 0xFF, 0xBC, 0x88, 0x0F, 0xFF,
-    0xD7, 0x33, 0x30, 0x7C, 0xF8, 0xCF, 0x07, 0x22, 0x78, 0x40, 0x04, 0x17, 0x21, 0x02, 0x00, 0x09,
-    0xDB, 0x24, 0xA4, 0x78, 0x9C, 0x0D, 0x8A, 0xBD, 0x0D, 0x40, 0x00, 0x18, 0x05, 0xCF, 0x4F, 0x30,
-    0x82, 0xD2, 0x1A, 0x36, 0xB0, 0x82, 0x29, 0x2C, 0xA3, 0x35, 0x0B, 0x85, 0x44, 0x21, 0xA1, 0xD3,
-    0x8A, 0x09, 0x54, 0x42, 0xC4, 0x97, 0xE7, 0x7B, 0xCD, 0x25, 0x77, 0x8F, 0x49, 0x6B, 0xC9, 0x21,
-    0x5F, 0xF8, 0x6A, 0xB1, 0x1E, 0x3B, 0x29, 0x2A, 0x3E, 0xA5, 0xC0, 0xA3, 0x33, 0x87, 0xC1, 0x63,
-    0x06, 0x9B, 0xD4, 0xBB, 0x1B, 0xA5, 0xD8, 0x71, 0x2B, 0xAD, 0xE1, 0x52, 0x62, 0xFB, 0x2C, 0x05,
-    0xE6, 0x9F, 0x86, 0xD6, 0xD4, 0x45, 0xFC, 0xC4, 0x1A, 0x2E, 0x32, 0x78, 0x9C, 0x63, 0x48, 0x78,
-    0xC7, 0xC8, 0xC0, 0xC0, 0x70, 0xE1, 0x3F, 0x88, 0xFC, 0x0C, 0x22, 0x03, 0xFE, 0xFD, 0xFF, 0xFF,
-    0x9E, 0xE1, 0xDB, 0x7F, 0x10, 0x79, 0xF4, 0xDF, 0xFF, 0xB3, 0x7B, 0x18, 0x18, 0x7E, 0x81, 0x65,
-    0x89, 0x21, 0x7F, 0xFC, 0x67, 0x77, 0x60, 0x60, 0xF8, 0x0A, 0xD4, 0x0C, 0x32, 0x13, 0x44, 0x0A,
-    0xBC, 0x7C, 0xDF, 0xCB, 0x00, 0x00, 0xF3, 0x24, 0x2C, 0xC3, 0x78, 0x9C, 0xFB, 0xF4, 0x9F, 0x93,
-    0xC1, 0xE1, 0x7F, 0xFD, 0x27, 0xD2, 0x29, 0x2E, 0x86, 0x84, 0xFF, 0xF5, 0x1F, 0xFF, 0xF3, 0x32,
-    0x6C, 0xF8, 0x5F, 0xFF, 0xE1, 0x7F, 0x3E, 0xC3, 0xF7, 0xFF, 0xF5, 0x0B, 0xFE, 0x83, 0x40, 0xBD,
-    0xC2, 0xBF, 0xFF, 0xFF, 0xFB, 0xFF, 0xD4, 0x33, 0x4C, 0xFC, 0xB7, 0x8F, 0xE5, 0x47, 0x3D, 0x00,
-    0x85, 0xF2, 0x39, 0xA0, 0x78, 0x9C, 0x1D, 0xCB, 0xCB, 0x0D, 0x82, 0x00, 0x14, 0x05, 0xD1, 0xC1,
-    0x44, 0x63, 0x34, 0x21, 0x74, 0xA0, 0x1B, 0xEB, 0xB0, 0x04, 0xED, 0xC0, 0xBD, 0x1B, 0xEC, 0x88,
-    0x0A, 0x0C, 0x76, 0x40, 0x09, 0xD0, 0x81, 0x25, 0xF8, 0x21, 0x86, 0x10, 0xC1, 0xF1, 0xE9, 0xE6,
-    0x9E, 0xCD, 0x9D, 0xD1, 0x04, 0x46, 0x93, 0xCE, 0x19, 0x6B, 0x4B, 0x1E, 0x2E, 0x39, 0xB9, 0xE3,
-    0xE2, 0x8A, 0xC6, 0x94, 0xBD, 0x07, 0x9E, 0xCE, 0xE1, 0x53, 0xD1, 0x39, 0x81, 0x5E, 0x86, 0x1A,
-    0x68, 0xDD, 0x98, 0x87, 0x8D, 0xC7, 0xB8, 0x12, 0xD1, 0xD9, 0x45, 0x98, 0x79, 0x75, 0x1A, 0xF2,
-    0xF6, 0xF6, 0x83, 0x97, 0xC5, 0xDF, 0xBB, 0xDB, 0xD8, 0x2F, 0x4D, 0xEB, 0x2E, 0xE5, 0x78, 0x9C,
-    0x0D, 0x8E, 0xBD, 0x0D, 0x82, 0x50, 0x18, 0x45, 0x2F, 0x12, 0x43, 0x0C, 0x0A, 0x23, 0x58, 0x59,
-    0xC3, 0x08, 0x6E, 0x42, 0x6B, 0xC9, 0x08, 0xF6, 0x36, 0x6E, 0xF0, 0xDC, 0x40, 0x16, 0x30, 0x71,
-    0x03, 0xDD, 0x00, 0x0B, 0x7B, 0x84, 0x04, 0xCD, 0x7B, 0xFE, 0x1C, 0xBF, 0xEE, 0x26, 0xF7, 0xE4,
-    0xDC, 0xEB, 0x89, 0xF4, 0x22, 0xD3, 0x81, 0x7C, 0x64, 0xAA, 0x37, 0x85, 0x6E, 0xA4, 0x3D, 0x33,
-    0x41, 0xA5, 0x81, 0xE4, 0xCC, 0xA2, 0x24, 0x38, 0x3D, 0x99, 0x6C, 0x59, 0xD6, 0xDC, 0x5B, 0x85,
-    0x4E, 0x25, 0x55, 0x43, 0x43, 0xF4, 0x73, 0x12, 0xEE, 0xD1, 0xD6, 0xAC, 0x0C, 0x57, 0xB8, 0x0C,
-    0xAE, 0x64, 0x43, 0x2E, 0xE3, 0xC7, 0x4A, 0xEC, 0x98, 0x4B, 0x3D, 0xBE, 0xD0, 0xE7, 0x44, 0x22,
-    0x5D, 0xF9, 0x66, 0xF2, 0x1D, 0xB1, 0xB4, 0x87, 0x54, 0x23, 0x9D, 0xA4, 0x35, 0xD6, 0x0D, 0x1C,
-    0x2D, 0xDA, 0x6C, 0x6C, 0x0F, 0xCC, 0xF5, 0x07, 0x24, 0x63, 0x52, 0x4B, 0x78, 0x9C, 0x15, 0xCB,
-    0xCB, 0x0D, 0x44, 0x60, 0x18, 0x46, 0xE1, 0xF7, 0xB7, 0x98, 0x08, 0x26, 0x51, 0x82, 0xF5, 0x6C,
-    0xE8, 0x80, 0x12, 0x74, 0x30, 0xD3, 0x81, 0x12, 0xB4, 0xA2, 0x02, 0x51, 0xC2, 0x74, 0x40, 0x07,
-    0xA2, 0x02, 0x2B, 0xD7, 0x85, 0xE3, 0xB3, 0x7A, 0x92, 0x93, 0x9C, 0x85, 0xB7, 0x7E, 0xF4, 0x6A,
-    0xA8, 0x35, 0x91, 0x2A, 0x06, 0x77, 0xE0, 0x4B, 0x2B, 0x1F, 0x46, 0x49, 0x1D, 0x23, 0xB9, 0x99,
-    0xC0, 0x93, 0xA5, 0x8D, 0xF9, 0x41, 0x27, 0x78, 0x46, 0x69, 0x3D, 0x32, 0x27, 0x5A, 0x2A, 0xF3,
-    0xE0, 0x75, 0xE1, 0x54, 0xD8, 0xBC, 0x12, 0x6A, 0xB0, 0xF9, 0xCF, 0x57, 0x3B, 0x81, 0x32, 0x66,
-    0x77, 0x03, 0xCA, 0xFA, 0x34, 0xF4, 0x78, 0x9C, 0x25, 0xCD, 0x4D, 0x0D, 0xC2, 0x40, 0x18, 0x84,
-    0xE1, 0xA1, 0x84, 0x84, 0x9F, 0xA4, 0xA9, 0x03, 0x8E, 0x5C, 0x71, 0x40, 0x1D, 0xC0, 0x1D, 0x0B,
-    0x78, 0x28, 0x0E, 0xB0, 0x80, 0x83, 0x45, 0x02, 0x12, 0x40, 0x01, 0x12, 0x08, 0x90, 0xD0, 0x1E,
-    0xCA, 0xBE, 0xCC, 0x6E, 0x4F, 0xCF, 0x1C, 0xE6, 0xFB, 0xA6, 0x67, 0x2C, 0x45, 0x46, 0x5F, 0xA6,
-    0x5A, 0x13, 0xF4, 0xA2, 0xD4, 0x91, 0xAD, 0xCE, 0x6C, 0x74, 0x73, 0xAE, 0x39, 0xE9, 0xCD, 0x4C,
-    0xFA, 0x3D, 0xD4, 0xA5, 0x6E, 0x4B, 0xE1, 0x28, 0x17, 0x57, 0x34, 0xF6, 0xC2, 0x81, 0xA5, 0xDD,
-    0x11, 0x58, 0x58, 0xC5, 0x27, 0x93, 0x64, 0x07, 0x09, 0x5F, 0x87, 0xEC, 0xD5, 0x5F, 0x07, 0xCB,
-    0xEC, 0xC7, 0x8B, 0x52, 0x55, 0x47, 0x8A, 0xDC, 0xF2, 0xD0, 0xE0, 0x3C, 0x79, 0x67, 0x9F, 0x5B,
-    0x7F, 0xB9, 0x9D, 0x3D, 0xF6, 0x78, 0x9C, 0xFB, 0xF0, 0x1F, 0x08, 0xEC, 0x3F, 0x80, 0xC9, 0x03,
-    0x77, 0xEF, 0xFE, 0xFD, 0xAF, 0xCF, 0xC0, 0xC0, 0xF0, 0xFD, 0x3F, 0x3B, 0x03, 0x83, 0xC1, 0xFF,
-    0xF3, 0x40, 0xE6, 0x85, 0xFF, 0xF2, 0x40, 0xF2, 0xE7, 0x7F, 0x56, 0x06, 0x06, 0x87, 0xFF, 0xEB,
-    0x81, 0xCC, 0x87, 0xFF, 0xE5, 0x80, 0xE4, 0xEF, 0xFF, 0x2C, 0x0C, 0x0C, 0x09, 0xFF, 0xFB, 0x81,
-    0xCC, 0x4F, 0xFF, 0xEF, 0xDF, 0xBD, 0x9B, 0xFB, 0x15, 0x64, 0x42, 0x3D, 0x84, 0x04, 0x00, 0xAB,
-    0xD6, 0x2E, 0x91, 0x78, 0x9C, 0x63, 0x60, 0x98, 0xF8, 0x97, 0x97, 0x41, 0xE0, 0xDF, 0x7F, 0x5E,
-    0x86, 0x84, 0xFF, 0xFF, 0xB9, 0x18, 0x0A, 0xFE, 0xCB, 0x31, 0x30, 0x34, 0xFC, 0xE7, 0xC6, 0x20,
-    0x2E, 0x00, 0x25, 0xA7, 0xFC, 0xFB, 0xCF, 0xCA, 0xF0, 0xEB, 0x7F, 0x0C, 0x03, 0x84, 0x98, 0x0A,
-    0xE2, 0x32, 0x5C, 0x04, 0x4A, 0x60, 0xD5, 0x01, 0x36, 0x0A, 0x6C, 0x28, 0xD8, 0x78, 0x86, 0x49,
-    0x7F, 0x79, 0x01, 0xF8, 0xAB, 0x29, 0x30, 0x78, 0x9C, 0xFB, 0x6E, 0xFF, 0x9D, 0x44, 0x08, 0x00,
-    0x0D, 0x54, 0x1E, 0x47, 0x78, 0x9C, 0x7B, 0xDF, 0xC3, 0xC8, 0xC0, 0xF0, 0xFF, 0x3F, 0x2F, 0x03,
-    0xC3, 0xDF, 0xFF, 0xF6, 0x0C, 0x0C, 0x06, 0xFF, 0xE3, 0x19, 0x18, 0x18, 0xFE, 0x61, 0x21, 0xFE,
-    0xAC, 0x07, 0x12, 0xDF, 0xFF, 0xF7, 0x30, 0x33, 0x24, 0xFC, 0xFD, 0xCF, 0xCE, 0x90, 0xF0, 0x07,
-    0x48, 0xFC, 0xF8, 0x3F, 0x97, 0x99, 0xE1, 0xEF, 0x7E, 0x90, 0x92, 0x7C, 0x0C, 0x1D, 0x60, 0xA3,
-    0xFE, 0x80, 0x0C, 0x05, 0x1B, 0xFF, 0x1E, 0x64, 0x11, 0x00, 0x88, 0xBD, 0x26, 0xE0, 0x78, 0x9C,
-    0x63, 0x60, 0x00, 0x83, 0x84, 0xBF, 0x39, 0x0C, 0x0C, 0x06, 0x4C, 0xDF, 0xFE, 0xFF, 0xB7, 0x61,
-    0x78, 0xC4, 0xFC, 0xEF, 0xCC, 0xFF, 0xFF, 0x7B, 0xFF, 0x33, 0xC7, 0x31, 0x2C, 0xFC, 0xFF, 0x7F,
-    0x3F, 0x03, 0x1B, 0x03, 0xC3, 0xE6, 0x77, 0x9C, 0x0C, 0x50, 0x00, 0x00, 0xB8, 0x63, 0x11, 0x04,
-    0x78, 0x9C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 0x9C, 0xDB, 0x78, 0x9E, 0xE9, 0xFB, 0x7F,
-    0xCE, 0x1F, 0xFF, 0xB9, 0x1E, 0xBD, 0x67, 0x66, 0x60, 0x64, 0x00, 0x82, 0x0D, 0xBB, 0x19, 0x3E,
-    0xFC, 0x67, 0xFC, 0xF8, 0x9F, 0xE9, 0xE3, 0x7F, 0xE6, 0x4F, 0xFF, 0x99, 0x3F, 0xFF, 0x67, 0xF9,
-    0xF2, 0x9F, 0xF5, 0xCB, 0x7F, 0xB6, 0xAF, 0xFF, 0xD9, 0xBE, 0xFD, 0x67, 0xFF, 0xFE, 0x9F, 0xE3,
-    0x07, 0x58, 0x3D, 0x00, 0x70, 0xEC, 0x20, 0x68, 0x78, 0x9C, 0x63, 0x60, 0x50, 0xF8, 0xCF, 0x00,
-    0x04, 0x60, 0x52, 0xE1, 0xC6, 0xFF, 0x73, 0x1A, 0x0C, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0xAF, 0x00,
-    0x24, 0xFE, 0xCB, 0x2F, 0xF8, 0x7F, 0x9E, 0x29, 0x89, 0xE3, 0xC3, 0x7F, 0x7E, 0xA0, 0xE4, 0xA7,
-    0xFF, 0x5C, 0x40, 0xF2, 0xF3, 0x7F, 0x4E, 0x38, 0xF9, 0xE9, 0x3F, 0x37, 0x90, 0xFC, 0xF0, 0x5F,
-    0x1E, 0x48, 0x02, 0x55, 0x0A, 0x3B, 0x79, 0x81, 0x75, 0xF9, 0x83, 0x4D, 0xF0, 0x67, 0x50, 0xB8,
-    0xF9, 0xFF, 0x1C, 0x1B, 0x03, 0x92, 0xF9, 0x00, 0xC3, 0x1A, 0x2D, 0x6E, 0x78, 0x9C, 0x63, 0x60,
-    0xD8, 0xFA, 0xEF, 0x9C, 0x27, 0x03, 0xC3, 0x84, 0xFF, 0x40, 0xC0, 0xC8, 0xF0, 0x05, 0x48, 0xEE,
-    0x67, 0x60, 0xF8, 0xF5, 0x5F, 0xC2, 0x11, 0x28, 0xF8, 0xE7, 0x3F, 0x03, 0x08, 0xFC, 0x79, 0x8F,
-    0x44, 0x81, 0xD4, 0xFD, 0x67, 0x87, 0x51, 0xAB, 0xFE, 0xFD, 0x5F, 0xB5, 0x8A, 0x05, 0xA1, 0xE4,
-    0x3E, 0x98, 0xFA, 0xB7, 0x1F, 0x44, 0x1A, 0xFC, 0x8F, 0x07, 0x51, 0x4F, 0xFF, 0x6B, 0x29, 0x29,
-    0x29, 0x31, 0x81, 0x35, 0xFC, 0xE7, 0x41, 0xA5, 0x00, 0x88, 0x32, 0x3E, 0x10, 0x78, 0x9C, 0x63,
-    0x60, 0x62, 0x60, 0x60, 0x60, 0xDC, 0xA0, 0x57, 0xEC, 0x7E, 0x40, 0xEF, 0xEB, 0x7F, 0x20, 0x58,
-    0xDF, 0x00, 0x22, 0x79, 0x0C, 0xFE, 0xEB, 0x34, 0xFE, 0xE7, 0x98, 0xF0, 0x9F, 0x91, 0xE1, 0x0F,
-    0xEF, 0x82, 0xFB, 0x0C, 0x0C, 0x3F, 0xF9, 0x21, 0x6C, 0x87, 0xFF, 0xDA, 0x40, 0x71, 0xB0, 0x1A,
-    0x6E, 0xB0, 0xFA, 0xF9, 0x20, 0xBD, 0x07, 0xE5, 0x18, 0xC0, 0xE6, 0x00, 0x00, 0x09, 0xCB, 0x26,
-    0xD1, 0x78, 0x9C, 0xFB, 0xF5, 0x9F, 0x89, 0x81, 0xE1, 0xEF, 0x7B, 0x86, 0x4F, 0xFF, 0x39, 0x19,
-    0x02, 0xFE, 0xE7, 0x33, 0x2C, 0xF8, 0x2F, 0xCF, 0x70, 0xE0, 0x3F, 0x2F, 0x83, 0xC2, 0xFF, 0x7A,
-    0x86, 0xCF, 0xFF, 0x59, 0x19, 0x18, 0x7E, 0xBD, 0x67, 0xF8, 0x75, 0x9F, 0x81, 0x01, 0xA8, 0x40,
-    0xF4, 0x7F, 0x3C, 0x90, 0x9E, 0xF0, 0xBF, 0xE7, 0x3F, 0x0F, 0x90, 0x16, 0xF8, 0xFF, 0xFF, 0x3F,
-    0x0B, 0x90, 0x66, 0xF8, 0xF9, 0xFF, 0x3C, 0x88, 0xFA, 0x05, 0xE4, 0xBF, 0x47, 0xA2, 0x15, 0x37,
-    0xFD, 0xD7, 0x53, 0x02, 0x49, 0x2C, 0xF8, 0xCF, 0x47, 0x8C, 0x3C, 0x94, 0x06, 0x00, 0x32, 0xD2,
-    0x3B, 0xC6, 0x78, 0x9C, 0xFB, 0x6E, 0xFF, 0x1D, 0x03, 0x32, 0xC0, 0x01, 0xA6, 0xDC, 0x77, 0x7B,
-    0x00, 0x71, 0x14, 0x18, 0x39, 0x78, 0x9C, 0x01, 0x5F, 0x00, 0xA0, 0xFF, 0x00, 0xB5, 0xFE, 0xBE,
-    0x17, 0xB0, 0xFF, 0xFF, 0xFF, 0xAF, 0xF5, 0xEF, 0x56, 0xC7, 0x3F, 0xF7, 0x8F, 0x00, 0x00, 0x02,
-    0xF5, 0xEF, 0x04, 0x00, 0x00, 0xB0, 0xFF, 0xCF, 0x06, 0x00, 0x40, 0xFF, 0xFF, 0xEF, 0x04, 0xF1,
-    0xDF, 0xD7, 0xFF, 0x3F, 0xF6, 0x4F, 0x00, 0xF7, 0xBF, 0xF7, 0x6F, 0x00, 0xE0, 0xEF, 0xF3, 0xFF,
-    0x06, 0xF1, 0xCF, 0x90, 0xFF, 0xEF, 0xFD, 0x5F, 0x00, 0xE6, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xC5,
-    0xFF, 0x6F, 0x00, 0x00, 0x00, 0xF7, 0xDF, 0x14, 0x00, 0x00, 0xF2, 0xEF, 0xFB, 0x6A, 0x65, 0xFC,
-    0x9F, 0xFB, 0xFF, 0xFF, 0xFF, 0x1D, 0x71, 0xEC, 0xFF, 0x7C, 0x00, 0x84, 0x69, 0x38, 0x30, 0x78,
-    0x9C, 0x53, 0x60, 0x66, 0x50, 0x62, 0xF8, 0xDA, 0x9F, 0xF0, 0x9F, 0xFD, 0xC7, 0xF9, 0x05, 0xFF,
-    0xB9, 0x2F, 0xC7, 0x39, 0xBC, 0x63, 0x01, 0x00, 0x51, 0xC6, 0x09, 0x04, 0x78, 0x9C, 0x63, 0x60,
-    0x50, 0x38, 0xF1, 0x7F, 0x9F, 0x38, 0x03, 0x08, 0xFC, 0xF8, 0x7F, 0xF6, 0xDF, 0x7F, 0x36, 0x20,
-    0xE3, 0xE0, 0x7D, 0x56, 0x06, 0x81, 0xE7, 0xEB, 0x81, 0xAC, 0x3F, 0x9C, 0x0D, 0x7F, 0xCF, 0xA9,
-    0xFD, 0xE6, 0x64, 0x68, 0x58, 0x2F, 0xF0, 0xF7, 0xFF, 0x7F, 0xFB, 0x03, 0xFE, 0x0C, 0x1F, 0xF9,
-    0x26, 0xFC, 0xCF, 0x9D, 0xC6, 0xAD, 0x70, 0x9F, 0xE1, 0x1B, 0xFB, 0x87, 0xFF, 0x8C, 0x40, 0x45,
-    0xBF, 0x98, 0x7F, 0x31, 0x7D, 0x01, 0xA9, 0x66, 0xF8, 0xCA, 0xF6, 0x87, 0xE1, 0x6B, 0x3F, 0x88,
-    0xF5, 0x99, 0x03, 0xC8, 0xAA, 0x87, 0xB0, 0x7E, 0x31, 0x7D, 0x9E, 0x0F, 0x91, 0x05, 0xEA, 0x78,
-    0xCF, 0x00, 0xD6, 0x01, 0x32, 0x25, 0xA7, 0x95, 0x07, 0x68, 0x0A, 0xC4, 0x64, 0xBE, 0x03, 0xF1,
-    0x50, 0xDB, 0xC4, 0x80, 0xB6, 0x21, 0xB9, 0x80, 0xE1, 0xE7, 0xFF, 0xB3, 0x7F, 0xC1, 0xAE, 0x02,
-    0xB9, 0xF4, 0x1C, 0xC8, 0xA5, 0x00, 0xDD, 0x49, 0x48, 0x71, 0x78, 0x9C, 0x01, 0x2D, 0x00, 0xD2,
-    0xFF, 0x20, 0xD8, 0xEF, 0x2B, 0x00, 0xB0, 0xFF, 0xFE, 0xEF, 0x01, 0x30, 0x16, 0x30, 0xFF, 0x05,
-    0x00, 0x62, 0x98, 0xFF, 0x07, 0x90, 0xFF, 0xEF, 0xFF, 0x08, 0xF4, 0x7F, 0x00, 0xFF, 0x08, 0xF5,
-    0x2F, 0x60, 0xFF, 0x08, 0xF2, 0xFF, 0xFE, 0xFD, 0x08, 0x50, 0xFD, 0x6D, 0xF4, 0x08, 0x18, 0xAF,
-    0x18, 0x5E, 0x78, 0x9C, 0x63, 0x60, 0xA8, 0x61, 0x60, 0xE8, 0x62, 0x64, 0x58, 0xF0, 0x9F, 0xB7,
-    0xE0, 0xBF, 0x3E, 0xC3, 0xB7, 0xFF, 0x6C, 0x5F, 0xFE, 0x73, 0x1A, 0xFC, 0x5F, 0x2F, 0xF0, 0xEF,
-    0x3C, 0xC3, 0xC3, 0xFF, 0xBC, 0x07, 0x80, 0x62, 0xBF, 0xFF, 0x33, 0xFF, 0xF8, 0xCF, 0x0A, 0xA2,
-    0x7E, 0x02, 0x29, 0xA8, 0x20, 0x54, 0x09, 0x54, 0x03, 0x4C, 0x3B, 0xC8, 0xB0, 0x59, 0x8C, 0x00,
-    0xA4, 0x1C, 0x27, 0xC0, 0x78, 0x9C, 0xFB, 0xF7, 0x1F, 0x04, 0x98, 0xFF, 0x41, 0xA8, 0x95, 0xAB,
-    0x56, 0xAD, 0xBA, 0xF5, 0x9F, 0x99, 0x01, 0x08, 0x0A, 0x70, 0x50, 0x00, 0xDE, 0x4D, 0x16, 0x44,
-    0x78, 0x9C, 0xFB, 0xF2, 0xFF, 0xBF, 0xFF, 0x17, 0x28, 0x16, 0x10, 0x14, 0x64, 0x04, 0x00, 0x6A,
-    0x0C, 0x09, 0xF7, 0x78, 0x9C, 0x63, 0x60, 0x50, 0x38, 0xF1, 0x7F, 0x9F, 0x38, 0x03, 0x08, 0xFC,
-    0xF8, 0x7F, 0xF6, 0xDF, 0x7F, 0x36, 0x20, 0xE3, 0xE0, 0x7D, 0x56, 0x06, 0x81, 0xE7, 0xEB, 0x81,
-    0xAC, 0x3F, 0x9C, 0x40, 0x42, 0xE0, 0x37, 0x27, 0x43, 0xC3, 0xFA, 0x84, 0xFF, 0xFF, 0x7B, 0x19,
-    0x0E, 0xF8, 0x33, 0x7C, 0xE4, 0x03, 0xB2, 0xFE, 0x73, 0x29, 0xDC, 0x67, 0xF8, 0xC6, 0x9E, 0xF0,
-    0x5F, 0xFD, 0x1F, 0x3F, 0xC3, 0x2F, 0xE6, 0x5F, 0x4C, 0x09, 0xFF, 0xD9, 0x7E, 0xCB, 0x33, 0x7C,
-    0x65, 0xFB, 0xC3, 0x90, 0xF0, 0xBF, 0xEA, 0x3F, 0x2F, 0xC3, 0x67, 0x0E, 0x10, 0xEB, 0xFF, 0x7D,
-    0x26, 0x20, 0x0B, 0x24, 0xFB, 0xE7, 0x3C, 0x03, 0x50, 0x16, 0xA4, 0xA3, 0xEC, 0x3F, 0x3B, 0x50,
-    0x07, 0xC8, 0x14, 0xB6, 0x3F, 0xF6, 0x40, 0x53, 0x40, 0x26, 0xB3, 0x7D, 0xBA, 0x7F, 0x30, 0x1E,
-    0xC9, 0x36, 0x24, 0x17, 0x30, 0xFC, 0xFC, 0x7F, 0xF6, 0x2F, 0xD8, 0x55, 0x20, 0x97, 0x9E, 0x03,
-    0xB9, 0x14, 0x00, 0xDB, 0x05, 0x4B, 0x9B, 0x78, 0x9C, 0x2B, 0x28, 0x07, 0x01, 0xF7, 0x8F, 0xFF,
-    0x41, 0x60, 0x3E, 0x94, 0x02, 0x00, 0x9B, 0x55, 0x10, 0x21, 0x78, 0x9C, 0x63, 0x78, 0x71, 0x9F,
-    0x8D, 0xE1, 0xC2, 0xFF, 0xFF, 0xF3, 0x19, 0x7E, 0xF4, 0x6F, 0xFD, 0xCF, 0xFC, 0x87, 0x93, 0xE1,
-    0x1F, 0xC7, 0x5F, 0x4E, 0x86, 0xBF, 0x1C, 0x3F, 0x41, 0xDC, 0x8B, 0x20, 0x09, 0x81, 0x97, 0x40,
-    0x25, 0x00, 0xBA, 0x40, 0x15, 0x1A, 0x78, 0x9C, 0x63, 0x60, 0x38, 0x14, 0xC3, 0x00, 0x02, 0x9F,
-    0xEB, 0x71, 0x51, 0xFF, 0xFE, 0x83, 0x00, 0x33, 0x94, 0x5A, 0xB9, 0xEA, 0xF7, 0xFD, 0x55, 0xAB,
-    0x98, 0xF0, 0x69, 0x60, 0x60, 0x48, 0x54, 0x03, 0x12, 0x2B, 0x57, 0x81, 0x00, 0x13, 0xAA, 0x76,
-    0x00, 0xA3, 0x55, 0x2D, 0xA6, 0x78, 0x9C, 0x13, 0xB8, 0xF9, 0x5E, 0x92, 0xE1, 0xD3, 0xFF, 0xFF,
-    0xE7, 0x19, 0x16, 0xF4, 0x3F, 0xFF, 0xCF, 0xC4, 0xC0, 0xB4, 0xE1, 0x3F, 0x33, 0x03, 0xC3, 0xC7,
-    0xF7, 0x0C, 0x0C, 0x0C, 0x7F, 0xE2, 0x19, 0x18, 0x0E, 0xFC, 0x67, 0x67, 0x10, 0xF8, 0x93, 0xCF,
-    0xC0, 0x70, 0xF0, 0x7F, 0x4D, 0x39, 0xF3, 0xD7, 0xFF, 0xFF, 0xFF, 0x73, 0x82, 0x09, 0x00, 0xDF,
-    0xE2, 0x1B, 0xA4, 0x78, 0x9C, 0x01, 0x37, 0x00, 0xC8, 0xFF, 0x20, 0xE9, 0xEF, 0x19, 0x00, 0xE0,
-    0xFF, 0xFF, 0xCF, 0x00, 0x60, 0x4B, 0xB2, 0xFF, 0x01, 0x00, 0x00, 0xC1, 0xDF, 0x00, 0x00, 0xFA,
-    0xFF, 0x19, 0x00, 0x00, 0xF9, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0x02, 0x00, 0x00, 0x40,
-    0xFF, 0x06, 0xC4, 0x15, 0xA2, 0xFF, 0x05, 0xF4, 0xFF, 0xFF, 0xDF, 0x00, 0x70, 0xEC, 0xDF, 0x19,
-    0x00, 0xCF, 0xAA, 0x19, 0xAF, 0x78, 0x9C, 0x63, 0xF8, 0xF6, 0x9F, 0xC7, 0xE0, 0xFF, 0x7A, 0x86,
-    0x87, 0xFF, 0xD9, 0x19, 0xFE, 0xF8, 0x31, 0x30, 0x00, 0x00, 0x44, 0x18, 0x07, 0x11, 0x78, 0x9C,
-    0xFB, 0xF0, 0x9F, 0x8B, 0x41, 0xE1, 0x7F, 0xFF, 0x07, 0x92, 0x28, 0x03, 0x10, 0xC5, 0xCD, 0x10,
-    0x00, 0xA2, 0xF8, 0x18, 0x16, 0x80, 0xA8, 0x7A, 0x86, 0xEF, 0x20, 0x0A, 0x04, 0xC0, 0xD4, 0xFA,
-    0x5F, 0x40, 0x6A, 0xD6, 0x7B, 0xCE, 0x6F, 0x60, 0x0D, 0x40, 0x40, 0x04, 0x05, 0x00, 0x71, 0x78,
-    0x47, 0xBA, 0x78, 0x9C, 0x63, 0x58, 0xF4, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0E, 0xFF, 0x41, 0xC0,
-    0xFF, 0x01, 0x90, 0x98, 0x7F, 0xDD, 0xFF, 0x0B, 0x88, 0xBD, 0xC1, 0xFF, 0x07, 0x84, 0xFA, 0x89,
-    0x42, 0x41, 0x05, 0xBF, 0x42, 0xA8, 0x0F, 0x10, 0x2A, 0x00, 0x42, 0x31, 0x6C, 0xF9, 0xF7, 0x0F,
-    0x44, 0x31, 0x30, 0x6C, 0xA0, 0x9C, 0x02, 0x00, 0x12, 0xA9, 0x51, 0x66, 0x78, 0x9C, 0x3B, 0x78,
-    0x9E, 0xE9, 0xFB, 0x7F, 0xCE, 0x1F, 0xFF, 0xB9, 0x1E, 0xBD, 0x67, 0x66, 0x60, 0x64, 0x00, 0x00,
-    0x48, 0xA8, 0x07, 0x68, 0x78, 0x9C, 0x53, 0xF8, 0xCF, 0xC2, 0xB0, 0xE0, 0xBF, 0x2D, 0x03, 0xC3,
-    0xD7, 0xF7, 0x0C, 0x8A, 0x0F, 0xFF, 0x33, 0x7C, 0xFF, 0x7F, 0x9E, 0xE1, 0xE9, 0x7B, 0x29, 0x06,
-    0x00, 0x88, 0xCA, 0x0B, 0x98, 0x78, 0x9C, 0x63, 0xD8, 0xF8, 0x9F, 0xC9, 0xE0, 0xDF, 0x7F, 0xA6,
-    0xAF, 0xFF, 0xFF, 0x33, 0x7D, 0xDB, 0x09, 0x64, 0x1F, 0xF8, 0xCF, 0xC4, 0x80, 0x03, 0x03, 0x00,
-    0x0D, 0x8B, 0x15, 0xFE, 0x78, 0x9C, 0x63, 0x38, 0xFA, 0x5F, 0x8B, 0x21, 0xE1, 0xFF, 0xFF, 0xF7,
-    0x4C, 0x0F, 0xF6, 0x1B, 0xFE, 0xE3, 0xFA, 0xEC, 0xCF, 0xF0, 0x93, 0xEF, 0x8B, 0x3D, 0xC3, 0x0F,
-    0x7E, 0x30, 0xEB, 0xC1, 0x7E, 0xC5, 0x7F, 0x5C, 0x01, 0xFF, 0xFF, 0xFF, 0x67, 0x62, 0x38, 0xFA,
-    0x5F, 0x9B, 0x01, 0x00, 0x18, 0x60, 0x16, 0xE8, 0x78, 0x9C, 0x0B, 0xD0, 0x61, 0x70, 0xB0, 0x61,
-    0x60, 0xF8, 0x7D, 0x9E, 0xE1, 0xC7, 0x7B, 0x46, 0x86, 0xCF, 0xFF, 0x39, 0x1F, 0xFE, 0xE7, 0x61,
-    0x28, 0xF8, 0x9F, 0xEF, 0xF0, 0xBF, 0x1F, 0x28, 0xFA, 0x9F, 0xF9, 0xC7, 0x7F, 0x56, 0x86, 0x87,
-    0xFF, 0x79, 0x0F, 0xFC, 0xD7, 0x87, 0x51, 0x10, 0x41, 0xB0, 0x92, 0xF9, 0x30, 0x0D, 0x50, 0xED,
-    0x01, 0x10, 0xC3, 0x00, 0xBE, 0xB5, 0x28, 0x33, 0x78, 0x9C, 0x63, 0x48, 0xF8, 0xCF, 0xC9, 0xC0,
-    0x50, 0xF0, 0x9F, 0x9D, 0x81, 0x81, 0xE1, 0x27, 0x88, 0xF9, 0xF1, 0x3E, 0x90, 0x75, 0xF0, 0x3F,
-    0x88, 0xF9, 0x33, 0x1E, 0xC8, 0xBC, 0x98, 0x07, 0x64, 0x2A, 0xFC, 0xE7, 0x01, 0x32, 0x15, 0x02,
-    0x81, 0xCC, 0x05, 0xFF, 0x99, 0x81, 0x4C, 0x86, 0x00, 0x20, 0xF3, 0xF3, 0x7E, 0x06, 0x18, 0xF3,
-    0x8F, 0x3E, 0x8C, 0x09, 0x44, 0x06, 0xFF, 0xF9, 0xC1, 0xCC, 0x0B, 0xFF, 0x19, 0x2F, 0x40, 0x99,
-    0xDF, 0xEA, 0x19, 0x7E, 0x40, 0x99, 0xFF, 0xF8, 0x0C, 0xCE, 0xFF, 0xE5, 0x07, 0xA9, 0x6E, 0xF8,
-    0xCF, 0x76, 0xC0, 0xFF, 0x1F, 0x98, 0x09, 0xB4, 0xF5, 0x3B, 0x17, 0x84, 0xF9, 0xD3, 0x5F, 0xE1,
-    0x3D, 0x23, 0x98, 0xA9, 0xF0, 0x9F, 0x7B, 0xC2, 0x7F, 0x20, 0xE0, 0x60, 0x60, 0xD8, 0xF0, 0x9F,
-    0x19, 0xC6, 0xFC, 0xB2, 0x1E, 0xA4, 0x0A, 0xAC, 0x00, 0x62, 0x2B, 0x90, 0x09, 0x00, 0x00, 0x18,
-    0x44, 0xF0, 0x78, 0x9C, 0x63, 0x48, 0xF8, 0xCF, 0xC9, 0xC0, 0x50, 0xF0, 0x9F, 0x9D, 0x81, 0x81,
-    0xE1, 0x27, 0x88, 0xF9, 0xF1, 0x3E, 0x90, 0x75, 0xF0, 0x3F, 0x88, 0xF9, 0x33, 0x1E, 0xC8, 0xBC,
-    0x98, 0x07, 0x64, 0x2A, 0xFC, 0xE7, 0x01, 0x32, 0x15, 0x02, 0x81, 0xCC, 0x05, 0xFF, 0x99, 0x81,
-    0x4C, 0x86, 0x00, 0x20, 0xF3, 0xF3, 0x7E, 0x06, 0x18, 0xF3, 0x8F, 0x3E, 0x8C, 0x09, 0x44, 0xC7,
-    0xDE, 0xFB, 0x80, 0x99, 0x17, 0xFE, 0x6F, 0xFC, 0xFF, 0x1F, 0xA8, 0x1C, 0xC8, 0xFC, 0x56, 0xEF,
-    0xB0, 0xFF, 0xD8, 0x7F, 0x0E, 0x10, 0xF3, 0x1F, 0x1F, 0x03, 0x33, 0x48, 0x0B, 0x03, 0x43, 0xC3,
-    0x7F, 0x36, 0x06, 0xA0, 0x79, 0xAC, 0x0C, 0x50, 0x5B, 0xBF, 0x83, 0xCD, 0xFB, 0xE9, 0x0F, 0x72,
-    0x0F, 0xD8, 0xBE, 0xFF, 0xDC, 0x30, 0xC1, 0x0D, 0x40, 0x63, 0x0A, 0xFE, 0xD7, 0x97, 0x03, 0x35,
-    0x7C, 0x59, 0xCF, 0xC0, 0xF0, 0x01, 0x68, 0x2E, 0x3F, 0x03, 0xD8, 0x56, 0x30, 0x13, 0x00, 0x57,
-    0x60, 0x47, 0x00, 0x78, 0x9C, 0x2D, 0xCA, 0xBD, 0x0D, 0x82, 0x50, 0x00, 0x04, 0xE0, 0x53, 0xF1,
-    0x19, 0x4D, 0xB4, 0x30, 0xF6, 0x52, 0xD9, 0xE2, 0x06, 0xB0, 0x81, 0x23, 0xB0, 0x02, 0x03, 0x98,
-    0xA8, 0xAD, 0x0D, 0x6E, 0xA0, 0x1B, 0xD8, 0x58, 0x03, 0x1B, 0x80, 0x13, 0xA8, 0x13, 0xBC, 0x44,
-    0xC2, 0x8F, 0x21, 0xBC, 0xF3, 0xF1, 0xF4, 0xAA, 0xEF, 0x72, 0x17, 0xB4, 0xD1, 0x00, 0x38, 0x71,
-    0x88, 0x0F, 0xE9, 0x00, 0xEF, 0x14, 0xB8, 0xAF, 0xCA, 0x1D, 0xD0, 0xB8, 0xD0, 0xA9, 0x5C, 0xAC,
-    0x39, 0x01, 0x3C, 0x3E, 0x2C, 0x24, 0xEC, 0x43, 0x57, 0xDD, 0x8B, 0x73, 0x37, 0xA2, 0x08, 0xD1,
-    0x2E, 0x8D, 0x9E, 0x69, 0xC0, 0x51, 0x46, 0xB1, 0x9D, 0x17, 0xF1, 0x4B, 0xA2, 0xA6, 0x50, 0xE4,
-    0xA6, 0xF6, 0x6D, 0x52, 0xDC, 0x54, 0xB4, 0xE0, 0x34, 0xB9, 0x52, 0xE8, 0xE3, 0x85, 0x56, 0x75,
-    0x34, 0xCA, 0x63, 0x5B, 0x1E, 0x8C, 0x1A, 0x27, 0xF1, 0xF7, 0x9D, 0x3C, 0x8E, 0x73, 0x92, 0x12,
-    0xC8, 0xD8, 0xFB, 0xAB, 0x0C, 0xF5, 0xC3, 0xAC, 0x6A, 0xF6, 0xD3, 0x17, 0x3A, 0x01, 0x4F, 0x90,
-    0x78, 0x9C, 0x63, 0x60, 0x28, 0x78, 0xC7, 0xC6, 0xC0, 0xC0, 0xF0, 0xF1, 0x3F, 0x3F, 0x9C, 0x5C,
-    0xF0, 0x9F, 0x13, 0x48, 0x32, 0x08, 0x32, 0xC0, 0x41, 0xC3, 0x7F, 0x6E, 0xB0, 0x38, 0x17, 0x90,
-    0xFC, 0xF2, 0x9F, 0x9D, 0x81, 0x21, 0xE1, 0xFF, 0x7B, 0x46, 0x06, 0x86, 0x1F, 0xFF, 0xF5, 0x40,
-    0xCC, 0xFB, 0x40, 0xE6, 0x83, 0xFF, 0xB2, 0x40, 0xB9, 0x4F, 0xFF, 0x41, 0x66, 0x7D, 0xFE, 0xCF,
-    0xCA, 0xC0, 0xC0, 0xF8, 0xF1, 0xBF, 0x8E, 0xC0, 0x56, 0xF9, 0x0D, 0xFF, 0x81, 0xA0, 0x5F, 0xE0,
-    0x2F, 0x90, 0x5C, 0xCF, 0x50, 0xF0, 0xE6, 0x7D, 0x0F, 0x13, 0x00, 0x33, 0x80, 0x28, 0xB4, 0x78,
-    0x9C, 0x55, 0xCE, 0x5B, 0x0D, 0xC2, 0x40, 0x10, 0x85, 0xE1, 0x13, 0x2E, 0xE1, 0x5E, 0xAA, 0x80,
-    0x92, 0x2A, 0x20, 0x18, 0xC0, 0x42, 0x1D, 0x2C, 0x0E, 0xC0, 0x01, 0x12, 0xC0, 0x01, 0x75, 0x50,
-    0x0B, 0x38, 0xC0, 0x02, 0xC1, 0x40, 0x1B, 0x02, 0x34, 0x14, 0xCA, 0xCF, 0xEE, 0xF6, 0x89, 0xF3,
-    0x72, 0xBE, 0x87, 0x99, 0xC9, 0x48, 0x2F, 0x86, 0xF2, 0xD9, 0xB2, 0x69, 0xA0, 0x07, 0xED, 0x06,
-    0xF3, 0x7A, 0xA6, 0xFF, 0x7C, 0x89, 0x7C, 0x2F, 0x60, 0xE7, 0x71, 0x80, 0xB3, 0xC7, 0x85, 0x8A,
-    0x96, 0xC3, 0x9D, 0x2B, 0x7D, 0x87, 0x2A, 0x4F, 0x99, 0x38, 0x70, 0x4C, 0x58, 0xD9, 0x4E, 0x30,
-    0x21, 0x7B, 0x8B, 0x94, 0xA9, 0x3E, 0xB9, 0x45, 0xC1, 0x58, 0x25, 0x1D, 0xE9, 0x49, 0x4F, 0x37,
-    0x06, 0xD2, 0x1B, 0x97, 0x40, 0xA1, 0x6F, 0x8C, 0xD6, 0x0D, 0x32, 0x9D, 0x30, 0x71, 0xBC, 0x04,
-    0x3B, 0x17, 0xB8, 0xEB, 0x74, 0x4B, 0xB7, 0x60, 0xBF, 0x1D, 0xD5, 0xFE, 0xE1, 0x82, 0xE8, 0x07,
-    0x77, 0x5A, 0x50, 0x90, 0x78, 0x9C, 0x5D, 0x8E, 0xC9, 0x0D, 0x82, 0x50, 0x14, 0x45, 0x6F, 0x1C,
-    0xA2, 0x46, 0x45, 0x3A, 0x20, 0x61, 0x6F, 0x62, 0x6C, 0xC0, 0x16, 0xE8, 0x00, 0x3A, 0xB1, 0x04,
-    0xED, 0x40, 0x3A, 0xA0, 0x05, 0x3B, 0x90, 0x12, 0x8C, 0x0D, 0x60, 0x9C, 0x88, 0x38, 0x1C, 0xFF,
-    0x7F, 0xEC, 0xBC, 0x9B, 0x73, 0xF2, 0xF2, 0x26, 0x49, 0x2A, 0x49, 0x65, 0x79, 0xD2, 0x33, 0x66,
-    0xCC, 0xDB, 0xC2, 0xB5, 0xD0, 0x5F, 0xBE, 0x44, 0xC6, 0x05, 0xAC, 0x4D, 0xB6, 0x70, 0x30, 0x39,
-    0xD2, 0xD0, 0xF1, 0x72, 0xE3, 0xC4, 0xD0, 0x4B, 0x53, 0xE5, 0x4C, 0xBD, 0xB0, 0x4B, 0x58, 0x39,
-    0x26, 0xA4, 0x21, 0x1B, 0x27, 0x39, 0x33, 0xBD, 0x2B, 0x27, 0x67, 0x26, 0xAA, 0xFD, 0xD5, 0x07,
-    0x03, 0x5D, 0x18, 0x49, 0x2F, 0x7C, 0x02, 0x85, 0x46, 0xF7, 0x59, 0xD6, 0x4A, 0xA1, 0x3D, 0x69,
-    0x1C, 0x2F, 0xC1, 0xF5, 0x05, 0x7E, 0x3B, 0xFD, 0xDA, 0x0F, 0xE8, 0xCE, 0xF8, 0x43, 0xD7, 0x96,
-    0x45, 0x3F, 0xA3, 0x15, 0x50, 0xD6, 0x78, 0x9C, 0x55, 0x8D, 0xCD, 0x11, 0xC1, 0x50, 0x18, 0x45,
-    0xAF, 0xBF, 0xC1, 0x20, 0xD2, 0x41, 0x66, 0xD2, 0x00, 0xA3, 0x01, 0x2D, 0xA4, 0x83, 0xA7, 0x04,
-    0x1D, 0x28, 0x81, 0x0E, 0x44, 0x05, 0x4A, 0xA0, 0x83, 0x94, 0xC0, 0x58, 0xD8, 0xC6, 0x18, 0xC4,
-    0x84, 0x38, 0xDE, 0x7B, 0x56, 0xEE, 0xE6, 0x9C, 0xC5, 0x77, 0xEF, 0x27, 0xA9, 0x62, 0x24, 0x97,
-    0x14, 0x0E, 0x35, 0x27, 0xCF, 0x6C, 0x43, 0xDF, 0x72, 0x4E, 0x47, 0xE7, 0x9D, 0xFE, 0xF2, 0x21,
-    0xF2, 0x1C, 0xC3, 0xC2, 0xCB, 0x0A, 0x32, 0x2F, 0x47, 0x4A, 0xEA, 0x4E, 0x6E, 0x9C, 0x6C, 0xD1,
-    0xA6, 0xCC, 0x53, 0x06, 0x4E, 0x58, 0x27, 0x4C, 0x2D, 0x13, 0x4C, 0xC8, 0xD2, 0xBF, 0x1A, 0xEA,
-    0x9D, 0x5B, 0xB9, 0xD8, 0x47, 0x05, 0x4D, 0xE9, 0x41, 0x5B, 0x57, 0xBA, 0xD2, 0x0B, 0x97, 0x40,
-    0xA1, 0x27, 0x46, 0xB3, 0x9F, 0x6C, 0xB5, 0xC7, 0xC4, 0xF1, 0x04, 0xEC, 0x5D, 0xE0, 0xD6, 0x69,
-    0x15, 0xAE, 0xA0, 0x3B, 0xBD, 0x8A, 0x86, 0x1F, 0x8B, 0xBE, 0x2F, 0xA7, 0x55, 0xB6, 0x78, 0x9C,
-    0x55, 0x8E, 0xBD, 0x0D, 0x82, 0x60, 0x14, 0x45, 0x6F, 0xFC, 0x37, 0x2A, 0xB2, 0x01, 0x09, 0x13,
-    0x18, 0x17, 0xD0, 0x11, 0xD8, 0x00, 0x37, 0x71, 0x04, 0xDC, 0x00, 0x9D, 0xC0, 0xD6, 0xD2, 0xC2,
-    0x9E, 0x11, 0x30, 0x56, 0x76, 0x18, 0xA3, 0x92, 0xE0, 0xCF, 0xF1, 0xE3, 0x59, 0x79, 0x9A, 0x7B,
-    0x8A, 0xFB, 0x6E, 0x9E, 0xB4, 0xC9, 0x3B, 0xF3, 0x54, 0x8E, 0x8A, 0xFC, 0x1C, 0xBB, 0xF4, 0xD9,
-    0xC1, 0xC8, 0x49, 0x94, 0xE8, 0x90, 0x35, 0xF4, 0xC7, 0x87, 0xC0, 0x72, 0x02, 0x4B, 0x93, 0x15,
-    0x64, 0x26, 0x47, 0x2A, 0xAC, 0x7C, 0xE3, 0x44, 0xCF, 0x06, 0x8B, 0xB5, 0xED, 0x88, 0x34, 0x62,
-    0x56, 0x0F, 0x12, 0xFB, 0x24, 0x4E, 0xD6, 0x8C, 0xF5, 0x2A, 0x9C, 0x5C, 0x18, 0xAA, 0xA4, 0x25,
-    0x3D, 0xE8, 0xEA, 0x4A, 0x5F, 0x7A, 0x52, 0xE3, 0xB9, 0x2F, 0x8C, 0x58, 0x8B, 0x9F, 0x6C, 0xB5,
-    0x27, 0x0E, 0xC3, 0x29, 0xB8, 0x9E, 0x67, 0xEF, 0xB6, 0xCB, 0xFA, 0x40, 0x77, 0x06, 0x6F, 0x9A,
-    0x36, 0x16, 0x7C, 0x01, 0xA9, 0x00, 0x56, 0x48, 0x78, 0x9C, 0x6D, 0x8D, 0xED, 0x0D, 0xC1, 0x60,
-    0x18, 0x45, 0x6F, 0x54, 0x83, 0xA0, 0xBA, 0x41, 0xA5, 0x13, 0x34, 0x5D, 0xC0, 0x0A, 0xDD, 0xA0,
-    0x36, 0x30, 0x82, 0x11, 0x74, 0x03, 0xDD, 0xC0, 0x0A, 0x36, 0x90, 0x58, 0x80, 0x18, 0x40, 0x45,
-    0x50, 0xA9, 0x8F, 0xE3, 0x7D, 0xDF, 0xFE, 0x75, 0xFF, 0xDC, 0xF3, 0xE3, 0x79, 0xCE, 0x95, 0xA6,
-    0x9E, 0x52, 0xD9, 0xDC, 0xD6, 0x19, 0x7D, 0x0B, 0xCF, 0x43, 0xC1, 0xC8, 0xC2, 0x7E, 0x91, 0x9C,
-    0x7D, 0xFD, 0xCF, 0x97, 0xC8, 0x75, 0x02, 0x4B, 0x07, 0x05, 0xEC, 0x1C, 0x1C, 0x69, 0xE8, 0x38,
-    0x21, 0xA7, 0x56, 0xD8, 0x54, 0x25, 0x63, 0x0B, 0x98, 0x89, 0x99, 0xE9, 0x8C, 0x3C, 0x64, 0x65,
-    0xA0, 0x64, 0xA2, 0x77, 0x65, 0xE0, 0x62, 0x16, 0x6B, 0xBA, 0xD2, 0x83, 0x9E, 0xAE, 0x0C, 0xA4,
-    0x17, 0x36, 0x81, 0x42, 0xD7, 0xE4, 0x9A, 0xB7, 0xB0, 0xD1, 0x96, 0x3C, 0x8E, 0x53, 0x30, 0x77,
-    0x81, 0xB5, 0xE3, 0xD7, 0xF6, 0x41, 0x77, 0x86, 0x1F, 0x3C, 0x27, 0x8B, 0x7E, 0x1C, 0xD2, 0x52,
-    0x93, 0x78, 0x9C, 0x25, 0x8E, 0xDD, 0x0D, 0x01, 0x41, 0x14, 0x85, 0x6F, 0xFC, 0x04, 0xC1, 0x9A,
-    0x44, 0x01, 0x64, 0x2B, 0x10, 0x0D, 0xD8, 0x12, 0xA6, 0x83, 0xD1, 0x81, 0x12, 0x56, 0x07, 0x74,
-    0x60, 0x3B, 0xD8, 0x16, 0x74, 0xE0, 0xD1, 0xAB, 0x68, 0x60, 0x44, 0xFC, 0x24, 0x8B, 0x7C, 0x66,
-    0xEE, 0x9C, 0x97, 0xF3, 0x3D, 0x9C, 0x73, 0xEE, 0x15, 0x11, 0x33, 0x95, 0xA4, 0x37, 0x03, 0xF5,
-    0xB9, 0x3F, 0x6F, 0x14, 0x6C, 0x59, 0xD4, 0x0A, 0x45, 0xBD, 0xDD, 0xA5, 0x0C, 0xAC, 0xD4, 0x17,
-    0x50, 0x2A, 0xEC, 0xE1, 0xA4, 0x70, 0xA1, 0xA1, 0x15, 0xE1, 0xC1, 0x95, 0x7E, 0x84, 0xC6, 0x57,
-    0x8C, 0xB5, 0x74, 0xB0, 0x5A, 0xB3, 0x38, 0x43, 0x1C, 0xAA, 0x98, 0xC8, 0xD7, 0x07, 0xB8, 0x31,
-    0x0A, 0x67, 0x3B, 0x22, 0x2F, 0x7A, 0x72, 0x8F, 0xF7, 0x3F, 0x44, 0x65, 0x62, 0xD4, 0x71, 0xB2,
-    0x4E, 0x50, 0xCB, 0x11, 0x97, 0xE7, 0x4B, 0x08, 0xB9, 0x2C, 0xAE, 0xD3, 0x4D, 0x0F, 0x3F, 0x19,
-    0xFE, 0x68, 0xEB, 0xD8, 0xEC, 0x0F, 0x10, 0x8F, 0x51, 0xD2, 0x78, 0x9C, 0x4D, 0xCD, 0xC1, 0x0D,
-    0x40, 0x40, 0x14, 0x04, 0xD0, 0x71, 0x10, 0x2E, 0x0E, 0x5B, 0x81, 0xE4, 0x57, 0xA0, 0x03, 0x25,
-    0x50, 0x8A, 0x50, 0x80, 0x12, 0xB6, 0x04, 0x3A, 0xD0, 0x8A, 0x4E, 0x24, 0x12, 0x89, 0x83, 0x64,
-    0x7C, 0x7E, 0xAC, 0x9D, 0xD3, 0xBB, 0xCC, 0x0C, 0x80, 0x8A, 0x96, 0x14, 0xC0, 0x1C, 0x79, 0x8F,
-    0x7C, 0x72, 0xA0, 0x77, 0xCE, 0x29, 0xC1, 0xA9, 0xE5, 0x88, 0x37, 0x1D, 0xEB, 0xE0, 0x95, 0x45,
-    0xF0, 0xC1, 0xAC, 0x7D, 0xAA, 0x9B, 0xFA, 0x62, 0xF2, 0xB9, 0xE2, 0x82, 0xCF, 0x33, 0x1B, 0xB5,
-    0x6D, 0xDA, 0x93, 0x75, 0xCF, 0xC8, 0xFC, 0xDD, 0x71, 0x12, 0xE9, 0xE9, 0x45, 0x44, 0x9F, 0x4A,
-    0xD8, 0x0E, 0xD3, 0x83, 0x79, 0xB0, 0x3E, 0x05, 0xDF, 0x17, 0x42, 0x6C, 0xE4, 0x78, 0x9C, 0x63,
-    0x60, 0x48, 0x78, 0xFD, 0x7F, 0x2D, 0x2B, 0x03, 0x83, 0xC1, 0xBF, 0xFF, 0xFF, 0xFF, 0xDF, 0x67,
-    0x60, 0xF8, 0x0A, 0xA4, 0xFE, 0xF7, 0x33, 0x08, 0xFC, 0xFB, 0x1F, 0x63, 0x7C, 0x4C, 0x9F, 0x61,
-    0xC1, 0xFF, 0xFD, 0x0C, 0x0C, 0x0C, 0x4C, 0x0C, 0x1F, 0xFE, 0xCB, 0x33, 0x80, 0xC0, 0x97, 0xFF,
-    0x5C, 0x60, 0xFA, 0xFB, 0x7F, 0x76, 0x30, 0xFD, 0xE3, 0x3F, 0x2B, 0x0A, 0xFD, 0xFD, 0x3F, 0x1B,
-    0x98, 0xFE, 0xFA, 0x9F, 0x13, 0x4C, 0x7F, 0xFC, 0xCF, 0x07, 0xA6, 0x0F, 0xFC, 0x9F, 0x0F, 0xA6,
-    0x1D, 0xFE, 0xFF, 0x8F, 0x36, 0x6A, 0x8D, 0x65, 0x60, 0xF8, 0x09, 0xB2, 0x27, 0x9F, 0x81, 0xA1,
-    0x01, 0x4A, 0x33, 0x34, 0xBD, 0x79, 0xBF, 0x16, 0x6C, 0xC6, 0x0F, 0x88, 0x0E, 0x01, 0xA8, 0x0E,
-    0x86, 0x85, 0xFF, 0x39, 0x40, 0x94, 0x42, 0x22, 0xC4, 0xEA, 0x0B, 0xFF, 0x21, 0x56, 0x2C, 0xF8,
-    0x5F, 0x0B, 0x24, 0x01, 0x01, 0xC4, 0x41, 0xAE, 0x78, 0x9C, 0x6B, 0xF8, 0xBF, 0x9E, 0x01, 0x08,
-    0xBE, 0xFF, 0x67, 0x03, 0x92, 0x0E, 0xFF, 0xEC, 0x41, 0x9C, 0x43, 0xEF, 0x19, 0x19, 0x20, 0xE0,
-    0xCF, 0x7F, 0x20, 0xE0, 0x40, 0x25, 0x05, 0x05, 0x05, 0x81, 0xE2, 0x10, 0x59, 0x64, 0x12, 0x08,
-    0x18, 0x51, 0x49, 0x5C, 0x2A, 0x95, 0x94, 0x94, 0x18, 0x31, 0x4D, 0x06, 0x00, 0x80, 0xE6, 0x46,
-    0xE5, 0x78, 0x9C, 0x63, 0x60, 0x70, 0xF8, 0x7F, 0x9F, 0x91, 0x81, 0xE1, 0xE1, 0x7F, 0x69, 0x06,
-    0x06, 0x86, 0x3F, 0xF3, 0x81, 0xC4, 0x82, 0xFF, 0xAC, 0x0C, 0x50, 0xF0, 0xE7, 0x3F, 0x10, 0x70,
-    0xA0, 0x92, 0x82, 0x82, 0x82, 0x40, 0x71, 0x88, 0x2C, 0x32, 0x09, 0x04, 0x8C, 0xA8, 0x24, 0x2E,
-    0x95, 0x4A, 0x4A, 0x4A, 0x8C, 0x98, 0x26, 0x03, 0x00, 0x7A, 0x87, 0x46, 0xE5, 0x78, 0x9C, 0x63,
-    0xF8, 0xF4, 0xFF, 0x3D, 0x23, 0x03, 0xC3, 0xDF, 0xFF, 0xFF, 0xB9, 0x19, 0x36, 0xFC, 0x97, 0xFA,
-    0xB3, 0x9E, 0xE1, 0x57, 0x3E, 0x43, 0xC3, 0x7F, 0x0E, 0x06, 0x30, 0xF8, 0xF3, 0x1F, 0x08, 0x38,
-    0x50, 0x49, 0x41, 0x41, 0x41, 0xA0, 0x38, 0x44, 0x16, 0x99, 0x04, 0x02, 0x46, 0x54, 0x12, 0x97,
-    0x4A, 0x25, 0x25, 0x25, 0x46, 0x4C, 0x93, 0x01, 0xEB, 0x23, 0x4B, 0xD7, 0x78, 0x9C, 0x63, 0x50,
-    0x62, 0x50, 0x60, 0x62, 0x48, 0xF8, 0xCF, 0xFE, 0x3D, 0x9F, 0x61, 0xC1, 0x7F, 0xEE, 0xDF, 0xEB,
-    0x19, 0x0C, 0xDE, 0xB1, 0x3C, 0xB1, 0x63, 0x40, 0x06, 0x7F, 0xFE, 0x03, 0x01, 0x07, 0x2A, 0x29,
-    0x28, 0x28, 0x08, 0x14, 0x87, 0xC8, 0x22, 0x93, 0x40, 0xC0, 0x88, 0x4A, 0xE2, 0x52, 0xA9, 0xA4,
-    0xA4, 0xC4, 0x88, 0x69, 0x32, 0x00, 0x3F, 0x67, 0x48, 0x34, 0x78, 0x9C, 0xFB, 0xF6, 0x9F, 0x87,
-    0x21, 0xE0, 0x7F, 0x3F, 0x03, 0xC3, 0xE3, 0xFF, 0xAC, 0x0C, 0x02, 0xBF, 0xF5, 0x19, 0x40, 0xE0,
-    0xC0, 0x7F, 0x7E, 0x6A, 0x60, 0x00, 0xF4, 0x79, 0x27, 0x7D, 0x78, 0x9C, 0x63, 0xF8, 0xF6, 0x9F,
-    0xDB, 0xE0, 0xFF, 0x7A, 0x86, 0x87, 0xFF, 0xD9, 0x19, 0xFE, 0xF8, 0x31, 0x80, 0xC1, 0x9F, 0xFF,
-    0xD4, 0xC1, 0x00, 0x95, 0xEA, 0x2A, 0xB6, 0x78, 0x9C, 0x63, 0x48, 0xF8, 0xFF, 0x9F, 0x8B, 0x81,
-    0xE1, 0xF3, 0xFF, 0xFF, 0xF5, 0x0C, 0x0A, 0xFF, 0xF2, 0x1F, 0xFF, 0x67, 0x7D, 0x78, 0x9F, 0x59,
-    0xE0, 0xB7, 0x3D, 0x03, 0x14, 0xFC, 0xF9, 0x4F, 0x2F, 0x12, 0x00, 0xAE, 0xC6, 0x30, 0x00, 0x78,
-    0x9C, 0x63, 0x10, 0x66, 0x30, 0x60, 0x3C, 0xF0, 0x9F, 0xE9, 0xAF, 0xFC, 0x87, 0xFF, 0xA2, 0xFF,
-    0xFD, 0x1B, 0xCE, 0x33, 0xFE, 0xE4, 0x66, 0x40, 0x80, 0x03, 0xFF, 0xF9, 0x69, 0x43, 0x00, 0x00,
-    0x8F, 0xEB, 0x29, 0x44, 0x78, 0x9C, 0x63, 0xF8, 0xF3, 0xFF, 0xFF, 0xFB, 0x6A, 0x46, 0x06, 0x06,
-    0x06, 0x20, 0xE3, 0xFF, 0xFF, 0x7E, 0x18, 0xE3, 0x3F, 0x37, 0x88, 0x21, 0xE8, 0xF4, 0xF3, 0xFF,
-    0x7C, 0x10, 0x83, 0x81, 0xC1, 0xE1, 0xFF, 0x7F, 0x26, 0x30, 0x83, 0xE1, 0xE7, 0x7F, 0x0E, 0x08,
-    0xE3, 0xF3, 0x7F, 0x1E, 0x08, 0xE3, 0xC3, 0x7F, 0xFE, 0x6F, 0x40, 0x2D, 0x7C, 0x0C, 0x0F, 0x30,
-    0x18, 0x1F, 0xFE, 0xF3, 0x09, 0x00, 0xCD, 0x61, 0x04, 0x2A, 0xE6, 0x86, 0x28, 0xFE, 0xF5, 0x9F,
-    0x1D, 0xCC, 0x48, 0xF8, 0xFF, 0x9F, 0x11, 0xC8, 0x50, 0x0A, 0xFA, 0xFD, 0xBF, 0x1E, 0x66, 0x29,
-    0x27, 0x94, 0x91, 0x07, 0x71, 0xC6, 0xBD, 0x2C, 0x20, 0x0D, 0x00, 0x0F, 0xA2, 0x57, 0xD7, 0x78,
-    0x9C, 0x4D, 0xCC, 0xB1, 0x0D, 0xC2, 0x30, 0x14, 0x84, 0xE1, 0x97, 0x14, 0xA4, 0x40, 0x62, 0x05,
-    0x7B, 0x23, 0x46, 0xC8, 0x0A, 0x6C, 0xC0, 0x06, 0x90, 0x0D, 0x3C, 0x82, 0x33, 0x02, 0x1B, 0xD0,
-    0xA4, 0x8F, 0xD2, 0xA5, 0x45, 0x18, 0xA4, 0x48, 0x09, 0x3F, 0x4F, 0x7E, 0x58, 0xE2, 0x8A, 0xD3,
-    0xA7, 0x2B, 0x4E, 0x64, 0x88, 0xF5, 0xCD, 0x89, 0x88, 0x87, 0xB8, 0x1C, 0x14, 0xDD, 0x7D, 0x86,
-    0x9D, 0x42, 0xE7, 0xF9, 0x22, 0x7F, 0x59, 0x39, 0x6A, 0xBF, 0xA8, 0x56, 0xC6, 0x02, 0x9A, 0x02,
-    0x67, 0x18, 0x09, 0x86, 0xF3, 0x46, 0x9D, 0x71, 0x4D, 0xEC, 0x33, 0x42, 0x4F, 0x6B, 0xF0, 0x7A,
-    0x90, 0x21, 0x0B, 0x4D, 0x52, 0x44, 0x99, 0x70, 0x86, 0x13, 0xE1, 0x99, 0x21, 0x1B, 0x6F, 0x43,
-    0xE2, 0x63, 0xE8, 0xC1, 0xE0, 0x0B, 0xF4, 0xE0, 0x87, 0x87, 0xE2, 0x0B, 0x7B, 0x02, 0x6A, 0xE2,
-    0x78, 0x9C, 0x63, 0x60, 0xF8, 0xF2, 0x5F, 0x8E, 0x01, 0x0C, 0x0C, 0xFE, 0xED, 0x87, 0x30, 0x18,
-    0x0E, 0xFE, 0xE7, 0x80, 0xB2, 0x7E, 0xC6, 0x33, 0xA0, 0x80, 0xC2, 0xD7, 0xFF, 0xF7, 0xB1, 0x01,
-    0xE9, 0x84, 0xFF, 0x40, 0xF0, 0x9E, 0x85, 0x81, 0xE1, 0x3B, 0x88, 0xF1, 0x3F, 0x9E, 0xC1, 0xE0,
-    0xFF, 0xFF, 0x1C, 0xE3, 0x6B, 0xFF, 0xFF, 0x33, 0x6D, 0xF8, 0x0F, 0x32, 0xE5, 0xCF, 0x7F, 0xCE,
-    0x8F, 0xFF, 0xE5, 0x81, 0x8C, 0x4F, 0xFF, 0xF9, 0xBF, 0xFE, 0xE7, 0x06, 0x32, 0x0E, 0xFC, 0xB7,
-    0xFF, 0x0E, 0x36, 0x76, 0xC2, 0xFF, 0xF8, 0x1F, 0xFF, 0xD9, 0x81, 0x8C, 0x86, 0xFF, 0xF9, 0x70,
-    0x06, 0x5C, 0xEA, 0x0B, 0x4C, 0x31, 0x5C, 0x3B, 0xDC, 0x40, 0xB8, 0x15, 0x70, 0x4B, 0x11, 0xCE,
-    0x80, 0x39, 0x0C, 0x00, 0x5B, 0xC7, 0x58, 0x8E, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x48, 0xF8,
-    0xBF, 0x9F, 0x01, 0x0C, 0x3E, 0xFF, 0xE7, 0x02, 0xD3, 0x02, 0xFF, 0xEA, 0x21, 0x02, 0x07, 0xDE,
-    0xB3, 0x30, 0xA0, 0x80, 0xC2, 0xD7, 0xFF, 0xF7, 0xB1, 0x81, 0xB5, 0x00, 0x01, 0x48, 0xF2, 0x3B,
-    0x88, 0xF1, 0x3F, 0x9E, 0xC1, 0xE0, 0xFF, 0xFF, 0x1C, 0xE3, 0x6B, 0xFF, 0xFF, 0x33, 0x6D, 0x00,
-    0x1B, 0xF6, 0xE7, 0x3F, 0xE7, 0xC7, 0xFF, 0xF2, 0x40, 0xC6, 0xA7, 0xFF, 0xFC, 0x5F, 0xFF, 0x73,
-    0x83, 0x8C, 0xFA, 0x6F, 0xFF, 0xFD, 0x3F, 0x07, 0x90, 0x31, 0xE1, 0x7F, 0xFC, 0x8F, 0xFF, 0xEC,
-    0x40, 0x46, 0xC3, 0xFF, 0x7C, 0x38, 0x03, 0x2E, 0xF5, 0x05, 0xA6, 0x18, 0xAE, 0x1D, 0x6E, 0x20,
-    0xDC, 0x0A, 0xB8, 0xA5, 0x08, 0x67, 0xC0, 0x1C, 0x06, 0x00, 0x7D, 0x7F, 0x58, 0xCA, 0x78, 0x9C,
-    0x63, 0x60, 0x60, 0xF8, 0xF9, 0xBF, 0x9E, 0x01, 0x04, 0x02, 0xFE, 0xFF, 0xFF, 0xCF, 0x02, 0x62,
-    0x7C, 0x79, 0x1F, 0xF2, 0xDF, 0x1E, 0x48, 0x2B, 0xFC, 0x97, 0x66, 0x38, 0xF4, 0x9E, 0x91, 0x01,
-    0x09, 0x14, 0xBE, 0xFE, 0xBF, 0x8F, 0x0D, 0x48, 0x27, 0x00, 0xD5, 0xFE, 0x7F, 0x0F, 0x54, 0xFD,
-    0x1D, 0xC4, 0xF8, 0x1F, 0xCF, 0x60, 0xF0, 0xFF, 0x7F, 0x8E, 0xF1, 0xB5, 0xFF, 0xFF, 0x99, 0x36,
-    0xFC, 0xDF, 0x0F, 0x94, 0xFF, 0xF3, 0x9F, 0xF3, 0xE3, 0x7F, 0x79, 0x20, 0xE3, 0xD3, 0x7F, 0xFE,
-    0xAF, 0xFF, 0xB9, 0x81, 0x8C, 0x03, 0xFF, 0xED, 0xBF, 0xFF, 0xE7, 0x00, 0x32, 0x26, 0xFC, 0x8F,
-    0xFF, 0xF1, 0x9F, 0x1D, 0xC8, 0x68, 0xF8, 0x9F, 0x0F, 0x67, 0xC0, 0xA5, 0xBE, 0xC0, 0x14, 0xC3,
-    0xB5, 0xC3, 0x0D, 0x84, 0x5B, 0x01, 0xB7, 0x14, 0xE1, 0x0C, 0x98, 0xC3, 0x00, 0x04, 0x15, 0x5D,
-    0x99, 0x78, 0x9C, 0x63, 0x60, 0x28, 0x78, 0x27, 0xC9, 0xF0, 0x8E, 0x01, 0x08, 0xBE, 0xFE, 0xFF,
-    0xBF, 0x73, 0x3F, 0x88, 0xF1, 0x67, 0xD6, 0xFF, 0xFF, 0xF6, 0x20, 0xC6, 0x7D, 0x86, 0x85, 0xEF,
-    0x59, 0x19, 0x90, 0x41, 0xE1, 0xEB, 0xFF, 0xFB, 0xD8, 0x80, 0x74, 0xC2, 0x7F, 0x20, 0x78, 0xCF,
-    0xC2, 0xC0, 0xF0, 0x1D, 0xC4, 0xF8, 0x1F, 0xCF, 0x60, 0xF0, 0xFF, 0x7F, 0x8E, 0xF1, 0xB5, 0xFF,
-    0xFF, 0x99, 0x36, 0xFC, 0x07, 0x99, 0xF1, 0xE7, 0x3F, 0xE7, 0xC7, 0xFF, 0xF2, 0x40, 0xC6, 0xA7,
-    0xFF, 0xFC, 0x5F, 0xFF, 0x73, 0x03, 0x19, 0x07, 0xFE, 0xDB, 0x7F, 0xFF, 0xCF, 0x01, 0x64, 0x4C,
-    0xF8, 0x1F, 0xFF, 0xE3, 0x3F, 0x3B, 0x90, 0xD1, 0xF0, 0x3F, 0x1F, 0xCE, 0x80, 0x4B, 0x7D, 0x81,
-    0x29, 0x86, 0x6B, 0x87, 0x1B, 0x08, 0xB7, 0x02, 0x6E, 0x29, 0xC2, 0x19, 0x30, 0x87, 0x01, 0x00,
-    0xBD, 0x2D, 0x5E, 0x87, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x66, 0x30, 0x64, 0x00, 0x81, 0x07,
-    0xF7, 0x05, 0xFE, 0xF1, 0x82, 0x18, 0x9F, 0xFE, 0x3B, 0xFD, 0x97, 0x07, 0x31, 0x36, 0xAC, 0x67,
-    0xF8, 0xCD, 0xC9, 0x80, 0x15, 0x14, 0xBE, 0xFE, 0xBF, 0x8F, 0x0D, 0x48, 0x27, 0xFC, 0x07, 0x82,
-    0xF7, 0x2C, 0x0C, 0x0C, 0xDF, 0x41, 0x8C, 0xFF, 0xF1, 0x0C, 0x06, 0xFF, 0xFF, 0xE7, 0x18, 0x5F,
-    0xFB, 0xFF, 0x9F, 0x69, 0xC3, 0xFF, 0xFD, 0x40, 0xF9, 0x3F, 0xFF, 0x39, 0x3F, 0x82, 0x0D, 0xFB,
-    0xF4, 0x9F, 0xFF, 0xEB, 0x7F, 0x6E, 0x20, 0xE3, 0xC0, 0x7F, 0xFB, 0xEF, 0xFF, 0x39, 0x80, 0x8C,
-    0x09, 0xFF, 0xE3, 0x7F, 0xFC, 0x67, 0x07, 0x32, 0x1A, 0xFE, 0xE7, 0xC3, 0x19, 0x70, 0xA9, 0x2F,
-    0x30, 0xC5, 0x70, 0xED, 0x70, 0x03, 0xE1, 0x56, 0xC0, 0x2D, 0x45, 0x38, 0x03, 0xE6, 0x30, 0x00,
-    0xB6, 0xFF, 0x5A, 0x32, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x01, 0x05, 0x19, 0x06, 0x86, 0x0D, 0x6C,
-    0x8F, 0xEE, 0x33, 0x32, 0xFC, 0x8E, 0xDF, 0xF0, 0x5F, 0x6F, 0xC3, 0x7F, 0x59, 0x86, 0xDF, 0xEF,
-    0xFF, 0x00, 0xB9, 0x1B, 0xFE, 0x03, 0x99, 0x0C, 0x02, 0xFF, 0xFF, 0x33, 0x33, 0x40, 0xD9, 0xBF,
-    0xEF, 0xFF, 0xBE, 0xCF, 0x08, 0x54, 0x00, 0x44, 0x10, 0xF5, 0x10, 0xBD, 0x60, 0x63, 0x18, 0x00,
-    0xBC, 0x7E, 0x1E, 0x80, 0x78, 0x9C, 0x3D, 0x8E, 0x31, 0x0A, 0xC2, 0x50, 0x10, 0x44, 0x27, 0x41,
-    0xD4, 0xA0, 0x90, 0xDC, 0xC0, 0x03, 0xD8, 0x08, 0x39, 0x40, 0x2E, 0x22, 0x7C, 0x6B, 0x9B, 0x8F,
-    0x27, 0xD0, 0x1B, 0xA8, 0x85, 0x7D, 0x8E, 0xF0, 0x2F, 0x10, 0xF5, 0x06, 0x82, 0x85, 0xAD, 0x9D,
-    0x4D, 0x8A, 0x10, 0x49, 0x4C, 0x0A, 0xFD, 0xE3, 0xFE, 0x08, 0x0E, 0x2C, 0x3B, 0x30, 0xCB, 0xBE,
-    0x01, 0x3A, 0xF5, 0x65, 0x56, 0x39, 0xB3, 0xC3, 0x05, 0x58, 0xD0, 0x69, 0x0B, 0x34, 0x9D, 0x51,
-    0x98, 0x91, 0xF3, 0xF8, 0x41, 0xFA, 0x86, 0x27, 0xA0, 0x22, 0x83, 0x92, 0x13, 0x44, 0xF6, 0xC3,
-    0xB0, 0xE6, 0x08, 0x29, 0xAF, 0x4C, 0x1A, 0x0E, 0x51, 0xAF, 0x53, 0xAA, 0x96, 0x83, 0xC8, 0x8E,
-    0x37, 0xD4, 0x62, 0x0C, 0x7D, 0x31, 0x12, 0xBD, 0x34, 0x76, 0x54, 0x15, 0xA7, 0x72, 0x7E, 0x66,
-    0x52, 0xF2, 0x5E, 0x78, 0x78, 0x32, 0x34, 0xEE, 0x3D, 0xDE, 0x0C, 0x04, 0xA1, 0xE3, 0x9B, 0x20,
-    0xFE, 0x50, 0xB4, 0x6E, 0x17, 0x3D, 0xC0, 0x2E, 0x73, 0x1E, 0x5D, 0xC1, 0xBD, 0xF7, 0x2B, 0xFB,
-    0x05, 0xE6, 0x9F, 0x62, 0x80, 0x78, 0x9C, 0x63, 0x78, 0xFC, 0x5F, 0x9F, 0x01, 0x04, 0x14, 0xFE,
-    0x9E, 0x07, 0xD3, 0x0C, 0x1B, 0xFF, 0x73, 0x41, 0x18, 0x3F, 0xF2, 0x19, 0x10, 0xE0, 0xDF, 0x7B,
-    0x20, 0xF1, 0xE1, 0x3F, 0x0F, 0xB5, 0xE9, 0xBF, 0x10, 0x9A, 0xFB, 0xCF, 0x7F, 0x46, 0x06, 0x86,
-    0xCF, 0xFF, 0xB9, 0x7E, 0xFE, 0x67, 0x67, 0x60, 0x00, 0x12, 0x9F, 0xFF, 0xCF, 0x37, 0x59, 0xF2,
-    0xFF, 0x3F, 0xE3, 0x84, 0xFF, 0x20, 0x90, 0x0F, 0x12, 0x03, 0x02, 0x36, 0x06, 0x06, 0x83, 0x9B,
-    0xFF, 0xCF, 0xA9, 0x33, 0x30, 0x00, 0x00, 0x32, 0x3C, 0x51, 0x4D, 0x78, 0x9C, 0x63, 0x60, 0x60,
-    0x50, 0xF8, 0xFF, 0x9E, 0x89, 0x01, 0x08, 0x2E, 0xFC, 0xD7, 0x05, 0x51, 0x0C, 0xBF, 0xF6, 0x83,
-    0xA9, 0x82, 0xFF, 0xEC, 0x0C, 0x08, 0xF0, 0xEF, 0x3D, 0x90, 0xF8, 0xF0, 0x9F, 0x87, 0xDA, 0xF4,
-    0x5F, 0x08, 0xCD, 0xFD, 0xE7, 0x3F, 0x23, 0x03, 0xC3, 0xE7, 0xFF, 0x5C, 0x3F, 0x41, 0xB6, 0x02,
-    0x89, 0xCF, 0xFF, 0xE7, 0x9B, 0x2C, 0xF9, 0xFF, 0x9F, 0x71, 0xC2, 0x7F, 0x10, 0xC8, 0x07, 0x89,
-    0x01, 0x01, 0x1B, 0x03, 0x83, 0xC1, 0xCD, 0xFF, 0xE7, 0xD4, 0x19, 0x18, 0x00, 0x3C, 0x19, 0x51,
-    0x6A, 0x78, 0x9C, 0x63, 0x60, 0xF8, 0xF4, 0xFF, 0x3D, 0x23, 0x03, 0x10, 0xFC, 0xF9, 0xFF, 0x9F,
-    0x1B, 0x48, 0x6D, 0xF8, 0x2F, 0xF5, 0x67, 0x3D, 0x90, 0xFE, 0x95, 0xCF, 0x50, 0xF0, 0x9F, 0x83,
-    0x01, 0x06, 0xFE, 0xBD, 0x07, 0x12, 0x1F, 0xFE, 0xF3, 0x50, 0x9B, 0xFE, 0x0B, 0xA1, 0xB9, 0xFF,
-    0xFC, 0x07, 0x3A, 0xE2, 0xF3, 0x7F, 0xAE, 0x9F, 0xFF, 0xD9, 0x19, 0x18, 0x80, 0xC4, 0xE7, 0xFF,
-    0xF3, 0x4D, 0x96, 0xFC, 0xFF, 0xCF, 0x38, 0xE1, 0x3F, 0x08, 0xE4, 0x83, 0xC4, 0x80, 0x80, 0x8D,
-    0x81, 0xC1, 0xE0, 0xE6, 0xFF, 0x73, 0xEA, 0x0C, 0x0C, 0x00, 0x83, 0x05, 0x56, 0x69, 0x78, 0x9C,
-    0x63, 0x60, 0x50, 0x62, 0x30, 0x60, 0x62, 0x60, 0x60, 0x28, 0xF8, 0xCF, 0xF6, 0x23, 0x1E, 0x48,
-    0x2F, 0xF8, 0xCF, 0xF5, 0x67, 0x3E, 0x90, 0x76, 0x78, 0xC7, 0xF2, 0xD4, 0x8E, 0x01, 0x03, 0xFC,
-    0x7B, 0x0F, 0x24, 0x3E, 0xFC, 0xE7, 0xA1, 0x36, 0xFD, 0x17, 0x42, 0x73, 0xFF, 0xF9, 0xCF, 0xC8,
-    0xC0, 0xF0, 0xF9, 0x3F, 0xD7, 0xCF, 0xFF, 0xEC, 0x0C, 0x0C, 0x40, 0xE2, 0xF3, 0xFF, 0xF9, 0x26,
-    0x4B, 0xFE, 0xFF, 0x67, 0x9C, 0xF0, 0x1F, 0x04, 0xF2, 0x41, 0x62, 0x40, 0xC0, 0xC6, 0xC0, 0x60,
-    0x70, 0xF3, 0xFF, 0x39, 0x75, 0x06, 0x06, 0x00, 0x60, 0xB1, 0x52, 0xE8, 0x78, 0x9C, 0x95, 0xCC,
-    0xC1, 0x09, 0xC2, 0x50, 0x10, 0x45, 0xD1, 0xAB, 0x12, 0x05, 0x49, 0x20, 0x7B, 0x41, 0xEC, 0x40,
-    0x3B, 0xB1, 0x84, 0x9F, 0x52, 0xEC, 0x40, 0x4B, 0xB0, 0x84, 0x74, 0x60, 0x29, 0xB1, 0x83, 0x20,
-    0x1F, 0x14, 0x09, 0x7A, 0xCD, 0xB8, 0x71, 0xED, 0x2C, 0xE6, 0xC0, 0x63, 0xE6, 0x01, 0xBC, 0x9C,
-    0x8F, 0x9B, 0x93, 0xFB, 0x80, 0x7B, 0x37, 0x0D, 0x76, 0xAE, 0xF8, 0xCD, 0x60, 0x01, 0xAD, 0x29,
-    0x5B, 0x41, 0xB6, 0x3C, 0x9B, 0x22, 0x9C, 0x6D, 0xEC, 0xC6, 0xCB, 0x0B, 0x3C, 0x2D, 0x5A, 0xB7,
-    0x70, 0xB3, 0xCA, 0x2E, 0xE1, 0x60, 0x1A, 0x9C, 0x40, 0xFD, 0xEE, 0x3D, 0x46, 0xC3, 0x43, 0xD7,
-    0xE1, 0x55, 0x17, 0x61, 0x63, 0xFF, 0x6D, 0xAE, 0xE3, 0xFB, 0x6F, 0x3F, 0x1B, 0x8B, 0x3B, 0x13,
-    0x78, 0x9C, 0xFB, 0xF3, 0x9F, 0x01, 0x04, 0xFE, 0xA0, 0x51, 0xFF, 0xDF, 0x67, 0x83, 0xA9, 0xFF,
-    0xFF, 0x75, 0x21, 0xD4, 0x7D, 0x20, 0x25, 0x58, 0xF4, 0xFF, 0x3F, 0x0B, 0x48, 0xC9, 0xF7, 0xFF,
-    0xEC, 0x20, 0xEA, 0xCB, 0x7F, 0x0E, 0x10, 0xF5, 0x03, 0xC4, 0x03, 0xC9, 0x31, 0x83, 0x55, 0xEE,
-    0x87, 0x68, 0x90, 0x01, 0x9B, 0x12, 0x85, 0x69, 0x34, 0x32, 0x05, 0x00, 0xDE, 0x85, 0x41, 0x22,
-    0x78, 0x9C, 0x1D, 0xCD, 0xB1, 0x09, 0xC2, 0x50, 0x18, 0xC4, 0xF1, 0x33, 0x5A, 0x09, 0x4A, 0x5A,
-    0x8B, 0x80, 0x0B, 0x28, 0x6E, 0xA0, 0x85, 0xBD, 0xA9, 0x53, 0x39, 0x48, 0x76, 0x10, 0x5C, 0x40,
-    0x9D, 0xC0, 0x0D, 0x24, 0x58, 0xB9, 0xC5, 0xE7, 0x06, 0x49, 0x15, 0x90, 0x90, 0xF7, 0xF7, 0x7D,
-    0xEF, 0x9A, 0x5F, 0x73, 0xC7, 0x29, 0xFF, 0x04, 0xAB, 0x24, 0xF5, 0xC4, 0x6C, 0x74, 0x70, 0x30,
-    0x35, 0xDC, 0x26, 0x25, 0x4C, 0x3B, 0x16, 0xD2, 0x8F, 0xAC, 0x63, 0x2E, 0x8D, 0x26, 0xF7, 0xCD,
-    0xD6, 0xDD, 0x05, 0xCB, 0xDC, 0x86, 0xA5, 0xDC, 0x2F, 0xA7, 0xE4, 0x1D, 0x56, 0x6E, 0x3E, 0xD0,
-    0xCE, 0xBC, 0x7F, 0x0E, 0xEC, 0xD3, 0xFE, 0xC1, 0x33, 0x29, 0x2C, 0x7A, 0xD4, 0x3A, 0xD9, 0xBF,
-    0x06, 0x2E, 0x6E, 0x3C, 0x2E, 0xA2, 0xD7, 0xB1, 0xAD, 0xF5, 0x07, 0x18, 0xBE, 0x56, 0x68, 0x78,
-    0x9C, 0x63, 0xF8, 0xF3, 0x9F, 0x8D, 0x01, 0x08, 0x16, 0xFC, 0xB7, 0x07, 0x51, 0x0C, 0xDF, 0xDF,
-    0x33, 0x82, 0x28, 0x87, 0x7F, 0x3C, 0x0C, 0xE8, 0x60, 0xCA, 0x9F, 0xFF, 0x35, 0x0C, 0x0C, 0x05,
-    0xFF, 0x81, 0x40, 0x8F, 0x41, 0xE0, 0xFF, 0xFB, 0x3F, 0xFF, 0xF7, 0x33, 0x30, 0xA4, 0x33, 0x32,
-    0xFC, 0xF9, 0x0F, 0xD6, 0xF2, 0xE3, 0x3F, 0x33, 0xC3, 0xE4, 0x3B, 0xFF, 0xFE, 0xFF, 0x67, 0x5E,
-    0x00, 0x52, 0xF2, 0x9F, 0xF9, 0xFB, 0xFF, 0x3E, 0x93, 0x9F, 0xFF, 0x99, 0xFF, 0x02, 0xC5, 0x81,
-    0x72, 0xFF, 0xDE, 0x33, 0x30, 0xFC, 0x06, 0xF1, 0x98, 0x12, 0x80, 0x72, 0xBF, 0xFE, 0x9F, 0xFF,
-    0x0B, 0xA4, 0x3E, 0x01, 0xD5, 0x3D, 0xF9, 0xCF, 0xAC, 0xF0, 0xEA, 0xBD, 0xD6, 0x84, 0xFF, 0xCC,
-    0x00, 0x4D, 0x5A, 0x42, 0x1D, 0x78, 0x9C, 0x63, 0x60, 0x60, 0xF8, 0xF4, 0xDF, 0x8E, 0x01, 0x08,
-    0xFE, 0xDC, 0x67, 0x02, 0x92, 0x0B, 0xFE, 0x4B, 0x83, 0x38, 0xDF, 0xFA, 0x19, 0x30, 0xC0, 0x94,
-    0x3F, 0xFF, 0x6B, 0x18, 0x18, 0x0A, 0xFE, 0x03, 0x81, 0x1E, 0x83, 0xC0, 0xFF, 0xF7, 0x7F, 0xFE,
-    0xEF, 0x67, 0x60, 0x48, 0x67, 0x64, 0xF8, 0xF3, 0x9F, 0x11, 0x24, 0xFD, 0xE3, 0x3F, 0x33, 0xC3,
-    0xE4, 0x3B, 0xFF, 0xFE, 0xFF, 0x67, 0x5E, 0x00, 0x52, 0xF2, 0x9F, 0xF9, 0xFB, 0xFF, 0x3E, 0x93,
-    0x9F, 0xFF, 0x99, 0xFF, 0x02, 0xC5, 0x81, 0x72, 0xFF, 0xDE, 0x33, 0x30, 0xFC, 0x06, 0xF1, 0x98,
-    0x12, 0x80, 0x72, 0xBF, 0xFE, 0x9F, 0xFF, 0x0B, 0xA4, 0x3E, 0x01, 0xD5, 0x3D, 0xF9, 0xCF, 0xAC,
-    0xF0, 0xEA, 0xBD, 0xD6, 0x84, 0xFF, 0xCC, 0x00, 0x63, 0x50, 0x42, 0x58, 0x78, 0x9C, 0x63, 0x10,
-    0xF8, 0xFF, 0x5F, 0x8E, 0x81, 0x81, 0xE1, 0xC0, 0xFF, 0xFF, 0xFB, 0x81, 0xD4, 0xEF, 0xF5, 0x07,
-    0xFF, 0x73, 0x31, 0x4C, 0xF8, 0xCF, 0xC6, 0xF0, 0xBD, 0x9F, 0x01, 0x0D, 0x4C, 0xF9, 0xF3, 0xBF,
-    0x86, 0x81, 0xA1, 0xE0, 0x3F, 0x10, 0xE8, 0x31, 0x08, 0xFC, 0x7F, 0xFF, 0x07, 0xA4, 0x23, 0x9D,
-    0x91, 0xE1, 0xCF, 0x7F, 0x46, 0x90, 0xF4, 0x8F, 0xFF, 0xCC, 0x0C, 0x93, 0xEF, 0xFC, 0xFB, 0xFF,
-    0x9F, 0x79, 0x01, 0x48, 0xC9, 0x7F, 0xE6, 0xEF, 0xFF, 0xFB, 0x4C, 0x7E, 0xFE, 0x67, 0xFE, 0x0B,
-    0x14, 0x07, 0xCA, 0xFD, 0x7B, 0x0F, 0x34, 0x1D, 0xC4, 0x63, 0x4A, 0x00, 0xCA, 0xFD, 0xFA, 0x7F,
-    0xFE, 0x2F, 0x90, 0xFA, 0x04, 0x54, 0xF7, 0xE4, 0x3F, 0xB3, 0xC2, 0xAB, 0xF7, 0x5A, 0x13, 0xFE,
-    0x33, 0x03, 0x00, 0xC8, 0x3E, 0x47, 0x45, 0x78, 0x9C, 0x63, 0x98, 0x70, 0x9F, 0xDD, 0x60, 0x3D,
-    0x03, 0xC3, 0xCF, 0xFF, 0xF7, 0x6F, 0xD4, 0x33, 0x30, 0xFC, 0xDF, 0xF1, 0xFF, 0x3F, 0x1F, 0x03,
-    0x50, 0x60, 0xF3, 0x79, 0x66, 0x06, 0x34, 0x30, 0xE5, 0xCF, 0xFF, 0x1A, 0x06, 0x86, 0x82, 0xFF,
-    0x40, 0xA0, 0xC7, 0x20, 0xF0, 0xFF, 0xFD, 0x9F, 0xFF, 0xFB, 0x19, 0x18, 0xD2, 0x19, 0x19, 0xFE,
-    0xFC, 0x67, 0x04, 0x49, 0xFF, 0xF8, 0xCF, 0xCC, 0x30, 0xF9, 0xCE, 0xBF, 0xFF, 0xFF, 0x99, 0x17,
-    0x80, 0x94, 0xFC, 0x67, 0xFE, 0xFE, 0xBF, 0xCF, 0xE4, 0xE7, 0x7F, 0xE6, 0xBF, 0x40, 0x71, 0xA0,
-    0xDC, 0xBF, 0xF7, 0x0C, 0x0C, 0xBF, 0x41, 0x3C, 0xA6, 0x04, 0xA0, 0xDC, 0xAF, 0xFF, 0xE7, 0xFF,
-    0x02, 0xA9, 0x4F, 0x40, 0x75, 0x4F, 0xFE, 0x33, 0x2B, 0xBC, 0x7A, 0xAF, 0x35, 0xE1, 0x3F, 0x33,
-    0x00, 0x09, 0x77, 0x47, 0xB7, 0x78, 0x9C, 0x63, 0x10, 0x60, 0x66, 0x30, 0x62, 0x60, 0x60, 0xF8,
-    0x32, 0x3F, 0xE0, 0x3F, 0x27, 0x03, 0xC3, 0xF7, 0xFB, 0x0D, 0xFF, 0x79, 0x18, 0x18, 0x2E, 0xE5,
-    0x1B, 0xBC, 0x65, 0x65, 0x40, 0x03, 0x53, 0xFE, 0xFC, 0xAF, 0x61, 0x60, 0x28, 0xF8, 0x0F, 0x04,
-    0x7A, 0x0C, 0x02, 0xFF, 0xDF, 0xFF, 0xF9, 0xBF, 0x9F, 0x81, 0x21, 0x9D, 0x91, 0xE1, 0xCF, 0x7F,
-    0x46, 0x90, 0xF4, 0x8F, 0xFF, 0xCC, 0x0C, 0x93, 0xEF, 0xFC, 0xFB, 0xFF, 0x9F, 0x79, 0x01, 0x48,
-    0xC9, 0x7F, 0xE6, 0xEF, 0xFF, 0xFB, 0x4C, 0x7E, 0xFE, 0x67, 0xFE, 0x0B, 0x14, 0x07, 0xCA, 0xFD,
-    0x7B, 0xCF, 0xC0, 0xF0, 0x1B, 0xC4, 0x63, 0x4A, 0x00, 0xCA, 0xFD, 0xFA, 0x7F, 0xFE, 0x2F, 0x90,
-    0xFA, 0x04, 0x54, 0xF7, 0xE4, 0x3F, 0xB3, 0xC2, 0xAB, 0xF7, 0x5A, 0x13, 0xFE, 0x33, 0x03, 0x00,
-    0x1B, 0x32, 0x44, 0x01, 0x78, 0x9C, 0x63, 0x60, 0x38, 0x7C, 0x9F, 0x8D, 0x01, 0x08, 0xFE, 0xFD,
-    0x89, 0x07, 0x92, 0x0E, 0xEB, 0x1D, 0xF6, 0x83, 0xA8, 0xF9, 0x0E, 0xEB, 0x11, 0x82, 0x30, 0x25,
-    0x28, 0x60, 0xCA, 0x9F, 0xFF, 0x35, 0x0C, 0x0C, 0x05, 0xFF, 0x81, 0x40, 0x8F, 0x41, 0xE0, 0xFF,
-    0xFB, 0x3F, 0xFF, 0x81, 0x1A, 0xD3, 0x19, 0x19, 0xFE, 0xFC, 0x67, 0x04, 0x49, 0xFF, 0xF8, 0xCF,
-    0xCC, 0x30, 0xF9, 0xCE, 0xBF, 0xFF, 0xFF, 0x99, 0x17, 0x80, 0x94, 0xFC, 0x67, 0xFE, 0xFE, 0xBF,
-    0xCF, 0xE4, 0xE7, 0x7F, 0xE6, 0xBF, 0x40, 0x71, 0xA0, 0xDC, 0xBF, 0xF7, 0x0C, 0x0C, 0xBF, 0x41,
-    0x3C, 0xA6, 0x04, 0xA0, 0xDC, 0xAF, 0xFF, 0xE7, 0xFF, 0x02, 0xA9, 0x4F, 0x40, 0x75, 0x4F, 0xFE,
-    0x33, 0x2B, 0xBC, 0x7A, 0xAF, 0x35, 0xE1, 0x3F, 0x33, 0x00, 0xE5, 0xF9, 0x46, 0xCB, 0x78, 0x9C,
-    0x63, 0x98, 0xF2, 0xF7, 0xBD, 0xB7, 0xC2, 0xCD, 0xFF, 0xBD, 0x8C, 0x0C, 0x05, 0xFF, 0x81, 0xE0,
-    0x17, 0x10, 0xDB, 0x31, 0x08, 0xFC, 0xBF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF7, 0xBB, 0xFF, 0xBF, 0x67,
-    0x60, 0x08, 0x63, 0x10, 0xF8, 0xF7, 0x9F, 0x9B, 0xE1, 0xF3, 0x7F, 0x76, 0x06, 0x20, 0xF8, 0xFD,
-    0x9F, 0x99, 0x61, 0x03, 0x90, 0x3B, 0xE5, 0xCD, 0x7F, 0x08, 0xE0, 0xDD, 0xF0, 0x1F, 0x06, 0x78,
-    0xBF, 0xFF, 0xAF, 0x33, 0xF9, 0xF3, 0xBF, 0xA2, 0xBC, 0xBC, 0x9C, 0xED, 0xEF, 0x7F, 0x26, 0xB0,
-    0x5A, 0x20, 0xF8, 0x07, 0x34, 0xE4, 0xDF, 0x7F, 0x0E, 0x10, 0x13, 0x28, 0xDA, 0xF0, 0xFF, 0x7F,
-    0x3E, 0x03, 0xC3, 0x16, 0x86, 0x9F, 0xFF, 0xCF, 0xFF, 0xBB, 0xFF, 0xEF, 0xFF, 0xB9, 0xBF, 0xFF,
-    0x19, 0x1F, 0x02, 0xF5, 0xCA, 0x3C, 0x06, 0x99, 0xC0, 0x28, 0xF0, 0xEA, 0x7D, 0x0E, 0x83, 0xC0,
-    0xF1, 0x7F, 0xF7, 0x2D, 0x19, 0x00, 0x16, 0x71, 0x5C, 0x65, 0x78, 0x9C, 0x63, 0x70, 0x78, 0xF5,
-    0x7E, 0x2E, 0x0B, 0xC3, 0xEF, 0xFF, 0xFF, 0xFF, 0xF3, 0x2E, 0x00, 0x12, 0xFF, 0xD9, 0x3F, 0xFF,
-    0x8F, 0x17, 0x5C, 0xC2, 0xF8, 0xE3, 0x3F, 0x1B, 0x03, 0x03, 0xC3, 0x9F, 0xFF, 0x8C, 0x40, 0xF2,
-    0xEF, 0x7F, 0x06, 0x38, 0x09, 0x11, 0xF9, 0x09, 0x96, 0xFD, 0x0A, 0x54, 0x39, 0x99, 0xF3, 0x00,
-    0x48, 0x17, 0x97, 0xC2, 0x5F, 0x10, 0xC9, 0x50, 0xF0, 0xE6, 0x7F, 0x2F, 0x50, 0xC1, 0x77, 0x7E,
-    0x90, 0xDA, 0x7F, 0xEB, 0x41, 0x6A, 0x1B, 0x80, 0xC2, 0x0C, 0x0A, 0x81, 0xFF, 0x79, 0x18, 0x18,
-    0x36, 0xFC, 0xFF, 0xCF, 0xC1, 0xC0, 0x30, 0xE1, 0x5F, 0x2F, 0x03, 0x03, 0x00, 0x5D, 0x74, 0x33,
-    0xB2, 0x78, 0x9C, 0x5D, 0xCD, 0xB1, 0x09, 0x83, 0x50, 0x14, 0x85, 0xE1, 0xA3, 0xA0, 0xA8, 0x21,
-    0xA3, 0x04, 0x6C, 0xB3, 0x44, 0x74, 0x1B, 0x9B, 0x0C, 0x91, 0x11, 0xB2, 0x44, 0xA6, 0x08, 0xC4,
-    0xDE, 0xC6, 0xF4, 0x29, 0x1E, 0x28, 0x88, 0xC1, 0xBC, 0xFC, 0xDE, 0x67, 0xE9, 0xDF, 0x7C, 0xC5,
-    0xB9, 0x70, 0xB5, 0x90, 0xC9, 0xBA, 0x51, 0x05, 0x34, 0xB9, 0x38, 0x50, 0xFE, 0x8F, 0xDA, 0x57,
-    0x7F, 0xDC, 0xD5, 0x58, 0x80, 0x93, 0xEE, 0xF4, 0x4F, 0x7A, 0x0D, 0xE4, 0x9A, 0x48, 0x66, 0x22,
-    0xBD, 0xC9, 0xC3, 0x04, 0x85, 0xDF, 0x38, 0x78, 0x1A, 0x2B, 0xF9, 0xD9, 0x66, 0xCD, 0xA4, 0x81,
-    0x91, 0x8B, 0xF4, 0xB0, 0x77, 0xBC, 0xBC, 0x93, 0xBE, 0x76, 0x68, 0x94, 0x1D, 0xED, 0x59, 0x2B,
-    0xA9, 0xDF, 0x3E, 0xD5, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x78, 0xF8, 0xDF, 0x9E, 0x01, 0x08, 0x7E,
-    0xBF, 0x67, 0x06, 0x92, 0x0D, 0xFF, 0x65, 0x40, 0x9C, 0xAF, 0xF3, 0x19, 0x30, 0x40, 0xC0, 0xEB,
-    0xF7, 0x35, 0x20, 0x75, 0xFF, 0xFF, 0xFF, 0xD7, 0x65, 0x58, 0xF0, 0xFF, 0xFE, 0xE9, 0xFF, 0xF7,
-    0x19, 0x3E, 0xFD, 0xE7, 0x64, 0xF8, 0xF6, 0x9F, 0xF5, 0xC7, 0x7F, 0x46, 0x86, 0x07, 0xFF, 0x39,
-    0x41, 0x52, 0xFF, 0xFF, 0x73, 0xFD, 0x05, 0x53, 0xDC, 0x7F, 0xFF, 0x97, 0x03, 0x01, 0xEB, 0x1F,
-    0xA0, 0x1C, 0x10, 0xFC, 0xF8, 0xCF, 0x06, 0xA2, 0x3E, 0xFF, 0xF7, 0x63, 0x60, 0xD8, 0xCA, 0x30,
-    0xE1, 0xFF, 0xFF, 0x73, 0x7F, 0xDF, 0x33, 0x30, 0xFC, 0x04, 0x2A, 0x04, 0x52, 0x06, 0xB7, 0xFE,
-    0x9F, 0xB7, 0x64, 0x00, 0x00, 0xBD, 0x8E, 0x3F, 0x0E, 0x78, 0x9C, 0x5D, 0x8A, 0x31, 0x0E, 0x01,
-    0x51, 0x14, 0x00, 0x67, 0x8B, 0x15, 0x8B, 0xAB, 0x48, 0xB4, 0x2A, 0x37, 0x10, 0x47, 0xD8, 0x5B,
-    0x68, 0x1C, 0x82, 0x1B, 0xB8, 0x84, 0x53, 0x48, 0x6C, 0xAF, 0x59, 0x8D, 0x4A, 0xF1, 0x13, 0x12,
-    0x59, 0xE1, 0x67, 0xBC, 0x55, 0x9A, 0x66, 0x8A, 0x19, 0xC8, 0x2E, 0x80, 0xBD, 0xA6, 0x02, 0xBA,
-    0x66, 0xE7, 0x84, 0xDA, 0x21, 0xD7, 0x86, 0x3F, 0x56, 0xB7, 0xB4, 0x09, 0xBD, 0xD5, 0x69, 0xFC,
-    0xED, 0xD1, 0x96, 0xBB, 0x15, 0x4F, 0xCB, 0xCE, 0x82, 0x8B, 0x55, 0x9F, 0x74, 0x94, 0x7F, 0x1A,
-    0x67, 0xD7, 0x41, 0xF9, 0x89, 0x16, 0x74, 0x0E, 0x7A, 0x3D, 0x5C, 0xC2, 0x81, 0xAD, 0x9E, 0x72,
-    0x82, 0x57, 0x8C, 0xA1, 0xD9, 0xD9, 0x66, 0xCE, 0x17, 0x32, 0x2D, 0x44, 0x1A, 0x78, 0x9C, 0x5D,
-    0xCA, 0x31, 0x0E, 0xC1, 0x60, 0x00, 0x86, 0xE1, 0x57, 0xA4, 0xA4, 0x3A, 0xE8, 0x45, 0x24, 0x35,
-    0xBA, 0x84, 0x38, 0x82, 0x5B, 0x58, 0xDC, 0x81, 0x23, 0xB8, 0x84, 0x03, 0x98, 0x25, 0xBA, 0x5B,
-    0x6A, 0xEF, 0xD0, 0xA4, 0x42, 0x2A, 0xFC, 0x79, 0xFD, 0x35, 0x7A, 0x97, 0x67, 0xF8, 0x3E, 0xF2,
-    0x21, 0x73, 0xA0, 0x2D, 0x0B, 0x33, 0x78, 0xB8, 0x76, 0x0A, 0xA7, 0x5D, 0x1E, 0xC6, 0xFC, 0xB5,
-    0xAA, 0x9B, 0x6D, 0xE4, 0xAD, 0xCE, 0x38, 0x58, 0x9D, 0xAD, 0x68, 0x4D, 0x79, 0x9A, 0x74, 0x0E,
-    0xB8, 0x99, 0xF6, 0x93, 0x4E, 0xC2, 0x8F, 0x2C, 0xB8, 0x89, 0x25, 0x9F, 0xB8, 0xC5, 0x3A, 0x47,
-    0x3D, 0x77, 0x97, 0x70, 0x64, 0xAF, 0x97, 0xD0, 0xC0, 0x2B, 0x1E, 0x23, 0xC5, 0xD5, 0x72, 0xC1,
-    0x17, 0x86, 0xDE, 0x40, 0xD8, 0x78, 0x9C, 0xBB, 0xF8, 0xDF, 0x9F, 0x41, 0xE0, 0xCF, 0x7B, 0x46,
-    0x86, 0x09, 0xFF, 0x79, 0x18, 0x18, 0xBE, 0xCD, 0x67, 0x80, 0x83, 0xFF, 0xEB, 0xC9, 0xC1, 0x00,
-    0x9E, 0x21, 0x1E, 0xD0, 0x78, 0x9C, 0x63, 0xD8, 0xF0, 0xBF, 0x9F, 0xE1, 0xFB, 0x7F, 0x36, 0x87,
-    0xFF, 0x7E, 0x0C, 0x0F, 0xCF, 0x33, 0x31, 0xC0, 0xC0, 0x87, 0xFF, 0x5C, 0x64, 0x61, 0x00, 0x51,
-    0x65, 0x23, 0x18, 0x78, 0x9C, 0x63, 0xD8, 0xF0, 0xFF, 0x3F, 0x2B, 0x03, 0xC3, 0xF7, 0xFF, 0xFF,
-    0xF5, 0x19, 0x12, 0xFE, 0xEB, 0x7D, 0x7F, 0xCF, 0xF8, 0x65, 0x3D, 0xA3, 0xC3, 0x5F, 0x5E, 0x06,
-    0x14, 0xF0, 0x7F, 0x3D, 0xB5, 0x49, 0x00, 0x1A, 0x39, 0x23, 0xBE, 0x78, 0x9C, 0x13, 0x60, 0x66,
-    0x30, 0x64, 0xF8, 0x74, 0xDE, 0xE0, 0x3F, 0xF7, 0xD7, 0xFF, 0x09, 0xFF, 0xF9, 0x0F, 0xF4, 0x0B,
-    0xFC, 0x65, 0x67, 0x40, 0x80, 0x0F, 0xFF, 0xB9, 0x28, 0x27, 0x00, 0x05, 0x2A, 0x24, 0xA3, 0x78,
-    0x9C, 0x25, 0x8C, 0xB1, 0x0D, 0x82, 0x60, 0x18, 0x05, 0xDF, 0x4F, 0x6C, 0x14, 0xA3, 0xD6, 0xC6,
-    0x1D, 0x64, 0x02, 0x31, 0x4C, 0xC0, 0x06, 0xAE, 0xC0, 0x00, 0x26, 0x68, 0x6B, 0xE5, 0x06, 0xBA,
-    0x89, 0x0C, 0x42, 0x22, 0xA5, 0x89, 0x24, 0x34, 0x0A, 0x05, 0xFE, 0x9C, 0x5F, 0x42, 0xF5, 0x92,
-    0xBB, 0xDC, 0x93, 0x2E, 0x2E, 0x0D, 0xA5, 0x3D, 0x79, 0x9F, 0x4B, 0x91, 0x87, 0xB5, 0xA4, 0x0F,
-    0x8D, 0x93, 0xAE, 0xC0, 0x5C, 0x4A, 0x1F, 0x09, 0x37, 0x83, 0x13, 0x75, 0x04, 0x3A, 0xFB, 0xE7,
-    0x8B, 0x69, 0x34, 0x98, 0x63, 0x51, 0x41, 0x09, 0xDB, 0x8E, 0x50, 0x5F, 0xE2, 0xDE, 0xF4, 0x9D,
-    0x83, 0x47, 0xCA, 0xC6, 0x39, 0x8D, 0xB0, 0x60, 0xD9, 0xB2, 0x51, 0xCB, 0xAC, 0x80, 0x9A, 0x26,
-    0x58, 0xFD, 0xAC, 0xDE, 0xD9, 0xF5, 0x9B, 0xA3, 0xD3, 0x1F, 0xEF, 0x98, 0x46, 0x5B, 0x78, 0x9C,
-    0x63, 0x70, 0xF8, 0xAB, 0xCD, 0xF0, 0x9B, 0x89, 0xE1, 0xE3, 0xFF, 0xFF, 0xB3, 0xFE, 0x33, 0x30,
-    0xFC, 0xE8, 0xF9, 0xF7, 0xBF, 0x9E, 0x01, 0x28, 0xD0, 0xF0, 0x8E, 0x83, 0x01, 0x15, 0x7C, 0x78,
-    0x2F, 0x70, 0xF3, 0xBF, 0x37, 0xC3, 0x87, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xE1, 0x3F,
-    0x08, 0xC8, 0x7F, 0xF8, 0x7F, 0x9E, 0xF9, 0xF2, 0xFF, 0xFC, 0x0F, 0xFF, 0xF5, 0x19, 0x12, 0xFE,
-    0xF7, 0x7F, 0xF8, 0xCF, 0xCB, 0x60, 0x00, 0xA2, 0xB8, 0x19, 0x14, 0x40, 0x14, 0x17, 0x69, 0x14,
-    0x00, 0xC4, 0x86, 0x47, 0x56, 0x78, 0x9C, 0x63, 0xF8, 0xF3, 0x9F, 0x8D, 0x01, 0x08, 0x16, 0xFC,
-    0xB7, 0x07, 0x51, 0x0C, 0xDF, 0xEF, 0x33, 0x82, 0x28, 0x87, 0x7F, 0xDC, 0x0C, 0xE8, 0xC0, 0xE1,
-    0xD5, 0xFB, 0x1A, 0xA0, 0xE4, 0xAF, 0xFF, 0xFF, 0xFF, 0xDB, 0x01, 0xD5, 0x03, 0xC1, 0x7B, 0xC6,
-    0xCF, 0xFF, 0xFD, 0x14, 0x7E, 0xFD, 0xE7, 0xFC, 0xF1, 0x9F, 0x95, 0xE1, 0xC2, 0x7F, 0xFE, 0x3F,
-    0xFF, 0x19, 0x18, 0x26, 0xFC, 0xB7, 0xFF, 0x0B, 0xA4, 0x0A, 0xFE, 0xFB, 0x83, 0xA8, 0x86, 0xFF,
-    0xF1, 0xBF, 0xFF, 0x33, 0x82, 0x04, 0xBF, 0x03, 0xED, 0x79, 0xF0, 0x9F, 0xFF, 0xD3, 0x7F, 0x3F,
-    0x81, 0x9F, 0xFF, 0xB9, 0x1A, 0x40, 0xDA, 0xFF, 0x33, 0x31, 0xFC, 0x04, 0x1B, 0xC6, 0xE0, 0x70,
-    0xEB, 0x7F, 0x0F, 0x23, 0x03, 0x00, 0x7C, 0x6F, 0x3F, 0x4B, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x38,
-    0xF0, 0x3F, 0x9F, 0x01, 0x08, 0x7E, 0xFC, 0x67, 0x05, 0x92, 0x01, 0xFF, 0xED, 0x40, 0x9C, 0x4F,
-    0xFB, 0x19, 0x19, 0xD0, 0x81, 0xC3, 0xAB, 0xF7, 0x35, 0x40, 0xD1, 0x5F, 0xFF, 0xFF, 0x03, 0xD5,
-    0x2C, 0x00, 0x92, 0xFF, 0xDF, 0x33, 0x7E, 0xFE, 0xEF, 0xA7, 0xF0, 0xEB, 0x3F, 0x27, 0x48, 0xEF,
-    0x85, 0xFF, 0xFC, 0x7F, 0xFE, 0x33, 0x30, 0x4C, 0xF8, 0x6F, 0xFF, 0x17, 0x48, 0x15, 0xFC, 0xF7,
-    0x07, 0x51, 0x0D, 0xFF, 0xE3, 0x7F, 0xFF, 0x67, 0x04, 0x09, 0x7E, 0xFF, 0xCF, 0xC6, 0xF0, 0xE0,
-    0x3F, 0xFF, 0xA7, 0xFF, 0x7E, 0x02, 0x3F, 0xFF, 0x73, 0x35, 0x80, 0xB4, 0xFF, 0x67, 0x62, 0xF8,
-    0x09, 0x36, 0x8C, 0xC1, 0xE1, 0xD6, 0xFF, 0x1E, 0x46, 0x06, 0x00, 0xA7, 0x82, 0x3F, 0xB5, 0x78,
-    0x9C, 0x63, 0x60, 0xF8, 0xF3, 0xDF, 0x9E, 0x81, 0x81, 0x61, 0xC2, 0xFF, 0xFF, 0xEF, 0x19, 0x19,
-    0x18, 0xBE, 0xDF, 0x9F, 0xF4, 0x5F, 0x96, 0x21, 0xE1, 0x3F, 0x27, 0xC3, 0xD3, 0xF3, 0x0C, 0x68,
-    0xC0, 0xE1, 0xD5, 0xFB, 0x1A, 0xA0, 0x92, 0x5F, 0xFF, 0xFF, 0xFF, 0xB7, 0x63, 0x58, 0x00, 0x24,
-    0x81, 0x3A, 0x3E, 0xFF, 0xF7, 0x53, 0xF8, 0xF5, 0x9F, 0xF3, 0xC7, 0x7F, 0x56, 0x86, 0x0B, 0xFF,
-    0xF9, 0xFF, 0xFC, 0x07, 0x19, 0x64, 0xFF, 0x17, 0x48, 0x15, 0xFC, 0xF7, 0x07, 0x51, 0x0D, 0xFF,
-    0xE3, 0x7F, 0xFF, 0x67, 0x04, 0x09, 0x7E, 0xFF, 0xCF, 0xC6, 0xF0, 0xE0, 0x3F, 0xFF, 0xA7, 0xFF,
-    0x7E, 0x02, 0x3F, 0xFF, 0x73, 0x35, 0x80, 0xB4, 0xFF, 0x67, 0x62, 0xF8, 0x09, 0x36, 0x8C, 0xC1,
-    0xE1, 0xD6, 0xFF, 0x1E, 0x46, 0x06, 0x00, 0x0D, 0xDA, 0x44, 0xA4, 0x78, 0x9C, 0x63, 0x98, 0x70,
-    0x9F, 0xDD, 0x60, 0x3D, 0x03, 0xC3, 0x8F, 0xFF, 0xF7, 0x6F, 0xD4, 0x33, 0x30, 0xFC, 0xDF, 0xF9,
-    0xFF, 0xBF, 0x1C, 0x03, 0x50, 0x60, 0xF3, 0x79, 0x66, 0x06, 0x34, 0xE0, 0xF0, 0xEA, 0x7D, 0x0D,
-    0x23, 0x03, 0xC3, 0xAF, 0xFF, 0xFF, 0xFF, 0xDB, 0x31, 0x2C, 0x00, 0x92, 0xFF, 0xDF, 0x33, 0x7E,
-    0xFE, 0xEF, 0xA7, 0xF0, 0xEB, 0x3F, 0xE7, 0x8F, 0xFF, 0xAC, 0x0C, 0x17, 0xFE, 0xF3, 0xFF, 0xF9,
-    0xCF, 0xC0, 0x30, 0xE1, 0xBF, 0xFD, 0x5F, 0x20, 0x55, 0xF0, 0xDF, 0x1F, 0x44, 0x35, 0xFC, 0x8F,
-    0xFF, 0xFD, 0x9F, 0x11, 0x24, 0xF8, 0xFD, 0x3F, 0x1B, 0xC3, 0x83, 0xFF, 0xFC, 0x9F, 0xFE, 0xFB,
-    0x09, 0xFC, 0xFC, 0xCF, 0xD5, 0x00, 0xD2, 0xFE, 0x9F, 0x89, 0xE1, 0x27, 0xD8, 0x30, 0x06, 0x87,
-    0x5B, 0xFF, 0x7B, 0x18, 0x19, 0x00, 0x48, 0x37, 0x45, 0x06, 0x78, 0x9C, 0x5D, 0x8C, 0xC1, 0x0D,
-    0x82, 0x40, 0x00, 0x04, 0xF7, 0x24, 0x92, 0x48, 0x62, 0xA0, 0x04, 0x5A, 0xA0, 0x01, 0xBD, 0x0A,
-    0xB0, 0x04, 0x5B, 0xA0, 0x00, 0x13, 0x28, 0xC0, 0x87, 0x25, 0xD8, 0x01, 0xAD, 0xE8, 0xD7, 0x97,
-    0x6F, 0x3F, 0x97, 0x48, 0x02, 0x02, 0x92, 0x81, 0xF3, 0xE9, 0x3E, 0x76, 0x92, 0x49, 0x76, 0x95,
-    0x04, 0xCA, 0x24, 0x35, 0xB5, 0x25, 0x92, 0x5A, 0x57, 0xB0, 0x95, 0xEE, 0x65, 0x3A, 0x85, 0xFA,
-    0x8B, 0x7D, 0xB9, 0x93, 0x91, 0x06, 0x60, 0xA7, 0xEB, 0xD2, 0x38, 0xD3, 0x90, 0xA7, 0x03, 0x9B,
-    0x0F, 0x6B, 0xDD, 0x88, 0xBF, 0x48, 0x17, 0xF6, 0xD3, 0x82, 0x82, 0x83, 0x47, 0xC5, 0x71, 0xC4,
-    0x78, 0xD9, 0x11, 0xEA, 0x49, 0xFC, 0x26, 0x4F, 0x7A, 0xA2, 0xCA, 0xCF, 0x59, 0xA9, 0xFF, 0x9D,
-    0xC9, 0x3E, 0x38, 0x1B, 0xCD, 0x59, 0x36, 0x41, 0x4F, 0x78, 0x9C, 0x63, 0x60, 0xB8, 0x14, 0xC7,
-    0x00, 0x02, 0x3F, 0xCE, 0x83, 0xA9, 0xEF, 0xFB, 0xC1, 0x54, 0x83, 0x26, 0x03, 0x1C, 0xFC, 0xFB,
-    0x0F, 0x02, 0xCC, 0x50, 0x6A, 0xE5, 0x2A, 0x10, 0x60, 0x82, 0xCB, 0xE2, 0xD6, 0x0E, 0x00, 0xF1,
-    0x61, 0x1A, 0xA2, 0x78, 0x9C, 0x15, 0x8D, 0xB1, 0x0D, 0x83, 0x30, 0x00, 0x04, 0x1F, 0xA4, 0x48,
-    0x11, 0x0D, 0x2C, 0x41, 0xCF, 0x04, 0xB1, 0x27, 0x60, 0x05, 0xE6, 0xA0, 0x63, 0x00, 0x0A, 0x46,
-    0xC8, 0x06, 0xAC, 0x90, 0x11, 0xB2, 0x81, 0xA9, 0x69, 0x2C, 0x41, 0x01, 0x4E, 0x40, 0x07, 0xFE,
-    0xE2, 0xAE, 0x3A, 0xBD, 0x74, 0x2F, 0x95, 0xEC, 0xEC, 0xFB, 0x51, 0xFA, 0x01, 0x5E, 0x6F, 0xA2,
-    0x92, 0x95, 0xDA, 0x42, 0xB6, 0xF3, 0xF8, 0x40, 0x7E, 0xA0, 0xCD, 0x61, 0x4E, 0x2A, 0x5A, 0x9A,
-    0x93, 0xAF, 0xEB, 0x68, 0xFE, 0x04, 0x33, 0x60, 0x76, 0x78, 0x4E, 0xE4, 0x0B, 0xBE, 0x08, 0x64,
-    0x43, 0xCC, 0x49, 0x6D, 0xE4, 0x4B, 0x9D, 0x9B, 0xE9, 0x13, 0xA9, 0x8C, 0x4F, 0xBA, 0x00, 0xE9,
-    0x9C, 0x43, 0x93, 0x78, 0x9C, 0x63, 0xF8, 0xFD, 0x9F, 0x83, 0x01, 0x08, 0x26, 0xFC, 0xF7, 0x07,
-    0x51, 0x0C, 0xDF, 0xDE, 0x33, 0x81, 0x28, 0x83, 0x7F, 0xBC, 0x0C, 0x68, 0xE0, 0xD3, 0x7F, 0x4E,
-    0x06, 0x87, 0xFF, 0xF5, 0x64, 0x50, 0x5C, 0x0C, 0x09, 0xFF, 0xEB, 0x3F, 0xFE, 0xE7, 0x65, 0xD8,
-    0xF0, 0xBF, 0xFE, 0xC3, 0xFF, 0x7C, 0x86, 0xEF, 0xFF, 0xEB, 0x17, 0xFC, 0x07, 0x81, 0x7A, 0x85,
-    0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xA9, 0x67, 0x98, 0xF8, 0x6F, 0x1F, 0xCB, 0x8F, 0x7A, 0x00, 0x0B,
-    0x0A, 0x40, 0xA2, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x48, 0xF8, 0x7F, 0x9E, 0x01, 0x08, 0x3E, 0xFD,
-    0xE7, 0x02, 0x92, 0x02, 0x7F, 0xFB, 0x41, 0x9C, 0x0D, 0xEF, 0x59, 0x18, 0xD0, 0xC0, 0xA7, 0xFF,
-    0x9C, 0x0C, 0x0E, 0xFF, 0xEB, 0xC9, 0xA0, 0xB8, 0x80, 0x56, 0xD4, 0x7F, 0xFC, 0xCF, 0xCB, 0xB0,
-    0xE1, 0x7F, 0xFD, 0x87, 0xFF, 0xF9, 0x0C, 0xDF, 0xFF, 0xD7, 0x2F, 0xF8, 0x0F, 0x02, 0xF5, 0x0A,
-    0xFF, 0xFE, 0xFF, 0xEF, 0xFF, 0x53, 0xCF, 0x30, 0xF1, 0xDF, 0x3E, 0x96, 0x1F, 0xF5, 0x00, 0x32,
-    0xB9, 0x41, 0x08, 0x78, 0x9C, 0x9D, 0xC5, 0xB1, 0x0D, 0x40, 0x40, 0x18, 0x86, 0xE1, 0xAF, 0xB8,
-    0x44, 0x48, 0xEC, 0x70, 0x53, 0xE8, 0x24, 0x46, 0xB1, 0xC1, 0x8D, 0xF0, 0x8F, 0x20, 0x36, 0x60,
-    0x02, 0x26, 0xB0, 0x8B, 0x0D, 0x90, 0x08, 0x05, 0xF7, 0x8A, 0x52, 0xEB, 0x69, 0x1E, 0x69, 0x67,
-    0x90, 0xE4, 0x81, 0x44, 0x9A, 0x29, 0x62, 0x90, 0xEE, 0x52, 0x3D, 0x4E, 0x1F, 0x1B, 0xA9, 0x2A,
-    0xEC, 0x47, 0x99, 0x6A, 0x6C, 0x25, 0xD7, 0x88, 0x2D, 0x04, 0x1D, 0x58, 0xC7, 0xCB, 0x7C, 0x84,
-    0xE6, 0x32, 0xB5, 0x71, 0x72, 0xA7, 0x3D, 0x85, 0x6B, 0x45, 0xC8, 0x78, 0x9C, 0x63, 0x60, 0x10,
-    0x66, 0x30, 0x60, 0x64, 0x60, 0xD8, 0xF0, 0x9F, 0xE9, 0xAF, 0x3E, 0x03, 0xC3, 0x87, 0xFF, 0xAC,
-    0xFF, 0xFD, 0x19, 0x18, 0x1A, 0xCE, 0x33, 0xFE, 0xE4, 0x61, 0x40, 0x05, 0x9F, 0xFE, 0x73, 0x32,
-    0x38, 0xFC, 0xAF, 0x27, 0x83, 0xE2, 0x62, 0x48, 0xF8, 0x5F, 0xFF, 0xF1, 0x3F, 0x2F, 0xD0, 0x92,
-    0xFA, 0x0F, 0xFF, 0xF3, 0x19, 0xBE, 0xFF, 0xAF, 0x5F, 0xF0, 0x1F, 0x04, 0xEA, 0x15, 0xFE, 0xFD,
-    0xFF, 0xDF, 0xFF, 0xA7, 0x9E, 0x61, 0xE2, 0xBF, 0x7D, 0x2C, 0x3F, 0xEA, 0x01, 0xC1, 0x15, 0x42,
-    0x58, 0x78, 0x9C, 0x65, 0x8E, 0xBD, 0x0D, 0xC2, 0x60, 0x0C, 0x44, 0x8F, 0x2F, 0x42, 0xE1, 0x47,
-    0x8A, 0xD8, 0x20, 0x25, 0x2D, 0x1B, 0x90, 0x09, 0x80, 0x9E, 0x15, 0xD8, 0x01, 0x36, 0x60, 0x05,
-    0x36, 0x08, 0x23, 0xB0, 0x01, 0x64, 0x02, 0xC4, 0x04, 0x88, 0x20, 0x25, 0x29, 0xE0, 0x3B, 0xCE,
-    0x4E, 0xC9, 0x35, 0xCF, 0x96, 0x4E, 0xCF, 0x06, 0x70, 0xE2, 0x11, 0x96, 0x86, 0xA9, 0x61, 0xC1,
-    0x95, 0xAF, 0x8F, 0x6B, 0xC0, 0x7F, 0x3E, 0x4C, 0x80, 0xC8, 0x41, 0xC3, 0x91, 0x9A, 0x25, 0x5E,
-    0xCC, 0x70, 0xE0, 0x5A, 0x92, 0x25, 0x6E, 0x9A, 0x0B, 0xC9, 0x6A, 0x8E, 0x81, 0xEF, 0x1D, 0x9D,
-    0x75, 0x5B, 0x06, 0x8D, 0x50, 0x71, 0xCE, 0xBD, 0x78, 0xE6, 0x8E, 0xB9, 0xB8, 0x61, 0xC9, 0xA9,
-    0x19, 0xE3, 0x93, 0x43, 0x63, 0x47, 0xFA, 0x85, 0x5A, 0x56, 0xCB, 0x45, 0xD6, 0x9E, 0x99, 0xF3,
-    0xAD, 0x8B, 0xC0, 0xAC, 0x88, 0x0C, 0xDE, 0xEA, 0xBF, 0x16, 0x27, 0xC6, 0x8A, 0x5B, 0x6F, 0xFD,
-    0x00, 0x49, 0xA3, 0x45, 0x4F, 0x78, 0x9C, 0xFB, 0xF0, 0x9F, 0x8B, 0x01, 0x08, 0x3E, 0xE0, 0xA7,
-    0x6E, 0xBC, 0x97, 0x04, 0x52, 0x37, 0xFF, 0xFF, 0x7F, 0xCF, 0xF8, 0xE1, 0x3F, 0x08, 0x70, 0x7F,
-    0xF8, 0xBF, 0x9F, 0xE9, 0xEB, 0x7F, 0xFD, 0x0F, 0xFF, 0xF9, 0x19, 0x1A, 0xFE, 0xE7, 0x7F, 0xF8,
-    0xCF, 0xC3, 0x60, 0xF0, 0x7F, 0x3E, 0x48, 0x83, 0xC2, 0xFF, 0xF5, 0x1F, 0xFE, 0x73, 0x43, 0x28,
-    0xA8, 0xA0, 0x3C, 0x50, 0x49, 0xFD, 0x87, 0xFF, 0xE7, 0x85, 0xC1, 0x1A, 0xA0, 0xDA, 0xFF, 0x40,
-    0x0C, 0xD3, 0x7C, 0x05, 0x36, 0x9A, 0x18, 0x47, 0x80, 0x28, 0x00, 0x4B, 0x2F, 0x55, 0xF2, 0x78,
-    0x9C, 0x65, 0x8E, 0xBB, 0x0D, 0xC2, 0x40, 0x10, 0x05, 0x9F, 0x8D, 0x90, 0xF8, 0x48, 0x16, 0x12,
-    0x22, 0x26, 0x24, 0x75, 0x07, 0xB8, 0x03, 0x93, 0xD3, 0x02, 0x3D, 0xE0, 0x0E, 0x68, 0x81, 0x0E,
-    0x4C, 0x09, 0x74, 0x00, 0x54, 0xE0, 0x12, 0xC0, 0x46, 0x02, 0x23, 0xE1, 0x1B, 0xF6, 0x0E, 0x32,
-    0x36, 0x99, 0x0D, 0xDE, 0xBE, 0x59, 0x69, 0xAA, 0x34, 0x92, 0x74, 0x24, 0xEE, 0xE6, 0xC6, 0x1B,
-    0x33, 0x72, 0x63, 0x71, 0x8A, 0x5E, 0x63, 0xFD, 0xCD, 0x9B, 0x9E, 0xE4, 0x88, 0x1E, 0x0C, 0x94,
-    0x52, 0xAA, 0x26, 0x51, 0x61, 0x07, 0x7B, 0x96, 0x3A, 0xDB, 0x9E, 0xB1, 0x53, 0xC3, 0x50, 0xEA,
-    0x2A, 0xB5, 0x3E, 0xFB, 0xB4, 0xDE, 0xCA, 0x0E, 0x6B, 0x16, 0x6C, 0x8D, 0x07, 0x36, 0x78, 0xCF,
-    0x8A, 0x92, 0xD0, 0xEF, 0xAE, 0xF4, 0x3D, 0x5B, 0x08, 0x86, 0xC6, 0x5A, 0x15, 0x1E, 0xCA, 0x7F,
-    0x4C, 0x02, 0xEF, 0x66, 0x94, 0x26, 0x99, 0x23, 0x0E, 0x29, 0x13, 0x7D, 0x39, 0xF2, 0xBC, 0xB0,
-    0x0E, 0xA9, 0x0F, 0x40, 0xD0, 0x46, 0xBD,
-};
-const GFXglyph OpenSans12BGlyphs[] = {
-    { 0, 0, 7, 0, 0, 8, 0 }, //  
-    { 5, 18, 7, 1, 18, 59, 8 }, // !
-    { 10, 6, 12, 1, 18, 41, 67 }, // "
-    { 16, 18, 16, 0, 18, 122, 108 }, // #
-    { 13, 20, 14, 1, 19, 109, 230 }, // $
-    { 22, 18, 23, 0, 18, 165, 339 }, // %
-    { 18, 18, 19, 1, 18, 138, 504 }, // &
-    { 5, 6, 7, 1, 18, 27, 642 }, // '
-    { 7, 22, 8, 1, 18, 80, 669 }, // (
-    { 8, 22, 8, 0, 18, 81, 749 }, // )
-    { 13, 13, 14, 0, 19, 90, 830 }, // *
-    { 13, 13, 14, 1, 15, 40, 920 }, // +
-    { 6, 6, 7, 0, 3, 27, 960 }, // ,
-    { 8, 4, 8, 0, 8, 19, 987 }, // -
-    { 5, 5, 7, 1, 5, 24, 1006 }, // .
-    { 11, 18, 10, 0, 18, 91, 1030 }, // /
-    { 14, 18, 14, 0, 18, 109, 1121 }, // 0
-    { 10, 18, 14, 1, 18, 45, 1230 }, // 1
-    { 14, 18, 14, 0, 18, 95, 1275 }, // 2
-    { 14, 18, 14, 0, 18, 107, 1370 }, // 3
-    { 14, 18, 14, 0, 18, 76, 1477 }, // 4
-    { 13, 18, 14, 1, 18, 98, 1553 }, // 5
-    { 14, 18, 14, 0, 18, 126, 1651 }, // 6
-    { 14, 18, 14, 0, 18, 91, 1777 }, // 7
-    { 14, 18, 14, 0, 18, 125, 1868 }, // 8
-    { 14, 18, 14, 0, 18, 121, 1993 }, // 9
-    { 5, 14, 7, 1, 14, 36, 2114 }, // :
-    { 6, 17, 7, 0, 14, 44, 2150 }, // ;
-    { 13, 14, 14, 1, 16, 74, 2194 }, // <
-    { 13, 7, 14, 1, 13, 27, 2268 }, // =
-    { 13, 14, 14, 1, 16, 70, 2295 }, // >
-    { 12, 18, 12, 0, 18, 90, 2365 }, // ?
-    { 21, 20, 22, 1, 18, 198, 2455 }, // @
-    { 18, 18, 17, 0, 18, 130, 2653 }, // A
-    { 14, 18, 17, 2, 18, 92, 2783 }, // B
-    { 15, 18, 16, 1, 18, 113, 2875 }, // C
-    { 16, 18, 19, 2, 18, 98, 2988 }, // D
-    { 11, 18, 14, 2, 18, 40, 3086 }, // E
-    { 11, 18, 14, 2, 18, 33, 3126 }, // F
-    { 16, 18, 18, 1, 18, 122, 3159 }, // G
-    { 15, 18, 19, 2, 18, 31, 3281 }, // H
-    { 5, 18, 8, 2, 18, 14, 3312 }, // I
-    { 9, 23, 8, -2, 18, 40, 3326 }, // J
-    { 15, 18, 17, 2, 18, 96, 3366 }, // K
-    { 12, 18, 14, 2, 18, 26, 3462 }, // L
-    { 20, 18, 24, 2, 18, 132, 3488 }, // M
-    { 17, 18, 20, 2, 18, 96, 3620 }, // N
-    { 18, 18, 20, 1, 18, 102, 3716 }, // O
-    { 13, 18, 16, 2, 18, 70, 3818 }, // P
-    { 18, 22, 20, 1, 18, 131, 3888 }, // Q
-    { 15, 18, 17, 2, 18, 97, 4019 }, // R
-    { 12, 18, 14, 1, 18, 105, 4116 }, // S
-    { 14, 18, 14, 0, 18, 31, 4221 }, // T
-    { 15, 18, 19, 2, 18, 66, 4252 }, // U
-    { 17, 18, 16, 0, 18, 130, 4318 }, // V
-    { 25, 18, 24, 0, 18, 173, 4448 }, // W
-    { 17, 18, 17, 0, 18, 132, 4621 }, // X
-    { 16, 18, 16, 0, 18, 93, 4753 }, // Y
-    { 14, 18, 14, 0, 18, 82, 4846 }, // Z
-    { 7, 22, 8, 1, 18, 27, 4928 }, // [
-    { 11, 18, 10, 0, 18, 89, 4955 }, // <backslash>
-    { 7, 22, 8, 0, 18, 28, 5044 }, // ]
-    { 14, 12, 13, 0, 18, 78, 5072 }, // ^
-    { 12, 2, 10, -1, -2, 17, 5150 }, // _
-    { 8, 4, 15, 4, 19, 24, 5167 }, // `
-    { 13, 14, 15, 1, 14, 98, 5191 }, // a
-    { 14, 19, 16, 1, 19, 94, 5289 }, // b
-    { 12, 14, 13, 1, 14, 72, 5383 }, // c
-    { 13, 19, 16, 1, 19, 94, 5455 }, // d
-    { 13, 14, 15, 1, 14, 92, 5549 }, // e
-    { 11, 19, 10, 0, 19, 57, 5641 }, // f
-    { 14, 20, 14, 0, 14, 133, 5698 }, // g
-    { 14, 19, 16, 1, 19, 62, 5831 }, // h
-    { 5, 19, 8, 1, 19, 29, 5893 }, // i
-    { 8, 25, 8, -2, 19, 50, 5922 }, // j
-    { 15, 19, 16, 1, 19, 90, 5972 }, // k
-    { 5, 19, 8, 1, 19, 14, 6062 }, // l
-    { 22, 14, 25, 1, 14, 87, 6076 }, // m
-    { 14, 14, 16, 1, 14, 57, 6163 }, // n
-    { 14, 14, 15, 1, 14, 98, 6220 }, // o
-    { 14, 20, 16, 1, 14, 96, 6318 }, // p
-    { 13, 20, 16, 1, 14, 89, 6414 }, // q
-    { 10, 14, 11, 1, 14, 44, 6503 }, // r
-    { 11, 14, 12, 1, 14, 88, 6547 }, // s
-    { 11, 17, 11, 0, 17, 63, 6635 }, // t
-    { 14, 14, 16, 1, 14, 58, 6698 }, // u
-    { 15, 14, 14, 0, 14, 106, 6756 }, // v
-    { 22, 14, 21, 0, 14, 142, 6862 }, // w
-    { 15, 14, 14, 0, 14, 106, 7004 }, // x
-    { 15, 20, 14, 0, 14, 127, 7110 }, // y
-    { 12, 14, 12, 0, 14, 78, 7237 }, // z
-    { 9, 22, 10, 0, 18, 68, 7315 }, // {
-    { 4, 25, 14, 5, 19, 13, 7383 }, // |
-    { 9, 22, 10, 1, 18, 74, 7396 }, // }
-    { 13, 7, 14, 1, 12, 50, 7470 }, // ~
-    { 0, 0, 7, 0, 0, 8, 7520 }, // �
-    { 5, 19, 7, 1, 14, 64, 7528 }, // �
-    { 12, 18, 14, 1, 18, 84, 7592 }, // �
-    { 13, 18, 14, 1, 18, 81, 7676 }, // �
-    { 12, 13, 14, 1, 15, 68, 7757 }, // �
-    { 15, 18, 14, 0, 18, 97, 7825 }, // �
-    { 4, 25, 14, 5, 19, 19, 7922 }, // �
-    { 10, 19, 12, 1, 19, 106, 7941 }, // �
-    { 9, 4, 15, 3, 20, 29, 8047 }, // �
-    { 19, 18, 21, 1, 18, 142, 8076 }, // �
-    { 9, 9, 10, 0, 18, 56, 8218 }, // �
-    { 14, 12, 15, 1, 13, 66, 8274 }, // �
-    { 13, 7, 14, 1, 10, 28, 8340 }, // �
-    { 8, 4, 8, 0, 8, 19, 8368 }, // �
-    { 19, 18, 21, 1, 18, 148, 8387 }, // �
-    { 14, 3, 13, -1, 22, 19, 8535 }, // �
-    { 9, 8, 11, 1, 18, 44, 8554 }, // �
-    { 13, 16, 14, 1, 16, 47, 8598 }, // �
-    { 9, 11, 9, 0, 18, 62, 8645 }, // �
-    { 9, 11, 9, 0, 18, 66, 8707 }, // �
-    { 8, 4, 15, 4, 19, 25, 8773 }, // �
-    { 14, 20, 17, 1, 14, 52, 8798 }, // �
-    { 14, 22, 16, 1, 19, 58, 8850 }, // �
-    { 5, 5, 7, 1, 11, 24, 8908 }, // �
-    { 7, 6, 5, -1, 0, 33, 8932 }, // �
-    { 7, 11, 9, 1, 18, 31, 8965 }, // �
-    { 9, 9, 10, 0, 18, 52, 8996 }, // �
-    { 14, 12, 15, 1, 13, 64, 9048 }, // �
-    { 21, 18, 22, 0, 18, 138, 9112 }, // �
-    { 21, 18, 22, 0, 18, 145, 9250 }, // �
-    { 20, 18, 22, 1, 18, 157, 9395 }, // �
-    { 12, 19, 12, 0, 14, 95, 9552 }, // �
-    { 18, 23, 17, 0, 23, 149, 9647 }, // �
-    { 18, 23, 17, 0, 23, 146, 9796 }, // �
-    { 18, 23, 17, 0, 23, 152, 9942 }, // �
-    { 18, 23, 17, 0, 23, 154, 10094 }, // �
-    { 18, 24, 17, 0, 24, 153, 10248 }, // �
-    { 18, 23, 17, 0, 23, 153, 10401 }, // �
-    { 23, 18, 24, 0, 18, 115, 10554 }, // �
-    { 15, 24, 16, 1, 18, 139, 10669 }, // �
-    { 11, 23, 14, 2, 23, 57, 10808 }, // �
-    { 11, 23, 14, 2, 23, 60, 10865 }, // �
-    { 11, 23, 14, 2, 23, 63, 10925 }, // �
-    { 11, 24, 14, 2, 24, 62, 10988 }, // �
-    { 8, 23, 8, -1, 23, 32, 11050 }, // �
-    { 8, 23, 8, 2, 23, 29, 11082 }, // �
-    { 12, 23, 8, -2, 23, 40, 11111 }, // �
-    { 10, 24, 8, -1, 24, 37, 11151 }, // �
-    { 18, 18, 19, 0, 18, 107, 11188 }, // �
-    { 17, 23, 20, 2, 23, 129, 11295 }, // �
-    { 18, 23, 20, 1, 23, 120, 11424 }, // �
-    { 18, 23, 20, 1, 23, 118, 11544 }, // �
-    { 18, 23, 20, 1, 23, 131, 11662 }, // �
-    { 18, 23, 20, 1, 23, 131, 11793 }, // �
-    { 18, 24, 20, 1, 24, 128, 11924 }, // �
-    { 12, 13, 14, 1, 15, 64, 12052 }, // �
-    { 18, 20, 20, 1, 19, 161, 12116 }, // �
-    { 15, 23, 19, 2, 23, 86, 12277 }, // �
-    { 15, 23, 19, 2, 23, 86, 12363 }, // �
-    { 15, 23, 19, 2, 23, 93, 12449 }, // �
-    { 15, 24, 19, 2, 24, 94, 12542 }, // �
-    { 16, 23, 16, 0, 23, 116, 12636 }, // �
-    { 13, 18, 16, 2, 18, 64, 12752 }, // �
-    { 16, 19, 18, 1, 19, 127, 12816 }, // �
-    { 13, 20, 15, 1, 20, 118, 12943 }, // �
-    { 13, 20, 15, 1, 20, 119, 13061 }, // �
-    { 13, 20, 15, 1, 20, 123, 13180 }, // �
-    { 13, 20, 15, 1, 20, 126, 13303 }, // �
-    { 13, 20, 15, 1, 20, 127, 13429 }, // �
-    { 13, 22, 15, 1, 22, 122, 13556 }, // �
-    { 21, 14, 23, 1, 14, 140, 13678 }, // �
-    { 12, 20, 13, 1, 14, 103, 13818 }, // �
-    { 13, 20, 15, 1, 20, 115, 13921 }, // �
-    { 13, 20, 15, 1, 20, 117, 14036 }, // �
-    { 13, 20, 15, 1, 20, 116, 14153 }, // �
-    { 13, 20, 15, 1, 20, 120, 14269 }, // �
-    { 8, 20, 8, -2, 20, 31, 14389 }, // �
-    { 8, 20, 8, 1, 20, 31, 14420 }, // �
-    { 12, 20, 8, -2, 20, 40, 14451 }, // �
-    { 10, 20, 8, -1, 20, 36, 14491 }, // �
-    { 14, 19, 15, 1, 19, 127, 14527 }, // �
-    { 14, 20, 16, 1, 20, 87, 14654 }, // �
-    { 14, 20, 15, 1, 20, 117, 14741 }, // �
-    { 14, 20, 15, 1, 20, 117, 14858 }, // �
-    { 14, 20, 15, 1, 20, 124, 14975 }, // �
-    { 14, 20, 15, 1, 20, 127, 15099 }, // �
-    { 14, 20, 15, 1, 20, 127, 15226 }, // �
-    { 13, 13, 14, 1, 15, 42, 15353 }, // �
-    { 14, 16, 15, 1, 15, 112, 15395 }, // �
-    { 14, 20, 16, 1, 20, 80, 15507 }, // �
-    { 14, 20, 16, 1, 20, 80, 15587 }, // �
-    { 14, 20, 16, 1, 20, 88, 15667 }, // �
-    { 14, 20, 16, 1, 20, 86, 15755 }, // �
-    { 15, 26, 14, 0, 20, 148, 15841 }, // �
-    { 14, 25, 16, 1, 19, 90, 15989 }, // �
-    { 15, 26, 14, 0, 20, 152, 16079 }, // �
-};
-const UnicodeInterval OpenSans12BIntervals[] = {
-    { 0x20, 0x7E, 0x0 },
-    { 0xA0, 0xFF, 0x5F },
-};
-const GFXfont OpenSans12B = {
-    (uint8_t*)OpenSans12BBitmaps,
-    (GFXglyph*)OpenSans12BGlyphs,
-    (UnicodeInterval*)OpenSans12BIntervals,
-    2,
-    1,
-    34,
-    27,
-    -8,
-};
+// Generated by tools/fontsubset.py from ../Font Files/opensans12b.h, do not edit
+#pragma once
+#include "epd_driver.h"
+const uint8_t OpenSans12BBitmaps[16231] = {
+    0x78, 0x9C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 0x9C, 0xFB, 0xFE, 0x9F, 0xEB, 0xFB, 0x7F,
+    0xCE, 0x6F, 0xFF, 0x39, 0xBF, 0xFE, 0xE7, 0xF8, 0xF2, 0x9F, 0xFD, 0xF3, 0x7F, 0xB6, 0x4F, 0xFF,
+    0x59, 0x3F, 0xFE, 0x67, 0x01, 0xA2, 0x0F, 0xFF, 0x99, 0x3F, 0xFC, 0x67, 0x5A, 0x70, 0x86, 0x91,
+    0x01, 0x08, 0x18, 0x19, 0x1E, 0xBD, 0x67, 0xFE, 0x01, 0x56, 0xBC, 0xF1, 0x3C, 0x13, 0x00, 0x95,
+    0xED, 0x1E, 0x71, 0x78, 0x9C, 0x01, 0x1E, 0x00, 0xE1, 0xFF, 0xF5, 0xFF, 0x20, 0xFF, 0x2F, 0xF4,
+    0xEF, 0x10, 0xFF, 0x0F, 0xF2, 0xDF, 0x00, 0xFF, 0x0F, 0xF1, 0xBF, 0x00, 0xFE, 0x0E, 0xF0, 0xAF,
+    0x00, 0xFD, 0x0C, 0xE0, 0x9F, 0x00, 0xFC, 0x0B, 0x1D, 0xC2, 0x11, 0x0D, 0x78, 0x9C, 0x63, 0x60,
+    0x30, 0xF8, 0xCF, 0xFE, 0xB1, 0x9F, 0x81, 0x81, 0x21, 0xE1, 0x3F, 0xCB, 0x97, 0x78, 0x20, 0x3D,
+    0xE1, 0x3F, 0xE3, 0x77, 0x7D, 0x20, 0x7D, 0xE0, 0x3D, 0xC3, 0x2F, 0x7E, 0x20, 0xFD, 0x61, 0x3F,
+    0xC3, 0x5F, 0x1E, 0xA0, 0x28, 0x18, 0xCC, 0x87, 0xD1, 0x01, 0x33, 0xFF, 0xCC, 0x3F, 0xF9, 0x7F,
+    0x66, 0x24, 0x03, 0xC3, 0x6F, 0xBE, 0x05, 0xFF, 0x81, 0xCA, 0x18, 0xFE, 0x73, 0x3F, 0xD8, 0xCF,
+    0xC0, 0xF0, 0x1D, 0x22, 0xCF, 0x03, 0xA3, 0x9B, 0x4F, 0xFC, 0xEF, 0xF8, 0x33, 0xBF, 0x83, 0x8D,
+    0x61, 0xC3, 0x7F, 0x86, 0xDF, 0x20, 0xE3, 0x1E, 0x9C, 0x67, 0xF8, 0xC7, 0x03, 0x32, 0x76, 0x3E,
+    0xC3, 0x7F, 0x2E, 0x20, 0xFD, 0x39, 0x1F, 0xE8, 0x00, 0x20, 0xFD, 0xD5, 0x1F, 0xE8, 0x00, 0x06,
+    0x06, 0x00, 0x54, 0xCE, 0x46, 0xB2, 0x78, 0x9C, 0x63, 0x60, 0x58, 0xC0, 0xCF, 0x00, 0x02, 0x10,
+    0x6A, 0xF2, 0xDF, 0xF7, 0x6B, 0xC4, 0x18, 0x1A, 0xFE, 0x03, 0xC1, 0x7D, 0x86, 0x6F, 0x20, 0xAA,
+    0x9E, 0xE1, 0xCF, 0xFF, 0xAD, 0xF2, 0x2D, 0xB2, 0x0C, 0xFF, 0xEE, 0x83, 0x95, 0xFC, 0xFE, 0xBF,
+    0x03, 0x44, 0x7D, 0xF9, 0xFF, 0xDF, 0x1E, 0x48, 0x25, 0x00, 0x55, 0xC4, 0x00, 0xE9, 0x45, 0x40,
+    0x5A, 0x1A, 0x48, 0x1F, 0xFC, 0xFF, 0xFF, 0x3C, 0xC8, 0x30, 0xFF, 0x7F, 0xFF, 0x99, 0x18, 0x81,
+    0x66, 0x7E, 0xFB, 0xCF, 0xB2, 0x4F, 0x6D, 0x81, 0xFC, 0xEF, 0xFF, 0x4C, 0xFF, 0x40, 0x86, 0x9D,
+    0x67, 0x00, 0x53, 0x32, 0x0C, 0x89, 0xA7, 0xFE, 0xBD, 0x8F, 0x46, 0x58, 0x0B, 0xA1, 0x00, 0x7A,
+    0xF8, 0x3F, 0x41, 0x78, 0x9C, 0x35, 0x8E, 0x4D, 0x0E, 0xC1, 0x40, 0x00, 0x85, 0x9F, 0x14, 0x49,
+    0xAB, 0x88, 0x1B, 0xF4, 0x06, 0xBA, 0x27, 0x99, 0xAE, 0x6C, 0xB9, 0x81, 0x23, 0xB8, 0xC2, 0x24,
+    0xD6, 0xF4, 0x08, 0x7A, 0x83, 0x4E, 0xE2, 0x00, 0x2C, 0x2C, 0x2D, 0xDC, 0xA0, 0x47, 0xF0, 0x53,
+    0x1A, 0xA5, 0xE6, 0x99, 0x8A, 0xD9, 0xBD, 0xBC, 0x7C, 0xF9, 0xDE, 0xC3, 0x81, 0x23, 0x00, 0xCF,
+    0x05, 0x10, 0x91, 0x74, 0x10, 0xB0, 0x0B, 0xEC, 0x79, 0x64, 0x07, 0x09, 0x9B, 0xC0, 0x85, 0x03,
+    0xF6, 0x91, 0xEF, 0x0C, 0x74, 0x3B, 0x43, 0x0B, 0x54, 0xC2, 0xC4, 0x3C, 0xC3, 0x47, 0x44, 0xF4,
+    0x6C, 0x7B, 0x62, 0x03, 0x7F, 0xB6, 0x88, 0xA5, 0x5E, 0x41, 0x19, 0x83, 0xAF, 0x7B, 0x6F, 0xD2,
+    0x0B, 0x8D, 0x77, 0xC9, 0x09, 0x53, 0x0A, 0x6C, 0x39, 0xBE, 0x66, 0x92, 0x6E, 0x19, 0x1B, 0x1C,
+    0xE5, 0x3C, 0x61, 0xBB, 0xA8, 0xD5, 0x01, 0x7D, 0xC5, 0xD6, 0xA3, 0x8E, 0x8A, 0x8E, 0x6D, 0xEF,
+    0x29, 0x2C, 0x5B, 0x0D, 0x11, 0x72, 0xC3, 0x29, 0x30, 0xA3, 0x0B, 0xBC, 0x68, 0xFE, 0xE1, 0xB7,
+    0x2A, 0xF5, 0x1A, 0x5F, 0xB5, 0x91, 0x5B, 0xCC, 0x78, 0x9C, 0x1D, 0x8D, 0xC1, 0x09, 0xC2, 0x40,
+    0x14, 0x44, 0x87, 0x68, 0xC0, 0x08, 0x6A, 0x4A, 0x48, 0x09, 0xC1, 0x06, 0xAC, 0x40, 0xB6, 0x03,
+    0xB5, 0x10, 0x41, 0xB1, 0x81, 0x34, 0x20, 0x58, 0x4A, 0xEC, 0xC0, 0x1A, 0xA2, 0x07, 0xC1, 0x93,
+    0x07, 0x35, 0x87, 0x4D, 0xF6, 0xF9, 0x37, 0xEF, 0x32, 0x0F, 0xFE, 0x67, 0x46, 0xE5, 0x8B, 0xBD,
+    0x22, 0x2D, 0x30, 0xB3, 0x2C, 0x20, 0x50, 0x99, 0xEC, 0x70, 0x79, 0xA8, 0x07, 0x59, 0xA8, 0xBB,
+    0x98, 0x94, 0x1C, 0x8E, 0xB8, 0xF8, 0xEC, 0xE9, 0x99, 0x46, 0x69, 0x20, 0x5E, 0x94, 0x7B, 0x98,
+    0xE8, 0xCD, 0xFC, 0x6A, 0x35, 0x5B, 0x7D, 0xC9, 0x5A, 0xD6, 0x81, 0xD4, 0x93, 0xF4, 0x24, 0x77,
+    0x2A, 0x6A, 0x81, 0x8A, 0x00, 0x2B, 0x93, 0x44, 0x0F, 0xC8, 0xAC, 0x66, 0xB3, 0x7C, 0x42, 0xAA,
+    0x0F, 0x03, 0xCE, 0xB6, 0x8C, 0x1B, 0x8C, 0x75, 0xEA, 0x38, 0x8F, 0x7E, 0xB8, 0x3F, 0xB7, 0x76,
+    0x57, 0xD4, 0x78, 0x9C, 0xFB, 0xFA, 0x9F, 0xE1, 0xCB, 0x7B, 0x86, 0x4F, 0xF7, 0x19, 0x3E, 0xEE,
+    0x67, 0xF8, 0xB0, 0x9E, 0xE1, 0xC1, 0x7C, 0x06, 0x00, 0x6D, 0xE0, 0x0A, 0x77, 0x78, 0x9C, 0x25,
+    0x8C, 0xCB, 0x0D, 0x40, 0x40, 0x00, 0x44, 0x9F, 0x8B, 0x13, 0x35, 0x6D, 0x09, 0x4A, 0xA0, 0x03,
+    0x3A, 0x50, 0x0A, 0x1D, 0xD1, 0x01, 0x35, 0x10, 0x2B, 0xF1, 0x1B, 0x23, 0x0E, 0x93, 0xCC, 0x9F,
+    0x5E, 0x29, 0xDB, 0x00, 0x4F, 0xA0, 0x52, 0xCE, 0x68, 0xB9, 0x28, 0x21, 0x4E, 0x70, 0x74, 0x70,
+    0xB5, 0x8E, 0x4A, 0x50, 0xF1, 0xE3, 0xE3, 0x77, 0x0D, 0xA7, 0xB3, 0xDD, 0xB3, 0x55, 0x30, 0x7B,
+    0xD3, 0x28, 0x73, 0x21, 0x40, 0xB4, 0xE9, 0xCF, 0x17, 0x29, 0x86, 0x22, 0xDF, 0x78, 0x9C, 0x7B,
+    0xF0, 0x9F, 0x89, 0x21, 0xE0, 0x3F, 0x0F, 0x03, 0xC3, 0x9F, 0x7C, 0x06, 0x86, 0xAF, 0xF7, 0x19,
+    0x18, 0x1E, 0xFC, 0x67, 0x61, 0x98, 0xF0, 0x9F, 0x0B, 0x28, 0xC8, 0xC7, 0xA0, 0xF0, 0x5F, 0x9E,
+    0x81, 0xE1, 0xBF, 0x3F, 0x03, 0xC3, 0xBF, 0x78, 0x06, 0x86, 0xBF, 0xF9, 0x10, 0x0C, 0x62, 0x03,
+    0xC5, 0x04, 0xFE, 0xEB, 0x83, 0xD5, 0x80, 0xD4, 0x3E, 0xF8, 0xCF, 0xCA, 0xF0, 0xF5, 0x3D, 0xD0,
+    0x8C, 0x7A, 0xA0, 0x10, 0x2F, 0x90, 0xCB, 0xC4, 0x00, 0x00, 0xC9, 0xE0, 0x21, 0x75, 0x78, 0x9C,
+    0x63, 0x60, 0xD8, 0xF0, 0x9F, 0x95, 0x01, 0x08, 0x16, 0xFC, 0x67, 0x06, 0x51, 0x0D, 0xFF, 0x99,
+    0x18, 0x18, 0x12, 0x58, 0x12, 0xFE, 0x33, 0x04, 0xB2, 0x3C, 0xF8, 0xBF, 0xFA, 0xFF, 0x8D, 0xFF,
+    0x9C, 0x1F, 0xFF, 0x83, 0x00, 0x77, 0xE1, 0x8C, 0xDF, 0xFF, 0xD7, 0x77, 0xB2, 0x31, 0x30, 0xFC,
+    0xFA, 0xEF, 0x0F, 0x54, 0x98, 0xF0, 0xFF, 0xE7, 0x7B, 0x46, 0x06, 0x86, 0x4F, 0xFF, 0x9B, 0xFE,
+    0x73, 0x33, 0x30, 0x7C, 0xDF, 0x2F, 0xF0, 0x5F, 0x8F, 0x81, 0x41, 0xC1, 0x9B, 0x61, 0x26, 0x23,
+    0x03, 0x14, 0x00, 0x00, 0xC2, 0x2E, 0x23, 0x96, 0x78, 0x9C, 0x63, 0x60, 0x38, 0x14, 0xC3, 0x00,
+    0x02, 0x9F, 0xEB, 0x71, 0x51, 0xFF, 0xFE, 0x83, 0x00, 0x33, 0x94, 0x5A, 0xB9, 0xEA, 0xF7, 0xFD,
+    0x55, 0xAB, 0x98, 0xF0, 0x69, 0x60, 0x60, 0x48, 0x54, 0x03, 0x12, 0x00, 0x8A, 0x3E, 0x1D, 0xB1,
+    0x78, 0x9C, 0x13, 0xF8, 0x5F, 0xEF, 0xF0, 0xDF, 0xBE, 0xE0, 0x3F, 0xDF, 0x82, 0xFF, 0x1C, 0x0F,
+    0xFE, 0x33, 0x7E, 0x5C, 0xCF, 0x00, 0x00, 0x5B, 0xF7, 0x09, 0xB1, 0x78, 0x9C, 0xFB, 0xF2, 0xFF,
+    0xBF, 0xFF, 0x17, 0x28, 0x16, 0x10, 0x14, 0x64, 0x04, 0x00, 0x6A, 0x0C, 0x09, 0xF7, 0x78, 0x9C,
+    0x63, 0x60, 0x64, 0x78, 0xF4, 0x9E, 0xF9, 0xC7, 0x7F, 0xAE, 0xEF, 0xFF, 0x39, 0x37, 0x9E, 0x67,
+    0x02, 0x00, 0x34, 0xAA, 0x07, 0x58, 0x78, 0x9C, 0x15, 0xCA, 0xCB, 0x0D, 0x40, 0x50, 0x00, 0x44,
+    0xD1, 0x47, 0x22, 0x24, 0x42, 0x74, 0x40, 0x27, 0x4A, 0xA0, 0x13, 0x4A, 0xD0, 0x89, 0x12, 0xE8,
+    0x40, 0x09, 0x94, 0xA0, 0x03, 0x11, 0x9F, 0xC4, 0x27, 0xC6, 0x7D, 0xB3, 0x38, 0x9B, 0xB9, 0xC6,
+    0x98, 0x43, 0x86, 0x3D, 0x1D, 0x24, 0x2A, 0xB0, 0x56, 0x8C, 0x93, 0x02, 0xDC, 0xE4, 0xE2, 0x35,
+    0xDA, 0xE4, 0xAB, 0xA0, 0x54, 0x8A, 0xBD, 0x42, 0x5C, 0xE5, 0xE1, 0xB9, 0xD8, 0xF3, 0x6D, 0x21,
+    0x53, 0x8E, 0x8D, 0x22, 0x9C, 0xE5, 0xE3, 0x2E, 0x07, 0xEF, 0xC1, 0x26, 0x3F, 0x8B, 0x1B, 0x1E,
+    0x94, 0x78, 0x9C, 0x63, 0x60, 0x38, 0xFE, 0xBF, 0x97, 0x91, 0x81, 0xE1, 0xE2, 0xFF, 0xFF, 0xFF,
+    0xF5, 0x18, 0x18, 0x7E, 0x03, 0xA9, 0xFB, 0x0C, 0x06, 0xFF, 0xEF, 0x0B, 0xFD, 0xFA, 0xCF, 0x36,
+    0xE1, 0xBF, 0x3D, 0xC3, 0x83, 0xFF, 0x3C, 0x07, 0xFE, 0xF3, 0x31, 0x2C, 0xF8, 0xCF, 0xFF, 0xE1,
+    0x3F, 0x0F, 0x43, 0xC3, 0x7F, 0xFB, 0x0F, 0xFF, 0xB9, 0x19, 0x12, 0xFE, 0xFB, 0x7F, 0xFC, 0xCF,
+    0x05, 0xA4, 0xE2, 0xA1, 0x14, 0x54, 0xF0, 0x01, 0x44, 0x09, 0x44, 0x83, 0x7C, 0x03, 0x58, 0x3B,
+    0xAF, 0x02, 0xD8, 0x30, 0x0E, 0x86, 0x5F, 0x40, 0xA3, 0xDF, 0x33, 0x32, 0x1C, 0x00, 0x52, 0xF6,
+    0x0C, 0x0C, 0x0C, 0xC7, 0xFE, 0xCF, 0x65, 0x64, 0x00, 0x00, 0xB7, 0xEA, 0x43, 0x29, 0x78, 0x9C,
+    0x63, 0x60, 0x48, 0xF8, 0x1F, 0xCF, 0xC0, 0xF0, 0x13, 0x48, 0x1C, 0xFC, 0xFF, 0x3F, 0xDE, 0xE0,
+    0x1F, 0x90, 0xF8, 0xFC, 0xBF, 0xEF, 0x7F, 0xFC, 0x81, 0xFB, 0x49, 0xFF, 0xE3, 0x05, 0x38, 0xC1,
+    0xB2, 0x60, 0xA2, 0x80, 0x44, 0x02, 0x00, 0xA8, 0xE8, 0x27, 0x9D, 0x78, 0x9C, 0x63, 0x50, 0x38,
+    0xF1, 0x6F, 0x1D, 0x33, 0x03, 0xC3, 0xCF, 0xFF, 0xFF, 0xFF, 0xF7, 0x33, 0x1C, 0xF8, 0x0F, 0x02,
+    0xAC, 0x0E, 0xFF, 0xEB, 0x8C, 0x7F, 0xFD, 0xE7, 0x61, 0x98, 0xC6, 0xC0, 0xF0, 0xE0, 0x3F, 0x1F,
+    0x03, 0x10, 0x1C, 0x80, 0x50, 0x1F, 0xFE, 0x73, 0x83, 0xA8, 0x1F, 0xFF, 0x59, 0x81, 0xA4, 0xC3,
+    0xFF, 0xF3, 0x20, 0xCE, 0xE7, 0xFF, 0x72, 0x40, 0xD2, 0xE0, 0xDF, 0x7B, 0x26, 0x20, 0xF5, 0xF8,
+    0xBF, 0x1E, 0x98, 0x73, 0x1F, 0xC2, 0x91, 0x85, 0xC8, 0x28, 0x2B, 0x29, 0x09, 0x3D, 0x00, 0x1B,
+    0x5D, 0xFF, 0x01, 0x85, 0x02, 0x00, 0x8A, 0x09, 0x3B, 0x37, 0x78, 0x9C, 0x63, 0x28, 0x7C, 0xFD,
+    0x7F, 0x2D, 0x0B, 0x43, 0xC3, 0x7F, 0x20, 0x58, 0x0F, 0xA1, 0xFE, 0xB3, 0x31, 0xDC, 0x55, 0x57,
+    0xFC, 0xF5, 0x9F, 0x9B, 0x81, 0x91, 0x81, 0xE1, 0x03, 0x90, 0x02, 0x82, 0x8F, 0xFF, 0xD9, 0x81,
+    0xA4, 0xE3, 0x9F, 0xFB, 0x0C, 0x0C, 0x0E, 0x40, 0x15, 0x9C, 0x60, 0x6A, 0x3D, 0x2B, 0x90, 0x7A,
+    0xF7, 0xFF, 0xFF, 0x7D, 0x26, 0xA0, 0x9C, 0xC2, 0xCF, 0xFF, 0xBC, 0x20, 0x95, 0x07, 0xFE, 0xDB,
+    0x83, 0xA8, 0x0D, 0xFF, 0xFD, 0x41, 0xD4, 0x83, 0xFF, 0xF6, 0x0F, 0x3C, 0x19, 0x0D, 0x7F, 0xFF,
+    0xE7, 0xFB, 0x00, 0x31, 0x1A, 0x4C, 0xD5, 0x33, 0x18, 0x1C, 0xFF, 0xFB, 0xBE, 0x87, 0x89, 0x01,
+    0x00, 0x85, 0xEF, 0x3B, 0xA4, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x50, 0xF8, 0xBF, 0x9F, 0x01, 0x08,
+    0x0E, 0x40, 0xA8, 0xEF, 0x60, 0xCA, 0xE0, 0x3F, 0x98, 0xBA, 0xF0, 0xFE, 0x1F, 0x88, 0xFA, 0x91,
+    0xFF, 0x17, 0x48, 0x39, 0xFC, 0xE7, 0x01, 0xF1, 0x1E, 0xFC, 0x67, 0x02, 0xC9, 0xFD, 0xAA, 0x67,
+    0x00, 0x52, 0x01, 0xFF, 0x79, 0x40, 0xD4, 0xC3, 0xFF, 0x4C, 0x20, 0xEA, 0xC7, 0x7F, 0x10, 0x78,
+    0xFF, 0x13, 0x42, 0x41, 0x78, 0xF7, 0x41, 0x86, 0x42, 0x8C, 0xC6, 0xA4, 0x00, 0x7F, 0x74, 0x3C,
+    0xC4, 0x78, 0x9C, 0x3B, 0xF0, 0x1F, 0x08, 0xF8, 0x18, 0x2E, 0x40, 0xA8, 0x0F, 0x30, 0xCA, 0xD2,
+    0xD8, 0x98, 0x89, 0xE1, 0xE3, 0x7F, 0x36, 0x06, 0x20, 0xF8, 0xF4, 0x9F, 0x05, 0x44, 0x7D, 0xF9,
+    0xFF, 0xF7, 0xBD, 0x37, 0x03, 0xC3, 0x57, 0x90, 0x12, 0x0E, 0x08, 0x15, 0xCF, 0xA0, 0xA0, 0xAA,
+    0x78, 0xF5, 0xFF, 0x79, 0x90, 0xB4, 0xC0, 0xFF, 0xFF, 0x20, 0x8A, 0xE1, 0xF7, 0x7F, 0x46, 0x10,
+    0xF5, 0xE7, 0x3F, 0x23, 0x23, 0x48, 0xF0, 0x3D, 0xC3, 0x1E, 0x33, 0xA0, 0x92, 0xF9, 0x40, 0x01,
+    0x20, 0x90, 0x03, 0x53, 0xF7, 0x99, 0x18, 0x9A, 0xDE, 0xFC, 0xDF, 0x07, 0x34, 0x1C, 0x00, 0x5D,
+    0x0A, 0x3F, 0x41, 0x78, 0x9C, 0x63, 0x60, 0x50, 0x38, 0xF1, 0xEF, 0x3D, 0x13, 0x03, 0xC3, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x33, 0x33, 0x1C, 0xF8, 0x0F, 0xA6, 0x7E, 0xFC, 0xF7, 0x66, 0x14, 0x60, 0x10,
+    0xF8, 0x5F, 0xCF, 0x00, 0x04, 0x05, 0xFF, 0x79, 0x41, 0xD4, 0x86, 0xFF, 0x12, 0xAF, 0xDE, 0x4B,
+    0x32, 0x3C, 0xF8, 0xFF, 0xE2, 0xFF, 0xFF, 0xF7, 0x4C, 0x1F, 0x40, 0x0A, 0xFF, 0xF3, 0x7C, 0xFC,
+    0xBF, 0x9E, 0xF1, 0xD1, 0x7F, 0xFD, 0x8F, 0x40, 0x25, 0x09, 0xFF, 0xF3, 0x3F, 0xFC, 0xE7, 0x62,
+    0x30, 0xF8, 0x5F, 0xFF, 0xE0, 0x3F, 0x0F, 0x83, 0xC3, 0xFF, 0xFC, 0x05, 0xFF, 0xF5, 0x19, 0x1A,
+    0xFE, 0xFB, 0x3B, 0xFC, 0xBF, 0x2F, 0xFC, 0xF5, 0x3F, 0x3F, 0xC3, 0x2F, 0x90, 0x06, 0x76, 0xA0,
+    0x31, 0xFF, 0xFF, 0xCF, 0x07, 0x1A, 0xB7, 0xF5, 0xDF, 0x3E, 0x16, 0x06, 0x00, 0x30, 0x95, 0x43,
+    0x9C, 0x78, 0x9C, 0xFB, 0xFA, 0x1F, 0x04, 0xEA, 0xBF, 0x22, 0x53, 0xF9, 0x0A, 0x4A, 0x4A, 0x4A,
+    0x87, 0xFE, 0xF3, 0x33, 0x00, 0xC1, 0xA7, 0xFF, 0x1C, 0x20, 0xEA, 0xE7, 0x7F, 0x26, 0x20, 0x29,
+    0xF0, 0x7F, 0x3F, 0x88, 0x53, 0xF0, 0xDF, 0x1F, 0x44, 0x3D, 0xF8, 0xCF, 0x0B, 0xA2, 0xBE, 0xFD,
+    0x67, 0x03, 0x51, 0x7F, 0xDF, 0x83, 0x48, 0x87, 0xFF, 0xFD, 0x20, 0xEA, 0xC0, 0x7F, 0x79, 0x10,
+    0xF5, 0xF9, 0x3F, 0x17, 0x88, 0xFA, 0xF5, 0x9F, 0x19, 0xAC, 0xF9, 0x3C, 0x88, 0xD3, 0xF0, 0x3F,
+    0x1E, 0x44, 0x7D, 0xF8, 0xCF, 0x07, 0x24, 0x01, 0xC9, 0xC5, 0x30, 0x43, 0x78, 0x9C, 0x1D, 0x8B,
+    0xBD, 0x0D, 0x82, 0x60, 0x00, 0x05, 0x9F, 0x44, 0xD4, 0x88, 0x3F, 0x2B, 0x7C, 0x13, 0x50, 0xD2,
+    0xCA, 0x04, 0xE2, 0x06, 0x8C, 0xA0, 0x95, 0xB5, 0x23, 0x38, 0x89, 0x32, 0x81, 0x71, 0x01, 0x42,
+    0xA2, 0x15, 0x24, 0x14, 0xB8, 0x00, 0x10, 0x43, 0x45, 0xF0, 0xFC, 0xB4, 0x7C, 0x77, 0xF7, 0x64,
+    0x72, 0x2E, 0x63, 0xA9, 0x03, 0xAE, 0x32, 0x50, 0xC2, 0xE4, 0xC0, 0x5E, 0x6F, 0x16, 0x27, 0xD6,
+    0xBA, 0xB3, 0xDC, 0x11, 0xA9, 0x62, 0xAE, 0x0F, 0xC1, 0x80, 0xA3, 0x97, 0x2D, 0xB7, 0xFA, 0xA5,
+    0xB5, 0x23, 0x3D, 0xFF, 0xCB, 0x50, 0x1F, 0xC1, 0x4D, 0xF0, 0xF5, 0x60, 0xD5, 0x30, 0x53, 0x48,
+    0xD4, 0x32, 0xB5, 0x22, 0x6E, 0x2C, 0x4C, 0xD8, 0x9C, 0x21, 0x05, 0x4F, 0xBD, 0x3D, 0x64, 0x23,
+    0x85, 0x05, 0x37, 0x57, 0x5F, 0x75, 0xD0, 0x46, 0xE4, 0x78, 0x9C, 0x1D, 0x8C, 0xCD, 0x0D, 0x01,
+    0x51, 0x00, 0x06, 0x87, 0x10, 0x1B, 0x84, 0x16, 0x28, 0xC0, 0x4F, 0x07, 0x2E, 0xEE, 0x5B, 0xC2,
+    0x2A, 0x40, 0x62, 0x3B, 0x20, 0x51, 0x00, 0x0D, 0x48, 0x74, 0xF4, 0x5C, 0xDD, 0x74, 0xB0, 0xAC,
+    0x88, 0x44, 0x6C, 0xC6, 0x3E, 0x97, 0x6F, 0x2E, 0x33, 0x1F, 0xA3, 0x6B, 0xB1, 0x06, 0x5E, 0xEA,
+    0x84, 0x79, 0xBD, 0x16, 0x9C, 0x3D, 0x8C, 0x3F, 0x26, 0x77, 0xFB, 0x5C, 0x1C, 0x94, 0x26, 0xEC,
+    0x9C, 0x95, 0x76, 0x58, 0x99, 0x3E, 0xEC, 0x72, 0x74, 0x73, 0x33, 0xE3, 0x6D, 0x96, 0xC7, 0xC0,
+    0x94, 0xAF, 0x6E, 0x5D, 0x90, 0x57, 0x61, 0xE9, 0xB0, 0xBE, 0xAB, 0x95, 0x5E, 0xC4, 0xD3, 0x36,
+    0x0D, 0xF6, 0x06, 0x88, 0xE2, 0xF4, 0x8F, 0xD0, 0x84, 0xAA, 0x38, 0xB5, 0xE0, 0x07, 0x45, 0x49,
+    0x41, 0xF6, 0x78, 0x9C, 0x3B, 0x78, 0x9E, 0xE9, 0xFB, 0x7F, 0xCE, 0x1F, 0xFF, 0xB9, 0x1E, 0xBD,
+    0x67, 0x66, 0x60, 0x64, 0x40, 0x01, 0x8C, 0x0C, 0x40, 0x41, 0xA0, 0x14, 0x50, 0xC1, 0xC6, 0xF3,
+    0x4C, 0x00, 0x45, 0x4A, 0x0E, 0xBF, 0x78, 0x9C, 0x13, 0xF8, 0xA3, 0x53, 0xF0, 0x7F, 0x7E, 0xC3,
+    0xFF, 0xF5, 0x0A, 0xFF, 0xEC, 0x18, 0x04, 0x18, 0x30, 0x81, 0xC0, 0xFF, 0x7A, 0x87, 0xFF, 0xF6,
+    0x05, 0xFF, 0xF9, 0x16, 0xFC, 0xE7, 0x78, 0xF0, 0x9F, 0xF1, 0xE3, 0x7A, 0x06, 0x00, 0x93, 0x15,
+    0x10, 0x91, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x82, 0x02, 0x26, 0x30, 0xF9, 0x8F, 0x19, 0x4C, 0xFE,
+    0x67, 0x06, 0x93, 0x75, 0x60, 0x32, 0x17, 0x4C, 0xFA, 0x00, 0x25, 0xFE, 0xFE, 0xB7, 0x06, 0xA9,
+    0xFA, 0xF7, 0x3F, 0x1A, 0x44, 0x2D, 0xFE, 0xFF, 0xBF, 0x8E, 0x11, 0x48, 0x37, 0xFE, 0xFB, 0xBF,
+    0x9E, 0x05, 0x48, 0x27, 0xFC, 0xFD, 0x7F, 0x1F, 0xC4, 0x77, 0xF8, 0x0D, 0xD2, 0xCE, 0xC0, 0xA0,
+    0xF0, 0x13, 0x4C, 0x31, 0x08, 0x30, 0x00, 0x00, 0xF7, 0x4D, 0x1E, 0x57, 0x78, 0x9C, 0xFB, 0xF7,
+    0x1F, 0x04, 0x98, 0xFF, 0x41, 0xA8, 0x95, 0xAB, 0x40, 0x80, 0x89, 0x01, 0x02, 0xA0, 0xBC, 0x7F,
+    0x28, 0x4A, 0x00, 0x2D, 0xE6, 0x1F, 0xEB, 0x78, 0x9C, 0x93, 0x60, 0x00, 0x83, 0x7F, 0x92, 0x10,
+    0xEA, 0x3F, 0x98, 0x3E, 0xFA, 0x1F, 0x42, 0x6F, 0x81, 0xD2, 0x8B, 0xA0, 0xF4, 0xC4, 0xFF, 0xFF,
+    0x99, 0x80, 0xD4, 0xE4, 0xFF, 0xFF, 0x99, 0x19, 0x18, 0x8E, 0xFD, 0xFF, 0xEF, 0xC3, 0xA0, 0xF0,
+    0xE2, 0xFF, 0x7F, 0x2B, 0x06, 0x86, 0xDF, 0xFF, 0xDF, 0x4B, 0x80, 0xB4, 0xDF, 0x67, 0x03, 0x29,
+    0xDB, 0xC7, 0x02, 0x36, 0x8C, 0x09, 0x62, 0x34, 0x00, 0xB0, 0x91, 0x1C, 0xC3, 0x78, 0x9C, 0x53,
+    0xD8, 0xFE, 0xEF, 0xBE, 0x04, 0xC3, 0xCF, 0xFF, 0xFF, 0xFF, 0xBF, 0x67, 0xFE, 0x0E, 0x24, 0xFF,
+    0xF3, 0x3E, 0x88, 0x66, 0xDC, 0xF4, 0xDF, 0x9E, 0x81, 0x81, 0xC1, 0xE1, 0xBF, 0x3F, 0x90, 0x2C,
+    0xF8, 0xAF, 0x0F, 0x24, 0xBF, 0xFE, 0xE7, 0x61, 0x60, 0x68, 0xF8, 0x7F, 0x9F, 0x91, 0x01, 0xA8,
+    0x56, 0x1A, 0x24, 0xD7, 0xCF, 0x00, 0x12, 0x00, 0x8A, 0x32, 0x4C, 0xF8, 0xCF, 0xC9, 0x00, 0x07,
+    0x82, 0x0C, 0x60, 0x3D, 0x5C, 0x40, 0xF2, 0x03, 0x58, 0xE7, 0x03, 0x30, 0x19, 0xF0, 0x8F, 0x83,
+    0x81, 0x01, 0x00, 0xCE, 0x39, 0x25, 0x7C, 0x78, 0x9C, 0x2D, 0x8E, 0xBB, 0x0E, 0x01, 0x51, 0x18,
+    0x84, 0x87, 0xB8, 0x6C, 0x14, 0x56, 0xA5, 0x5D, 0x6F, 0x60, 0xDF, 0x00, 0x89, 0x4A, 0x43, 0x23,
+    0x4A, 0x95, 0x46, 0x23, 0xD1, 0x0B, 0x6F, 0xE0, 0x11, 0x2C, 0xBD, 0xCB, 0x0B, 0xA0, 0x44, 0x45,
+    0xA2, 0x54, 0xAC, 0x44, 0xA2, 0xA0, 0x58, 0xB7, 0xB8, 0xED, 0x3A, 0xE3, 0x1C, 0x31, 0xC5, 0xFC,
+    0x5F, 0x31, 0xF3, 0x67, 0x00, 0xD4, 0x8F, 0x9C, 0xC4, 0xA1, 0xD4, 0xA5, 0x52, 0x48, 0x92, 0x29,
+    0x9C, 0x6A, 0x71, 0xC6, 0xA1, 0xC4, 0x2B, 0x35, 0xE9, 0x6B, 0xE5, 0x22, 0xAF, 0x52, 0x31, 0x91,
+    0x44, 0x8B, 0x61, 0xF3, 0xC0, 0xB1, 0x76, 0xEB, 0xE0, 0x64, 0xE3, 0x21, 0x5B, 0xC6, 0xCA, 0xC1,
+    0xAD, 0x59, 0x60, 0x3B, 0xEB, 0xE9, 0x16, 0x7D, 0xCF, 0xD4, 0x8A, 0x01, 0x78, 0x7A, 0x8B, 0xFE,
+    0xB7, 0x71, 0xB6, 0x81, 0x8F, 0x44, 0x9F, 0xAB, 0x5F, 0xA6, 0x00, 0xA3, 0x16, 0xE1, 0xEA, 0xB2,
+    0x98, 0x66, 0x74, 0x3B, 0xC5, 0xCB, 0x18, 0x31, 0xB7, 0x67, 0xED, 0x95, 0xC7, 0xBD, 0x6C, 0xCA,
+    0x5F, 0x1B, 0x32, 0x82, 0xCB, 0x12, 0x3D, 0xD1, 0x48, 0x78, 0x0D, 0xC0, 0x62, 0x18, 0x7F, 0x25,
+    0x44, 0x5B, 0x9D, 0x8C, 0xB2, 0x1D, 0x07, 0xA5, 0xCA, 0xC2, 0xF9, 0x6D, 0x72, 0xD5, 0x72, 0xFB,
+    0x17, 0x31, 0xE7, 0xC2, 0xE9, 0x07, 0x25, 0x7C, 0x01, 0x2A, 0xE5, 0x64, 0x2F, 0x78, 0x9C, 0x25,
+    0xCC, 0xDB, 0x0D, 0x82, 0x50, 0x10, 0x84, 0xE1, 0x89, 0x97, 0xA8, 0x11, 0x91, 0x0E, 0x48, 0xA8,
+    0xC0, 0xD8, 0x80, 0x2D, 0xD0, 0xC1, 0xA1, 0x13, 0x4A, 0xD0, 0x0E, 0xA4, 0x03, 0x5B, 0xB0, 0x03,
+    0x5B, 0x30, 0x34, 0x80, 0x31, 0x20, 0x09, 0x8A, 0xBF, 0x67, 0x8F, 0xF3, 0x32, 0xDF, 0xC3, 0xEE,
+    0x48, 0xFA, 0x92, 0xCA, 0xB2, 0x83, 0x32, 0xE0, 0x04, 0xB7, 0x80, 0x3B, 0x03, 0x13, 0x43, 0x4B,
+    0xCD, 0xD2, 0x30, 0x34, 0x15, 0x1B, 0x03, 0xE7, 0x9C, 0x83, 0xEF, 0x1C, 0x97, 0x70, 0xF4, 0xA8,
+    0xD8, 0xEA, 0xD3, 0x78, 0x3C, 0x88, 0xD4, 0x33, 0x93, 0x5E, 0x2C, 0xF4, 0x64, 0x25, 0xBD, 0xB1,
+    0xC4, 0x4A, 0x42, 0xE3, 0x54, 0xFC, 0x71, 0xD1, 0x15, 0x97, 0x65, 0x7B, 0xF0, 0x77, 0xB1, 0xAD,
+    0x33, 0xEF, 0xED, 0x41, 0x1D, 0xEB, 0x91, 0x69, 0x18, 0x4B, 0x7F, 0x2B, 0x3D, 0x49, 0x7E, 0x78,
+    0x9C, 0xFB, 0xF3, 0xFF, 0xFF, 0xFB, 0x39, 0x2C, 0x0C, 0x7F, 0xFE, 0x03, 0xC1, 0x7E, 0x08, 0xF5,
+    0x9F, 0xF3, 0xCF, 0x7F, 0x41, 0xA7, 0x5F, 0xFF, 0xF9, 0xFE, 0xFC, 0x67, 0x60, 0xF8, 0xF0, 0x9F,
+    0x1F, 0x42, 0x81, 0x78, 0x0A, 0x3F, 0xFF, 0x73, 0x80, 0x95, 0x9C, 0x87, 0xA8, 0x94, 0x86, 0x6A,
+    0x60, 0x05, 0xC9, 0x7D, 0xFF, 0x2F, 0x0F, 0x52, 0xB9, 0xE0, 0x7F, 0x3C, 0x88, 0x6A, 0xF8, 0x5F,
+    0x0F, 0xA2, 0x36, 0xFC, 0xCF, 0xFF, 0xF3, 0x5F, 0xC9, 0xE8, 0xE7, 0x7F, 0x7D, 0x88, 0x4A, 0x6E,
+    0x24, 0x8B, 0xD6, 0xB1, 0x30, 0x00, 0x00, 0xA7, 0xE2, 0x56, 0x8D, 0x78, 0x9C, 0x63, 0x60, 0x48,
+    0x78, 0xFD, 0x7F, 0x2D, 0x2B, 0x03, 0x83, 0xC1, 0xBF, 0xFF, 0xFF, 0xFF, 0xDF, 0x67, 0x60, 0xF8,
+    0x0A, 0xA4, 0xFE, 0xF7, 0x33, 0x08, 0xFC, 0xFB, 0x1F, 0x63, 0x7C, 0x4C, 0x9F, 0x61, 0xC1, 0xFF,
+    0xFD, 0x0C, 0x0C, 0x0C, 0x4C, 0x0C, 0x1F, 0xFE, 0xCB, 0x33, 0x80, 0xC0, 0x97, 0xFF, 0x5C, 0x60,
+    0xFA, 0xFB, 0x7F, 0x76, 0x30, 0xFD, 0xE3, 0x3F, 0x2B, 0x0A, 0xFD, 0xFD, 0x3F, 0x1B, 0x98, 0xFE,
+    0xFA, 0x9F, 0x13, 0x4C, 0x7F, 0xFC, 0xCF, 0x07, 0xA6, 0x0F, 0xFC, 0x9F, 0x0F, 0xA6, 0x1D, 0xFE,
+    0xFF, 0x8F, 0x36, 0x6A, 0x8D, 0x65, 0x60, 0xF8, 0x09, 0xB2, 0x27, 0x9F, 0x81, 0xA1, 0x01, 0x4A,
+    0x33, 0x34, 0xBD, 0x79, 0x0F, 0x74, 0x07, 0x00, 0xCF, 0x69, 0x36, 0xD8, 0x78, 0x9C, 0xFB, 0xF3,
+    0xFF, 0xFF, 0xFB, 0x6A, 0x46, 0x06, 0x86, 0x3F, 0xFF, 0x81, 0xA0, 0x1F, 0x4A, 0xFF, 0xE7, 0x06,
+    0xD2, 0x82, 0x4E, 0x3F, 0xFF, 0xCF, 0x07, 0xD2, 0x0C, 0x0C, 0x0E, 0xFF, 0xFF, 0x33, 0x81, 0x68,
+    0x86, 0x9F, 0xFF, 0x39, 0xC0, 0xF4, 0xA7, 0xFF, 0x3C, 0x60, 0xFA, 0xC3, 0x7F, 0x7E, 0x30, 0xFD,
+    0x00, 0x8D, 0xFE, 0xF0, 0x9F, 0x0F, 0x4C, 0x7F, 0xFE, 0xCF, 0x0D, 0xA6, 0x7F, 0xFD, 0x67, 0x07,
+    0xD1, 0x09, 0xFF, 0xFF, 0x33, 0xFE, 0xF9, 0xAF, 0x14, 0xF4, 0xFB, 0x7F, 0x3D, 0xD4, 0x1E, 0x4E,
+    0x08, 0x9D, 0x07, 0xB6, 0xF7, 0x5E, 0x16, 0x50, 0x29, 0x00, 0x6D, 0x42, 0x51, 0xA2, 0x78, 0x9C,
+    0xFB, 0xF3, 0x1F, 0x08, 0x38, 0xFE, 0xA0, 0x90, 0x82, 0x82, 0x82, 0x0C, 0x7F, 0xFE, 0x33, 0x00,
+    0x01, 0x2A, 0x09, 0x04, 0x8C, 0xA8, 0x24, 0x2E, 0x95, 0x4A, 0x4A, 0x4A, 0x8C, 0x7F, 0x30, 0x4C,
+    0x06, 0x00, 0xD3, 0x8C, 0x3F, 0x8C, 0x78, 0x9C, 0xFB, 0xF3, 0x1F, 0x08, 0xD8, 0xFF, 0xA0, 0x90,
+    0x82, 0x82, 0x82, 0x0C, 0x7F, 0xFE, 0x33, 0x00, 0x01, 0x36, 0x12, 0x08, 0xD0, 0x48, 0xFC, 0xEA,
+    0x11, 0x24, 0x00, 0x41, 0x00, 0x36, 0x10, 0x78, 0x9C, 0x63, 0x60, 0x30, 0x38, 0xF1, 0xEF, 0x7E,
+    0x35, 0x13, 0x83, 0xC2, 0x9F, 0xFF, 0x40, 0xC0, 0xC7, 0xF0, 0x18, 0x44, 0xFD, 0x67, 0x17, 0xF8,
+    0xF7, 0x7F, 0xBE, 0x4A, 0xF0, 0x2F, 0xC6, 0x09, 0xFF, 0xDF, 0x33, 0x33, 0x00, 0xC1, 0x87, 0xFF,
+    0xFE, 0x20, 0x8A, 0xE1, 0xCB, 0x7F, 0x1E, 0x30, 0xFD, 0xED, 0x3F, 0x07, 0x98, 0xFE, 0xF1, 0x9F,
+    0x8D, 0x01, 0xA8, 0x5E, 0xFE, 0xC7, 0x7F, 0x56, 0x30, 0xFD, 0xFD, 0x3F, 0x3B, 0x98, 0xFE, 0xFA,
+    0x9F, 0x8B, 0x41, 0x69, 0xD1, 0x7F, 0xF9, 0x8F, 0xFF, 0xE5, 0x19, 0x18, 0x26, 0xFC, 0x97, 0xDF,
+    0xF0, 0x7F, 0x3D, 0x98, 0x76, 0xF8, 0xFF, 0x3F, 0xC6, 0xF8, 0x08, 0x50, 0xF0, 0x07, 0xD8, 0x1E,
+    0x79, 0x86, 0x02, 0x28, 0xCD, 0x50, 0xF8, 0xE6, 0xFF, 0xB9, 0x2C, 0x26, 0x00, 0x1C, 0x3E, 0x4A,
+    0x0B, 0x78, 0x9C, 0xFB, 0xF3, 0x9F, 0x81, 0x81, 0xE1, 0xC1, 0x7F, 0xBE, 0x3F, 0x24, 0xD3, 0x60,
+    0x80, 0x85, 0x56, 0x52, 0x52, 0x7A, 0x44, 0x8E, 0x79, 0x10, 0x1A, 0x00, 0xF4, 0xC2, 0x50, 0x0D,
+    0x78, 0x9C, 0xFB, 0xF3, 0x9F, 0xE1, 0x0F, 0xE9, 0x08, 0x00, 0xE6, 0x70, 0x23, 0xA7, 0x78, 0x9C,
+    0x63, 0x60, 0xF8, 0xF3, 0x9F, 0x81, 0x81, 0xEA, 0xC4, 0x5F, 0x20, 0x21, 0xF0, 0xFF, 0x3E, 0x83,
+    0xC9, 0x91, 0xFF, 0xF3, 0x81, 0x9C, 0xFF, 0xFA, 0x20, 0x82, 0x8D, 0xE1, 0xF7, 0x7B, 0x2B, 0x06,
+    0x06, 0x00, 0x6B, 0x52, 0x30, 0x7B, 0x78, 0x9C, 0x3D, 0xCD, 0xCB, 0x0D, 0x40, 0x40, 0x18, 0x04,
+    0xE0, 0x3F, 0x59, 0x11, 0x9C, 0x54, 0x40, 0x09, 0x4A, 0x51, 0x02, 0x25, 0xE8, 0x40, 0x0B, 0x3A,
+    0xA1, 0x04, 0x1D, 0x28, 0x45, 0x64, 0x0F, 0x22, 0x1E, 0x63, 0x67, 0x22, 0x4E, 0xDF, 0x65, 0x1E,
+    0x17, 0xCC, 0xF2, 0x07, 0xEE, 0x0A, 0xCE, 0x68, 0x8C, 0x1E, 0x48, 0x69, 0x8B, 0xC5, 0xA8, 0x47,
+    0x41, 0x43, 0x2A, 0xA2, 0x13, 0x7A, 0xA3, 0x3B, 0x32, 0x89, 0xDF, 0x5A, 0x8E, 0x58, 0xA5, 0x3B,
+    0x91, 0xA8, 0xBF, 0xA1, 0x92, 0xDD, 0xB7, 0x67, 0x37, 0x62, 0xE9, 0x51, 0xCA, 0x01, 0xA3, 0xE4,
+    0xC3, 0x0B, 0x43, 0x04, 0x4A, 0x09, 0x78, 0x9C, 0xFB, 0xF3, 0x9F, 0x01, 0x08, 0xFE, 0x50, 0x99,
+    0x54, 0x52, 0x52, 0x62, 0xFA, 0xF3, 0x1F, 0x08, 0xFC, 0x91, 0x49, 0x00, 0x3E, 0x9A, 0x2D, 0xF3,
+    0x78, 0x9C, 0x25, 0xCD, 0xC1, 0x0D, 0x82, 0x40, 0x14, 0x45, 0xD1, 0xA7, 0x21, 0x1A, 0x03, 0xB1,
+    0x05, 0xDC, 0xBB, 0x40, 0x17, 0xAC, 0xB5, 0x04, 0x3A, 0xA0, 0x84, 0xB1, 0x13, 0xEC, 0x40, 0x3A,
+    0xA0, 0x84, 0xB1, 0x03, 0x4A, 0xC0, 0x12, 0x34, 0x12, 0x93, 0x09, 0x64, 0x9E, 0xFF, 0xF3, 0xEF,
+    0xEA, 0xEC, 0xEE, 0xCC, 0x06, 0x12, 0x59, 0xCF, 0x1C, 0x04, 0xD5, 0x22, 0xAE, 0x81, 0xD6, 0xB4,
+    0x05, 0xDE, 0x2A, 0xCF, 0x0C, 0x18, 0xBD, 0xA8, 0x61, 0x0E, 0x04, 0xA7, 0x9A, 0x1C, 0x10, 0x0B,
+    0xD1, 0xE3, 0xE7, 0x71, 0xE5, 0x51, 0xF5, 0x21, 0xEE, 0x2C, 0x55, 0x4F, 0x26, 0x2F, 0x9E, 0x45,
+    0xDD, 0x8D, 0xBB, 0xAF, 0x3F, 0xA9, 0x0E, 0xDC, 0x07, 0xB7, 0x08, 0xF1, 0x12, 0x73, 0x53, 0xE8,
+    0x99, 0x9A, 0x46, 0x72, 0x63, 0x92, 0xE9, 0xCA, 0xD4, 0xB2, 0x87, 0xA9, 0xA2, 0x53, 0xFD, 0x01,
+    0x62, 0xBF, 0x69, 0xD3, 0x78, 0x9C, 0x35, 0xCC, 0x41, 0x0D, 0x80, 0x30, 0x0C, 0x05, 0xD0, 0xC2,
+    0x65, 0x07, 0x44, 0x6C, 0x8E, 0x90, 0x80, 0x05, 0x1C, 0x20, 0x01, 0x09, 0x95, 0xC0, 0x1C, 0x2D,
+    0x48, 0x20, 0x0C, 0x12, 0x92, 0x8D, 0x4F, 0xD3, 0xB2, 0xDB, 0x3B, 0xBD, 0x82, 0x91, 0x88, 0x2E,
+    0x74, 0x05, 0xA9, 0x01, 0xAE, 0xC1, 0x1B, 0x12, 0xD8, 0xB0, 0x54, 0xF4, 0x8A, 0x35, 0x63, 0x50,
+    0x70, 0xC4, 0x64, 0x08, 0x12, 0x28, 0xE8, 0x81, 0xCB, 0x82, 0x8D, 0x76, 0x78, 0xC3, 0x0C, 0x3E,
+    0x15, 0x54, 0x71, 0x1B, 0x32, 0x5E, 0x43, 0x04, 0x0C, 0xA1, 0x41, 0x82, 0x1F, 0x87, 0xE0, 0x03,
+    0xF0, 0xEC, 0x5E, 0x0A, 0x78, 0x9C, 0x63, 0x60, 0x28, 0x7C, 0xFD, 0x7F, 0x1F, 0x1B, 0x03, 0x03,
+    0x43, 0xC2, 0x7F, 0x20, 0x78, 0xCF, 0xC2, 0xC0, 0xF0, 0x1D, 0xC4, 0xF8, 0x1F, 0xCF, 0x60, 0xF0,
+    0xFF, 0x7F, 0x8E, 0xF1, 0xB5, 0xFF, 0xFF, 0x99, 0x36, 0xFC, 0xDF, 0x0F, 0x94, 0xFF, 0xF3, 0x9F,
+    0xF3, 0xE3, 0x7F, 0x79, 0x20, 0xE3, 0xD3, 0x7F, 0xFE, 0xAF, 0xFF, 0xB9, 0x81, 0x8C, 0x03, 0xFF,
+    0xED, 0xBF, 0xFF, 0xE7, 0x00, 0x32, 0x26, 0xFC, 0x8F, 0xFF, 0xF1, 0x9F, 0x1D, 0xC8, 0x68, 0xF8,
+    0x9F, 0x0F, 0x67, 0xC0, 0xA5, 0xBE, 0xC0, 0x14, 0xC3, 0xB5, 0xC3, 0x0D, 0x84, 0x5B, 0x01, 0xB7,
+    0x14, 0xE1, 0x0C, 0x98, 0xC3, 0x00, 0x07, 0x93, 0x51, 0x70, 0x78, 0x9C, 0xFB, 0xF3, 0xFF, 0xFF,
+    0xFB, 0x68, 0x06, 0x86, 0x3F, 0xFF, 0x81, 0x40, 0x06, 0x42, 0xED, 0x07, 0x52, 0x82, 0xCD, 0xFF,
+    0xFF, 0x33, 0xFF, 0xF9, 0xCF, 0xC0, 0xF0, 0xF3, 0x3F, 0x3B, 0x88, 0xFA, 0xFA, 0x9F, 0x03, 0x89,
+    0xFA, 0xF5, 0x9F, 0x0D, 0xA8, 0x64, 0xC9, 0xFF, 0xFF, 0x8C, 0x60, 0x0D, 0xFD, 0x10, 0x7D, 0x9C,
+    0x20, 0xEA, 0xBE, 0x25, 0xC8, 0x30, 0x06, 0x10, 0x20, 0x82, 0x02, 0x00, 0x68, 0x90, 0x42, 0xAD,
+    0x78, 0x9C, 0x63, 0x60, 0x28, 0x7C, 0xFD, 0x7F, 0x1F, 0x1B, 0x03, 0x03, 0x43, 0xC2, 0x7F, 0x20,
+    0x78, 0xCF, 0xC2, 0xC0, 0xF0, 0x1D, 0xC4, 0xF8, 0x1F, 0xCF, 0x60, 0xF0, 0xFF, 0x7F, 0x8E, 0xF1,
+    0xB5, 0xFF, 0xFF, 0x99, 0x36, 0xFC, 0xDF, 0x0F, 0x94, 0xFF, 0xF3, 0x9F, 0xF3, 0xE3, 0x7F, 0x79,
+    0x20, 0xE3, 0xD3, 0x7F, 0xFE, 0xAF, 0xFF, 0xB9, 0x81, 0x8C, 0x03, 0xFF, 0xED, 0xBF, 0xFF, 0xE7,
+    0x00, 0x32, 0x26, 0xFC, 0x8F, 0xFF, 0xF1, 0x9F, 0x1D, 0xC8, 0x68, 0xF8, 0x9F, 0x0F, 0x67, 0xC0,
+    0xA5, 0xBE, 0xC0, 0x14, 0xC3, 0xB5, 0xC3, 0x0D, 0x84, 0x5B, 0x01, 0xB5, 0x34, 0x1F, 0xE6, 0x0C,
+    0x56, 0xA0, 0x3C, 0xD0, 0x61, 0x40, 0x57, 0x80, 0x41, 0xC0, 0xFF, 0xFF, 0xCC, 0x10, 0xD6, 0x8F,
+    0xFF, 0x7A, 0x10, 0xC6, 0x86, 0xFF, 0xEF, 0x19, 0xC1, 0x0C, 0x81, 0xBF, 0xFF, 0x65, 0x01, 0x30,
+    0xDF, 0x5B, 0x59, 0x78, 0x9C, 0x2D, 0xCC, 0xBB, 0x0D, 0x80, 0x30, 0x0C, 0x04, 0x50, 0x13, 0xF1,
+    0x2B, 0x28, 0xC8, 0x00, 0x2C, 0xC6, 0x12, 0x20, 0x16, 0xA0, 0x60, 0x00, 0xD8, 0x30, 0x23, 0x20,
+    0x04, 0x12, 0x05, 0x81, 0xC3, 0x9F, 0xB8, 0x79, 0xB2, 0xEE, 0xEC, 0x08, 0x84, 0x9E, 0x88, 0x22,
+    0x78, 0xBA, 0x64, 0x10, 0xFD, 0x02, 0xE4, 0x2C, 0xD1, 0x8D, 0x4A, 0xBD, 0x50, 0xA7, 0xBD, 0x14,
+    0x27, 0x20, 0xB3, 0xFE, 0x60, 0x77, 0x7B, 0x61, 0xAE, 0xFA, 0xCF, 0x3F, 0x70, 0x22, 0x1D, 0x68,
+    0xD4, 0x11, 0xB3, 0x4A, 0x2F, 0x07, 0xE2, 0xC9, 0x81, 0xB8, 0x71, 0x20, 0xB6, 0x1F, 0xDC, 0x0F,
+    0x74, 0xB1, 0x4E, 0xCB, 0x78, 0x9C, 0x63, 0x68, 0xFC, 0xF3, 0xBE, 0x87, 0xD9, 0xE0, 0xDF, 0xFF,
+    0xFF, 0xFF, 0xEB, 0x1F, 0x02, 0x89, 0xFF, 0xFA, 0xDF, 0xFE, 0xFB, 0x04, 0xDF, 0xE0, 0xF9, 0xF9,
+    0x9F, 0x89, 0x81, 0x81, 0xE1, 0xE7, 0x7F, 0x66, 0x20, 0xF9, 0xED, 0xBF, 0x1F, 0x90, 0x7C, 0xF0,
+    0xFF, 0xBF, 0x0F, 0x03, 0x83, 0x02, 0x50, 0xA5, 0x0D, 0x03, 0xC3, 0x44, 0xA0, 0x4A, 0x56, 0x06,
+    0x86, 0x49, 0x40, 0xF5, 0x40, 0xA9, 0x43, 0xFF, 0xFB, 0x81, 0xA4, 0xC0, 0xFF, 0xFD, 0xA2, 0x40,
+    0xEA, 0xFF, 0xFE, 0xBF, 0x59, 0xCA, 0x5B, 0xFE, 0xF7, 0xFF, 0x05, 0x99, 0x26, 0x07, 0x22, 0xDF,
+    0x33, 0x17, 0xBE, 0xFE, 0xBF, 0x8F, 0x9D, 0x01, 0x00, 0x58, 0x8A, 0x3A, 0x16, 0x78, 0x9C, 0xFB,
+    0xF1, 0x1F, 0x0C, 0x7E, 0xA0, 0x50, 0x8A, 0x4A, 0x9B, 0xFE, 0xFB, 0x2B, 0x29, 0x31, 0x30, 0x2C,
+    0xF8, 0xAF, 0xCF, 0xC0, 0x40, 0x43, 0x0A, 0x00, 0x5D, 0x16, 0x30, 0xA2, 0x78, 0x9C, 0xFB, 0xF7,
+    0x9E, 0x81, 0x81, 0xE1, 0xC3, 0x7F, 0x9E, 0x7F, 0x54, 0xA6, 0xFF, 0x42, 0x68, 0xEE, 0x3F, 0xFF,
+    0x19, 0x19, 0x18, 0x3E, 0xFF, 0xE7, 0xFA, 0xF9, 0x9F, 0x9D, 0x81, 0x01, 0x48, 0x7C, 0xFE, 0x3F,
+    0xDF, 0x64, 0xC9, 0xFF, 0xFF, 0x8C, 0x13, 0xFE, 0x83, 0x40, 0x3E, 0x48, 0x0C, 0x08, 0xD8, 0x18,
+    0x18, 0x0C, 0x6E, 0xFE, 0x3F, 0xA7, 0xCE, 0xC0, 0x00, 0x00, 0x72, 0x01, 0x4A, 0x2F, 0x78, 0x9C,
+    0x1D, 0xCE, 0x5B, 0x0D, 0xC2, 0x40, 0x14, 0x84, 0xE1, 0xBF, 0x84, 0x4B, 0x08, 0x04, 0x70, 0x50,
+    0x9C, 0x80, 0x04, 0x1C, 0x20, 0xA1, 0x75, 0x02, 0x12, 0x70, 0x80, 0x84, 0x56, 0x02, 0x0E, 0x8A,
+    0x04, 0xBA, 0x21, 0x34, 0x5C, 0xDA, 0x61, 0x76, 0xE7, 0xE5, 0xCC, 0xCB, 0x77, 0x32, 0xBD, 0x70,
+    0xBE, 0xCA, 0x3A, 0x8D, 0x61, 0xA3, 0x8A, 0xA0, 0x39, 0x1C, 0x54, 0x70, 0xD3, 0x0A, 0x2E, 0xCA,
+    0x29, 0xB5, 0x83, 0x87, 0x16, 0x6C, 0x75, 0x82, 0xA7, 0xA6, 0xD0, 0x37, 0xF0, 0x56, 0x06, 0x9D,
+    0x46, 0x0C, 0x95, 0x5F, 0x04, 0xCD, 0xF6, 0x46, 0x50, 0x6B, 0x79, 0x36, 0xC2, 0x2C, 0xBF, 0x1B,
+    0x61, 0x56, 0x84, 0x88, 0xE0, 0x77, 0x7D, 0x45, 0x64, 0xD6, 0x7C, 0x22, 0x82, 0x56, 0xC3, 0x31,
+    0x95, 0x5A, 0x5A, 0xA7, 0x52, 0x2A, 0xA1, 0x38, 0x46, 0x13, 0x9F, 0x3F, 0x19, 0xFD, 0x3D, 0xDE,
+    0x78, 0x9C, 0x25, 0x8F, 0xC1, 0x0D, 0x82, 0x40, 0x14, 0x44, 0x87, 0xA8, 0x51, 0x13, 0x92, 0xA5,
+    0x04, 0x0A, 0xB0, 0x07, 0x4A, 0x80, 0x1A, 0x6C, 0xC0, 0x12, 0x28, 0x01, 0x2E, 0xD6, 0x61, 0x09,
+    0x94, 0x00, 0x47, 0x6F, 0x94, 0x80, 0x24, 0x62, 0x80, 0x0D, 0x3B, 0xCE, 0x0F, 0x87, 0xDD, 0x9F,
+    0x9D, 0xFC, 0xBC, 0x37, 0x1B, 0x7A, 0x00, 0x1B, 0x75, 0xAD, 0xC4, 0xC2, 0x08, 0x09, 0x79, 0x04,
+    0x42, 0x8B, 0x49, 0xB3, 0x20, 0x2F, 0x48, 0x59, 0x61, 0xD4, 0xAC, 0xC9, 0x58, 0x49, 0x8E, 0x4E,
+    0xB3, 0x63, 0x70, 0x4A, 0xF6, 0x33, 0x0E, 0x7E, 0x4F, 0x0B, 0x66, 0xF8, 0x35, 0x73, 0x85, 0x8F,
+    0xF6, 0x13, 0x96, 0x58, 0xCB, 0xA9, 0xC7, 0xD7, 0x88, 0xDB, 0x0B, 0x21, 0x1F, 0x19, 0xCD, 0xE6,
+    0x5A, 0x86, 0x94, 0xAE, 0xE3, 0xC9, 0xB7, 0x7A, 0x4C, 0xBC, 0x33, 0xAE, 0x79, 0x95, 0x06, 0x12,
+    0x3D, 0x79, 0x2E, 0x78, 0x93, 0x06, 0x42, 0xBE, 0x79, 0x48, 0xF8, 0x90, 0x02, 0x12, 0x79, 0x1A,
+    0x46, 0x1A, 0x58, 0xB1, 0x46, 0x18, 0xAB, 0x07, 0xAB, 0x5C, 0x1A, 0xC6, 0x34, 0xF6, 0x99, 0xCC,
+    0x30, 0xA6, 0xB1, 0x0D, 0x67, 0x18, 0xD3, 0xFC, 0x01, 0x3B, 0x3D, 0x6E, 0xA6, 0x78, 0x9C, 0x25,
+    0x8C, 0x61, 0x0D, 0xC2, 0x50, 0x0C, 0x84, 0x0F, 0xC8, 0xFB, 0x01, 0x19, 0x64, 0x0A, 0x16, 0x9C,
+    0x80, 0x03, 0x2C, 0xCC, 0x01, 0x48, 0xC0, 0x01, 0x38, 0x18, 0x0E, 0xC0, 0x01, 0x38, 0x00, 0x0B,
+    0x53, 0xB0, 0x00, 0x0B, 0x24, 0xCB, 0xDE, 0x3E, 0xDA, 0x47, 0x93, 0xE6, 0xBE, 0xF6, 0xDA, 0x6B,
+    0x99, 0x4B, 0x4B, 0x1A, 0x9D, 0xD8, 0x4A, 0x17, 0x36, 0xCA, 0x07, 0x46, 0x6A, 0x99, 0x49, 0x1F,
+    0xA6, 0x8A, 0x36, 0xE8, 0xC6, 0x6A, 0xE7, 0xB6, 0x1D, 0xDE, 0x6B, 0x32, 0x03, 0x7D, 0x89, 0x8C,
+    0x1D, 0x1E, 0x70, 0x70, 0xD5, 0x1A, 0x8F, 0xB2, 0x3A, 0x42, 0x91, 0xE0, 0x0D, 0xD7, 0x04, 0xB1,
+    0xE9, 0x08, 0xA6, 0x16, 0x52, 0x27, 0xEF, 0x45, 0x56, 0x72, 0x36, 0xE8, 0x99, 0x58, 0x07, 0x95,
+    0x54, 0xBE, 0x2D, 0xF4, 0x64, 0x21, 0xED, 0xCD, 0xFB, 0x7F, 0x0C, 0x84, 0x1F, 0xAE, 0xE0, 0x43,
+    0xD7, 0x78, 0x9C, 0x95, 0xCB, 0xC1, 0x09, 0x83, 0x40, 0x00, 0x00, 0xC1, 0x0D, 0x22, 0x01, 0x51,
+    0xB0, 0x02, 0x49, 0x07, 0xB1, 0xA3, 0xB3, 0x14, 0x3B, 0x48, 0x0B, 0x96, 0x60, 0x07, 0x96, 0x62,
+    0x3A, 0x90, 0x70, 0x0F, 0x91, 0x03, 0x57, 0xAF, 0x84, 0xEC, 0x67, 0x5E, 0x9B, 0x2C, 0x61, 0x36,
+    0x44, 0x1B, 0x88, 0xD6, 0x93, 0x01, 0x92, 0xC5, 0xCB, 0x95, 0xDE, 0x05, 0x0E, 0xCB, 0xD9, 0x37,
+    0xFC, 0x6C, 0xA2, 0x15, 0x8C, 0x86, 0xE4, 0x03, 0xDA, 0x73, 0xF3, 0xC3, 0xDD, 0xAE, 0x5D, 0xF6,
+    0xAB, 0xCF, 0xEC, 0xE0, 0x96, 0xA1, 0xCD, 0xF7, 0xDF, 0x5E, 0x78, 0x2B, 0x34, 0x12, 0x78, 0x9C,
+    0xFB, 0xF4, 0x1F, 0x04, 0xD6, 0x7F, 0x42, 0xA6, 0xFA, 0x15, 0x94, 0x94, 0x94, 0xBE, 0xFC, 0xE7,
+    0x65, 0x00, 0x82, 0x3F, 0xFF, 0x99, 0x81, 0x64, 0xC1, 0xFF, 0x7E, 0x10, 0xE7, 0x33, 0x44, 0xEC,
+    0x2F, 0x58, 0xAC, 0xE1, 0x7F, 0x3D, 0x44, 0x8C, 0x07, 0x22, 0xC6, 0x04, 0x24, 0x27, 0xFC, 0xCF,
+    0x07, 0x71, 0xBE, 0xFC, 0xE7, 0x06, 0x92, 0x02, 0xFF, 0xFE, 0x33, 0x02, 0xA9, 0x05, 0xFF, 0xEB,
+    0x81, 0xC6, 0x09, 0x7D, 0x01, 0x1B, 0xFD, 0xFE, 0x1B, 0x0A, 0x05, 0x00, 0x0F, 0x81, 0x41, 0x6D,
+    0x78, 0x9C, 0xFB, 0xF2, 0xFF, 0x3F, 0xD7, 0x17, 0x30, 0x9E, 0xC9, 0xF6, 0xE5, 0x3D, 0x03, 0x03,
+    0x45, 0x18, 0x64, 0x06, 0xD4, 0x3C, 0x00, 0x5F, 0x26, 0x2F, 0x45, 0x78, 0x9C, 0xFB, 0xB5, 0x9F,
+    0x01, 0x08, 0xBE, 0xFC, 0x67, 0x04, 0x92, 0x0F, 0xFE, 0xB3, 0x03, 0xC9, 0x09, 0xFF, 0x79, 0x81,
+    0xA4, 0xC1, 0x7F, 0x7B, 0x90, 0xC4, 0xDF, 0xF9, 0x20, 0xF2, 0xFB, 0x7B, 0x10, 0xF9, 0xF1, 0x3F,
+    0x0B, 0x90, 0xDC, 0xF0, 0x9F, 0x0B, 0x48, 0x06, 0xFC, 0x97, 0x07, 0x09, 0xFD, 0xCF, 0x07, 0x91,
+    0x3F, 0xCF, 0x83, 0xC8, 0xCF, 0xFF, 0x99, 0x80, 0xE4, 0x85, 0xFF, 0x1C, 0x40, 0xB2, 0xE1, 0x3F,
+    0x1F, 0x90, 0x54, 0xF8, 0xEF, 0x0F, 0x92, 0xF8, 0xB3, 0x1E, 0x44, 0x7E, 0xFB, 0xCF, 0x00, 0x00,
+    0xAF, 0x1F, 0x1E, 0xD7, 0x78, 0x9C, 0xFB, 0xF6, 0xFF, 0x3F, 0xC7, 0x37, 0x20, 0x9E, 0x7C, 0xF3,
+    0x3F, 0x07, 0xC3, 0x02, 0xCA, 0x30, 0xC8, 0x8C, 0x6F, 0x50, 0xF3, 0x00, 0x89, 0xC3, 0x2B, 0x47,
+    0x78, 0x9C, 0x63, 0x60, 0x38, 0x50, 0xCF, 0x00, 0x02, 0x9F, 0xDF, 0x83, 0xA9, 0x5F, 0xFF, 0xD9,
+    0x81, 0xA4, 0xC2, 0xFF, 0xFF, 0x7C, 0x40, 0x6A, 0xC2, 0xFF, 0xAF, 0x20, 0xC9, 0x0F, 0xEB, 0x0F,
+    0x80, 0x24, 0xBF, 0xDB, 0x3B, 0x80, 0x24, 0xFF, 0xF1, 0x32, 0xFC, 0xE5, 0x63, 0x08, 0xF8, 0xCF,
+    0xC6, 0x00, 0x94, 0x3C, 0xF0, 0x9F, 0x81, 0xE1, 0xC2, 0x7B, 0x86, 0xCF, 0xF3, 0x19, 0x18, 0x12,
+    0xFE, 0xB3, 0xFF, 0xB2, 0x07, 0x2A, 0xFB, 0xC7, 0x07, 0x00, 0x91, 0x45, 0x1D, 0xB5, 0x78, 0x9C,
+    0xDB, 0xB0, 0x1B, 0x08, 0xAC, 0x3F, 0xFC, 0x07, 0x82, 0x78, 0x00, 0x39, 0x9C, 0x09, 0x23, 0x78,
+    0x9C, 0xFB, 0xF5, 0x9F, 0x93, 0xA1, 0xE1, 0x7F, 0x3C, 0x03, 0xC3, 0xD7, 0xFF, 0x4C, 0x0C, 0x06,
+    0x7F, 0x79, 0x01, 0x43, 0x18, 0x07, 0x11, 0x78, 0x9C, 0x63, 0x98, 0xF2, 0xE7, 0x7F, 0x0D, 0x03,
+    0x43, 0xC1, 0x7F, 0x20, 0xD0, 0x63, 0x10, 0xF8, 0xFF, 0xFE, 0xCF, 0xFF, 0xFD, 0x0C, 0x0C, 0xE9,
+    0x8C, 0x0C, 0x7F, 0xFE, 0x33, 0x32, 0x00, 0xC1, 0x8F, 0xFF, 0xCC, 0x0C, 0x93, 0xEF, 0xFC, 0xFB,
+    0xFF, 0x9F, 0x79, 0x01, 0x48, 0xC9, 0x7F, 0xE6, 0xEF, 0xFF, 0xFB, 0x4C, 0x7E, 0xFE, 0x67, 0xFE,
+    0x0B, 0x14, 0x07, 0xCA, 0xFD, 0x7B, 0xCF, 0xC0, 0xF0, 0x1B, 0xC4, 0x63, 0x4A, 0x00, 0xCA, 0xFD,
+    0xFA, 0x7F, 0xFE, 0x2F, 0x90, 0xFA, 0x04, 0x54, 0xF7, 0xE4, 0x3F, 0xB3, 0xC2, 0xAB, 0xF7, 0x5A,
+    0x13, 0xFE, 0x33, 0x03, 0x00, 0xC1, 0xCA, 0x3B, 0x0D, 0x78, 0x9C, 0xFB, 0xF0, 0x9F, 0x8B, 0x01,
+    0x08, 0x3E, 0xE0, 0xA7, 0x5E, 0xBC, 0x97, 0x04, 0x52, 0xB7, 0xFE, 0xFF, 0x7F, 0xCF, 0xF8, 0xE1,
+    0x3F, 0x08, 0x70, 0x7F, 0xF8, 0xBF, 0x9F, 0xE9, 0xEB, 0x7F, 0xFD, 0x0F, 0xFF, 0xF9, 0x19, 0x1A,
+    0xFE, 0xE7, 0x7F, 0xF8, 0xCF, 0xC3, 0x60, 0xF0, 0x7F, 0x3E, 0x48, 0x83, 0xC2, 0xFF, 0xF5, 0x1F,
+    0xFE, 0x73, 0x43, 0x28, 0x1E, 0x06, 0x07, 0x90, 0xA0, 0x3C, 0xC3, 0x04, 0x90, 0x92, 0xF3, 0xCC,
+    0x60, 0x0D, 0x20, 0xC0, 0xF5, 0xE1, 0xFF, 0x8B, 0xFF, 0xFF, 0xEF, 0x03, 0x0D, 0x13, 0x78, 0x09,
+    0x34, 0x1A, 0x00, 0x0B, 0x74, 0x49, 0xEE, 0x78, 0x9C, 0x63, 0x70, 0x78, 0xF5, 0x7E, 0x2E, 0x0B,
+    0xC3, 0xEF, 0xFF, 0xFF, 0xFF, 0xF3, 0x2E, 0x00, 0x12, 0xFF, 0xD9, 0x3F, 0xFF, 0x8F, 0x17, 0x5C,
+    0xC2, 0xF8, 0xE3, 0x3F, 0x1B, 0x03, 0x03, 0xC3, 0x9F, 0xFF, 0x8C, 0x40, 0xF2, 0xEF, 0x7F, 0x06,
+    0x38, 0x09, 0x11, 0xF9, 0x09, 0x96, 0xFD, 0x0A, 0x54, 0x39, 0x99, 0xF3, 0x00, 0x48, 0x17, 0x97,
+    0xC2, 0x5F, 0x10, 0xC9, 0x50, 0xF0, 0xE6, 0x7F, 0x2F, 0x23, 0x00, 0xE7, 0xAF, 0x29, 0x28, 0x78,
+    0x9C, 0x63, 0x60, 0x60, 0x60, 0xB8, 0xF0, 0x9F, 0x8F, 0x01, 0x1F, 0xB5, 0xE8, 0x5F, 0xEF, 0x81,
+    0xFF, 0x7C, 0x06, 0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0x9F, 0xEF, 0xC2, 0x7F, 0x10, 0xE0, 0xFB, 0xFA,
+    0xDF, 0xCF, 0xF0, 0xCF, 0x7F, 0xBE, 0x9F, 0xFF, 0xD9, 0x18, 0x3E, 0xFE, 0xE7, 0xFB, 0xF3, 0x9F,
+    0x91, 0x61, 0xC3, 0x7F, 0xBE, 0xBF, 0xFF, 0x19, 0x18, 0x26, 0x00, 0xA9, 0xF7, 0x60, 0xEA, 0x0F,
+    0x90, 0xB7, 0x01, 0xA4, 0x84, 0x95, 0xE1, 0x01, 0x58, 0x83, 0xC2, 0x2F, 0xB8, 0x76, 0x90, 0x61,
+    0xDD, 0x60, 0xA3, 0x6B, 0x15, 0xFE, 0xF3, 0x01, 0x00, 0x08, 0x42, 0x45, 0x62, 0x78, 0x9C, 0x1D,
+    0x8A, 0xB1, 0x0D, 0x40, 0x60, 0x14, 0x06, 0x3F, 0x05, 0x09, 0x66, 0x91, 0x68, 0x2D, 0x21, 0xB6,
+    0xD1, 0x18, 0xC2, 0x08, 0x96, 0x30, 0x85, 0x84, 0x5E, 0x43, 0xAF, 0x90, 0x90, 0x08, 0xE1, 0xCF,
+    0x79, 0x5C, 0x73, 0xC5, 0x9D, 0x8A, 0x65, 0xAD, 0x24, 0xDD, 0x40, 0xA2, 0x86, 0xA9, 0x63, 0xD2,
+    0x46, 0xA8, 0x03, 0xFF, 0xC4, 0xD3, 0x4C, 0xF8, 0x25, 0x88, 0xDC, 0xAF, 0xD8, 0x51, 0x1A, 0xFE,
+    0x63, 0xCD, 0x38, 0x09, 0x3E, 0xED, 0xE4, 0x52, 0xAB, 0x1A, 0x7A, 0xB7, 0x4A, 0x97, 0x8D, 0xA6,
+    0x74, 0x64, 0xC8, 0xF4, 0x02, 0x24, 0xD6, 0x37, 0xD3, 0x78, 0x9C, 0x63, 0x60, 0x38, 0xFE, 0xFF,
+    0x1C, 0x1B, 0xC3, 0x86, 0xFF, 0xFF, 0xFF, 0xB3, 0x33, 0x7C, 0x06, 0x92, 0x4C, 0x0C, 0xDF, 0xFE,
+    0x73, 0x2A, 0x30, 0x30, 0x7C, 0xFF, 0xCF, 0xC2, 0xC0, 0x50, 0xF0, 0xEF, 0xFF, 0xFF, 0x7E, 0x86,
+    0x1F, 0xFF, 0x41, 0xE4, 0xB1, 0x7F, 0xFF, 0xCF, 0xE6, 0x40, 0xC5, 0x29, 0x21, 0x01, 0x4A, 0xAE,
+    0x30, 0x92, 0x78, 0x9C, 0x63, 0x48, 0x78, 0xFD, 0xFF, 0xFF, 0xFF, 0xFB, 0x0C, 0xBF, 0x81, 0xE4,
+    0xFF, 0xF3, 0x05, 0xFF, 0xD7, 0x97, 0xFE, 0x7F, 0xCF, 0x7C, 0xE0, 0x3F, 0x2F, 0xC3, 0xF7, 0xFF,
+    0x8C, 0x0F, 0xFE, 0x73, 0x33, 0x7C, 0xF9, 0xCF, 0x02, 0xE1, 0x31, 0x25, 0xFC, 0x5F, 0x9F, 0x02,
+    0x54, 0xC8, 0xF0, 0x13, 0xA8, 0x50, 0x8F, 0x81, 0xE1, 0xD1, 0xFF, 0xFF, 0x35, 0x8C, 0x0C, 0x0C,
+    0xFF, 0x78, 0x19, 0x80, 0xC0, 0xE1, 0xBF, 0x2E, 0x88, 0x52, 0x00, 0x19, 0xD2, 0xCB, 0xC8, 0xF0,
+    0x0D, 0x44, 0xF3, 0x16, 0xFC, 0x03, 0x51, 0xF5, 0xDF, 0xDF, 0xB3, 0x30, 0x38, 0xFC, 0x5B, 0xFF,
+    0x37, 0x1F, 0xA8, 0xE0, 0xD7, 0xFC, 0x7F, 0xFD, 0x0C, 0x0C, 0x06, 0xFF, 0xE3, 0x7F, 0xFD, 0xAF,
+    0x6E, 0xFF, 0xF3, 0x9F, 0xF7, 0x22, 0x48, 0xC5, 0x7E, 0x46, 0x86, 0x6D, 0xFF, 0xDE, 0xCF, 0x61,
+    0x66, 0x00, 0x00, 0xA6, 0xB5, 0x50, 0x7D, 0x78, 0x9C, 0xFB, 0xF0, 0x9F, 0x8B, 0x01, 0x08, 0x3E,
+    0xE0, 0xA5, 0x38, 0x6F, 0xBC, 0xF7, 0x06, 0x52, 0x37, 0xFF, 0xFF, 0xFF, 0xCF, 0xF6, 0xE1, 0x3F,
+    0x08, 0xC8, 0x7F, 0xF8, 0x7F, 0x9F, 0xF9, 0xF1, 0xFF, 0xF8, 0x0F, 0xFF, 0xF5, 0x19, 0x12, 0xFE,
+    0xF7, 0x7F, 0xF8, 0xCF, 0xCB, 0x60, 0x00, 0xA2, 0xB8, 0x19, 0x14, 0x40, 0x14, 0x17, 0x69, 0x14,
+    0x00, 0xB3, 0xC1, 0x43, 0xCE, 0x78, 0x9C, 0x9B, 0xF0, 0x9E, 0xE5, 0xD3, 0x7F, 0x9E, 0x8F, 0xFF,
+    0xB9, 0x1D, 0x3A, 0x19, 0x19, 0x18, 0x18, 0x3E, 0xFC, 0xE7, 0x22, 0x12, 0x01, 0x00, 0xA7, 0x7B,
+    0x21, 0xE4, 0x78, 0x9C, 0x63, 0x60, 0xF8, 0xE9, 0xC7, 0xA0, 0xF0, 0xFF, 0x3C, 0x83, 0xC0, 0xFF,
+    0xFD, 0x0C, 0x0C, 0x53, 0x24, 0x18, 0xC0, 0xE0, 0xFF, 0x7A, 0xB2, 0xB1, 0xC2, 0xFF, 0xF5, 0x82,
+    0x13, 0xFE, 0xF7, 0xFF, 0xFC, 0xFF, 0xDF, 0x1F, 0x88, 0xB9, 0x9E, 0xFF, 0xCF, 0x61, 0x00, 0x00,
+    0x6D, 0xB0, 0x2B, 0x78, 0x78, 0x9C, 0xFB, 0xF0, 0x9F, 0x8B, 0x01, 0x04, 0x3E, 0x10, 0x41, 0x17,
+    0xFC, 0xDF, 0x0F, 0xA6, 0xBF, 0xFE, 0xE7, 0x01, 0xD1, 0x0E, 0xFF, 0xEF, 0x33, 0x82, 0xE8, 0xCF,
+    0xFF, 0xF5, 0x40, 0xF2, 0x92, 0xFF, 0xFE, 0x33, 0x83, 0xE8, 0x13, 0xFF, 0xFD, 0xC1, 0xEA, 0xFF,
+    0xFD, 0xD7, 0x07, 0xD3, 0xFF, 0xFF, 0x9F, 0x07, 0xD3, 0xF7, 0x7F, 0xFD, 0xE7, 0x00, 0xD1, 0xBC,
+    0x17, 0xFE, 0xDB, 0x83, 0xCD, 0x33, 0xF8, 0xFF, 0x1E, 0xAC, 0x9F, 0xE1, 0x07, 0x10, 0x83, 0xE8,
+    0x03, 0xFF, 0xF3, 0xC1, 0xB4, 0xC2, 0xFF, 0xFF, 0x4C, 0x00, 0x53, 0xB0, 0x44, 0x3E, 0x78, 0x9C,
+    0xFB, 0xF0, 0x9F, 0xEB, 0x03, 0x59, 0x08, 0x00, 0x50, 0x76, 0x25, 0x7C, 0x78, 0x9C, 0xFB, 0xF0,
+    0x5E, 0xE0, 0xE5, 0x7B, 0x2B, 0x86, 0x63, 0xFF, 0x6B, 0x19, 0x3E, 0xFC, 0x7F, 0xFA, 0xFF, 0xFF,
+    0xFF, 0x25, 0x40, 0xCC, 0xFD, 0xE1, 0x3F, 0x0C, 0xF8, 0x7F, 0xF8, 0x7F, 0x9E, 0xE9, 0xEB, 0xFF,
+    0xFF, 0x62, 0x07, 0xFF, 0xF7, 0x7F, 0xF8, 0x2F, 0xCF, 0x70, 0xE0, 0xFF, 0x7C, 0x06, 0x87, 0xFF,
+    0xEB, 0x3F, 0xFC, 0xE7, 0x65, 0x98, 0xF0, 0xDF, 0x9F, 0x41, 0x00, 0xC4, 0xE4, 0x66, 0x68, 0xF8,
+    0x6F, 0xCF, 0xC0, 0xF0, 0x7F, 0xFF, 0x87, 0xFF, 0x5C, 0x40, 0xA6, 0x3E, 0x75, 0x98, 0x00, 0xCB,
+    0x04, 0x59, 0x3A, 0x78, 0x9C, 0xFB, 0xF0, 0x5E, 0xE0, 0xE6, 0x7F, 0x6F, 0x86, 0x0F, 0xFF, 0x9F,
+    0xFE, 0xFF, 0xFF, 0x9F, 0xFD, 0xC3, 0x7F, 0x10, 0x90, 0xFF, 0xF0, 0xFF, 0x3C, 0xF3, 0xE5, 0xFF,
+    0xF9, 0x1F, 0xFE, 0xEB, 0x33, 0x24, 0xFC, 0xEF, 0xFF, 0xF0, 0x9F, 0x97, 0xC1, 0x00, 0x44, 0x71,
+    0x33, 0x28, 0x80, 0x28, 0x2E, 0xD2, 0x28, 0x00, 0x25, 0x86, 0x39, 0xF6, 0x78, 0x9C, 0x63, 0x70,
+    0x78, 0xF5, 0xBE, 0x86, 0x91, 0x81, 0xE1, 0xD7, 0xFF, 0xFF, 0xFF, 0xED, 0x18, 0x16, 0x00, 0xC9,
+    0xFF, 0xEF, 0x19, 0x3F, 0xFF, 0xF7, 0x53, 0xF8, 0xF5, 0x9F, 0xF3, 0xC7, 0x7F, 0x56, 0x86, 0x0B,
+    0xFF, 0xF9, 0xFF, 0xFC, 0x67, 0x60, 0x98, 0xF0, 0xDF, 0xFE, 0x2F, 0x90, 0x2A, 0xF8, 0xEF, 0x0F,
+    0xA2, 0x1A, 0xFE, 0xC7, 0xFF, 0xFE, 0xCF, 0x08, 0x12, 0xFC, 0xFE, 0x9F, 0x8D, 0xE1, 0xC1, 0x7F,
+    0xFE, 0x4F, 0xFF, 0xFD, 0x04, 0x7E, 0xFE, 0xE7, 0x6A, 0x00, 0x69, 0xFF, 0xCF, 0xC4, 0xF0, 0x13,
+    0x6C, 0x18, 0x83, 0xC3, 0xAD, 0xFF, 0x3D, 0x8C, 0x0C, 0x00, 0xF9, 0x02, 0x38, 0x4C, 0x78, 0x9C,
+    0x8D, 0x8C, 0xB1, 0x11, 0x40, 0x50, 0x14, 0x04, 0x1F, 0xA1, 0x6F, 0x46, 0x20, 0x21, 0xA2, 0x03,
+    0x3A, 0x53, 0x02, 0x9D, 0x28, 0x41, 0x09, 0x4A, 0x90, 0x49, 0x7F, 0xCA, 0x08, 0x5C, 0x22, 0x5E,
+    0xDF, 0x50, 0x80, 0x4B, 0x76, 0xE6, 0xE6, 0xF6, 0x44, 0xB4, 0x9D, 0xA5, 0x89, 0x15, 0xCE, 0x48,
+    0x3C, 0x71, 0x62, 0x8E, 0x2F, 0x1A, 0x91, 0xD9, 0x40, 0x2F, 0x52, 0x6B, 0x19, 0x45, 0x62, 0x35,
+    0x93, 0x70, 0x2F, 0xBE, 0xB2, 0x0A, 0x93, 0x4E, 0x2C, 0xF9, 0x45, 0xF5, 0xEA, 0x89, 0x38, 0xC0,
+    0x87, 0xB3, 0x72, 0xF7, 0x85, 0x3D, 0x5E, 0xC8, 0x0F, 0xDC, 0x0F, 0x58, 0x4B, 0xC5, 0x78, 0x9C,
+    0x63, 0x58, 0xF4, 0xAF, 0x37, 0xE0, 0x3F, 0x9F, 0xC1, 0xFF, 0xFF, 0xFF, 0xE7, 0xFE, 0xE7, 0xBB,
+    0xF0, 0x1F, 0x04, 0xF8, 0xBE, 0xFE, 0x8F, 0x33, 0xFC, 0xF3, 0x9F, 0xEF, 0xE7, 0x7F, 0x36, 0x86,
+    0x8F, 0xFF, 0xF9, 0xFE, 0xFC, 0x67, 0x64, 0xD8, 0xF0, 0x9F, 0xEF, 0xEF, 0x7F, 0x06, 0x86, 0x09,
+    0x70, 0xEA, 0x0F, 0x90, 0xDA, 0x00, 0x52, 0xC2, 0xC2, 0xF0, 0x00, 0xA4, 0xC1, 0x4E, 0xE0, 0x27,
+    0x5C, 0x3B, 0xC8, 0xB0, 0xD3, 0xFF, 0xF9, 0x18, 0x16, 0xFD, 0xAB, 0xBD, 0x00, 0xA4, 0x80, 0x80,
+    0x38, 0x0A, 0x00, 0x7C, 0x37, 0x47, 0x9D, 0x78, 0x9C, 0xFB, 0xF0, 0x9E, 0xE1, 0xDA, 0xFE, 0x0F,
+    0xFF, 0x17, 0xFE, 0x07, 0x12, 0xBF, 0xFF, 0xAF, 0xFF, 0xF0, 0xFF, 0xFF, 0xBC, 0x88, 0x0F, 0xFF,
+    0xD7, 0x33, 0x30, 0x7C, 0xF8, 0xCF, 0x07, 0x22, 0x78, 0x40, 0x04, 0x17, 0x21, 0x02, 0x00, 0x09,
+    0xDB, 0x24, 0xA4, 0x78, 0x9C, 0x0D, 0x8A, 0xBD, 0x0D, 0x40, 0x00, 0x18, 0x05, 0xCF, 0x4F, 0x30,
+    0x82, 0xD2, 0x1A, 0x36, 0xB0, 0x82, 0x29, 0x2C, 0xA3, 0x35, 0x0B, 0x85, 0x44, 0x21, 0xA1, 0xD3,
+    0x8A, 0x09, 0x54, 0x42, 0xC4, 0x97, 0xE7, 0x7B, 0xCD, 0x25, 0x77, 0x8F, 0x49, 0x6B, 0xC9, 0x21,
+    0x5F, 0xF8, 0x6A, 0xB1, 0x1E, 0x3B, 0x29, 0x2A, 0x3E, 0xA5, 0xC0, 0xA3, 0x33, 0x87, 0xC1, 0x63,
+    0x06, 0x9B, 0xD4, 0xBB, 0x1B, 0xA5, 0xD8, 0x71, 0x2B, 0xAD, 0xE1, 0x52, 0x62, 0xFB, 0x2C, 0x05,
+    0xE6, 0x9F, 0x86, 0xD6, 0xD4, 0x45, 0xFC, 0xC4, 0x1A, 0x2E, 0x32, 0x78, 0x9C, 0x63, 0x48, 0x78,
+    0xC7, 0xC8, 0xC0, 0xC0, 0x70, 0xE1, 0x3F, 0x88, 0xFC, 0x0C, 0x22, 0x03, 0xFE, 0xFD, 0xFF, 0xFF,
+    0x9E, 0xE1, 0xDB, 0x7F, 0x10, 0x79, 0xF4, 0xDF, 0xFF, 0xB3, 0x7B, 0x18, 0x18, 0x7E, 0x81, 0x65,
+    0x89, 0x21, 0x7F, 0xFC, 0x67, 0x77, 0x60, 0x60, 0xF8, 0x0A, 0xD4, 0x0C, 0x32, 0x13, 0x44, 0x0A,
+    0xBC, 0x7C, 0xDF, 0xCB, 0x00, 0x00, 0xF3, 0x24, 0x2C, 0xC3, 0x78, 0x9C, 0xFB, 0xF4, 0x9F, 0x93,
+    0xC1, 0xE1, 0x7F, 0xFD, 0x27, 0xD2, 0x29, 0x2E, 0x86, 0x84, 0xFF, 0xF5, 0x1F, 0xFF, 0xF3, 0x32,
+    0x6C, 0xF8, 0x5F, 0xFF, 0xE1, 0x7F, 0x3E, 0xC3, 0xF7, 0xFF, 0xF5, 0x0B, 0xFE, 0x83, 0x40, 0xBD,
+    0xC2, 0xBF, 0xFF, 0xFF, 0xFB, 0xFF, 0xD4, 0x33, 0x4C, 0xFC, 0xB7, 0x8F, 0xE5, 0x47, 0x3D, 0x00,
+    0x85, 0xF2, 0x39, 0xA0, 0x78, 0x9C, 0x1D, 0xCB, 0xCB, 0x0D, 0x82, 0x00, 0x14, 0x05, 0xD1, 0xC1,
+    0x44, 0x63, 0x34, 0x21, 0x74, 0xA0, 0x1B, 0xEB, 0xB0, 0x04, 0xED, 0xC0, 0xBD, 0x1B, 0xEC, 0x88,
+    0x0A, 0x0C, 0x76, 0x40, 0x09, 0xD0, 0x81, 0x25, 0xF8, 0x21, 0x86, 0x10, 0xC1, 0xF1, 0xE9, 0xE6,
+    0x9E, 0xCD, 0x9D, 0xD1, 0x04, 0x46, 0x93, 0xCE, 0x19, 0x6B, 0x4B, 0x1E, 0x2E, 0x39, 0xB9, 0xE3,
+    0xE2, 0x8A, 0xC6, 0x94, 0xBD, 0x07, 0x9E, 0xCE, 0xE1, 0x53, 0xD1, 0x39, 0x81, 0x5E, 0x86, 0x1A,
+    0x68, 0xDD, 0x98, 0x87, 0x8D, 0xC7, 0xB8, 0x12, 0xD1, 0xD9, 0x45, 0x98, 0x79, 0x75, 0x1A, 0xF2,
+    0xF6, 0xF6, 0x83, 0x97, 0xC5, 0xDF, 0xBB, 0xDB, 0xD8, 0x2F, 0x4D, 0xEB, 0x2E, 0xE5, 0x78, 0x9C,
+    0x0D, 0x8E, 0xBD, 0x0D, 0x82, 0x50, 0x18, 0x45, 0x2F, 0x12, 0x43, 0x0C, 0x0A, 0x23, 0x58, 0x59,
+    0xC3, 0x08, 0x6E, 0x42, 0x6B, 0xC9, 0x08, 0xF6, 0x36, 0x6E, 0xF0, 0xDC, 0x40, 0x16, 0x30, 0x71,
+    0x03, 0xDD, 0x00, 0x0B, 0x7B, 0x84, 0x04, 0xCD, 0x7B, 0xFE, 0x1C, 0xBF, 0xEE, 0x26, 0xF7, 0xE4,
+    0xDC, 0xEB, 0x89, 0xF4, 0x22, 0xD3, 0x81, 0x7C, 0x64, 0xAA, 0x37, 0x85, 0x6E, 0xA4, 0x3D, 0x33,
+    0x41, 0xA5, 0x81, 0xE4, 0xCC, 0xA2, 0x24, 0x38, 0x3D, 0x99, 0x6C, 0x59, 0xD6, 0xDC, 0x5B, 0x85,
+    0x4E, 0x25, 0x55, 0x43, 0x43, 0xF4, 0x73, 0x12, 0xEE, 0xD1, 0xD6, 0xAC, 0x0C, 0x57, 0xB8, 0x0C,
+    0xAE, 0x64, 0x43, 0x2E, 0xE3, 0xC7, 0x4A, 0xEC, 0x98, 0x4B, 0x3D, 0xBE, 0xD0, 0xE7, 0x44, 0x22,
+    0x5D, 0xF9, 0x66, 0xF2, 0x1D, 0xB1, 0xB4, 0x87, 0x54, 0x23, 0x9D, 0xA4, 0x35, 0xD6, 0x0D, 0x1C,
+    0x2D, 0xDA, 0x6C, 0x6C, 0x0F, 0xCC, 0xF5, 0x07, 0x24, 0x63, 0x52, 0x4B, 0x78, 0x9C, 0x15, 0xCB,
+    0xCB, 0x0D, 0x44, 0x60, 0x18, 0x46, 0xE1, 0xF7, 0xB7, 0x98, 0x08, 0x26, 0x51, 0x82, 0xF5, 0x6C,
+    0xE8, 0x80, 0x12, 0x74, 0x30, 0xD3, 0x81, 0x12, 0xB4, 0xA2, 0x02, 0x51, 0xC2, 0x74, 0x40, 0x07,
+    0xA2, 0x02, 0x2B, 0xD7, 0x85, 0xE3, 0xB3, 0x7A, 0x92, 0x93, 0x9C, 0x85, 0xB7, 0x7E, 0xF4, 0x6A,
+    0xA8, 0x35, 0x91, 0x2A, 0x06, 0x77, 0xE0, 0x4B, 0x2B, 0x1F, 0x46, 0x49, 0x1D, 0x23, 0xB9, 0x99,
+    0xC0, 0x93, 0xA5, 0x8D, 0xF9, 0x41, 0x27, 0x78, 0x46, 0x69, 0x3D, 0x32, 0x27, 0x5A, 0x2A, 0xF3,
+    0xE0, 0x75, 0xE1, 0x54, 0xD8, 0xBC, 0x12, 0x6A, 0xB0, 0xF9, 0xCF, 0x57, 0x3B, 0x81, 0x32, 0x66,
+    0x77, 0x03, 0xCA, 0xFA, 0x34, 0xF4, 0x78, 0x9C, 0x25, 0xCD, 0x4D, 0x0D, 0xC2, 0x40, 0x18, 0x84,
+    0xE1, 0xA1, 0x84, 0x84, 0x9F, 0xA4, 0xA9, 0x03, 0x8E, 0x5C, 0x71, 0x40, 0x1D, 0xC0, 0x1D, 0x0B,
+    0x78, 0x28, 0x0E, 0xB0, 0x80, 0x83, 0x45, 0x02, 0x12, 0x40, 0x01, 0x12, 0x08, 0x90, 0xD0, 0x1E,
+    0xCA, 0xBE, 0xCC, 0x6E, 0x4F, 0xCF, 0x1C, 0xE6, 0xFB, 0xA6, 0x67, 0x2C, 0x45, 0x46, 0x5F, 0xA6,
+    0x5A, 0x13, 0xF4, 0xA2, 0xD4, 0x91, 0xAD, 0xCE, 0x6C, 0x74, 0x73, 0xAE, 0x39, 0xE9, 0xCD, 0x4C,
+    0xFA, 0x3D, 0xD4, 0xA5, 0x6E, 0x4B, 0xE1, 0x28, 0x17, 0x57, 0x34, 0xF6, 0xC2, 0x81, 0xA5, 0xDD,
+    0x11, 0x58, 0x58, 0xC5, 0x27, 0x93, 0x64, 0x07, 0x09, 0x5F, 0x87, 0xEC, 0xD5, 0x5F, 0x07, 0xCB,
+    0xEC, 0xC7, 0x8B, 0x52, 0x55, 0x47, 0x8A, 0xDC, 0xF2, 0xD0, 0xE0, 0x3C, 0x79, 0x67, 0x9F, 0x5B,
+    0x7F, 0xB9, 0x9D, 0x3D, 0xF6, 0x78, 0x9C, 0xFB, 0xF0, 0x1F, 0x08, 0xEC, 0x3F, 0x80, 0xC9, 0x03,
+    0x77, 0xEF, 0xFE, 0xFD, 0xAF, 0xCF, 0xC0, 0xC0, 0xF0, 0xFD, 0x3F, 0x3B, 0x03, 0x83, 0xC1, 0xFF,
+    0xF3, 0x40, 0xE6, 0x85, 0xFF, 0xF2, 0x40, 0xF2, 0xE7, 0x7F, 0x56, 0x06, 0x06, 0x87, 0xFF, 0xEB,
+    0x81, 0xCC, 0x87, 0xFF, 0xE5, 0x80, 0xE4, 0xEF, 0xFF, 0x2C, 0x0C, 0x0C, 0x09, 0xFF, 0xFB, 0x81,
+    0xCC, 0x4F, 0xFF, 0xEF, 0xDF, 0xBD, 0x9B, 0xFB, 0x15, 0x64, 0x42, 0x3D, 0x84, 0x04, 0x00, 0xAB,
+    0xD6, 0x2E, 0x91, 0x78, 0x9C, 0x63, 0x60, 0x98, 0xF8, 0x97, 0x97, 0x41, 0xE0, 0xDF, 0x7F, 0x5E,
+    0x86, 0x84, 0xFF, 0xFF, 0xB9, 0x18, 0x0A, 0xFE, 0xCB, 0x31, 0x30, 0x34, 0xFC, 0xE7, 0xC6, 0x20,
+    0x2E, 0x00, 0x25, 0xA7, 0xFC, 0xFB, 0xCF, 0xCA, 0xF0, 0xEB, 0x7F, 0x0C, 0x03, 0x84, 0x98, 0x0A,
+    0xE2, 0x32, 0x5C, 0x04, 0x4A, 0x60, 0xD5, 0x01, 0x36, 0x0A, 0x6C, 0x28, 0xD8, 0x78, 0x86, 0x49,
+    0x7F, 0x79, 0x01, 0xF8, 0xAB, 0x29, 0x30, 0x78, 0x9C, 0xFB, 0x6E, 0xFF, 0x9D, 0x44, 0x08, 0x00,
+    0x0D, 0x54, 0x1E, 0x47, 0x78, 0x9C, 0x7B, 0xDF, 0xC3, 0xC8, 0xC0, 0xF0, 0xFF, 0x3F, 0x2F, 0x03,
+    0xC3, 0xDF, 0xFF, 0xF6, 0x0C, 0x0C, 0x06, 0xFF, 0xE3, 0x19, 0x18, 0x18, 0xFE, 0x61, 0x21, 0xFE,
+    0xAC, 0x07, 0x12, 0xDF, 0xFF, 0xF7, 0x30, 0x33, 0x24, 0xFC, 0xFD, 0xCF, 0xCE, 0x90, 0xF0, 0x07,
+    0x48, 0xFC, 0xF8, 0x3F, 0x97, 0x99, 0xE1, 0xEF, 0x7E, 0x90, 0x92, 0x7C, 0x0C, 0x1D, 0x60, 0xA3,
+    0xFE, 0x80, 0x0C, 0x05, 0x1B, 0xFF, 0x1E, 0x64, 0x11, 0x00, 0x88, 0xBD, 0x26, 0xE0, 0x78, 0x9C,
+    0x63, 0x60, 0x00, 0x83, 0x84, 0xBF, 0x39, 0x0C, 0x0C, 0x06, 0x4C, 0xDF, 0xFE, 0xFF, 0xB7, 0x61,
+    0x78, 0xC4, 0xFC, 0xEF, 0xCC, 0xFF, 0xFF, 0x7B, 0xFF, 0x33, 0xC7, 0x31, 0x2C, 0xFC, 0xFF, 0x7F,
+    0x3F, 0x03, 0x1B, 0x03, 0xC3, 0xE6, 0x77, 0x9C, 0x0C, 0x50, 0x00, 0x00, 0xB8, 0x63, 0x11, 0x04,
+    0x78, 0x9C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 0x9C, 0xDB, 0x78, 0x9E, 0xE9, 0xFB, 0x7F,
+    0xCE, 0x1F, 0xFF, 0xB9, 0x1E, 0xBD, 0x67, 0x66, 0x60, 0x64, 0x00, 0x82, 0x0D, 0xBB, 0x19, 0x3E,
+    0xFC, 0x67, 0xFC, 0xF8, 0x9F, 0xE9, 0xE3, 0x7F, 0xE6, 0x4F, 0xFF, 0x99, 0x3F, 0xFF, 0x67, 0xF9,
+    0xF2, 0x9F, 0xF5, 0xCB, 0x7F, 0xB6, 0xAF, 0xFF, 0xD9, 0xBE, 0xFD, 0x67, 0xFF, 0xFE, 0x9F, 0xE3,
+    0x07, 0x58, 0x3D, 0x00, 0x70, 0xEC, 0x20, 0x68, 0x78, 0x9C, 0x63, 0x60, 0x50, 0xF8, 0xCF, 0x00,
+    0x04, 0x60, 0x52, 0xE1, 0xC6, 0xFF, 0x73, 0x1A, 0x0C, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0xAF, 0x00,
+    0x24, 0xFE, 0xCB, 0x2F, 0xF8, 0x7F, 0x9E, 0x29, 0x89, 0xE3, 0xC3, 0x7F, 0x7E, 0xA0, 0xE4, 0xA7,
+    0xFF, 0x5C, 0x40, 0xF2, 0xF3, 0x7F, 0x4E, 0x38, 0xF9, 0xE9, 0x3F, 0x37, 0x90, 0xFC, 0xF0, 0x5F,
+    0x1E, 0x48, 0x02, 0x55, 0x0A, 0x3B, 0x79, 0x81, 0x75, 0xF9, 0x83, 0x4D, 0xF0, 0x67, 0x50, 0xB8,
+    0xF9, 0xFF, 0x1C, 0x1B, 0x03, 0x92, 0xF9, 0x00, 0xC3, 0x1A, 0x2D, 0x6E, 0x78, 0x9C, 0x63, 0x60,
+    0xD8, 0xFA, 0xEF, 0x9C, 0x27, 0x03, 0xC3, 0x84, 0xFF, 0x40, 0xC0, 0xC8, 0xF0, 0x05, 0x48, 0xEE,
+    0x67, 0x60, 0xF8, 0xF5, 0x5F, 0xC2, 0x11, 0x28, 0xF8, 0xE7, 0x3F, 0x03, 0x08, 0xFC, 0x79, 0x8F,
+    0x44, 0x81, 0xD4, 0xFD, 0x67, 0x87, 0x51, 0xAB, 0xFE, 0xFD, 0x5F, 0xB5, 0x8A, 0x05, 0xA1, 0xE4,
+    0x3E, 0x98, 0xFA, 0xB7, 0x1F, 0x44, 0x1A, 0xFC, 0x8F, 0x07, 0x51, 0x4F, 0xFF, 0x6B, 0x29, 0x29,
+    0x29, 0x31, 0x81, 0x35, 0xFC, 0xE7, 0x41, 0xA5, 0x00, 0x88, 0x32, 0x3E, 0x10, 0x78, 0x9C, 0x63,
+    0x60, 0x62, 0x60, 0x60, 0x60, 0xDC, 0xA0, 0x57, 0xEC, 0x7E, 0x40, 0xEF, 0xEB, 0x7F, 0x20, 0x58,
+    0xDF, 0x00, 0x22, 0x79, 0x0C, 0xFE, 0xEB, 0x34, 0xFE, 0xE7, 0x98, 0xF0, 0x9F, 0x91, 0xE1, 0x0F,
+    0xEF, 0x82, 0xFB, 0x0C, 0x0C, 0x3F, 0xF9, 0x21, 0x6C, 0x87, 0xFF, 0xDA, 0x40, 0x71, 0xB0, 0x1A,
+    0x6E, 0xB0, 0xFA, 0xF9, 0x20, 0xBD, 0x07, 0xE5, 0x18, 0xC0, 0xE6, 0x00, 0x00, 0x09, 0xCB, 0x26,
+    0xD1, 0x78, 0x9C, 0xFB, 0xF5, 0x9F, 0x89, 0x81, 0xE1, 0xEF, 0x7B, 0x86, 0x4F, 0xFF, 0x39, 0x19,
+    0x02, 0xFE, 0xE7, 0x33, 0x2C, 0xF8, 0x2F, 0xCF, 0x70, 0xE0, 0x3F, 0x2F, 0x83, 0xC2, 0xFF, 0x7A,
+    0x86, 0xCF, 0xFF, 0x59, 0x19, 0x18, 0x7E, 0xBD, 0x67, 0xF8, 0x75, 0x9F, 0x81, 0x01, 0xA8, 0x40,
+    0xF4, 0x7F, 0x3C, 0x90, 0x9E, 0xF0, 0xBF, 0xE7, 0x3F, 0x0F, 0x90, 0x16, 0xF8, 0xFF, 0xFF, 0x3F,
+    0x0B, 0x90, 0x66, 0xF8, 0xF9, 0xFF, 0x3C, 0x88, 0xFA, 0x05, 0xE4, 0xBF, 0x47, 0xA2, 0x15, 0x37,
+    0xFD, 0xD7, 0x53, 0x02, 0x49, 0x2C, 0xF8, 0xCF, 0x47, 0x8C, 0x3C, 0x94, 0x06, 0x00, 0x32, 0xD2,
+    0x3B, 0xC6, 0x78, 0x9C, 0xFB, 0x6E, 0xFF, 0x1D, 0x03, 0x32, 0xC0, 0x01, 0xA6, 0xDC, 0x77, 0x7B,
+    0x00, 0x71, 0x14, 0x18, 0x39, 0x78, 0x9C, 0x01, 0x5F, 0x00, 0xA0, 0xFF, 0x00, 0xB5, 0xFE, 0xBE,
+    0x17, 0xB0, 0xFF, 0xFF, 0xFF, 0xAF, 0xF5, 0xEF, 0x56, 0xC7, 0x3F, 0xF7, 0x8F, 0x00, 0x00, 0x02,
+    0xF5, 0xEF, 0x04, 0x00, 0x00, 0xB0, 0xFF, 0xCF, 0x06, 0x00, 0x40, 0xFF, 0xFF, 0xEF, 0x04, 0xF1,
+    0xDF, 0xD7, 0xFF, 0x3F, 0xF6, 0x4F, 0x00, 0xF7, 0xBF, 0xF7, 0x6F, 0x00, 0xE0, 0xEF, 0xF3, 0xFF,
+    0x06, 0xF1, 0xCF, 0x90, 0xFF, 0xEF, 0xFD, 0x5F, 0x00, 0xE6, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xC5,
+    0xFF, 0x6F, 0x00, 0x00, 0x00, 0xF7, 0xDF, 0x14, 0x00, 0x00, 0xF2, 0xEF, 0xFB, 0x6A, 0x65, 0xFC,
+    0x9F, 0xFB, 0xFF, 0xFF, 0xFF, 0x1D, 0x71, 0xEC, 0xFF, 0x7C, 0x00, 0x84, 0x69, 0x38, 0x30, 0x78,
+    0x9C, 0x53, 0x60, 0x66, 0x50, 0x62, 0xF8, 0xDA, 0x9F, 0xF0, 0x9F, 0xFD, 0xC7, 0xF9, 0x05, 0xFF,
+    0xB9, 0x2F, 0xC7, 0x39, 0xBC, 0x63, 0x01, 0x00, 0x51, 0xC6, 0x09, 0x04, 0x78, 0x9C, 0x63, 0x60,
+    0x50, 0x38, 0xF1, 0x7F, 0x9F, 0x38, 0x03, 0x08, 0xFC, 0xF8, 0x7F, 0xF6, 0xDF, 0x7F, 0x36, 0x20,
+    0xE3, 0xE0, 0x7D, 0x56, 0x06, 0x81, 0xE7, 0xEB, 0x81, 0xAC, 0x3F, 0x9C, 0x0D, 0x7F, 0xCF, 0xA9,
+    0xFD, 0xE6, 0x64, 0x68, 0x58, 0x2F, 0xF0, 0xF7, 0xFF, 0x7F, 0xFB, 0x03, 0xFE, 0x0C, 0x1F, 0xF9,
+    0x26, 0xFC, 0xCF, 0x9D, 0xC6, 0xAD, 0x70, 0x9F, 0xE1, 0x1B, 0xFB, 0x87, 0xFF, 0x8C, 0x40, 0x45,
+    0xBF, 0x98, 0x7F, 0x31, 0x7D, 0x01, 0xA9, 0x66, 0xF8, 0xCA, 0xF6, 0x87, 0xE1, 0x6B, 0x3F, 0x88,
+    0xF5, 0x99, 0x03, 0xC8, 0xAA, 0x87, 0xB0, 0x7E, 0x31, 0x7D, 0x9E, 0x0F, 0x91, 0x05, 0xEA, 0x78,
+    0xCF, 0x00, 0xD6, 0x01, 0x32, 0x25, 0xA7, 0x95, 0x07, 0x68, 0x0A, 0xC4, 0x64, 0xBE, 0x03, 0xF1,
+    0x50, 0xDB, 0xC4, 0x80, 0xB6, 0x21, 0xB9, 0x80, 0xE1, 0xE7, 0xFF, 0xB3, 0x7F, 0xC1, 0xAE, 0x02,
+    0xB9, 0xF4, 0x1C, 0xC8, 0xA5, 0x00, 0xDD, 0x49, 0x48, 0x71, 0x78, 0x9C, 0x01, 0x2D, 0x00, 0xD2,
+    0xFF, 0x20, 0xD8, 0xEF, 0x2B, 0x00, 0xB0, 0xFF, 0xFE, 0xEF, 0x01, 0x30, 0x16, 0x30, 0xFF, 0x05,
+    0x00, 0x62, 0x98, 0xFF, 0x07, 0x90, 0xFF, 0xEF, 0xFF, 0x08, 0xF4, 0x7F, 0x00, 0xFF, 0x08, 0xF5,
+    0x2F, 0x60, 0xFF, 0x08, 0xF2, 0xFF, 0xFE, 0xFD, 0x08, 0x50, 0xFD, 0x6D, 0xF4, 0x08, 0x18, 0xAF,
+    0x18, 0x5E, 0x78, 0x9C, 0x63, 0x60, 0xA8, 0x61, 0x60, 0xE8, 0x62, 0x64, 0x58, 0xF0, 0x9F, 0xB7,
+    0xE0, 0xBF, 0x3E, 0xC3, 0xB7, 0xFF, 0x6C, 0x5F, 0xFE, 0x73, 0x1A, 0xFC, 0x5F, 0x2F, 0xF0, 0xEF,
+    0x3C, 0xC3, 0xC3, 0xFF, 0xBC, 0x07, 0x80, 0x62, 0xBF, 0xFF, 0x33, 0xFF, 0xF8, 0xCF, 0x0A, 0xA2,
+    0x7E, 0x02, 0x29, 0xA8, 0x20, 0x54, 0x09, 0x54, 0x03, 0x4C, 0x3B, 0xC8, 0xB0, 0x59, 0x8C, 0x00,
+    0xA4, 0x1C, 0x27, 0xC0, 0x78, 0x9C, 0xFB, 0xF7, 0x1F, 0x04, 0x98, 0xFF, 0x41, 0xA8, 0x95, 0xAB,
+    0x56, 0xAD, 0xBA, 0xF5, 0x9F, 0x99, 0x01, 0x08, 0x0A, 0x70, 0x50, 0x00, 0xDE, 0x4D, 0x16, 0x44,
+    0x78, 0x9C, 0xFB, 0xF2, 0xFF, 0xBF, 0xFF, 0x17, 0x28, 0x16, 0x10, 0x14, 0x64, 0x04, 0x00, 0x6A,
+    0x0C, 0x09, 0xF7, 0x78, 0x9C, 0x63, 0x60, 0x50, 0x38, 0xF1, 0x7F, 0x9F, 0x38, 0x03, 0x08, 0xFC,
+    0xF8, 0x7F, 0xF6, 0xDF, 0x7F, 0x36, 0x20, 0xE3, 0xE0, 0x7D, 0x56, 0x06, 0x81, 0xE7, 0xEB, 0x81,
+    0xAC, 0x3F, 0x9C, 0x40, 0x42, 0xE0, 0x37, 0x27, 0x43, 0xC3, 0xFA, 0x84, 0xFF, 0xFF, 0x7B, 0x19,
+    0x0E, 0xF8, 0x33, 0x7C, 0xE4, 0x03, 0xB2, 0xFE, 0x73, 0x29, 0xDC, 0x67, 0xF8, 0xC6, 0x9E, 0xF0,
+    0x5F, 0xFD, 0x1F, 0x3F, 0xC3, 0x2F, 0xE6, 0x5F, 0x4C, 0x09, 0xFF, 0xD9, 0x7E, 0xCB, 0x33, 0x7C,
+    0x65, 0xFB, 0xC3, 0x90, 0xF0, 0xBF, 0xEA, 0x3F, 0x2F, 0xC3, 0x67, 0x0E, 0x10, 0xEB, 0xFF, 0x7D,
+    0x26, 0x20, 0x0B, 0x24, 0xFB, 0xE7, 0x3C, 0x03, 0x50, 0x16, 0xA4, 0xA3, 0xEC, 0x3F, 0x3B, 0x50,
+    0x07, 0xC8, 0x14, 0xB6, 0x3F, 0xF6, 0x40, 0x53, 0x40, 0x26, 0xB3, 0x7D, 0xBA, 0x7F, 0x30, 0x1E,
+    0xC9, 0x36, 0x24, 0x17, 0x30, 0xFC, 0xFC, 0x7F, 0xF6, 0x2F, 0xD8, 0x55, 0x20, 0x97, 0x9E, 0x03,
+    0xB9, 0x14, 0x00, 0xDB, 0x05, 0x4B, 0x9B, 0x78, 0x9C, 0x2B, 0x28, 0x07, 0x01, 0xF7, 0x8F, 0xFF,
+    0x41, 0x60, 0x3E, 0x94, 0x02, 0x00, 0x9B, 0x55, 0x10, 0x21, 0x78, 0x9C, 0x63, 0x78, 0x71, 0x9F,
+    0x8D, 0xE1, 0xC2, 0xFF, 0xFF, 0xF3, 0x19, 0x7E, 0xF4, 0x6F, 0xFD, 0xCF, 0xFC, 0x87, 0x93, 0xE1,
+    0x1F, 0xC7, 0x5F, 0x4E, 0x86, 0xBF, 0x1C, 0x3F, 0x41, 0xDC, 0x8B, 0x20, 0x09, 0x81, 0x97, 0x40,
+    0x25, 0x00, 0xBA, 0x40, 0x15, 0x1A, 0x78, 0x9C, 0x63, 0x60, 0x38, 0x14, 0xC3, 0x00, 0x02, 0x9F,
+    0xEB, 0x71, 0x51, 0xFF, 0xFE, 0x83, 0x00, 0x33, 0x94, 0x5A, 0xB9, 0xEA, 0xF7, 0xFD, 0x55, 0xAB,
+    0x98, 0xF0, 0x69, 0x60, 0x60, 0x48, 0x54, 0x03, 0x12, 0x2B, 0x57, 0x81, 0x00, 0x13, 0xAA, 0x76,
+    0x00, 0xA3, 0x55, 0x2D, 0xA6, 0x78, 0x9C, 0x13, 0xB8, 0xF9, 0x5E, 0x92, 0xE1, 0xD3, 0xFF, 0xFF,
+    0xE7, 0x19, 0x16, 0xF4, 0x3F, 0xFF, 0xCF, 0xC4, 0xC0, 0xB4, 0xE1, 0x3F, 0x33, 0x03, 0xC3, 0xC7,
+    0xF7, 0x0C, 0x0C, 0x0C, 0x7F, 0xE2, 0x19, 0x18, 0x0E, 0xFC, 0x67, 0x67, 0x10, 0xF8, 0x93, 0xCF,
+    0xC0, 0x70, 0xF0, 0x7F, 0x4D, 0x39, 0xF3, 0xD7, 0xFF, 0xFF, 0xFF, 0x73, 0x82, 0x09, 0x00, 0xDF,
+    0xE2, 0x1B, 0xA4, 0x78, 0x9C, 0x01, 0x37, 0x00, 0xC8, 0xFF, 0x20, 0xE9, 0xEF, 0x19, 0x00, 0xE0,
+    0xFF, 0xFF, 0xCF, 0x00, 0x60, 0x4B, 0xB2, 0xFF, 0x01, 0x00, 0x00, 0xC1, 0xDF, 0x00, 0x00, 0xFA,
+    0xFF, 0x19, 0x00, 0x00, 0xF9, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0x02, 0x00, 0x00, 0x40,
+    0xFF, 0x06, 0xC4, 0x15, 0xA2, 0xFF, 0x05, 0xF4, 0xFF, 0xFF, 0xDF, 0x00, 0x70, 0xEC, 0xDF, 0x19,
+    0x00, 0xCF, 0xAA, 0x19, 0xAF, 0x78, 0x9C, 0x63, 0xF8, 0xF6, 0x9F, 0xC7, 0xE0, 0xFF, 0x7A, 0x86,
+    0x87, 0xFF, 0xD9, 0x19, 0xFE, 0xF8, 0x31, 0x30, 0x00, 0x00, 0x44, 0x18, 0x07, 0x11, 0x78, 0x9C,
+    0xFB, 0xF0, 0x9F, 0x8B, 0x41, 0xE1, 0x7F, 0xFF, 0x07, 0x92, 0x28, 0x03, 0x10, 0xC5, 0xCD, 0x10,
+    0x00, 0xA2, 0xF8, 0x18, 0x16, 0x80, 0xA8, 0x7A, 0x86, 0xEF, 0x20, 0x0A, 0x04, 0xC0, 0xD4, 0xFA,
+    0x5F, 0x40, 0x6A, 0xD6, 0x7B, 0xCE, 0x6F, 0x60, 0x0D, 0x40, 0x40, 0x04, 0x05, 0x00, 0x71, 0x78,
+    0x47, 0xBA, 0x78, 0x9C, 0x63, 0x58, 0xF4, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0E, 0xFF, 0x41, 0xC0,
+    0xFF, 0x01, 0x90, 0x98, 0x7F, 0xDD, 0xFF, 0x0B, 0x88, 0xBD, 0xC1, 0xFF, 0x07, 0x84, 0xFA, 0x89,
+    0x42, 0x41, 0x05, 0xBF, 0x42, 0xA8, 0x0F, 0x10, 0x2A, 0x00, 0x42, 0x31, 0x6C, 0xF9, 0xF7, 0x0F,
+    0x44, 0x31, 0x30, 0x6C, 0xA0, 0x9C, 0x02, 0x00, 0x12, 0xA9, 0x51, 0x66, 0x78, 0x9C, 0x3B, 0x78,
+    0x9E, 0xE9, 0xFB, 0x7F, 0xCE, 0x1F, 0xFF, 0xB9, 0x1E, 0xBD, 0x67, 0x66, 0x60, 0x64, 0x00, 0x00,
+    0x48, 0xA8, 0x07, 0x68, 0x78, 0x9C, 0x53, 0xF8, 0xCF, 0xC2, 0xB0, 0xE0, 0xBF, 0x2D, 0x03, 0xC3,
+    0xD7, 0xF7, 0x0C, 0x8A, 0x0F, 0xFF, 0x33, 0x7C, 0xFF, 0x7F, 0x9E, 0xE1, 0xE9, 0x7B, 0x29, 0x06,
+    0x00, 0x88, 0xCA, 0x0B, 0x98, 0x78, 0x9C, 0x63, 0xD8, 0xF8, 0x9F, 0xC9, 0xE0, 0xDF, 0x7F, 0xA6,
+    0xAF, 0xFF, 0xFF, 0x33, 0x7D, 0xDB, 0x09, 0x64, 0x1F, 0xF8, 0xCF, 0xC4, 0x80, 0x03, 0x03, 0x00,
+    0x0D, 0x8B, 0x15, 0xFE, 0x78, 0x9C, 0x63, 0x38, 0xFA, 0x5F, 0x8B, 0x21, 0xE1, 0xFF, 0xFF, 0xF7,
+    0x4C, 0x0F, 0xF6, 0x1B, 0xFE, 0xE3, 0xFA, 0xEC, 0xCF, 0xF0, 0x93, 0xEF, 0x8B, 0x3D, 0xC3, 0x0F,
+    0x7E, 0x30, 0xEB, 0xC1, 0x7E, 0xC5, 0x7F, 0x5C, 0x01, 0xFF, 0xFF, 0xFF, 0x67, 0x62, 0x38, 0xFA,
+    0x5F, 0x9B, 0x01, 0x00, 0x18, 0x60, 0x16, 0xE8, 0x78, 0x9C, 0x0B, 0xD0, 0x61, 0x70, 0xB0, 0x61,
+    0x60, 0xF8, 0x7D, 0x9E, 0xE1, 0xC7, 0x7B, 0x46, 0x86, 0xCF, 0xFF, 0x39, 0x1F, 0xFE, 0xE7, 0x61,
+    0x28, 0xF8, 0x9F, 0xEF, 0xF0, 0xBF, 0x1F, 0x28, 0xFA, 0x9F, 0xF9, 0xC7, 0x7F, 0x56, 0x86, 0x87,
+    0xFF, 0x79, 0x0F, 0xFC, 0xD7, 0x87, 0x51, 0x10, 0x41, 0xB0, 0x92, 0xF9, 0x30, 0x0D, 0x50, 0xED,
+    0x01, 0x10, 0xC3, 0x00, 0xBE, 0xB5, 0x28, 0x33, 0x78, 0x9C, 0x63, 0x48, 0xF8, 0xCF, 0xC9, 0xC0,
+    0x50, 0xF0, 0x9F, 0x9D, 0x81, 0x81, 0xE1, 0x27, 0x88, 0xF9, 0xF1, 0x3E, 0x90, 0x75, 0xF0, 0x3F,
+    0x88, 0xF9, 0x33, 0x1E, 0xC8, 0xBC, 0x98, 0x07, 0x64, 0x2A, 0xFC, 0xE7, 0x01, 0x32, 0x15, 0x02,
+    0x81, 0xCC, 0x05, 0xFF, 0x99, 0x81, 0x4C, 0x86, 0x00, 0x20, 0xF3, 0xF3, 0x7E, 0x06, 0x18, 0xF3,
+    0x8F, 0x3E, 0x8C, 0x09, 0x44, 0x06, 0xFF, 0xF9, 0xC1, 0xCC, 0x0B, 0xFF, 0x19, 0x2F, 0x40, 0x99,
+    0xDF, 0xEA, 0x19, 0x7E, 0x40, 0x99, 0xFF, 0xF8, 0x0C, 0xCE, 0xFF, 0xE5, 0x07, 0xA9, 0x6E, 0xF8,
+    0xCF, 0x76, 0xC0, 0xFF, 0x1F, 0x98, 0x09, 0xB4, 0xF5, 0x3B, 0x17, 0x84, 0xF9, 0xD3, 0x5F, 0xE1,
+    0x3D, 0x23, 0x98, 0xA9, 0xF0, 0x9F, 0x7B, 0xC2, 0x7F, 0x20, 0xE0, 0x60, 0x60, 0xD8, 0xF0, 0x9F,
+    0x19, 0xC6, 0xFC, 0xB2, 0x1E, 0xA4, 0x0A, 0xAC, 0x00, 0x62, 0x2B, 0x90, 0x09, 0x00, 0x00, 0x18,
+    0x44, 0xF0, 0x78, 0x9C, 0x63, 0x48, 0xF8, 0xCF, 0xC9, 0xC0, 0x50, 0xF0, 0x9F, 0x9D, 0x81, 0x81,
+    0xE1, 0x27, 0x88, 0xF9, 0xF1, 0x3E, 0x90, 0x75, 0xF0, 0x3F, 0x88, 0xF9, 0x33, 0x1E, 0xC8, 0xBC,
+    0x98, 0x07, 0x64, 0x2A, 0xFC, 0xE7, 0x01, 0x32, 0x15, 0x02, 0x81, 0xCC, 0x05, 0xFF, 0x99, 0x81,
+    0x4C, 0x86, 0x00, 0x20, 0xF3, 0xF3, 0x7E, 0x06, 0x18, 0xF3, 0x8F, 0x3E, 0x8C, 0x09, 0x44, 0xC7,
+    0xDE, 0xFB, 0x80, 0x99, 0x17, 0xFE, 0x6F, 0xFC, 0xFF, 0x1F, 0xA8, 0x1C, 0xC8, 0xFC, 0x56, 0xEF,
+    0xB0, 0xFF, 0xD8, 0x7F, 0x0E, 0x10, 0xF3, 0x1F, 0x1F, 0x03, 0x33, 0x48, 0x0B, 0x03, 0x43, 0xC3,
+    0x7F, 0x36, 0x06, 0xA0, 0x79, 0xAC, 0x0C, 0x50, 0x5B, 0xBF, 0x83, 0xCD, 0xFB, 0xE9, 0x0F, 0x72,
+    0x0F, 0xD8, 0xBE, 0xFF, 0xDC, 0x30, 0xC1, 0x0D, 0x40, 0x63, 0x0A, 0xFE, 0xD7, 0x97, 0x03, 0x35,
+    0x7C, 0x59, 0xCF, 0xC0, 0xF0, 0x01, 0x68, 0x2E, 0x3F, 0x03, 0xD8, 0x56, 0x30, 0x13, 0x00, 0x57,
+    0x60, 0x47, 0x00, 0x78, 0x9C, 0x2D, 0xCA, 0xBD, 0x0D, 0x82, 0x50, 0x00, 0x04, 0xE0, 0x53, 0xF1,
+    0x19, 0x4D, 0xB4, 0x30, 0xF6, 0x52, 0xD9, 0xE2, 0x06, 0xB0, 0x81, 0x23, 0xB0, 0x02, 0x03, 0x98,
+    0xA8, 0xAD, 0x0D, 0x6E, 0xA0, 0x1B, 0xD8, 0x58, 0x03, 0x1B, 0x80, 0x13, 0xA8, 0x13, 0xBC, 0x44,
+    0xC2, 0x8F, 0x21, 0xBC, 0xF3, 0xF1, 0xF4, 0xAA, 0xEF, 0x72, 0x17, 0xB4, 0xD1, 0x00, 0x38, 0x71,
+    0x88, 0x0F, 0xE9, 0x00, 0xEF, 0x14, 0xB8, 0xAF, 0xCA, 0x1D, 0xD0, 0xB8, 0xD0, 0xA9, 0x5C, 0xAC,
+    0x39, 0x01, 0x3C, 0x3E, 0x2C, 0x24, 0xEC, 0x43, 0x57, 0xDD, 0x8B, 0x73, 0x37, 0xA2, 0x08, 0xD1,
+    0x2E, 0x8D, 0x9E, 0x69, 0xC0, 0x51, 0x46, 0xB1, 0x9D, 0x17, 0xF1, 0x4B, 0xA2, 0xA6, 0x50, 0xE4,
+    0xA6, 0xF6, 0x6D, 0x52, 0xDC, 0x54, 0xB4, 0xE0, 0x34, 0xB9, 0x52, 0xE8, 0xE3, 0x85, 0x56, 0x75,
+    0x34, 0xCA, 0x63, 0x5B, 0x1E, 0x8C, 0x1A, 0x27, 0xF1, 0xF7, 0x9D, 0x3C, 0x8E, 0x73, 0x92, 0x12,
+    0xC8, 0xD8, 0xFB, 0xAB, 0x0C, 0xF5, 0xC3, 0xAC, 0x6A, 0xF6, 0xD3, 0x17, 0x3A, 0x01, 0x4F, 0x90,
+    0x78, 0x9C, 0x63, 0x60, 0x28, 0x78, 0xC7, 0xC6, 0xC0, 0xC0, 0xF0, 0xF1, 0x3F, 0x3F, 0x9C, 0x5C,
+    0xF0, 0x9F, 0x13, 0x48, 0x32, 0x08, 0x32, 0xC0, 0x41, 0xC3, 0x7F, 0x6E, 0xB0, 0x38, 0x17, 0x90,
+    0xFC, 0xF2, 0x9F, 0x9D, 0x81, 0x21, 0xE1, 0xFF, 0x7B, 0x46, 0x06, 0x86, 0x1F, 0xFF, 0xF5, 0x40,
+    0xCC, 0xFB, 0x40, 0xE6, 0x83, 0xFF, 0xB2, 0x40, 0xB9, 0x4F, 0xFF, 0x41, 0x66, 0x7D, 0xFE, 0xCF,
+    0xCA, 0xC0, 0xC0, 0xF8, 0xF1, 0xBF, 0x8E, 0xC0, 0x56, 0xF9, 0x0D, 0xFF, 0x81, 0xA0, 0x5F, 0xE0,
+    0x2F, 0x90, 0x5C, 0xCF, 0x50, 0xF0, 0xE6, 0x7D, 0x0F, 0x13, 0x00, 0x33, 0x80, 0x28, 0xB4, 0x78,
+    0x9C, 0x55, 0xCE, 0x5B, 0x0D, 0xC2, 0x40, 0x10, 0x85, 0xE1, 0x13, 0x2E, 0xE1, 0x5E, 0xAA, 0x80,
+    0x92, 0x2A, 0x20, 0x18, 0xC0, 0x42, 0x1D, 0x2C, 0x0E, 0xC0, 0x01, 0x12, 0xC0, 0x01, 0x75, 0x50,
+    0x0B, 0x38, 0xC0, 0x02, 0xC1, 0x40, 0x1B, 0x02, 0x34, 0x14, 0xCA, 0xCF, 0xEE, 0xF6, 0x89, 0xF3,
+    0x72, 0xBE, 0x87, 0x99, 0xC9, 0x48, 0x2F, 0x86, 0xF2, 0xD9, 0xB2, 0x69, 0xA0, 0x07, 0xED, 0x06,
+    0xF3, 0x7A, 0xA6, 0xFF, 0x7C, 0x89, 0x7C, 0x2F, 0x60, 0xE7, 0x71, 0x80, 0xB3, 0xC7, 0x85, 0x8A,
+    0x96, 0xC3, 0x9D, 0x2B, 0x7D, 0x87, 0x2A, 0x4F, 0x99, 0x38, 0x70, 0x4C, 0x58, 0xD9, 0x4E, 0x30,
+    0x21, 0x7B, 0x8B, 0x94, 0xA9, 0x3E, 0xB9, 0x45, 0xC1, 0x58, 0x25, 0x1D, 0xE9, 0x49, 0x4F, 0x37,
+    0x06, 0xD2, 0x1B, 0x97, 0x40, 0xA1, 0x6F, 0x8C, 0xD6, 0x0D, 0x32, 0x9D, 0x30, 0x71, 0xBC, 0x04,
+    0x3B, 0x17, 0xB8, 0xEB, 0x74, 0x4B, 0xB7, 0x60, 0xBF, 0x1D, 0xD5, 0xFE, 0xE1, 0x82, 0xE8, 0x07,
+    0x77, 0x5A, 0x50, 0x90, 0x78, 0x9C, 0x5D, 0x8E, 0xC9, 0x0D, 0x82, 0x50, 0x14, 0x45, 0x6F, 0x1C,
+    0xA2, 0x46, 0x45, 0x3A, 0x20, 0x61, 0x6F, 0x62, 0x6C, 0xC0, 0x16, 0xE8, 0x00, 0x3A, 0xB1, 0x04,
+    0xED, 0x40, 0x3A, 0xA0, 0x05, 0x3B, 0x90, 0x12, 0x8C, 0x0D, 0x60, 0x9C, 0x88, 0x38, 0x1C, 0xFF,
+    0x7F, 0xEC, 0xBC, 0x9B, 0x73, 0xF2, 0xF2, 0x26, 0x49, 0x2A, 0x49, 0x65, 0x79, 0xD2, 0x33, 0x66,
+    0xCC, 0xDB, 0xC2, 0xB5, 0xD0, 0x5F, 0xBE, 0x44, 0xC6, 0x05, 0xAC, 0x4D, 0xB6, 0x70, 0x30, 0x39,
+    0xD2, 0xD0, 0xF1, 0x72, 0xE3, 0xC4, 0xD0, 0x4B, 0x53, 0xE5, 0x4C, 0xBD, 0xB0, 0x4B, 0x58, 0x39,
+    0x26, 0xA4, 0x21, 0x1B, 0x27, 0x39, 0x33, 0xBD, 0x2B, 0x27, 0x67, 0x26, 0xAA, 0xFD, 0xD5, 0x07,
+    0x03, 0x5D, 0x18, 0x49, 0x2F, 0x7C, 0x02, 0x85, 0x46, 0xF7, 0x59, 0xD6, 0x4A, 0xA1, 0x3D, 0x69,
+    0x1C, 0x2F, 0xC1, 0xF5, 0x05, 0x7E, 0x3B, 0xFD, 0xDA, 0x0F, 0xE8, 0xCE, 0xF8, 0x43, 0xD7, 0x96,
+    0x45, 0x3F, 0xA3, 0x15, 0x50, 0xD6, 0x78, 0x9C, 0x55, 0x8D, 0xCD, 0x11, 0xC1, 0x50, 0x18, 0x45,
+    0xAF, 0xBF, 0xC1, 0x20, 0xD2, 0x41, 0x66, 0xD2, 0x00, 0xA3, 0x01, 0x2D, 0xA4, 0x83, 0xA7, 0x04,
+    0x1D, 0x28, 0x81, 0x0E, 0x44, 0x05, 0x4A, 0xA0, 0x83, 0x94, 0xC0, 0x58, 0xD8, 0xC6, 0x18, 0xC4,
+    0x84, 0x38, 0xDE, 0x7B, 0x56, 0xEE, 0xE6, 0x9C, 0xC5, 0x77, 0xEF, 0x27, 0xA9, 0x62, 0x24, 0x97,
+    0x14, 0x0E, 0x35, 0x27, 0xCF, 0x6C, 0x43, 0xDF, 0x72, 0x4E, 0x47, 0xE7, 0x9D, 0xFE, 0xF2, 0x21,
+    0xF2, 0x1C, 0xC3, 0xC2, 0xCB, 0x0A, 0x32, 0x2F, 0x47, 0x4A, 0xEA, 0x4E, 0x6E, 0x9C, 0x6C, 0xD1,
+    0xA6, 0xCC, 0x53, 0x06, 0x4E, 0x58, 0x27, 0x4C, 0x2D, 0x13, 0x4C, 0xC8, 0xD2, 0xBF, 0x1A, 0xEA,
+    0x9D, 0x5B, 0xB9, 0xD8, 0x47, 0x05, 0x4D, 0xE9, 0x41, 0x5B, 0x57, 0xBA, 0xD2, 0x0B, 0x97, 0x40,
+    0xA1, 0x27, 0x46, 0xB3, 0x9F, 0x6C, 0xB5, 0xC7, 0xC4, 0xF1, 0x04, 0xEC, 0x5D, 0xE0, 0xD6, 0x69,
+    0x15, 0xAE, 0xA0, 0x3B, 0xBD, 0x8A, 0x86, 0x1F, 0x8B, 0xBE, 0x2F, 0xA7, 0x55, 0xB6, 0x78, 0x9C,
+    0x55, 0x8E, 0xBD, 0x0D, 0x82, 0x60, 0x14, 0x45, 0x6F, 0xFC, 0x37, 0x2A, 0xB2, 0x01, 0x09, 0x13,
+    0x18, 0x17, 0xD0, 0x11, 0xD8, 0x00, 0x37, 0x71, 0x04, 0xDC, 0x00, 0x9D, 0xC0, 0xD6, 0xD2, 0xC2,
+    0x9E, 0x11, 0x30, 0x56, 0x76, 0x18, 0xA3, 0x92, 0xE0, 0xCF, 0xF1, 0xE3, 0x59, 0x79, 0x9A, 0x7B,
+    0x8A, 0xFB, 0x6E, 0x9E, 0xB4, 0xC9, 0x3B, 0xF3, 0x54, 0x8E, 0x8A, 0xFC, 0x1C, 0xBB, 0xF4, 0xD9,
+    0xC1, 0xC8, 0x49, 0x94, 0xE8, 0x90, 0x35, 0xF4, 0xC7, 0x87, 0xC0, 0x72, 0x02, 0x4B, 0x93, 0x15,
+    0x64, 0x26, 0x47, 0x2A, 0xAC, 0x7C, 0xE3, 0x44, 0xCF, 0x06, 0x8B, 0xB5, 0xED, 0x88, 0x34, 0x62,
+    0x56, 0x0F, 0x12, 0xFB, 0x24, 0x4E, 0xD6, 0x8C, 0xF5, 0x2A, 0x9C, 0x5C, 0x18, 0xAA, 0xA4, 0x25,
+    0x3D, 0xE8, 0xEA, 0x4A, 0x5F, 0x7A, 0x52, 0xE3, 0xB9, 0x2F, 0x8C, 0x58, 0x8B, 0x9F, 0x6C, 0xB5,
+    0x27, 0x0E, 0xC3, 0x29, 0xB8, 0x9E, 0x67, 0xEF, 0xB6, 0xCB, 0xFA, 0x40, 0x77, 0x06, 0x6F, 0x9A,
+    0x36, 0x16, 0x7C, 0x01, 0xA9, 0x00, 0x56, 0x48, 0x78, 0x9C, 0x6D, 0x8D, 0xED, 0x0D, 0xC1, 0x60,
+    0x18, 0x45, 0x6F, 0x54, 0x83, 0xA0, 0xBA, 0x41, 0xA5, 0x13, 0x34, 0x5D, 0xC0, 0x0A, 0xDD, 0xA0,
+    0x36, 0x30, 0x82, 0x11, 0x74, 0x03, 0xDD, 0xC0, 0x0A, 0x36, 0x90, 0x58, 0x80, 0x18, 0x40, 0x45,
+    0x50, 0xA9, 0x8F, 0xE3, 0x7D, 0xDF, 0xFE, 0x75, 0xFF, 0xDC, 0xF3, 0xE3, 0x79, 0xCE, 0x95, 0xA6,
+    0x9E, 0x52, 0xD9, 0xDC, 0xD6, 0x19, 0x7D, 0x0B, 0xCF, 0x43, 0xC1, 0xC8, 0xC2, 0x7E, 0x91, 0x9C,
+    0x7D, 0xFD, 0xCF, 0x97, 0xC8, 0x75, 0x02, 0x4B, 0x07, 0x05, 0xEC, 0x1C, 0x1C, 0x69, 0xE8, 0x38,
+    0x21, 0xA7, 0x56, 0xD8, 0x54, 0x25, 0x63, 0x0B, 0x98, 0x89, 0x99, 0xE9, 0x8C, 0x3C, 0x64, 0x65,
+    0xA0, 0x64, 0xA2, 0x77, 0x65, 0xE0, 0x62, 0x16, 0x6B, 0xBA, 0xD2, 0x83, 0x9E, 0xAE, 0x0C, 0xA4,
+    0x17, 0x36, 0x81, 0x42, 0xD7, 0xE4, 0x9A, 0xB7, 0xB0, 0xD1, 0x96, 0x3C, 0x8E, 0x53, 0x30, 0x77,
+    0x81, 0xB5, 0xE3, 0xD7, 0xF6, 0x41, 0x77, 0x86, 0x1F, 0x3C, 0x27, 0x8B, 0x7E, 0x1C, 0xD2, 0x52,
+    0x93, 0x78, 0x9C, 0x25, 0x8E, 0xDD, 0x0D, 0x01, 0x41, 0x14, 0x85, 0x6F, 0xFC, 0x04, 0xC1, 0x9A,
+    0x44, 0x01, 0x64, 0x2B, 0x10, 0x0D, 0xD8, 0x12, 0xA6, 0x83, 0xD1, 0x81, 0x12, 0x56, 0x07, 0x74,
+    0x60, 0x3B, 0xD8, 0x16, 0x74, 0xE0, 0xD1, 0xAB, 0x68, 0x60, 0x44, 0xFC, 0x24, 0x8B, 0x7C, 0x66,
+    0xEE, 0x9C, 0x97, 0xF3, 0x3D, 0x9C, 0x73, 0xEE, 0x15, 0x11, 0x33, 0x95, 0xA4, 0x37, 0x03, 0xF5,
+    0xB9, 0x3F, 0x6F, 0x14, 0x6C, 0x59, 0xD4, 0x0A, 0x45, 0xBD, 0xDD, 0xA5, 0x0C, 0xAC, 0xD4, 0x17,
+    0x50, 0x2A, 0xEC, 0xE1, 0xA4, 0x70, 0xA1, 0xA1, 0x15, 0xE1, 0xC1, 0x95, 0x7E, 0x84, 0xC6, 0x57,
+    0x8C, 0xB5, 0x74, 0xB0, 0x5A, 0xB3, 0x38, 0x43, 0x1C, 0xAA, 0x98, 0xC8, 0xD7, 0x07, 0xB8, 0x31,
+    0x0A, 0x67, 0x3B, 0x22, 0x2F, 0x7A, 0x72, 0x8F, 0xF7, 0x3F, 0x44, 0x65, 0x62, 0xD4, 0x71, 0xB2,
+    0x4E, 0x50, 0xCB, 0x11, 0x97, 0xE7, 0x4B, 0x08, 0xB9, 0x2C, 0xAE, 0xD3, 0x4D, 0x0F, 0x3F, 0x19,
+    0xFE, 0x68, 0xEB, 0xD8, 0xEC, 0x0F, 0x10, 0x8F, 0x51, 0xD2, 0x78, 0x9C, 0x4D, 0xCD, 0xC1, 0x0D,
+    0x40, 0x40, 0x14, 0x04, 0xD0, 0x71, 0x10, 0x2E, 0x0E, 0x5B, 0x81, 0xE4, 0x57, 0xA0, 0x03, 0x25,
+    0x50, 0x8A, 0x50, 0x80, 0x12, 0xB6, 0x04, 0x3A, 0xD0, 0x8A, 0x4E, 0x24, 0x12, 0x89, 0x83, 0x64,
+    0x7C, 0x7E, 0xAC, 0x9D, 0xD3, 0xBB, 0xCC, 0x0C, 0x80, 0x8A, 0x96, 0x14, 0xC0, 0x1C, 0x79, 0x8F,
+    0x7C, 0x72, 0xA0, 0x77, 0xCE, 0x29, 0xC1, 0xA9, 0xE5, 0x88, 0x37, 0x1D, 0xEB, 0xE0, 0x95, 0x45,
+    0xF0, 0xC1, 0xAC, 0x7D, 0xAA, 0x9B, 0xFA, 0x62, 0xF2, 0xB9, 0xE2, 0x82, 0xCF, 0x33, 0x1B, 0xB5,
+    0x6D, 0xDA, 0x93, 0x75, 0xCF, 0xC8, 0xFC, 0xDD, 0x71, 0x12, 0xE9, 0xE9, 0x45, 0x44, 0x9F, 0x4A,
+    0xD8, 0x0E, 0xD3, 0x83, 0x79, 0xB0, 0x3E, 0x05, 0xDF, 0x17, 0x42, 0x6C, 0xE4, 0x78, 0x9C, 0x63,
+    0x60, 0x48, 0x78, 0xFD, 0x7F, 0x2D, 0x2B, 0x03, 0x83, 0xC1, 0xBF, 0xFF, 0xFF, 0xFF, 0xDF, 0x67,
+    0x60, 0xF8, 0x0A, 0xA4, 0xFE, 0xF7, 0x33, 0x08, 0xFC, 0xFB, 0x1F, 0x63, 0x7C, 0x4C, 0x9F, 0x61,
+    0xC1, 0xFF, 0xFD, 0x0C, 0x0C, 0x0C, 0x4C, 0x0C, 0x1F, 0xFE, 0xCB, 0x33, 0x80, 0xC0, 0x97, 0xFF,
+    0x5C, 0x60, 0xFA, 0xFB, 0x7F, 0x76, 0x30, 0xFD, 0xE3, 0x3F, 0x2B, 0x0A, 0xFD, 0xFD, 0x3F, 0x1B,
+    0x98, 0xFE, 0xFA, 0x9F, 0x13, 0x4C, 0x7F, 0xFC, 0xCF, 0x07, 0xA6, 0x0F, 0xFC, 0x9F, 0x0F, 0xA6,
+    0x1D, 0xFE, 0xFF, 0x8F, 0x36, 0x6A, 0x8D, 0x65, 0x60, 0xF8, 0x09, 0xB2, 0x27, 0x9F, 0x81, 0xA1,
+    0x01, 0x4A, 0x33, 0x34, 0xBD, 0x79, 0xBF, 0x16, 0x6C, 0xC6, 0x0F, 0x88, 0x0E, 0x01, 0xA8, 0x0E,
+    0x86, 0x85, 0xFF, 0x39, 0x40, 0x94, 0x42, 0x22, 0xC4, 0xEA, 0x0B, 0xFF, 0x21, 0x56, 0x2C, 0xF8,
+    0x5F, 0x0B, 0x24, 0x01, 0x01, 0xC4, 0x41, 0xAE, 0x78, 0x9C, 0x6B, 0xF8, 0xBF, 0x9E, 0x01, 0x08,
+    0xBE, 0xFF, 0x67, 0x03, 0x92, 0x0E, 0xFF, 0xEC, 0x41, 0x9C, 0x43, 0xEF, 0x19, 0x19, 0x20, 0xE0,
+    0xCF, 0x7F, 0x20, 0xE0, 0x40, 0x25, 0x05, 0x05, 0x05, 0x81, 0xE2, 0x10, 0x59, 0x64, 0x12, 0x08,
+    0x18, 0x51, 0x49, 0x5C, 0x2A, 0x95, 0x94, 0x94, 0x18, 0x31, 0x4D, 0x06, 0x00, 0x80, 0xE6, 0x46,
+    0xE5, 0x78, 0x9C, 0x63, 0x60, 0x70, 0xF8, 0x7F, 0x9F, 0x91, 0x81, 0xE1, 0xE1, 0x7F, 0x69, 0x06,
+    0x06, 0x86, 0x3F, 0xF3, 0x81, 0xC4, 0x82, 0xFF, 0xAC, 0x0C, 0x50, 0xF0, 0xE7, 0x3F, 0x10, 0x70,
+    0xA0, 0x92, 0x82, 0x82, 0x82, 0x40, 0x71, 0x88, 0x2C, 0x32, 0x09, 0x04, 0x8C, 0xA8, 0x24, 0x2E,
+    0x95, 0x4A, 0x4A, 0x4A, 0x8C, 0x98, 0x26, 0x03, 0x00, 0x7A, 0x87, 0x46, 0xE5, 0x78, 0x9C, 0x63,
+    0xF8, 0xF4, 0xFF, 0x3D, 0x23, 0x03, 0xC3, 0xDF, 0xFF, 0xFF, 0xB9, 0x19, 0x36, 0xFC, 0x97, 0xFA,
+    0xB3, 0x9E, 0xE1, 0x57, 0x3E, 0x43, 0xC3, 0x7F, 0x0E, 0x06, 0x30, 0xF8, 0xF3, 0x1F, 0x08, 0x38,
+    0x50, 0x49, 0x41, 0x41, 0x41, 0xA0, 0x38, 0x44, 0x16, 0x99, 0x04, 0x02, 0x46, 0x54, 0x12, 0x97,
+    0x4A, 0x25, 0x25, 0x25, 0x46, 0x4C, 0x93, 0x01, 0xEB, 0x23, 0x4B, 0xD7, 0x78, 0x9C, 0x63, 0x50,
+    0x62, 0x50, 0x60, 0x62, 0x48, 0xF8, 0xCF, 0xFE, 0x3D, 0x9F, 0x61, 0xC1, 0x7F, 0xEE, 0xDF, 0xEB,
+    0x19, 0x0C, 0xDE, 0xB1, 0x3C, 0xB1, 0x63, 0x40, 0x06, 0x7F, 0xFE, 0x03, 0x01, 0x07, 0x2A, 0x29,
+    0x28, 0x28, 0x08, 0x14, 0x87, 0xC8, 0x22, 0x93, 0x40, 0xC0, 0x88, 0x4A, 0xE2, 0x52, 0xA9, 0xA4,
+    0xA4, 0xC4, 0x88, 0x69, 0x32, 0x00, 0x3F, 0x67, 0x48, 0x34, 0x78, 0x9C, 0xFB, 0xF6, 0x9F, 0x87,
+    0x21, 0xE0, 0x7F, 0x3F, 0x03, 0xC3, 0xE3, 0xFF, 0xAC, 0x0C, 0x02, 0xBF, 0xF5, 0x19, 0x40, 0xE0,
+    0xC0, 0x7F, 0x7E, 0x6A, 0x60, 0x00, 0xF4, 0x79, 0x27, 0x7D, 0x78, 0x9C, 0x63, 0xF8, 0xF6, 0x9F,
+    0xDB, 0xE0, 0xFF, 0x7A, 0x86, 0x87, 0xFF, 0xD9, 0x19, 0xFE, 0xF8, 0x31, 0x80, 0xC1, 0x9F, 0xFF,
+    0xD4, 0xC1, 0x00, 0x95, 0xEA, 0x2A, 0xB6, 0x78, 0x9C, 0x63, 0x48, 0xF8, 0xFF, 0x9F, 0x8B, 0x81,
+    0xE1, 0xF3, 0xFF, 0xFF, 0xF5, 0x0C, 0x0A, 0xFF, 0xF2, 0x1F, 0xFF, 0x67, 0x7D, 0x78, 0x9F, 0x59,
+    0xE0, 0xB7, 0x3D, 0x03, 0x14, 0xFC, 0xF9, 0x4F, 0x2F, 0x12, 0x00, 0xAE, 0xC6, 0x30, 0x00, 0x78,
+    0x9C, 0x63, 0x10, 0x66, 0x30, 0x60, 0x3C, 0xF0, 0x9F, 0xE9, 0xAF, 0xFC, 0x87, 0xFF, 0xA2, 0xFF,
+    0xFD, 0x1B, 0xCE, 0x33, 0xFE, 0xE4, 0x66, 0x40, 0x80, 0x03, 0xFF, 0xF9, 0x69, 0x43, 0x00, 0x00,
+    0x8F, 0xEB, 0x29, 0x44, 0x78, 0x9C, 0x63, 0xF8, 0xF3, 0xFF, 0xFF, 0xFB, 0x6A, 0x46, 0x06, 0x06,
+    0x06, 0x20, 0xE3, 0xFF, 0xFF, 0x7E, 0x18, 0xE3, 0x3F, 0x37, 0x88, 0x21, 0xE8, 0xF4, 0xF3, 0xFF,
+    0x7C, 0x10, 0x83, 0x81, 0xC1, 0xE1, 0xFF, 0x7F, 0x26, 0x30, 0x83, 0xE1, 0xE7, 0x7F, 0x0E, 0x08,
+    0xE3, 0xF3, 0x7F, 0x1E, 0x08, 0xE3, 0xC3, 0x7F, 0xFE, 0x6F, 0x40, 0x2D, 0x7C, 0x0C, 0x0F, 0x30,
+    0x18, 0x1F, 0xFE, 0xF3, 0x09, 0x00, 0xCD, 0x61, 0x04, 0x2A, 0xE6, 0x86, 0x28, 0xFE, 0xF5, 0x9F,
+    0x1D, 0xCC, 0x48, 0xF8, 0xFF, 0x9F, 0x11, 0xC8, 0x50, 0x0A, 0xFA, 0xFD, 0xBF, 0x1E, 0x66, 0x29,
+    0x27, 0x94, 0x91, 0x07, 0x71, 0xC6, 0xBD, 0x2C, 0x20, 0x0D, 0x00, 0x0F, 0xA2, 0x57, 0xD7, 0x78,
+    0x9C, 0x4D, 0xCC, 0xB1, 0x0D, 0xC2, 0x30, 0x14, 0x84, 0xE1, 0x97, 0x14, 0xA4, 0x40, 0x62, 0x05,
+    0x7B, 0x23, 0x46, 0xC8, 0x0A, 0x6C, 0xC0, 0x06, 0x90, 0x0D, 0x3C, 0x82, 0x33, 0x02, 0x1B, 0xD0,
+    0xA4, 0x8F, 0xD2, 0xA5, 0x45, 0x18, 0xA4, 0x48, 0x09, 0x3F, 0x4F, 0x7E, 0x58, 0xE2, 0x8A, 0xD3,
+    0xA7, 0x2B, 0x4E, 0x64, 0x88, 0xF5, 0xCD, 0x89, 0x88, 0x87, 0xB8, 0x1C, 0x14, 0xDD, 0x7D, 0x86,
+    0x9D, 0x42, 0xE7, 0xF9, 0x22, 0x7F, 0x59, 0x39, 0x6A, 0xBF, 0xA8, 0x56, 0xC6, 0x02, 0x9A, 0x02,
+    0x67, 0x18, 0x09, 0x86, 0xF3, 0x46, 0x9D, 0x71, 0x4D, 0xEC, 0x33, 0x42, 0x4F, 0x6B, 0xF0, 0x7A,
+    0x90, 0x21, 0x0B, 0x4D, 0x52, 0x44, 0x99, 0x70, 0x86, 0x13, 0xE1, 0x99, 0x21, 0x1B, 0x6F, 0x43,
+    0xE2, 0x63, 0xE8, 0xC1, 0xE0, 0x0B, 0xF4, 0xE0, 0x87, 0x87, 0xE2, 0x0B, 0x7B, 0x02, 0x6A, 0xE2,
+    0x78, 0x9C, 0x63, 0x60, 0xF8, 0xF2, 0x5F, 0x8E, 0x01, 0x0C, 0x0C, 0xFE, 0xED, 0x87, 0x30, 0x18,
+    0x0E, 0xFE, 0xE7, 0x80, 0xB2, 0x7E, 0xC6, 0x33, 0xA0, 0x80, 0xC2, 0xD7, 0xFF, 0xF7, 0xB1, 0x01,
+    0xE9, 0x84, 0xFF, 0x40, 0xF0, 0x9E, 0x85, 0x81, 0xE1, 0x3B, 0x88, 0xF1, 0x3F, 0x9E, 0xC1, 0xE0,
+    0xFF, 0xFF, 0x1C, 0xE3, 0x6B, 0xFF, 0xFF, 0x33, 0x6D, 0xF8, 0x0F, 0x32, 0xE5, 0xCF, 0x7F, 0xCE,
+    0x8F, 0xFF, 0xE5, 0x81, 0x8C, 0x4F, 0xFF, 0xF9, 0xBF, 0xFE, 0xE7, 0x06, 0x32, 0x0E, 0xFC, 0xB7,
+    0xFF, 0x0E, 0x36, 0x76, 0xC2, 0xFF, 0xF8, 0x1F, 0xFF, 0xD9, 0x81, 0x8C, 0x86, 0xFF, 0xF9, 0x70,
+    0x06, 0x5C, 0xEA, 0x0B, 0x4C, 0x31, 0x5C, 0x3B, 0xDC, 0x40, 0xB8, 0x15, 0x70, 0x4B, 0x11, 0xCE,
+    0x80, 0x39, 0x0C, 0x00, 0x5B, 0xC7, 0x58, 0x8E, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x48, 0xF8,
+    0xBF, 0x9F, 0x01, 0x0C, 0x3E, 0xFF, 0xE7, 0x02, 0xD3, 0x02, 0xFF, 0xEA, 0x21, 0x02, 0x07, 0xDE,
+    0xB3, 0x30, 0xA0, 0x80, 0xC2, 0xD7, 0xFF, 0xF7, 0xB1, 0x81, 0xB5, 0x00, 0x01, 0x48, 0xF2, 0x3B,
+    0x88, 0xF1, 0x3F, 0x9E, 0xC1, 0xE0, 0xFF, 0xFF, 0x1C, 0xE3, 0x6B, 0xFF, 0xFF, 0x33, 0x6D, 0x00,
+    0x1B, 0xF6, 0xE7, 0x3F, 0xE7, 0xC7, 0xFF, 0xF2, 0x40, 0xC6, 0xA7, 0xFF, 0xFC, 0x5F, 0xFF, 0x73,
+    0x83, 0x8C, 0xFA, 0x6F, 0xFF, 0xFD, 0x3F, 0x07, 0x90, 0x31, 0xE1, 0x7F, 0xFC, 0x8F, 0xFF, 0xEC,
+    0x40, 0x46, 0xC3, 0xFF, 0x7C, 0x38, 0x03, 0x2E, 0xF5, 0x05, 0xA6, 0x18, 0xAE, 0x1D, 0x6E, 0x20,
+    0xDC, 0x0A, 0xB8, 0xA5, 0x08, 0x67, 0xC0, 0x1C, 0x06, 0x00, 0x7D, 0x7F, 0x58, 0xCA, 0x78, 0x9C,
+    0x63, 0x60, 0x60, 0xF8, 0xF9, 0xBF, 0x9E, 0x01, 0x04, 0x02, 0xFE, 0xFF, 0xFF, 0xCF, 0x02, 0x62,
+    0x7C, 0x79, 0x1F, 0xF2, 0xDF, 0x1E, 0x48, 0x2B, 0xFC, 0x97, 0x66, 0x38, 0xF4, 0x9E, 0x91, 0x01,
+    0x09, 0x14, 0xBE, 0xFE, 0xBF, 0x8F, 0x0D, 0x48, 0x27, 0x00, 0xD5, 0xFE, 0x7F, 0x0F, 0x54, 0xFD,
+    0x1D, 0xC4, 0xF8, 0x1F, 0xCF, 0x60, 0xF0, 0xFF, 0x7F, 0x8E, 0xF1, 0xB5, 0xFF, 0xFF, 0x99, 0x36,
+    0xFC, 0xDF, 0x0F, 0x94, 0xFF, 0xF3, 0x9F, 0xF3, 0xE3, 0x7F, 0x79, 0x20, 0xE3, 0xD3, 0x7F, 0xFE,
+    0xAF, 0xFF, 0xB9, 0x81, 0x8C, 0x03, 0xFF, 0xED, 0xBF, 0xFF, 0xE7, 0x00, 0x32, 0x26, 0xFC, 0x8F,
+    0xFF, 0xF1, 0x9F, 0x1D, 0xC8, 0x68, 0xF8, 0x9F, 0x0F, 0x67, 0xC0, 0xA5, 0xBE, 0xC0, 0x14, 0xC3,
+    0xB5, 0xC3, 0x0D, 0x84, 0x5B, 0x01, 0xB7, 0x14, 0xE1, 0x0C, 0x98, 0xC3, 0x00, 0x04, 0x15, 0x5D,
+    0x99, 0x78, 0x9C, 0x63, 0x60, 0x28, 0x78, 0x27, 0xC9, 0xF0, 0x8E, 0x01, 0x08, 0xBE, 0xFE, 0xFF,
+    0xBF, 0x73, 0x3F, 0x88, 0xF1, 0x67, 0xD6, 0xFF, 0xFF, 0xF6, 0x20, 0xC6, 0x7D, 0x86, 0x85, 0xEF,
+    0x59, 0x19, 0x90, 0x41, 0xE1, 0xEB, 0xFF, 0xFB, 0xD8, 0x80, 0x74, 0xC2, 0x7F, 0x20, 0x78, 0xCF,
+    0xC2, 0xC0, 0xF0, 0x1D, 0xC4, 0xF8, 0x1F, 0xCF, 0x60, 0xF0, 0xFF, 0x7F, 0x8E, 0xF1, 0xB5, 0xFF,
+    0xFF, 0x99, 0x36, 0xFC, 0x07, 0x99, 0xF1, 0xE7, 0x3F, 0xE7, 0xC7, 0xFF, 0xF2, 0x40, 0xC6, 0xA7,
+    0xFF, 0xFC, 0x5F, 0xFF, 0x73, 0x03, 0x19, 0x07, 0xFE, 0xDB, 0x7F, 0xFF, 0xCF, 0x01, 0x64, 0x4C,
+    0xF8, 0x1F, 0xFF, 0xE3, 0x3F, 0x3B, 0x90, 0xD1, 0xF0, 0x3F, 0x1F, 0xCE, 0x80, 0x4B, 0x7D, 0x81,
+    0x29, 0x86, 0x6B, 0x87, 0x1B, 0x08, 0xB7, 0x02, 0x6E, 0x29, 0xC2, 0x19, 0x30, 0x87, 0x01, 0x00,
+    0xBD, 0x2D, 0x5E, 0x87, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x66, 0x30, 0x64, 0x00, 0x81, 0x07,
+    0xF7, 0x05, 0xFE, 0xF1, 0x82, 0x18, 0x9F, 0xFE, 0x3B, 0xFD, 0x97, 0x07, 0x31, 0x36, 0xAC, 0x67,
+    0xF8, 0xCD, 0xC9, 0x80, 0x15, 0x14, 0xBE, 0xFE, 0xBF, 0x8F, 0x0D, 0x48, 0x27, 0xFC, 0x07, 0x82,
+    0xF7, 0x2C, 0x0C, 0x0C, 0xDF, 0x41, 0x8C, 0xFF, 0xF1, 0x0C, 0x06, 0xFF, 0xFF, 0xE7, 0x18, 0x5F,
+    0xFB, 0xFF, 0x9F, 0x69, 0xC3, 0xFF, 0xFD, 0x40, 0xF9, 0x3F, 0xFF, 0x39, 0x3F, 0x82, 0x0D, 0xFB,
+    0xF4, 0x9F, 0xFF, 0xEB, 0x7F, 0x6E, 0x20, 0xE3, 0xC0, 0x7F, 0xFB, 0xEF, 0xFF, 0x39, 0x80, 0x8C,
+    0x09, 0xFF, 0xE3, 0x7F, 0xFC, 0x67, 0x07, 0x32, 0x1A, 0xFE, 0xE7, 0xC3, 0x19, 0x70, 0xA9, 0x2F,
+    0x30, 0xC5, 0x70, 0xED, 0x70, 0x03, 0xE1, 0x56, 0xC0, 0x2D, 0x45, 0x38, 0x03, 0xE6, 0x30, 0x00,
+    0xB6, 0xFF, 0x5A, 0x32, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x01, 0x05, 0x19, 0x06, 0x86, 0x0D, 0x6C,
+    0x8F, 0xEE, 0x33, 0x32, 0xFC, 0x8E, 0xDF, 0xF0, 0x5F, 0x6F, 0xC3, 0x7F, 0x59, 0x86, 0xDF, 0xEF,
+    0xFF, 0x00, 0xB9, 0x1B, 0xFE, 0x03, 0x99, 0x0C, 0x02, 0xFF, 0xFF, 0x33, 0x33, 0x40, 0xD9, 0xBF,
+    0xEF, 0xFF, 0xBE, 0xCF, 0x08, 0x54, 0x00, 0x44, 0x10, 0xF5, 0x10, 0xBD, 0x60, 0x63, 0x18, 0x00,
+    0xBC, 0x7E, 0x1E, 0x80, 0x78, 0x9C, 0x3D, 0x8E, 0x31, 0x0A, 0xC2, 0x50, 0x10, 0x44, 0x27, 0x41,
+    0xD4, 0xA0, 0x90, 0xDC, 0xC0, 0x03, 0xD8, 0x08, 0x39, 0x40, 0x2E, 0x22, 0x7C, 0x6B, 0x9B, 0x8F,
+    0x27, 0xD0, 0x1B, 0xA8, 0x85, 0x7D, 0x8E, 0xF0, 0x2F, 0x10, 0xF5, 0x06, 0x82, 0x85, 0xAD, 0x9D,
+    0x4D, 0x8A, 0x10, 0x49, 0x4C, 0x0A, 0xFD, 0xE3, 0xFE, 0x08, 0x0E, 0x2C, 0x3B, 0x30, 0xCB, 0xBE,
+    0x01, 0x3A, 0xF5, 0x65, 0x56, 0x39, 0xB3, 0xC3, 0x05, 0x58, 0xD0, 0x69, 0x0B, 0x34, 0x9D, 0x51,
+    0x98, 0x91, 0xF3, 0xF8, 0x41, 0xFA, 0x86, 0x27, 0xA0, 0x22, 0x83, 0x92, 0x13, 0x44, 0xF6, 0xC3,
+    0xB0, 0xE6, 0x08, 0x29, 0xAF, 0x4C, 0x1A, 0x0E, 0x51, 0xAF, 0x53, 0xAA, 0x96, 0x83, 0xC8, 0x8E,
+    0x37, 0xD4, 0x62, 0x0C, 0x7D, 0x31, 0x12, 0xBD, 0x34, 0x76, 0x54, 0x15, 0xA7, 0x72, 0x7E, 0x66,
+    0x52, 0xF2, 0x5E, 0x78, 0x78, 0x32, 0x34, 0xEE, 0x3D, 0xDE, 0x0C, 0x04, 0xA1, 0xE3, 0x9B, 0x20,
+    0xFE, 0x50, 0xB4, 0x6E, 0x17, 0x3D, 0xC0, 0x2E, 0x73, 0x1E, 0x5D, 0xC1, 0xBD, 0xF7, 0x2B, 0xFB,
+    0x05, 0xE6, 0x9F, 0x62, 0x80, 0x78, 0x9C, 0x63, 0x78, 0xFC, 0x5F, 0x9F, 0x01, 0x04, 0x14, 0xFE,
+    0x9E, 0x07, 0xD3, 0x0C, 0x1B, 0xFF, 0x73, 0x41, 0x18, 0x3F, 0xF2, 0x19, 0x10, 0xE0, 0xDF, 0x7B,
+    0x20, 0xF1, 0xE1, 0x3F, 0x0F, 0xB5, 0xE9, 0xBF, 0x10, 0x9A, 0xFB, 0xCF, 0x7F, 0x46, 0x06, 0x86,
+    0xCF, 0xFF, 0xB9, 0x7E, 0xFE, 0x67, 0x67, 0x60, 0x00, 0x12, 0x9F, 0xFF, 0xCF, 0x37, 0x59, 0xF2,
+    0xFF, 0x3F, 0xE3, 0x84, 0xFF, 0x20, 0x90, 0x0F, 0x12, 0x03, 0x02, 0x36, 0x06, 0x06, 0x83, 0x9B,
+    0xFF, 0xCF, 0xA9, 0x33, 0x30, 0x00, 0x00, 0x32, 0x3C, 0x51, 0x4D, 0x78, 0x9C, 0x63, 0x60, 0x60,
+    0x50, 0xF8, 0xFF, 0x9E, 0x89, 0x01, 0x08, 0x2E, 0xFC, 0xD7, 0x05, 0x51, 0x0C, 0xBF, 0xF6, 0x83,
+    0xA9, 0x82, 0xFF, 0xEC, 0x0C, 0x08, 0xF0, 0xEF, 0x3D, 0x90, 0xF8, 0xF0, 0x9F, 0x87, 0xDA, 0xF4,
+    0x5F, 0x08, 0xCD, 0xFD, 0xE7, 0x3F, 0x23, 0x03, 0xC3, 0xE7, 0xFF, 0x5C, 0x3F, 0x41, 0xB6, 0x02,
+    0x89, 0xCF, 0xFF, 0xE7, 0x9B, 0x2C, 0xF9, 0xFF, 0x9F, 0x71, 0xC2, 0x7F, 0x10, 0xC8, 0x07, 0x89,
+    0x01, 0x01, 0x1B, 0x03, 0x83, 0xC1, 0xCD, 0xFF, 0xE7, 0xD4, 0x19, 0x18, 0x00, 0x3C, 0x19, 0x51,
+    0x6A, 0x78, 0x9C, 0x63, 0x60, 0xF8, 0xF4, 0xFF, 0x3D, 0x23, 0x03, 0x10, 0xFC, 0xF9, 0xFF, 0x9F,
+    0x1B, 0x48, 0x6D, 0xF8, 0x2F, 0xF5, 0x67, 0x3D, 0x90, 0xFE, 0x95, 0xCF, 0x50, 0xF0, 0x9F, 0x83,
+    0x01, 0x06, 0xFE, 0xBD, 0x07, 0x12, 0x1F, 0xFE, 0xF3, 0x50, 0x9B, 0xFE, 0x0B, 0xA1, 0xB9, 0xFF,
+    0xFC, 0x07, 0x3A, 0xE2, 0xF3, 0x7F, 0xAE, 0x9F, 0xFF, 0xD9, 0x19, 0x18, 0x80, 0xC4, 0xE7, 0xFF,
+    0xF3, 0x4D, 0x96, 0xFC, 0xFF, 0xCF, 0x38, 0xE1, 0x3F, 0x08, 0xE4, 0x83, 0xC4, 0x80, 0x80, 0x8D,
+    0x81, 0xC1, 0xE0, 0xE6, 0xFF, 0x73, 0xEA, 0x0C, 0x0C, 0x00, 0x83, 0x05, 0x56, 0x69, 0x78, 0x9C,
+    0x63, 0x60, 0x50, 0x62, 0x30, 0x60, 0x62, 0x60, 0x60, 0x28, 0xF8, 0xCF, 0xF6, 0x23, 0x1E, 0x48,
+    0x2F, 0xF8, 0xCF, 0xF5, 0x67, 0x3E, 0x90, 0x76, 0x78, 0xC7, 0xF2, 0xD4, 0x8E, 0x01, 0x03, 0xFC,
+    0x7B, 0x0F, 0x24, 0x3E, 0xFC, 0xE7, 0xA1, 0x36, 0xFD, 0x17, 0x42, 0x73, 0xFF, 0xF9, 0xCF, 0xC8,
+    0xC0, 0xF0, 0xF9, 0x3F, 0xD7, 0xCF, 0xFF, 0xEC, 0x0C, 0x0C, 0x40, 0xE2, 0xF3, 0xFF, 0xF9, 0x26,
+    0x4B, 0xFE, 0xFF, 0x67, 0x9C, 0xF0, 0x1F, 0x04, 0xF2, 0x41, 0x62, 0x40, 0xC0, 0xC6, 0xC0, 0x60,
+    0x70, 0xF3, 0xFF, 0x39, 0x75, 0x06, 0x06, 0x00, 0x60, 0xB1, 0x52, 0xE8, 0x78, 0x9C, 0x95, 0xCC,
+    0xC1, 0x09, 0xC2, 0x50, 0x10, 0x45, 0xD1, 0xAB, 0x12, 0x05, 0x49, 0x20, 0x7B, 0x41, 0xEC, 0x40,
+    0x3B, 0xB1, 0x84, 0x9F, 0x52, 0xEC, 0x40, 0x4B, 0xB0, 0x84, 0x74, 0x60, 0x29, 0xB1, 0x83, 0x20,
+    0x1F, 0x14, 0x09, 0x7A, 0xCD, 0xB8, 0x71, 0xED, 0x2C, 0xE6, 0xC0, 0x63, 0xE6, 0x01, 0xBC, 0x9C,
+    0x8F, 0x9B, 0x93, 0xFB, 0x80, 0x7B, 0x37, 0x0D, 0x76, 0xAE, 0xF8, 0xCD, 0x60, 0x01, 0xAD, 0x29,
+    0x5B, 0x41, 0xB6, 0x3C, 0x9B, 0x22, 0x9C, 0x6D, 0xEC, 0xC6, 0xCB, 0x0B, 0x3C, 0x2D, 0x5A, 0xB7,
+    0x70, 0xB3, 0xCA, 0x2E, 0xE1, 0x60, 0x1A, 0x9C, 0x40, 0xFD, 0xEE, 0x3D, 0x46, 0xC3, 0x43, 0xD7,
+    0xE1, 0x55, 0x17, 0x61, 0x63, 0xFF, 0x6D, 0xAE, 0xE3, 0xFB, 0x6F, 0x3F, 0x1B, 0x8B, 0x3B, 0x13,
+    0x78, 0x9C, 0xFB, 0xF3, 0x9F, 0x01, 0x04, 0xFE, 0xA0, 0x51, 0xFF, 0xDF, 0x67, 0x83, 0xA9, 0xFF,
+    0xFF, 0x75, 0x21, 0xD4, 0x7D, 0x20, 0x25, 0x58, 0xF4, 0xFF, 0x3F, 0x0B, 0x48, 0xC9, 0xF7, 0xFF,
+    0xEC, 0x20, 0xEA, 0xCB, 0x7F, 0x0E, 0x10, 0xF5, 0x03, 0xC4, 0x03, 0xC9, 0x31, 0x83, 0x55, 0xEE,
+    0x87, 0x68, 0x90, 0x01, 0x9B, 0x12, 0x85, 0x69, 0x34, 0x32, 0x05, 0x00, 0xDE, 0x85, 0x41, 0x22,
+    0x78, 0x9C, 0x1D, 0xCD, 0xB1, 0x09, 0xC2, 0x50, 0x18, 0xC4, 0xF1, 0x33, 0x5A, 0x09, 0x4A, 0x5A,
+    0x8B, 0x80, 0x0B, 0x28, 0x6E, 0xA0, 0x85, 0xBD, 0xA9, 0x53, 0x39, 0x48, 0x76, 0x10, 0x5C, 0x40,
+    0x9D, 0xC0, 0x0D, 0x24, 0x58, 0xB9, 0xC5, 0xE7, 0x06, 0x49, 0x15, 0x90, 0x90, 0xF7, 0xF7, 0x7D,
+    0xEF, 0x9A, 0x5F, 0x73, 0xC7, 0x29, 0xFF, 0x04, 0xAB, 0x24, 0xF5, 0xC4, 0x6C, 0x74, 0x70, 0x30,
+    0x35, 0xDC, 0x26, 0x25, 0x4C, 0x3B, 0x16, 0xD2, 0x8F, 0xAC, 0x63, 0x2E, 0x8D, 0x26, 0xF7, 0xCD,
+    0xD6, 0xDD, 0x05, 0xCB, 0xDC, 0x86, 0xA5, 0xDC, 0x2F, 0xA7, 0xE4, 0x1D, 0x56, 0x6E, 0x3E, 0xD0,
+    0xCE, 0xBC, 0x7F, 0x0E, 0xEC, 0xD3, 0xFE, 0xC1, 0x33, 0x29, 0x2C, 0x7A, 0xD4, 0x3A, 0xD9, 0xBF,
+    0x06, 0x2E, 0x6E, 0x3C, 0x2E, 0xA2, 0xD7, 0xB1, 0xAD, 0xF5, 0x07, 0x18, 0xBE, 0x56, 0x68, 0x78,
+    0x9C, 0x63, 0xF8, 0xF3, 0x9F, 0x8D, 0x01, 0x08, 0x16, 0xFC, 0xB7, 0x07, 0x51, 0x0C, 0xDF, 0xDF,
+    0x33, 0x82, 0x28, 0x87, 0x7F, 0x3C, 0x0C, 0xE8, 0x60, 0xCA, 0x9F, 0xFF, 0x35, 0x0C, 0x0C, 0x05,
+    0xFF, 0x81, 0x40, 0x8F, 0x41, 0xE0, 0xFF, 0xFB, 0x3F, 0xFF, 0xF7, 0x33, 0x30, 0xA4, 0x33, 0x32,
+    0xFC, 0xF9, 0x0F, 0xD6, 0xF2, 0xE3, 0x3F, 0x33, 0xC3, 0xE4, 0x3B, 0xFF, 0xFE, 0xFF, 0x67, 0x5E,
+    0x00, 0x52, 0xF2, 0x9F, 0xF9, 0xFB, 0xFF, 0x3E, 0x93, 0x9F, 0xFF, 0x99, 0xFF, 0x02, 0xC5, 0x81,
+    0x72, 0xFF, 0xDE, 0x33, 0x30, 0xFC, 0x06, 0xF1, 0x98, 0x12, 0x80, 0x72, 0xBF, 0xFE, 0x9F, 0xFF,
+    0x0B, 0xA4, 0x3E, 0x01, 0xD5, 0x3D, 0xF9, 0xCF, 0xAC, 0xF0, 0xEA, 0xBD, 0xD6, 0x84, 0xFF, 0xCC,
+    0x00, 0x4D, 0x5A, 0x42, 0x1D, 0x78, 0x9C, 0x63, 0x60, 0x60, 0xF8, 0xF4, 0xDF, 0x8E, 0x01, 0x08,
+    0xFE, 0xDC, 0x67, 0x02, 0x92, 0x0B, 0xFE, 0x4B, 0x83, 0x38, 0xDF, 0xFA, 0x19, 0x30, 0xC0, 0x94,
+    0x3F, 0xFF, 0x6B, 0x18, 0x18, 0x0A, 0xFE, 0x03, 0x81, 0x1E, 0x83, 0xC0, 0xFF, 0xF7, 0x7F, 0xFE,
+    0xEF, 0x67, 0x60, 0x48, 0x67, 0x64, 0xF8, 0xF3, 0x9F, 0x11, 0x24, 0xFD, 0xE3, 0x3F, 0x33, 0xC3,
+    0xE4, 0x3B, 0xFF, 0xFE, 0xFF, 0x67, 0x5E, 0x00, 0x52, 0xF2, 0x9F, 0xF9, 0xFB, 0xFF, 0x3E, 0x93,
+    0x9F, 0xFF, 0x99, 0xFF, 0x02, 0xC5, 0x81, 0x72, 0xFF, 0xDE, 0x33, 0x30, 0xFC, 0x06, 0xF1, 0x98,
+    0x12, 0x80, 0x72, 0xBF, 0xFE, 0x9F, 0xFF, 0x0B, 0xA4, 0x3E, 0x01, 0xD5, 0x3D, 0xF9, 0xCF, 0xAC,
+    0xF0, 0xEA, 0xBD, 0xD6, 0x84, 0xFF, 0xCC, 0x00, 0x63, 0x50, 0x42, 0x58, 0x78, 0x9C, 0x63, 0x10,
+    0xF8, 0xFF, 0x5F, 0x8E, 0x81, 0x81, 0xE1, 0xC0, 0xFF, 0xFF, 0xFB, 0x81, 0xD4, 0xEF, 0xF5, 0x07,
+    0xFF, 0x73, 0x31, 0x4C, 0xF8, 0xCF, 0xC6, 0xF0, 0xBD, 0x9F, 0x01, 0x0D, 0x4C, 0xF9, 0xF3, 0xBF,
+    0x86, 0x81, 0xA1, 0xE0, 0x3F, 0x10, 0xE8, 0x31, 0x08, 0xFC, 0x7F, 0xFF, 0x07, 0xA4, 0x23, 0x9D,
+    0x91, 0xE1, 0xCF, 0x7F, 0x46, 0x90, 0xF4, 0x8F, 0xFF, 0xCC, 0x0C, 0x93, 0xEF, 0xFC, 0xFB, 0xFF,
+    0x9F, 0x79, 0x01, 0x48, 0xC9, 0x7F, 0xE6, 0xEF, 0xFF, 0xFB, 0x4C, 0x7E, 0xFE, 0x67, 0xFE, 0x0B,
+    0x14, 0x07, 0xCA, 0xFD, 0x7B, 0x0F, 0x34, 0x1D, 0xC4, 0x63, 0x4A, 0x00, 0xCA, 0xFD, 0xFA, 0x7F,
+    0xFE, 0x2F, 0x90, 0xFA, 0x04, 0x54, 0xF7, 0xE4, 0x3F, 0xB3, 0xC2, 0xAB, 0xF7, 0x5A, 0x13, 0xFE,
+    0x33, 0x03, 0x00, 0xC8, 0x3E, 0x47, 0x45, 0x78, 0x9C, 0x63, 0x98, 0x70, 0x9F, 0xDD, 0x60, 0x3D,
+    0x03, 0xC3, 0xCF, 0xFF, 0xF7, 0x6F, 0xD4, 0x33, 0x30, 0xFC, 0xDF, 0xF1, 0xFF, 0x3F, 0x1F, 0x03,
+    0x50, 0x60, 0xF3, 0x79, 0x66, 0x06, 0x34, 0x30, 0xE5, 0xCF, 0xFF, 0x1A, 0x06, 0x86, 0x82, 0xFF,
+    0x40, 0xA0, 0xC7, 0x20, 0xF0, 0xFF, 0xFD, 0x9F, 0xFF, 0xFB, 0x19, 0x18, 0xD2, 0x19, 0x19, 0xFE,
+    0xFC, 0x67, 0x04, 0x49, 0xFF, 0xF8, 0xCF, 0xCC, 0x30, 0xF9, 0xCE, 0xBF, 0xFF, 0xFF, 0x99, 0x17,
+    0x80, 0x94, 0xFC, 0x67, 0xFE, 0xFE, 0xBF, 0xCF, 0xE4, 0xE7, 0x7F, 0xE6, 0xBF, 0x40, 0x71, 0xA0,
+    0xDC, 0xBF, 0xF7, 0x0C, 0x0C, 0xBF, 0x41, 0x3C, 0xA6, 0x04, 0xA0, 0xDC, 0xAF, 0xFF, 0xE7, 0xFF,
+    0x02, 0xA9, 0x4F, 0x40, 0x75, 0x4F, 0xFE, 0x33, 0x2B, 0xBC, 0x7A, 0xAF, 0x35, 0xE1, 0x3F, 0x33,
+    0x00, 0x09, 0x77, 0x47, 0xB7, 0x78, 0x9C, 0x63, 0x10, 0x60, 0x66, 0x30, 0x62, 0x60, 0x60, 0xF8,
+    0x32, 0x3F, 0xE0, 0x3F, 0x27, 0x03, 0xC3, 0xF7, 0xFB, 0x0D, 0xFF, 0x79, 0x18, 0x18, 0x2E, 0xE5,
+    0x1B, 0xBC, 0x65, 0x65, 0x40, 0x03, 0x53, 0xFE, 0xFC, 0xAF, 0x61, 0x60, 0x28, 0xF8, 0x0F, 0x04,
+    0x7A, 0x0C, 0x02, 0xFF, 0xDF, 0xFF, 0xF9, 0xBF, 0x9F, 0x81, 0x21, 0x9D, 0x91, 0xE1, 0xCF, 0x7F,
+    0x46, 0x90, 0xF4, 0x8F, 0xFF, 0xCC, 0x0C, 0x93, 0xEF, 0xFC, 0xFB, 0xFF, 0x9F, 0x79, 0x01, 0x48,
+    0xC9, 0x7F, 0xE6, 0xEF, 0xFF, 0xFB, 0x4C, 0x7E, 0xFE, 0x67, 0xFE, 0x0B, 0x14, 0x07, 0xCA, 0xFD,
+    0x7B, 0xCF, 0xC0, 0xF0, 0x1B, 0xC4, 0x63, 0x4A, 0x00, 0xCA, 0xFD, 0xFA, 0x7F, 0xFE, 0x2F, 0x90,
+    0xFA, 0x04, 0x54, 0xF7, 0xE4, 0x3F, 0xB3, 0xC2, 0xAB, 0xF7, 0x5A, 0x13, 0xFE, 0x33, 0x03, 0x00,
+    0x1B, 0x32, 0x44, 0x01, 0x78, 0x9C, 0x63, 0x60, 0x38, 0x7C, 0x9F, 0x8D, 0x01, 0x08, 0xFE, 0xFD,
+    0x89, 0x07, 0x92, 0x0E, 0xEB, 0x1D, 0xF6, 0x83, 0xA8, 0xF9, 0x0E, 0xEB, 0x11, 0x82, 0x30, 0x25,
+    0x28, 0x60, 0xCA, 0x9F, 0xFF, 0x35, 0x0C, 0x0C, 0x05, 0xFF, 0x81, 0x40, 0x8F, 0x41, 0xE0, 0xFF,
+    0xFB, 0x3F, 0xFF, 0x81, 0x1A, 0xD3, 0x19, 0x19, 0xFE, 0xFC, 0x67, 0x04, 0x49, 0xFF, 0xF8, 0xCF,
+    0xCC, 0x30, 0xF9, 0xCE, 0xBF, 0xFF, 0xFF, 0x99, 0x17, 0x80, 0x94, 0xFC, 0x67, 0xFE, 0xFE, 0xBF,
+    0xCF, 0xE4, 0xE7, 0x7F, 0xE6, 0xBF, 0x40, 0x71, 0xA0, 0xDC, 0xBF, 0xF7, 0x0C, 0x0C, 0xBF, 0x41,
+    0x3C, 0xA6, 0x04, 0xA0, 0xDC, 0xAF, 0xFF, 0xE7, 0xFF, 0x02, 0xA9, 0x4F, 0x40, 0x75, 0x4F, 0xFE,
+    0x33, 0x2B, 0xBC, 0x7A, 0xAF, 0x35, 0xE1, 0x3F, 0x33, 0x00, 0xE5, 0xF9, 0x46, 0xCB, 0x78, 0x9C,
+    0x63, 0x98, 0xF2, 0xF7, 0xBD, 0xB7, 0xC2, 0xCD, 0xFF, 0xBD, 0x8C, 0x0C, 0x05, 0xFF, 0x81, 0xE0,
+    0x17, 0x10, 0xDB, 0x31, 0x08, 0xFC, 0xBF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF7, 0xBB, 0xFF, 0xBF, 0x67,
+    0x60, 0x08, 0x63, 0x10, 0xF8, 0xF7, 0x9F, 0x9B, 0xE1, 0xF3, 0x7F, 0x76, 0x06, 0x20, 0xF8, 0xFD,
+    0x9F, 0x99, 0x61, 0x03, 0x90, 0x3B, 0xE5, 0xCD, 0x7F, 0x08, 0xE0, 0xDD, 0xF0, 0x1F, 0x06, 0x78,
+    0xBF, 0xFF, 0xAF, 0x33, 0xF9, 0xF3, 0xBF, 0xA2, 0xBC, 0xBC, 0x9C, 0xED, 0xEF, 0x7F, 0x26, 0xB0,
+    0x5A, 0x20, 0xF8, 0x07, 0x34, 0xE4, 0xDF, 0x7F, 0x0E, 0x10, 0x13, 0x28, 0xDA, 0xF0, 0xFF, 0x7F,
+    0x3E, 0x03, 0xC3, 0x16, 0x86, 0x9F, 0xFF, 0xCF, 0xFF, 0xBB, 0xFF, 0xEF, 0xFF, 0xB9, 0xBF, 0xFF,
+    0x19, 0x1F, 0x02, 0xF5, 0xCA, 0x3C, 0x06, 0x99, 0xC0, 0x28, 0xF0, 0xEA, 0x7D, 0x0E, 0x83, 0xC0,
+    0xF1, 0x7F, 0xF7, 0x2D, 0x19, 0x00, 0x16, 0x71, 0x5C, 0x65, 0x78, 0x9C, 0x63, 0x70, 0x78, 0xF5,
+    0x7E, 0x2E, 0x0B, 0xC3, 0xEF, 0xFF, 0xFF, 0xFF, 0xF3, 0x2E, 0x00, 0x12, 0xFF, 0xD9, 0x3F, 0xFF,
+    0x8F, 0x17, 0x5C, 0xC2, 0xF8, 0xE3, 0x3F, 0x1B, 0x03, 0x03, 0xC3, 0x9F, 0xFF, 0x8C, 0x40, 0xF2,
+    0xEF, 0x7F, 0x06, 0x38, 0x09, 0x11, 0xF9, 0x09, 0x96, 0xFD, 0x0A, 0x54, 0x39, 0x99, 0xF3, 0x00,
+    0x48, 0x17, 0x97, 0xC2, 0x5F, 0x10, 0xC9, 0x50, 0xF0, 0xE6, 0x7F, 0x2F, 0x50, 0xC1, 0x77, 0x7E,
+    0x90, 0xDA, 0x7F, 0xEB, 0x41, 0x6A, 0x1B, 0x80, 0xC2, 0x0C, 0x0A, 0x81, 0xFF, 0x79, 0x18, 0x18,
+    0x36, 0xFC, 0xFF, 0xCF, 0xC1, 0xC0, 0x30, 0xE1, 0x5F, 0x2F, 0x03, 0x03, 0x00, 0x5D, 0x74, 0x33,
+    0xB2, 0x78, 0x9C, 0x5D, 0xCD, 0xB1, 0x09, 0x83, 0x50, 0x14, 0x85, 0xE1, 0xA3, 0xA0, 0xA8, 0x21,
+    0xA3, 0x04, 0x6C, 0xB3, 0x44, 0x74, 0x1B, 0x9B, 0x0C, 0x91, 0x11, 0xB2, 0x44, 0xA6, 0x08, 0xC4,
+    0xDE, 0xC6, 0xF4, 0x29, 0x1E, 0x28, 0x88, 0xC1, 0xBC, 0xFC, 0xDE, 0x67, 0xE9, 0xDF, 0x7C, 0xC5,
+    0xB9, 0x70, 0xB5, 0x90, 0xC9, 0xBA, 0x51, 0x05, 0x34, 0xB9, 0x38, 0x50, 0xFE, 0x8F, 0xDA, 0x57,
+    0x7F, 0xDC, 0xD5, 0x58, 0x80, 0x93, 0xEE, 0xF4, 0x4F, 0x7A, 0x0D, 0xE4, 0x9A, 0x48, 0x66, 0x22,
+    0xBD, 0xC9, 0xC3, 0x04, 0x85, 0xDF, 0x38, 0x78, 0x1A, 0x2B, 0xF9, 0xD9, 0x66, 0xCD, 0xA4, 0x81,
+    0x91, 0x8B, 0xF4, 0xB0, 0x77, 0xBC, 0xBC, 0x93, 0xBE, 0x76, 0x68, 0x94, 0x1D, 0xED, 0x59, 0x2B,
+    0xA9, 0xDF, 0x3E, 0xD5, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x78, 0xF8, 0xDF, 0x9E, 0x01, 0x08, 0x7E,
+    0xBF, 0x67, 0x06, 0x92, 0x0D, 0xFF, 0x65, 0x40, 0x9C, 0xAF, 0xF3, 0x19, 0x30, 0x40, 0xC0, 0xEB,
+    0xF7, 0x35, 0x20, 0x75, 0xFF, 0xFF, 0xFF, 0xD7, 0x65, 0x58, 0xF0, 0xFF, 0xFE, 0xE9, 0xFF, 0xF7,
+    0x19, 0x3E, 0xFD, 0xE7, 0x64, 0xF8, 0xF6, 0x9F, 0xF5, 0xC7, 0x7F, 0x46, 0x86, 0x07, 0xFF, 0x39,
+    0x41, 0x52, 0xFF, 0xFF, 0x73, 0xFD, 0x05, 0x53, 0xDC, 0x7F, 0xFF, 0x97, 0x03, 0x01, 0xEB, 0x1F,
+    0xA0, 0x1C, 0x10, 0xFC, 0xF8, 0xCF, 0x06, 0xA2, 0x3E, 0xFF, 0xF7, 0x63, 0x60, 0xD8, 0xCA, 0x30,
+    0xE1, 0xFF, 0xFF, 0x73, 0x7F, 0xDF, 0x33, 0x30, 0xFC, 0x04, 0x2A, 0x04, 0x52, 0x06, 0xB7, 0xFE,
+    0x9F, 0xB7, 0x64, 0x00, 0x00, 0xBD, 0x8E, 0x3F, 0x0E, 0x78, 0x9C, 0x5D, 0x8A, 0x31, 0x0E, 0x01,
+    0x51, 0x14, 0x00, 0x67, 0x8B, 0x15, 0x8B, 0xAB, 0x48, 0xB4, 0x2A, 0x37, 0x10, 0x47, 0xD8, 0x5B,
+    0x68, 0x1C, 0x82, 0x1B, 0xB8, 0x84, 0x53, 0x48, 0x6C, 0xAF, 0x59, 0x8D, 0x4A, 0xF1, 0x13, 0x12,
+    0x59, 0xE1, 0x67, 0xBC, 0x55, 0x9A, 0x66, 0x8A, 0x19, 0xC8, 0x2E, 0x80, 0xBD, 0xA6, 0x02, 0xBA,
+    0x66, 0xE7, 0x84, 0xDA, 0x21, 0xD7, 0x86, 0x3F, 0x56, 0xB7, 0xB4, 0x09, 0xBD, 0xD5, 0x69, 0xFC,
+    0xED, 0xD1, 0x96, 0xBB, 0x15, 0x4F, 0xCB, 0xCE, 0x82, 0x8B, 0x55, 0x9F, 0x74, 0x94, 0x7F, 0x1A,
+    0x67, 0xD7, 0x41, 0xF9, 0x89, 0x16, 0x74, 0x0E, 0x7A, 0x3D, 0x5C, 0xC2, 0x81, 0xAD, 0x9E, 0x72,
+    0x82, 0x57, 0x8C, 0xA1, 0xD9, 0xD9, 0x66, 0xCE, 0x17, 0x32, 0x2D, 0x44, 0x1A, 0x78, 0x9C, 0x5D,
+    0xCA, 0x31, 0x0E, 0xC1, 0x60, 0x00, 0x86, 0xE1, 0x57, 0xA4, 0xA4, 0x3A, 0xE8, 0x45, 0x24, 0x35,
+    0xBA, 0x84, 0x38, 0x82, 0x5B, 0x58, 0xDC, 0x81, 0x23, 0xB8, 0x84, 0x03, 0x98, 0x25, 0xBA, 0x5B,
+    0x6A, 0xEF, 0xD0, 0xA4, 0x42, 0x2A, 0xFC, 0x79, 0xFD, 0x35, 0x7A, 0x97, 0x67, 0xF8, 0x3E, 0xF2,
+    0x21, 0x73, 0xA0, 0x2D, 0x0B, 0x33, 0x78, 0xB8, 0x76, 0x0A, 0xA7, 0x5D, 0x1E, 0xC6, 0xFC, 0xB5,
+    0xAA, 0x9B, 0x6D, 0xE4, 0xAD, 0xCE, 0x38, 0x58, 0x9D, 0xAD, 0x68, 0x4D, 0x79, 0x9A, 0x74, 0x0E,
+    0xB8, 0x99, 0xF6, 0x93, 0x4E, 0xC2, 0x8F, 0x2C, 0xB8, 0x89, 0x25, 0x9F, 0xB8, 0xC5, 0x3A, 0x47,
+    0x3D, 0x77, 0x97, 0x70, 0x64, 0xAF, 0x97, 0xD0, 0xC0, 0x2B, 0x1E, 0x23, 0xC5, 0xD5, 0x72, 0xC1,
+    0x17, 0x86, 0xDE, 0x40, 0xD8, 0x78, 0x9C, 0xBB, 0xF8, 0xDF, 0x9F, 0x41, 0xE0, 0xCF, 0x7B, 0x46,
+    0x86, 0x09, 0xFF, 0x79, 0x18, 0x18, 0xBE, 0xCD, 0x67, 0x80, 0x83, 0xFF, 0xEB, 0xC9, 0xC1, 0x00,
+    0x9E, 0x21, 0x1E, 0xD0, 0x78, 0x9C, 0x63, 0xD8, 0xF0, 0xBF, 0x9F, 0xE1, 0xFB, 0x7F, 0x36, 0x87,
+    0xFF, 0x7E, 0x0C, 0x0F, 0xCF, 0x33, 0x31, 0xC0, 0xC0, 0x87, 0xFF, 0x5C, 0x64, 0x61, 0x00, 0x51,
+    0x65, 0x23, 0x18, 0x78, 0x9C, 0x63, 0xD8, 0xF0, 0xFF, 0x3F, 0x2B, 0x03, 0xC3, 0xF7, 0xFF, 0xFF,
+    0xF5, 0x19, 0x12, 0xFE, 0xEB, 0x7D, 0x7F, 0xCF, 0xF8, 0x65, 0x3D, 0xA3, 0xC3, 0x5F, 0x5E, 0x06,
+    0x14, 0xF0, 0x7F, 0x3D, 0xB5, 0x49, 0x00, 0x1A, 0x39, 0x23, 0xBE, 0x78, 0x9C, 0x13, 0x60, 0x66,
+    0x30, 0x64, 0xF8, 0x74, 0xDE, 0xE0, 0x3F, 0xF7, 0xD7, 0xFF, 0x09, 0xFF, 0xF9, 0x0F, 0xF4, 0x0B,
+    0xFC, 0x65, 0x67, 0x40, 0x80, 0x0F, 0xFF, 0xB9, 0x28, 0x27, 0x00, 0x05, 0x2A, 0x24, 0xA3, 0x78,
+    0x9C, 0x25, 0x8C, 0xB1, 0x0D, 0x82, 0x60, 0x18, 0x05, 0xDF, 0x4F, 0x6C, 0x14, 0xA3, 0xD6, 0xC6,
+    0x1D, 0x64, 0x02, 0x31, 0x4C, 0xC0, 0x06, 0xAE, 0xC0, 0x00, 0x26, 0x68, 0x6B, 0xE5, 0x06, 0xBA,
+    0x89, 0x0C, 0x42, 0x22, 0xA5, 0x89, 0x24, 0x34, 0x0A, 0x05, 0xFE, 0x9C, 0x5F, 0x42, 0xF5, 0x92,
+    0xBB, 0xDC, 0x93, 0x2E, 0x2E, 0x0D, 0xA5, 0x3D, 0x79, 0x9F, 0x4B, 0x91, 0x87, 0xB5, 0xA4, 0x0F,
+    0x8D, 0x93, 0xAE, 0xC0, 0x5C, 0x4A, 0x1F, 0x09, 0x37, 0x83, 0x13, 0x75, 0x04, 0x3A, 0xFB, 0xE7,
+    0x8B, 0x69, 0x34, 0x98, 0x63, 0x51, 0x41, 0x09, 0xDB, 0x8E, 0x50, 0x5F, 0xE2, 0xDE, 0xF4, 0x9D,
+    0x83, 0x47, 0xCA, 0xC6, 0x39, 0x8D, 0xB0, 0x60, 0xD9, 0xB2, 0x51, 0xCB, 0xAC, 0x80, 0x9A, 0x26,
+    0x58, 0xFD, 0xAC, 0xDE, 0xD9, 0xF5, 0x9B, 0xA3, 0xD3, 0x1F, 0xEF, 0x98, 0x46, 0x5B, 0x78, 0x9C,
+    0x63, 0x70, 0xF8, 0xAB, 0xCD, 0xF0, 0x9B, 0x89, 0xE1, 0xE3, 0xFF, 0xFF, 0xB3, 0xFE, 0x33, 0x30,
+    0xFC, 0xE8, 0xF9, 0xF7, 0xBF, 0x9E, 0x01, 0x28, 0xD0, 0xF0, 0x8E, 0x83, 0x01, 0x15, 0x7C, 0x78,
+    0x2F, 0x70, 0xF3, 0xBF, 0x37, 0xC3, 0x87, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xE1, 0x3F,
+    0x08, 0xC8, 0x7F, 0xF8, 0x7F, 0x9E, 0xF9, 0xF2, 0xFF, 0xFC, 0x0F, 0xFF, 0xF5, 0x19, 0x12, 0xFE,
+    0xF7, 0x7F, 0xF8, 0xCF, 0xCB, 0x60, 0x00, 0xA2, 0xB8, 0x19, 0x14, 0x40, 0x14, 0x17, 0x69, 0x14,
+    0x00, 0xC4, 0x86, 0x47, 0x56, 0x78, 0x9C, 0x63, 0xF8, 0xF3, 0x9F, 0x8D, 0x01, 0x08, 0x16, 0xFC,
+    0xB7, 0x07, 0x51, 0x0C, 0xDF, 0xEF, 0x33, 0x82, 0x28, 0x87, 0x7F, 0xDC, 0x0C, 0xE8, 0xC0, 0xE1,
+    0xD5, 0xFB, 0x1A, 0xA0, 0xE4, 0xAF, 0xFF, 0xFF, 0xFF, 0xDB, 0x01, 0xD5, 0x03, 0xC1, 0x7B, 0xC6,
+    0xCF, 0xFF, 0xFD, 0x14, 0x7E, 0xFD, 0xE7, 0xFC, 0xF1, 0x9F, 0x95, 0xE1, 0xC2, 0x7F, 0xFE, 0x3F,
+    0xFF, 0x19, 0x18, 0x26, 0xFC, 0xB7, 0xFF, 0x0B, 0xA4, 0x0A, 0xFE, 0xFB, 0x83, 0xA8, 0x86, 0xFF,
+    0xF1, 0xBF, 0xFF, 0x33, 0x82, 0x04, 0xBF, 0x03, 0xED, 0x79, 0xF0, 0x9F, 0xFF, 0xD3, 0x7F, 0x3F,
+    0x81, 0x9F, 0xFF, 0xB9, 0x1A, 0x40, 0xDA, 0xFF, 0x33, 0x31, 0xFC, 0x04, 0x1B, 0xC6, 0xE0, 0x70,
+    0xEB, 0x7F, 0x0F, 0x23, 0x03, 0x00, 0x7C, 0x6F, 0x3F, 0x4B, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x38,
+    0xF0, 0x3F, 0x9F, 0x01, 0x08, 0x7E, 0xFC, 0x67, 0x05, 0x92, 0x01, 0xFF, 0xED, 0x40, 0x9C, 0x4F,
+    0xFB, 0x19, 0x19, 0xD0, 0x81, 0xC3, 0xAB, 0xF7, 0x35, 0x40, 0xD1, 0x5F, 0xFF, 0xFF, 0x03, 0xD5,
+    0x2C, 0x00, 0x92, 0xFF, 0xDF, 0x33, 0x7E, 0xFE, 0xEF, 0xA7, 0xF0, 0xEB, 0x3F, 0x27, 0x48, 0xEF,
+    0x85, 0xFF, 0xFC, 0x7F, 0xFE, 0x33, 0x30, 0x4C, 0xF8, 0x6F, 0xFF, 0x17, 0x48, 0x15, 0xFC, 0xF7,
+    0x07, 0x51, 0x0D, 0xFF, 0xE3, 0x7F, 0xFF, 0x67, 0x04, 0x09, 0x7E, 0xFF, 0xCF, 0xC6, 0xF0, 0xE0,
+    0x3F, 0xFF, 0xA7, 0xFF, 0x7E, 0x02, 0x3F, 0xFF, 0x73, 0x35, 0x80, 0xB4, 0xFF, 0x67, 0x62, 0xF8,
+    0x09, 0x36, 0x8C, 0xC1, 0xE1, 0xD6, 0xFF, 0x1E, 0x46, 0x06, 0x00, 0xA7, 0x82, 0x3F, 0xB5, 0x78,
+    0x9C, 0x63, 0x60, 0xF8, 0xF3, 0xDF, 0x9E, 0x81, 0x81, 0x61, 0xC2, 0xFF, 0xFF, 0xEF, 0x19, 0x19,
+    0x18, 0xBE, 0xDF, 0x9F, 0xF4, 0x5F, 0x96, 0x21, 0xE1, 0x3F, 0x27, 0xC3, 0xD3, 0xF3, 0x0C, 0x68,
+    0xC0, 0xE1, 0xD5, 0xFB, 0x1A, 0xA0, 0x92, 0x5F, 0xFF, 0xFF, 0xFF, 0xB7, 0x63, 0x58, 0x00, 0x24,
+    0x81, 0x3A, 0x3E, 0xFF, 0xF7, 0x53, 0xF8, 0xF5, 0x9F, 0xF3, 0xC7, 0x7F, 0x56, 0x86, 0x0B, 0xFF,
+    0xF9, 0xFF, 0xFC, 0x07, 0x19, 0x64, 0xFF, 0x17, 0x48, 0x15, 0xFC, 0xF7, 0x07, 0x51, 0x0D, 0xFF,
+    0xE3, 0x7F, 0xFF, 0x67, 0x04, 0x09, 0x7E, 0xFF, 0xCF, 0xC6, 0xF0, 0xE0, 0x3F, 0xFF, 0xA7, 0xFF,
+    0x7E, 0x02, 0x3F, 0xFF, 0x73, 0x35, 0x80, 0xB4, 0xFF, 0x67, 0x62, 0xF8, 0x09, 0x36, 0x8C, 0xC1,
+    0xE1, 0xD6, 0xFF, 0x1E, 0x46, 0x06, 0x00, 0x0D, 0xDA, 0x44, 0xA4, 0x78, 0x9C, 0x63, 0x98, 0x70,
+    0x9F, 0xDD, 0x60, 0x3D, 0x03, 0xC3, 0x8F, 0xFF, 0xF7, 0x6F, 0xD4, 0x33, 0x30, 0xFC, 0xDF, 0xF9,
+    0xFF, 0xBF, 0x1C, 0x03, 0x50, 0x60, 0xF3, 0x79, 0x66, 0x06, 0x34, 0xE0, 0xF0, 0xEA, 0x7D, 0x0D,
+    0x23, 0x03, 0xC3, 0xAF, 0xFF, 0xFF, 0xFF, 0xDB, 0x31, 0x2C, 0x00, 0x92, 0xFF, 0xDF, 0x33, 0x7E,
+    0xFE, 0xEF, 0xA7, 0xF0, 0xEB, 0x3F, 0xE7, 0x8F, 0xFF, 0xAC, 0x0C, 0x17, 0xFE, 0xF3, 0xFF, 0xF9,
+    0xCF, 0xC0, 0x30, 0xE1, 0xBF, 0xFD, 0x5F, 0x20, 0x55, 0xF0, 0xDF, 0x1F, 0x44, 0x35, 0xFC, 0x8F,
+    0xFF, 0xFD, 0x9F, 0x11, 0x24, 0xF8, 0xFD, 0x3F, 0x1B, 0xC3, 0x83, 0xFF, 0xFC, 0x9F, 0xFE, 0xFB,
+    0x09, 0xFC, 0xFC, 0xCF, 0xD5, 0x00, 0xD2, 0xFE, 0x9F, 0x89, 0xE1, 0x27, 0xD8, 0x30, 0x06, 0x87,
+    0x5B, 0xFF, 0x7B, 0x18, 0x19, 0x00, 0x48, 0x37, 0x45, 0x06, 0x78, 0x9C, 0x5D, 0x8C, 0xC1, 0x0D,
+    0x82, 0x40, 0x00, 0x04, 0xF7, 0x24, 0x92, 0x48, 0x62, 0xA0, 0x04, 0x5A, 0xA0, 0x01, 0xBD, 0x0A,
+    0xB0, 0x04, 0x5B, 0xA0, 0x00, 0x13, 0x28, 0xC0, 0x87, 0x25, 0xD8, 0x01, 0xAD, 0xE8, 0xD7, 0x97,
+    0x6F, 0x3F, 0x97, 0x48, 0x02, 0x02, 0x92, 0x81, 0xF3, 0xE9, 0x3E, 0x76, 0x92, 0x49, 0x76, 0x95,
+    0x04, 0xCA, 0x24, 0x35, 0xB5, 0x25, 0x92, 0x5A, 0x57, 0xB0, 0x95, 0xEE, 0x65, 0x3A, 0x85, 0xFA,
+    0x8B, 0x7D, 0xB9, 0x93, 0x91, 0x06, 0x60, 0xA7, 0xEB, 0xD2, 0x38, 0xD3, 0x90, 0xA7, 0x03, 0x9B,
+    0x0F, 0x6B, 0xDD, 0x88, 0xBF, 0x48, 0x17, 0xF6, 0xD3, 0x82, 0x82, 0x83, 0x47, 0xC5, 0x71, 0xC4,
+    0x78, 0xD9, 0x11, 0xEA, 0x49, 0xFC, 0x26, 0x4F, 0x7A, 0xA2, 0xCA, 0xCF, 0x59, 0xA9, 0xFF, 0x9D,
+    0xC9, 0x3E, 0x38, 0x1B, 0xCD, 0x59, 0x36, 0x41, 0x4F, 0x78, 0x9C, 0x63, 0x60, 0xB8, 0x14, 0xC7,
+    0x00, 0x02, 0x3F, 0xCE, 0x83, 0xA9, 0xEF, 0xFB, 0xC1, 0x54, 0x83, 0x26, 0x03, 0x1C, 0xFC, 0xFB,
+    0x0F, 0x02, 0xCC, 0x50, 0x6A, 0xE5, 0x2A, 0x10, 0x60, 0x82, 0xCB, 0xE2, 0xD6, 0x0E, 0x00, 0xF1,
+    0x61, 0x1A, 0xA2, 0x78, 0x9C, 0x15, 0x8D, 0xB1, 0x0D, 0x83, 0x30, 0x00, 0x04, 0x1F, 0xA4, 0x48,
+    0x11, 0x0D, 0x2C, 0x41, 0xCF, 0x04, 0xB1, 0x27, 0x60, 0x05, 0xE6, 0xA0, 0x63, 0x00, 0x0A, 0x46,
+    0xC8, 0x06, 0xAC, 0x90, 0x11, 0xB2, 0x81, 0xA9, 0x69, 0x2C, 0x41, 0x01, 0x4E, 0x40, 0x07, 0xFE,
+    0xE2, 0xAE, 0x3A, 0xBD, 0x74, 0x2F, 0x95, 0xEC, 0xEC, 0xFB, 0x51, 0xFA, 0x01, 0x5E, 0x6F, 0xA2,
+    0x92, 0x95, 0xDA, 0x42, 0xB6, 0xF3, 0xF8, 0x40, 0x7E, 0xA0, 0xCD, 0x61, 0x4E, 0x2A, 0x5A, 0x9A,
+    0x93, 0xAF, 0xEB, 0x68, 0xFE, 0x04, 0x33, 0x60, 0x76, 0x78, 0x4E, 0xE4, 0x0B, 0xBE, 0x08, 0x64,
+    0x43, 0xCC, 0x49, 0x6D, 0xE4, 0x4B, 0x9D, 0x9B, 0xE9, 0x13, 0xA9, 0x8C, 0x4F, 0xBA, 0x00, 0xE9,
+    0x9C, 0x43, 0x93, 0x78, 0x9C, 0x63, 0xF8, 0xFD, 0x9F, 0x83, 0x01, 0x08, 0x26, 0xFC, 0xF7, 0x07,
+    0x51, 0x0C, 0xDF, 0xDE, 0x33, 0x81, 0x28, 0x83, 0x7F, 0xBC, 0x0C, 0x68, 0xE0, 0xD3, 0x7F, 0x4E,
+    0x06, 0x87, 0xFF, 0xF5, 0x64, 0x50, 0x5C, 0x0C, 0x09, 0xFF, 0xEB, 0x3F, 0xFE, 0xE7, 0x65, 0xD8,
+    0xF0, 0xBF, 0xFE, 0xC3, 0xFF, 0x7C, 0x86, 0xEF, 0xFF, 0xEB, 0x17, 0xFC, 0x07, 0x81, 0x7A, 0x85,
+    0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xA9, 0x67, 0x98, 0xF8, 0x6F, 0x1F, 0xCB, 0x8F, 0x7A, 0x00, 0x0B,
+    0x0A, 0x40, 0xA2, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x48, 0xF8, 0x7F, 0x9E, 0x01, 0x08, 0x3E, 0xFD,
+    0xE7, 0x02, 0x92, 0x02, 0x7F, 0xFB, 0x41, 0x9C, 0x0D, 0xEF, 0x59, 0x18, 0xD0, 0xC0, 0xA7, 0xFF,
+    0x9C, 0x0C, 0x0E, 0xFF, 0xEB, 0xC9, 0xA0, 0xB8, 0x80, 0x56, 0xD4, 0x7F, 0xFC, 0xCF, 0xCB, 0xB0,
+    0xE1, 0x7F, 0xFD, 0x87, 0xFF, 0xF9, 0x0C, 0xDF, 0xFF, 0xD7, 0x2F, 0xF8, 0x0F, 0x02, 0xF5, 0x0A,
+    0xFF, 0xFE, 0xFF, 0xEF, 0xFF, 0x53, 0xCF, 0x30, 0xF1, 0xDF, 0x3E, 0x96, 0x1F, 0xF5, 0x00, 0x32,
+    0xB9, 0x41, 0x08, 0x78, 0x9C, 0x9D, 0xC5, 0xB1, 0x0D, 0x40, 0x40, 0x18, 0x86, 0xE1, 0xAF, 0xB8,
+    0x44, 0x48, 0xEC, 0x70, 0x53, 0xE8, 0x24, 0x46, 0xB1, 0xC1, 0x8D, 0xF0, 0x8F, 0x20, 0x36, 0x60,
+    0x02, 0x26, 0xB0, 0x8B, 0x0D, 0x90, 0x08, 0x05, 0xF7, 0x8A, 0x52, 0xEB, 0x69, 0x1E, 0x69, 0x67,
+    0x90, 0xE4, 0x81, 0x44, 0x9A, 0x29, 0x62, 0x90, 0xEE, 0x52, 0x3D, 0x4E, 0x1F, 0x1B, 0xA9, 0x2A,
+    0xEC, 0x47, 0x99, 0x6A, 0x6C, 0x25, 0xD7, 0x88, 0x2D, 0x04, 0x1D, 0x58, 0xC7, 0xCB, 0x7C, 0x84,
+    0xE6, 0x32, 0xB5, 0x71, 0x72, 0xA7, 0x3D, 0x85, 0x6B, 0x45, 0xC8, 0x78, 0x9C, 0x63, 0x60, 0x10,
+    0x66, 0x30, 0x60, 0x64, 0x60, 0xD8, 0xF0, 0x9F, 0xE9, 0xAF, 0x3E, 0x03, 0xC3, 0x87, 0xFF, 0xAC,
+    0xFF, 0xFD, 0x19, 0x18, 0x1A, 0xCE, 0x33, 0xFE, 0xE4, 0x61, 0x40, 0x05, 0x9F, 0xFE, 0x73, 0x32,
+    0x38, 0xFC, 0xAF, 0x27, 0x83, 0xE2, 0x62, 0x48, 0xF8, 0x5F, 0xFF, 0xF1, 0x3F, 0x2F, 0xD0, 0x92,
+    0xFA, 0x0F, 0xFF, 0xF3, 0x19, 0xBE, 0xFF, 0xAF, 0x5F, 0xF0, 0x1F, 0x04, 0xEA, 0x15, 0xFE, 0xFD,
+    0xFF, 0xDF, 0xFF, 0xA7, 0x9E, 0x61, 0xE2, 0xBF, 0x7D, 0x2C, 0x3F, 0xEA, 0x01, 0xC1, 0x15, 0x42,
+    0x58, 0x78, 0x9C, 0x65, 0x8E, 0xBD, 0x0D, 0xC2, 0x60, 0x0C, 0x44, 0x8F, 0x2F, 0x42, 0xE1, 0x47,
+    0x8A, 0xD8, 0x20, 0x25, 0x2D, 0x1B, 0x90, 0x09, 0x80, 0x9E, 0x15, 0xD8, 0x01, 0x36, 0x60, 0x05,
+    0x36, 0x08, 0x23, 0xB0, 0x01, 0x64, 0x02, 0xC4, 0x04, 0x88, 0x20, 0x25, 0x29, 0xE0, 0x3B, 0xCE,
+    0x4E, 0xC9, 0x35, 0xCF, 0x96, 0x4E, 0xCF, 0x06, 0x70, 0xE2, 0x11, 0x96, 0x86, 0xA9, 0x61, 0xC1,
+    0x95, 0xAF, 0x8F, 0x6B, 0xC0, 0x7F, 0x3E, 0x4C, 0x80, 0xC8, 0x41, 0xC3, 0x91, 0x9A, 0x25, 0x5E,
+    0xCC, 0x70, 0xE0, 0x5A, 0x92, 0x25, 0x6E, 0x9A, 0x0B, 0xC9, 0x6A, 0x8E, 0x81, 0xEF, 0x1D, 0x9D,
+    0x75, 0x5B, 0x06, 0x8D, 0x50, 0x71, 0xCE, 0xBD, 0x78, 0xE6, 0x8E, 0xB9, 0xB8, 0x61, 0xC9, 0xA9,
+    0x19, 0xE3, 0x93, 0x43, 0x63, 0x47, 0xFA, 0x85, 0x5A, 0x56, 0xCB, 0x45, 0xD6, 0x9E, 0x99, 0xF3,
+    0xAD, 0x8B, 0xC0, 0xAC, 0x88, 0x0C, 0xDE, 0xEA, 0xBF, 0x16, 0x27, 0xC6, 0x8A, 0x5B, 0x6F, 0xFD,
+    0x00, 0x49, 0xA3, 0x45, 0x4F, 0x78, 0x9C, 0xFB, 0xF0, 0x9F, 0x8B, 0x01, 0x08, 0x3E, 0xE0, 0xA7,
+    0x6E, 0xBC, 0x97, 0x04, 0x52, 0x37, 0xFF, 0xFF, 0x7F, 0xCF, 0xF8, 0xE1, 0x3F, 0x08, 0x70, 0x7F,
+    0xF8, 0xBF, 0x9F, 0xE9, 0xEB, 0x7F, 0xFD, 0x0F, 0xFF, 0xF9, 0x19, 0x1A, 0xFE, 0xE7, 0x7F, 0xF8,
+    0xCF, 0xC3, 0x60, 0xF0, 0x7F, 0x3E, 0x48, 0x83, 0xC2, 0xFF, 0xF5, 0x1F, 0xFE, 0x73, 0x43, 0x28,
+    0xA8, 0xA0, 0x3C, 0x50, 0x49, 0xFD, 0x87, 0xFF, 0xE7, 0x85, 0xC1, 0x1A, 0xA0, 0xDA, 0xFF, 0x40,
+    0x0C, 0xD3, 0x7C, 0x05, 0x36, 0x9A, 0x18, 0x47, 0x80, 0x28, 0x00, 0x4B, 0x2F, 0x55, 0xF2, 0x78,
+    0x9C, 0x65, 0x8E, 0xBB, 0x0D, 0xC2, 0x40, 0x10, 0x05, 0x9F, 0x8D, 0x90, 0xF8, 0x48, 0x16, 0x12,
+    0x22, 0x26, 0x24, 0x75, 0x07, 0xB8, 0x03, 0x93, 0xD3, 0x02, 0x3D, 0xE0, 0x0E, 0x68, 0x81, 0x0E,
+    0x4C, 0x09, 0x74, 0x00, 0x54, 0xE0, 0x12, 0xC0, 0x46, 0x02, 0x23, 0xE1, 0x1B, 0xF6, 0x0E, 0x32,
+    0x36, 0x99, 0x0D, 0xDE, 0xBE, 0x59, 0x69, 0xAA, 0x34, 0x92, 0x74, 0x24, 0xEE, 0xE6, 0xC6, 0x1B,
+    0x33, 0x72, 0x63, 0x71, 0x8A, 0x5E, 0x63, 0xFD, 0xCD, 0x9B, 0x9E, 0xE4, 0x88, 0x1E, 0x0C, 0x94,
+    0x52, 0xAA, 0x26, 0x51, 0x61, 0x07, 0x7B, 0x96, 0x3A, 0xDB, 0x9E, 0xB1, 0x53, 0xC3, 0x50, 0xEA,
+    0x2A, 0xB5, 0x3E, 0xFB, 0xB4, 0xDE, 0xCA, 0x0E, 0x6B, 0x16, 0x6C, 0x8D, 0x07, 0x36, 0x78, 0xCF,
+    0x8A, 0x92, 0xD0, 0xEF, 0xAE, 0xF4, 0x3D, 0x5B, 0x08, 0x86, 0xC6, 0x5A, 0x15, 0x1E, 0xCA, 0x7F,
+    0x4C, 0x02, 0xEF, 0x66, 0x94, 0x26, 0x99, 0x23, 0x0E, 0x29, 0x13, 0x7D, 0x39, 0xF2, 0xBC, 0xB0,
+    0x0E, 0xA9, 0x0F, 0x40, 0xD0, 0x46, 0xBD,
+};
+const GFXglyph OpenSans12BGlyphs[] = {
+    { 0, 0, 7, 0, 0, 8, 0 }, //  
+    { 5, 18, 7, 1, 18, 59, 8 }, // !
+    { 10, 6, 12, 1, 18, 41, 67 }, // "
+    { 16, 18, 16, 0, 18, 122, 108 }, // #
+    { 13, 20, 14, 1, 19, 109, 230 }, // $
+    { 22, 18, 23, 0, 18, 165, 339 }, // %
+    { 18, 18, 19, 1, 18, 138, 504 }, // &
+    { 5, 6, 7, 1, 18, 27, 642 }, // '
+    { 7, 22, 8, 1, 18, 80, 669 }, // (
+    { 8, 22, 8, 0, 18, 81, 749 }, // )
+    { 13, 13, 14, 0, 19, 90, 830 }, // *
+    { 13, 13, 14, 1, 15, 40, 920 }, // +
+    { 6, 6, 7, 0, 3, 27, 960 }, // ,
+    { 8, 4, 8, 0, 8, 19, 987 }, // -
+    { 5, 5, 7, 1, 5, 24, 1006 }, // .
+    { 11, 18, 10, 0, 18, 91, 1030 }, // /
+    { 14, 18, 14, 0, 18, 109, 1121 }, // 0
+    { 10, 18, 14, 1, 18, 45, 1230 }, // 1
+    { 14, 18, 14, 0, 18, 95, 1275 }, // 2
+    { 14, 18, 14, 0, 18, 107, 1370 }, // 3
+    { 14, 18, 14, 0, 18, 76, 1477 }, // 4
+    { 13, 18, 14, 1, 18, 98, 1553 }, // 5
+    { 14, 18, 14, 0, 18, 126, 1651 }, // 6
+    { 14, 18, 14, 0, 18, 91, 1777 }, // 7
+    { 14, 18, 14, 0, 18, 125, 1868 }, // 8
+    { 14, 18, 14, 0, 18, 121, 1993 }, // 9
+    { 5, 14, 7, 1, 14, 36, 2114 }, // :
+    { 6, 17, 7, 0, 14, 44, 2150 }, // ;
+    { 13, 14, 14, 1, 16, 74, 2194 }, // <
+    { 13, 7, 14, 1, 13, 27, 2268 }, // =
+    { 13, 14, 14, 1, 16, 70, 2295 }, // >
+    { 12, 18, 12, 0, 18, 90, 2365 }, // ?
+    { 21, 20, 22, 1, 18, 198, 2455 }, // @
+    { 18, 18, 17, 0, 18, 130, 2653 }, // A
+    { 14, 18, 17, 2, 18, 92, 2783 }, // B
+    { 15, 18, 16, 1, 18, 113, 2875 }, // C
+    { 16, 18, 19, 2, 18, 98, 2988 }, // D
+    { 11, 18, 14, 2, 18, 40, 3086 }, // E
+    { 11, 18, 14, 2, 18, 33, 3126 }, // F
+    { 16, 18, 18, 1, 18, 122, 3159 }, // G
+    { 15, 18, 19, 2, 18, 31, 3281 }, // H
+    { 5, 18, 8, 2, 18, 14, 3312 }, // I
+    { 9, 23, 8, -2, 18, 40, 3326 }, // J
+    { 15, 18, 17, 2, 18, 96, 3366 }, // K
+    { 12, 18, 14, 2, 18, 26, 3462 }, // L
+    { 20, 18, 24, 2, 18, 132, 3488 }, // M
+    { 17, 18, 20, 2, 18, 96, 3620 }, // N
+    { 18, 18, 20, 1, 18, 102, 3716 }, // O
+    { 13, 18, 16, 2, 18, 70, 3818 }, // P
+    { 18, 22, 20, 1, 18, 131, 3888 }, // Q
+    { 15, 18, 17, 2, 18, 97, 4019 }, // R
+    { 12, 18, 14, 1, 18, 105, 4116 }, // S
+    { 14, 18, 14, 0, 18, 31, 4221 }, // T
+    { 15, 18, 19, 2, 18, 66, 4252 }, // U
+    { 17, 18, 16, 0, 18, 130, 4318 }, // V
+    { 25, 18, 24, 0, 18, 173, 4448 }, // W
+    { 17, 18, 17, 0, 18, 132, 4621 }, // X
+    { 16, 18, 16, 0, 18, 93, 4753 }, // Y
+    { 14, 18, 14, 0, 18, 82, 4846 }, // Z
+    { 7, 22, 8, 1, 18, 27, 4928 }, // [
+    { 11, 18, 10, 0, 18, 89, 4955 }, // <backslash>
+    { 7, 22, 8, 0, 18, 28, 5044 }, // ]
+    { 14, 12, 13, 0, 18, 78, 5072 }, // ^
+    { 12, 2, 10, -1, -2, 17, 5150 }, // _
+    { 8, 4, 15, 4, 19, 24, 5167 }, // `
+    { 13, 14, 15, 1, 14, 98, 5191 }, // a
+    { 14, 19, 16, 1, 19, 94, 5289 }, // b
+    { 12, 14, 13, 1, 14, 72, 5383 }, // c
+    { 13, 19, 16, 1, 19, 94, 5455 }, // d
+    { 13, 14, 15, 1, 14, 92, 5549 }, // e
+    { 11, 19, 10, 0, 19, 57, 5641 }, // f
+    { 14, 20, 14, 0, 14, 133, 5698 }, // g
+    { 14, 19, 16, 1, 19, 62, 5831 }, // h
+    { 5, 19, 8, 1, 19, 29, 5893 }, // i
+    { 8, 25, 8, -2, 19, 50, 5922 }, // j
+    { 15, 19, 16, 1, 19, 90, 5972 }, // k
+    { 5, 19, 8, 1, 19, 14, 6062 }, // l
+    { 22, 14, 25, 1, 14, 87, 6076 }, // m
+    { 14, 14, 16, 1, 14, 57, 6163 }, // n
+    { 14, 14, 15, 1, 14, 98, 6220 }, // o
+    { 14, 20, 16, 1, 14, 96, 6318 }, // p
+    { 13, 20, 16, 1, 14, 89, 6414 }, // q
+    { 10, 14, 11, 1, 14, 44, 6503 }, // r
+    { 11, 14, 12, 1, 14, 88, 6547 }, // s
+    { 11, 17, 11, 0, 17, 63, 6635 }, // t
+    { 14, 14, 16, 1, 14, 58, 6698 }, // u
+    { 15, 14, 14, 0, 14, 106, 6756 }, // v
+    { 22, 14, 21, 0, 14, 142, 6862 }, // w
+    { 15, 14, 14, 0, 14, 106, 7004 }, // x
+    { 15, 20, 14, 0, 14, 127, 7110 }, // y
+    { 12, 14, 12, 0, 14, 78, 7237 }, // z
+    { 9, 22, 10, 0, 18, 68, 7315 }, // {
+    { 4, 25, 14, 5, 19, 13, 7383 }, // |
+    { 9, 22, 10, 1, 18, 74, 7396 }, // }
+    { 13, 7, 14, 1, 12, 50, 7470 }, // ~
+    { 0, 0, 7, 0, 0, 8, 7520 }, //  
+    { 5, 19, 7, 1, 14, 64, 7528 }, // ¡
+    { 12, 18, 14, 1, 18, 84, 7592 }, // ¢
+    { 13, 18, 14, 1, 18, 81, 7676 }, // £
+    { 12, 13, 14, 1, 15, 68, 7757 }, // ¤
+    { 15, 18, 14, 0, 18, 97, 7825 }, // ¥
+    { 4, 25, 14, 5, 19, 19, 7922 }, // ¦
+    { 10, 19, 12, 1, 19, 106, 7941 }, // §
+    { 9, 4, 15, 3, 20, 29, 8047 }, // ¨
+    { 19, 18, 21, 1, 18, 142, 8076 }, // ©
+    { 9, 9, 10, 0, 18, 56, 8218 }, // ª
+    { 14, 12, 15, 1, 13, 66, 8274 }, // «
+    { 13, 7, 14, 1, 10, 28, 8340 }, // ¬
+    { 8, 4, 8, 0, 8, 19, 8368 }, // ­
+    { 19, 18, 21, 1, 18, 148, 8387 }, // ®
+    { 14, 3, 13, -1, 22, 19, 8535 }, // ¯
+    { 9, 8, 11, 1, 18, 44, 8554 }, // °
+    { 13, 16, 14, 1, 16, 47, 8598 }, // ±
+    { 9, 11, 9, 0, 18, 62, 8645 }, // ²
+    { 9, 11, 9, 0, 18, 66, 8707 }, // ³
+    { 8, 4, 15, 4, 19, 25, 8773 }, // ´
+    { 14, 20, 17, 1, 14, 52, 8798 }, // µ
+    { 14, 22, 16, 1, 19, 58, 8850 }, // ¶
+    { 5, 5, 7, 1, 11, 24, 8908 }, // ·
+    { 7, 6, 5, -1, 0, 33, 8932 }, // ¸
+    { 7, 11, 9, 1, 18, 31, 8965 }, // ¹
+    { 9, 9, 10, 0, 18, 52, 8996 }, // º
+    { 14, 12, 15, 1, 13, 64, 9048 }, // »
+    { 21, 18, 22, 0, 18, 138, 9112 }, // ¼
+    { 21, 18, 22, 0, 18, 145, 9250 }, // ½
+    { 20, 18, 22, 1, 18, 157, 9395 }, // ¾
+    { 12, 19, 12, 0, 14, 95, 9552 }, // ¿
+    { 18, 23, 17, 0, 23, 149, 9647 }, // À
+    { 18, 23, 17, 0, 23, 146, 9796 }, // Á
+    { 18, 23, 17, 0, 23, 152, 9942 }, // Â
+    { 18, 23, 17, 0, 23, 154, 10094 }, // Ã
+    { 18, 24, 17, 0, 24, 153, 10248 }, // Ä
+    { 18, 23, 17, 0, 23, 153, 10401 }, // Å
+    { 23, 18, 24, 0, 18, 115, 10554 }, // Æ
+    { 15, 24, 16, 1, 18, 139, 10669 }, // Ç
+    { 11, 23, 14, 2, 23, 57, 10808 }, // È
+    { 11, 23, 14, 2, 23, 60, 10865 }, // É
+    { 11, 23, 14, 2, 23, 63, 10925 }, // Ê
+    { 11, 24, 14, 2, 24, 62, 10988 }, // Ë
+    { 8, 23, 8, -1, 23, 32, 11050 }, // Ì
+    { 8, 23, 8, 2, 23, 29, 11082 }, // Í
+    { 12, 23, 8, -2, 23, 40, 11111 }, // Î
+    { 10, 24, 8, -1, 24, 37, 11151 }, // Ï
+    { 18, 18, 19, 0, 18, 107, 11188 }, // Ð
+    { 17, 23, 20, 2, 23, 129, 11295 }, // Ñ
+    { 18, 23, 20, 1, 23, 120, 11424 }, // Ò
+    { 18, 23, 20, 1, 23, 118, 11544 }, // Ó
+    { 18, 23, 20, 1, 23, 131, 11662 }, // Ô
+    { 18, 23, 20, 1, 23, 131, 11793 }, // Õ
+    { 18, 24, 20, 1, 24, 128, 11924 }, // Ö
+    { 12, 13, 14, 1, 15, 64, 12052 }, // ×
+    { 18, 20, 20, 1, 19, 161, 12116 }, // Ø
+    { 15, 23, 19, 2, 23, 86, 12277 }, // Ù
+    { 15, 23, 19, 2, 23, 86, 12363 }, // Ú
+    { 15, 23, 19, 2, 23, 93, 12449 }, // Û
+    { 15, 24, 19, 2, 24, 94, 12542 }, // Ü
+    { 16, 23, 16, 0, 23, 116, 12636 }, // Ý
+    { 13, 18, 16, 2, 18, 64, 12752 }, // Þ
+    { 16, 19, 18, 1, 19, 127, 12816 }, // ß
+    { 13, 20, 15, 1, 20, 118, 12943 }, // à
+    { 13, 20, 15, 1, 20, 119, 13061 }, // á
+    { 13, 20, 15, 1, 20, 123, 13180 }, // â
+    { 13, 20, 15, 1, 20, 126, 13303 }, // ã
+    { 13, 20, 15, 1, 20, 127, 13429 }, // ä
+    { 13, 22, 15, 1, 22, 122, 13556 }, // å
+    { 21, 14, 23, 1, 14, 140, 13678 }, // æ
+    { 12, 20, 13, 1, 14, 103, 13818 }, // ç
+    { 13, 20, 15, 1, 20, 115, 13921 }, // è
+    { 13, 20, 15, 1, 20, 117, 14036 }, // é
+    { 13, 20, 15, 1, 20, 116, 14153 }, // ê
+    { 13, 20, 15, 1, 20, 120, 14269 }, // ë
+    { 8, 20, 8, -2, 20, 31, 14389 }, // ì
+    { 8, 20, 8, 1, 20, 31, 14420 }, // í
+    { 12, 20, 8, -2, 20, 40, 14451 }, // î
+    { 10, 20, 8, -1, 20, 36, 14491 }, // ï
+    { 14, 19, 15, 1, 19, 127, 14527 }, // ð
+    { 14, 20, 16, 1, 20, 87, 14654 }, // ñ
+    { 14, 20, 15, 1, 20, 117, 14741 }, // ò
+    { 14, 20, 15, 1, 20, 117, 14858 }, // ó
+    { 14, 20, 15, 1, 20, 124, 14975 }, // ô
+    { 14, 20, 15, 1, 20, 127, 15099 }, // õ
+    { 14, 20, 15, 1, 20, 127, 15226 }, // ö
+    { 13, 13, 14, 1, 15, 42, 15353 }, // ÷
+    { 14, 16, 15, 1, 15, 112, 15395 }, // ø
+    { 14, 20, 16, 1, 20, 80, 15507 }, // ù
+    { 14, 20, 16, 1, 20, 80, 15587 }, // ú
+    { 14, 20, 16, 1, 20, 88, 15667 }, // û
+    { 14, 20, 16, 1, 20, 86, 15755 }, // ü
+    { 15, 26, 14, 0, 20, 148, 15841 }, // ý
+    { 14, 25, 16, 1, 19, 90, 15989 }, // þ
+    { 15, 26, 14, 0, 20, 152, 16079 }, // ÿ
+};
+constexpr UnicodeInterval OpenSans12BIntervals[] = {
+    { 0x20, 0x7E, 0x0 },
+    { 0xA0, 0xFF, 0x5F },
+};
+const GFXfont OpenSans12B = {
+    (uint8_t*)OpenSans12BBitmaps,
+    (GFXglyph*)OpenSans12BGlyphs,
+    (UnicodeInterval*)OpenSans12BIntervals,
+    2,
+    1,
+    34,
+    27,
+    -8,
+};
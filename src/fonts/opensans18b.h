@@ -0,0 +1,270 @@
+// Generated by tools/fontsubset.py from ../Font Files/opensans18b.h, do not edit
+#pragma once
+#include "epd_driver.h"
+const uint8_t OpenSans18BBitmaps[3660] = {
+    0x00, 0x40, 0xEB, 0xEF, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x1E, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x90, 0xFF, 0xDF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x8F, 0x60, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xF2, 0xFF, 0x5F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xFE, 0xFF, 0x0C, 0x00, 0x00, 0xFB, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x0F, 0x00, 0xFB, 0xFF, 0x0E, 0x00, 0x30, 0xFF,
+    0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0D, 0x00, 0xFA, 0xFF, 0x0F, 0x00, 0xC0,
+    0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x0D, 0x00, 0xF9, 0xFF, 0x0F, 0x00,
+    0xF5, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0D, 0x00, 0xFA, 0xFF, 0x0F,
+    0x00, 0xFE, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x0F, 0x00, 0xFB, 0xFF,
+    0x0E, 0x70, 0xFF, 0xEF, 0x00, 0xB4, 0xFE, 0xBE, 0x05, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xFE,
+    0xFF, 0x0C, 0xF1, 0xFF, 0x6F, 0x90, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xF4, 0xFF, 0x8F, 0x50,
+    0xFF, 0xFF, 0x08, 0xF9, 0xFF, 0x0D, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xE0, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xFF, 0x22, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x9F, 0xB0, 0xFF, 0xBF, 0x50, 0xFF, 0xFF, 0x09, 0xF6, 0xFF, 0x8F, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0xFF, 0x0B, 0xF4, 0xFF, 0x3F, 0x80, 0xFF, 0xFF, 0x02, 0xE0, 0xFF, 0xCF, 0x00,
+    0x00, 0x30, 0xEA, 0xEF, 0x5B, 0x00, 0xFC, 0xFF, 0x0A, 0xB0, 0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xDF, 0x00, 0xA0, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x8F, 0x00, 0xD0, 0xFF, 0xDF, 0x00, 0x90,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x0E, 0x00, 0xC0, 0xFF, 0xDF, 0x00,
+    0xA0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x06, 0x00, 0xB0, 0xFF, 0xFF,
+    0x00, 0xB0, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDF, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0x01, 0xE0, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x4F, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0x08, 0xF5, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x0B, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xFE, 0xBE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x48, 0x00,
+    0x70, 0xFF, 0x2F, 0x00, 0x51, 0xD9, 0x00, 0xF5, 0xFF, 0xBF, 0x76, 0xFF, 0x4F, 0xC7, 0xFF, 0xFF,
+    0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xB8, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xBD, 0x05, 0x00,
+    0x00, 0x10, 0xFD, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x9F, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x10, 0xFE,
+    0xFF, 0x1A, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x03, 0xF8, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0xCF, 0x00, 0xF1, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x50, 0xFD, 0x5F, 0x00,
+    0x90, 0xFF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x00, 0x20, 0x5D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x01, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x42, 0x02, 0x00, 0xC1, 0xFF, 0xAF, 0x00, 0xF9,
+    0xFF, 0xFF, 0x06, 0xFC, 0xFF, 0xFF, 0x09, 0xFB, 0xFF, 0xFF, 0x09, 0xF6, 0xFF, 0xFF, 0x03, 0x70,
+    0xFD, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF,
+    0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xB7, 0xFE,
+    0xDE, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBE, 0xFB, 0xFF, 0xFF, 0x8F, 0x00, 0x60, 0xFF, 0xFF,
+    0xBF, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0x05, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0xF3, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0x0E, 0xF5, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x0F, 0xF7,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x2F, 0xF8, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x3F, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x4F, 0xF9, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x5F, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0x4F, 0xF8, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x4F, 0xF7, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0x3F, 0xF5, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0xF2,
+    0xFF, 0xFF, 0x06, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0E, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x0B, 0xA0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x07, 0x50, 0xFF, 0xFF,
+    0xBF, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0x02, 0x00, 0xFD, 0xFF, 0xFF, 0xAE, 0xFB, 0xFF, 0xFF, 0xAF,
+    0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xB6, 0xFD, 0xDF, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xBF,
+    0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xBF, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x20, 0xFC, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xBF, 0xE4, 0xFF, 0xFF, 0x9F, 0xFE, 0xFF, 0xBF, 0xF4, 0xFF, 0xFF, 0x08, 0xFF, 0xFF,
+    0xBF, 0x80, 0xFF, 0x6F, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0xEB, 0x03, 0x00, 0xFF, 0xFF, 0xBF, 0x00,
+    0x10, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x40, 0xC8, 0xFE, 0xDF, 0x7B, 0x01, 0x00, 0x00,
+    0x00, 0x50, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0B, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xE1, 0xFF,
+    0xFF, 0xFF, 0xDE, 0xFE, 0xFF, 0xFF, 0xFF, 0x02, 0x30, 0xFF, 0xFF, 0x3A, 0x00, 0x30, 0xFD, 0xFF,
+    0xFF, 0x07, 0x00, 0xF5, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x0A, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xFC, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x6D, 0xF7, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+    0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x84, 0xDC, 0xFF, 0xDE, 0x7B, 0x01, 0x00, 0x00, 0x00, 0xE8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x1D, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x40, 0xFF, 0xFF, 0xCF,
+    0xBA, 0xFD, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0xF9, 0x6D, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0x05,
+    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xD7, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0xFF, 0x9E, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xDF, 0x4A, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x62, 0x66, 0x97, 0xFC,
+    0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x2F, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x1F, 0xD8, 0x27, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0x0C,
+    0xF8, 0xFF, 0xBE, 0x99, 0xA9, 0xFE, 0xFF, 0xFF, 0xFF, 0x06, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xE5, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x73, 0xDA, 0xFE, 0xFF, 0xBE, 0x48, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFE, 0xFF, 0xDF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xDF, 0xF9, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x4F,
+    0xFA, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x0A, 0xFB, 0xFF, 0xDF, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xFF, 0xEF, 0x01, 0xFB, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x5F,
+    0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0x0B, 0x00, 0xFC, 0xFF, 0xDF, 0x00,
+    0x00, 0x00, 0xA0, 0xFF, 0xEF, 0x01, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x5F,
+    0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0x0B, 0x00, 0x00, 0xFC, 0xFF, 0xDF,
+    0x00, 0x00, 0xA0, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x72, 0x77, 0x77, 0x77, 0x77, 0x77, 0xFD,
+    0xFF, 0xEF, 0x77, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x2F, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0xDD, 0xDD, 0xDD, 0xDD, 0x1D, 0x00, 0x00, 0xFF, 0xFF,
+    0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xBF, 0xFE, 0xEF, 0x9C, 0x03, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBF, 0x01, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x90, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x10, 0xF9, 0xDF, 0xAC, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x0A, 0xF2, 0x49, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x05, 0xF2, 0xFF, 0xEF, 0xAB, 0xCA, 0xFF, 0xFF, 0xFF, 0xDF,
+    0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00,
+    0x73, 0xDB, 0xFE, 0xEF, 0xAD, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xDA, 0xFE,
+    0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xCF, 0x89, 0x88, 0x7A, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xDF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xEF,
+    0x00, 0xA4, 0xFD, 0xDF, 0x39, 0x00, 0x00, 0xF6, 0xFF, 0xCF, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x09,
+    0x00, 0xF7, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xF9, 0xFF, 0xFF, 0xFF, 0x7B, 0x86, 0xFE, 0xFF, 0xFF, 0x0D, 0xFA,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x2F, 0xF9, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x5F, 0xF8, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x7F, 0xF6, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x7F, 0xF3, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x30, 0xFF, 0xFF,
+    0x5F, 0xE0, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x3F, 0x80, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0x0E, 0x10, 0xFF, 0xFF, 0xFF, 0xAE, 0xC9, 0xFF, 0xFF, 0xFF, 0x08, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x2E, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xA5, 0xFD, 0xEF, 0x8C, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xDD,
+    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xED, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x5F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xDF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xC9, 0xFE, 0xEF, 0x8B, 0x02, 0x00, 0x00, 0x00,
+    0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x01, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1D, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x70, 0xFF, 0xFF,
+    0xDF, 0x36, 0x84, 0xFF, 0xFF, 0xFF, 0x03, 0xB0, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0x06, 0xC0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x08, 0xB0, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x06, 0x70, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x02, 0x10,
+    0xFF, 0xFF, 0xEF, 0x04, 0x70, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xCF, 0xFD, 0xFF,
+    0xFF, 0x1D, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0xE4,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00,
+    0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0x7E,
+    0xFC, 0xFF, 0xFF, 0x7F, 0x00, 0xB0, 0xFF, 0xFF, 0x8F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x04, 0xF2,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0x0D, 0xF7, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0x3F, 0xF9, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x5F, 0xF9, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x4F, 0xF7, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0x2F, 0xF3, 0xFF, 0xFF, 0xBF, 0x45, 0x64, 0xFC, 0xFF, 0xFF, 0x0C, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0x00, 0x61, 0xDA, 0xFE, 0xEF, 0x8C,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x50, 0xD9, 0xFE, 0xCE, 0x39, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFD,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03,
+    0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xAB,
+    0xFB, 0xFF, 0xFF, 0xBF, 0x00, 0xF3, 0xFF, 0xFF, 0x2E, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0x03, 0xF8,
+    0xFF, 0xFF, 0x04, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x09, 0xFA, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0x0E, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x1F, 0xFB, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x4F, 0xFA, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0x5F, 0xF7, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x5F, 0xF2, 0xFF, 0xFF, 0xCF, 0x67,
+    0xD8, 0xFF, 0xFF, 0xFF, 0x5F, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x10,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0x3F, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x17,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xB5, 0xFE, 0xDF, 0x39, 0x30, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0x9A, 0x78, 0x98, 0xFC, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x9F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xFF, 0xDF, 0xAC, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC5, 0xFE, 0x7C, 0x01, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0x9A, 0xFE, 0xFF, 0x0C, 0xE0, 0xFF, 0x2E,
+    0x00, 0xC0, 0xFF, 0x3F, 0xF2, 0xFF, 0x07, 0x00, 0x30, 0xFF, 0x6F, 0xF4, 0xFF, 0x04, 0x00, 0x00,
+    0xFF, 0x8F, 0xF3, 0xFF, 0x07, 0x00, 0x30, 0xFF, 0x6F, 0xF0, 0xFF, 0x2E, 0x00, 0xC0, 0xFF, 0x3F,
+    0x90, 0xFF, 0xFF, 0x9A, 0xFE, 0xFF, 0x0C, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0xD2,
+    0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0x8D, 0x01, 0x00,
+};
+const GFXglyph OpenSans18BGlyphs[] = {
+    { 0, 0, 10, 0, 0, 0, 0 }, //  
+    { 33, 27, 34, 1, 27, 459, 0 }, // %
+    { 19, 19, 21, 1, 29, 190, 459 }, // *
+    { 11, 5, 12, 1, 13, 30, 649 }, // -
+    { 7, 7, 11, 2, 7, 28, 679 }, // .
+    { 16, 27, 16, 0, 27, 216, 707 }, // /
+    { 20, 27, 22, 1, 27, 270, 923 }, // 0
+    { 14, 27, 22, 2, 27, 189, 1193 }, // 1
+    { 20, 27, 22, 1, 27, 270, 1382 }, // 2
+    { 20, 27, 22, 1, 27, 270, 1652 }, // 3
+    { 22, 27, 22, 0, 27, 297, 1922 }, // 4
+    { 19, 27, 22, 1, 27, 270, 2219 }, // 5
+    { 20, 27, 22, 1, 27, 270, 2489 }, // 6
+    { 20, 27, 22, 1, 27, 270, 2759 }, // 7
+    { 20, 27, 22, 1, 27, 270, 3029 }, // 8
+    { 20, 27, 22, 1, 27, 270, 3299 }, // 9
+    { 14, 13, 16, 1, 28, 91, 3569 }, // °
+};
+constexpr UnicodeInterval OpenSans18BIntervals[] = {
+    { 0x20, 0x20, 0x0 },
+    { 0x25, 0x25, 0x1 },
+    { 0x2A, 0x2A, 0x2 },
+    { 0x2D, 0x39, 0x3 },
+    { 0xB0, 0xB0, 0x10 },
+};
+const GFXfont OpenSans18B = {
+    (uint8_t*)OpenSans18BBitmaps,
+    (GFXglyph*)OpenSans18BGlyphs,
+    (UnicodeInterval*)OpenSans18BIntervals,
+    5,
+    0,
+    51,
+    41,
+    -11,
+};
@@ -1,38 +1,72 @@
-#ifndef FORECAST_RECORD_H_
-#define FORECAST_RECORD_H_
-
-#include <Arduino.h>
-
-enum class PressureTrend {
-  same,
-  rising,
-  falling,
-  zero
-};
-
-typedef struct { // For current Day and Day 1, 2, 3, etc
-  int    Dt;
-  String Icon;
-  PressureTrend Trend;
-  String Forecast0;
-  String Description;
-  float  Temperature;
-  float  FeelsLike;
-  float  DewPoint;
-  float  Humidity;
-  float  High;
-  float  Low;
-  float  Winddir;
-  float  Windspeed;
-  float  Rainfall;
-  float  Snowfall;
-  float  Pressure;
-  int    Cloudcover;
-  int    Visibility;
-  int    Sunrise;
-  int    Sunset;
-  int    FTimezone;
-  float  UVI;
-} Forecast_record_type;
-
-#endif /* ifndef FORECAST_RECORD_H_ */
+#ifndef FORECAST_RECORD_H_
+#define FORECAST_RECORD_H_
+
+#include <Arduino.h>
+
+enum class PressureTrend {
+  same,
+  rising,
+  falling,
+  zero
+};
+
+typedef struct { // For current Day and Day 1, 2, 3, etc
+  int    Dt;
+  String Icon;
+  PressureTrend Trend;
+  String Forecast0;
+  String Description;
+  float  Temperature;
+  float  FeelsLike;
+  float  DewPoint;
+  float  Humidity;
+  float  High;
+  float  Low;
+  float  Winddir;
+  float  Windspeed;
+  float  Rainfall;
+  float  Snowfall;
+  float  Pressure;
+  int    Cloudcover;
+  int    Visibility;
+  int    Sunrise;
+  int    Sunset;
+  int    FTimezone;
+  float  UVI;
+} Forecast_record_type;
+
+// Compact copies of the records above without heap Strings, so they can be kept in RTC memory
+// across deep sleep and redrawn on render wakes without fetching new data
+typedef struct {
+  char   Icon[4];
+  char   Forecast0[96];
+  PressureTrend Trend;
+  float  Temperature;
+  float  FeelsLike;
+  float  Humidity;
+  float  High;
+  float  Low;
+  float  Winddir;
+  float  Windspeed;
+  float  Pressure;
+  int    Cloudcover;
+  int    Visibility;
+  int    Sunrise;
+  int    Sunset;
+  int    FTimezone;
+  float  UVI;
+} Cached_conditions_type;
+
+typedef struct {
+  int    Dt;
+  char   Icon[4];
+  float  Temperature;
+  float  High;
+  float  Low;
+  float  Pressure;
+  float  Humidity;
+  float  Rainfall;
+  float  Snowfall;
+} Cached_forecast_type;
+
+#endif /* ifndef FORECAST_RECORD_H_ */
@@ -0,0 +1,143 @@
+#include "glyphpack.h"
+
+#include <esp_heap_caps.h>
+#include <esp_partition.h>
+#include <esp_timer.h>
+
+// Pack layout, little endian: header, GlyphCount index entries sorted by codepoint, then the bitmaps.
+// tools/glyphpack.py writes the same structures.
+typedef struct {
+    char Magic[4]; // "GPK1"
+    uint32_t GlyphCount;
+    uint32_t BitmapOffset;
+    uint16_t AdvanceY;
+    int16_t Ascender;
+    int16_t Descender;
+    uint8_t Compressed;
+    uint8_t Reserved;
+} Glyph_pack_header_type;
+
+typedef struct {
+    uint32_t Codepoint;
+    uint8_t Width;
+    uint8_t Height;
+    uint8_t AdvanceX;
+    uint8_t Reserved;
+    int16_t Left;
+    int16_t Top;
+    uint16_t Size; // bytes of bitmap data, compressed or not
+    uint16_t Reserved2;
+    uint32_t DataOffset; // from BitmapOffset
+} Glyph_pack_entry_type;
+
+static_assert(sizeof(Glyph_pack_header_type) == 20, "pack header must match tools/glyphpack.py");
+static_assert(sizeof(Glyph_pack_entry_type) == 20, "pack index entry must match tools/glyphpack.py");
+
+const esp_partition_t *packPartition = nullptr;
+spi_flash_mmap_handle_t packHandle;
+const Glyph_pack_header_type *packHeader = nullptr;
+const Glyph_pack_entry_type *packIndex = nullptr;
+
+// the glyphs loaded for this frame, their bitmaps packed into the arena
+uint8_t *packArena = nullptr;
+GFXglyph packGlyphs[GlyphPackMaxGlyphs];
+uint32_t packCodepoints[GlyphPackMaxGlyphs];
+int packUsed = 0;
+GFXfont packFont;
+Glyph_pack_stats_type packStats;
+
+bool GlyphPackOpen() {
+    if(packHeader)
+        return true;
+    packPartition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "glyphs");
+    if(!packPartition) {
+        log_i("No glyphs partition, only the compiled fonts are available");
+        return false;
+    }
+    Glyph_pack_header_type header;
+    if(esp_partition_read(packPartition, 0, &header, sizeof(header)) != ESP_OK
+       || memcmp(header.Magic, "GPK1", 4) != 0) {
+        log_i("No glyph pack in the glyphs partition");
+        return false;
+    }
+    size_t indexSize = sizeof(header) + header.GlyphCount * sizeof(Glyph_pack_entry_type);
+    if(header.BitmapOffset < indexSize || header.BitmapOffset > packPartition->size) {
+        log_e("Glyph pack index of %u glyphs does not fit the partition", header.GlyphCount);
+        return false;
+    }
+    const void *mapped;
+    esp_err_t err
+        = esp_partition_mmap(packPartition, 0, indexSize, SPI_FLASH_MMAP_DATA, &mapped, &packHandle);
+    if(err != ESP_OK) {
+        log_e("Mapping the glyph pack index failed: %s", esp_err_to_name(err));
+        return false;
+    }
+    packArena = (uint8_t *)heap_caps_malloc(GlyphPackBudget, MALLOC_CAP_8BIT);
+    if(!packArena) {
+        log_e("No memory for the glyph pack budget of %u bytes", GlyphPackBudget);
+        spi_flash_munmap(packHandle);
+        return false;
+    }
+    packHeader = (const Glyph_pack_header_type *)mapped;
+    packIndex = (const Glyph_pack_entry_type *)(packHeader + 1);
+    packFont = {packArena, packGlyphs, nullptr, 0, header.Compressed != 0, (uint8_t)header.AdvanceY,
+                header.Ascender, header.Descender};
+    log_i("Glyph pack with %u glyphs, %u KB index mapped", header.GlyphCount, indexSize / 1024);
+    return true;
+}
+
+static const Glyph_pack_entry_type *FindEntry(uint32_t cp) {
+    uint32_t lo = 0, hi = packHeader->GlyphCount;
+    while(lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        if(packIndex[mid].Codepoint < cp)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo < packHeader->GlyphCount && packIndex[lo].Codepoint == cp ? &packIndex[lo] : nullptr;
+}
+
+const GFXglyph *GlyphPackLookup(uint32_t cp, const GFXfont **source) {
+    if(!packHeader)
+        return nullptr;
+    *source = &packFont;
+    for(int i = 0; i < packUsed; i++)
+        if(packCodepoints[i] == cp)
+            return &packGlyphs[i];
+    const Glyph_pack_entry_type *entry = FindEntry(cp);
+    if(!entry)
+        return nullptr;
+    if(packUsed == GlyphPackMaxGlyphs || packStats.Bytes + entry->Size > GlyphPackBudget) {
+        packStats.OverBudget++;
+        return nullptr;
+    }
+    int64_t start = esp_timer_get_time();
+    if(esp_partition_read(packPartition, packHeader->BitmapOffset + entry->DataOffset,
+                          packArena + packStats.Bytes, entry->Size)
+       != ESP_OK) {
+        log_e("Reading glyph U+%04X from the pack failed", cp);
+        return nullptr;
+    }
+    packStats.LoadUs += esp_timer_get_time() - start;
+    packCodepoints[packUsed] = cp;
+    packGlyphs[packUsed]
+        = {entry->Width, entry->Height, entry->AdvanceX, entry->Left, entry->Top, entry->Size, packStats.Bytes};
+    packStats.Bytes += entry->Size;
+    packStats.Loaded++;
+    return &packGlyphs[packUsed++];
+}
+
+void GlyphPackFrameBegin() {
+    packUsed = 0;
+    packStats = {};
+}
+
+void GlyphPackFrameEnd() {
+    if(!packHeader || !(packStats.Loaded || packStats.OverBudget))
+        return;
+    log_d("Glyph pack: %u glyphs, %u of %u bytes, %u over budget, %u us loading", packStats.Loaded,
+          packStats.Bytes, GlyphPackBudget, packStats.OverBudget, packStats.LoadUs);
+}
+
+const Glyph_pack_stats_type &GlyphPackStats() { return packStats; }
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "epd_driver.h"
+#include <Arduino.h>
+
+// Glyphs for the scripts the compiled fonts do not cover (Greek, CJK, Arabic, ...), kept in the "glyphs"
+// data partition as a pack built by tools/glyphpack.py. The sorted codepoint index is memory mapped and
+// binary searched; only the bitmaps of the glyphs a frame actually draws are read into RAM, up to
+// GlyphPackBudget bytes. Glyphs beyond the budget are skipped and counted.
+//
+// Use GlyphPackLookup as the fallback of the font the pack was built to match, and bracket every frame with
+// GlyphPackFrameBegin() and GlyphPackFrameEnd(): the glyphs stay loaded for all bands of a frame.
+constexpr size_t GlyphPackBudget = 16 * 1024;
+constexpr int GlyphPackMaxGlyphs = 128;
+
+typedef struct { // what the last frame needed from the pack
+    uint16_t Loaded;
+    uint16_t OverBudget;
+    uint32_t Bytes;
+    uint32_t LoadUs;
+} Glyph_pack_stats_type;
+
+bool GlyphPackOpen();
+const GFXglyph *GlyphPackLookup(uint32_t cp, const GFXfont **source);
+void GlyphPackFrameBegin();
+void GlyphPackFrameEnd();
+const Glyph_pack_stats_type &GlyphPackStats();
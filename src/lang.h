@@ -1,71 +1,71 @@
-#define FONT(x) x##_tf
-
-//Temperature - Humidity - Forecast
-const char *TXT_FORECAST_VALUES  = "3-Day Forecast Values";
-const char *TXT_CONDITIONS       = "Conditions";
-const char *TXT_DAYS             = "(Days)";
-const char *TXT_TEMPERATURES     = "Temperature";
-const char *TXT_TEMPERATURE_C    = "Temperature (°C)";
-const char *TXT_TEMPERATURE_F    = "Temperature (°F)";
-const char *TXT_HUMIDITY_PERCENT = "Humidity (%)";
-
-// Pressure
-const char *TXT_PRESSURE         = "Pressure";
-const char *TXT_PRESSURE_HPA     = "Pressure (hPa)";
-const char *TXT_PRESSURE_IN      = "Pressure (in)";
-const char *TXT_PRESSURE_STEADY  = "Steady";
-const char *TXT_PRESSURE_RISING  = "Rising";
-const char *TXT_PRESSURE_FALLING = "Falling";
-
-//RainFall / SnowFall
-const char *TXT_RAINFALL_MM = "Rainfall (mm)";
-const char *TXT_RAINFALL_IN = "Rainfall (in)";
-const char *TXT_SNOWFALL_MM = "Snowfall (mm)";
-const char *TXT_SNOWFALL_IN = "Snowfall (in)";
-const char *TXT_PRECIPITATION_SOON = "Prec.";
-
-
-//Sun
-const char *TXT_SUNRISE  = "Sunrise";
-const char *TXT_SUNSET   = "Sunset";
-
-//Moon
-const char *TXT_MOON_NEW             = "New";
-const char *TXT_MOON_WAXING_CRESCENT = "Waxing Crescent";
-const char *TXT_MOON_FIRST_QUARTER   = "First Quarter";
-const char *TXT_MOON_WAXING_GIBBOUS  = "Waxing Gibbous";
-const char *TXT_MOON_FULL            = "Full";
-const char *TXT_MOON_WANING_GIBBOUS  = "Waning Gibbous";
-const char *TXT_MOON_THIRD_QUARTER   = "Third Quarter";
-const char *TXT_MOON_WANING_CRESCENT = "Waning Crescent";
-
-//Power / WiFi
-const char *TXT_POWER  = "Power";
-const char *TXT_WIFI   = "WiFi";
-const char* TXT_UPDATED = "Updated:";
-
-
-//Wind
-const char *TXT_WIND_SPEED_DIRECTION = "Wind Speed/Direction";
-const char *TXT_N   = "N";
-const char *TXT_NNE = "NNE";
-const char *TXT_NE  = "NE";
-const char *TXT_ENE = "ENE";
-const char *TXT_E   = "E";
-const char *TXT_ESE = "ESE";
-const char *TXT_SE  = "SE";
-const char *TXT_SSE = "SSE";
-const char *TXT_S   = "S";
-const char *TXT_SSW = "SSW";
-const char *TXT_SW  = "SW";
-const char *TXT_WSW = "WSW";
-const char *TXT_W   = "W";
-const char *TXT_WNW = "WNW";
-const char *TXT_NW  = "NW";
-const char *TXT_NNW = "NNW";
-
-//Day of the week
-const char *weekday_D[] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
-
-//Month
-const char *month_M[] = { "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+#define FONT(x) x##_tf
+
+//Temperature - Humidity - Forecast
+const char *TXT_FORECAST_VALUES  = "3-Day Forecast Values";
+const char *TXT_CONDITIONS       = "Conditions";
+const char *TXT_DAYS             = "(Days)";
+const char *TXT_TEMPERATURES     = "Temperature";
+const char *TXT_TEMPERATURE_C    = "Temperature (°C)";
+const char *TXT_TEMPERATURE_F    = "Temperature (°F)";
+const char *TXT_HUMIDITY_PERCENT = "Humidity (%)";
+
+// Pressure
+const char *TXT_PRESSURE         = "Pressure";
+const char *TXT_PRESSURE_HPA     = "Pressure (hPa)";
+const char *TXT_PRESSURE_IN      = "Pressure (in)";
+const char *TXT_PRESSURE_STEADY  = "Steady";
+const char *TXT_PRESSURE_RISING  = "Rising";
+const char *TXT_PRESSURE_FALLING = "Falling";
+
+//RainFall / SnowFall
+const char *TXT_RAINFALL_MM = "Rainfall (mm)";
+const char *TXT_RAINFALL_IN = "Rainfall (in)";
+const char *TXT_SNOWFALL_MM = "Snowfall (mm)";
+const char *TXT_SNOWFALL_IN = "Snowfall (in)";
+const char *TXT_PRECIPITATION_SOON = "Prec.";
+
+
+//Sun
+const char *TXT_SUNRISE  = "Sunrise";
+const char *TXT_SUNSET   = "Sunset";
+
+//Moon
+const char *TXT_MOON_NEW             = "New";
+const char *TXT_MOON_WAXING_CRESCENT = "Waxing Crescent";
+const char *TXT_MOON_FIRST_QUARTER   = "First Quarter";
+const char *TXT_MOON_WAXING_GIBBOUS  = "Waxing Gibbous";
+const char *TXT_MOON_FULL            = "Full";
+const char *TXT_MOON_WANING_GIBBOUS  = "Waning Gibbous";
+const char *TXT_MOON_THIRD_QUARTER   = "Third Quarter";
+const char *TXT_MOON_WANING_CRESCENT = "Waning Crescent";
+
+//Power / WiFi
+const char *TXT_POWER  = "Power";
+const char *TXT_WIFI   = "WiFi";
+const char* TXT_UPDATED = "Updated:";
+
+
+//Wind
+const char *TXT_WIND_SPEED_DIRECTION = "Wind Speed/Direction";
+const char *TXT_N   = "N";
+const char *TXT_NNE = "NNE";
+const char *TXT_NE  = "NE";
+const char *TXT_ENE = "ENE";
+const char *TXT_E   = "E";
+const char *TXT_ESE = "ESE";
+const char *TXT_SE  = "SE";
+const char *TXT_SSE = "SSE";
+const char *TXT_S   = "S";
+const char *TXT_SSW = "SSW";
+const char *TXT_SW  = "SW";
+const char *TXT_WSW = "WSW";
+const char *TXT_W   = "W";
+const char *TXT_WNW = "WNW";
+const char *TXT_NW  = "NW";
+const char *TXT_NNW = "NNW";
+
+//Day of the week
+const char *weekday_D[] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+
+//Month
+const char *month_M[] = { "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
@@ -1,1797 +0,0 @@
-#pragma once
-#include "epd_driver.h"
-const uint8_t OpenSans18BBitmaps[25371] = {
-    0x78, 0x9C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 0x9C, 0x3D, 0xCC, 0xC9, 0x0D, 0x40, 0x00,
-    0x14, 0x00, 0xD1, 0x6F, 0x5F, 0xCA, 0x52, 0x85, 0x8B, 0x44, 0x09, 0xCA, 0xD0, 0x8D, 0x1A, 0x54,
-    0x40, 0x07, 0x74, 0x60, 0xDF, 0xC9, 0xF8, 0x71, 0x30, 0xC9, 0xBB, 0xCE, 0x05, 0xE1, 0x09, 0xC1,
-    0x01, 0xBE, 0xF2, 0x76, 0x70, 0x37, 0x70, 0x56, 0xB5, 0x80, 0x3D, 0x83, 0x35, 0x81, 0x39, 0x82,
-    0xA1, 0x64, 0x50, 0x3D, 0xDD, 0xA7, 0xA5, 0x91, 0x9A, 0x4A, 0xD2, 0x3C, 0x96, 0xBF, 0xC8, 0x94,
-    0x92, 0x42, 0xF4, 0xE5, 0xDE, 0xFA, 0xBD, 0x94, 0xBE, 0xAC, 0xEC, 0x49, 0xE4, 0x05, 0xBD, 0x11,
-    0x43, 0x6E, 0x78, 0x9C, 0x15, 0xC5, 0x41, 0x15, 0x80, 0x20, 0x00, 0x44, 0xC1, 0xBD, 0xFB, 0x84,
-    0x08, 0x44, 0x30, 0x02, 0x11, 0x88, 0x40, 0x04, 0x23, 0x18, 0xC1, 0x08, 0x56, 0x31, 0x8A, 0x11,
-    0x50, 0x40, 0xD4, 0xCB, 0x57, 0xE7, 0x32, 0x8D, 0x45, 0x0F, 0xE3, 0xC9, 0xAC, 0x9B, 0x58, 0x99,
-    0x74, 0x11, 0x0A, 0x51, 0x0D, 0x9F, 0x09, 0xAA, 0xB8, 0x1D, 0xAF, 0x82, 0x4D, 0x0C, 0xCA, 0x7F,
-    0x4E, 0x07, 0x66, 0xC3, 0x2A, 0xD1, 0xAF, 0x98, 0xAF, 0xEE, 0x05, 0x65, 0xA7, 0x2B, 0x7B, 0x78,
-    0x9C, 0x75, 0x8F, 0x5D, 0x0A, 0x82, 0x50, 0x14, 0x84, 0xA7, 0x1F, 0xFB, 0xA1, 0x28, 0x77, 0x52,
-    0x4B, 0x70, 0x27, 0xB5, 0x04, 0x77, 0xD2, 0x12, 0x6A, 0x05, 0xB5, 0x04, 0x97, 0x10, 0xF4, 0x2E,
-    0xFA, 0x1E, 0x24, 0x45, 0x94, 0x29, 0x3A, 0xDD, 0x3B, 0x76, 0xED, 0xC9, 0x81, 0x03, 0x1F, 0x87,
-    0xC3, 0x99, 0x19, 0x00, 0x78, 0x70, 0x81, 0x17, 0xA7, 0xB0, 0x7A, 0x72, 0x8E, 0x9C, 0x23, 0xF1,
-    0xDB, 0xEC, 0x4A, 0x0E, 0xC5, 0x85, 0xD9, 0xD5, 0xEC, 0x89, 0x2B, 0x0E, 0x7C, 0x66, 0x42, 0x90,
-    0x08, 0x18, 0x09, 0xD7, 0x4C, 0x10, 0x72, 0x27, 0xDE, 0xF2, 0x84, 0x03, 0x37, 0x3A, 0x76, 0x8A,
-    0x3A, 0xF9, 0x7A, 0xAB, 0x99, 0x69, 0x8E, 0x8A, 0x30, 0xC3, 0xE7, 0x17, 0x21, 0xE7, 0xC4, 0xDA,
-    0x89, 0x4B, 0x7A, 0xD6, 0x4E, 0x32, 0x51, 0x02, 0x9E, 0x95, 0xBD, 0xD5, 0xB8, 0x8B, 0x2F, 0x71,
-    0xC5, 0x44, 0x13, 0x9B, 0xAF, 0x29, 0x57, 0x6A, 0x69, 0x75, 0xE7, 0x52, 0x2D, 0x5D, 0xF3, 0xA2,
-    0x6D, 0xFE, 0xB7, 0x2D, 0xE8, 0xF9, 0xCE, 0xB6, 0x62, 0xBF, 0xB1, 0x6D, 0x9A, 0x87, 0xDC, 0x5B,
-    0xFA, 0x02, 0x1C, 0xF8, 0xA1, 0x55, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0xF8, 0xA6, 0xCF, 0x00,
-    0x05, 0x98, 0x2C, 0x87, 0x93, 0xFF, 0xFE, 0x9F, 0xCB, 0x64, 0x62, 0x60, 0x08, 0xF8, 0xFB, 0x1F,
-    0x04, 0xEE, 0xB3, 0x32, 0xFC, 0xFC, 0x0F, 0x01, 0xEC, 0x05, 0x50, 0xC6, 0x7F, 0xC6, 0x0F, 0x40,
-    0xE2, 0xEF, 0xFE, 0xBF, 0xFF, 0xF7, 0x33, 0x7C, 0xFE, 0xFF, 0x9F, 0x0B, 0xA8, 0xB7, 0xD9, 0x97,
-    0xE1, 0xEB, 0xFF, 0xFF, 0x2C, 0x10, 0x53, 0xBE, 0xFC, 0xFF, 0xCF, 0x01, 0x61, 0x7D, 0xFC, 0xFF,
-    0x7F, 0xFD, 0x0F, 0x30, 0x6B, 0x02, 0x48, 0x1F, 0x98, 0x25, 0x00, 0x32, 0xF8, 0xBD, 0x26, 0x88,
-    0xB9, 0x11, 0x6C, 0x9A, 0x35, 0x88, 0x79, 0x15, 0xCC, 0xE4, 0x04, 0x31, 0x97, 0x80, 0x58, 0xE7,
-    0x21, 0xAE, 0x82, 0x0B, 0x7E, 0xCB, 0xFF, 0xF3, 0xFF, 0x3F, 0x3F, 0xC4, 0xA5, 0x0B, 0xFE, 0xFF,
-    0xB7, 0x17, 0x04, 0xB3, 0x12, 0x80, 0xAC, 0xAF, 0xD9, 0x8C, 0x40, 0xD6, 0x86, 0xFF, 0xFF, 0xE5,
-    0xBF, 0xFE, 0xBF, 0x5F, 0xF5, 0x6B, 0xFD, 0xBF, 0xFF, 0xFF, 0x79, 0xBE, 0xC2, 0x5C, 0xCA, 0x02,
-    0x63, 0xE5, 0x33, 0x6C, 0x82, 0x30, 0xCE, 0x33, 0x33, 0x30, 0x04, 0xEE, 0x7C, 0xFB, 0xFF, 0x7D,
-    0x37, 0x33, 0xAE, 0x30, 0xC0, 0x64, 0x01, 0x00, 0x87, 0xAE, 0x94, 0xFF, 0x78, 0x9C, 0x55, 0x51,
-    0xCB, 0x51, 0x02, 0x41, 0x14, 0x6C, 0x40, 0x2D, 0x3E, 0xA2, 0x46, 0xA0, 0x55, 0x24, 0x20, 0x19,
-    0x48, 0x06, 0x72, 0xF7, 0xA0, 0x19, 0x48, 0x08, 0x66, 0xB0, 0x9B, 0x01, 0x56, 0x19, 0x80, 0x7B,
-    0xF0, 0x2C, 0x64, 0x20, 0x19, 0xB0, 0x67, 0x3D, 0xA0, 0x16, 0xCB, 0xBA, 0x02, 0xD3, 0xF4, 0x7B,
-    0x02, 0xB5, 0xBE, 0xAA, 0x99, 0x37, 0xD3, 0xF3, 0x3E, 0xFD, 0x7A, 0xD0, 0xFB, 0x98, 0xDD, 0xC0,
-    0x6C, 0xC2, 0xC8, 0x7D, 0x41, 0xB2, 0x69, 0x87, 0x9C, 0xE7, 0xE6, 0x06, 0xBA, 0xFB, 0xD3, 0x19,
-    0x79, 0x64, 0xC0, 0x27, 0x19, 0xC8, 0x2A, 0x10, 0x73, 0xEA, 0x19, 0x19, 0xA3, 0x3B, 0xB2, 0x0E,
-    0x7C, 0xF3, 0xD6, 0x81, 0x1F, 0x5E, 0x20, 0xF0, 0x18, 0x58, 0xDA, 0x06, 0xF3, 0xA7, 0x5A, 0x27,
-    0xE8, 0x92, 0x35, 0x07, 0x56, 0x6C, 0xE3, 0x57, 0xE0, 0x98, 0xCF, 0x7E, 0xC7, 0x5A, 0x40, 0x21,
-    0x20, 0x53, 0xEA, 0xBF, 0x88, 0x60, 0x85, 0x4B, 0x35, 0x06, 0x9C, 0xE1, 0x25, 0xBC, 0x1E, 0xEE,
-    0xBB, 0x7C, 0xF1, 0x3E, 0x16, 0x43, 0xD5, 0x99, 0x33, 0xEA, 0x8B, 0x47, 0xC1, 0x76, 0x6E, 0x9C,
-    0xEB, 0x48, 0x9D, 0x69, 0x87, 0x3C, 0xB0, 0x3B, 0x2F, 0xD1, 0x37, 0x37, 0x4C, 0x38, 0xD2, 0xA1,
-    0xB1, 0xB0, 0xA9, 0x2C, 0xB2, 0x35, 0xE7, 0xD5, 0x83, 0x26, 0x4A, 0xF9, 0x06, 0x74, 0xDF, 0xA5,
-    0xC7, 0x8A, 0xCD, 0x84, 0x44, 0xA2, 0x5E, 0x6E, 0x1A, 0xAF, 0x32, 0xD6, 0xB4, 0x8F, 0x02, 0xDD,
-    0x52, 0xE5, 0x4E, 0x04, 0xC4, 0x3B, 0x20, 0xD7, 0x74, 0xE5, 0x08, 0x17, 0xAB, 0x5C, 0xC3, 0xC5,
-    0x52, 0x97, 0x8A, 0x77, 0x81, 0x89, 0x75, 0x0D, 0xF4, 0x44, 0x33, 0xDB, 0x0A, 0xBF, 0x64, 0x4B,
-    0x7B, 0xE0, 0xD4, 0x98, 0xC2, 0xDF, 0xAA, 0xAE, 0xAE, 0xAC, 0xF1, 0xF7, 0x43, 0xC3, 0xDD, 0x87,
-    0x8C, 0x3C, 0x63, 0xB1, 0x15, 0xEB, 0xC9, 0xF5, 0xD8, 0x00, 0x4D, 0x8E, 0xD4, 0x70, 0x78, 0x9C,
-    0x3D, 0x90, 0xCD, 0x6D, 0xC2, 0x40, 0x14, 0x84, 0x07, 0x5B, 0xE1, 0x27, 0x52, 0x24, 0x0A, 0x00,
-    0xC1, 0x2D, 0x57, 0x77, 0x00, 0x1D, 0x24, 0x0D, 0x44, 0x50, 0x02, 0x35, 0x70, 0xE0, 0x0A, 0x1D,
-    0x50, 0x01, 0xE2, 0x9A, 0x1B, 0x88, 0x06, 0xA0, 0x00, 0x24, 0x23, 0xCE, 0x91, 0x0C, 0x49, 0x00,
-    0x41, 0x14, 0x0F, 0xF3, 0x76, 0xD7, 0xBC, 0xC3, 0x7A, 0xBF, 0xDD, 0xF7, 0x66, 0x66, 0x0D, 0x60,
-    0xF8, 0xC5, 0xD9, 0x13, 0x42, 0x4D, 0xA8, 0x4A, 0xE3, 0x40, 0x7F, 0x46, 0xEC, 0x78, 0x18, 0x38,
-    0x60, 0xEA, 0x69, 0x43, 0x4E, 0x47, 0x39, 0x19, 0x39, 0x3A, 0x92, 0x65, 0x7C, 0x93, 0x5E, 0x47,
-    0x9B, 0x12, 0x76, 0x05, 0x1D, 0xC8, 0xD8, 0x1A, 0xA2, 0x62, 0xAE, 0x26, 0xDD, 0xF4, 0xA1, 0xD9,
-    0x59, 0x91, 0xBD, 0xE0, 0x97, 0x33, 0x93, 0xC3, 0x73, 0xA0, 0x5F, 0xB3, 0x9B, 0x17, 0xC9, 0x96,
-    0x46, 0xE5, 0x00, 0xC9, 0xBF, 0xE0, 0x4D, 0x9B, 0x9B, 0x89, 0x9F, 0xEC, 0x2A, 0x53, 0x68, 0xAD,
-    0x48, 0x7C, 0xCC, 0x1E, 0xFA, 0xE4, 0xD8, 0xA6, 0xD2, 0xA1, 0xB0, 0x22, 0xDF, 0x96, 0x05, 0x6B,
-    0xE1, 0xAC, 0xF3, 0x8B, 0xB9, 0x9C, 0x2D, 0x4A, 0xD7, 0xB7, 0x47, 0xD0, 0x51, 0x15, 0xD8, 0x1B,
-    0x8C, 0x61, 0x77, 0x2F, 0x40, 0xDD, 0x6C, 0xF4, 0xFD, 0x21, 0x17, 0x31, 0x92, 0xAB, 0x6B, 0xB4,
-    0x97, 0x31, 0xDB, 0xBA, 0x31, 0x45, 0x7D, 0xE7, 0xA3, 0x16, 0x70, 0x83, 0x45, 0x35, 0x42, 0x4E,
-    0xF2, 0x43, 0xB2, 0xEB, 0x92, 0xF0, 0x33, 0xCF, 0x66, 0xAF, 0x68, 0xEB, 0xBF, 0x35, 0xEF, 0xB4,
-    0x6C, 0xCA, 0x2F, 0x78, 0x9C, 0x01, 0x1E, 0x00, 0xE1, 0xFF, 0xF7, 0xFF, 0x9F, 0xF6, 0xFF, 0x8F,
-    0xF5, 0xFF, 0x7F, 0xF4, 0xFF, 0x5F, 0xF3, 0xFF, 0x4F, 0xF1, 0xFF, 0x3F, 0xF0, 0xFF, 0x2F, 0xF0,
-    0xFF, 0x1F, 0xE0, 0xFF, 0x0F, 0xC0, 0xFF, 0x0E, 0x73, 0x45, 0x16, 0x36, 0x78, 0x9C, 0x5D, 0x8E,
-    0xCD, 0x0D, 0x01, 0x61, 0x18, 0x84, 0x1F, 0x89, 0x4F, 0xEC, 0x81, 0xE8, 0x44, 0x09, 0x74, 0xB0,
-    0x5B, 0xC2, 0x76, 0xA2, 0x04, 0x25, 0xD0, 0x81, 0x12, 0x28, 0x41, 0x09, 0x68, 0x60, 0x57, 0x58,
-    0x12, 0x0E, 0xE3, 0xDD, 0xF9, 0x92, 0x3D, 0xB8, 0xCC, 0x61, 0xFE, 0x61, 0x2D, 0x4D, 0xE0, 0xAA,
-    0x23, 0xF0, 0xD1, 0x92, 0x9E, 0x28, 0xE0, 0x24, 0x8D, 0xE0, 0xA9, 0x83, 0xE9, 0x12, 0x16, 0xD2,
-    0x1C, 0x2A, 0x8B, 0x7B, 0x29, 0xC1, 0xD9, 0x96, 0x56, 0x4D, 0x58, 0x1E, 0xCE, 0x77, 0xB6, 0xBF,
-    0xB4, 0x0D, 0x7C, 0x6B, 0xF3, 0x87, 0x99, 0xEF, 0xB4, 0x1B, 0xFC, 0x77, 0x67, 0x2F, 0xEE, 0x89,
-    0xCE, 0x31, 0xD4, 0xEE, 0x8F, 0xAD, 0x59, 0x08, 0x5F, 0xAD, 0x86, 0x40, 0x1E, 0x8B, 0xF9, 0xA9,
-    0x85, 0xF8, 0xC9, 0xCD, 0x1D, 0x71, 0x37, 0xFD, 0x00, 0x63, 0x24, 0x52, 0x9D, 0x78, 0x9C, 0x55,
-    0x8E, 0xD1, 0x0D, 0x82, 0x00, 0x0C, 0x44, 0x0F, 0xC1, 0x44, 0x7F, 0x84, 0x4D, 0x74, 0x03, 0xDD,
-    0x00, 0x47, 0x70, 0x13, 0x47, 0xD0, 0x11, 0xD8, 0x00, 0x36, 0xD0, 0x0D, 0x74, 0x03, 0xDC, 0x40,
-    0x12, 0x13, 0x21, 0xFA, 0xF1, 0x6C, 0xAB, 0x7C, 0xF8, 0xF3, 0x9A, 0xDC, 0xB5, 0x77, 0x1D, 0x58,
-    0x4A, 0xBA, 0xD2, 0x1A, 0x37, 0x30, 0xB3, 0xF1, 0x0E, 0xE9, 0x41, 0x6D, 0x3C, 0xC3, 0x44, 0xDA,
-    0x85, 0x51, 0xC0, 0x22, 0xEC, 0xB5, 0xB1, 0x67, 0x1F, 0x4B, 0x27, 0x63, 0xC7, 0xDD, 0x78, 0x83,
-    0x64, 0x3C, 0xA8, 0x20, 0x93, 0x8E, 0x30, 0xFD, 0xE7, 0x57, 0x6F, 0x20, 0xF5, 0x4E, 0xDF, 0xEF,
-    0x20, 0x72, 0x2E, 0xC6, 0x27, 0x87, 0xC8, 0x2F, 0x8D, 0x90, 0x4B, 0x5B, 0x98, 0x47, 0x64, 0x3A,
-    0x56, 0xBD, 0xBC, 0x7C, 0xF5, 0x93, 0xDB, 0xC4, 0xFF, 0xF0, 0x6F, 0x3E, 0x4F, 0x98, 0x53, 0x15,
-    0x78, 0x9C, 0x63, 0x60, 0x60, 0xF8, 0xF0, 0x7F, 0x3F, 0x03, 0x04, 0x3C, 0xF8, 0x3F, 0x1F, 0xCA,
-    0xBA, 0xF0, 0xBF, 0x1E, 0xCA, 0xDA, 0xF0, 0x3F, 0x1F, 0xCA, 0x9A, 0xF0, 0xDF, 0x1F, 0x44, 0x5D,
-    0xF6, 0x60, 0x28, 0xF8, 0xAF, 0xCF, 0x10, 0x78, 0x93, 0xE1, 0xEB, 0xFF, 0xFD, 0x65, 0xFF, 0xFD,
-    0x8F, 0xFF, 0xFF, 0xCF, 0xF8, 0xE3, 0x3F, 0x14, 0x30, 0xFF, 0x82, 0xB1, 0xD8, 0x76, 0xBC, 0x01,
-    0xD3, 0xEF, 0xF7, 0xB2, 0x32, 0x30, 0x08, 0xFC, 0xFD, 0xFF, 0x9F, 0x13, 0x6A, 0xC8, 0x7F, 0x88,
-    0x31, 0x0C, 0x5F, 0xFE, 0xCF, 0xFF, 0xFF, 0x9E, 0x11, 0xC8, 0x10, 0xF8, 0xF7, 0x5F, 0xEA, 0xFF,
-    0x7F, 0x6E, 0xB0, 0x5D, 0xFF, 0x99, 0x7F, 0x80, 0x6D, 0xFE, 0xF6, 0xFF, 0x3C, 0xC3, 0xC7, 0xFF,
-    0xFF, 0x99, 0x18, 0x18, 0x02, 0xFE, 0xC6, 0x03, 0x35, 0xD9, 0x80, 0x74, 0x24, 0xF0, 0x30, 0x28,
-    0xC4, 0x32, 0x20, 0x03, 0x00, 0x6E, 0xEE, 0x4F, 0xAF, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x30,
-    0x36, 0x66, 0x80, 0x00, 0x83, 0xFF, 0xEF, 0x29, 0x65, 0x7D, 0xFD, 0x0F, 0x05, 0xF2, 0xF8, 0x59,
-    0x02, 0x82, 0x82, 0x86, 0xFF, 0xDF, 0x0B, 0x0A, 0x0A, 0x32, 0x52, 0x68, 0x2F, 0x83, 0xB1, 0x32,
-    0x88, 0x04, 0x00, 0x5B, 0xC6, 0x42, 0xF8, 0x78, 0x9C, 0x01, 0x24, 0x00, 0xDB, 0xFF, 0x00, 0xFF,
-    0xFF, 0x6F, 0x30, 0xFF, 0xFF, 0x2F, 0x60, 0xFF, 0xFF, 0x0D, 0x90, 0xFF, 0xFF, 0x08, 0xC0, 0xFF,
-    0xFF, 0x02, 0xF0, 0xFF, 0xCF, 0x00, 0xF4, 0xFF, 0x5F, 0x00, 0xF7, 0xFF, 0x0E, 0x00, 0xFB, 0xFF,
-    0x07, 0x00, 0xA4, 0x35, 0x15, 0xA1, 0x78, 0x9C, 0xFB, 0xF7, 0x1F, 0x08, 0x18, 0xFF, 0x61, 0x90,
-    0x2B, 0x56, 0x01, 0x01, 0x03, 0x00, 0x87, 0xD9, 0x17, 0x3D, 0x78, 0x9C, 0x63, 0x70, 0x62, 0x62,
-    0x38, 0xF8, 0x7F, 0x3D, 0xC3, 0xCF, 0xFF, 0xFF, 0xD9, 0xFE, 0xFC, 0xFF, 0xCF, 0xF9, 0x1B, 0x88,
-    0xBF, 0xFD, 0xFF, 0xCF, 0x5C, 0xF0, 0x37, 0x96, 0x01, 0x00, 0xE0, 0x41, 0x10, 0x77, 0x78, 0x9C,
-    0x95, 0xCD, 0xCB, 0x09, 0x83, 0x50, 0x00, 0x44, 0xD1, 0x27, 0x12, 0x24, 0x88, 0x62, 0x07, 0xDA,
-    0x49, 0xEC, 0xC4, 0x74, 0x12, 0x4B, 0xB0, 0x83, 0xD8, 0x89, 0x76, 0xA2, 0x1D, 0x84, 0x88, 0x06,
-    0xF1, 0x77, 0x93, 0x79, 0x64, 0xA3, 0x3B, 0x67, 0x73, 0x36, 0x03, 0xD7, 0x98, 0xDF, 0x56, 0x32,
-    0x91, 0x40, 0x28, 0x0B, 0xB8, 0xCA, 0x16, 0x5C, 0x39, 0xD0, 0x08, 0x33, 0xF3, 0x10, 0x11, 0xC4,
-    0xF2, 0x0E, 0xBE, 0xAC, 0xE1, 0x22, 0x3B, 0x5E, 0xF6, 0x36, 0xF2, 0xB4, 0x6E, 0xDC, 0x44, 0x0A,
-    0x81, 0x2C, 0xC1, 0x93, 0x6F, 0x70, 0xE4, 0x87, 0xCA, 0xDE, 0x96, 0x7D, 0x3C, 0x3F, 0xC4, 0xFB,
-    0x7F, 0x7C, 0x3A, 0x17, 0xFF, 0x02, 0x16, 0xCD, 0x44, 0xF2, 0x78, 0x9C, 0x45, 0x8F, 0x4D, 0x0E,
-    0x01, 0x41, 0x10, 0x85, 0x9F, 0xF1, 0x33, 0x89, 0x49, 0x98, 0x1B, 0x8C, 0x03, 0x48, 0xC6, 0x0D,
-    0x66, 0x2F, 0x91, 0xB1, 0xB6, 0xE1, 0x08, 0x8E, 0xE0, 0x06, 0x1C, 0xC1, 0x09, 0xB0, 0x62, 0x87,
-    0x93, 0xB0, 0xB2, 0x26, 0xFE, 0x45, 0x66, 0x9E, 0xAA, 0xEE, 0x4C, 0xAB, 0x45, 0xF7, 0xD7, 0x9D,
-    0x7A, 0xAF, 0x5E, 0x01, 0xE1, 0x26, 0x3F, 0x74, 0xA1, 0xF5, 0xA2, 0x54, 0x5B, 0x60, 0xA6, 0xC0,
-    0xB3, 0x07, 0x3C, 0x0D, 0xB1, 0x01, 0xE4, 0xE4, 0xF6, 0x4B, 0x4E, 0x31, 0x22, 0x77, 0xE8, 0xC8,
-    0x13, 0x2B, 0x32, 0x32, 0x2D, 0xD5, 0x0B, 0x19, 0x00, 0x72, 0xD6, 0x6F, 0xA4, 0x0F, 0xEC, 0x45,
-    0xF2, 0x20, 0x2B, 0xC6, 0xAA, 0x29, 0xBE, 0x65, 0x60, 0x42, 0xC6, 0x6F, 0xB2, 0x04, 0x75, 0x48,
-    0x3E, 0x05, 0xA5, 0x8E, 0x86, 0xFF, 0x3F, 0xD7, 0x97, 0x8A, 0xD6, 0x33, 0xDA, 0xC4, 0xF9, 0x45,
-    0x57, 0xB2, 0x66, 0x67, 0xE8, 0x44, 0x33, 0x37, 0x98, 0x17, 0x59, 0xFC, 0xBE, 0xE6, 0x6B, 0xE5,
-    0xAA, 0xCB, 0xC8, 0x85, 0x64, 0x5E, 0x02, 0x77, 0xBB, 0x47, 0x0C, 0x8C, 0x2D, 0x89, 0x15, 0x4E,
-    0x0A, 0x3D, 0xDD, 0x3C, 0x5C, 0x67, 0xC7, 0x81, 0xDC, 0x3F, 0xB6, 0x70, 0x9B, 0xF1, 0x78, 0x9C,
-    0x63, 0x60, 0x60, 0x60, 0xF8, 0xF9, 0x7F, 0x3F, 0x90, 0x3C, 0xF8, 0x1F, 0x44, 0x19, 0xFC, 0x03,
-    0x53, 0xDF, 0xFE, 0x83, 0xA8, 0x05, 0xFF, 0x41, 0x94, 0xC2, 0x1F, 0x30, 0xF5, 0xE4, 0xFF, 0xFF,
-    0xF9, 0xFF, 0xFE, 0xEF, 0xFF, 0xF2, 0xFF, 0x3F, 0x07, 0x90, 0xD7, 0xF0, 0x3F, 0x9F, 0x01, 0xA4,
-    0xE4, 0x35, 0x33, 0x98, 0x12, 0x60, 0x00, 0x53, 0x0C, 0xF4, 0xA5, 0x00, 0x04, 0x37, 0x5C, 0xEC,
-    0x78, 0x9C, 0x63, 0x60, 0x70, 0x38, 0xF1, 0xEF, 0x7E, 0x35, 0x23, 0x03, 0x03, 0x43, 0xC0, 0xDF,
-    0xFF, 0x40, 0xD0, 0xCF, 0xC0, 0x20, 0xF0, 0xFB, 0x3F, 0x18, 0x70, 0x33, 0x3C, 0x82, 0x30, 0xFE,
-    0xCF, 0x67, 0x78, 0x08, 0x24, 0xEF, 0xFD, 0x03, 0x12, 0x4C, 0x06, 0xFF, 0xFF, 0x5B, 0x31, 0x18,
-    0x00, 0xD5, 0xB2, 0x33, 0x7C, 0xB5, 0x05, 0x6A, 0xFB, 0xF2, 0xFF, 0x3F, 0x17, 0x83, 0x03, 0x90,
-    0xC1, 0xF0, 0x01, 0xA4, 0x85, 0x01, 0xCA, 0xE2, 0x84, 0xB0, 0x3E, 0xFF, 0xFF, 0xCF, 0x06, 0x61,
-    0xFD, 0xFA, 0xFF, 0x9F, 0x11, 0xCC, 0x70, 0xF8, 0xFF, 0x7F, 0x3D, 0x44, 0x08, 0x68, 0xA8, 0x3C,
-    0x98, 0x21, 0x00, 0x34, 0x8E, 0x15, 0xCC, 0x3A, 0x08, 0x76, 0x01, 0x48, 0xE8, 0x0F, 0xCC, 0x8C,
-    0x83, 0x20, 0xFB, 0x61, 0x42, 0x1C, 0x60, 0xD6, 0xC5, 0xFF, 0xFF, 0xF3, 0xD1, 0x34, 0x02, 0x85,
-    0xFC, 0x61, 0x42, 0xEF, 0x99, 0x61, 0x42, 0xFF, 0xEF, 0x82, 0x40, 0xEE, 0x77, 0xA8, 0x3F, 0xFE,
-    0xD7, 0xE3, 0x67, 0x01, 0x00, 0xD9, 0x37, 0x87, 0xDF, 0x78, 0x9C, 0x35, 0xCF, 0xBD, 0x0E, 0x01,
-    0x51, 0x10, 0x05, 0xE0, 0xB3, 0xC2, 0x16, 0xB2, 0x09, 0x2F, 0x20, 0x4A, 0x95, 0xE0, 0x0D, 0xB6,
-    0x14, 0x4F, 0x21, 0x0A, 0x1D, 0x8D, 0x52, 0xAB, 0x57, 0x8A, 0x86, 0x5A, 0xA5, 0x57, 0xAC, 0x47,
-    0x58, 0x1D, 0x11, 0xF1, 0x13, 0x91, 0xE8, 0x44, 0xFC, 0xAD, 0x60, 0x8F, 0xD9, 0x9D, 0xDD, 0xD3,
-    0xCC, 0x97, 0xCC, 0xBD, 0x73, 0xEF, 0x00, 0xBD, 0x0D, 0xB7, 0x5D, 0x03, 0xC0, 0x99, 0x41, 0xC6,
-    0x06, 0x8E, 0xD4, 0xE4, 0x70, 0x88, 0x34, 0x87, 0x4D, 0xBA, 0xB3, 0x9F, 0x30, 0x81, 0x77, 0x0B,
-    0x28, 0xFB, 0x64, 0x0A, 0x75, 0xB9, 0x85, 0x17, 0x69, 0x22, 0xCC, 0x9D, 0x4C, 0xAA, 0x1E, 0xA4,
-    0xA1, 0xFA, 0xB1, 0x1F, 0xD6, 0xCA, 0x92, 0xB4, 0xA4, 0x3E, 0x83, 0x71, 0x53, 0x44, 0x1A, 0x25,
-    0x62, 0xED, 0x6A, 0xB1, 0xC8, 0xA2, 0xA8, 0xD1, 0x1C, 0x7C, 0xC9, 0x4B, 0xD8, 0x47, 0xF6, 0x43,
-    0xA6, 0x75, 0xDE, 0x95, 0xCC, 0xA8, 0x16, 0x64, 0x49, 0xB5, 0x17, 0xE9, 0x73, 0x37, 0x32, 0xBF,
-    0x2A, 0x08, 0x6C, 0xF9, 0x9F, 0xE5, 0xD1, 0x19, 0x4E, 0x04, 0x34, 0xBD, 0x68, 0x0F, 0x17, 0xB1,
-    0x2C, 0x9C, 0x14, 0x6D, 0x39, 0xDD, 0x59, 0xFB, 0x74, 0xAA, 0x82, 0x3F, 0x66, 0x64, 0x88, 0x88,
-    0x78, 0x9C, 0x63, 0x60, 0x00, 0x81, 0x3F, 0xFF, 0xEF, 0x33, 0x40, 0x40, 0xC1, 0x7F, 0x38, 0xF3,
-    0x13, 0x82, 0xF9, 0x17, 0xCE, 0x6C, 0xF8, 0x0F, 0x67, 0x7E, 0x46, 0x30, 0xFF, 0xFE, 0xFF, 0x07,
-    0x65, 0x36, 0xFC, 0xBF, 0xFF, 0x13, 0xCA, 0xFC, 0xFC, 0xDF, 0xFF, 0x17, 0x94, 0xF9, 0xF7, 0x3F,
-    0xD7, 0x6F, 0x08, 0x73, 0xC2, 0xFF, 0xF7, 0x8C, 0x50, 0xE6, 0x97, 0xFF, 0xF1, 0x50, 0x8B, 0x05,
-    0xFE, 0xFD, 0xE7, 0x86, 0x32, 0x17, 0x00, 0xE5, 0xA1, 0xCC, 0xAF, 0x40, 0x79, 0x08, 0x13, 0x2C,
-    0x0F, 0x61, 0x82, 0xE5, 0x21, 0xCC, 0x2F, 0xFF, 0x61, 0x40, 0xFE, 0x2B, 0x21, 0x66, 0x51, 0x39,
-    0x08, 0xFC, 0xFD, 0xFF, 0xBE, 0x9C, 0x9D, 0x01, 0xCD, 0xC7, 0x44, 0x32, 0x01, 0xC8, 0x49, 0x8C,
-    0x03, 0x78, 0x9C, 0x3D, 0xCD, 0x3F, 0x0E, 0x01, 0x41, 0x18, 0x05, 0xF0, 0x27, 0x6C, 0x23, 0xC1,
-    0x5E, 0xC0, 0x9F, 0x4E, 0xA1, 0xE0, 0x06, 0xB4, 0xAA, 0x75, 0x04, 0x37, 0x50, 0xB8, 0x80, 0x23,
-    0x38, 0x80, 0x1B, 0xE0, 0x0C, 0xAB, 0xD6, 0x88, 0x5A, 0x64, 0xDD, 0x60, 0x92, 0x09, 0xC5, 0x06,
-    0xF3, 0xCC, 0x7A, 0x93, 0x79, 0xD5, 0x2F, 0x33, 0xDF, 0xF7, 0x3E, 0x94, 0xFC, 0x67, 0x0C, 0xBC,
-    0xA3, 0x3E, 0x51, 0xDF, 0x28, 0x47, 0x73, 0xF7, 0xE9, 0x02, 0xE4, 0x0A, 0x0A, 0x99, 0x09, 0x03,
-    0x72, 0x2A, 0x4D, 0xC8, 0xBE, 0x34, 0x23, 0x3B, 0xD2, 0x82, 0xCC, 0x9D, 0xD9, 0xD5, 0x81, 0xA5,
-    0xEA, 0xF2, 0x1A, 0x36, 0x12, 0x7B, 0xD8, 0x06, 0x5D, 0x90, 0x96, 0xC5, 0xE1, 0x5C, 0xB1, 0x81,
-    0x14, 0x1A, 0x6E, 0xAA, 0xE1, 0x49, 0xB6, 0xA4, 0x47, 0x6C, 0x3D, 0x91, 0xED, 0xF8, 0x16, 0x7E,
-    0x5F, 0x7E, 0xC3, 0xCE, 0xC3, 0x6E, 0x62, 0x69, 0xF6, 0x55, 0x5F, 0x01, 0x1B, 0x6E, 0x64, 0x51,
-    0x09, 0xAE, 0xC2, 0xC8, 0x4F, 0xAF, 0x6F, 0xCE, 0x1C, 0x87, 0x1E, 0x3F, 0x75, 0x93, 0x8C, 0xD4,
-    0x78, 0x9C, 0x35, 0x8E, 0x3D, 0x0E, 0x01, 0x51, 0x14, 0x85, 0xCF, 0x10, 0x42, 0x82, 0xCC, 0x12,
-    0xAC, 0x00, 0xAD, 0xCA, 0x12, 0xD8, 0x01, 0xB1, 0x01, 0x6A, 0x12, 0x54, 0x42, 0xA2, 0xB0, 0x03,
-    0x0A, 0x5A, 0x63, 0x07, 0x1A, 0x8D, 0x6A, 0x7A, 0xCD, 0x90, 0xE8, 0x47, 0xFC, 0x8C, 0x9F, 0x98,
-    0x39, 0xEE, 0x7B, 0x8F, 0x5B, 0xBC, 0xFB, 0xE5, 0x9E, 0x73, 0xEF, 0x3B, 0x00, 0xD0, 0xDC, 0x47,
-    0xEC, 0x49, 0xC7, 0x96, 0x52, 0x33, 0x81, 0x39, 0x7F, 0x64, 0x7F, 0xFE, 0xB4, 0x96, 0xE6, 0x8E,
-    0x47, 0x1D, 0x20, 0x20, 0x5B, 0xD0, 0x15, 0xD1, 0x8B, 0x69, 0xA8, 0x91, 0x15, 0x33, 0x12, 0x5B,
-    0xCA, 0xD0, 0x99, 0x34, 0x22, 0x2E, 0xF4, 0xB1, 0x08, 0xBD, 0xB2, 0x5A, 0x75, 0xF5, 0xE9, 0x34,
-    0x1E, 0x74, 0xDE, 0x8A, 0x1C, 0x3C, 0xF9, 0xAB, 0xE4, 0x4B, 0x9E, 0xEE, 0x30, 0x22, 0xB3, 0x22,
-    0x55, 0x81, 0x23, 0x59, 0x94, 0x59, 0x02, 0x68, 0x90, 0x75, 0xF1, 0x59, 0x40, 0x9E, 0xEC, 0x07,
-    0x9A, 0x6C, 0xA1, 0xAB, 0x56, 0x4B, 0xA2, 0x1E, 0xC8, 0x0C, 0x30, 0x95, 0x1C, 0x03, 0x75, 0x14,
-    0x37, 0x32, 0x27, 0x0E, 0xAE, 0x76, 0x54, 0x89, 0xEE, 0xE6, 0x0B, 0x0F, 0x68, 0x1B, 0x2A, 0x48,
-    0xAE, 0x93, 0x82, 0x8D, 0xA5, 0x22, 0x2E, 0x43, 0x7F, 0x12, 0x07, 0xBE, 0x89, 0xF7, 0x97, 0xEE,
-    0x78, 0x9C, 0x7D, 0xCF, 0xC1, 0x0D, 0x82, 0x50, 0x10, 0x84, 0x61, 0x8D, 0x18, 0x0D, 0x18, 0x43,
-    0x07, 0xDA, 0x01, 0x25, 0x40, 0x27, 0xD0, 0x81, 0x25, 0x60, 0x09, 0x74, 0x60, 0x09, 0xD8, 0x89,
-    0x36, 0x60, 0xA4, 0x01, 0x0E, 0x62, 0x4C, 0x88, 0x51, 0x7F, 0x5F, 0x76, 0x7C, 0xEF, 0xE8, 0x9C,
-    0xBE, 0xEC, 0x61, 0x26, 0x0B, 0xBF, 0xD4, 0xFC, 0xD5, 0xC5, 0xD2, 0xC3, 0x66, 0x62, 0xE9, 0x20,
-    0x96, 0x1E, 0x30, 0x93, 0xDE, 0x9C, 0x84, 0x02, 0x4A, 0xE9, 0x08, 0x6B, 0xE9, 0x0E, 0x0B, 0xE9,
-    0x09, 0x53, 0xC3, 0x16, 0x0E, 0x3A, 0x35, 0x90, 0x49, 0x37, 0x48, 0xA4, 0x11, 0x22, 0xE9, 0xC3,
-    0x55, 0xA8, 0x60, 0x27, 0x9D, 0x43, 0xAF, 0x9B, 0x5F, 0x4A, 0x2F, 0xDF, 0xEB, 0xE6, 0xDB, 0x30,
-    0x9F, 0x4B, 0x03, 0xAC, 0xC2, 0xFC, 0xDC, 0x90, 0xE2, 0x7B, 0xF7, 0xEE, 0x41, 0xC3, 0x17, 0x6F,
-    0x49, 0x6D, 0xAA, 0x78, 0x9C, 0x2D, 0x8E, 0x3D, 0x0E, 0x01, 0x51, 0x14, 0x85, 0x0F, 0xE3, 0x2F,
-    0x7E, 0x92, 0xD9, 0x00, 0xD1, 0x2B, 0xA8, 0xB4, 0x34, 0x6A, 0x4B, 0x40, 0x62, 0x01, 0x56, 0x80,
-    0x42, 0x47, 0x62, 0x0B, 0xB3, 0x83, 0xB1, 0x03, 0x94, 0xAA, 0xE9, 0x35, 0x44, 0x24, 0xCA, 0x11,
-    0xC4, 0x64, 0x12, 0xE6, 0x38, 0x6F, 0xC6, 0xAD, 0xBE, 0x77, 0x73, 0xDE, 0x77, 0x2E, 0xD0, 0x3A,
-    0x44, 0xFE, 0x32, 0x0D, 0xA0, 0xFE, 0xA1, 0xC6, 0x4D, 0x01, 0x2F, 0xC6, 0x53, 0x85, 0x1D, 0x25,
-    0xB4, 0xC5, 0x84, 0x3C, 0xB5, 0x17, 0x42, 0x6B, 0x43, 0xD6, 0xE2, 0x48, 0x6E, 0x47, 0x16, 0x81,
-    0x33, 0x59, 0xD0, 0xAE, 0x04, 0xDC, 0xB5, 0x53, 0xAE, 0x09, 0xBC, 0xC9, 0xB4, 0x4D, 0xFA, 0x19,
-    0x3D, 0xDD, 0xF8, 0xE9, 0x7D, 0x8D, 0xCF, 0x68, 0x8C, 0x4E, 0x1D, 0xB8, 0x1A, 0xCA, 0x09, 0x70,
-    0x33, 0xD4, 0x10, 0xEC, 0x93, 0xB6, 0x2C, 0x6C, 0xA5, 0xA7, 0x3A, 0x67, 0x06, 0x99, 0xD7, 0x18,
-    0x6A, 0x99, 0x79, 0x90, 0x79, 0xE0, 0x42, 0x56, 0x02, 0xFA, 0x0A, 0x77, 0xC9, 0x4E, 0x68, 0xEC,
-    0x00, 0x39, 0x08, 0xE9, 0x09, 0xD4, 0xD9, 0x0F, 0x8C, 0x00, 0x8E, 0xEE, 0x78, 0xAA, 0xA9, 0x37,
-    0x96, 0xA6, 0xEC, 0xF0, 0x3F, 0x96, 0xFD, 0x49, 0x60, 0x00, 0xCC, 0x63, 0xF0, 0x2C, 0xFD, 0x1B,
-    0x1D, 0x23, 0x7F, 0x25, 0xF8, 0x01, 0x3E, 0xAA, 0xA3, 0xD7, 0x78, 0x9C, 0x35, 0x8E, 0x31, 0x4E,
-    0xC3, 0x50, 0x10, 0x44, 0x07, 0x39, 0x92, 0x45, 0x90, 0x2C, 0x37, 0x88, 0x22, 0x12, 0xA1, 0xA6,
-    0x20, 0xB4, 0xAE, 0xE0, 0x06, 0xF6, 0x0D, 0x9C, 0x8E, 0x92, 0x36, 0x65, 0x8E, 0x11, 0xA5, 0x81,
-    0x1E, 0x24, 0x68, 0xA8, 0xE1, 0x04, 0x09, 0xA2, 0x82, 0xCA, 0x07, 0x48, 0x11, 0x09, 0x24, 0x9C,
-    0x60, 0xC7, 0x8F, 0xFD, 0xDF, 0xF1, 0x14, 0xFF, 0x3F, 0x69, 0x67, 0x66, 0x57, 0xCA, 0xBE, 0x9A,
-    0x45, 0x22, 0xD3, 0xF5, 0x0E, 0xD3, 0xC0, 0xE8, 0xD7, 0x01, 0xEB, 0x40, 0x97, 0xB4, 0x3A, 0xD5,
-    0x9B, 0xBD, 0x0F, 0x15, 0xBC, 0xEA, 0x07, 0x2E, 0x74, 0x66, 0xDE, 0x60, 0x03, 0x3D, 0xE9, 0x1B,
-    0x0E, 0xFF, 0xC0, 0x62, 0xF7, 0x10, 0xD5, 0x14, 0x46, 0x63, 0x18, 0x56, 0x9E, 0x32, 0x48, 0x6D,
-    0x7A, 0xE0, 0xA7, 0x79, 0x09, 0x7D, 0xC9, 0x72, 0xB9, 0xA5, 0x96, 0x37, 0x9F, 0x56, 0x9A, 0x3F,
-    0xEF, 0x77, 0x90, 0xC6, 0x8D, 0xFB, 0x6E, 0xE1, 0x4A, 0x1F, 0x8E, 0x4E, 0xAC, 0x45, 0x7A, 0x69,
-    0x8A, 0xC4, 0xEE, 0x88, 0xE4, 0x35, 0x85, 0xA3, 0x96, 0xDE, 0x21, 0x6C, 0xA9, 0xF4, 0xFD, 0xED,
-    0xB2, 0x27, 0x0F, 0xF1, 0x16, 0x46, 0xD2, 0x7C, 0x32, 0xAB, 0xF1, 0x36, 0xDF, 0xCC, 0x9D, 0x3A,
-    0x0A, 0x3B, 0x3A, 0x77, 0xF6, 0x15, 0xC5, 0xE3, 0xB1, 0x83, 0x7F, 0x7A, 0xC7, 0x96, 0x3F, 0x78,
-    0x9C, 0x2B, 0xF8, 0x1B, 0xCB, 0xF0, 0xED, 0xFF, 0x7F, 0x96, 0xDF, 0xFF, 0xFF, 0x73, 0xFE, 0x01,
-    0xE2, 0x1F, 0xFF, 0xFF, 0xB3, 0x1D, 0xFC, 0xBF, 0x9E, 0x81, 0xC1, 0x89, 0x89, 0x01, 0x2F, 0x00,
-    0xCA, 0x83, 0xD4, 0xFD, 0x04, 0xAA, 0x07, 0xE9, 0x03, 0xE9, 0x07, 0x9A, 0xC3, 0x5C, 0x00, 0x34,
-    0x0F, 0x00, 0x87, 0xFA, 0x20, 0xED, 0x78, 0x9C, 0x63, 0xB8, 0x7E, 0x9F, 0x35, 0xE1, 0xFF, 0x7F,
-    0xFF, 0x0D, 0xFF, 0xFF, 0xCF, 0x3F, 0x00, 0xC4, 0x0D, 0xFF, 0xFF, 0xE7, 0x0B, 0xFC, 0xF9, 0xCF,
-    0xC5, 0xA0, 0xA0, 0xC2, 0x40, 0x34, 0x00, 0xEA, 0x31, 0xF8, 0xFF, 0x5F, 0x1F, 0x68, 0x0E, 0xEF,
-    0x84, 0xFF, 0xFF, 0x39, 0x80, 0xE6, 0x30, 0x7D, 0xF8, 0x7F, 0x9E, 0xE1, 0xCB, 0xFF, 0x78, 0x86,
-    0xEF, 0xFF, 0xF9, 0x18, 0x7E, 0xFF, 0x67, 0x67, 0x00, 0x00, 0x84, 0x3B, 0x25, 0xF9, 0x78, 0x9C,
-    0x63, 0x60, 0x80, 0x00, 0x01, 0x0E, 0x18, 0xE3, 0x87, 0x3C, 0x8C, 0xF1, 0x5F, 0x1E, 0xC6, 0x80,
-    0xB0, 0x40, 0x8C, 0xFF, 0xBC, 0x30, 0x46, 0x0C, 0x8C, 0xE1, 0x0D, 0x63, 0x58, 0xC1, 0x18, 0x9A,
-    0x20, 0xD5, 0x5F, 0xFE, 0xFF, 0x7F, 0x2F, 0x01, 0x36, 0xE0, 0xEB, 0xFF, 0xFF, 0xB2, 0x0C, 0x30,
-    0xD6, 0x7F, 0x4B, 0x30, 0x2B, 0xE1, 0x2F, 0x90, 0x99, 0x03, 0x66, 0x3A, 0xFC, 0x06, 0x32, 0xE7,
-    0x31, 0x81, 0x98, 0x0A, 0x3F, 0x81, 0xCC, 0xFD, 0xAC, 0x60, 0xCB, 0x9E, 0x03, 0x99, 0xEF, 0x21,
-    0xAE, 0xBA, 0xF6, 0x1F, 0xEA, 0x02, 0x06, 0x86, 0x2D, 0x70, 0x16, 0xC3, 0x24, 0x38, 0x8B, 0xA1,
-    0x50, 0x8E, 0x01, 0x0E, 0x00, 0xEC, 0xBB, 0x43, 0x54, 0x78, 0x9C, 0xFB, 0xFA, 0x1F, 0x0A, 0xE4,
-    0xBF, 0xE2, 0x65, 0x09, 0x08, 0x42, 0x01, 0x23, 0x03, 0x1C, 0x20, 0xC4, 0xF0, 0xEB, 0x45, 0xB0,
-    0x00, 0x13, 0x24, 0x49, 0x93, 0x78, 0x9C, 0x4B, 0x61, 0x80, 0x81, 0xAF, 0x79, 0x70, 0xD6, 0xFF,
-    0x3C, 0x38, 0x0B, 0xC6, 0xFC, 0xF2, 0x1F, 0xC6, 0x14, 0x78, 0x0E, 0x67, 0x32, 0x5C, 0x43, 0x30,
-    0x8F, 0x22, 0x98, 0x5B, 0x10, 0xCC, 0xC5, 0x40, 0x26, 0x1F, 0xDC, 0x04, 0x79, 0x30, 0x63, 0xEB,
-    0x7F, 0x08, 0x4B, 0xE0, 0x05, 0x90, 0xB1, 0x9F, 0x85, 0x81, 0xC1, 0xE1, 0x37, 0x90, 0x31, 0x9F,
-    0x89, 0x81, 0xA1, 0xF0, 0x2F, 0x90, 0x51, 0xC7, 0xC8, 0xC0, 0xB0, 0x08, 0x48, 0xFF, 0x8F, 0x81,
-    0xBA, 0xE0, 0xBF, 0x37, 0xCC, 0x2D, 0x9A, 0x50, 0x57, 0xBD, 0x67, 0x87, 0xBA, 0xEF, 0x28, 0x2B,
-    0x03, 0x06, 0x00, 0x00, 0xEA, 0x34, 0x44, 0xEF, 0x78, 0x9C, 0x85, 0x8F, 0x3D, 0x0E, 0x01, 0x61,
-    0x10, 0x86, 0x5F, 0xBB, 0x11, 0x44, 0x82, 0x5A, 0xA5, 0x53, 0xDA, 0x23, 0xAC, 0x1B, 0xEC, 0x0D,
-    0x1C, 0xC1, 0x15, 0x9C, 0x44, 0x54, 0x12, 0x89, 0xC2, 0x09, 0xD8, 0x1B, 0x70, 0x03, 0x1A, 0xA5,
-    0x88, 0xF8, 0x29, 0xD8, 0x78, 0x7C, 0x33, 0x4B, 0xED, 0x6D, 0x9E, 0x27, 0x93, 0x6F, 0xBE, 0x99,
-    0x51, 0x6F, 0x7E, 0x62, 0xDD, 0x97, 0xB2, 0x02, 0x4B, 0x43, 0x4F, 0x27, 0x5B, 0xDD, 0x4A, 0xA1,
-    0x9E, 0xC3, 0x72, 0xF1, 0x86, 0x56, 0xBA, 0xA9, 0x4A, 0x33, 0x18, 0x28, 0x92, 0x94, 0x98, 0x58,
-    0x52, 0x68, 0xBB, 0x84, 0x87, 0x4D, 0x63, 0x27, 0xFC, 0x15, 0x9B, 0x1C, 0x61, 0x64, 0x0C, 0x3D,
-    0x67, 0x2F, 0xBC, 0xA0, 0x6B, 0xCC, 0x60, 0xEC, 0x2D, 0x2B, 0xA8, 0xB9, 0xEC, 0xA0, 0xE2, 0x72,
-    0x00, 0xFD, 0xCD, 0x30, 0x2E, 0x39, 0x61, 0x1F, 0xB9, 0x5C, 0xBF, 0xA3, 0xF5, 0xF8, 0x2D, 0x73,
-    0x0F, 0x0B, 0xBB, 0x5C, 0xEC, 0x2A, 0x4B, 0x52, 0x4C, 0x0D, 0x1F, 0xDA, 0x5A, 0x54, 0x7A, 0x78,
-    0x9C, 0x4D, 0x51, 0x3D, 0x4F, 0xC2, 0x50, 0x14, 0xBD, 0x94, 0x12, 0x09, 0x06, 0xE9, 0x66, 0x5C,
-    0x2C, 0xBF, 0xC0, 0xF2, 0x0B, 0xC0, 0x7F, 0xA0, 0x6E, 0x6E, 0x6C, 0xC6, 0x0D, 0x5D, 0x89, 0x09,
-    0x1D, 0x1C, 0xDC, 0xD8, 0x8D, 0x89, 0x4E, 0x26, 0x4E, 0xB0, 0x3A, 0x68, 0x75, 0x72, 0xB3, 0xCE,
-    0xC6, 0x08, 0x6E, 0x12, 0x49, 0x0A, 0x8A, 0x1F, 0x25, 0xB4, 0xC7, 0xF3, 0x5E, 0xEB, 0xC7, 0x49,
-    0x5E, 0x6F, 0xCF, 0xBD, 0xA7, 0xE7, 0x9D, 0xDC, 0x8A, 0x10, 0xD6, 0xE9, 0x10, 0x8F, 0x4D, 0x43,
-    0x52, 0xAC, 0xCE, 0xA0, 0xE0, 0xE7, 0x12, 0x5A, 0x4E, 0x28, 0xE0, 0x65, 0x34, 0xFF, 0xE0, 0xEB,
-    0xD1, 0xC1, 0x39, 0x9F, 0x55, 0x45, 0x5D, 0xA0, 0x63, 0xB2, 0xAE, 0xCF, 0x10, 0x18, 0x7A, 0xEC,
-    0x67, 0xB5, 0x6E, 0x07, 0x28, 0x8A, 0x54, 0x80, 0x42, 0xEA, 0xFB, 0x8E, 0x96, 0xC8, 0x1D, 0x7C,
-    0x91, 0xDD, 0x17, 0xDC, 0x36, 0x4D, 0x17, 0x81, 0x6A, 0xDA, 0x4A, 0x49, 0xB4, 0x25, 0x46, 0x4E,
-    0x22, 0xCC, 0xC9, 0x54, 0xF3, 0x96, 0x7C, 0xA1, 0xC0, 0xCF, 0xD5, 0x0D, 0xC7, 0x5B, 0xCF, 0x68,
-    0xC8, 0x1B, 0x16, 0x5C, 0x74, 0xE4, 0x15, 0x7E, 0x86, 0x3E, 0x0D, 0x19, 0xC1, 0xEE, 0xB2, 0x84,
-    0x58, 0x16, 0xE9, 0xA3, 0xCE, 0xE3, 0xF4, 0x51, 0xA3, 0x45, 0x5E, 0x38, 0x5B, 0x53, 0x9C, 0x12,
-    0x01, 0x4C, 0xC5, 0x6B, 0xE4, 0xF6, 0x18, 0x25, 0x0B, 0x60, 0xC0, 0x31, 0xF9, 0x08, 0x25, 0xF2,
-    0x64, 0x3E, 0x81, 0x43, 0xE3, 0xA2, 0xD2, 0xC7, 0x8C, 0x40, 0x53, 0x47, 0x3E, 0x91, 0x57, 0x7E,
-    0x53, 0xFA, 0x33, 0x47, 0x9D, 0xC6, 0xD9, 0x2B, 0xC6, 0x9A, 0x20, 0xD8, 0x0E, 0x81, 0xDE, 0x0D,
-    0x3C, 0x66, 0xF3, 0xE4, 0x44, 0xC7, 0x8D, 0x78, 0x56, 0x94, 0xCE, 0xD0, 0xF9, 0xAB, 0x4F, 0x40,
-    0xC0, 0x7B, 0x22, 0xCC, 0x4B, 0xE5, 0x1E, 0x7B, 0x62, 0x0D, 0x7A, 0x4B, 0x7A, 0x09, 0x6D, 0xF9,
-    0x8F, 0xEE, 0xDF, 0x7E, 0x92, 0xF5, 0x46, 0x08, 0x16, 0x55, 0xDD, 0x18, 0x24, 0xFD, 0x6B, 0x9A,
-    0x5D, 0x1E, 0x9E, 0x0D, 0x7F, 0x75, 0x61, 0xFA, 0x3B, 0x7E, 0x78, 0x39, 0x6D, 0x78, 0x66, 0xEA,
-    0x63, 0xED, 0x3F, 0xC4, 0xC1, 0xC5, 0xA6, 0xB6, 0xFB, 0x06, 0xC7, 0x68, 0xE8, 0x4D, 0x78, 0x9C,
-    0x3D, 0xCF, 0xDB, 0x11, 0x01, 0x31, 0x14, 0xC6, 0xF1, 0xB8, 0x8F, 0xBB, 0x0E, 0xE8, 0x40, 0x09,
-    0xBC, 0x79, 0x54, 0x02, 0x1D, 0xD0, 0x01, 0x05, 0x98, 0xA1, 0x03, 0x3A, 0xA0, 0x04, 0x1D, 0xD0,
-    0x80, 0xA1, 0x83, 0x65, 0x58, 0x3B, 0x6E, 0xFB, 0x77, 0x4E, 0x36, 0x9B, 0xEF, 0x61, 0xB3, 0xBF,
-    0x4C, 0x72, 0x72, 0x8E, 0x31, 0xC6, 0xAC, 0x80, 0x9A, 0x49, 0x73, 0x11, 0x75, 0xBD, 0x1E, 0xA2,
-    0x99, 0xD7, 0x5B, 0x74, 0xF6, 0x92, 0x7F, 0xC8, 0x39, 0x8C, 0x61, 0x01, 0x65, 0xA7, 0x1D, 0x0C,
-    0xA0, 0xE1, 0x74, 0x93, 0x63, 0x31, 0x43, 0xA7, 0x88, 0x40, 0x0A, 0x6D, 0x9D, 0xBE, 0xAC, 0x4D,
-    0x08, 0x09, 0x3A, 0xC8, 0xA9, 0x2B, 0x14, 0xAC, 0xE6, 0xD0, 0xD4, 0x4A, 0x55, 0xAB, 0x23, 0x54,
-    0xF4, 0x95, 0xB6, 0xD5, 0x1D, 0x8A, 0xA6, 0x05, 0x13, 0xAB, 0x17, 0x64, 0xB4, 0xD4, 0xC1, 0x2A,
-    0xB6, 0x6B, 0x04, 0x59, 0x59, 0xFA, 0xA4, 0x29, 0x89, 0x36, 0x5E, 0x75, 0xD1, 0xD5, 0xAB, 0x27,
-    0x0A, 0xBD, 0x96, 0xA2, 0x0F, 0x9C, 0x34, 0x48, 0xB7, 0xFA, 0x50, 0x60, 0x4B, 0xCB, 0x6E, 0x5E,
-    0x9B, 0x48, 0xBA, 0x7F, 0xEA, 0xC0, 0x7B, 0x18, 0xA5, 0x53, 0x36, 0x93, 0x8F, 0xC6, 0x6E, 0x47,
-    0xDA, 0xB3, 0x66, 0xAA, 0x57, 0x7E, 0xE9, 0x60, 0x32, 0x26, 0x99, 0x3F, 0xCB, 0xE0, 0xA7, 0x36,
-    0x78, 0x9C, 0xFB, 0xF9, 0x1F, 0x08, 0xDE, 0xAD, 0x11, 0x63, 0x60, 0x60, 0xF8, 0xF9, 0x1F, 0x02,
-    0xB4, 0x10, 0xCC, 0xFF, 0xCC, 0x08, 0x26, 0x1F, 0x88, 0xB9, 0x67, 0xF7, 0x1F, 0x20, 0x33, 0x1F,
-    0xC4, 0x64, 0x62, 0x60, 0x78, 0xF2, 0xFF, 0xFF, 0x7E, 0x28, 0x33, 0xE0, 0xFF, 0xFF, 0xF3, 0x50,
-    0xA6, 0x00, 0x82, 0xA9, 0x80, 0x50, 0x50, 0xF0, 0xFF, 0x7F, 0x3D, 0x84, 0x69, 0xF0, 0xE3, 0xFF,
-    0x7F, 0x79, 0x84, 0xB9, 0xAC, 0x70, 0xA6, 0x35, 0xDC, 0xE2, 0xF7, 0x96, 0x48, 0x6E, 0xE0, 0x04,
-    0x31, 0x67, 0xCD, 0xDC, 0x09, 0x64, 0xF6, 0x43, 0x0D, 0x6B, 0x00, 0xB2, 0x19, 0x21, 0x4C, 0x86,
-    0xDF, 0x40, 0x23, 0xA0, 0xCC, 0xEF, 0xFF, 0xFF, 0xB3, 0x43, 0x99, 0x40, 0x3B, 0x38, 0xA0, 0xCC,
-    0xBF, 0xFF, 0xFF, 0xB3, 0x41, 0x98, 0x9B, 0x40, 0x3E, 0x02, 0x32, 0xCF, 0x9C, 0x79, 0x03, 0x64,
-    0xDD, 0x47, 0x58, 0xE1, 0x8F, 0xCD, 0x39, 0x36, 0x30, 0x37, 0xEC, 0xB3, 0x00, 0x9A, 0x02, 0x00,
-    0xC2, 0x59, 0xC8, 0x56, 0x78, 0x9C, 0x65, 0x90, 0x31, 0x0A, 0xC2, 0x40, 0x10, 0x45, 0xBF, 0xAE,
-    0x28, 0x2A, 0x48, 0x1A, 0x6B, 0xAF, 0x90, 0x23, 0xE4, 0x1A, 0x9E, 0xC3, 0x03, 0xC4, 0x4B, 0x58,
-    0xEB, 0x0D, 0xB4, 0xB3, 0xF4, 0x04, 0xDA, 0xD8, 0x1A, 0x22, 0x56, 0x16, 0x4A, 0x10, 0x51, 0x62,
-    0x12, 0xFC, 0xCE, 0x64, 0x07, 0x2D, 0x7C, 0xC5, 0xF2, 0x60, 0xF7, 0xEF, 0xF0, 0x07, 0x00, 0x66,
-    0x17, 0xEE, 0xC6, 0x50, 0x72, 0x2A, 0x4B, 0x07, 0xEC, 0xE9, 0xE9, 0x21, 0x32, 0xA3, 0xC3, 0x49,
-    0xCE, 0x2C, 0x21, 0x53, 0xA0, 0x24, 0x37, 0x0E, 0xE1, 0x39, 0xAE, 0xEF, 0x3B, 0x1A, 0x1E, 0x62,
-    0x25, 0x59, 0x78, 0x6E, 0xE4, 0xC8, 0xF4, 0x41, 0xF6, 0x4D, 0x73, 0x7B, 0x2A, 0x14, 0x64, 0xCB,
-    0xB4, 0x22, 0x9B, 0xFF, 0x5A, 0xFE, 0xB4, 0xD0, 0xE1, 0x9E, 0x17, 0xD9, 0x36, 0x7D, 0x92, 0x5D,
-    0xD3, 0x3B, 0x39, 0x30, 0x3D, 0x92, 0xB1, 0xE9, 0x94, 0x36, 0x23, 0x40, 0x20, 0x3A, 0x97, 0xEF,
-    0x26, 0x87, 0x3A, 0xC7, 0x6C, 0xFB, 0xD6, 0x16, 0x0B, 0xAB, 0x96, 0x7E, 0xBB, 0xD7, 0x1A, 0x55,
-    0x7E, 0x0F, 0x9A, 0x0D, 0xD7, 0x57, 0xD9, 0x4E, 0x03, 0x1F, 0x7A, 0xF9, 0x7F, 0x7A, 0x78, 0x9C,
-    0x6D, 0xD0, 0xB1, 0x0D, 0xC2, 0x30, 0x10, 0x05, 0x50, 0xC7, 0x16, 0x20, 0x11, 0x40, 0x59, 0x84,
-    0x55, 0xA0, 0xCD, 0x16, 0xF4, 0x54, 0xD9, 0x28, 0x14, 0x74, 0x30, 0x42, 0x10, 0x1D, 0x25, 0x8C,
-    0x60, 0x85, 0x08, 0xA4, 0x20, 0x25, 0x9F, 0xEF, 0xE0, 0xD3, 0xA5, 0xE0, 0x1A, 0x3F, 0xDB, 0x67,
-    0x9F, 0xCF, 0x2D, 0x18, 0xF7, 0xBD, 0x33, 0x8C, 0x16, 0x43, 0x3C, 0x26, 0x6A, 0x5C, 0xAD, 0x1A,
-    0x9B, 0xC1, 0xE7, 0x53, 0x47, 0x7B, 0x1B, 0xCC, 0xDD, 0x23, 0x27, 0xCB, 0x68, 0xF3, 0x06, 0x76,
-    0xE2, 0x82, 0x49, 0x62, 0xD3, 0x03, 0x4E, 0xCC, 0x71, 0x26, 0x7E, 0x01, 0xA9, 0xF8, 0x09, 0x2C,
-    0xC4, 0x35, 0x2F, 0x1D, 0x79, 0xF5, 0x6F, 0xBD, 0x19, 0x9D, 0x65, 0xE1, 0xB9, 0xF8, 0x03, 0x4C,
-    0xA3, 0x33, 0x3E, 0xCE, 0x46, 0x1F, 0xD8, 0x8D, 0xBC, 0x87, 0x29, 0xDB, 0x9F, 0xB3, 0x1B, 0x53,
-    0xD2, 0xE0, 0xAA, 0xEA, 0x43, 0xF7, 0x89, 0xF6, 0xBB, 0xD6, 0xDE, 0x4B, 0xFD, 0x93, 0xD2, 0x45,
-    0xFB, 0x4B, 0x9E, 0x84, 0x7A, 0x5F, 0xDA, 0x1A, 0xBB, 0x18, 0x78, 0x9C, 0xFB, 0xF9, 0x1F, 0x02,
-    0x18, 0x7E, 0xE2, 0x65, 0xEC, 0xD9, 0x0D, 0x04, 0x20, 0x06, 0x13, 0x03, 0x08, 0x90, 0xCA, 0x00,
-    0x81, 0x78, 0x02, 0x0C, 0x90, 0x15, 0xD6, 0xE4, 0x5B, 0x71, 0x06, 0x04, 0x08, 0xF8, 0x02, 0xC2,
-    0x00, 0x00, 0x52, 0xF1, 0x94, 0x36, 0x78, 0x9C, 0xFB, 0xF9, 0x1F, 0x02, 0x7E, 0xE2, 0xA6, 0x77,
-    0x83, 0x00, 0x90, 0x66, 0x64, 0x00, 0x02, 0x32, 0x68, 0x10, 0xF0, 0xC7, 0x43, 0x83, 0x8C, 0xB7,
-    0xA6, 0xC0, 0x7C, 0xAC, 0x34, 0x00, 0xBE, 0x1C, 0x7C, 0x05, 0x78, 0x9C, 0x4D, 0xCF, 0x31, 0x0A,
-    0xC2, 0x30, 0x14, 0x06, 0xE0, 0xBF, 0x2D, 0x5A, 0x11, 0x94, 0xDE, 0xC0, 0x1E, 0xA1, 0xB3, 0x83,
-    0xB8, 0x39, 0x8A, 0xA3, 0xA7, 0xD0, 0x23, 0x78, 0x04, 0x6F, 0xE0, 0x20, 0x38, 0x09, 0xF5, 0x04,
-    0xEA, 0x2A, 0x54, 0x70, 0x73, 0x11, 0x3C, 0x81, 0x28, 0x5A, 0x8A, 0xB6, 0xD6, 0xDF, 0xBC, 0x36,
-    0x81, 0x3E, 0x08, 0xF9, 0x48, 0xDE, 0xFB, 0x43, 0x00, 0x60, 0x74, 0xC8, 0xB9, 0x1D, 0x5B, 0x4A,
-    0x58, 0xB2, 0xA8, 0xD0, 0x06, 0xE6, 0xD4, 0x65, 0xC1, 0xCB, 0x35, 0x43, 0x60, 0x2F, 0xFB, 0xF5,
-    0x42, 0x0E, 0x81, 0x54, 0xB1, 0x0B, 0xF8, 0xE7, 0x16, 0x02, 0xC5, 0x9E, 0x24, 0xC0, 0xC2, 0x46,
-    0xD9, 0x46, 0x59, 0x0F, 0x72, 0xA2, 0x89, 0x98, 0x6C, 0x1B, 0xBF, 0xC9, 0x86, 0xB1, 0x8A, 0xA9,
-    0x19, 0x67, 0xA4, 0x83, 0x7E, 0xF1, 0x98, 0xFB, 0x95, 0x18, 0xED, 0xAC, 0xE2, 0xB4, 0xD2, 0xF3,
-    0x21, 0xEB, 0x08, 0xA2, 0x48, 0xF5, 0xBA, 0x09, 0xD9, 0x94, 0x8C, 0xA7, 0xB2, 0x5A, 0x1D, 0xE3,
-    0x13, 0xB9, 0x30, 0x9E, 0xCA, 0x90, 0xB6, 0xF7, 0x23, 0x77, 0x0E, 0xF0, 0x92, 0xA3, 0x58, 0xE2,
-    0x8E, 0x79, 0x71, 0x3D, 0x33, 0x5F, 0x97, 0xD6, 0xA4, 0x62, 0x3F, 0x2D, 0x29, 0x53, 0xF0, 0x57,
-    0x37, 0xDE, 0xD7, 0x03, 0xE0, 0x0F, 0x36, 0x9C, 0xAF, 0x0E, 0x78, 0x9C, 0xFB, 0xF9, 0xFF, 0x3F,
-    0x13, 0x03, 0x10, 0x7C, 0xFC, 0xFF, 0x9F, 0xEB, 0xE7, 0xC0, 0xB1, 0x61, 0x80, 0x58, 0xF6, 0xD9,
-    0x33, 0x40, 0xF0, 0x67, 0x60, 0xDD, 0x0C, 0x67, 0x03, 0x00, 0xAD, 0xB0, 0xB8, 0xA9, 0x78, 0x9C,
-    0xFB, 0xF9, 0xFF, 0x3F, 0xD3, 0x4F, 0x3A, 0x61, 0x00, 0x3E, 0xC2, 0x50, 0x44, 0x78, 0x9C, 0xD5,
-    0xCA, 0xA1, 0x0D, 0x80, 0x30, 0x14, 0x00, 0xD1, 0xFB, 0x58, 0x56, 0x40, 0xB0, 0x09, 0x9A, 0x29,
-    0xD9, 0xA9, 0xAA, 0x0A, 0x26, 0x20, 0x68, 0x08, 0xCD, 0xF1, 0xD3, 0x2D, 0x30, 0xF7, 0xCC, 0x01,
-    0xB7, 0x0E, 0xFC, 0x8E, 0x47, 0x23, 0x79, 0x35, 0x3B, 0xEB, 0x41, 0x50, 0x74, 0xA3, 0x9D, 0xEA,
-    0x42, 0xCB, 0x3A, 0x76, 0xAE, 0xE8, 0x4C, 0x50, 0xDD, 0xD7, 0xDC, 0x3F, 0x7D, 0x53, 0x6F, 0xD3,
-    0x78, 0x9C, 0x4D, 0xD0, 0xDD, 0x09, 0xC2, 0x30, 0x18, 0x85, 0xE1, 0x4F, 0xED, 0x8D, 0x8A, 0x8E,
-    0xA0, 0x1B, 0x88, 0x23, 0xB8, 0x81, 0x6E, 0x62, 0x37, 0x28, 0x38, 0x41, 0x37, 0x70, 0x04, 0x47,
-    0x70, 0x04, 0xDD, 0x40, 0x9C, 0x40, 0xB0, 0x20, 0xB4, 0xFE, 0xBC, 0xA6, 0xC9, 0xF9, 0x20, 0xB9,
-    0x7A, 0x6E, 0x5E, 0x92, 0x93, 0x16, 0x86, 0x66, 0x56, 0xC3, 0xD9, 0xDA, 0xE4, 0x17, 0x2C, 0xE4,
-    0x35, 0x30, 0x92, 0xEF, 0xB0, 0x37, 0xF9, 0x03, 0x63, 0x39, 0x94, 0x17, 0x93, 0x63, 0x99, 0x9C,
-    0xCA, 0xE4, 0x50, 0x56, 0x26, 0x87, 0x72, 0x22, 0x1F, 0xE0, 0x66, 0x72, 0x28, 0x57, 0xEE, 0x70,
-    0x96, 0x99, 0x4F, 0x99, 0x29, 0xDC, 0x3F, 0x98, 0xCB, 0xD5, 0x15, 0x8E, 0x72, 0xB1, 0xC9, 0xEE,
-    0xB5, 0x0E, 0x66, 0x6E, 0x3D, 0x22, 0x7A, 0x47, 0x5C, 0x91, 0xB6, 0xBC, 0x61, 0xEA, 0x7E, 0x66,
-    0x1B, 0x4B, 0x78, 0x0C, 0xFC, 0x4F, 0xBE, 0xFD, 0xB3, 0xE5, 0x06, 0xB6, 0xEE, 0xBA, 0xDF, 0xF0,
-    0x07, 0x75, 0x9A, 0xA9, 0xBC, 0x78, 0x9C, 0xFB, 0xF9, 0xFF, 0x3F, 0x13, 0x03, 0x08, 0xFC, 0x1C,
-    0xE2, 0x8C, 0x33, 0x20, 0xA0, 0x03, 0x64, 0x80, 0x81, 0x3E, 0x1E, 0x06, 0x00, 0x3F, 0x17, 0x69,
-    0x0A, 0x78, 0x9C, 0x45, 0xD0, 0xD1, 0x0D, 0x82, 0x30, 0x10, 0xC6, 0xF1, 0xC6, 0xA0, 0x46, 0x34,
-    0xE0, 0x06, 0xAE, 0xC0, 0x06, 0xBA, 0x81, 0x23, 0xE0, 0x06, 0x8C, 0x20, 0x1B, 0xD4, 0x0D, 0x1C,
-    0x01, 0x37, 0x70, 0x05, 0x5E, 0x7C, 0xC6, 0x0D, 0x34, 0x18, 0x83, 0x68, 0xE1, 0xF3, 0xEE, 0xCA,
-    0x29, 0x0F, 0x0D, 0xBF, 0x92, 0xFC, 0x5B, 0xAE, 0x05, 0x30, 0x31, 0xFC, 0x1C, 0xE8, 0x2D, 0x6B,
-    0x69, 0x99, 0x0B, 0xAF, 0xCA, 0x58, 0xF8, 0x50, 0xA6, 0xC2, 0x56, 0x59, 0x08, 0x7B, 0x25, 0x58,
-    0x09, 0x3C, 0x0B, 0x20, 0x90, 0xF0, 0xED, 0xC3, 0xCC, 0x80, 0x99, 0x84, 0x8F, 0xC2, 0xD4, 0x21,
-    0x92, 0xF0, 0xD6, 0xC9, 0xD7, 0x06, 0x6B, 0xE2, 0x0B, 0x51, 0x27, 0xAC, 0x61, 0x25, 0x1C, 0x0A,
-    0xF7, 0x25, 0x2A, 0x09, 0x07, 0x3D, 0xD3, 0xD2, 0x65, 0x47, 0x26, 0xA7, 0xE3, 0x3C, 0x37, 0xC0,
-    0xD4, 0x94, 0x74, 0x19, 0x39, 0xD7, 0xD2, 0xEE, 0x82, 0xC3, 0xCA, 0x37, 0x56, 0x14, 0x8E, 0x95,
-    0x4F, 0x64, 0xA6, 0x43, 0xA8, 0xBC, 0xE3, 0x4C, 0xE1, 0xB1, 0xF2, 0x04, 0x70, 0x58, 0xB9, 0x03,
-    0x2E, 0xFC, 0x97, 0x03, 0x97, 0x80, 0xE3, 0x19, 0x0C, 0x34, 0xCE, 0x4F, 0x48, 0xD9, 0x10, 0xC3,
-    0x3F, 0x6B, 0x70, 0xF8, 0xC7, 0xD2, 0x0F, 0x48, 0x99, 0xFB, 0xF1, 0x29, 0x13, 0x3F, 0x5C, 0xE2,
-    0x17, 0x4F, 0xD3, 0xF5, 0xDF, 0x78, 0x9C, 0x4D, 0xCF, 0xD1, 0x09, 0xC2, 0x50, 0x0C, 0x40, 0xD1,
-    0x28, 0x8A, 0x8A, 0x28, 0xDD, 0xC4, 0x11, 0x74, 0x03, 0xDD, 0xC0, 0x11, 0x1C, 0xA1, 0xFE, 0xF9,
-    0x69, 0x47, 0xE8, 0x08, 0x6E, 0xE0, 0x08, 0x76, 0x03, 0xDD, 0xA0, 0x50, 0x41, 0x2D, 0x8A, 0xD7,
-    0x3C, 0x68, 0x62, 0xDE, 0x47, 0xE0, 0x90, 0x70, 0xE1, 0xB5, 0x50, 0x4B, 0x7A, 0x27, 0x18, 0xB5,
-    0xC0, 0x38, 0x62, 0x11, 0x71, 0x8E, 0x60, 0x10, 0x31, 0x73, 0xD4, 0x90, 0x3B, 0x76, 0xBA, 0xEA,
-    0x19, 0xB6, 0x2F, 0x98, 0x38, 0x6E, 0xB0, 0xF4, 0xB3, 0x0D, 0x5C, 0x0C, 0xB9, 0x7C, 0x60, 0xD8,
-    0xE1, 0x28, 0x77, 0x98, 0x3B, 0x4A, 0x74, 0x18, 0x32, 0x8D, 0xF7, 0xCB, 0x0E, 0xF2, 0x84, 0xA9,
-    0xA3, 0x82, 0x75, 0x61, 0xD0, 0xF8, 0x75, 0x6F, 0x90, 0x37, 0x1C, 0x1C, 0x8D, 0xF6, 0x1C, 0x45,
-    0xFA, 0x88, 0x21, 0xFB, 0x06, 0xC8, 0x23, 0xA2, 0x8A, 0x58, 0x45, 0xA4, 0xF8, 0x1F, 0x4D, 0xC2,
-    0x0F, 0x8A, 0x70, 0xCF, 0xAF, 0x78, 0x9C, 0x5D, 0x50, 0xC9, 0x0D, 0xC2, 0x40, 0x0C, 0x1C, 0x91,
-    0x20, 0x10, 0xF0, 0x48, 0x07, 0xA4, 0x04, 0x4A, 0x48, 0x27, 0xE4, 0xCD, 0x07, 0x3A, 0x80, 0x0E,
-    0x78, 0xF1, 0xA6, 0x04, 0x4A, 0xA0, 0x04, 0x68, 0x80, 0xA4, 0x01, 0x24, 0x24, 0x2E, 0x71, 0x29,
-    0x83, 0xED, 0x4D, 0x60, 0x93, 0x79, 0x58, 0x3B, 0xF6, 0xFA, 0x98, 0x01, 0x10, 0xAD, 0x8E, 0xCC,
-    0x26, 0x2D, 0x18, 0xA2, 0x27, 0x15, 0xDB, 0xC0, 0xD8, 0x8D, 0x0E, 0x4B, 0x25, 0x33, 0x56, 0xE8,
-    0x09, 0xBB, 0xEA, 0xE3, 0x50, 0x48, 0x98, 0x0B, 0x2B, 0xAC, 0x25, 0x7E, 0x08, 0x0D, 0x90, 0x4A,
-    0xEC, 0x48, 0x72, 0x64, 0x5F, 0xF7, 0xE4, 0xC6, 0x86, 0xDD, 0xC9, 0x21, 0xCE, 0x1A, 0x14, 0x92,
-    0x9E, 0x6A, 0xAA, 0x6F, 0x6C, 0x41, 0xAE, 0x21, 0xAB, 0xBB, 0xC6, 0x12, 0x32, 0xC7, 0x8B, 0x6C,
-    0xBB, 0x93, 0xC8, 0x13, 0xDE, 0x64, 0xE8, 0x2E, 0x94, 0xA1, 0xF8, 0xE8, 0x9A, 0x1F, 0xAB, 0xD7,
-    0xEA, 0x7D, 0xFE, 0xCC, 0x9D, 0xEA, 0x19, 0xFC, 0xF7, 0xF9, 0xB7, 0x8C, 0x1B, 0x77, 0x56, 0x1A,
-    0x12, 0x27, 0x57, 0xF5, 0x85, 0x88, 0xD5, 0x1C, 0x31, 0xEA, 0xA2, 0xDA, 0x33, 0x96, 0xDA, 0xD3,
-    0x9A, 0x2F, 0xCE, 0x98, 0xB2, 0xD4, 0xF4, 0xD3, 0xF7, 0xFA, 0x0B, 0x90, 0x2D, 0xBA, 0x68, 0x78,
-    0x9C, 0xFB, 0xF9, 0x1F, 0x08, 0xEE, 0x55, 0x31, 0x32, 0x30, 0xFC, 0xFC, 0x0F, 0x06, 0xF3, 0x19,
-    0x61, 0xAC, 0xFF, 0x72, 0x70, 0xD6, 0x7D, 0x10, 0x6B, 0xCF, 0xE9, 0x7F, 0x40, 0x26, 0x1B, 0x90,
-    0xC5, 0xC4, 0x60, 0xF0, 0xF7, 0xFF, 0x7F, 0x1E, 0x30, 0x8B, 0xE1, 0xE3, 0xFF, 0xFF, 0xFC, 0x10,
-    0xD6, 0x81, 0xFF, 0xFF, 0xE5, 0x21, 0xAC, 0x05, 0xFF, 0xFF, 0xEB, 0xC3, 0xC5, 0xA0, 0xB2, 0x5F,
-    0xFE, 0xFF, 0xE7, 0x03, 0xB3, 0x12, 0x80, 0xA6, 0x70, 0x82, 0xCC, 0xBB, 0x0D, 0x32, 0x9A, 0x19,
-    0x66, 0xC7, 0x7C, 0xB8, 0x6D, 0x5C, 0x30, 0x56, 0x1C, 0xD4, 0x55, 0xE7, 0x3C, 0x19, 0xC0, 0x2C,
-    0xA0, 0x29, 0x0C, 0x34, 0x65, 0x01, 0x00, 0x82, 0x84, 0x95, 0x54, 0x78, 0x9C, 0x5D, 0x50, 0xC9,
-    0x0D, 0xC2, 0x40, 0x0C, 0x34, 0x24, 0x08, 0x44, 0x40, 0x4A, 0x07, 0xA4, 0x04, 0x4A, 0x48, 0x29,
-    0x79, 0xF3, 0x81, 0x0E, 0xA0, 0x03, 0x5E, 0xBC, 0x29, 0x21, 0x74, 0x40, 0x09, 0xA1, 0x01, 0x42,
-    0x03, 0x48, 0x48, 0x5C, 0x0A, 0x57, 0x06, 0xDB, 0x8B, 0x03, 0x61, 0x1E, 0xD6, 0x8E, 0x77, 0x77,
-    0xEC, 0x19, 0x22, 0x0A, 0x17, 0x7B, 0xE4, 0xA3, 0x26, 0x29, 0xC2, 0x1B, 0x04, 0x6B, 0x4F, 0xD9,
-    0x05, 0x0E, 0x73, 0x21, 0x13, 0x18, 0xBA, 0xCC, 0xCE, 0x72, 0xD8, 0x96, 0x5C, 0xA6, 0xCC, 0x4A,
-    0xFD, 0x12, 0x15, 0x4C, 0x3D, 0x4A, 0xB8, 0xB6, 0xB9, 0x39, 0xD4, 0xA7, 0x1B, 0x20, 0x55, 0xB1,
-    0x2B, 0x30, 0xA0, 0xA3, 0x14, 0x01, 0xB7, 0xC7, 0xD2, 0x0A, 0x94, 0xCD, 0x80, 0x25, 0xF1, 0xE8,
-    0x8E, 0xB2, 0x18, 0xD8, 0xD1, 0x1D, 0x68, 0xB9, 0x95, 0x80, 0x03, 0x3D, 0x00, 0xDF, 0x6D, 0xC8,
-    0xA2, 0xF4, 0x94, 0x31, 0x15, 0xAB, 0xDF, 0xD5, 0xFF, 0xFD, 0x6A, 0x66, 0xE2, 0xA7, 0x67, 0xF3,
-    0xD2, 0xBF, 0x5D, 0xEA, 0x7B, 0x9A, 0x87, 0xD8, 0xD9, 0x15, 0x7F, 0x3E, 0x45, 0x12, 0x0E, 0x07,
-    0x75, 0x12, 0xEF, 0xB9, 0x05, 0x93, 0xD4, 0x72, 0x71, 0xC1, 0x58, 0x66, 0x96, 0x67, 0xF6, 0x59,
-    0x57, 0xB2, 0x66, 0x73, 0x0D, 0x32, 0x44, 0xAC, 0xDC, 0xAF, 0x98, 0x28, 0x67, 0x5F, 0x26, 0xCA,
-    0xC1, 0x97, 0x16, 0x12, 0x52, 0x85, 0x15, 0xCC, 0x9A, 0xE2, 0x25, 0x1E, 0xDE, 0xB9, 0x51, 0xD1,
-    0x51, 0x78, 0x9C, 0xFB, 0xF9, 0x1F, 0x08, 0xCE, 0x45, 0x32, 0x80, 0xC0, 0xCF, 0xFF, 0x60, 0x30,
-    0x9F, 0x11, 0xC1, 0xFE, 0xAF, 0x8B, 0xC4, 0xBE, 0x0F, 0x61, 0xEF, 0x39, 0x0D, 0xE2, 0xB0, 0x81,
-    0xD9, 0x4C, 0x0C, 0x0E, 0x7F, 0xFF, 0xFF, 0xE7, 0x81, 0xB2, 0x19, 0x3E, 0xFE, 0xFF, 0xCF, 0x0F,
-    0x63, 0x6F, 0xF8, 0xFF, 0x5F, 0x1E, 0xC6, 0x5E, 0xF0, 0xFF, 0xBF, 0x3E, 0x8C, 0x7D, 0x01, 0x49,
-    0xCD, 0x37, 0xB8, 0x5E, 0x81, 0x29, 0x40, 0x33, 0x59, 0x11, 0x76, 0xAD, 0x47, 0xB2, 0x97, 0x1B,
-    0xC1, 0xEE, 0x47, 0x72, 0x27, 0x2B, 0x94, 0xBD, 0xFA, 0xD5, 0xFF, 0xFF, 0x7C, 0x50, 0x36, 0x93,
-    0x03, 0xD0, 0xFD, 0x30, 0x36, 0x88, 0x60, 0x81, 0xB1, 0x1F, 0xFE, 0xFF, 0x2F, 0x07, 0x63, 0x07,
-    0xC0, 0xCD, 0x07, 0xBA, 0xE1, 0x37, 0xCC, 0x5E, 0x20, 0xFB, 0x13, 0x58, 0x11, 0x84, 0x5D, 0x00,
-    0x56, 0x04, 0x61, 0x33, 0xFC, 0x05, 0x29, 0x82, 0xB2, 0x3F, 0x83, 0x14, 0x41, 0xD9, 0x13, 0xFE,
-    0xFF, 0xDF, 0xCF, 0x00, 0x00, 0x03, 0xE9, 0xB3, 0x12, 0x78, 0x9C, 0x3D, 0x8E, 0x31, 0x0A, 0xC2,
-    0x50, 0x10, 0x44, 0x27, 0x31, 0x8A, 0xA0, 0x88, 0x27, 0x10, 0x2B, 0x2D, 0x2C, 0xB4, 0xB4, 0xD3,
-    0x23, 0x24, 0x27, 0xD0, 0x03, 0x08, 0x1E, 0x49, 0x25, 0xB5, 0x58, 0x5A, 0x89, 0x58, 0x5A, 0xA9,
-    0xBD, 0x10, 0x0F, 0x20, 0xA4, 0x09, 0x22, 0x51, 0xFE, 0xB8, 0x7F, 0x17, 0x9C, 0xE2, 0xF3, 0x76,
-    0x98, 0xD9, 0xFD, 0x40, 0x77, 0xEF, 0xF2, 0x6D, 0x0F, 0x40, 0xBB, 0xA4, 0xD7, 0x02, 0xB8, 0xD1,
-    0x14, 0xE0, 0x6B, 0xB0, 0x43, 0x2C, 0x6F, 0xF6, 0x24, 0x27, 0x58, 0xCB, 0x18, 0x20, 0x29, 0x9B,
-    0xB8, 0x92, 0x2D, 0xE9, 0x21, 0xC4, 0x83, 0x6C, 0x40, 0x25, 0x5E, 0xC7, 0x48, 0x72, 0x97, 0x50,
-    0x69, 0x2A, 0xDD, 0x55, 0xA0, 0xF8, 0xF1, 0xCB, 0xD4, 0x3D, 0xE9, 0x5E, 0x75, 0xF5, 0xEE, 0x52,
-    0x93, 0x7A, 0xAF, 0xAE, 0xE8, 0xA3, 0x33, 0x2D, 0x8D, 0x04, 0x73, 0x5B, 0x3A, 0x17, 0xB3, 0x62,
-    0xF8, 0x26, 0xAB, 0x46, 0x05, 0x59, 0x4B, 0x23, 0x4F, 0x2F, 0x32, 0x2A, 0xB2, 0x31, 0x10, 0x3B,
-    0xF9, 0xBD, 0xF8, 0xD9, 0x5D, 0xE0, 0xE8, 0x13, 0xAA, 0xE1, 0x9F, 0x22, 0x6C, 0x0C, 0x06, 0x52,
-    0x4B, 0xCE, 0x8E, 0x87, 0xBE, 0xC0, 0x0F, 0x02, 0x74, 0x88, 0x5C, 0x78, 0x9C, 0xFB, 0xFC, 0x1F,
-    0x06, 0xFC, 0x3F, 0x13, 0x62, 0x1E, 0x3A, 0x73, 0xE6, 0x0C, 0x90, 0x06, 0x92, 0x36, 0x0C, 0x40,
-    0xF0, 0xEF, 0xFF, 0x7B, 0x06, 0x28, 0x18, 0x01, 0x4C, 0x00, 0x17, 0x30, 0x71, 0xF0, 0x78, 0x9C,
-    0xFB, 0xF3, 0xFF, 0x3F, 0x03, 0x08, 0x7C, 0xFE, 0xFF, 0x9F, 0xE3, 0xCF, 0x10, 0x66, 0x7F, 0x01,
-    0xB2, 0x7F, 0x43, 0xD9, 0x5F, 0xFF, 0xFF, 0x67, 0xFF, 0xF5, 0xFF, 0x3F, 0x33, 0x88, 0xFD, 0xFD,
-    0xFF, 0x7F, 0xB6, 0x1F, 0x40, 0x39, 0x10, 0x1B, 0xA8, 0x96, 0x05, 0xA8, 0x4E, 0x1F, 0xC8, 0x4C,
-    0xF8, 0x0F, 0x54, 0xFB, 0xE0, 0xFF, 0xFF, 0xF7, 0xAC, 0x0C, 0x02, 0x40, 0xE9, 0xF9, 0x0C, 0x01,
-    0x40, 0x81, 0xFF, 0xF7, 0xFE, 0x01, 0x09, 0x79, 0x06, 0x86, 0x5F, 0xFF, 0xA1, 0x80, 0x95, 0x81,
-    0x61, 0x01, 0x94, 0x19, 0x0F, 0x32, 0xE1, 0x2A, 0x98, 0xB9, 0x9E, 0x09, 0x6C, 0x4D, 0xCB, 0x9B,
-    0xFF, 0xF7, 0xAB, 0x18, 0x81, 0x0C, 0x00, 0x55, 0xFE, 0xA9, 0x7C, 0x78, 0x9C, 0x3D, 0x90, 0xEB,
-    0x55, 0xC2, 0x40, 0x10, 0x46, 0x27, 0xC6, 0xF7, 0xBB, 0x03, 0xEC, 0x40, 0x3B, 0xA0, 0x05, 0x3A,
-    0x08, 0x1D, 0x48, 0x07, 0xD8, 0x01, 0x25, 0x40, 0x07, 0xD8, 0x81, 0x74, 0x20, 0x1D, 0xC4, 0x12,
-    0x34, 0x0A, 0x51, 0x92, 0x70, 0xF9, 0x66, 0x92, 0x38, 0x3F, 0xF6, 0xEC, 0x9D, 0xC7, 0x3D, 0x3B,
-    0xDB, 0x80, 0x45, 0xFC, 0xC0, 0x79, 0x09, 0xC7, 0x01, 0x7F, 0x90, 0x16, 0x70, 0x11, 0xB0, 0x27,
-    0xB7, 0x15, 0xDC, 0xFA, 0xFD, 0x09, 0x66, 0x36, 0x81, 0xA1, 0xC3, 0x0B, 0x3C, 0xDA, 0x83, 0x67,
-    0x14, 0x6B, 0xB8, 0x31, 0xAB, 0xD5, 0xAB, 0xF8, 0x86, 0x33, 0x33, 0xE9, 0x52, 0xC1, 0x2F, 0x1C,
-    0x99, 0x7D, 0xC9, 0x2F, 0x68, 0x78, 0xD7, 0xB9, 0x8A, 0x66, 0x8D, 0x4E, 0x05, 0x63, 0xD7, 0xB8,
-    0x74, 0x20, 0xB8, 0x8F, 0x9C, 0xEA, 0xD7, 0xEE, 0xA9, 0xBC, 0x5B, 0x93, 0xA7, 0x0E, 0x5B, 0x48,
-    0xDC, 0x99, 0x38, 0x44, 0xB2, 0xE6, 0x2D, 0x5E, 0xF8, 0x0A, 0x57, 0x1A, 0x7C, 0x0E, 0x90, 0xEE,
-    0x6E, 0xD4, 0xCA, 0x42, 0x97, 0x2D, 0x54, 0x6D, 0x77, 0xAC, 0x98, 0x7F, 0xC0, 0x49, 0x0B, 0x1B,
-    0xF2, 0xA2, 0x5F, 0xDE, 0x3E, 0xA1, 0xEC, 0x64, 0x66, 0x1A, 0x68, 0xC8, 0x3A, 0x90, 0x4A, 0xC2,
-    0x0E, 0xCC, 0xE1, 0xB2, 0x87, 0x1D, 0xFF, 0xB2, 0xF8, 0xBF, 0x5E, 0x16, 0xBA, 0x65, 0x5C, 0x0E,
-    0x5E, 0x76, 0x8D, 0xCA, 0x78, 0x9C, 0x2D, 0x91, 0xDB, 0x59, 0x02, 0x41, 0x0C, 0x85, 0x8F, 0x17,
-    0x54, 0x3E, 0x05, 0xE9, 0x00, 0x3B, 0xC0, 0x0E, 0xB0, 0x03, 0xE8, 0x00, 0x3B, 0xC0, 0x0E, 0xA4,
-    0x03, 0xEC, 0xC0, 0xED, 0x00, 0x3A, 0x80, 0x0E, 0xA0, 0x03, 0xB6, 0x83, 0x05, 0x64, 0xC5, 0x05,
-    0xE1, 0x37, 0xC9, 0x98, 0x97, 0x64, 0x26, 0x33, 0x39, 0x97, 0x9C, 0x58, 0xC8, 0xE2, 0x0D, 0xBA,
-    0x9E, 0xD7, 0x50, 0xAF, 0xC0, 0xCB, 0x29, 0xBC, 0x7B, 0xDE, 0x41, 0xAD, 0x84, 0xAB, 0xD4, 0x9D,
-    0xF9, 0xD5, 0x0F, 0x5C, 0x6C, 0xE0, 0x36, 0x75, 0xE3, 0xF5, 0x91, 0x95, 0x96, 0x70, 0x9F, 0xBA,
-    0x5C, 0x5B, 0x86, 0x4F, 0x7D, 0xC0, 0xA3, 0x95, 0xBF, 0x76, 0x75, 0x27, 0x3D, 0xC3, 0x40, 0xFD,
-    0x04, 0x65, 0x37, 0x3C, 0x04, 0x70, 0x5B, 0x2D, 0x18, 0x4A, 0x2F, 0x70, 0xB4, 0x83, 0x32, 0x68,
-    0x48, 0x27, 0x26, 0xD2, 0x08, 0x4A, 0xFB, 0xA2, 0xDC, 0x68, 0x49, 0x15, 0x85, 0x0C, 0x64, 0xB5,
-    0xB5, 0xC1, 0xDA, 0x06, 0x88, 0xC1, 0x5F, 0x6A, 0xC3, 0x24, 0x37, 0x78, 0x7D, 0x1B, 0x2D, 0xD9,
-    0x89, 0x1B, 0x95, 0x0C, 0xA7, 0x7E, 0xAA, 0x42, 0xDE, 0xDC, 0xBF, 0x57, 0x74, 0x0D, 0xAC, 0x66,
-    0x83, 0xC7, 0x8A, 0xC9, 0x0D, 0x2B, 0x9B, 0x46, 0xA9, 0x6E, 0xF0, 0x3D, 0x05, 0x7E, 0xBB, 0xE5,
-    0x12, 0xA0, 0xD9, 0x4F, 0xBC, 0xAD, 0xEC, 0xBD, 0xFA, 0xBC, 0x23, 0x9D, 0x51, 0xF0, 0x75, 0x2D,
-    0xE3, 0xCC, 0x51, 0xF7, 0x0C, 0xE6, 0xA1, 0xCA, 0x15, 0xCF, 0x96, 0xCE, 0xCD, 0x88, 0xAD, 0x93,
-    0x76, 0x23, 0x56, 0xAC, 0x5D, 0x41, 0xCE, 0x62, 0x9B, 0x1C, 0x72, 0xF7, 0x76, 0xAE, 0x33, 0xA3,
-    0x28, 0x93, 0xEB, 0xEE, 0xF1, 0x81, 0x8E, 0x64, 0x18, 0x55, 0xD0, 0x0A, 0x43, 0xCE, 0x34, 0xA5,
-    0x27, 0xCF, 0xB1, 0x13, 0xB7, 0x2D, 0xF4, 0xEB, 0xCC, 0x3F, 0xAD, 0x64, 0x5F, 0xCD, 0xF2, 0x81,
-    0x64, 0x7A, 0xAC, 0x20, 0xF4, 0x9B, 0xF6, 0xB4, 0x1A, 0x8B, 0x3D, 0xEE, 0x4B, 0x78, 0x12, 0x0B,
-    0xB4, 0xF8, 0xF2, 0xB5, 0xC8, 0x7D, 0x4C, 0xB4, 0xFE, 0x00, 0xE1, 0xBC, 0x00, 0x05, 0x78, 0x9C,
-    0x3D, 0x90, 0xE9, 0x11, 0x01, 0x41, 0x10, 0x46, 0x5B, 0xAD, 0xA3, 0x9C, 0x25, 0x02, 0x64, 0x20,
-    0x04, 0x21, 0x48, 0x41, 0x06, 0x64, 0x80, 0x08, 0x6C, 0x06, 0x64, 0xB0, 0x21, 0x90, 0x81, 0x10,
-    0x94, 0x08, 0x54, 0x59, 0x94, 0xFB, 0xE9, 0xDE, 0x9E, 0xD1, 0xBF, 0xFA, 0xCD, 0x7C, 0x7D, 0x7D,
-    0x67, 0x18, 0x89, 0xC5, 0x1B, 0xAA, 0x33, 0xD8, 0x5B, 0x3E, 0x81, 0xAD, 0xBF, 0x28, 0x1C, 0x61,
-    0x28, 0x72, 0x86, 0xBE, 0xC2, 0x03, 0x6A, 0x22, 0x0B, 0xC8, 0x44, 0x06, 0x70, 0x30, 0xF5, 0x07,
-    0x12, 0xD9, 0x85, 0x3E, 0x39, 0xB4, 0xE5, 0x0A, 0x75, 0x83, 0x14, 0xE6, 0xF2, 0xE5, 0x54, 0x0C,
-    0xD0, 0x84, 0x25, 0x8C, 0x1D, 0x2E, 0xF0, 0x82, 0x86, 0xC3, 0x06, 0x8D, 0x53, 0xC9, 0xA1, 0xAB,
-    0x3A, 0xA6, 0x12, 0x42, 0x5B, 0xD1, 0x8C, 0xA0, 0x45, 0x54, 0x22, 0xE8, 0x58, 0x3A, 0x21, 0x4F,
-    0xAD, 0xC1, 0x3A, 0x40, 0x6E, 0x40, 0xF9, 0xAF, 0xCA, 0xA3, 0x4E, 0xD7, 0x9E, 0xCE, 0xA2, 0x4E,
-    0x0F, 0x6A, 0xD9, 0x6F, 0x39, 0x1C, 0x9F, 0x58, 0x5D, 0x4F, 0x73, 0x55, 0xAC, 0x8A, 0x8E, 0x99,
-    0xAB, 0x3A, 0xBE, 0x92, 0xCE, 0x7D, 0xF9, 0xF4, 0x9B, 0xE9, 0xDC, 0x22, 0xB1, 0xBB, 0x33, 0xB3,
-    0xC8, 0xCC, 0x31, 0x47, 0xA8, 0x3C, 0x0B, 0x8B, 0x34, 0xEE, 0xAA, 0xFB, 0x01, 0x47, 0x0C, 0x9A,
-    0xAB, 0x78, 0x9C, 0xBD, 0x8E, 0x59, 0x0D, 0x02, 0x41, 0x10, 0x44, 0x6B, 0x49, 0x08, 0x24, 0x1C,
-    0x16, 0x40, 0x02, 0x12, 0x70, 0xC0, 0x3A, 0x02, 0x07, 0x58, 0xC0, 0x01, 0x48, 0x58, 0x07, 0xE0,
-    0x84, 0x9B, 0x84, 0xF3, 0x51, 0xD3, 0x33, 0x58, 0xA0, 0x7E, 0xBA, 0x3A, 0xA9, 0xEA, 0x7E, 0x4F,
-    0xE8, 0xC8, 0xDA, 0xC0, 0xFC, 0x0C, 0xC3, 0xE4, 0x3D, 0x07, 0x2B, 0xEF, 0xC9, 0xBF, 0xA0, 0x3D,
-    0x06, 0x2A, 0x69, 0x0A, 0x5B, 0xE9, 0x0E, 0x5D, 0xA9, 0x81, 0x99, 0x74, 0x84, 0x91, 0x74, 0x81,
-    0x9E, 0xB4, 0x80, 0x65, 0xC4, 0x5B, 0x6E, 0x7D, 0x5C, 0x70, 0x7C, 0x9D, 0x2E, 0xDC, 0x5C, 0x68,
-    0x22, 0x28, 0xED, 0x3C, 0xAF, 0x71, 0x40, 0xAA, 0x5D, 0x78, 0xB3, 0xAF, 0x54, 0xDE, 0x94, 0x87,
-    0x71, 0xAF, 0x80, 0x04, 0x96, 0x01, 0xB2, 0x9F, 0x10, 0x00, 0x59, 0x8F, 0x00, 0xC8, 0x3A, 0x41,
-    0xFF, 0xE7, 0x0F, 0x01, 0xF3, 0x5F, 0xFF, 0x05, 0xFF, 0x96, 0x79, 0x25, 0x78, 0x9C, 0x85, 0xCF,
-    0xD1, 0x09, 0x82, 0x60, 0x14, 0xC5, 0x71, 0x2D, 0x31, 0xA2, 0x1E, 0x1A, 0x20, 0xAC, 0x0D, 0x6C,
-    0x03, 0x47, 0xC8, 0x4D, 0x6A, 0x83, 0x1C, 0xA1, 0x4D, 0x72, 0x84, 0x06, 0x08, 0x1A, 0x21, 0x9D,
-    0x20, 0x8A, 0x90, 0x28, 0xEC, 0xDF, 0xC5, 0x73, 0xEB, 0xD5, 0xF3, 0xF4, 0xE3, 0xDC, 0xEF, 0xC2,
-    0x77, 0x4B, 0x7E, 0x99, 0x96, 0x3D, 0x9C, 0x14, 0xA7, 0x2E, 0xC6, 0x61, 0xD0, 0x65, 0x0F, 0x3B,
-    0x29, 0x78, 0xD8, 0x53, 0x69, 0xF6, 0x81, 0x81, 0x68, 0xBB, 0x1B, 0x9F, 0x37, 0xB6, 0x2F, 0x2D,
-    0xE1, 0x1A, 0x8A, 0x47, 0x58, 0xFB, 0xFC, 0x09, 0x63, 0x69, 0x05, 0x17, 0x2F, 0x2B, 0xC8, 0x9C,
-    0x2F, 0x18, 0x49, 0x39, 0x9C, 0xBD, 0xAC, 0x21, 0x75, 0xBE, 0x21, 0x96, 0xB6, 0x70, 0xF0, 0xF2,
-    0x0E, 0x89, 0xB3, 0x85, 0x48, 0x2A, 0xEC, 0xFF, 0x3A, 0x64, 0x7E, 0xFB, 0xDF, 0xB6, 0xE8, 0xE5,
-    0x17, 0x4A, 0x0C, 0x93, 0x5D, 0x78, 0x9C, 0xFB, 0xFA, 0xFF, 0xFF, 0xFF, 0xF5, 0x5F, 0x91, 0x89,
-    0x77, 0xF3, 0xBE, 0xFE, 0xAF, 0x67, 0x60, 0x18, 0x38, 0x02, 0xEC, 0x02, 0x14, 0x57, 0x01, 0x00,
-    0x15, 0xB9, 0x62, 0x00, 0x78, 0x9C, 0xB5, 0xCE, 0xD1, 0x09, 0x40, 0x60, 0x18, 0x85, 0x61, 0x24,
-    0x49, 0x92, 0x0D, 0x8C, 0xC0, 0x26, 0x6C, 0xF2, 0xDB, 0x84, 0x4D, 0xD8, 0x84, 0x4D, 0x90, 0xA4,
-    0x3F, 0xE9, 0xD5, 0x77, 0x76, 0x70, 0x6E, 0x9E, 0x8B, 0xF7, 0xE6, 0x78, 0x86, 0xC0, 0x76, 0xB2,
-    0xC9, 0x15, 0x62, 0xB3, 0x87, 0xCC, 0x2C, 0xA1, 0x52, 0x78, 0x70, 0xF2, 0x62, 0x91, 0x3B, 0x44,
-    0xE6, 0x08, 0xA9, 0xD9, 0x40, 0xA1, 0xF0, 0xD2, 0xCA, 0x9B, 0x49, 0x1E, 0x10, 0x9A, 0x33, 0x24,
-    0x66, 0x07, 0xB9, 0x02, 0xD4, 0xD2, 0xFF, 0x71, 0xE1, 0x03, 0x91, 0xF8, 0x45, 0x01, 0x78, 0x9C,
-    0xFB, 0xF0, 0xFF, 0xFF, 0xFF, 0xF7, 0x1F, 0xE0, 0xC4, 0x83, 0x77, 0xFF, 0xFE, 0xBF, 0x67, 0x60,
-    0x78, 0x30, 0x70, 0x04, 0xD8, 0x05, 0x1F, 0x50, 0x5D, 0x05, 0x00, 0xFB, 0x0A, 0x6C, 0xBB, 0x78,
-    0x9C, 0x35, 0xCE, 0xFF, 0x0D, 0xC1, 0x60, 0x10, 0xC6, 0xF1, 0xC7, 0x8F, 0x90, 0x26, 0x65, 0x04,
-    0x6C, 0x60, 0x04, 0x1D, 0xC1, 0x06, 0x1D, 0xA1, 0xDD, 0x84, 0x11, 0x6C, 0xC0, 0x06, 0x6C, 0xC0,
-    0x06, 0x6C, 0x20, 0x8A, 0x26, 0x42, 0x7D, 0xDD, 0x7B, 0x7D, 0xDD, 0x1F, 0x4F, 0x3E, 0x77, 0xB9,
-    0x4B, 0x4E, 0x92, 0xBE, 0x0B, 0xC5, 0x2A, 0x39, 0xFE, 0x79, 0x81, 0x7E, 0x64, 0x0D, 0xA3, 0xC8,
-    0x06, 0x8A, 0x56, 0x4B, 0xE0, 0xDA, 0xF2, 0x44, 0xDE, 0x30, 0x74, 0x3E, 0x18, 0x3F, 0x99, 0x38,
-    0x3F, 0x0C, 0x0E, 0xAC, 0x82, 0x32, 0x5B, 0xCC, 0xA0, 0x63, 0xDC, 0x85, 0xC9, 0x9B, 0xC4, 0x78,
-    0x67, 0x1A, 0x62, 0xAE, 0x38, 0xD8, 0xB0, 0x97, 0x66, 0xD0, 0xF5, 0xEC, 0x59, 0xBF, 0x0D, 0xC7,
-    0x2F, 0x52, 0x55, 0xF8, 0x87, 0x37, 0x72, 0x6F, 0xAD, 0xD6, 0x9C, 0xF5, 0x03, 0x39, 0x7E, 0x40,
-    0x5D, 0x78, 0x9C, 0x9B, 0x30, 0x13, 0x02, 0xD8, 0x3E, 0xFE, 0x87, 0x00, 0x6E, 0x38, 0x03, 0x00,
-    0x0E, 0x64, 0x14, 0xB0, 0x78, 0x9C, 0xFB, 0xF5, 0xFF, 0x3F, 0x2F, 0x03, 0xC3, 0x84, 0xFF, 0xFF,
-    0xE7, 0x33, 0x30, 0x30, 0x7C, 0xFB, 0xFF, 0x9F, 0x95, 0x81, 0xC1, 0xE1, 0xDF, 0x7F, 0x7B, 0x20,
-    0xE7, 0xE0, 0xFF, 0xF7, 0x8C, 0x40, 0xEA, 0xC7, 0x7F, 0x1E, 0x00, 0x48, 0xF7, 0x10, 0x5B, 0x78,
-    0x9C, 0x63, 0x60, 0x70, 0xD8, 0xF1, 0xEF, 0xFF, 0x5A, 0x36, 0x06, 0x06, 0x86, 0xC6, 0xFF, 0x60,
-    0x00, 0x64, 0x7E, 0x82, 0xB0, 0xFA, 0x19, 0x18, 0x16, 0x40, 0x58, 0xFF, 0x99, 0x19, 0x0C, 0xFE,
-    0xCF, 0x33, 0x4B, 0xFE, 0xFB, 0xFF, 0x3F, 0x17, 0x03, 0x83, 0x3B, 0x50, 0xF1, 0xC3, 0xFF, 0xFF,
-    0xF9, 0x18, 0xC0, 0x00, 0xA8, 0x84, 0x1F, 0xC2, 0x6A, 0xF8, 0xFF, 0x5F, 0x9E, 0x81, 0xC1, 0x61,
-    0xC5, 0x9D, 0x7F, 0xFF, 0x41, 0xAC, 0x82, 0x7F, 0x10, 0xBD, 0xF2, 0x02, 0x7F, 0xA0, 0xA6, 0xC8,
-    0x83, 0x8C, 0xEB, 0x0D, 0x5B, 0x0A, 0x64, 0x7D, 0xFC, 0xFF, 0x3F, 0x1E, 0xA2, 0xE3, 0xCB, 0xFF,
-    0xFF, 0x9C, 0x0C, 0x0C, 0x13, 0x80, 0xAC, 0x6F, 0x60, 0xCB, 0x2F, 0x00, 0x59, 0x5F, 0xC1, 0x62,
-    0xDF, 0x81, 0x2C, 0xA0, 0x53, 0xFA, 0x95, 0xB7, 0x80, 0xF4, 0x5E, 0xF8, 0x0F, 0x33, 0x25, 0x00,
-    0x4C, 0xF9, 0xFF, 0x06, 0xDA, 0x01, 0x54, 0xF2, 0xFF, 0x3D, 0xCB, 0x57, 0x20, 0x4B, 0xE1, 0xE6,
-    0xFF, 0x7D, 0xE2, 0x0C, 0x1F, 0xFE, 0xCB, 0x03, 0x00, 0x84, 0xBF, 0x7F, 0x60, 0x78, 0x9C, 0xFB,
-    0xF0, 0xFF, 0x3F, 0x17, 0x03, 0x04, 0x7C, 0x20, 0x9B, 0xC9, 0x89, 0x9D, 0x99, 0xF0, 0xFA, 0x7D,
-    0x36, 0x84, 0xA9, 0xF1, 0xF7, 0xFF, 0xFF, 0xFF, 0xBA, 0x60, 0xE6, 0x0D, 0x20, 0xEB, 0xFF, 0x7B,
-    0x46, 0x10, 0x13, 0x02, 0xB8, 0xC0, 0xCC, 0xF5, 0x2B, 0x80, 0x84, 0x3D, 0x88, 0x79, 0x9F, 0x91,
-    0xE1, 0xE2, 0xFF, 0xFF, 0xF3, 0x41, 0x4C, 0x7B, 0x06, 0x06, 0x03, 0xA0, 0x62, 0x10, 0x93, 0x0F,
-    0x68, 0xD0, 0x9F, 0xFF, 0xFF, 0x19, 0x81, 0x4C, 0x6E, 0x20, 0xF3, 0xE7, 0xFF, 0xFF, 0xCC, 0x50,
-    0x37, 0x7C, 0xFF, 0xFF, 0x9F, 0x05, 0xC1, 0x64, 0x45, 0x15, 0xE5, 0x41, 0xA8, 0xE5, 0x07, 0x32,
-    0xFF, 0x42, 0x4C, 0x88, 0x67, 0x60, 0x70, 0x80, 0x9A, 0xFB, 0x9E, 0x99, 0xE1, 0x11, 0xD4, 0xB6,
-    0xFF, 0xFB, 0x57, 0xC2, 0xDC, 0x80, 0xE4, 0xB2, 0x1F, 0x20, 0xD6, 0x7D, 0x90, 0x7B, 0xEF, 0x3B,
-    0xFC, 0x03, 0x32, 0x65, 0x40, 0xBE, 0xA8, 0x67, 0x28, 0x7C, 0xF3, 0x3E, 0x1A, 0x68, 0x20, 0x00,
-    0xFB, 0xC0, 0xAA, 0x45, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x68, 0x79, 0xF3, 0xFF, 0x9C, 0x27, 0x03,
-    0x03, 0xC3, 0xE1, 0xFF, 0x20, 0xA0, 0xC7, 0x90, 0x00, 0xA6, 0xFF, 0xF3, 0x31, 0x7C, 0x81, 0x30,
-    0x38, 0x18, 0xFE, 0xFD, 0xFF, 0x7F, 0x7E, 0xE6, 0x9F, 0xFF, 0x4C, 0x40, 0x99, 0xF7, 0xCC, 0x0C,
-    0x0C, 0xAD, 0x0C, 0x1B, 0xFE, 0xFF, 0x8F, 0x67, 0x00, 0x81, 0x0F, 0x20, 0x75, 0x20, 0xF0, 0xE9,
-    0xFF, 0x7F, 0x2E, 0x30, 0xE3, 0x33, 0x48, 0x03, 0x08, 0x00, 0x75, 0xB3, 0xA3, 0x8A, 0xC0, 0xD5,
-    0xC0, 0x75, 0x5D, 0x80, 0x9A, 0xC3, 0xD8, 0x00, 0x31, 0x79, 0x31, 0xB7, 0xC2, 0x7F, 0x90, 0x5D,
-    0xAF, 0xFF, 0x73, 0x33, 0xFC, 0x80, 0xD8, 0xCE, 0x0D, 0xB2, 0x0C, 0xC2, 0x80, 0x0A, 0x01, 0x4D,
-    0x15, 0xD8, 0xF6, 0xF7, 0xFF, 0x3E, 0x71, 0x06, 0x00, 0xF2, 0xBF, 0x5D, 0xF4, 0x78, 0x9C, 0xAD,
-    0xCF, 0xC1, 0x0D, 0x01, 0x51, 0x10, 0x06, 0xE0, 0x99, 0x38, 0x88, 0x84, 0x44, 0x09, 0xDB, 0x80,
-    0x44, 0x07, 0x3A, 0x40, 0x09, 0x5B, 0x80, 0x12, 0x1C, 0xB6, 0x04, 0x47, 0x5D, 0x88, 0xAB, 0x0B,
-    0x25, 0x50, 0x81, 0x3B, 0x87, 0x27, 0x76, 0x65, 0xAD, 0x58, 0xBF, 0x7F, 0xE6, 0x6D, 0x88, 0xBB,
-    0x39, 0xCC, 0xFB, 0xF2, 0xF2, 0xF2, 0xBF, 0x19, 0x11, 0xAF, 0x0A, 0x50, 0xF9, 0x17, 0xEF, 0xCE,
-    0xE9, 0x29, 0xCC, 0xB5, 0x34, 0xF6, 0x9F, 0x00, 0xC6, 0x37, 0xE3, 0x01, 0x56, 0x7E, 0x5B, 0xA1,
-    0x29, 0x4D, 0xD8, 0xB6, 0x1B, 0x67, 0x06, 0x84, 0x96, 0xAC, 0x8D, 0x7B, 0x60, 0xC2, 0xB0, 0x17,
-    0x79, 0x01, 0x7A, 0x4D, 0xEE, 0x15, 0xE8, 0x90, 0x16, 0x96, 0x03, 0x6D, 0x92, 0x87, 0x16, 0x5F,
-    0xE6, 0x3F, 0xB4, 0xB7, 0x45, 0x4C, 0xE8, 0x92, 0x65, 0xCC, 0x1D, 0x91, 0x35, 0xB9, 0x00, 0x8E,
-    0x2A, 0x99, 0xFD, 0x36, 0x64, 0x5B, 0x2D, 0x6B, 0xA3, 0x3C, 0x3E, 0x93, 0xC5, 0x79, 0x83, 0x25,
-    0x48, 0x62, 0x5B, 0x0C, 0x76, 0xBE, 0x5B, 0x7A, 0x0E, 0x33, 0x49, 0xC9, 0x37, 0x82, 0xC2, 0xA8,
-    0xB2, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x98, 0xF2, 0xF6, 0xFD, 0x5C, 0x56, 0x06, 0x20, 0xB8, 0xFC,
-    0x1F, 0x08, 0xEE, 0xB3, 0x30, 0x30, 0x04, 0xFC, 0x07, 0x83, 0x7C, 0x06, 0x86, 0xCF, 0x10, 0xD6,
-    0x7F, 0x66, 0x86, 0x7F, 0xFF, 0xFF, 0x6B, 0x28, 0x7C, 0xFF, 0xFF, 0x9F, 0x07, 0x28, 0x59, 0xCF,
-    0xC0, 0x60, 0xF0, 0xFF, 0xBF, 0xFD, 0x86, 0xFF, 0xFF, 0xF9, 0x80, 0xDA, 0x7E, 0xFF, 0xEF, 0xFF,
-    0xF0, 0xFF, 0x3F, 0x17, 0x90, 0xF5, 0xE3, 0xFF, 0xFA, 0x4F, 0x50, 0x0D, 0xFF, 0xCF, 0x7F, 0x86,
-    0xB3, 0xBE, 0xC0, 0x58, 0xF7, 0x81, 0x62, 0x67, 0xCF, 0x80, 0xC0, 0x1C, 0xA0, 0x3A, 0x0E, 0x06,
-    0x30, 0x00, 0xEA, 0xE5, 0x86, 0xB0, 0x80, 0xE6, 0xE9, 0x43, 0x58, 0x40, 0x3B, 0xEE, 0x33, 0x82,
-    0x68, 0x76, 0x86, 0xBF, 0xFF, 0xFF, 0xCF, 0x37, 0x0D, 0xD9, 0x0E, 0x34, 0x1F, 0x66, 0x20, 0x17,
-    0x83, 0xC3, 0x3F, 0x18, 0x8B, 0x61, 0x21, 0x84, 0xC5, 0x0E, 0x54, 0x5C, 0x74, 0xFB, 0xFF, 0xFB,
-    0x39, 0xA2, 0x0C, 0x00, 0x7E, 0x96, 0x7F, 0x5F, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x28, 0x7C, 0xFD,
-    0xFF, 0x5E, 0x14, 0x23, 0x03, 0x83, 0xC3, 0xBF, 0xFF, 0x40, 0xC0, 0xCC, 0xC0, 0xF0, 0x09, 0x44,
-    0xDF, 0x67, 0x60, 0x60, 0xF8, 0x05, 0x62, 0xF4, 0x03, 0x19, 0x40, 0x99, 0xDE, 0x15, 0x7A, 0x40,
-    0x06, 0x44, 0x9C, 0x81, 0x41, 0xE0, 0xFF, 0xFF, 0xF9, 0x60, 0x86, 0x02, 0x44, 0x01, 0x03, 0xC3,
-    0x55, 0x90, 0xDA, 0xFF, 0xEC, 0x0C, 0x97, 0xFE, 0x43, 0x19, 0x9F, 0x31, 0x18, 0x0E, 0x21, 0xFF,
-    0xFF, 0xAF, 0x77, 0x71, 0x61, 0x44, 0xD2, 0x35, 0x38, 0x18, 0x00, 0xB9, 0xE7, 0x69, 0xE6, 0x78,
-    0x9C, 0x45, 0x8F, 0xB1, 0x4E, 0x02, 0x51, 0x10, 0x45, 0xEF, 0x4A, 0x44, 0x84, 0x42, 0x1B, 0x6B,
-    0xB6, 0x34, 0x16, 0xCA, 0x1F, 0x68, 0x69, 0x27, 0x7F, 0xA0, 0xA5, 0x9D, 0x9F, 0x60, 0x4B, 0xA1,
-    0xD1, 0x9E, 0x90, 0x50, 0x51, 0xD3, 0x49, 0x41, 0x22, 0x7F, 0x80, 0xBD, 0x85, 0x9D, 0x9D, 0xAE,
-    0x90, 0x20, 0x10, 0xF2, 0xF6, 0x30, 0xE3, 0x3E, 0xF0, 0x56, 0x67, 0x26, 0x33, 0x77, 0xEE, 0x48,
-    0xE9, 0x20, 0xC7, 0x75, 0x20, 0x2D, 0x21, 0x62, 0x9F, 0x2D, 0xCE, 0xE1, 0xF1, 0xC5, 0xE8, 0x52,
-    0xCA, 0x19, 0xCB, 0xEB, 0x44, 0x29, 0x5C, 0x49, 0x3F, 0xB0, 0xA7, 0x0B, 0x38, 0x93, 0x46, 0xB0,
-    0xEF, 0x58, 0xFF, 0xC3, 0xEA, 0xFF, 0x40, 0x45, 0x0A, 0x71, 0xAD, 0x24, 0xCD, 0xA0, 0x33, 0xC0,
-    0x6B, 0x3D, 0x17, 0x07, 0x4E, 0x0D, 0xBD, 0x0D, 0xAF, 0x89, 0xD1, 0xE1, 0x8A, 0x3C, 0x7B, 0x28,
-    0x79, 0xF3, 0x8D, 0x7B, 0x45, 0xCD, 0xDC, 0xAC, 0xD0, 0x2F, 0xB4, 0x5B, 0xAD, 0x5B, 0x9F, 0x98,
-    0x14, 0x0E, 0x59, 0x59, 0x6A, 0xC6, 0xB8, 0x4F, 0xD2, 0x4D, 0x88, 0xBC, 0xD3, 0xC8, 0x37, 0x5F,
-    0x54, 0xA6, 0x70, 0x2C, 0xA5, 0x9F, 0x50, 0x5B, 0x72, 0xE7, 0x3E, 0xB6, 0x51, 0x0B, 0xFE, 0xB4,
-    0x3C, 0x76, 0x35, 0x70, 0xEE, 0x68, 0x7F, 0x97, 0x57, 0x7C, 0x98, 0x7B, 0x33, 0x90, 0x25, 0x96,
-    0x2B, 0x1B, 0xBE, 0x9B, 0xC1, 0xB5, 0xBA, 0x1B, 0xAF, 0x5D, 0x69, 0x51, 0xD0, 0x89, 0xE7, 0xED,
-    0x7D, 0xF1, 0xDD, 0x3E, 0x32, 0x5A, 0x03, 0xAF, 0xF6, 0xB9, 0xA6, 0x78, 0x9C, 0xC5, 0xCC, 0x3D,
-    0x0E, 0x40, 0x40, 0x14, 0x45, 0x61, 0x3F, 0x91, 0x30, 0xA2, 0x56, 0x5A, 0x12, 0x3B, 0x62, 0x1B,
-    0x0A, 0x6B, 0xB0, 0x14, 0xA5, 0x45, 0x28, 0x4C, 0x89, 0xE0, 0x78, 0x6F, 0xA6, 0x55, 0x69, 0x9C,
-    0xEA, 0x2B, 0x6E, 0xAE, 0x05, 0x13, 0xF8, 0xEC, 0x67, 0x66, 0xAF, 0x4C, 0x9B, 0x85, 0x21, 0x76,
-    0x2C, 0x4F, 0x60, 0x74, 0x9C, 0xD1, 0x8C, 0xD2, 0x57, 0x3B, 0x4E, 0xFD, 0xA5, 0x0B, 0x65, 0x12,
-    0x74, 0xB0, 0x2A, 0x5B, 0x39, 0xBA, 0x41, 0x59, 0x09, 0x0F, 0x08, 0x85, 0x85, 0x70, 0x87, 0x48,
-    0x98, 0x0B, 0x37, 0x4F, 0xF3, 0x0B, 0x1F, 0x5C, 0x7A, 0xA1, 0x3F, 0x78, 0x9C, 0x73, 0xF8, 0xB3,
-    0x8E, 0xF1, 0xC1, 0xFF, 0xFF, 0x9C, 0x9F, 0xFF, 0xFF, 0xE7, 0xFD, 0xF4, 0xFF, 0x3F, 0xCF, 0x86,
-    0xFF, 0xFF, 0x59, 0x19, 0x5A, 0xD5, 0x19, 0x60, 0xE0, 0xC3, 0xFF, 0xFF, 0x5C, 0xD4, 0xC6, 0x00,
-    0x53, 0x36, 0x4C, 0x84, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x38, 0xF2, 0x5E, 0x8A, 0x81, 0x81, 0xE1,
-    0xDF, 0xFF, 0xF9, 0x0C, 0x0C, 0x06, 0xFF, 0xFF, 0xDF, 0x67, 0x60, 0x50, 0xF8, 0xFF, 0xFF, 0x3C,
-    0x50, 0xE4, 0xF7, 0xFF, 0x78, 0x20, 0x19, 0x50, 0xC1, 0xC4, 0x80, 0x0A, 0xFE, 0xFF, 0x5F, 0x3F,
-    0xD0, 0xA4, 0x00, 0x98, 0x04, 0xBA, 0x16, 0xE8, 0xE6, 0x05, 0xFF, 0xFF, 0xF7, 0x6F, 0x9B, 0xF9,
-    0xF7, 0xFF, 0x7F, 0xFF, 0xEF, 0xFF, 0x81, 0x80, 0x0F, 0x4C, 0xB2, 0x80, 0xC8, 0x78, 0x86, 0x2D,
-    0xFF, 0xDE, 0xD7, 0x30, 0x32, 0x00, 0x00, 0xE7, 0x7B, 0x67, 0x1E, 0x78, 0x9C, 0xB5, 0xCF, 0xC1,
-    0x09, 0xC2, 0x40, 0x10, 0x85, 0xE1, 0x8D, 0x04, 0x74, 0x8D, 0x07, 0x6F, 0xDE, 0xC4, 0x0E, 0xB4,
-    0x03, 0x5B, 0xB0, 0x03, 0x5B, 0xB0, 0x93, 0xB4, 0x60, 0x09, 0x9E, 0xBC, 0xC6, 0x46, 0x24, 0x25,
-    0x18, 0x10, 0x45, 0x11, 0xF3, 0x3B, 0xBB, 0x6F, 0x20, 0x15, 0x38, 0xA7, 0x8F, 0x65, 0xF7, 0xCD,
-    0xDB, 0x0E, 0xA6, 0x41, 0xD3, 0xFD, 0x81, 0x1F, 0x88, 0xE2, 0x11, 0x1A, 0x3F, 0x7D, 0xC3, 0x4C,
-    0x3C, 0x40, 0x5B, 0x24, 0xC6, 0xF0, 0x84, 0x65, 0x7E, 0x16, 0x77, 0x70, 0x1B, 0x65, 0x4E, 0xEE,
-    0xB0, 0x55, 0xD8, 0xA2, 0x87, 0x52, 0x3C, 0xC3, 0xDE, 0x57, 0x7C, 0x61, 0xED, 0xB4, 0x69, 0x07,
-    0x5A, 0xA0, 0x78, 0xD5, 0x65, 0x63, 0xB3, 0xB1, 0xDC, 0x22, 0xB3, 0x0A, 0xAF, 0x54, 0x41, 0x1D,
-    0x2E, 0x50, 0x3B, 0x57, 0xA4, 0x25, 0x2A, 0x99, 0xFB, 0x88, 0xA7, 0xA1, 0xFA, 0xDC, 0x6A, 0x8C,
-    0xFD, 0x6F, 0x0F, 0x2B, 0xF7, 0x03, 0x0A, 0x1B, 0x9B, 0x80, 0x78, 0x9C, 0xFB, 0xF0, 0xFF, 0x3F,
-    0xD7, 0x07, 0x3A, 0x63, 0x00, 0xD5, 0x22, 0x56, 0x19, 0x78, 0x9C, 0xFB, 0xF0, 0x3F, 0x9F, 0xA1,
-    0xF0, 0xCD, 0xFB, 0x1A, 0x26, 0x06, 0x81, 0xE3, 0xFF, 0xCE, 0x89, 0x33, 0x30, 0x7C, 0xF8, 0xBF,
-    0xDE, 0xE1, 0xDF, 0xFF, 0xFF, 0x40, 0xE1, 0x6F, 0x40, 0xF2, 0x3F, 0x2B, 0x50, 0xE0, 0xFD, 0x67,
-    0x10, 0xEB, 0x7F, 0x08, 0x98, 0xB4, 0x07, 0x0A, 0xA0, 0x80, 0xFD, 0x60, 0x81, 0xFD, 0x2B, 0x41,
-    0x9A, 0xFE, 0x77, 0xFF, 0x02, 0x12, 0x8C, 0x20, 0x01, 0x66, 0x86, 0x87, 0x40, 0x52, 0x8F, 0x41,
-    0x01, 0x48, 0xB2, 0x7C, 0x00, 0x99, 0xC7, 0x50, 0x00, 0x62, 0x32, 0x30, 0xFC, 0xF8, 0xFF, 0x9F,
-    0x0D, 0x28, 0x20, 0xCF, 0xC0, 0x60, 0xF0, 0xFF, 0xFF, 0x7B, 0x06, 0x06, 0x86, 0xAF, 0xFF, 0xFF,
-    0xB3, 0x03, 0x05, 0x78, 0x19, 0x40, 0x8A, 0xF7, 0x03, 0x05, 0x3E, 0x43, 0x04, 0xB8, 0x19, 0x18,
-    0x04, 0xFE, 0xFF, 0x9F, 0x8F, 0x10, 0xE0, 0x02, 0x0B, 0xF4, 0x0F, 0x39, 0x01, 0x00, 0xCF, 0x7E,
-    0xCE, 0x77, 0x78, 0x9C, 0xC5, 0xCA, 0xBD, 0x11, 0x40, 0x40, 0x10, 0x40, 0xE1, 0xF5, 0x13, 0x9D,
-    0x51, 0x83, 0x56, 0x74, 0xA0, 0x05, 0x1D, 0x28, 0x81, 0x36, 0x04, 0x6A, 0x50, 0x8A, 0x42, 0x04,
-    0x77, 0x33, 0x12, 0x0C, 0x9E, 0x5D, 0xF4, 0xE0, 0x45, 0x5F, 0xF0, 0x02, 0x8D, 0xD4, 0x33, 0x43,
-    0x22, 0x12, 0x18, 0xCB, 0x13, 0x18, 0x8D, 0x7E, 0xC1, 0x72, 0xCA, 0xAF, 0xEA, 0xE1, 0xD4, 0x1F,
-    0x76, 0x18, 0x53, 0xE9, 0xC0, 0x1B, 0x5B, 0x11, 0xB9, 0xC0, 0x58, 0x28, 0x77, 0x88, 0x94, 0xB9,
-    0x72, 0x83, 0x58, 0x99, 0x29, 0xD7, 0x97, 0xEE, 0x17, 0xDE, 0xDD, 0x5E, 0x88, 0xDD, 0x78, 0x9C,
-    0x63, 0x60, 0x60, 0x68, 0x79, 0xF3, 0x7F, 0x2F, 0x1B, 0x03, 0x08, 0x1C, 0xFE, 0x0F, 0x02, 0xEC,
-    0x40, 0x56, 0x00, 0x98, 0xF5, 0x7F, 0x3F, 0x90, 0xF9, 0x19, 0xC2, 0xFC, 0xCF, 0xC5, 0xC0, 0xF0,
-    0x17, 0x28, 0xB2, 0x12, 0x48, 0xC4, 0x83, 0xE4, 0xEF, 0x33, 0x31, 0x34, 0x00, 0x49, 0x86, 0x0D,
-    0xFF, 0xFF, 0xDB, 0x03, 0x95, 0xFD, 0xFE, 0xFF, 0x9F, 0xF9, 0xC3, 0xFF, 0xFF, 0xBC, 0x40, 0xE6,
-    0xD7, 0xFF, 0xFF, 0x39, 0x3E, 0x81, 0x35, 0x30, 0x80, 0x28, 0xA0, 0x01, 0x1C, 0x40, 0x26, 0x50,
-    0x92, 0xE7, 0x0B, 0xC4, 0x74, 0x28, 0x13, 0x26, 0x8A, 0xA4, 0x16, 0x61, 0x02, 0x3B, 0xD0, 0x5C,
-    0x7F, 0x88, 0xB9, 0x2C, 0x40, 0xDB, 0xDE, 0x33, 0x31, 0x14, 0x80, 0x6C, 0x63, 0xF8, 0x03, 0x74,
-    0xC3, 0x4C, 0xA0, 0x1B, 0xF2, 0xC1, 0x1A, 0xC0, 0x80, 0x9B, 0x81, 0xC1, 0x01, 0xEA, 0x5E, 0x46,
-    0xA0, 0x8E, 0x4D, 0x60, 0x26, 0x07, 0xD8, 0x47, 0xCD, 0x40, 0xBF, 0x89, 0x01, 0x69, 0x00, 0x1C,
-    0xAB, 0x81, 0xFE, 0x78, 0x9C, 0xFB, 0xF0, 0x7F, 0x3F, 0x43, 0xC2, 0xEB, 0xF7, 0xD9, 0x0C, 0x0C,
-    0x0C, 0x1F, 0xFE, 0xFF, 0x57, 0xF8, 0xF3, 0xFF, 0xFF, 0x7F, 0x5D, 0x30, 0xF3, 0x2A, 0x90, 0xF5,
-    0xFF, 0x3D, 0x23, 0x88, 0x09, 0x01, 0xDC, 0x60, 0xE6, 0xFA, 0x15, 0xFF, 0xFE, 0xFF, 0xB7, 0x07,
-    0x31, 0xEF, 0x33, 0x32, 0x1C, 0xFC, 0xFF, 0x7F, 0x3E, 0x88, 0x69, 0xCF, 0xC0, 0xA0, 0x00, 0x54,
-    0x0C, 0x62, 0xF2, 0x01, 0x0D, 0x02, 0x1A, 0xC2, 0xF8, 0x01, 0xA4, 0x81, 0x81, 0xE1, 0xE7, 0xFF,
-    0xFF, 0xCC, 0x40, 0x26, 0x17, 0x90, 0xF9, 0xFD, 0xFF, 0x7F, 0x16, 0x04, 0x93, 0x15, 0x55, 0x94,
-    0x07, 0xA2, 0x96, 0x09, 0xC8, 0xE4, 0x47, 0x98, 0x10, 0x0F, 0x36, 0xF7, 0x3E, 0xC8, 0xDC, 0xF7,
-    0xCC, 0x0C, 0x17, 0xFF, 0xFF, 0xEF, 0x07, 0xBB, 0x61, 0xFF, 0x4A, 0x20, 0xA1, 0x8F, 0x70, 0x19,
-    0x17, 0x88, 0xF9, 0x1B, 0xC4, 0xBA, 0x0F, 0x76, 0xAF, 0x3B, 0xD0, 0x89, 0xFF, 0x65, 0xC0, 0xBE,
-    0xE0, 0x28, 0x7C, 0xF3, 0x3E, 0x1A, 0xE2, 0x37, 0x4E, 0x06, 0x08, 0x80, 0x5A, 0x4C, 0x75, 0x26,
-    0x00, 0xDF, 0x30, 0xAD, 0x18, 0x78, 0x9C, 0xB5, 0xCE, 0xCD, 0x0D, 0x41, 0x41, 0x14, 0x05, 0xE0,
-    0x73, 0x6D, 0xFC, 0x24, 0x44, 0x09, 0xAF, 0x03, 0x1A, 0xD0, 0x02, 0x4A, 0x50, 0x80, 0x85, 0x02,
-    0x2C, 0xEC, 0x6C, 0x55, 0xA0, 0x07, 0x5B, 0x1B, 0x3A, 0x40, 0x1B, 0x2C, 0x46, 0x78, 0xC2, 0xE3,
-    0xC5, 0x71, 0xEE, 0x9B, 0x17, 0xD1, 0x80, 0x9B, 0xCC, 0xCC, 0x97, 0x99, 0xCC, 0xB9, 0x17, 0x18,
-    0x1E, 0xC3, 0xD4, 0xB6, 0xA4, 0xA1, 0xFD, 0x22, 0xD9, 0x3F, 0x3B, 0x0F, 0xF4, 0xBA, 0x39, 0x33,
-    0x96, 0x65, 0x89, 0xB6, 0xCD, 0xBA, 0xE0, 0x8C, 0x0C, 0x15, 0xAC, 0x9C, 0x7B, 0x72, 0x00, 0xE0,
-    0x2D, 0xEA, 0x6B, 0x4B, 0x7C, 0x88, 0x17, 0xB2, 0x21, 0x7A, 0xC2, 0x95, 0xAC, 0x89, 0x3A, 0x2C,
-    0x25, 0xAB, 0x25, 0x7F, 0x6E, 0xB5, 0xEA, 0x62, 0x1A, 0x13, 0x9A, 0xE2, 0x3D, 0xE6, 0x76, 0xC4,
-    0x5C, 0x5C, 0x90, 0x3B, 0xC3, 0xC4, 0xBB, 0x75, 0xB5, 0x2D, 0xE7, 0xB9, 0x13, 0xCF, 0xEF, 0x64,
-    0x71, 0xDE, 0xE0, 0x8D, 0x91, 0xF8, 0x63, 0xCF, 0x13, 0x80, 0xD1, 0x29, 0x8C, 0x8B, 0x71, 0x10,
-    0x2B, 0xFB, 0x23, 0x3F, 0x12, 0x4C, 0xAB, 0xFF, 0x78, 0x9C, 0xFB, 0xF0, 0x3F, 0x9E, 0xC1, 0xE0,
-    0xD5, 0x7F, 0xD6, 0x0F, 0xFF, 0xE7, 0x33, 0xFC, 0xF8, 0x0F, 0xA2, 0xCF, 0x4F, 0xF8, 0xFF, 0xFF,
-    0x3F, 0xCB, 0x87, 0xFF, 0xFF, 0xBF, 0x01, 0x69, 0x66, 0x20, 0x0D, 0x02, 0x8C, 0x20, 0xFA, 0x7E,
-    0x44, 0x2A, 0x03, 0x88, 0x66, 0x63, 0x60, 0x00, 0xD1, 0xF5, 0x0C, 0x10, 0x9A, 0x1F, 0x4A, 0x73,
-    0x43, 0x69, 0x2E, 0x5A, 0xD0, 0x00, 0xA0, 0x9E, 0x51, 0x9B, 0x78, 0x9C, 0x63, 0x60, 0x98, 0xFA,
-    0xE6, 0xFF, 0xB9, 0x48, 0x46, 0x06, 0x86, 0xCB, 0xFF, 0x41, 0x60, 0x3D, 0x83, 0x01, 0x98, 0xFE,
-    0x7F, 0x9F, 0xE1, 0x02, 0x84, 0x91, 0xCF, 0xF0, 0xE9, 0xFF, 0xFF, 0x58, 0xE3, 0xA9, 0xFF, 0xF8,
-    0x19, 0xBE, 0xFC, 0xFF, 0xCF, 0xC6, 0xC0, 0x10, 0xC0, 0xC6, 0xF0, 0xF9, 0xFF, 0x7F, 0x19, 0x06,
-    0x10, 0xF8, 0x08, 0x54, 0xA0, 0x01, 0x62, 0x2C, 0x00, 0x29, 0x8D, 0x06, 0x32, 0x04, 0xFE, 0x82,
-    0x58, 0xB1, 0x40, 0xD6, 0x42, 0xB0, 0x76, 0x2E, 0x20, 0x6B, 0x11, 0x88, 0xD1, 0x0F, 0x52, 0x56,
-    0xF8, 0x0F, 0xC8, 0x62, 0x04, 0xB1, 0x0A, 0x80, 0x0C, 0x56, 0xB0, 0x19, 0x5F, 0x81, 0xA6, 0x4E,
-    0x66, 0x06, 0x32, 0x80, 0xA6, 0xB2, 0x7E, 0x79, 0x9F, 0xA9, 0x1C, 0x0C, 0x34, 0x82, 0xE9, 0x0B,
-    0xC4, 0xF6, 0xFD, 0x0C, 0x50, 0x86, 0x1E, 0x48, 0x1A, 0x08, 0xCE, 0x33, 0x31, 0x08, 0x2C, 0x7B,
-    0xF3, 0xFF, 0x7D, 0x0F, 0x50, 0x07, 0x00, 0x7D, 0x9B, 0x6A, 0xF5, 0x78, 0x9C, 0x63, 0x60, 0x30,
-    0x48, 0x13, 0x63, 0x00, 0x81, 0x0D, 0xFF, 0xED, 0xC1, 0xF4, 0x47, 0x28, 0xFD, 0x1D, 0x4A, 0xFF,
-    0x85, 0xD0, 0x9B, 0xFE, 0x83, 0x00, 0x7F, 0xC3, 0x7F, 0x08, 0xFD, 0x09, 0x8D, 0x76, 0x98, 0xF2,
-    0xFF, 0x7F, 0xBE, 0x8B, 0x0B, 0x0B, 0x43, 0xC2, 0x7F, 0x88, 0x7A, 0x2A, 0xD0, 0xFE, 0x20, 0x3A,
-    0xE0, 0xFF, 0xFF, 0xF5, 0x20, 0x5A, 0x01, 0x68, 0x4B, 0xCF, 0x4E, 0xA0, 0xD0, 0x3F, 0x90, 0x7D,
-    0x40, 0xFA, 0x1B, 0x94, 0x9E, 0x00, 0xA5, 0x19, 0x96, 0xFC, 0x7B, 0x3F, 0x87, 0x05, 0x00, 0xE1,
-    0xE8, 0x5B, 0xB8, 0x78, 0x9C, 0xFB, 0xF4, 0xFF, 0x3F, 0x07, 0x03, 0x03, 0xC3, 0xAF, 0xFF, 0xFF,
-    0x3F, 0xD1, 0x9A, 0xF5, 0x1B, 0x0B, 0xEB, 0x1F, 0x98, 0xC5, 0xC5, 0xC0, 0x20, 0xF0, 0xFF, 0xFF,
-    0xFF, 0x8F, 0xFF, 0xFF, 0xF3, 0x31, 0x30, 0x34, 0x00, 0x59, 0x1F, 0xFE, 0xFF, 0xAF, 0x67, 0x60,
-    0xF8, 0x0A, 0x64, 0x6D, 0x00, 0xE2, 0x9E, 0x93, 0x40, 0xE2, 0xBF, 0xC3, 0x7F, 0x18, 0x00, 0xE9,
-    0x07, 0x82, 0xCF, 0x40, 0x16, 0x48, 0xFA, 0xBF, 0x2D, 0x90, 0x64, 0x60, 0x58, 0xF2, 0xF7, 0x7D,
-    0x36, 0x43, 0xC1, 0xFF, 0xFF, 0x00, 0x2D, 0x4E, 0x89, 0x33, 0x78, 0x9C, 0x25, 0x8E, 0xC1, 0x09,
-    0xC2, 0x40, 0x10, 0x45, 0xBF, 0x12, 0x82, 0x48, 0x90, 0x74, 0xA0, 0x1D, 0xD8, 0x82, 0x1D, 0xD8,
-    0x82, 0x1D, 0x68, 0x09, 0x76, 0x60, 0x0B, 0x1E, 0xBC, 0xDB, 0x82, 0x1D, 0xA4, 0x05, 0x8F, 0xDE,
-    0x42, 0x44, 0x8C, 0x84, 0xE8, 0xF3, 0xCF, 0xEE, 0x1C, 0x76, 0xDF, 0xB0, 0xB3, 0xEF, 0xCF, 0x17,
-    0x26, 0x92, 0x0E, 0xB0, 0xEF, 0xA1, 0x34, 0xDE, 0x60, 0xD9, 0x41, 0x65, 0x7C, 0xC2, 0xFC, 0xEC,
-    0xD6, 0xE8, 0xC7, 0x62, 0xE3, 0x21, 0xE3, 0x48, 0x2B, 0xFD, 0x68, 0xA4, 0x1A, 0x4E, 0xD2, 0x27,
-    0x14, 0x16, 0xAC, 0xD3, 0x87, 0x32, 0x04, 0x95, 0xF2, 0xD9, 0x25, 0xE5, 0x2E, 0x14, 0x7D, 0x0A,
-    0xAA, 0x43, 0x31, 0x72, 0xB5, 0x46, 0x03, 0x8D, 0xDB, 0x6D, 0xE0, 0x0B, 0x3C, 0xB4, 0x08, 0xBC,
-    0xC3, 0x05, 0x66, 0x81, 0x47, 0x78, 0xC0, 0x34, 0x70, 0x05, 0x43, 0x24, 0x2A, 0xE5, 0xE7, 0x3D,
-    0x5C, 0x6F, 0xF2, 0x76, 0x2E, 0x47, 0x31, 0xCF, 0xE8, 0x95, 0x29, 0x32, 0x7A, 0xE5, 0x36, 0xEE,
-    0x3F, 0x9E, 0xF0, 0x6B, 0xA1, 0x78, 0x9C, 0x2D, 0x90, 0xCB, 0x51, 0x42, 0x41, 0x10, 0x45, 0xAF,
-    0x3F, 0x40, 0x40, 0x20, 0x04, 0x33, 0xC0, 0x0C, 0xA8, 0x32, 0x02, 0x43, 0x30, 0x03, 0x58, 0xB0,
-    0x7F, 0x64, 0xA0, 0x19, 0xE0, 0xCE, 0x25, 0x64, 0x80, 0x19, 0xE0, 0xD6, 0x95, 0x66, 0x00, 0x25,
-    0x96, 0x4F, 0xF1, 0xE1, 0xF1, 0x76, 0x3F, 0x67, 0xD1, 0xFF, 0xE9, 0x73, 0x67, 0x4A, 0x38, 0x96,
-    0xDE, 0xE0, 0x4E, 0xD2, 0x17, 0x68, 0x07, 0x0D, 0x85, 0x5D, 0xBB, 0x50, 0xB1, 0x8A, 0x5E, 0x5B,
-    0x2A, 0x71, 0x4F, 0x03, 0x28, 0xF4, 0x00, 0x3D, 0xE9, 0xC7, 0x85, 0x53, 0xDD, 0xC0, 0xB0, 0x36,
-    0x82, 0x03, 0x2D, 0xDD, 0x47, 0xD3, 0x63, 0x63, 0x5D, 0xB1, 0x29, 0xE9, 0xEA, 0x19, 0xCE, 0x63,
-    0xD1, 0x42, 0x13, 0x16, 0x3B, 0xFA, 0x7A, 0x8F, 0x7B, 0x46, 0x6D, 0xB4, 0x64, 0xBC, 0x65, 0xA4,
-    0xCF, 0xD8, 0x1C, 0xC4, 0x13, 0x67, 0x4F, 0x06, 0xEC, 0x4D, 0x95, 0xB6, 0xD0, 0xF4, 0xFC, 0xCC,
-    0xC9, 0xAF, 0x8B, 0x0A, 0x6E, 0xBB, 0xA4, 0x63, 0xDA, 0x20, 0x81, 0xBA, 0x85, 0x8B, 0x3D, 0x2D,
-    0x67, 0xD7, 0x29, 0x29, 0xB8, 0xFD, 0xCA, 0xDB, 0x0F, 0x4C, 0x93, 0x2A, 0x47, 0x23, 0x38, 0xD2,
-    0x37, 0x8F, 0x70, 0xA6, 0x7C, 0x62, 0xC1, 0xAB, 0xCC, 0x7C, 0x49, 0xAA, 0xF4, 0xC1, 0x8A, 0xB9,
-    0xAC, 0xAA, 0x4A, 0x6A, 0x72, 0xAD, 0x3E, 0x5D, 0x91, 0x85, 0x25, 0x89, 0xFB, 0x77, 0x3E, 0x13,
-    0x12, 0x37, 0xAB, 0x9D, 0xCF, 0xA5, 0xA3, 0x8E, 0xE2, 0x1F, 0x6A, 0x6A, 0x70, 0x69, 0xA6, 0x9E,
-    0xA4, 0xFE, 0x01, 0xC9, 0x0B, 0xB9, 0x32, 0x78, 0x9C, 0x2D, 0x8D, 0xDB, 0x0D, 0x01, 0x51, 0x14,
-    0x45, 0x77, 0xC6, 0x07, 0x89, 0xA1, 0x05, 0x3A, 0xA0, 0x03, 0x1F, 0x0A, 0x50, 0x82, 0x16, 0x74,
-    0x30, 0x3A, 0xE0, 0x53, 0x17, 0x5A, 0x98, 0x0E, 0x68, 0x40, 0xE8, 0x40, 0xC6, 0x23, 0x1E, 0x09,
-    0xCB, 0x79, 0xB8, 0x1F, 0x27, 0x2B, 0x77, 0xED, 0xB3, 0xCF, 0x05, 0x66, 0x92, 0x6E, 0x30, 0x5A,
-    0xC0, 0xD1, 0xF0, 0x03, 0xED, 0x1C, 0xF6, 0xB1, 0x93, 0xAE, 0x30, 0x50, 0x03, 0x13, 0x69, 0x09,
-    0x5B, 0xBD, 0xA1, 0x93, 0xB1, 0x69, 0x2E, 0x78, 0xE2, 0x10, 0x5E, 0x5A, 0xE3, 0xCF, 0xBD, 0xF4,
-    0xE5, 0xEF, 0xA3, 0x3E, 0xBD, 0x74, 0x32, 0xEC, 0x27, 0xBE, 0x0C, 0x57, 0x41, 0xE3, 0x58, 0x6B,
-    0x39, 0xEE, 0x03, 0x7B, 0x8E, 0x4F, 0xD8, 0x40, 0x95, 0xFE, 0xEC, 0x7D, 0x45, 0xF8, 0xB9, 0xEE,
-    0x50, 0x86, 0xEF, 0xAA, 0xF6, 0x84, 0xEF, 0x17, 0x1A, 0xFA, 0xAC, 0xB3, 0xD3, 0xBA, 0xCB, 0x47,
-    0xF6, 0xD8, 0xC5, 0xEA, 0x07, 0xEA, 0x9B, 0x79, 0x20, 0x78, 0x9C, 0x3D, 0x8F, 0xBD, 0x6D, 0x02,
-    0x41, 0x14, 0x06, 0x3F, 0x84, 0x2D, 0x04, 0x16, 0x36, 0x1D, 0x40, 0x09, 0xEE, 0x00, 0x3A, 0x80,
-    0x0A, 0xA0, 0x00, 0x07, 0x04, 0x2E, 0x80, 0x2B, 0x81, 0x98, 0xE4, 0xE8, 0x00, 0x32, 0x87, 0xB4,
-    0x40, 0x07, 0x10, 0x93, 0x1C, 0xB6, 0x2C, 0x63, 0xC4, 0xCF, 0xF0, 0xDE, 0xBE, 0xD3, 0x6D, 0x34,
-    0x5A, 0xED, 0x8C, 0xBE, 0xBD, 0xC2, 0xB3, 0xA4, 0x39, 0x4C, 0xFF, 0xE0, 0xC5, 0x70, 0x0F, 0xDD,
-    0x23, 0xBC, 0x19, 0xFE, 0x42, 0x6B, 0x09, 0x13, 0xC3, 0x33, 0x3C, 0xBD, 0xC3, 0xCA, 0xF0, 0x4E,
-    0x21, 0xDD, 0x40, 0xB2, 0x8B, 0x5C, 0x3A, 0x79, 0x22, 0x83, 0xBE, 0xF4, 0x6D, 0x82, 0xB6, 0xD0,
-    0x96, 0x96, 0x9E, 0xF8, 0x81, 0x86, 0x34, 0x80, 0xA1, 0xFE, 0xA1, 0x96, 0xE4, 0xDC, 0xDC, 0x8D,
-    0x91, 0x79, 0x45, 0x2F, 0xE2, 0xEE, 0x7D, 0xC2, 0xAB, 0xE3, 0x1A, 0xBE, 0xA0, 0xE9, 0x38, 0x82,
-    0x03, 0xD4, 0x1D, 0xCD, 0xBB, 0xB1, 0x4B, 0xE4, 0x25, 0x66, 0x81, 0xD6, 0xA7, 0x1B, 0x68, 0x5E,
-    0x9A, 0x1F, 0x5E, 0xFA, 0x54, 0x78, 0xA8, 0xC2, 0x5C, 0xD5, 0x83, 0x7E, 0x89, 0x31, 0xD6, 0x4F,
-    0xE7, 0x9A, 0xC6, 0x4A, 0xD9, 0xE2, 0x82, 0x7F, 0xB1, 0x8C, 0xC6, 0xC2, 0xC0, 0x46, 0x85, 0xE3,
-    0x90, 0xB2, 0x7B, 0xF1, 0x51, 0x96, 0x1E, 0xB2, 0x05, 0x8D, 0x12, 0x78, 0x9C, 0x75, 0x8D, 0x41,
-    0x0A, 0x40, 0x60, 0x10, 0x46, 0x91, 0x48, 0x59, 0x38, 0x81, 0xDC, 0x84, 0x33, 0xA8, 0x7F, 0xCD,
-    0x4D, 0x1C, 0xC1, 0x15, 0x5C, 0xC2, 0x9A, 0x9B, 0xC8, 0x09, 0x14, 0x25, 0x25, 0x9E, 0x7F, 0x86,
-    0xAD, 0xD9, 0xBC, 0xD7, 0x37, 0xD3, 0x7C, 0x3B, 0xEF, 0xB8, 0xFB, 0xAF, 0x38, 0xA5, 0x31, 0xA6,
-    0x87, 0xC6, 0x91, 0xD9, 0x20, 0x16, 0x26, 0x37, 0x8B, 0x2B, 0xD2, 0x41, 0xA5, 0x1B, 0x7B, 0x1F,
-    0x09, 0x33, 0x98, 0x34, 0x18, 0x21, 0x57, 0x39, 0x20, 0x14, 0x16, 0x30, 0x68, 0x30, 0x43, 0xAA,
-    0x72, 0x82, 0x2F, 0xAC, 0xA1, 0xD5, 0x60, 0xB5, 0xDF, 0x6C, 0x9D, 0xF1, 0xAE, 0xAF, 0x3D, 0xE0,
-    0x5F, 0x1E, 0x5E, 0x79, 0x69, 0xAD, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x10, 0x58, 0xF6, 0xB6, 0x9E,
-    0x81, 0x81, 0xE1, 0xCB, 0xFF, 0xFF, 0x40, 0x4A, 0xE0, 0x3F, 0x98, 0x2A, 0x80, 0x50, 0x13, 0xFE,
-    0xFF, 0xEF, 0x17, 0x61, 0x60, 0x58, 0xF0, 0xFF, 0x3F, 0x07, 0x03, 0x98, 0x62, 0x81, 0x50, 0xCC,
-    0xB8, 0xA8, 0x0D, 0x10, 0xEA, 0x23, 0x98, 0x32, 0xF8, 0xF3, 0xFF, 0x3F, 0x03, 0xC3, 0x91, 0x7F,
-    0x40, 0x43, 0x18, 0x18, 0xBE, 0x01, 0x4D, 0x64, 0x07, 0x53, 0x12, 0x0C, 0x10, 0x1E, 0xD0, 0xC8,
-    0xA3, 0x40, 0xB9, 0xF9, 0x40, 0xAE, 0xC3, 0xDF, 0xFF, 0xFF, 0x19, 0xE1, 0xFA, 0x60, 0xA6, 0xE0,
-    0xB3, 0x08, 0xE1, 0x16, 0x90, 0xCB, 0x80, 0xEE, 0x9C, 0x2F, 0x02, 0x77, 0x35, 0xD4, 0x0F, 0x50,
-    0x1F, 0x81, 0xFD, 0x07, 0x00, 0xE8, 0xA7, 0x65, 0x7D, 0x78, 0x9C, 0xFB, 0xF9, 0x9F, 0xE3, 0x27,
-    0x7D, 0x11, 0x00, 0x37, 0x37, 0x4C, 0x01, 0x78, 0x9C, 0xFB, 0x7E, 0xAF, 0x9A, 0x91, 0x81, 0x81,
-    0xE1, 0xFB, 0xFF, 0xFF, 0xF9, 0x10, 0xEA, 0x3F, 0x23, 0x84, 0x62, 0x67, 0x60, 0x70, 0xFC, 0xF1,
-    0xFF, 0x3F, 0x27, 0x50, 0xB4, 0xE1, 0xFF, 0x7F, 0x2E, 0x20, 0xE5, 0x40, 0x14, 0xC5, 0x0D, 0xA4,
-    0x0C, 0xFE, 0xFF, 0xE7, 0x03, 0x52, 0x02, 0xFF, 0xFF, 0xEF, 0x67, 0x02, 0xD2, 0x40, 0x63, 0xEE,
-    0x7B, 0x33, 0x30, 0x14, 0xFC, 0x87, 0x58, 0xD2, 0x08, 0xA6, 0x1A, 0x20, 0xBC, 0x5F, 0xFF, 0xFF,
-    0xBF, 0xF7, 0x01, 0xA9, 0x3C, 0xCF, 0x0C, 0xD6, 0x27, 0x8F, 0x30, 0x85, 0x08, 0xFB, 0x26, 0x80,
-    0x29, 0xA8, 0x3B, 0xA1, 0xAE, 0x06, 0x51, 0x4C, 0x60, 0x2A, 0x1E, 0xE4, 0xA3, 0xFB, 0x60, 0xFF,
-    0x01, 0x00, 0x81, 0x52, 0x5F, 0x80, 0x78, 0x9C, 0x63, 0x60, 0x80, 0x83, 0x49, 0xFF, 0xF6, 0xB1,
-    0x82, 0x68, 0x36, 0x87, 0xFF, 0xFF, 0xFF, 0xBF, 0x67, 0x63, 0x60, 0x08, 0x90, 0xFF, 0xF4, 0x1F,
-    0xC4, 0xB4, 0x30, 0xFC, 0x25, 0xFF, 0xF5, 0x3F, 0x14, 0xC8, 0x7F, 0xED, 0x17, 0x5A, 0x02, 0x66,
-    0xF1, 0x3C, 0x65, 0x66, 0x60, 0x98, 0x08, 0x64, 0xDC, 0x67, 0x54, 0x01, 0xE9, 0x6B, 0xFC, 0x73,
-    0x9F, 0x1D, 0x61, 0x1A, 0x03, 0x00, 0xD7, 0x6E, 0x26, 0x84, 0x78, 0x9C, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x78, 0x9C, 0x35, 0xCC, 0xC9, 0x0D, 0x40, 0x50, 0x00, 0x84, 0xE1, 0xC1, 0xB3, 0xB5,
-    0xA5, 0x0A, 0x17, 0x3D, 0xBC, 0x32, 0x74, 0x25, 0x2A, 0x50, 0x02, 0x1D, 0xD8, 0x77, 0x32, 0x86,
-    0xC4, 0x24, 0xFF, 0x65, 0x0E, 0x9F, 0xBD, 0x33, 0x2C, 0xA4, 0x77, 0x92, 0xF1, 0xA5, 0x36, 0x32,
-    0x28, 0x59, 0x00, 0x89, 0x8B, 0x7F, 0x36, 0x4F, 0xD1, 0xE8, 0xEB, 0xBE, 0x2A, 0xF4, 0xAC, 0x31,
-    0xB0, 0x55, 0xC4, 0xA8, 0x26, 0x35, 0x93, 0x8E, 0x1C, 0x77, 0x95, 0xA5, 0x8C, 0x1C, 0xB3, 0x93,
-    0xFE, 0x21, 0x4F, 0x76, 0x28, 0x3B, 0x7A, 0xFD, 0x07, 0x49, 0xC6, 0x46, 0x36, 0x78, 0x9C, 0x63,
-    0x60, 0x60, 0x60, 0xF8, 0x71, 0x9E, 0x01, 0x02, 0x30, 0x18, 0xCB, 0xFE, 0xFD, 0x3F, 0x17, 0x09,
-    0xA4, 0xBF, 0xFD, 0x07, 0x01, 0x3D, 0x86, 0x05, 0x60, 0xFA, 0x3F, 0x2F, 0xC3, 0x0F, 0x08, 0x83,
-    0x5D, 0x01, 0x48, 0xEC, 0x9F, 0xF9, 0xFB, 0x3F, 0x63, 0xC3, 0xFF, 0xFF, 0xEF, 0x99, 0x18, 0x18,
-    0x4A, 0x19, 0x2E, 0xFC, 0xFF, 0xEF, 0x0F, 0xD6, 0xFB, 0x11, 0xA4, 0x0E, 0x04, 0x3E, 0xFF, 0xFF,
-    0xCF, 0x09, 0x66, 0x7C, 0x01, 0x6A, 0x00, 0x33, 0xBE, 0xC2, 0x18, 0x70, 0x11, 0xB8, 0x1A, 0xB8,
-    0xAE, 0x07, 0x30, 0x73, 0x26, 0x00, 0x4D, 0x66, 0x66, 0x60, 0x68, 0xE2, 0x04, 0xD9, 0x75, 0x7E,
-    0xD5, 0xEB, 0xFF, 0x5C, 0x30, 0xDB, 0xB9, 0x60, 0xEE, 0xE1, 0x62, 0x60, 0xF8, 0x0E, 0x66, 0x70,
-    0x40, 0xDC, 0xBC, 0x4F, 0x1D, 0xBB, 0x77, 0x20, 0x0C, 0x00, 0x99, 0xC2, 0x69, 0x61, 0x78, 0x9C,
-    0x63, 0x60, 0x60, 0x10, 0xD8, 0xFE, 0xEF, 0xFD, 0x1C, 0x31, 0x06, 0x20, 0xF8, 0xF6, 0x1F, 0x04,
-    0xA4, 0x19, 0x18, 0x0A, 0xC0, 0x8C, 0xFF, 0xBC, 0x0C, 0x0C, 0x9F, 0x21, 0x2C, 0x36, 0x06, 0x86,
-    0x5F, 0xFF, 0xFF, 0x9F, 0xDF, 0xF5, 0xF7, 0x3F, 0x50, 0xD9, 0xBF, 0xFF, 0xFF, 0x59, 0x18, 0x04,
-    0xCA, 0x80, 0x3A, 0xFF, 0xFF, 0x5F, 0xCF, 0x00, 0x06, 0x0A, 0xFF, 0xFF, 0xD7, 0x13, 0xC1, 0xFA,
-    0xFE, 0x1F, 0x66, 0x1C, 0x7E, 0x96, 0x80, 0x21, 0x50, 0x87, 0xA0, 0xA0, 0x20, 0x0E, 0xF3, 0x0C,
-    0xFE, 0xFF, 0x8F, 0x87, 0xB0, 0x12, 0xFE, 0xFF, 0x97, 0x87, 0xB0, 0x2E, 0xFC, 0xFF, 0xCF, 0x09,
-    0x66, 0x08, 0xFC, 0xF9, 0x3F, 0x1F, 0x22, 0xF4, 0xF5, 0xFF, 0xFF, 0xFB, 0x77, 0x41, 0xE0, 0x2C,
-    0xCC, 0xE4, 0xFF, 0xFF, 0xF1, 0xB3, 0x00, 0x3A, 0x57, 0x91, 0x47, 0x78, 0x9C, 0x63, 0x60, 0x80,
-    0x02, 0x81, 0x5E, 0x30, 0x39, 0x87, 0xE1, 0xE2, 0x7F, 0x8E, 0x65, 0x67, 0xBC, 0x0E, 0xFE, 0xE7,
-    0xFC, 0xF5, 0x1F, 0x02, 0xE2, 0x2F, 0x42, 0x19, 0x1C, 0x02, 0x7F, 0xC1, 0xF4, 0x7C, 0x06, 0x86,
-    0x3F, 0xFF, 0x7D, 0x05, 0xBE, 0xFD, 0xEF, 0x67, 0x50, 0xF8, 0xFF, 0x9E, 0x91, 0xC1, 0xE1, 0xFF,
-    0x7B, 0x86, 0x84, 0xFF, 0xF5, 0x0C, 0x20, 0x61, 0xC6, 0x82, 0xFF, 0xF1, 0x40, 0xC6, 0xCF, 0xFF,
-    0x4C, 0x70, 0x11, 0x03, 0x98, 0x1A, 0xB8, 0x2E, 0x81, 0x3F, 0x60, 0x73, 0xFA, 0x19, 0x0E, 0xC2,
-    0x4C, 0xFE, 0x09, 0x65, 0xF8, 0x1F, 0xF8, 0x2F, 0xB1, 0x7C, 0x8F, 0x27, 0xD0, 0x0D, 0x02, 0x3D,
-    0x08, 0x57, 0x41, 0x00, 0x00, 0xD3, 0x77, 0x58, 0x5D, 0x78, 0x9C, 0xA5, 0xCE, 0xBD, 0x09, 0x02,
-    0x41, 0x14, 0x45, 0xE1, 0x8B, 0x3F, 0x81, 0xB8, 0x3D, 0xB8, 0x25, 0xD8, 0x81, 0xC9, 0xE4, 0xB6,
-    0xE0, 0x76, 0x60, 0x07, 0xB6, 0x62, 0x07, 0x5B, 0x82, 0x25, 0x98, 0x1A, 0xDA, 0x81, 0x28, 0x08,
-    0xB2, 0xE8, 0x1E, 0xEF, 0xBE, 0x17, 0x88, 0x81, 0x91, 0x13, 0x0C, 0xE7, 0xC1, 0xF7, 0x86, 0xE9,
-    0x60, 0x24, 0x69, 0x0B, 0xEB, 0x1B, 0xCC, 0x9C, 0x67, 0xA8, 0xF6, 0xB0, 0x70, 0xDE, 0x61, 0x52,
-    0xC3, 0xCE, 0xF9, 0xE4, 0x28, 0x75, 0x5C, 0xA4, 0xA5, 0xA9, 0x64, 0x3C, 0x95, 0x59, 0xA5, 0xBC,
-    0xAF, 0x30, 0x96, 0x8C, 0x57, 0x7A, 0x70, 0xF0, 0x82, 0x71, 0xAB, 0xDE, 0xA3, 0x02, 0x37, 0x30,
-    0x1F, 0xD2, 0xF8, 0x14, 0x34, 0x30, 0x49, 0x07, 0x4C, 0xD2, 0xC0, 0x49, 0x37, 0xE4, 0xF9, 0x99,
-    0x75, 0x29, 0x3D, 0x6D, 0x29, 0xB9, 0xF7, 0x8A, 0x7F, 0x7E, 0xE5, 0xFF, 0x2F, 0x7C, 0xF2, 0x0D,
-    0xD9, 0xF6, 0x89, 0x5E, 0x78, 0x9C, 0xFB, 0xF9, 0x9F, 0xE3, 0x27, 0xD1, 0x88, 0x01, 0x07, 0x20,
-    0xDE, 0x04, 0x20, 0x02, 0x00, 0x97, 0x73, 0x3C, 0x01, 0x78, 0x9C, 0x25, 0x8E, 0x3F, 0x0E, 0x01,
-    0x71, 0x10, 0x85, 0x1F, 0x42, 0x42, 0x14, 0x7B, 0x03, 0xA5, 0xD6, 0x05, 0x84, 0x56, 0x83, 0x96,
-    0x86, 0x1B, 0x70, 0x03, 0x92, 0xAD, 0x54, 0x4B, 0xA9, 0xB2, 0x27, 0xC0, 0x05, 0x64, 0xB5, 0x4E,
-    0xB1, 0xA5, 0x82, 0xC4, 0x86, 0xF8, 0x53, 0xE0, 0x33, 0xBF, 0xF5, 0x8A, 0xF9, 0x5E, 0x66, 0x32,
-    0x2F, 0x4F, 0xF2, 0xCF, 0xEC, 0xAA, 0x52, 0x88, 0x53, 0x5D, 0xEF, 0x94, 0x95, 0x2E, 0xAC, 0x97,
-    0x6F, 0x4A, 0x21, 0x97, 0x8C, 0xBC, 0x63, 0x6E, 0x4B, 0x2C, 0xA7, 0x39, 0x14, 0x1C, 0x6B, 0x10,
-    0xE5, 0x9C, 0x79, 0x41, 0x5C, 0xF8, 0x1F, 0xB8, 0x98, 0xB9, 0xBB, 0xF7, 0x8D, 0x3C, 0xE8, 0x59,
-    0x54, 0x71, 0x4C, 0xA4, 0xE6, 0x87, 0x46, 0xC8, 0x48, 0xBA, 0x12, 0x6C, 0x59, 0x49, 0x36, 0xA6,
-    0x90, 0x37, 0x4E, 0x5C, 0x4E, 0xF6, 0x4A, 0x47, 0x4F, 0x33, 0x5F, 0xCA, 0x1A, 0xBA, 0xFF, 0x38,
-    0x23, 0x2D, 0x8C, 0x91, 0x51, 0xE3, 0x0F, 0xB6, 0x37, 0x0D, 0xBF, 0x0C, 0xD2, 0x12, 0x37, 0x02,
-    0xCF, 0x31, 0x61, 0x95, 0xB4, 0x8C, 0x0F, 0x46, 0x09, 0xD1, 0xEC, 0x60, 0xBD, 0x93, 0xB4, 0x3E,
-    0xF9, 0x7D, 0x8A, 0xB6, 0xE4, 0x9F, 0x88, 0xFB, 0xD2, 0x0F, 0xED, 0x23, 0x80, 0x81, 0x78, 0x9C,
-    0x5B, 0x78, 0x8F, 0x95, 0xE1, 0xEA, 0x3A, 0xC6, 0x9F, 0xFF, 0xF5, 0x15, 0xFE, 0xFF, 0xE7, 0xFA,
-    0xF3, 0x3F, 0xDE, 0xE1, 0xFF, 0x7F, 0xDE, 0x5F, 0x10, 0xDE, 0xC6, 0xF7, 0x6C, 0x0C, 0xCF, 0xF6,
-    0x33, 0x02, 0x00, 0x66, 0x4D, 0x13, 0x99, 0x78, 0x9C, 0x5D, 0x91, 0xBD, 0x4E, 0xC3, 0x40, 0x10,
-    0x84, 0xC7, 0x0E, 0x4A, 0x82, 0x4C, 0x91, 0x8E, 0x82, 0xC6, 0x5D, 0x9A, 0x88, 0xDA, 0x15, 0xF0,
-    0x04, 0x01, 0x7A, 0x90, 0xF2, 0x06, 0xF0, 0x08, 0xAE, 0xD3, 0x10, 0x29, 0xE2, 0x0D, 0xA8, 0xA8,
-    0x10, 0x1D, 0x48, 0x04, 0x44, 0x05, 0x0D, 0x6E, 0xD3, 0x51, 0x21, 0x51, 0x20, 0x1D, 0x38, 0x48,
-    0xF9, 0xC1, 0xF2, 0x64, 0x77, 0x73, 0x96, 0x50, 0xB6, 0xF0, 0xDD, 0xD8, 0x77, 0xB3, 0xDF, 0x8E,
-    0x01, 0xA9, 0xCB, 0x2F, 0x8E, 0x12, 0xF8, 0x6A, 0x7D, 0x52, 0xEB, 0xC4, 0xCB, 0x0F, 0x72, 0x74,
-    0x5F, 0x90, 0x3B, 0xA6, 0x52, 0xBA, 0xB6, 0x2C, 0x57, 0x74, 0x35, 0x95, 0x33, 0x36, 0xED, 0xF5,
-    0x33, 0xF7, 0xE5, 0xD9, 0x63, 0x17, 0xF1, 0xB8, 0x7C, 0x4B, 0x30, 0x77, 0x01, 0x90, 0xB3, 0x26,
-    0x07, 0xA4, 0xA2, 0x01, 0x23, 0x60, 0x71, 0x86, 0x81, 0x39, 0x37, 0x51, 0x1C, 0x22, 0xE6, 0x16,
-    0x7E, 0xC9, 0xFE, 0x2B, 0x03, 0x4C, 0x32, 0x9C, 0x73, 0x03, 0x85, 0x9A, 0x1C, 0x03, 0x37, 0x0C,
-    0x9E, 0x1C, 0x5A, 0x64, 0xC3, 0xBC, 0x8F, 0x58, 0xFF, 0x7E, 0xC4, 0x01, 0xE5, 0xA0, 0xE1, 0x71,
-    0xF3, 0xE7, 0x42, 0x5A, 0x39, 0xCF, 0xC7, 0x28, 0x57, 0xF9, 0xEE, 0x65, 0x19, 0xAD, 0x7D, 0x5D,
-    0xDD, 0x45, 0x75, 0x77, 0xE5, 0x5C, 0xAF, 0x9C, 0x53, 0xE9, 0xFB, 0xC7, 0x5D, 0xD9, 0x07, 0xD2,
-    0x37, 0x54, 0xAA, 0x89, 0x50, 0xDD, 0x31, 0x44, 0x9E, 0x19, 0x73, 0x6A, 0xCC, 0xA1, 0x32, 0xDB,
-    0x44, 0x53, 0x93, 0xA9, 0x4E, 0xD4, 0xE3, 0x1E, 0xE2, 0x97, 0x32, 0x4B, 0x30, 0xD3, 0x79, 0x31,
-    0xF7, 0xC4, 0xB7, 0x96, 0x86, 0x66, 0xB5, 0x2D, 0xCB, 0xD0, 0x67, 0xA5, 0x49, 0x3E, 0x5C, 0x4B,
-    0x92, 0x1D, 0x0F, 0x63, 0xD9, 0xF0, 0xB4, 0xCA, 0xFD, 0xDF, 0x5F, 0x58, 0x02, 0xB5, 0xD6, 0xA1,
-    0x7B, 0x78, 0x9C, 0x63, 0x70, 0x38, 0xF9, 0xEF, 0x1C, 0x1B, 0x83, 0xC2, 0xDF, 0xFF, 0xFF, 0xFF,
-    0xAF, 0x67, 0x60, 0xF8, 0xFB, 0xFF, 0xDF, 0xFF, 0xFF, 0x6C, 0x0C, 0x4B, 0x45, 0x19, 0xBE, 0xFD,
-    0xE7, 0x66, 0x60, 0x60, 0x10, 0x78, 0xF4, 0x9F, 0x8F, 0xA1, 0xE0, 0x35, 0x50, 0x92, 0xCF, 0x00,
-    0x28, 0x03, 0xA4, 0x0E, 0xFC, 0x5F, 0xAF, 0x72, 0xF1, 0x3F, 0xDF, 0xC7, 0xFF, 0x3C, 0x0C, 0x1F,
-    0x40, 0x14, 0xAF, 0xC0, 0xEF, 0xFF, 0x7C, 0x17, 0xFE, 0xBF, 0x07, 0x1A, 0xC0, 0x17, 0x00, 0x54,
-    0x60, 0x07, 0xD4, 0xB0, 0xE5, 0x7F, 0x2F, 0xE3, 0x6F, 0x3E, 0x00, 0x37, 0xCE, 0x35, 0x21, 0x78,
-    0x9C, 0x4D, 0x8E, 0xC1, 0x0D, 0x01, 0x51, 0x14, 0x45, 0xCF, 0x04, 0x93, 0x11, 0x1B, 0x15, 0x88,
-    0x0E, 0x94, 0xA0, 0x05, 0x1D, 0x68, 0x41, 0x27, 0x66, 0x6B, 0x65, 0x4A, 0xA1, 0x02, 0x54, 0x30,
-    0x51, 0x81, 0x85, 0xC9, 0xB0, 0x98, 0x38, 0xFE, 0xFF, 0x82, 0xD9, 0xDC, 0xDC, 0xBC, 0xDC, 0x9C,
-    0x77, 0x80, 0x63, 0x0E, 0xEC, 0xB2, 0x10, 0x74, 0xF5, 0x90, 0x8D, 0xDB, 0xD0, 0x2A, 0x5D, 0xD2,
-    0xE8, 0x18, 0x9E, 0x9A, 0xCF, 0xF5, 0x04, 0x2B, 0xDD, 0x73, 0xD1, 0x19, 0xDC, 0x75, 0x42, 0xA7,
-    0x03, 0xA6, 0x2F, 0xEB, 0xAC, 0xD4, 0x35, 0x1C, 0x74, 0xC1, 0x43, 0x0B, 0x68, 0x63, 0xEA, 0x2D,
-    0xA0, 0xCE, 0xFF, 0x6B, 0xDA, 0x56, 0x69, 0xDB, 0x23, 0x7C, 0xB8, 0xD7, 0xC4, 0xED, 0x7D, 0xFB,
-    0x39, 0x14, 0xC9, 0x6C, 0x14, 0xCD, 0xA2, 0xE5, 0xD7, 0xF7, 0x0D, 0x1E, 0xAB, 0x57, 0x47, 0x78,
-    0x9C, 0xFB, 0xFA, 0x1F, 0x0A, 0xE4, 0xBF, 0xE2, 0x65, 0x09, 0x08, 0x82, 0xC1, 0xC7, 0xFF, 0xF2,
-    0x0C, 0x10, 0xF0, 0x81, 0x1C, 0x16, 0x00, 0xCC, 0x59, 0x33, 0x0A, 0x78, 0x9C, 0xFB, 0xF7, 0x1F,
-    0x08, 0x18, 0xFF, 0x61, 0x90, 0x2B, 0x56, 0x01, 0x01, 0x03, 0x00, 0x87, 0xD9, 0x17, 0x3D, 0x78,
-    0x9C, 0x4D, 0x91, 0xB1, 0x4E, 0x02, 0x41, 0x10, 0x86, 0x7F, 0x38, 0x05, 0xCC, 0x19, 0x73, 0x9D,
-    0x85, 0x0D, 0x9D, 0x8D, 0xB1, 0xB6, 0xD2, 0x37, 0x10, 0x1E, 0x40, 0xB3, 0xBC, 0x01, 0xF4, 0x36,
-    0xF7, 0x06, 0x9A, 0x10, 0x6B, 0x1B, 0x2A, 0x2A, 0x62, 0x69, 0x22, 0x12, 0x5F, 0x00, 0x3B, 0x4B,
-    0x68, 0x4C, 0x2C, 0x4C, 0x56, 0x4E, 0x43, 0xC0, 0x9C, 0xF7, 0x3B, 0x33, 0xB7, 0x24, 0x4E, 0x71,
-    0x9B, 0xEF, 0x76, 0x67, 0x76, 0xE6, 0x5B, 0x40, 0xE2, 0xF6, 0x83, 0xE3, 0x13, 0x84, 0x48, 0xDE,
-    0xA9, 0x71, 0x11, 0xF0, 0x8D, 0x1C, 0x3F, 0xE4, 0xE4, 0x81, 0x51, 0x4A, 0x7F, 0x28, 0xCB, 0x80,
-    0x3E, 0x52, 0x5C, 0xB1, 0x61, 0xBF, 0x9F, 0x79, 0x26, 0xDF, 0x0E, 0xCF, 0xE7, 0xA4, 0xBF, 0x02,
-    0xD6, 0xBE, 0x02, 0x64, 0x8C, 0xE6, 0x5A, 0xE9, 0x18, 0x37, 0x8C, 0x81, 0x9F, 0x2E, 0x0C, 0x67,
-    0x40, 0xDE, 0x42, 0x93, 0xBB, 0x82, 0xDD, 0x3E, 0x19, 0xE1, 0x6B, 0x8A, 0x1E, 0xB7, 0x04, 0x1D,
-    0x0A, 0xD6, 0x30, 0x62, 0x65, 0xE2, 0x61, 0xF8, 0x2B, 0xD8, 0x66, 0xED, 0xF3, 0xC9, 0x30, 0xA1,
-    0x9C, 0x4A, 0xB8, 0xB3, 0xB8, 0x56, 0xBC, 0x7B, 0xA5, 0x9C, 0x02, 0xE3, 0xCC, 0x50, 0xA2, 0x25,
-    0x58, 0xC4, 0x8B, 0x0D, 0x56, 0x6D, 0xB7, 0xCC, 0x9D, 0x15, 0xDC, 0x86, 0xE6, 0x86, 0xCA, 0x4B,
-    0xEE, 0x41, 0x2B, 0xA7, 0xE5, 0xBD, 0x2F, 0x94, 0xA4, 0x11, 0xAB, 0x65, 0x57, 0xAE, 0xAD, 0xC9,
-    0xD9, 0x34, 0xF4, 0xEC, 0x90, 0x4B, 0xFF, 0xD2, 0x73, 0x39, 0x91, 0xC3, 0x37, 0x5D, 0xAA, 0x13,
-    0x75, 0x78, 0xAA, 0x38, 0xA1, 0xB7, 0x79, 0xB1, 0x66, 0xDD, 0x6C, 0xDC, 0x9B, 0x0D, 0x75, 0xB5,
-    0x2F, 0x4B, 0x3F, 0xB8, 0x52, 0x93, 0x8F, 0x43, 0x31, 0x79, 0x14, 0x3C, 0xAF, 0xCC, 0xF3, 0xE5,
-    0xC6, 0xFB, 0xBF, 0x57, 0xF8, 0x03, 0x6F, 0x0A, 0xB7, 0x88, 0x78, 0x9C, 0xDB, 0xB8, 0x1B, 0x06,
-    0x18, 0x3F, 0xFE, 0x87, 0x01, 0x1C, 0x4C, 0x00, 0x26, 0xC7, 0x25, 0x01, 0x78, 0x9C, 0x63, 0x60,
-    0x38, 0xFA, 0xAF, 0x86, 0x91, 0x81, 0xE1, 0xE0, 0xFF, 0xFF, 0xFF, 0xED, 0x18, 0x18, 0xFE, 0x02,
-    0xA9, 0xFF, 0x4C, 0x0D, 0xFF, 0xFF, 0xCF, 0xFA, 0xF7, 0x9F, 0xE7, 0xC1, 0x7F, 0x3D, 0x86, 0x03,
-    0xFF, 0xED, 0x3F, 0xFD, 0x67, 0x67, 0x30, 0xF8, 0x9F, 0xFF, 0xE5, 0x3F, 0x0B, 0x03, 0xC3, 0xFF,
-    0xFE, 0xCF, 0x10, 0xDE, 0x07, 0x88, 0xDC, 0x04, 0x88, 0x4A, 0x01, 0x88, 0x3E, 0x86, 0x4B, 0x40,
-    0xD2, 0x8F, 0x81, 0x81, 0xE1, 0xF8, 0xFF, 0x5E, 0x46, 0x06, 0x00, 0x53, 0x31, 0x33, 0xDE, 0x78,
-    0x9C, 0x63, 0x60, 0x60, 0x60, 0x30, 0x36, 0x66, 0x80, 0x00, 0x83, 0xFF, 0xEF, 0x29, 0x65, 0x7D,
-    0xFD, 0x0F, 0x05, 0xF2, 0xF8, 0x59, 0x02, 0x82, 0x82, 0x86, 0xFF, 0xDF, 0x0B, 0x0A, 0x0A, 0x32,
-    0x52, 0x68, 0x2F, 0x83, 0xB1, 0x32, 0x88, 0x04, 0x9A, 0x07, 0x01, 0x8C, 0xC4, 0xBA, 0x00, 0x00,
-    0x81, 0x7F, 0x67, 0xC1, 0x78, 0x9C, 0x63, 0x70, 0xB8, 0xF9, 0x7F, 0x1D, 0x33, 0x83, 0xC2, 0x9F,
-    0xFF, 0xFF, 0xFF, 0xE7, 0x33, 0x5C, 0xF8, 0x0F, 0x02, 0x4C, 0x0E, 0xFF, 0xCF, 0xDF, 0xFC, 0xFF,
-    0x9F, 0x9D, 0xE1, 0x1A, 0x33, 0xC3, 0xFF, 0xFF, 0x1C, 0x0C, 0x40, 0xF0, 0xFF, 0x3F, 0x1B, 0x90,
-    0x4C, 0xF8, 0xFF, 0x9F, 0x11, 0x48, 0x7D, 0xFE, 0x5F, 0x0F, 0x24, 0x1D, 0xFE, 0xFF, 0xE7, 0x02,
-    0x52, 0x5F, 0xFF, 0xAF, 0x87, 0xC8, 0x70, 0x02, 0xA9, 0xEF, 0x60, 0x99, 0x86, 0xFF, 0xFF, 0xF7,
-    0xED, 0xDE, 0xCD, 0xFD, 0x01, 0x6C, 0x18, 0x3F, 0x2A, 0x05, 0x00, 0x6A, 0x1A, 0x3C, 0x30, 0x78,
-    0x9C, 0x63, 0x58, 0xFA, 0xF7, 0xBE, 0x26, 0xC3, 0xE5, 0xFF, 0x40, 0xC0, 0xFA, 0x03, 0x44, 0xCA,
-    0x1F, 0xD8, 0x6F, 0xFA, 0xED, 0x7F, 0xBC, 0x02, 0x2B, 0xC3, 0x86, 0xFF, 0xF6, 0x0C, 0x0C, 0x02,
-    0x5F, 0xFF, 0xF3, 0x30, 0x7C, 0xFB, 0xFF, 0x7F, 0x3E, 0x03, 0x88, 0xD4, 0x64, 0x60, 0xF8, 0x0A,
-    0x54, 0xC3, 0xC1, 0xC0, 0xC0, 0x70, 0xE5, 0x7F, 0x3E, 0x90, 0x0C, 0xF8, 0xBF, 0x5F, 0x02, 0x44,
-    0xDE, 0xFF, 0x17, 0x65, 0xFC, 0xEC, 0xFF, 0xFA, 0x7F, 0x20, 0x13, 0xFC, 0xFF, 0x80, 0x48, 0xF6,
-    0x80, 0x5B, 0xFF, 0xCF, 0x69, 0x30, 0x00, 0x00, 0x63, 0xAB, 0x37, 0x83, 0x78, 0x9C, 0x01, 0x24,
-    0x00, 0xDB, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0A, 0x00, 0x80, 0xFF, 0xFF, 0x9F, 0x00, 0x00,
-    0xF5, 0xFF, 0xFF, 0x07, 0x00, 0x30, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0xE1, 0xFF, 0xCF, 0x01, 0x00,
-    0x00, 0xFB, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x4B, 0xE5, 0x10, 0x4B, 0x78, 0x9C, 0xFB, 0xF0, 0xFF,
-    0x3F, 0x17, 0x03, 0x03, 0xC3, 0x8F, 0xFF, 0xFF, 0x99, 0x3E, 0xD0, 0x8D, 0xF9, 0x13, 0xC1, 0xFC,
-    0x85, 0x60, 0xFE, 0x81, 0x30, 0xB9, 0x81, 0xCC, 0xFF, 0x10, 0x26, 0x3F, 0x03, 0x43, 0x02, 0x94,
-    0x39, 0x9F, 0x81, 0xE1, 0x33, 0x94, 0xF9, 0xBF, 0x77, 0xC7, 0x7F, 0x18, 0x13, 0x02, 0x60, 0xCC,
-    0xA3, 0x10, 0x26, 0xD0, 0xA0, 0xF9, 0x0D, 0x10, 0xA6, 0xC7, 0xEF, 0xF3, 0x6C, 0x0E, 0x10, 0x26,
-    0x07, 0x03, 0x04, 0x00, 0x99, 0x9C, 0x58, 0x99, 0x5C, 0x94, 0x31, 0x01, 0xC9, 0xC5, 0xA8, 0xD4,
-    0x78, 0x9C, 0x63, 0x60, 0x98, 0xF2, 0xF6, 0x3F, 0x08, 0xAC, 0x67, 0x38, 0xF8, 0x1F, 0x02, 0xD6,
-    0x0B, 0xFC, 0x85, 0xB1, 0x26, 0x80, 0xA9, 0xF7, 0xBB, 0xFF, 0xAC, 0xFF, 0x08, 0x66, 0xCD, 0x67,
-    0xF8, 0xBA, 0xFE, 0x1B, 0x9C, 0xF5, 0x13, 0xCE, 0xFA, 0x03, 0x67, 0xFD, 0x85, 0xB3, 0xFE, 0x61,
-    0x11, 0x43, 0xA8, 0xFB, 0x05, 0x67, 0x7D, 0x87, 0xB3, 0x3E, 0xC1, 0x59, 0x1B, 0xE0, 0x2C, 0x05,
-    0x38, 0x8B, 0xE1, 0x31, 0x9C, 0xC5, 0xB0, 0xED, 0xDF, 0xFD, 0xBF, 0x10, 0x16, 0x10, 0x7C, 0x1B,
-    0x6C, 0x2C, 0x00, 0xFB, 0xF2, 0xC8, 0x1F, 0x78, 0x9C, 0x2B, 0xF8, 0x1B, 0xCB, 0xF0, 0xED, 0xFF,
-    0x7F, 0x96, 0xDF, 0xFF, 0xFF, 0x73, 0xFE, 0x01, 0xE2, 0x1F, 0xFF, 0xFF, 0xB3, 0x1D, 0xFC, 0xBF,
-    0x9E, 0x81, 0xC1, 0x89, 0x89, 0x01, 0x00, 0x0D, 0x91, 0x10, 0x77, 0x78, 0x9C, 0x63, 0xF8, 0xF9,
-    0x9F, 0x91, 0x41, 0xE1, 0xFF, 0x7D, 0x06, 0x86, 0x86, 0xFF, 0xFF, 0xB5, 0x19, 0x18, 0x26, 0xFE,
-    0xFF, 0xCF, 0xC4, 0xC0, 0xF0, 0xE7, 0x3F, 0x97, 0x8B, 0xD1, 0xBF, 0xFF, 0xDC, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xCF, 0x01, 0x24, 0xEE, 0x33, 0x5E, 0xFF, 0x7F, 0x8E, 0x9D, 0x01, 0x00, 0xFF, 0x4B, 0x18,
-    0x39, 0x78, 0x9C, 0x63, 0x60, 0x48, 0xF8, 0x7F, 0x9F, 0x81, 0xE1, 0x27, 0x90, 0x38, 0xF4, 0xFF,
-    0xFF, 0x7D, 0x87, 0x7F, 0x40, 0xE2, 0xE3, 0xFF, 0xFD, 0x40, 0xD6, 0xFF, 0x16, 0xA0, 0x98, 0x6A,
-    0x03, 0x48, 0x76, 0x02, 0xF1, 0x04, 0x00, 0x8A, 0x8B, 0x2D, 0x5F, 0x78, 0x9C, 0x63, 0x28, 0x78,
-    0xF3, 0xDE, 0x8B, 0x81, 0x41, 0xE1, 0xEF, 0xFF, 0xFF, 0xFF, 0x39, 0x19, 0x2E, 0x00, 0xC9, 0xFF,
-    0xFD, 0x0C, 0xDF, 0xFE, 0xDB, 0x04, 0xFE, 0xFB, 0xCF, 0xF8, 0xFB, 0x3F, 0x13, 0xC3, 0xF7, 0xFF,
-    0x6C, 0x7F, 0xDF, 0x33, 0x30, 0x7C, 0xFE, 0xCF, 0xF9, 0xEF, 0x3E, 0x03, 0xC3, 0xA7, 0xFF, 0x5C,
-    0x50, 0xDE, 0x2F, 0x88, 0xDC, 0x57, 0xA0, 0xCA, 0xFF, 0xFF, 0x19, 0x0F, 0x40, 0xF4, 0x09, 0xFC,
-    0x01, 0x52, 0x5C, 0x0C, 0x0C, 0x09, 0x6F, 0xDE, 0x7B, 0x33, 0x30, 0x00, 0x00, 0x93, 0x70, 0x34,
-    0x8D, 0x78, 0x9C, 0x4D, 0x8E, 0xDD, 0x09, 0xC2, 0x60, 0x10, 0x04, 0xC7, 0x5F, 0x24, 0x28, 0xA4,
-    0x00, 0x8B, 0xB0, 0x03, 0x5B, 0x48, 0x09, 0xE9, 0xC0, 0x12, 0xB4, 0x03, 0xAD, 0xC1, 0x16, 0x2C,
-    0x40, 0x3B, 0xB0, 0x06, 0x6D, 0x20, 0x60, 0x40, 0x10, 0x8D, 0xE3, 0x99, 0x87, 0xE4, 0x7B, 0x39,
-    0xF6, 0x86, 0x65, 0x77, 0x29, 0x97, 0xC0, 0x69, 0x1A, 0xA7, 0x68, 0xAE, 0x70, 0x74, 0x1D, 0xB2,
-    0xD6, 0x8C, 0x8F, 0xD5, 0x10, 0x4A, 0xDD, 0x72, 0xD7, 0x45, 0xE0, 0x97, 0x4E, 0x56, 0x7A, 0x0E,
-    0x79, 0x31, 0x8C, 0x4F, 0x9D, 0x41, 0xFE, 0xB5, 0x1A, 0x1C, 0x74, 0x13, 0xF8, 0xA1, 0x73, 0xDE,
-    0x3A, 0x82, 0xDD, 0x9F, 0xB4, 0x7F, 0x47, 0xC7, 0xE4, 0x4D, 0xE7, 0x4D, 0x12, 0xFA, 0xDC, 0x68,
-    0xDB, 0x73, 0x6B, 0xDB, 0x92, 0x0D, 0xC9, 0x32, 0xFA, 0xBD, 0x3F, 0x42, 0xFB, 0x57, 0x65, 0x78,
-    0x9C, 0x4D, 0xD0, 0x5F, 0x0E, 0xC1, 0x40, 0x10, 0x06, 0xF0, 0x41, 0x44, 0x09, 0x4D, 0x4F, 0x20,
-    0x4D, 0x0F, 0x80, 0x07, 0xEF, 0x75, 0x04, 0x4F, 0x5E, 0xF5, 0x08, 0x6E, 0xA0, 0x47, 0x70, 0x03,
-    0x6E, 0x80, 0x13, 0x70, 0x83, 0xBA, 0x01, 0x4E, 0x20, 0x41, 0xAB, 0xFE, 0xB4, 0x9F, 0x9D, 0xDD,
-    0xEE, 0x66, 0xE7, 0x65, 0xF2, 0x4B, 0x26, 0xB3, 0xB3, 0x1F, 0xD1, 0xA4, 0x04, 0x71, 0x3D, 0x31,
-    0x94, 0x3D, 0x87, 0x72, 0x81, 0x36, 0xB7, 0x3D, 0x94, 0x23, 0xA0, 0x26, 0xDA, 0xA8, 0xAC, 0x7C,
-    0xC1, 0x92, 0xDB, 0x09, 0x07, 0xE5, 0x1C, 0x2E, 0xB7, 0x11, 0x66, 0xD2, 0x1E, 0xD0, 0x94, 0x6B,
-    0xC6, 0x91, 0xF4, 0x06, 0x09, 0xA9, 0x52, 0x7E, 0x20, 0xAC, 0xBC, 0x90, 0xFE, 0xA1, 0x63, 0x7B,
-    0x0A, 0xD4, 0x6D, 0x9F, 0xB0, 0x26, 0xDB, 0x19, 0xFA, 0x7C, 0xA1, 0xAB, 0x5D, 0xA2, 0x45, 0x31,
-    0x8C, 0x63, 0x9C, 0xF9, 0x09, 0xE3, 0x3B, 0xE6, 0x3C, 0x63, 0xFC, 0x41, 0x57, 0x5C, 0xF4, 0x55,
-    0x27, 0xF3, 0xD1, 0x68, 0x50, 0x9A, 0xBC, 0xB4, 0x8F, 0xD8, 0x92, 0x57, 0x86, 0xB9, 0x76, 0x2A,
-    0xA2, 0xD9, 0xC1, 0x31, 0x2E, 0xE0, 0x50, 0x76, 0xD6, 0x5F, 0x16, 0x1B, 0x6F, 0x35, 0x5F, 0x8C,
-    0x68, 0x5F, 0x45, 0x34, 0x2B, 0xC8, 0x0A, 0x55, 0x34, 0x3D, 0xF1, 0x9A, 0xB1, 0xCF, 0xD1, 0x58,
-    0x96, 0xD1, 0x78, 0x41, 0x10, 0xBC, 0x31, 0xA8, 0xDB, 0xD1, 0x54, 0xFB, 0x4C, 0x34, 0xEC, 0x3F,
-    0xF9, 0xFD, 0xA4, 0x5F, 0x78, 0x9C, 0x4D, 0x90, 0x4B, 0x0E, 0x01, 0x51, 0x10, 0x45, 0xCB, 0x2F,
-    0x3E, 0x41, 0xAC, 0x40, 0x7A, 0x2A, 0x91, 0x30, 0x30, 0x67, 0x07, 0x8C, 0x4C, 0xF5, 0x0E, 0xD8,
-    0x01, 0x4B, 0x30, 0x37, 0x60, 0x62, 0x2C, 0xC6, 0x06, 0xEC, 0x80, 0xC4, 0x02, 0x9A, 0x15, 0x48,
-    0xFC, 0xD2, 0x3E, 0xDD, 0xD7, 0xAB, 0xAA, 0x87, 0xAE, 0xC9, 0xC9, 0xA9, 0xE4, 0x55, 0xEE, 0xBB,
-    0x44, 0xAD, 0x10, 0xC4, 0x73, 0x45, 0x4D, 0xE8, 0x43, 0x3D, 0x40, 0x96, 0xB1, 0x84, 0xBA, 0x0B,
-    0xC4, 0x0C, 0xEA, 0xA1, 0xF5, 0x03, 0x86, 0x8C, 0x1D, 0xD6, 0xEA, 0x3E, 0x8A, 0x8C, 0x3A, 0xBA,
-    0xE2, 0x25, 0x20, 0x25, 0x67, 0x1A, 0xAE, 0xF8, 0x0C, 0x5B, 0xD2, 0x51, 0xBF, 0xA0, 0x69, 0x7D,
-    0x20, 0xFE, 0x46, 0x2E, 0xEA, 0x1D, 0x20, 0x1E, 0xF5, 0x1D, 0xA6, 0x14, 0xF5, 0x3B, 0xCA, 0x34,
-    0x0F, 0xBC, 0xCA, 0xD7, 0x43, 0xA4, 0xF7, 0x26, 0x18, 0x92, 0xEA, 0x23, 0x78, 0x25, 0x56, 0xCE,
-    0xC4, 0x7E, 0x46, 0xCF, 0x3C, 0x99, 0x84, 0x68, 0xAB, 0x3F, 0x91, 0xA7, 0x71, 0x55, 0xD6, 0x1A,
-    0x1A, 0x09, 0xE6, 0xD9, 0x86, 0xDA, 0x60, 0x21, 0x7C, 0xA0, 0x20, 0xBC, 0x69, 0x35, 0xEE, 0xF7,
-    0x4F, 0x01, 0x32, 0x8C, 0xBB, 0x56, 0x60, 0x2E, 0x9E, 0x62, 0x1A, 0x44, 0xD6, 0x74, 0xD4, 0xBD,
-    0x8F, 0x3E, 0xD9, 0x46, 0x0B, 0xD2, 0x00, 0xA7, 0x33, 0xE3, 0xE8, 0x99, 0x17, 0xBC, 0xD5, 0x6A,
-    0xF2, 0xAB, 0xC6, 0x91, 0xBC, 0xDE, 0xAF, 0x9A, 0xBF, 0x6B, 0x35, 0xD6, 0x3F, 0x96, 0x15, 0xA4,
-    0xD3, 0x78, 0x9C, 0x4D, 0x91, 0x4F, 0x2E, 0x43, 0x51, 0x14, 0xC6, 0x4F, 0xAB, 0x45, 0x78, 0xE4,
-    0x4D, 0x0C, 0x49, 0xF3, 0x62, 0x60, 0x22, 0xAC, 0x00, 0x43, 0x43, 0x89, 0x05, 0xD4, 0x9C, 0xE8,
-    0xEB, 0x0A, 0x74, 0x05, 0x0C, 0x2C, 0x80, 0x88, 0x39, 0x33, 0xD3, 0xEE, 0x80, 0x1D, 0x3C, 0x9D,
-    0x4B, 0xAA, 0x45, 0x4A, 0xB5, 0xFD, 0xF9, 0xEE, 0xF5, 0xEE, 0x6B, 0xBF, 0xC1, 0x39, 0xF7, 0x97,
-    0xDC, 0xF3, 0xE7, 0x7E, 0xD7, 0x9A, 0x6F, 0x9C, 0x99, 0xD3, 0x2B, 0x17, 0x8A, 0x29, 0xD2, 0xBA,
-    0xE3, 0x6F, 0x56, 0x14, 0x3B, 0x8E, 0x6F, 0x74, 0xA8, 0x41, 0x55, 0xE9, 0x80, 0xC3, 0x7B, 0xBA,
-    0x3A, 0xDC, 0xF2, 0xEC, 0xCB, 0xD6, 0x2C, 0x26, 0x53, 0xFE, 0x60, 0xDF, 0xFE, 0x75, 0x47, 0x43,
-    0x71, 0xC4, 0x92, 0xA7, 0x36, 0x64, 0x2A, 0x3C, 0x82, 0x72, 0xE0, 0x73, 0xA5, 0x17, 0xAE, 0x2C,
-    0x30, 0x7B, 0x66, 0x03, 0x36, 0xF2, 0x72, 0x6B, 0xAA, 0x7F, 0x3C, 0x61, 0x21, 0xB0, 0xFD, 0x52,
-    0x6D, 0xF9, 0x19, 0xD2, 0xB1, 0x6F, 0x3D, 0xDF, 0xA7, 0xAE, 0x55, 0x74, 0xE7, 0xEB, 0x72, 0xF3,
-    0x1A, 0x2A, 0x43, 0x22, 0xB7, 0xAA, 0xD8, 0xED, 0x9B, 0xED, 0xC2, 0x9C, 0x0D, 0x1D, 0x7F, 0x3A,
-    0xDE, 0x6E, 0xF3, 0x60, 0x27, 0x38, 0x8E, 0x9F, 0x26, 0xDD, 0x53, 0xDD, 0xDA, 0xB1, 0x5E, 0x36,
-    0x9D, 0x31, 0x66, 0xD1, 0x46, 0xF5, 0x82, 0x53, 0x6D, 0x90, 0x12, 0x11, 0xB8, 0xA3, 0x17, 0xF5,
-    0x29, 0x17, 0xFC, 0x23, 0x6B, 0xC6, 0x0D, 0x0B, 0x2C, 0x6B, 0x2A, 0x2D, 0x96, 0x0B, 0x7E, 0x94,
-    0x35, 0xEF, 0x78, 0x45, 0x96, 0x5B, 0xD3, 0x9B, 0x61, 0x67, 0xCD, 0x0C, 0xCB, 0x9A, 0x92, 0xD5,
-    0x92, 0x24, 0x81, 0xAD, 0x92, 0xFF, 0x88, 0xDC, 0x9A, 0xBC, 0xDF, 0x80, 0xD5, 0x29, 0xFF, 0x01,
-    0x94, 0xA7, 0xB1, 0x52, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x08, 0xF8, 0x5B, 0xCB, 0x00, 0x06, 0x9F,
-    0xFF, 0xFF, 0x67, 0x03, 0x33, 0x7E, 0xFE, 0xFF, 0xCF, 0x0D, 0x63, 0xF0, 0x80, 0x19, 0xDF, 0xFE,
-    0xFF, 0xE7, 0x04, 0x33, 0x16, 0xFC, 0x3F, 0xCF, 0x08, 0x51, 0xED, 0xC4, 0xC4, 0x80, 0x03, 0x2C,
-    0xF8, 0xFF, 0x9F, 0x19, 0xCC, 0xD8, 0x00, 0x63, 0x3C, 0xF8, 0xFF, 0x9F, 0x11, 0x6A, 0xE0, 0x7B,
-    0x98, 0x4C, 0x3D, 0x88, 0x56, 0xF8, 0x0B, 0xB5, 0x01, 0x68, 0xF7, 0x7E, 0x10, 0x6D, 0xF0, 0x1F,
-    0x6A, 0x13, 0x50, 0x4B, 0x3C, 0xCC, 0x6A, 0x56, 0x30, 0xE3, 0xD7, 0xFF, 0xF3, 0x10, 0xF3, 0xFF,
-    0xFC, 0xEF, 0x87, 0x30, 0xFE, 0xFE, 0x9F, 0x0F, 0xA2, 0x14, 0x19, 0x7E, 0x83, 0x2D, 0xDA, 0x7A,
-    0x9E, 0xE1, 0x3B, 0xD0, 0x98, 0x95, 0x7F, 0x80, 0xBC, 0x87, 0xFF, 0x21, 0x80, 0xDB, 0x01, 0xCA,
-    0x90, 0x67, 0xB8, 0x0C, 0xA6, 0xFB, 0x80, 0x0E, 0x99, 0xF2, 0xE6, 0xFF, 0x5E, 0x73, 0x06, 0x06,
-    0x00, 0xDB, 0x7C, 0x5B, 0xF4, 0x78, 0x9C, 0x8D, 0x91, 0xD1, 0x51, 0x02, 0x31, 0x14, 0x45, 0xB3,
-    0x8A, 0x38, 0x02, 0xBA, 0x56, 0x00, 0x76, 0x20, 0x1D, 0xC0, 0x1F, 0x9F, 0x96, 0x20, 0x1D, 0x60,
-    0x07, 0x50, 0x00, 0x33, 0xD8, 0x01, 0x76, 0x80, 0x76, 0x60, 0x07, 0xDA, 0x80, 0x03, 0x1D, 0xEC,
-    0x3A, 0x22, 0x2B, 0xCA, 0x72, 0x78, 0xEF, 0x65, 0x37, 0xEC, 0xA7, 0xF7, 0x23, 0xC9, 0x49, 0x32,
-    0x2F, 0xF7, 0xBE, 0x38, 0xE7, 0x7E, 0xA0, 0xED, 0x82, 0x1E, 0x60, 0x71, 0x24, 0xF7, 0x0D, 0xE7,
-    0x47, 0xEA, 0xE6, 0xDC, 0x55, 0x0E, 0x5F, 0xE0, 0xA4, 0x82, 0x19, 0x97, 0xEE, 0x3F, 0x7A, 0x04,
-    0x5A, 0x81, 0x56, 0x42, 0xB7, 0x81, 0xD6, 0x42, 0xE3, 0x40, 0xBF, 0x42, 0xCB, 0x40, 0xB2, 0x86,
-    0xD3, 0x02, 0x86, 0x30, 0x85, 0x8B, 0x82, 0x9E, 0x61, 0x00, 0x57, 0x05, 0x7D, 0xCA, 0xB5, 0x7D,
-    0x70, 0x9A, 0x91, 0x48, 0xA1, 0x32, 0xD4, 0x8E, 0xB9, 0x86, 0xF2, 0x70, 0x83, 0xDC, 0x4A, 0xE1,
-    0xCC, 0x68, 0x02, 0xB1, 0x56, 0x6A, 0x1A, 0xBD, 0x43, 0x43, 0x5F, 0xE9, 0x18, 0x7D, 0x41, 0xDD,
-    0x5D, 0xC3, 0xC8, 0x68, 0x0B, 0x91, 0x96, 0x7A, 0x33, 0xDA, 0xDB, 0x9C, 0xF9, 0x66, 0xF4, 0x29,
-    0xA5, 0x7D, 0x7B, 0x0A, 0xA4, 0xAD, 0x49, 0x03, 0xF5, 0x9C, 0xB5, 0xB6, 0xD0, 0x4C, 0xE8, 0x0F,
-    0x3E, 0x54, 0x88, 0x5B, 0x7D, 0x28, 0xB1, 0xD2, 0xB2, 0x5B, 0x53, 0x13, 0xDE, 0xFD, 0x46, 0x03,
-    0xBF, 0xC2, 0x7D, 0x99, 0x32, 0xF6, 0x83, 0xCA, 0xB6, 0x33, 0xF5, 0xAC, 0xB2, 0x5F, 0xCC, 0xCB,
-    0x60, 0x12, 0x93, 0xE8, 0x00, 0xBA, 0x3C, 0xB7, 0x90, 0x78, 0x9C, 0x8D, 0xD0, 0xD1, 0x51, 0xC2,
-    0x40, 0x10, 0xC6, 0xF1, 0x8B, 0xA2, 0x28, 0x88, 0xD0, 0x81, 0x74, 0x60, 0x05, 0x8C, 0xBC, 0xF9,
-    0x48, 0x09, 0xD0, 0x81, 0x74, 0xA0, 0x05, 0x30, 0x83, 0x1D, 0x40, 0x07, 0xDA, 0x01, 0x74, 0x80,
-    0x0D, 0x30, 0xDA, 0x41, 0x82, 0x1A, 0x32, 0xA8, 0xC9, 0xDF, 0xDD, 0xCB, 0x65, 0xE3, 0xA3, 0xDF,
-    0x43, 0x92, 0x5F, 0x72, 0xD9, 0xDB, 0x3D, 0xE7, 0x34, 0xBD, 0x02, 0xCE, 0x5C, 0x95, 0x25, 0xDC,
-    0x1B, 0x5C, 0x06, 0x27, 0x86, 0x21, 0x0C, 0xEA, 0x4F, 0xEF, 0xAC, 0xA2, 0x5A, 0x39, 0x4D, 0xF7,
-    0xAF, 0x3C, 0x02, 0x17, 0xA6, 0x37, 0xD1, 0xB5, 0xE9, 0x93, 0xBF, 0x9B, 0x7F, 0x89, 0x5E, 0x4D,
-    0xF2, 0x0C, 0xC7, 0x01, 0x13, 0x98, 0xC1, 0x79, 0xD0, 0x33, 0xDC, 0xC2, 0x65, 0xD0, 0x4E, 0x96,
-    0x15, 0x8C, 0x6C, 0x80, 0x58, 0x0A, 0x3D, 0x05, 0xFD, 0xB0, 0x70, 0x29, 0x94, 0xE8, 0x23, 0xAB,
-    0x92, 0x6A, 0xC0, 0x07, 0xE8, 0x6A, 0xA5, 0xB6, 0xD7, 0x0B, 0xB4, 0x74, 0x97, 0x2B, 0xAF, 0x0F,
-    0x38, 0x75, 0x3D, 0xB8, 0xF3, 0x3A, 0x40, 0xA4, 0xA5, 0x36, 0x5E, 0x85, 0xBF, 0xCB, 0x39, 0x1D,
-    0x95, 0x27, 0x14, 0xA2, 0xA7, 0xB1, 0x34, 0x75, 0x44, 0x89, 0xE9, 0x46, 0x94, 0x9A, 0xE6, 0xA2,
-    0x6F, 0xD8, 0x6A, 0x90, 0x6E, 0x75, 0xA3, 0xD8, 0x97, 0x96, 0xB7, 0x0D, 0x6D, 0xA2, 0xEC, 0x7E,
-    0xAF, 0x03, 0xAF, 0x61, 0x5C, 0x4D, 0xD9, 0x2D, 0x2F, 0x1A, 0xFF, 0x3A, 0xD3, 0x9E, 0x35, 0x53,
-    0xFD, 0x25, 0xAF, 0x06, 0x93, 0x31, 0x89, 0x7E, 0x01, 0x9F, 0xD4, 0xB7, 0x90, 0x78, 0x9C, 0x85,
-    0x91, 0xDD, 0x4D, 0x02, 0x41, 0x14, 0x85, 0xEF, 0xE2, 0x0F, 0x41, 0xD0, 0xA5, 0x03, 0xED, 0x80,
-    0x0A, 0x88, 0xBE, 0x10, 0x1E, 0xB7, 0x04, 0xEC, 0x40, 0x3B, 0xC0, 0x02, 0x48, 0xA0, 0x03, 0xE9,
-    0x40, 0x4B, 0x30, 0x36, 0x80, 0x0D, 0x18, 0xB5, 0x82, 0x5D, 0xC3, 0xCF, 0xC6, 0x1F, 0xF6, 0xE3,
-    0xDE, 0xD9, 0x99, 0x49, 0x78, 0xE2, 0x3C, 0xEC, 0xEC, 0x37, 0xD9, 0xB9, 0xE7, 0x9C, 0x59, 0x11,
-    0x91, 0x07, 0xA0, 0x23, 0x41, 0x2B, 0xA5, 0x69, 0x80, 0x2B, 0x4C, 0x27, 0x9E, 0xBE, 0x60, 0x50,
-    0x91, 0xD5, 0xD0, 0xDD, 0xD2, 0x97, 0x57, 0x38, 0x72, 0xF4, 0xE6, 0xCE, 0x94, 0x5C, 0xCA, 0x61,
-    0xCD, 0xF6, 0xFC, 0x3E, 0x95, 0x7A, 0x7B, 0xEE, 0xE3, 0x48, 0xBF, 0x4A, 0x1F, 0x91, 0xF4, 0x3D,
-    0xD8, 0x89, 0xDC, 0xC2, 0x04, 0x5A, 0x9E, 0x9E, 0x61, 0x08, 0x17, 0x9E, 0xBE, 0xF5, 0xB3, 0x98,
-    0x53, 0x43, 0xE5, 0x3A, 0xE8, 0xC9, 0xD3, 0x3F, 0x8F, 0xB2, 0x86, 0x58, 0x2F, 0x93, 0x22, 0x14,
-    0xD4, 0x7B, 0x48, 0x6D, 0x52, 0xDB, 0x37, 0xE2, 0xCC, 0x5C, 0xEA, 0x46, 0x4B, 0x38, 0x95, 0x2E,
-    0xDC, 0x39, 0xFA, 0x81, 0xC4, 0x46, 0x2D, 0x1C, 0x55, 0x6E, 0x2D, 0xA1, 0xA1, 0xCB, 0x0D, 0x41,
-    0x4D, 0xA5, 0x79, 0xA4, 0x73, 0xA5, 0x22, 0xD2, 0xB5, 0xD2, 0x3A, 0x92, 0x5D, 0xDD, 0x1F, 0xBC,
-    0x9B, 0xD0, 0xB4, 0x66, 0x94, 0xBB, 0xD1, 0xBA, 0x7B, 0x6C, 0x21, 0xEA, 0xF4, 0x1B, 0x2B, 0xFC,
-    0x02, 0xA3, 0xD0, 0x32, 0xAD, 0x1F, 0x26, 0xB7, 0x5D, 0x5A, 0x66, 0xD3, 0xBD, 0x1D, 0xD9, 0x86,
-    0x62, 0xF6, 0x17, 0x93, 0x1D, 0xEC, 0xF4, 0xC3, 0x4E, 0x78, 0x9C, 0x8D, 0x91, 0xCD, 0x51, 0x02,
-    0x41, 0x10, 0x85, 0x07, 0x5D, 0xB4, 0x50, 0x91, 0xCD, 0x40, 0x32, 0x80, 0x0C, 0xF4, 0xE6, 0x51,
-    0x33, 0xD0, 0x0C, 0x34, 0x03, 0x0D, 0x80, 0x2A, 0xC9, 0x40, 0x22, 0x40, 0x43, 0x30, 0x03, 0x30,
-    0x00, 0x4B, 0x8F, 0xDE, 0xC0, 0x52, 0xDC, 0x52, 0x84, 0xCF, 0xD7, 0xD3, 0x3B, 0xE3, 0xD5, 0x77,
-    0x98, 0x9D, 0x6F, 0x7E, 0x7A, 0x5E, 0xBF, 0x0D, 0x21, 0x94, 0xAF, 0x93, 0x66, 0x28, 0xD9, 0x0D,
-    0x51, 0x8F, 0xF0, 0x5C, 0x0C, 0x69, 0x39, 0x7D, 0x01, 0xB3, 0x15, 0x45, 0x84, 0xD2, 0xA6, 0xDA,
-    0xF6, 0xAD, 0x53, 0xDA, 0xDD, 0x25, 0x1C, 0x3A, 0x5D, 0xD2, 0x0C, 0xFD, 0xE5, 0x78, 0x23, 0xFC,
-    0x43, 0x43, 0x15, 0xD9, 0xCB, 0xF4, 0x22, 0xEA, 0x65, 0xFA, 0x10, 0x5D, 0x65, 0xFA, 0xFE, 0x7B,
-    0x4E, 0xD2, 0x1C, 0x36, 0x6B, 0x38, 0x87, 0x01, 0xC9, 0x66, 0xB8, 0x87, 0x63, 0xD8, 0xAF, 0xE9,
-    0x4D, 0xC7, 0xD6, 0x9C, 0xD4, 0x54, 0x31, 0x53, 0xA1, 0xBB, 0x9A, 0x7E, 0xB8, 0x0D, 0x0B, 0x70,
-    0xE8, 0xA2, 0x53, 0x73, 0xE4, 0xDD, 0x74, 0x0D, 0x1D, 0xAB, 0xE4, 0x49, 0x4C, 0x61, 0xC7, 0x5E,
-    0x39, 0x88, 0xF4, 0x0E, 0x5B, 0x0A, 0x80, 0x8B, 0x14, 0x4B, 0xC3, 0x4A, 0x4D, 0x22, 0xAD, 0xE3,
-    0xB7, 0x02, 0xEB, 0xFE, 0x88, 0xA4, 0x6D, 0xD1, 0x28, 0x53, 0x5B, 0x34, 0xCF, 0x64, 0xA9, 0x2D,
-    0x32, 0xDD, 0x88, 0x14, 0xE5, 0x93, 0x49, 0x79, 0x5B, 0xD2, 0x36, 0xFA, 0x6A, 0x61, 0x26, 0xDC,
-    0xFD, 0xA7, 0x35, 0xFC, 0x00, 0x67, 0xA9, 0xCB, 0x8E, 0x0F, 0xA6, 0xB8, 0x5C, 0x99, 0x67, 0xFF,
-    0x1D, 0xBA, 0xB2, 0x4A, 0x8D, 0xA9, 0x4D, 0x1A, 0xBF, 0x52, 0x37, 0xC5, 0x25, 0x78, 0x9C, 0x95,
-    0x90, 0xCD, 0x51, 0x02, 0x41, 0x10, 0x85, 0x1B, 0x10, 0x28, 0x51, 0xC4, 0x3B, 0x07, 0x08, 0x80,
-    0x2A, 0x42, 0x80, 0x9B, 0x47, 0xC9, 0x40, 0x33, 0xD0, 0x0C, 0x20, 0x00, 0xAB, 0x34, 0x03, 0x37,
-    0x03, 0xC8, 0x40, 0x32, 0xD0, 0x04, 0x14, 0x13, 0xB0, 0x16, 0x4B, 0x70, 0x15, 0xDC, 0xFD, 0xEC,
-    0x9E, 0x9D, 0x99, 0x2A, 0x8F, 0xBE, 0xC3, 0xCC, 0x7C, 0xF3, 0xD3, 0xF3, 0x5E, 0x8B, 0xC8, 0xF8,
-    0xAD, 0x2B, 0xC9, 0x4B, 0x53, 0x4A, 0xAD, 0x79, 0x90, 0x2F, 0xCE, 0x3D, 0x7D, 0x90, 0xCA, 0x9E,
-    0xA9, 0xA7, 0xF7, 0x3F, 0x67, 0x93, 0x7C, 0x20, 0x49, 0x1A, 0xDE, 0xFD, 0x43, 0x77, 0xC0, 0x71,
-    0xA4, 0x57, 0xA5, 0x61, 0xA4, 0x8D, 0xD2, 0x34, 0xD2, 0x4E, 0x69, 0x15, 0x49, 0xD7, 0x50, 0xF3,
-    0x70, 0x09, 0x37, 0x70, 0xE8, 0x69, 0x01, 0x67, 0x70, 0x12, 0x7D, 0x52, 0x2B, 0xA2, 0xCF, 0x4C,
-    0x33, 0xEC, 0x98, 0x7B, 0xFA, 0xE1, 0x5E, 0xB6, 0x50, 0x42, 0x1F, 0xBD, 0xB5, 0x86, 0xBA, 0xA3,
-    0x19, 0x74, 0xAC, 0xD2, 0x91, 0xA3, 0x27, 0x68, 0xD9, 0x2F, 0x3D, 0xDF, 0x08, 0x1A, 0x72, 0x0A,
-    0x57, 0x8E, 0xBE, 0xA1, 0x62, 0xA5, 0x1E, 0x1D, 0x15, 0x6E, 0xCE, 0xA0, 0xAA, 0xD3, 0x98, 0x20,
-    0xEB, 0x4C, 0x12, 0xA9, 0x2D, 0xD6, 0xDB, 0xA0, 0x91, 0xD2, 0x36, 0xD2, 0xAD, 0xD2, 0x1E, 0x9E,
-    0x4D, 0xA8, 0x5B, 0xFB, 0x28, 0x75, 0xA5, 0x75, 0xF7, 0xC0, 0x4C, 0x94, 0xEE, 0x3F, 0x2D, 0xF0,
-    0x12, 0x2E, 0x42, 0xCA, 0x4E, 0x39, 0x98, 0xDC, 0x76, 0x66, 0x9E, 0x4D, 0xD7, 0xF6, 0x24, 0x0F,
-    0xC1, 0x34, 0x26, 0x95, 0x5F, 0x6B, 0xEA, 0xBC, 0x55, 0x78, 0x9C, 0x75, 0xD1, 0xD1, 0x51, 0xC2,
-    0x40, 0x10, 0x80, 0xE1, 0x03, 0x14, 0x06, 0x1C, 0x05, 0x1A, 0x40, 0x3A, 0xA0, 0x04, 0x7C, 0xF3,
-    0xD1, 0x27, 0x9E, 0x63, 0x07, 0xD0, 0x81, 0x16, 0xC0, 0x0C, 0x25, 0x40, 0x07, 0xD8, 0x01, 0x74,
-    0x10, 0x1A, 0x70, 0x2C, 0x21, 0x38, 0x04, 0x19, 0x8D, 0xF0, 0xB3, 0x7B, 0x77, 0x59, 0x9E, 0xD8,
-    0x87, 0x24, 0x5F, 0xE6, 0x6E, 0x6F, 0x77, 0xCF, 0x39, 0x89, 0xFE, 0xA8, 0xEA, 0x2C, 0x3A, 0x05,
-    0xE9, 0x85, 0x6B, 0xA0, 0x67, 0xCA, 0xB3, 0xD1, 0x71, 0x66, 0x3A, 0x8C, 0x5D, 0xBE, 0xBA, 0x28,
-    0x71, 0xBB, 0xD4, 0xB4, 0x4F, 0xBB, 0xC5, 0xDC, 0xB4, 0x95, 0x2C, 0x83, 0x2B, 0xCA, 0x45, 0x6F,
-    0xA6, 0x3F, 0xD1, 0x97, 0x49, 0xBE, 0xA1, 0x16, 0xF1, 0x0A, 0x53, 0x68, 0x46, 0x7D, 0xC0, 0x33,
-    0x3C, 0x44, 0x7D, 0xCB, 0xB2, 0x13, 0x2F, 0x65, 0x29, 0x64, 0x92, 0x68, 0x19, 0xF5, 0xCF, 0xDC,
-    0xED, 0x21, 0xA0, 0x8F, 0xAC, 0x92, 0x02, 0x6E, 0xBD, 0xDE, 0xA1, 0xAD, 0x99, 0xEE, 0xBC, 0x36,
-    0xD0, 0xD2, 0x53, 0x1E, 0xBD, 0x76, 0x50, 0x77, 0x1D, 0x18, 0x7B, 0xFD, 0x42, 0x45, 0x53, 0x85,
-    0x0E, 0x4F, 0xFE, 0x7D, 0x00, 0x1D, 0xD4, 0x13, 0x65, 0x34, 0x44, 0x0B, 0xD3, 0x7D, 0x6C, 0x35,
-    0xC4, 0x50, 0x87, 0x62, 0xD2, 0x21, 0x16, 0xF0, 0xA9, 0x81, 0x54, 0xAB, 0x07, 0x65, 0x3E, 0xB5,
-    0xFC, 0xBD, 0xD1, 0x22, 0x42, 0xF5, 0x3F, 0xDA, 0xB0, 0xDC, 0x41, 0x52, 0x76, 0xD9, 0x0E, 0x8F,
-    0x78, 0x35, 0x89, 0xD6, 0xD0, 0xF2, 0x9A, 0xE8, 0x96, 0x63, 0xD9, 0x98, 0xB4, 0x49, 0xE5, 0x0C,
-    0x8F, 0xDE, 0xBC, 0x5A, 0x78, 0x9C, 0x5D, 0xCF, 0xCD, 0x0D, 0x01, 0x41, 0x18, 0x87, 0xF1, 0x97,
-    0x90, 0x10, 0x89, 0xE8, 0xC0, 0xDE, 0x1D, 0xB4, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x25, 0x50, 0x82,
-    0x12, 0xDC, 0x95, 0xC0, 0x41, 0x01, 0x12, 0x1A, 0x60, 0x55, 0x20, 0x11, 0x9F, 0xF1, 0xB1, 0x8F,
-    0x77, 0x76, 0x2D, 0xF3, 0xCE, 0x73, 0x9A, 0xF9, 0x5D, 0xE6, 0x3F, 0x22, 0x5A, 0x83, 0x7F, 0xEE,
-    0x2E, 0xE3, 0x10, 0xF6, 0x21, 0x5C, 0x43, 0x78, 0xC3, 0x01, 0xE2, 0xB9, 0x36, 0x73, 0xF7, 0x1E,
-    0xB4, 0x3B, 0x30, 0x92, 0xBC, 0x25, 0xD4, 0x0C, 0x9C, 0xA0, 0x64, 0xE0, 0x41, 0x2C, 0x3E, 0x44,
-    0xEE, 0xEC, 0xC3, 0x04, 0x9A, 0x06, 0x8E, 0x50, 0x75, 0x90, 0xD6, 0x55, 0xB8, 0x41, 0xD1, 0x40,
-    0xC2, 0x5A, 0x7C, 0xD0, 0x59, 0x7D, 0x03, 0x1B, 0xA8, 0xA7, 0x90, 0x4E, 0x6F, 0x89, 0x9C, 0xF3,
-    0x6F, 0xE5, 0xAF, 0x3C, 0x03, 0x88, 0x08, 0x60, 0x1A, 0x82, 0xCE, 0xDA, 0x6D, 0xB5, 0x1F, 0xDC,
-    0xA1, 0x2C, 0xE2, 0x4D, 0x4F, 0xF4, 0xAB, 0x19, 0xC4, 0x2B, 0x6D, 0x31, 0x80, 0xE1, 0x17, 0xB2,
-    0xB2, 0x59, 0x1E, 0x5C, 0xA0, 0x62, 0xE0, 0x05, 0x05, 0x03, 0x1F, 0x03, 0x29, 0xF8, 0x5E, 0x78,
-    0x9C, 0x65, 0x90, 0x3F, 0x0E, 0x01, 0x41, 0x18, 0xC5, 0x1F, 0x2B, 0x04, 0x89, 0x6C, 0xA3, 0xA5,
-    0xD1, 0x73, 0x03, 0x7B, 0x0D, 0xB7, 0x90, 0x68, 0x25, 0xEB, 0x06, 0x2A, 0x35, 0x37, 0xA0, 0x53,
-    0xAE, 0x0B, 0xD0, 0x68, 0x09, 0xA1, 0x51, 0x90, 0x8D, 0x08, 0xD6, 0xFA, 0xF3, 0xCC, 0xEC, 0x7C,
-    0xBB, 0x0A, 0xAF, 0x98, 0xFC, 0x32, 0x33, 0x6F, 0xDE, 0xBC, 0x0F, 0x00, 0x06, 0x47, 0x2E, 0x5A,
-    0xD0, 0x0A, 0xA8, 0x35, 0xB6, 0x80, 0x25, 0x8D, 0x0A, 0x70, 0x84, 0x68, 0x61, 0xA7, 0x56, 0x7F,
-    0x4D, 0x6E, 0x80, 0x27, 0xE9, 0x59, 0x68, 0x1C, 0xDC, 0xE8, 0x3C, 0xA7, 0xCD, 0x65, 0x4C, 0x94,
-    0x17, 0x46, 0x67, 0xB2, 0x2A, 0x78, 0x25, 0x8B, 0x82, 0x81, 0x5C, 0x55, 0x0A, 0xC9, 0x8C, 0xE0,
-    0x8B, 0x4C, 0xFF, 0xE3, 0xF3, 0x87, 0xA1, 0x0E, 0x37, 0x7A, 0x90, 0x59, 0xC1, 0x1B, 0x99, 0x17,
-    0xBC, 0x90, 0x25, 0xC1, 0x2D, 0xE9, 0x0A, 0xF6, 0x28, 0x19, 0x36, 0x6C, 0x85, 0x43, 0xF5, 0x5C,
-    0x67, 0x15, 0xF9, 0xE8, 0xCF, 0x3F, 0xBA, 0xC5, 0x48, 0xAA, 0x6D, 0x92, 0xEE, 0x11, 0x3A, 0x2F,
-    0x33, 0x07, 0xED, 0x6D, 0x4C, 0x4F, 0x6A, 0x3A, 0x29, 0x79, 0xB0, 0x8E, 0xA4, 0x5F, 0x1C, 0x88,
-    0x3B, 0xBD, 0xF8, 0xA3, 0x76, 0xC0, 0x66, 0xBC, 0x3D, 0x8B, 0x67, 0xE1, 0xD4, 0xF6, 0xF4, 0x0C,
-    0xEA, 0xBC, 0xFE, 0x0F, 0x2B, 0x06, 0xDB, 0x6F, 0xBF, 0xAB, 0x03, 0xBE, 0x0E, 0x8F, 0x98, 0x56,
-    0x78, 0x9C, 0x13, 0xF8, 0xF7, 0xFF, 0x3F, 0x3B, 0x03, 0x08, 0x5C, 0xFC, 0xFF, 0xDF, 0x1E, 0xCC,
-    0x60, 0xF8, 0xFD, 0xFF, 0x3D, 0x23, 0x98, 0xD1, 0xF0, 0xFF, 0x3F, 0x0F, 0x44, 0xE8, 0xEB, 0xFF,
-    0xF5, 0x10, 0x86, 0xC2, 0x9F, 0xFF, 0x6C, 0x0C, 0x58, 0xC0, 0xCF, 0xFF, 0x10, 0x40, 0x80, 0xB1,
-    0x67, 0x37, 0x10, 0x80, 0x18, 0x4C, 0x30, 0x5D, 0x24, 0x31, 0x40, 0x20, 0x9E, 0x00, 0x03, 0x64,
-    0x85, 0x35, 0xF9, 0x56, 0x9C, 0x01, 0x01, 0xA2, 0xBC, 0x03, 0x00, 0xED, 0x16, 0xA4, 0x8F, 0x78,
-    0x9C, 0x63, 0x60, 0x60, 0x60, 0xF8, 0xF4, 0xFF, 0x7F, 0x3C, 0x03, 0x08, 0xFC, 0xFD, 0xFF, 0x9F,
-    0x15, 0x44, 0x2F, 0xF8, 0xFF, 0xDF, 0x0E, 0x2C, 0xF0, 0xFD, 0xFF, 0x79, 0x46, 0x10, 0xED, 0xF0,
-    0xFF, 0x3F, 0x27, 0x58, 0xE0, 0x23, 0x54, 0x25, 0x06, 0xF8, 0xF9, 0x1F, 0x02, 0x08, 0x30, 0xF6,
-    0xEC, 0x06, 0x02, 0x10, 0x83, 0x09, 0xA6, 0x8B, 0x24, 0x06, 0x08, 0xC4, 0x13, 0x60, 0x80, 0xAC,
-    0xB0, 0x26, 0xDF, 0x8A, 0x33, 0x20, 0x40, 0x94, 0x77, 0x00, 0x11, 0x9A, 0xA4, 0xBD, 0x78, 0x9C,
-    0x63, 0x60, 0xF8, 0xFA, 0xFF, 0xFF, 0x7B, 0x46, 0x06, 0x06, 0x06, 0x85, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xE7, 0x06, 0x32, 0x2E, 0x02, 0xE9, 0xFF, 0xFD, 0x40, 0xC6, 0x9F, 0xFF, 0xFD, 0x97, 0xFE, 0xFF,
-    0x67, 0x67, 0xD8, 0xF0, 0xFF, 0x3D, 0x2B, 0xC3, 0xAF, 0xFF, 0xF9, 0x40, 0x2C, 0xCD, 0xC0, 0x10,
-    0xF0, 0xEF, 0x3F, 0x0B, 0x03, 0x06, 0xF8, 0xF9, 0x1F, 0x02, 0x08, 0x30, 0xF6, 0xEC, 0x06, 0x02,
-    0x10, 0x83, 0x09, 0xA6, 0x8B, 0x24, 0x06, 0x08, 0xC4, 0x13, 0x60, 0x80, 0xAC, 0xB0, 0x26, 0xDF,
-    0x8A, 0x33, 0x20, 0x40, 0x94, 0x77, 0x00, 0x17, 0x7A, 0xB0, 0x6C, 0x78, 0x9C, 0x63, 0xD8, 0x74,
-    0x8E, 0x85, 0xE1, 0xFA, 0x3C, 0x06, 0x06, 0x86, 0xDF, 0xFF, 0xF9, 0x0D, 0xFE, 0xFF, 0xE7, 0x60,
-    0x60, 0xF8, 0xF7, 0xDF, 0x3E, 0xE1, 0xFF, 0x7F, 0x6E, 0x06, 0x86, 0x3F, 0xFF, 0xE5, 0x1D, 0xC0,
-    0x22, 0x87, 0xEE, 0xB3, 0x30, 0x3C, 0x5F, 0xCF, 0x80, 0x0F, 0xFC, 0xFC, 0x0F, 0x01, 0x04, 0x18,
-    0x7B, 0x76, 0x03, 0x01, 0x88, 0xC1, 0x04, 0xD3, 0x45, 0x12, 0x03, 0x04, 0xE2, 0x09, 0x30, 0x40,
-    0x56, 0x58, 0x93, 0x6F, 0xC5, 0x19, 0x10, 0x20, 0xCA, 0x3B, 0x00, 0xA0, 0x72, 0xA7, 0xAE, 0x78,
-    0x9C, 0xBB, 0xF0, 0xFF, 0xFF, 0x7C, 0x06, 0x06, 0x81, 0x3F, 0xFF, 0xFF, 0xB3, 0x32, 0x30, 0x4C,
-    0xF8, 0xFF, 0x5F, 0x9F, 0x81, 0x81, 0xE1, 0xDB, 0xFF, 0xFB, 0x8C, 0x0C, 0x0C, 0x06, 0xFF, 0xFE,
-    0x73, 0x03, 0x39, 0x1B, 0xFF, 0xF7, 0x33, 0xA0, 0x00, 0x88, 0xA2, 0xC1, 0x4B, 0x02, 0x00, 0xD6,
-    0x2A, 0x5A, 0x75, 0x78, 0x9C, 0x63, 0x60, 0xF8, 0xFB, 0xFF, 0x3F, 0x27, 0xC3, 0x84, 0xFF, 0xFF,
-    0xFB, 0x19, 0x18, 0xBE, 0xFD, 0xFF, 0xCF, 0xC6, 0x60, 0xF0, 0xFF, 0xBF, 0x1D, 0x03, 0xC3, 0xA3,
-    0xFF, 0xE7, 0x19, 0x19, 0x18, 0xFE, 0xFC, 0xE7, 0x60, 0x40, 0x05, 0x3F, 0xFF, 0xFF, 0x67, 0x1A,
-    0xDC, 0x24, 0x00, 0x5A, 0xD7, 0x60, 0x7F, 0x78, 0x9C, 0x63, 0x60, 0xF8, 0xF6, 0xFF, 0xFF, 0x7B,
-    0x06, 0x20, 0x50, 0xF8, 0x0F, 0x04, 0x5C, 0x40, 0xC6, 0x45, 0x10, 0xA3, 0x1F, 0xC8, 0xF8, 0xF3,
-    0xBF, 0xFE, 0xD2, 0xFF, 0xFF, 0x6C, 0x0C, 0x07, 0xFE, 0xBF, 0x67, 0x11, 0xF8, 0xF5, 0x3F, 0x9E,
-    0xE1, 0xD7, 0x7F, 0x29, 0x06, 0x86, 0x80, 0x7F, 0xFF, 0x99, 0x19, 0xB0, 0x80, 0x09, 0xFF, 0xFF,
-    0xEB, 0x8F, 0x28, 0x06, 0x00, 0x33, 0x58, 0x66, 0x22, 0x78, 0x9C, 0x33, 0x78, 0x63, 0xC3, 0xD0,
-    0xF0, 0x8E, 0xF3, 0xC2, 0xFF, 0xF7, 0x0C, 0x5F, 0xFF, 0xE7, 0x7F, 0xF8, 0xFF, 0x9F, 0xF1, 0xC7,
-    0xFF, 0xF5, 0x20, 0xDE, 0xB7, 0xFF, 0xF5, 0x06, 0x7F, 0x6C, 0x19, 0x26, 0xBC, 0xE3, 0x64, 0xC0,
-    0x0E, 0x7E, 0xFE, 0xFF, 0xCF, 0x34, 0x44, 0x29, 0x00, 0x15, 0x58, 0x65, 0xEB, 0x78, 0x9C, 0x63,
-    0x98, 0xF0, 0x1F, 0x08, 0xDE, 0xAF, 0x35, 0x67, 0x00, 0x01, 0x30, 0x07, 0x08, 0x62, 0x91, 0x39,
-    0xFF, 0x75, 0x90, 0x39, 0xEF, 0x59, 0xC0, 0x9C, 0xF3, 0xBB, 0x6F, 0x83, 0x78, 0x7A, 0x60, 0x8E,
-    0x3E, 0x03, 0x83, 0xC3, 0xEF, 0xFF, 0xFF, 0xEF, 0xC3, 0x38, 0x0C, 0x05, 0x40, 0x29, 0x36, 0x18,
-    0x87, 0xE1, 0xE7, 0xFF, 0xFF, 0x7C, 0x70, 0xCE, 0x87, 0xFF, 0xFF, 0xED, 0xE1, 0x1C, 0x20, 0x5D,
-    0x0F, 0xE7, 0x04, 0xFC, 0xFF, 0xBF, 0xFF, 0x13, 0xD8, 0x8E, 0xF9, 0x0C, 0x0C, 0x0A, 0x40, 0x2B,
-    0xE0, 0x1C, 0x01, 0xA0, 0xD9, 0xC8, 0x9C, 0xF7, 0x28, 0x32, 0x1B, 0x5F, 0x83, 0x9C, 0x93, 0xCD,
-    0xC0, 0x60, 0x00, 0x34, 0x00, 0x6E, 0x5A, 0xC2, 0xFF, 0xFF, 0xEB, 0xE1, 0x9C, 0x05, 0xFF, 0xFF,
-    0xE7, 0xC3, 0x39, 0x1F, 0x41, 0x34, 0x8C, 0x03, 0x74, 0x36, 0x0F, 0x8C, 0x03, 0x54, 0xF5, 0x9F,
-    0x05, 0xCA, 0x49, 0xFC, 0x07, 0x32, 0x0C, 0xEC, 0xD3, 0x33, 0x6F, 0x40, 0x96, 0xC9, 0x22, 0x85,
-    0xC1, 0x7D, 0x26, 0x24, 0x0E, 0x17, 0x52, 0xE8, 0x58, 0xC1, 0xC3, 0xED, 0x5E, 0x8F, 0x28, 0x88,
-    0x0D, 0x00, 0x4E, 0xB0, 0xC9, 0xA6, 0x78, 0x9C, 0x7D, 0xCF, 0xCB, 0x0D, 0xC2, 0x30, 0x10, 0x04,
-    0xD0, 0x35, 0x1F, 0x05, 0x84, 0x40, 0xE9, 0x84, 0x12, 0x48, 0x07, 0x50, 0x00, 0x12, 0x74, 0x40,
-    0x07, 0x24, 0x37, 0x6E, 0x10, 0x3A, 0x48, 0x07, 0xD0, 0x01, 0x74, 0x40, 0x3A, 0x80, 0x0E, 0x82,
-    0x02, 0xE2, 0x23, 0xA2, 0x0C, 0x6B, 0xCB, 0x36, 0x7B, 0x62, 0x0E, 0x96, 0x9F, 0xBC, 0x1A, 0x79,
-    0x89, 0x68, 0x5E, 0xAD, 0x15, 0x1D, 0xA1, 0x48, 0xE7, 0x0D, 0x2C, 0xE9, 0x5E, 0x98, 0x7B, 0x04,
-    0xCE, 0x09, 0x3B, 0x83, 0x3D, 0xDF, 0x38, 0x23, 0x83, 0x2B, 0x9A, 0x09, 0x23, 0x30, 0x28, 0x79,
-    0x60, 0x5B, 0x4F, 0xE9, 0x6F, 0xB8, 0xB7, 0xB0, 0x3D, 0x08, 0x18, 0xE8, 0x48, 0x0C, 0x25, 0x0E,
-    0x12, 0x68, 0x49, 0xF4, 0x3D, 0x0A, 0x20, 0xF6, 0x58, 0xF0, 0x93, 0x72, 0x98, 0xBD, 0x80, 0xAE,
-    0xC7, 0xC5, 0x7C, 0xD9, 0x8E, 0x4D, 0x78, 0x1D, 0x87, 0x98, 0x2A, 0xA0, 0x6D, 0xB1, 0xA1, 0x1B,
-    0x30, 0xF0, 0xC8, 0xC0, 0x87, 0x43, 0xC8, 0xE5, 0x8D, 0xCC, 0x82, 0x9E, 0x40, 0xCF, 0x23, 0x07,
-    0xC6, 0xA9, 0x03, 0x97, 0x9F, 0x13, 0x07, 0xFA, 0x00, 0x2B, 0x8F, 0x92, 0xFB, 0x3C, 0x52, 0xBD,
-    0x88, 0x43, 0x58, 0x0B, 0xD0, 0x43, 0x22, 0x97, 0x88, 0x24, 0x74, 0xF9, 0x0F, 0xA5, 0xC6, 0x17,
-    0xCF, 0xFF, 0xEF, 0x26, 0x78, 0x9C, 0x8D, 0x90, 0x4B, 0x0E, 0x01, 0x51, 0x10, 0x45, 0x2B, 0x3E,
-    0x21, 0x88, 0x58, 0x01, 0xBD, 0x04, 0x4B, 0xB0, 0x13, 0x3D, 0x36, 0x61, 0x07, 0xEC, 0xC0, 0xC8,
-    0x98, 0x1D, 0x58, 0x82, 0x25, 0xB0, 0x01, 0x6C, 0x40, 0x22, 0xF1, 0x6F, 0x9F, 0x3E, 0x5E, 0xF5,
-    0xEB, 0xCF, 0x6B, 0x23, 0x77, 0x50, 0xC9, 0xAD, 0x7A, 0x55, 0xEF, 0xDE, 0x2B, 0x22, 0x77, 0x68,
-    0x4B, 0x0A, 0x1F, 0x56, 0x19, 0x93, 0x0B, 0x54, 0x33, 0xE6, 0x7D, 0xE8, 0x3B, 0xC3, 0x05, 0x14,
-    0x1D, 0x7A, 0xA3, 0x29, 0x7F, 0xA0, 0x35, 0x3B, 0xB0, 0x1B, 0x14, 0x62, 0x12, 0xA0, 0x58, 0xD9,
-    0x3B, 0x57, 0x2C, 0xA6, 0x4A, 0x46, 0x24, 0xA8, 0x59, 0x21, 0xB0, 0x0D, 0x4D, 0x19, 0x1B, 0x16,
-    0x46, 0x2B, 0xDE, 0x03, 0x55, 0x60, 0x24, 0x53, 0x31, 0xCD, 0x6E, 0xF4, 0x74, 0x03, 0xCB, 0x58,
-    0x0E, 0x1D, 0x39, 0x69, 0x51, 0x98, 0xF6, 0x50, 0x5B, 0xF5, 0x88, 0x4D, 0x60, 0x2E, 0x41, 0xE2,
-    0xAD, 0x07, 0x7B, 0x79, 0x42, 0xD9, 0x4A, 0x82, 0xA3, 0xBC, 0xA0, 0x64, 0x15, 0x9A, 0xA3, 0xF2,
-    0x4E, 0x8D, 0x2A, 0xCB, 0xCF, 0xF2, 0x7B, 0xEE, 0xCD, 0xB5, 0xFA, 0x69, 0x64, 0xFF, 0xB9, 0x5A,
-    0xFA, 0x3F, 0x3A, 0x13, 0x0F, 0x3D, 0x6B, 0x57, 0xFD, 0x95, 0xC4, 0xD3, 0x70, 0x4C, 0x50, 0x67,
-    0xF5, 0xBE, 0x23, 0xF6, 0xEE, 0xE7, 0x72, 0xB1, 0xC1, 0xC4, 0xA3, 0xDF, 0x3C, 0xDD, 0xAC, 0xBF,
-    0x61, 0x6A, 0xCA, 0xB1, 0x78, 0x9C, 0x8D, 0x50, 0xC9, 0x0D, 0xC2, 0x40, 0x0C, 0xB4, 0x48, 0x10,
-    0x47, 0x78, 0xA4, 0x03, 0x52, 0x02, 0x25, 0xA4, 0x03, 0x4A, 0x20, 0x6F, 0x3E, 0xD0, 0x01, 0x74,
-    0xC0, 0x8B, 0x37, 0x25, 0x50, 0x02, 0x25, 0x00, 0x05, 0x90, 0x34, 0x80, 0x84, 0xC4, 0x25, 0x2E,
-    0x65, 0xB0, 0xD7, 0xD9, 0x6C, 0xC2, 0x8B, 0x79, 0xAC, 0x34, 0xF6, 0xDA, 0x9E, 0x19, 0x22, 0x83,
-    0x0F, 0x10, 0x90, 0xC5, 0x1C, 0x58, 0x97, 0x84, 0xAE, 0x40, 0xAB, 0x24, 0x11, 0x30, 0x74, 0xAD,
-    0x3D, 0xB2, 0x86, 0x63, 0x6F, 0x74, 0xE8, 0x1F, 0x84, 0xCB, 0x23, 0xD2, 0x71, 0x31, 0x18, 0x3E,
-    0x21, 0xD8, 0x78, 0x86, 0xDD, 0xA0, 0x58, 0x08, 0x99, 0xC2, 0xA2, 0xAB, 0x32, 0x80, 0x43, 0xCE,
-    0xCF, 0x8C, 0x59, 0x6E, 0x46, 0xA2, 0x07, 0x53, 0x8F, 0x12, 0xA8, 0xC4, 0x81, 0xF9, 0xBA, 0xB3,
-    0xEA, 0xEF, 0x40, 0x9F, 0xCE, 0xF2, 0x08, 0xB8, 0x3C, 0x91, 0x52, 0x60, 0x2D, 0xAE, 0x88, 0x4F,
-    0xB7, 0x0D, 0x8B, 0x81, 0x8C, 0x5E, 0x40, 0x53, 0x25, 0x01, 0x27, 0x36, 0x03, 0x5F, 0x15, 0xF2,
-    0x52, 0x89, 0xC7, 0x73, 0xAC, 0xDE, 0xAB, 0xCF, 0x55, 0x77, 0x6E, 0xC5, 0x4F, 0xCF, 0xDD, 0xAB,
-    0x6A, 0x19, 0xFD, 0xE8, 0xB4, 0x1E, 0x62, 0xB5, 0x2B, 0xFE, 0x7C, 0x8A, 0x24, 0x1C, 0x0E, 0xEA,
-    0x22, 0xDE, 0x53, 0x14, 0xDE, 0x93, 0x5A, 0x2E, 0x1A, 0x4C, 0xD1, 0xFA, 0xCD, 0xB3, 0x9A, 0xF5,
-    0x17, 0x4A, 0x06, 0xCA, 0xB4, 0x78, 0x9C, 0x85, 0x90, 0xBB, 0x0D, 0xC2, 0x40, 0x10, 0x44, 0x57,
-    0x60, 0x3E, 0x02, 0x07, 0xEE, 0x00, 0x97, 0x40, 0x42, 0x88, 0xE4, 0x0E, 0x28, 0x01, 0xC7, 0x24,
-    0xD0, 0x01, 0x74, 0x40, 0x44, 0xEC, 0x12, 0x28, 0x01, 0x44, 0x03, 0xD0, 0x00, 0x46, 0xE4, 0x48,
-    0x48, 0x7C, 0x2C, 0xBE, 0x1E, 0xF6, 0xF6, 0xEE, 0xC0, 0x76, 0xC2, 0x06, 0x27, 0xBD, 0xBD, 0xBB,
-    0xDD, 0x99, 0x21, 0x22, 0x9A, 0x00, 0x70, 0xC9, 0xD6, 0x85, 0x69, 0x6A, 0xC1, 0x4F, 0x99, 0x50,
-    0x35, 0xB4, 0x07, 0x3A, 0x29, 0x7A, 0x1A, 0xBC, 0x37, 0xBA, 0xB4, 0x02, 0x1C, 0xA1, 0x25, 0x22,
-    0x3E, 0x13, 0xB4, 0xE8, 0x6F, 0x79, 0xB3, 0x03, 0xE2, 0x41, 0xC9, 0xC0, 0x5D, 0x2D, 0xC0, 0xA2,
-    0x2C, 0x74, 0x85, 0x2E, 0xD9, 0x3F, 0x82, 0xAD, 0x86, 0x91, 0x85, 0xAD, 0x92, 0x33, 0x66, 0x4A,
-    0xE5, 0x8B, 0x7F, 0x63, 0x2C, 0x53, 0xC8, 0x67, 0x8D, 0x9B, 0x6D, 0x79, 0xBA, 0x01, 0xE6, 0x32,
-    0x2C, 0x01, 0xAB, 0x39, 0xC1, 0x48, 0xE2, 0xF6, 0x50, 0xB5, 0x9A, 0x42, 0x6C, 0x39, 0x22, 0x5E,
-    0x5D, 0x17, 0x0A, 0x80, 0x1D, 0x3D, 0x80, 0x8A, 0x96, 0x04, 0x1C, 0xE9, 0x69, 0x8D, 0x11, 0x0F,
-    0xA5, 0x97, 0x5A, 0xF3, 0xA5, 0xFC, 0x5D, 0xFE, 0x5F, 0x76, 0xE6, 0x5A, 0xF9, 0x71, 0x7F, 0xFB,
-    0xB2, 0x5A, 0xFA, 0x05, 0x9D, 0xD6, 0x43, 0xA0, 0xED, 0x2A, 0x7F, 0x0E, 0xF9, 0x2A, 0x1C, 0x0E,
-    0xEA, 0xAC, 0xBC, 0xC7, 0x30, 0xDE, 0xC3, 0x5C, 0x2E, 0x3A, 0x18, 0x73, 0x55, 0xCC, 0x33, 0x9B,
-    0xF5, 0x07, 0x95, 0x88, 0xD6, 0x70, 0x78, 0x9C, 0x85, 0x90, 0xBB, 0x0D, 0xC2, 0x40, 0x0C, 0x86,
-    0x2D, 0x08, 0xEF, 0x20, 0x65, 0x03, 0x32, 0x02, 0x1B, 0x90, 0x4D, 0x48, 0x4D, 0x03, 0x1B, 0xC0,
-    0x06, 0xD0, 0x50, 0xB3, 0x01, 0x8C, 0xC0, 0x08, 0xB0, 0x00, 0x49, 0x4B, 0x81, 0x14, 0x89, 0x97,
-    0x78, 0x04, 0x7E, 0xEC, 0xF3, 0x01, 0x09, 0x0D, 0x2E, 0xAC, 0xFB, 0xEE, 0x61, 0xDF, 0x67, 0x22,
-    0xA2, 0x6D, 0x5C, 0x26, 0x0F, 0x2E, 0x99, 0x58, 0x03, 0xB1, 0x33, 0x41, 0x4D, 0xE9, 0x0A, 0x20,
-    0x79, 0xA0, 0xA4, 0x84, 0x24, 0x65, 0x8E, 0x15, 0x02, 0x34, 0xFD, 0x1B, 0xD0, 0x51, 0x1A, 0xA0,
-    0x4C, 0xED, 0xFB, 0xBC, 0x40, 0xFF, 0xC3, 0x9B, 0xEE, 0x10, 0xF5, 0xEC, 0x4D, 0x4F, 0x3A, 0x00,
-    0xCB, 0xA2, 0xA1, 0x13, 0x34, 0xC6, 0x5A, 0xF2, 0x1D, 0x75, 0xA6, 0xA3, 0x2C, 0x36, 0x4F, 0x4E,
-    0x43, 0xA6, 0xA7, 0x79, 0xE2, 0x5F, 0x18, 0x8B, 0x14, 0x72, 0xAE, 0xF0, 0x66, 0xDB, 0x5C, 0x65,
-    0x81, 0x85, 0x29, 0x76, 0x06, 0x5A, 0xB4, 0x97, 0x64, 0xBD, 0xFA, 0xB2, 0xD5, 0x30, 0x34, 0x02,
-    0x66, 0x22, 0x57, 0xB5, 0x2A, 0x2C, 0xC5, 0x2E, 0xAA, 0xE9, 0xB1, 0x32, 0xDD, 0x01, 0xC7, 0x4A,
-    0x03, 0x94, 0x4A, 0x9B, 0x0F, 0xE5, 0xCF, 0xF2, 0xEF, 0xB2, 0x35, 0x57, 0xE2, 0xE3, 0x7E, 0xFB,
-    0x65, 0xFF, 0xD2, 0xFD, 0xF9, 0xE7, 0xDB, 0x21, 0x50, 0x5D, 0xF1, 0x73, 0xC8, 0x97, 0xE1, 0xF0,
-    0xA0, 0x0E, 0xE2, 0x1E, 0xC1, 0xBA, 0x87, 0xB9, 0xB9, 0xE8, 0x60, 0xEC, 0xD1, 0xEF, 0x3C, 0xB3,
-    0xB3, 0x7E, 0x01, 0xE1, 0x5D, 0xD8, 0x38, 0x78, 0x9C, 0x95, 0x50, 0xB9, 0x0D, 0xC2, 0x40, 0x10,
-    0x5C, 0x61, 0x23, 0x10, 0x10, 0xD0, 0x81, 0x9D, 0x43, 0x40, 0x09, 0xD7, 0x01, 0x25, 0xE0, 0x98,
-    0x04, 0x3A, 0x80, 0x0E, 0x20, 0x21, 0x86, 0x0E, 0x28, 0x81, 0x12, 0x4C, 0x03, 0x98, 0x06, 0x2C,
-    0x19, 0xF1, 0xC9, 0x7C, 0x1E, 0x76, 0xEF, 0x6C, 0xB0, 0x2D, 0x12, 0x26, 0x38, 0xDD, 0xDC, 0xDE,
-    0xEE, 0xCE, 0x0C, 0x11, 0xA9, 0xB0, 0x43, 0xF3, 0xA0, 0x46, 0x06, 0x07, 0xF8, 0x14, 0xA3, 0x9F,
-    0xB2, 0x23, 0x40, 0x77, 0x4C, 0x7E, 0xD6, 0xD4, 0xAB, 0x4B, 0xAB, 0xA8, 0x4E, 0xFF, 0xA2, 0xBD,
-    0x08, 0x11, 0x0C, 0x2B, 0x29, 0xB9, 0x41, 0xB0, 0xB1, 0x34, 0xBB, 0xC0, 0x60, 0x26, 0x64, 0x8C,
-    0x0C, 0x0D, 0x66, 0x67, 0xB9, 0xEC, 0x12, 0x3E, 0x44, 0x4D, 0xA2, 0x5B, 0xDC, 0x98, 0xA9, 0x45,
-    0x1E, 0x9F, 0x22, 0xBF, 0xA7, 0xBF, 0x6E, 0x81, 0xB5, 0x1E, 0x76, 0x05, 0x1C, 0x31, 0xE0, 0x68,
-    0xC6, 0xCF, 0x23, 0x79, 0x6A, 0x6A, 0x36, 0x05, 0x96, 0xC4, 0xAB, 0x8D, 0x7A, 0x05, 0xEC, 0xD9,
-    0x26, 0xAA, 0x46, 0x12, 0x10, 0xD1, 0x03, 0xB0, 0x8D, 0x42, 0x1E, 0x4A, 0x4F, 0x59, 0xF3, 0x61,
-    0xC5, 0x5A, 0xB1, 0x2F, 0x3F, 0xD3, 0x17, 0x3F, 0xAD, 0xEF, 0xBE, 0xBC, 0x96, 0x41, 0x49, 0x67,
-    0xE6, 0x41, 0x19, 0xBB, 0xE2, 0xCF, 0x26, 0x57, 0xC2, 0xE1, 0xA0, 0x4E, 0xE2, 0x3D, 0x40, 0xEA,
-    0xDD, 0x2B, 0xE4, 0x62, 0x82, 0x49, 0x4B, 0xE5, 0x3C, 0xF3, 0x59, 0xBF, 0x01, 0x65, 0x8B, 0xCF,
-    0xA4, 0x78, 0x9C, 0x63, 0x98, 0xC2, 0x00, 0x04, 0x02, 0xD2, 0x0C, 0x06, 0xFF, 0xB9, 0x80, 0x8C,
-    0x47, 0xF7, 0x19, 0x3F, 0xFF, 0x5F, 0xCF, 0xC0, 0xA0, 0xF0, 0xEF, 0xBF, 0xEC, 0xA3, 0xFF, 0x40,
-    0x21, 0x10, 0x01, 0xE4, 0xAC, 0x07, 0x61, 0x06, 0x10, 0xEF, 0x35, 0x48, 0x14, 0x24, 0xFF, 0x1F,
-    0x24, 0x00, 0x16, 0x02, 0xEB, 0x64, 0x70, 0xF8, 0xFF, 0xFF, 0x3E, 0x03, 0x4C, 0x84, 0x93, 0x01,
-    0xAA, 0x66, 0x3E, 0x44, 0xE0, 0x15, 0x48, 0x48, 0xE0, 0x2F, 0xD8, 0x9C, 0xF9, 0x0C, 0x17, 0xA1,
-    0x26, 0x73, 0xC2, 0xEC, 0xE2, 0x31, 0x00, 0xEB, 0x78, 0x74, 0x9E, 0x91, 0x61, 0x32, 0xC8, 0x08,
-    0x05, 0x69, 0x06, 0x00, 0xC1, 0xD3, 0x47, 0xD3, 0x78, 0x9C, 0x6D, 0x51, 0x31, 0x4E, 0x42, 0x51,
-    0x10, 0x1C, 0x41, 0x23, 0x0A, 0x31, 0x3F, 0x16, 0xB6, 0xFE, 0x23, 0x70, 0x03, 0xB9, 0x81, 0xDC,
-    0x00, 0x6A, 0x2B, 0x7B, 0x0A, 0x48, 0x3C, 0x03, 0x35, 0x56, 0xB6, 0x1C, 0x41, 0x0B, 0x4A, 0x13,
-    0xFF, 0x05, 0x80, 0xD8, 0x6B, 0x48, 0x04, 0x8D, 0x5F, 0x08, 0xE3, 0xCC, 0xFE, 0x4F, 0xD4, 0xC4,
-    0x2D, 0x76, 0xDF, 0xE4, 0xBD, 0x9D, 0x9D, 0xD9, 0x07, 0xFC, 0x1F, 0x93, 0x4A, 0x94, 0x64, 0xF8,
-    0xC2, 0x79, 0xEF, 0x74, 0xDB, 0x0F, 0x90, 0xD3, 0xB1, 0xE0, 0xD8, 0xE8, 0x9D, 0x65, 0x9C, 0x08,
-    0x5C, 0xEF, 0x00, 0xEB, 0x42, 0x2B, 0x1F, 0xA6, 0x5B, 0x25, 0xF7, 0xA9, 0xDE, 0x57, 0x91, 0xAE,
-    0x05, 0x2B, 0xE8, 0x2A, 0x1F, 0x8A, 0xCA, 0x97, 0xC7, 0xC8, 0x18, 0x5C, 0xB7, 0x7E, 0x7F, 0x8E,
-    0x37, 0x27, 0xE0, 0x83, 0x53, 0xB2, 0xA3, 0x62, 0xAE, 0x94, 0xBC, 0x21, 0x47, 0xD0, 0xE8, 0x1A,
-    0xF0, 0xC0, 0x7E, 0x8B, 0x7C, 0xC2, 0x17, 0x79, 0x00, 0x7C, 0xB2, 0x91, 0x48, 0x0E, 0xC4, 0xBC,
-    0x8F, 0xA6, 0xD9, 0x45, 0x83, 0x0D, 0x59, 0x15, 0x71, 0x07, 0x81, 0xE2, 0x2E, 0xD7, 0xA8, 0x40,
-    0xEE, 0x6B, 0x73, 0xB1, 0x87, 0xE8, 0x33, 0xE7, 0x33, 0x2F, 0x81, 0xE0, 0xF4, 0xBC, 0x35, 0x8F,
-    0x80, 0x81, 0xE7, 0x49, 0xCB, 0x88, 0x73, 0xA9, 0xC9, 0xAC, 0x25, 0xB3, 0xC0, 0x8B, 0xD0, 0x26,
-    0x89, 0xF6, 0x60, 0x13, 0xAD, 0xF0, 0x60, 0x7F, 0x9A, 0x91, 0xE6, 0xE1, 0xAF, 0xF0, 0x3E, 0x63,
-    0xE9, 0xFD, 0x67, 0x2F, 0x7A, 0x68, 0xE6, 0x22, 0x62, 0x9D, 0xCB, 0x12, 0x68, 0x39, 0xC1, 0x7C,
-    0x76, 0xF7, 0xCA, 0xD9, 0x55, 0xB1, 0xF7, 0xF4, 0xF1, 0xCF, 0x6F, 0x24, 0xBF, 0xCE, 0xDF, 0x7B,
-    0xBE, 0xE1, 0x7C, 0x78, 0x9C, 0xD5, 0xD0, 0xBB, 0x0D, 0xC2, 0x40, 0x10, 0x84, 0xE1, 0xE1, 0x61,
-    0xB0, 0x1C, 0xB9, 0x01, 0x44, 0x09, 0xB4, 0x42, 0x07, 0x76, 0x1D, 0xC4, 0xF4, 0x81, 0x3B, 0x80,
-    0x4E, 0x88, 0x48, 0x01, 0x89, 0x14, 0x89, 0x00, 0x2C, 0x83, 0x0D, 0xFC, 0x2C, 0x77, 0x67, 0x87,
-    0xE4, 0x4C, 0x70, 0xF7, 0x69, 0x77, 0xA3, 0x91, 0x5E, 0x90, 0x28, 0x64, 0x03, 0x59, 0x6B, 0x3D,
-    0xA0, 0xDF, 0x3A, 0x87, 0x49, 0xB7, 0x38, 0xB1, 0xED, 0x9C, 0x36, 0xC4, 0xFA, 0x91, 0x27, 0xB8,
-    0xFF, 0x0A, 0xF1, 0x3F, 0xFB, 0x66, 0x6E, 0x82, 0x4B, 0x18, 0xD7, 0x30, 0xF8, 0xBA, 0x82, 0xD1,
-    0x1D, 0xDF, 0x81, 0xDD, 0x0E, 0xED, 0x6E, 0xE6, 0xFB, 0x42, 0x47, 0xB8, 0x44, 0x4A, 0x6D, 0xBD,
-    0xD2, 0xDC, 0x06, 0xEC, 0xDF, 0xF6, 0x4C, 0xA5, 0x9A, 0x90, 0x48, 0x2A, 0x02, 0x5D, 0xEF, 0x3B,
-    0xC7, 0xB5, 0xAF, 0x7D, 0x79, 0xE6, 0xB0, 0xE8, 0x19, 0x3E, 0x0A, 0x2B, 0xB9, 0xC5, 0x78, 0x9C,
-    0xD5, 0xD0, 0xB9, 0x0D, 0xC2, 0x40, 0x10, 0x85, 0xE1, 0xC7, 0x61, 0xAE, 0x88, 0x0E, 0xA0, 0x03,
-    0x3A, 0x41, 0xEE, 0x00, 0xEA, 0x20, 0x22, 0xA0, 0x0F, 0xE8, 0x80, 0x52, 0x88, 0x48, 0x39, 0x72,
-    0x24, 0x02, 0x8C, 0xB0, 0x6C, 0xC4, 0xCF, 0x8C, 0x3D, 0x4E, 0xC9, 0x79, 0xC1, 0xEE, 0xA7, 0xD9,
-    0xD1, 0x48, 0x3B, 0x92, 0xE7, 0x0D, 0x23, 0xD5, 0x59, 0xC3, 0x36, 0xA8, 0x27, 0xF4, 0x83, 0x53,
-    0x98, 0x37, 0xE5, 0x2B, 0x87, 0x76, 0xE3, 0x92, 0xA1, 0x7E, 0xC5, 0x26, 0x57, 0xF7, 0x03, 0x06,
-    0xFF, 0xEC, 0xCC, 0x5C, 0x86, 0x7D, 0x2D, 0x05, 0x74, 0xDC, 0x2F, 0xE8, 0xE5, 0xF6, 0x16, 0x7F,
-    0xED, 0x5A, 0xDF, 0xCC, 0xB8, 0xC4, 0x7A, 0x2F, 0x70, 0x4F, 0x34, 0xCE, 0x7D, 0xA3, 0xA9, 0x15,
-    0x38, 0x7D, 0xEC, 0x98, 0x48, 0x05, 0x91, 0x44, 0xDA, 0x05, 0x17, 0x3E, 0xE1, 0x58, 0x71, 0x5F,
-    0x6F, 0x77, 0x73, 0xE3, 0xBC, 0x6A, 0x19, 0xBE, 0xDB, 0x05, 0xB9, 0xB7, 0x78, 0x9C, 0xD5, 0xD0,
-    0xBB, 0x0D, 0xC2, 0x40, 0x10, 0x04, 0xD0, 0xC1, 0xC6, 0x7C, 0x32, 0x42, 0x22, 0x28, 0x81, 0x16,
-    0x28, 0xC1, 0x1D, 0x40, 0x1D, 0x8E, 0xC9, 0x71, 0x07, 0xD0, 0x01, 0x74, 0x40, 0x09, 0x24, 0x90,
-    0x02, 0xCE, 0x91, 0x08, 0xC0, 0x32, 0x32, 0x9F, 0x61, 0x6E, 0xD9, 0x94, 0x02, 0xD8, 0xE0, 0xEE,
-    0xE9, 0xF6, 0x74, 0xA7, 0x1D, 0x00, 0x63, 0x92, 0x03, 0x7C, 0xAB, 0x90, 0xB7, 0xEE, 0xA7, 0xCC,
-    0xAE, 0x71, 0x4D, 0xF6, 0x5F, 0x9C, 0x9B, 0x6B, 0x4E, 0x90, 0x93, 0x6D, 0x31, 0xE7, 0x26, 0x02,
-    0x76, 0x3A, 0xF8, 0x59, 0x7A, 0xC4, 0xF6, 0x2B, 0xD9, 0xF9, 0x67, 0xDF, 0xE4, 0x87, 0xBB, 0xD4,
-    0xF4, 0x35, 0x19, 0x07, 0x57, 0x64, 0xEB, 0xAE, 0x9E, 0xCF, 0xDA, 0xD4, 0xBD, 0x91, 0x38, 0x55,
-    0x74, 0x38, 0x91, 0x97, 0x04, 0x3D, 0xB5, 0x17, 0x48, 0x43, 0x98, 0x87, 0xB7, 0x96, 0x61, 0x88,
-    0xD0, 0x2B, 0x01, 0x96, 0x4E, 0xCB, 0x70, 0x6F, 0x5C, 0x45, 0xF6, 0xCD, 0xEC, 0xCC, 0x63, 0xD6,
-    0x10, 0x3E, 0xFA, 0x08, 0xC5, 0x45, 0x78, 0x9C, 0x63, 0x60, 0x50, 0x78, 0xED, 0xC3, 0x50, 0xF0,
-    0x96, 0x93, 0x01, 0x04, 0x36, 0xFC, 0xFF, 0xCF, 0xF0, 0xE5, 0x7F, 0x3F, 0x98, 0xFD, 0xE0, 0xFF,
-    0x7F, 0xE6, 0xEF, 0xFF, 0xF7, 0x83, 0xD9, 0x07, 0x90, 0xC4, 0x15, 0xFE, 0xF8, 0x32, 0x34, 0xFC,
-    0xE3, 0x62, 0x20, 0x0E, 0xFC, 0x01, 0xEA, 0x04, 0x81, 0xCF, 0xFF, 0xFF, 0x73, 0x0C, 0x65, 0xF6,
-    0x17, 0x20, 0xFB, 0x37, 0x94, 0xFD, 0xF5, 0xFF, 0x7F, 0xF6, 0x5F, 0xC0, 0xD0, 0x01, 0xB1, 0xBF,
-    0xFF, 0xFF, 0xCF, 0xF6, 0x03, 0x28, 0x07, 0xF5, 0x2B, 0x0B, 0x50, 0x9D, 0x3E, 0x90, 0x99, 0xF0,
-    0x1F, 0xA8, 0x16, 0x18, 0x82, 0xEF, 0x59, 0x19, 0x04, 0x80, 0xD2, 0xF3, 0x19, 0x02, 0x80, 0x02,
-    0xFF, 0xEF, 0xFD, 0x03, 0x12, 0xF2, 0x0C, 0x0C, 0xBF, 0xFE, 0x43, 0x01, 0x2B, 0x03, 0xC3, 0x02,
-    0x28, 0x33, 0x1E, 0x64, 0xC2, 0x55, 0x30, 0x73, 0x3D, 0x13, 0xD8, 0x9A, 0x96, 0x37, 0xFF, 0xEF,
-    0x57, 0x31, 0x02, 0x19, 0x00, 0x7A, 0x38, 0xBF, 0x30, 0x78, 0x9C, 0xBD, 0x8F, 0xDB, 0x0D, 0x01,
-    0x61, 0x10, 0x85, 0xCF, 0x4A, 0x84, 0xC4, 0xA5, 0x01, 0x0F, 0x34, 0x40, 0x94, 0xA0, 0x03, 0x3A,
-    0xA2, 0x03, 0x3A, 0xA0, 0x03, 0x4A, 0xD8, 0x0E, 0x50, 0x81, 0x12, 0x5C, 0x97, 0xB0, 0xF8, 0xCC,
-    0x7F, 0x59, 0x8F, 0x1E, 0x9D, 0x97, 0xF9, 0x26, 0x99, 0x39, 0x73, 0x46, 0x72, 0xBA, 0x41, 0x4F,
-    0x41, 0x7D, 0xD8, 0x95, 0x22, 0x6F, 0xA1, 0x15, 0x51, 0x39, 0xF3, 0x02, 0x67, 0x50, 0x2E, 0x38,
-    0xA3, 0xAB, 0x5F, 0xCA, 0xA1, 0xE2, 0xEA, 0x0A, 0xC6, 0x67, 0x68, 0x3A, 0xB6, 0xDA, 0x58, 0x58,
-    0xEF, 0xF8, 0x69, 0x5E, 0x1D, 0x20, 0x91, 0x06, 0xB0, 0x96, 0xEE, 0x50, 0x95, 0x52, 0x18, 0x4A,
-    0x47, 0x68, 0x4B, 0x17, 0xA8, 0x49, 0x13, 0x98, 0xFA, 0x71, 0x17, 0xEE, 0x6D, 0x0B, 0x36, 0xBE,
-    0x74, 0x0E, 0x57, 0x5B, 0x48, 0xFD, 0xA0, 0xB4, 0xB1, 0x9A, 0x79, 0x03, 0x69, 0x64, 0x0B, 0x2F,
-    0xF6, 0x89, 0xE2, 0x99, 0x78, 0xD0, 0xFB, 0xC5, 0x20, 0x3E, 0xD6, 0xF7, 0x19, 0xFB, 0xDC, 0x05,
-    0x08, 0x7A, 0xF8, 0x00, 0x41, 0x27, 0xA8, 0x17, 0x7C, 0xF0, 0x61, 0xFE, 0xCB, 0x1F, 0xC6, 0xA8,
-    0x89, 0x8E, 0x78, 0x9C, 0xFB, 0xF9, 0xFF, 0x3F, 0x13, 0x03, 0x18, 0xFC, 0x24, 0xC4, 0xFA, 0xFF,
-    0xFF, 0x5E, 0x15, 0x23, 0x94, 0xF5, 0xFF, 0x7F, 0x3F, 0x9C, 0xF5, 0x9F, 0x07, 0xCE, 0x5A, 0x0F,
-    0x62, 0xAD, 0xDE, 0xF5, 0x0F, 0xC8, 0x64, 0x06, 0xEB, 0x75, 0x00, 0x32, 0xB9, 0x20, 0xA6, 0x7C,
-    0xFE, 0xFF, 0x9F, 0x0F, 0xC2, 0xBA, 0xF0, 0xFF, 0x3F, 0x3F, 0x84, 0xB5, 0xE0, 0xFF, 0x7F, 0x7D,
-    0x08, 0x6B, 0xC3, 0xFF, 0xFF, 0xF2, 0xE8, 0xB2, 0x5F, 0xFE, 0xFF, 0xE7, 0x05, 0xB3, 0x02, 0x80,
-    0xE6, 0x71, 0xC0, 0x4D, 0x66, 0x84, 0xD9, 0x56, 0x0F, 0xB7, 0x97, 0x13, 0xC6, 0x8A, 0x83, 0xBA,
-    0xEA, 0x5C, 0x24, 0x31, 0x3E, 0xC2, 0x60, 0x01, 0x00, 0x78, 0x82, 0x97, 0x71, 0x78, 0x9C, 0x4D,
-    0xD0, 0x31, 0x0E, 0x01, 0x41, 0x14, 0x06, 0xE0, 0x9F, 0x95, 0x25, 0xC4, 0x9E, 0x40, 0xB2, 0x1C,
-    0x40, 0xA8, 0xD4, 0x7B, 0x04, 0x27, 0xA0, 0xD7, 0xD8, 0xD2, 0x1D, 0x14, 0x14, 0x7A, 0x9C, 0x80,
-    0x1B, 0xEC, 0x11, 0x34, 0x1A, 0x8D, 0xA5, 0xA0, 0x92, 0x90, 0x10, 0x84, 0x64, 0x7F, 0x6F, 0xCC,
-    0xDB, 0xF0, 0x8A, 0xC9, 0xF7, 0x26, 0x33, 0xEF, 0xBD, 0x19, 0x00, 0x93, 0x13, 0xE3, 0xA1, 0x03,
-    0x13, 0x47, 0x9A, 0x88, 0x73, 0xC2, 0x19, 0x6D, 0x8C, 0xC4, 0x2F, 0x35, 0x5D, 0x04, 0xB2, 0x2E,
-    0x06, 0x1B, 0x59, 0x3D, 0x73, 0x24, 0xCA, 0x00, 0x77, 0xD2, 0xC7, 0xCE, 0x6C, 0x00, 0x4B, 0xB2,
-    0x81, 0x0B, 0x59, 0xB2, 0xF6, 0x8C, 0x8B, 0xE2, 0x2B, 0x59, 0x50, 0x07, 0x09, 0x63, 0xA8, 0x1F,
-    0x64, 0x45, 0x3D, 0x26, 0xA7, 0x50, 0xDF, 0xC8, 0x7C, 0x6A, 0xE9, 0x8D, 0xD4, 0x6F, 0x53, 0x45,
-    0xFD, 0x24, 0x57, 0x8E, 0x7A, 0x6F, 0xE7, 0xFC, 0xBA, 0x99, 0x48, 0x52, 0xD7, 0xFA, 0x73, 0xF1,
-    0x39, 0xAB, 0x33, 0xAC, 0x25, 0x29, 0xAB, 0xCD, 0xF5, 0x6E, 0xEA, 0x50, 0x5A, 0xA7, 0xAE, 0xCA,
-    0xF3, 0x8C, 0x83, 0x2C, 0xD0, 0xD6, 0xFD, 0x30, 0x6A, 0xD5, 0x0E, 0x64, 0xFF, 0x6B, 0xFB, 0x11,
-    0xFE, 0x9F, 0xDD, 0x9F, 0x3B, 0xB6, 0xAF, 0xFC, 0xE8, 0xB6, 0x07, 0x7C, 0x00, 0x1E, 0xDC, 0xC6,
-    0x5E, 0x78, 0x9C, 0x75, 0xCE, 0x3D, 0x0E, 0x41, 0x41, 0x14, 0x05, 0xE0, 0xEB, 0x27, 0x84, 0x08,
-    0x3A, 0xE5, 0x48, 0x6C, 0xE0, 0x55, 0x6A, 0x9D, 0xF2, 0xBD, 0x4A, 0xAB, 0xB0, 0x01, 0x4B, 0x60,
-    0x01, 0xC2, 0x0A, 0xD0, 0x48, 0x34, 0x3A, 0x85, 0x4A, 0x62, 0x07, 0xAF, 0x95, 0x68, 0xAC, 0xC0,
-    0x4F, 0x3C, 0x22, 0x98, 0xE3, 0xBC, 0xB9, 0x4F, 0xE9, 0x36, 0xF3, 0x65, 0x72, 0xCF, 0x99, 0x91,
-    0x00, 0x40, 0x5A, 0xDC, 0x44, 0x40, 0x49, 0xE5, 0x59, 0xCC, 0x54, 0xB2, 0x03, 0xF2, 0x09, 0x9F,
-    0xF0, 0x13, 0x31, 0x94, 0x92, 0x3F, 0xD3, 0xDA, 0x58, 0xAC, 0x72, 0xC4, 0x10, 0x6E, 0xC8, 0xAB,
-    0x6A, 0x2C, 0x32, 0x57, 0x21, 0x23, 0x1E, 0xA6, 0xCD, 0xDE, 0x07, 0x28, 0x8A, 0xB4, 0xB9, 0x7C,
-    0x04, 0xCA, 0x9A, 0xE7, 0x4A, 0x45, 0x35, 0x00, 0x0C, 0xFB, 0x96, 0x07, 0x8B, 0x58, 0x7D, 0xAB,
-    0x59, 0x53, 0x7D, 0x27, 0x2D, 0x26, 0xAE, 0x1B, 0x75, 0x16, 0xD4, 0x05, 0xE8, 0x6A, 0xE2, 0x06,
-    0x14, 0x44, 0x26, 0xD4, 0xDD, 0x3D, 0x1E, 0x52, 0x91, 0xBB, 0x7B, 0x50, 0xFC, 0xCA, 0xB8, 0xB1,
-    0x8E, 0xB3, 0x21, 0x7E, 0x2D, 0x81, 0x3B, 0xFC, 0x17, 0xDF, 0xE0, 0x0A, 0x4E, 0xD9, 0x88, 0xAA,
-    0xEF, 0xB1, 0xAD, 0xC9, 0x19, 0xE6, 0x0B, 0x74, 0xE0, 0x8F, 0xD6, 0x78, 0x9C, 0x75, 0x8F, 0x3D,
-    0x0E, 0x01, 0x51, 0x14, 0x85, 0x6F, 0x42, 0x26, 0xA1, 0x60, 0x3A, 0xE5, 0x48, 0xB4, 0x0A, 0x95,
-    0x5A, 0xA7, 0x34, 0x95, 0x56, 0x61, 0x03, 0x76, 0x80, 0x05, 0xC8, 0x58, 0x01, 0x1A, 0x89, 0x46,
-    0x28, 0x14, 0x2A, 0xB1, 0x84, 0x69, 0x25, 0x1A, 0x2B, 0xF0, 0x13, 0x83, 0x04, 0xEF, 0x38, 0xEF,
-    0x3E, 0x4A, 0xA7, 0x79, 0x5F, 0x4E, 0xEE, 0x39, 0xF7, 0x5D, 0x11, 0x6A, 0x0B, 0x2C, 0x44, 0xF5,
-    0x00, 0x32, 0x0A, 0x21, 0xD0, 0x75, 0xD6, 0x05, 0xC7, 0xB4, 0x82, 0x6F, 0x50, 0x76, 0xD6, 0x12,
-    0x63, 0xF9, 0xAB, 0xDA, 0xDA, 0x60, 0xEE, 0x11, 0xFA, 0x50, 0x79, 0xB6, 0x42, 0x15, 0x89, 0x4C,
-    0x1C, 0x21, 0x25, 0x15, 0x8C, 0xAA, 0xED, 0x37, 0x90, 0x15, 0xA9, 0x73, 0xF8, 0x00, 0xE4, 0x5C,
-    0x9E, 0x23, 0x79, 0x47, 0x3D, 0x20, 0x60, 0xDF, 0x6C, 0x6F, 0x60, 0xA9, 0x63, 0x5C, 0x36, 0xF0,
-    0x5F, 0xDF, 0x96, 0xC0, 0xD6, 0x0D, 0x9A, 0x53, 0xD2, 0x19, 0x68, 0xB9, 0xC4, 0x55, 0x4F, 0x18,
-    0x92, 0x6E, 0xBA, 0x3C, 0x26, 0x25, 0xEA, 0xDD, 0x49, 0xFC, 0x4A, 0x54, 0x5A, 0xD9, 0x6C, 0x8C,
-    0x5F, 0x4B, 0xA8, 0x4F, 0xE3, 0xC9, 0x1D, 0x1C, 0xE1, 0xB9, 0x09, 0xA9, 0xB8, 0xC3, 0xA6, 0x20,
-    0x27, 0x04, 0x1F, 0x8D, 0x49, 0x90, 0x04, 0x78, 0x9C, 0x6D, 0x8F, 0x31, 0x0E, 0x01, 0x51, 0x18,
-    0x84, 0x47, 0x2C, 0x82, 0x04, 0x9D, 0x42, 0xF1, 0x36, 0x71, 0x01, 0x95, 0x7A, 0x3B, 0x25, 0x95,
-    0x56, 0xE1, 0x00, 0x1C, 0x81, 0x03, 0xC8, 0x3A, 0x01, 0x1A, 0x89, 0x46, 0xA2, 0x50, 0xA8, 0x9C,
-    0x61, 0xA3, 0x93, 0x68, 0x9C, 0x60, 0x11, 0x4B, 0x58, 0x76, 0xFC, 0x6F, 0x1F, 0x9D, 0x69, 0xDE,
-    0x97, 0x3F, 0x33, 0xF3, 0xFF, 0x0F, 0x40, 0x40, 0xFA, 0x09, 0x88, 0xEC, 0x88, 0x64, 0x5E, 0x93,
-    0x27, 0xC0, 0xA9, 0xA6, 0x90, 0xEE, 0x8E, 0xCC, 0x00, 0x2B, 0xFA, 0x29, 0x3C, 0xD9, 0x03, 0x1E,
-    0xAC, 0x00, 0x4E, 0x44, 0x0B, 0x7F, 0xE5, 0x6C, 0x22, 0x2E, 0xD3, 0x02, 0x43, 0xC6, 0x12, 0xBC,
-    0x18, 0x72, 0x81, 0x99, 0x21, 0x26, 0x51, 0xE3, 0xA4, 0xDE, 0x7D, 0x93, 0x39, 0xA0, 0x21, 0xE6,
-    0x23, 0x59, 0x30, 0x79, 0xB1, 0x14, 0x0D, 0x0D, 0x48, 0x25, 0x7D, 0x8B, 0x83, 0xBE, 0x4B, 0xA1,
-    0x1F, 0x99, 0xAC, 0x2A, 0xBD, 0xBE, 0x2D, 0x4A, 0xD7, 0x8D, 0xDA, 0x73, 0xA1, 0x33, 0xD9, 0x31,
-    0x89, 0x2B, 0x99, 0x05, 0xC6, 0x42, 0xB7, 0x78, 0xB9, 0xFC, 0x45, 0x05, 0xF1, 0xEC, 0x2E, 0x24,
-    0xA7, 0xB8, 0xD5, 0xB5, 0xCE, 0x7A, 0xFC, 0xB5, 0xB4, 0xE2, 0xA7, 0x19, 0xCA, 0x0E, 0xB1, 0xD0,
-    0xB7, 0x02, 0x21, 0x7B, 0xCF, 0x6D, 0x19, 0x27, 0xAA, 0x0F, 0x21, 0x54, 0x9B, 0x93, 0x78, 0x9C,
-    0x75, 0x8E, 0x3F, 0x0E, 0x01, 0x61, 0x14, 0xC4, 0xC7, 0xFF, 0x20, 0x41, 0xA7, 0xFC, 0x24, 0x2E,
-    0xB0, 0x95, 0x5A, 0xA7, 0xB4, 0x95, 0x56, 0xE1, 0x02, 0x7B, 0x01, 0xC1, 0x01, 0x64, 0x9D, 0x00,
-    0x8D, 0x44, 0x23, 0x14, 0x0A, 0x95, 0x2B, 0xD0, 0x4A, 0x24, 0xEC, 0x09, 0x16, 0xB1, 0x14, 0xEC,
-    0x8E, 0xB7, 0xFB, 0x51, 0x9A, 0xE6, 0xFD, 0xF2, 0x32, 0x33, 0xEF, 0x01, 0xC6, 0x6B, 0x19, 0x47,
-    0x9F, 0x29, 0xC0, 0x23, 0x27, 0x31, 0x87, 0x71, 0x94, 0x28, 0xDA, 0xD1, 0x05, 0x2C, 0x9E, 0x02,
-    0xE1, 0x1E, 0xB0, 0x62, 0xC6, 0x14, 0xCC, 0x03, 0xE7, 0x70, 0xEF, 0x77, 0xF1, 0x47, 0xF5, 0x4D,
-    0xC0, 0x45, 0x5A, 0x60, 0xC0, 0x48, 0x82, 0x37, 0x4D, 0x36, 0x30, 0xD5, 0xC4, 0x04, 0x0C, 0x8E,
-    0x6B, 0x1D, 0x9F, 0xCC, 0x01, 0x0D, 0x31, 0x3B, 0x64, 0x41, 0xE7, 0xC5, 0x52, 0xD4, 0xD4, 0x27,
-    0x95, 0xF4, 0xCD, 0x8F, 0xE1, 0x0B, 0x0A, 0x56, 0xA0, 0xB3, 0xAA, 0xF4, 0xFE, 0xB6, 0xA8, 0xB0,
-    0x6E, 0xD8, 0x9A, 0x09, 0x5D, 0xC9, 0xB6, 0x4E, 0xDC, 0xC9, 0x2C, 0x30, 0x12, 0x7A, 0x44, 0xC7,
-    0xF7, 0x42, 0x5E, 0xB4, 0x7B, 0x0A, 0xC9, 0x2B, 0x76, 0x75, 0x1D, 0x66, 0xF7, 0xFC, 0xB5, 0x98,
-    0xD1, 0x68, 0xBE, 0xE4, 0x86, 0x58, 0xE8, 0x26, 0x3D, 0xA1, 0xCA, 0x81, 0xDB, 0x32, 0x2E, 0x54,
-    0x1F, 0x38, 0x35, 0x9E, 0x8C, 0x78, 0x9C, 0x7D, 0x8E, 0xBD, 0x0E, 0xC1, 0x60, 0x18, 0x85, 0xDF,
-    0x20, 0x15, 0x22, 0x74, 0x33, 0x56, 0xE2, 0x06, 0x3A, 0x59, 0xD9, 0x8C, 0x35, 0x59, 0x0D, 0x6E,
-    0xC0, 0x1D, 0xE0, 0x02, 0xA4, 0xBD, 0x02, 0xE9, 0x22, 0xB1, 0xD8, 0x0C, 0xA6, 0x4E, 0x76, 0x5D,
-    0x0C, 0x12, 0x91, 0xB8, 0x82, 0x22, 0xAA, 0xE2, 0xA7, 0xC7, 0x69, 0x3F, 0x56, 0x67, 0xF9, 0x9E,
-    0xBC, 0x39, 0x3F, 0x9F, 0x88, 0x73, 0xD0, 0x64, 0xED, 0x65, 0x44, 0x24, 0x42, 0x53, 0x80, 0x12,
-    0xE9, 0x81, 0xA1, 0x09, 0x54, 0x48, 0x77, 0x58, 0xBA, 0xBA, 0xB9, 0x41, 0x5E, 0xB6, 0x9B, 0xC4,
-    0xF7, 0x5F, 0xAD, 0x55, 0x8C, 0x85, 0x46, 0x18, 0x23, 0x15, 0xF1, 0xA2, 0xC8, 0x66, 0x89, 0x22,
-    0x64, 0xC5, 0xC4, 0xB4, 0xD1, 0x7F, 0x03, 0x45, 0x91, 0x36, 0xCD, 0x47, 0xA0, 0xAC, 0xF2, 0xAE,
-    0x1A, 0xA6, 0x46, 0x80, 0xC1, 0xBE, 0xF9, 0x3E, 0x46, 0x42, 0x83, 0x58, 0x65, 0x0D, 0xFD, 0xF5,
-    0x6D, 0x31, 0x92, 0xBA, 0x49, 0x77, 0x46, 0x3A, 0x03, 0x3D, 0x95, 0xB8, 0x02, 0x05, 0x11, 0x87,
-    0x74, 0x4B, 0xC7, 0x7D, 0x52, 0x98, 0xDE, 0x22, 0x12, 0xBF, 0x62, 0xD7, 0x97, 0x49, 0xD6, 0xC7,
-    0xAF, 0xA5, 0x93, 0x3E, 0xD6, 0x93, 0x1B, 0xB4, 0x20, 0xC8, 0x85, 0xA4, 0xDA, 0x0E, 0x5E, 0x55,
-    0x4E, 0x30, 0x3E, 0xC0, 0x37, 0x92, 0xE8, 0x78, 0x9C, 0x75, 0x8F, 0x3D, 0x0E, 0x01, 0x41, 0x14,
-    0xC7, 0x5F, 0x62, 0x23, 0xA1, 0x58, 0xDB, 0x29, 0x47, 0xA2, 0xD3, 0x50, 0x29, 0x54, 0x3A, 0xE5,
-    0xAA, 0xB4, 0x5B, 0xB8, 0x80, 0x23, 0x70, 0x00, 0x59, 0x27, 0x10, 0x8D, 0x44, 0xA3, 0x53, 0xA8,
-    0x9C, 0x61, 0x75, 0x4B, 0x34, 0x4E, 0x30, 0x88, 0xF5, 0x11, 0xBB, 0xFB, 0xF7, 0x66, 0xC6, 0x2A,
-    0x24, 0x5E, 0x33, 0xBF, 0xBC, 0xFC, 0x3F, 0xDE, 0x10, 0x11, 0x85, 0xB2, 0x46, 0x7A, 0x02, 0x00,
-    0x96, 0xA6, 0x87, 0xDC, 0xC3, 0xD6, 0x94, 0xD4, 0x29, 0x76, 0x35, 0xA5, 0x36, 0x3D, 0xBD, 0x6C,
-    0x97, 0xB8, 0x3F, 0xBA, 0xED, 0xD7, 0xEB, 0x84, 0xB2, 0x45, 0xFF, 0xA6, 0xBD, 0x4E, 0xB1, 0xCC,
-    0x33, 0x8C, 0xA0, 0x87, 0xF1, 0x62, 0xC8, 0x27, 0x9A, 0x19, 0x42, 0x8E, 0x1A, 0x98, 0x36, 0xFB,
-    0x09, 0x50, 0x24, 0xEA, 0xB0, 0xF8, 0x88, 0x4F, 0x8B, 0x92, 0x94, 0x0C, 0x0D, 0x01, 0xC1, 0x79,
-    0x8B, 0x43, 0x0A, 0x45, 0x83, 0xD4, 0x78, 0x85, 0x13, 0x7F, 0x52, 0x84, 0x8A, 0x1B, 0xF7, 0xE6,
-    0x4C, 0x67, 0xC0, 0x33, 0x8E, 0x2B, 0x50, 0x20, 0x9A, 0x30, 0xDD, 0x74, 0x39, 0x7F, 0x59, 0x44,
-    0x7A, 0x77, 0x67, 0xE2, 0x53, 0xFC, 0xEA, 0x4A, 0x79, 0x03, 0x64, 0x29, 0x5D, 0xFD, 0xB8, 0x2F,
-    0xEE, 0x60, 0x09, 0xA4, 0x15, 0x31, 0x55, 0x76, 0xD8, 0x94, 0xE9, 0x04, 0xF1, 0x06, 0x18, 0x4A,
-    0x99, 0xF4, 0x78, 0x9C, 0x63, 0x60, 0x70, 0x38, 0xF9, 0xEF, 0x7D, 0x0F, 0x33, 0x43, 0xC0, 0xAD,
-    0x7F, 0xE7, 0x34, 0x18, 0x80, 0x60, 0xE2, 0x7F, 0x10, 0x58, 0xEF, 0xF0, 0x0F, 0x44, 0x71, 0x02,
-    0x05, 0x3E, 0x81, 0x05, 0xFE, 0xFF, 0x05, 0x93, 0xE7, 0x81, 0x02, 0x0B, 0xFE, 0x23, 0x03, 0x2E,
-    0x06, 0x06, 0x85, 0xFF, 0x3D, 0xA6, 0xC9, 0x20, 0xF5, 0xB1, 0x4C, 0x87, 0xFF, 0xFF, 0xB7, 0x07,
-    0x2A, 0x51, 0x83, 0xE8, 0x03, 0xA9, 0xFE, 0xFB, 0x7F, 0x3D, 0x03, 0x04, 0x3C, 0xF8, 0xFF, 0xDF,
-    0x1F, 0x48, 0x7D, 0xFD, 0xFF, 0x1E, 0x21, 0xC0, 0x0F, 0xA4, 0x3E, 0xFF, 0xFF, 0xCF, 0xC8, 0xC0,
-    0x10, 0xB0, 0xE3, 0xCD, 0x3F, 0x84, 0xA9, 0x4C, 0x0C, 0x0D, 0x28, 0xB6, 0xFC, 0x67, 0x16, 0xF8,
-    0x8B, 0x26, 0x00, 0x72, 0x46, 0x4F, 0xD8, 0x53, 0xA0, 0x2D, 0x67, 0xC0, 0x80, 0xE9, 0x23, 0xD8,
-    0x7C, 0xA0, 0xA1, 0x7C, 0x50, 0xF3, 0xBF, 0x80, 0x3D, 0xF0, 0xE1, 0xFF, 0x7F, 0x79, 0xA8, 0xC0,
-    0xB7, 0xFF, 0xFF, 0xD9, 0xC0, 0xF6, 0xF5, 0x43, 0x05, 0xBE, 0x82, 0x55, 0xFC, 0x01, 0x9A, 0xC4,
-    0x0A, 0xE4, 0x19, 0x70, 0x82, 0x1C, 0x5D, 0xAF, 0x7C, 0x15, 0x64, 0xFE, 0x7E, 0x37, 0xE7, 0xE9,
-    0xFF, 0xF8, 0x19, 0x2E, 0x40, 0x6C, 0xEB, 0x87, 0xDA, 0xCA, 0xCF, 0xE0, 0x00, 0x61, 0xB0, 0x7D,
-    0x81, 0x09, 0x80, 0x0C, 0xF9, 0xFF, 0xDF, 0x8F, 0x41, 0xE1, 0x0F, 0x58, 0x80, 0x87, 0x81, 0x41,
-    0xE0, 0xC6, 0xFF, 0xFB, 0x51, 0x20, 0xF3, 0x4E, 0xFC, 0x7B, 0xBF, 0x57, 0x9D, 0x81, 0x01, 0x00,
-    0x6B, 0xCD, 0xD4, 0x01, 0x78, 0x9C, 0x55, 0x8E, 0xBF, 0x0E, 0x01, 0x41, 0x18, 0xC4, 0xE7, 0x90,
-    0x10, 0x97, 0x88, 0x4E, 0x49, 0xA1, 0xC6, 0x6B, 0xA8, 0x78, 0x03, 0xF7, 0x28, 0x0A, 0x3A, 0x85,
-    0x56, 0xED, 0x05, 0x54, 0x4A, 0x12, 0x7A, 0xE7, 0x0D, 0xE8, 0x49, 0x4E, 0xFC, 0x09, 0x85, 0x33,
-    0x76, 0x76, 0xD7, 0x25, 0xA6, 0xF9, 0x7E, 0xF9, 0xF6, 0x9B, 0x99, 0x05, 0x30, 0x3A, 0x73, 0xD7,
-    0x05, 0xB0, 0xA5, 0xD4, 0x42, 0x64, 0x27, 0x2B, 0xB8, 0x3B, 0x28, 0xE1, 0x43, 0xC6, 0xB3, 0x37,
-    0x73, 0xE6, 0x25, 0xC9, 0x03, 0x63, 0x2C, 0xC8, 0x01, 0xA4, 0x8B, 0xEE, 0xA4, 0x2B, 0x59, 0xB6,
-    0x70, 0x93, 0x41, 0x32, 0xEE, 0xE2, 0xFF, 0x26, 0xBB, 0xC9, 0x5C, 0x7B, 0x9F, 0x13, 0x0C, 0x5D,
-    0xF2, 0x3C, 0x6C, 0x50, 0x5D, 0x27, 0x86, 0x78, 0xB9, 0xF6, 0x50, 0x65, 0x0E, 0xFC, 0xCA, 0xA4,
-    0x56, 0x97, 0x29, 0x57, 0x35, 0x39, 0x23, 0xF6, 0x6C, 0x12, 0x8E, 0xAC, 0x3B, 0x78, 0x30, 0x2E,
-    0x38, 0x7A, 0xFA, 0x4F, 0x62, 0xCA, 0x83, 0x46, 0xA7, 0xB9, 0x61, 0x22, 0x30, 0x6D, 0x5C, 0xFF,
-    0xA0, 0x2D, 0xE8, 0xA7, 0x9C, 0x04, 0xC0, 0x17, 0x32, 0xAD, 0x76, 0xEF, 0x78, 0x9C, 0x75, 0x8F,
-    0x3D, 0x0A, 0xC2, 0x40, 0x10, 0x85, 0xC7, 0x3F, 0x22, 0x51, 0xEC, 0x6C, 0x25, 0xA5, 0x9D, 0x36,
-    0xD6, 0xE6, 0x08, 0x16, 0xDE, 0x43, 0xF0, 0x02, 0x1E, 0xC1, 0xC6, 0x32, 0x22, 0x9E, 0x40, 0xAD,
-    0x2C, 0xBD, 0x80, 0x62, 0x61, 0x69, 0x91, 0x13, 0x48, 0x24, 0x09, 0x28, 0x48, 0xF2, 0x39, 0xC9,
-    0xC6, 0x74, 0xBE, 0x66, 0x3E, 0x76, 0xF6, 0xBD, 0xB7, 0x2B, 0x2E, 0x50, 0x93, 0x5C, 0x31, 0xF4,
-    0x0C, 0x39, 0x09, 0x27, 0x43, 0x72, 0x80, 0x66, 0x81, 0x6F, 0x66, 0x05, 0xB9, 0x29, 0x55, 0xF9,
-    0xA7, 0xD5, 0x23, 0x58, 0x37, 0x32, 0xB8, 0x69, 0x34, 0x7E, 0x5D, 0x64, 0x42, 0x2E, 0x75, 0x47,
-    0x86, 0xB4, 0x31, 0x85, 0xBE, 0xF3, 0x82, 0xB6, 0x2E, 0x17, 0x22, 0x43, 0x18, 0xEF, 0xA1, 0xA3,
-    0xB6, 0x0F, 0xCB, 0x27, 0xD8, 0x79, 0xE1, 0x2E, 0x2C, 0x0C, 0x5C, 0xA3, 0x92, 0xE2, 0x1F, 0xF9,
-    0x7A, 0x76, 0x39, 0x67, 0xF2, 0xC2, 0xF2, 0x99, 0xEA, 0x6D, 0x19, 0xD2, 0xBC, 0x81, 0x21, 0xED,
-    0xF0, 0x2B, 0xD9, 0xB4, 0x24, 0x81, 0xCD, 0x68, 0x7A, 0xD4, 0xFC, 0x5F, 0xA0, 0x9D, 0x7D, 0xA7,
-    0x20, 0xD9, 0x1A, 0xB2, 0xF4, 0xF2, 0xFC, 0x4E, 0xE0, 0x75, 0xE5, 0x0B, 0x7F, 0x0F, 0x8F, 0xE6,
-    0x78, 0x9C, 0x75, 0x8F, 0x31, 0x0E, 0x01, 0x61, 0x10, 0x85, 0x9F, 0x20, 0x2B, 0x4B, 0x74, 0x7A,
-    0xA5, 0x8E, 0x46, 0x29, 0x1C, 0x61, 0x0B, 0xF7, 0x90, 0xB8, 0x80, 0x23, 0xAC, 0x42, 0xB9, 0x22,
-    0x4E, 0xB0, 0x3A, 0x97, 0x20, 0x5B, 0x28, 0x15, 0x1B, 0x07, 0x90, 0xDD, 0x58, 0x41, 0x82, 0x7D,
-    0x66, 0xFF, 0xF1, 0xEB, 0xBC, 0xEA, 0xCB, 0xCC, 0xBC, 0x79, 0x33, 0x80, 0x68, 0x43, 0x46, 0x30,
-    0xBA, 0x91, 0x75, 0x03, 0x3D, 0xD2, 0xD7, 0xD2, 0x89, 0xAC, 0x2A, 0xBD, 0x38, 0x50, 0x98, 0x33,
-    0x2C, 0xE1, 0xAF, 0x16, 0xE7, 0x64, 0x69, 0x1C, 0x07, 0x8A, 0xE2, 0x0A, 0xE0, 0xD1, 0x68, 0x02,
-    0x64, 0x4A, 0x2C, 0x23, 0x27, 0x3B, 0xED, 0x3B, 0xD9, 0x90, 0xE6, 0xCC, 0xE4, 0x0D, 0xE5, 0x8C,
-    0xA6, 0xD8, 0x9E, 0xF4, 0x53, 0xD2, 0x15, 0x7A, 0x30, 0xBC, 0x7C, 0x0D, 0x8C, 0xB2, 0x1F, 0x5D,
-    0x2D, 0xC5, 0x52, 0xDB, 0xEF, 0x0A, 0x05, 0x32, 0x57, 0xD3, 0xF8, 0xD4, 0xBE, 0x50, 0xBC, 0xD5,
-    0x55, 0x92, 0x8C, 0xB8, 0xB8, 0xD8, 0x73, 0xF0, 0x26, 0x57, 0xFD, 0xF1, 0x56, 0xF6, 0xDB, 0x85,
-    0x2E, 0x46, 0xB9, 0x25, 0xAC, 0x95, 0x1C, 0x19, 0x9E, 0x1E, 0x99, 0x04, 0x2D, 0x7C, 0x00, 0x78,
-    0x69, 0x8F, 0xF3, 0x78, 0x9C, 0x6D, 0x8F, 0xB1, 0x0E, 0xC1, 0x50, 0x14, 0x86, 0x7F, 0x41, 0x4A,
-    0x89, 0xCD, 0xDE, 0xD1, 0x84, 0xC5, 0xCC, 0x13, 0x48, 0x07, 0x0F, 0xE0, 0x0D, 0x24, 0x5E, 0x80,
-    0x37, 0x10, 0x89, 0xB1, 0x22, 0x9E, 0x80, 0xCD, 0xE8, 0x05, 0x48, 0x07, 0xA3, 0xA1, 0xF1, 0x00,
-    0x52, 0xD1, 0x46, 0x25, 0x8D, 0xFE, 0x4E, 0xEF, 0x6D, 0x4D, 0xFE, 0xE9, 0xBB, 0xF7, 0x9E, 0xF3,
-    0xDD, 0x73, 0x00, 0xDC, 0x48, 0x96, 0x91, 0x26, 0x16, 0x6A, 0xA7, 0x30, 0x17, 0xA0, 0x57, 0x10,
-    0x8A, 0xE8, 0x2E, 0xC9, 0x3A, 0x30, 0x26, 0xAB, 0x78, 0xF1, 0x08, 0x84, 0x1C, 0x02, 0x56, 0x2C,
-    0xC7, 0xFF, 0x59, 0xDD, 0xFD, 0xB5, 0xF2, 0x5D, 0x94, 0xA5, 0x04, 0xD8, 0x54, 0x99, 0x00, 0x81,
-    0x26, 0x16, 0x91, 0x90, 0x2D, 0x2B, 0x12, 0xB5, 0x3C, 0xCE, 0x80, 0x2E, 0xD9, 0xDF, 0x93, 0x0D,
-    0x35, 0xC5, 0xE2, 0x41, 0x9A, 0x42, 0x6F, 0xEE, 0x9E, 0x59, 0x03, 0xDD, 0xE0, 0x47, 0x61, 0x4E,
-    0x9E, 0xDC, 0x9D, 0x4F, 0x69, 0x1C, 0xA9, 0xAB, 0xE8, 0xEF, 0xA5, 0xB7, 0xA6, 0x49, 0x7C, 0x1D,
-    0x4D, 0x76, 0xB6, 0x8D, 0x6D, 0xE0, 0x43, 0x6E, 0x7A, 0xA3, 0x83, 0xF8, 0x73, 0xA1, 0x89, 0x41,
-    0x92, 0x13, 0xB6, 0x9A, 0x0C, 0x29, 0x9E, 0x5E, 0xE9, 0x3B, 0x4D, 0x7C, 0x01, 0x25, 0xC6, 0x9B,
-    0xA3, 0x78, 0x9C, 0x85, 0x8F, 0xBF, 0x0E, 0xC1, 0x60, 0x14, 0xC5, 0x8F, 0x20, 0xA5, 0x84, 0xC9,
-    0x6E, 0xB4, 0xB1, 0x98, 0x79, 0x04, 0x83, 0xF7, 0x20, 0x5E, 0xA0, 0xDE, 0xC0, 0x62, 0x6C, 0x23,
-    0x9E, 0xA0, 0x62, 0xB1, 0x9B, 0xFD, 0x19, 0x8C, 0x86, 0x3E, 0x81, 0x56, 0xB4, 0x49, 0x25, 0xE8,
-    0x71, 0xBF, 0x7E, 0xAD, 0xD5, 0x59, 0xBE, 0x5F, 0xEE, 0x77, 0xCE, 0xB9, 0xB9, 0xC0, 0xD4, 0xAF,
-    0x62, 0x7B, 0x2A, 0x01, 0x88, 0x68, 0xE1, 0xCD, 0xA6, 0x50, 0x4C, 0x17, 0xE4, 0x20, 0x9B, 0x7D,
-    0xD2, 0xD9, 0xDC, 0x37, 0xB1, 0xF7, 0x94, 0xEF, 0x8F, 0x96, 0xB7, 0xC0, 0x29, 0x2B, 0xB8, 0x50,
-    0xA4, 0x12, 0x23, 0xA6, 0x9A, 0x00, 0xA1, 0x26, 0x16, 0x91, 0x90, 0x9D, 0x76, 0x4C, 0xD6, 0xE5,
-    0xD3, 0x02, 0x7A, 0xB2, 0x6E, 0x43, 0x36, 0x24, 0xF6, 0xE2, 0xE2, 0x4E, 0x9A, 0x42, 0x4F, 0xBA,
-    0x8F, 0x2C, 0xC0, 0x73, 0xF8, 0xA3, 0x28, 0x27, 0x4F, 0x66, 0xC7, 0x83, 0x92, 0x2D, 0xBE, 0x8A,
-    0x5E, 0x2F, 0xD9, 0x9A, 0x26, 0xE9, 0xEB, 0x6A, 0x92, 0x1D, 0x5E, 0x41, 0xBD, 0x86, 0x1C, 0xC3,
-    0x55, 0x7F, 0xBC, 0x93, 0xFE, 0xBC, 0xD0, 0xC4, 0x30, 0xC9, 0x09, 0x6B, 0x4D, 0x86, 0x98, 0x67,
-    0x57, 0x06, 0x76, 0x0B, 0x5F, 0x1A, 0x1A, 0x93, 0x42, 0x78, 0x9C, 0xFB, 0xF5, 0xFF, 0x3F, 0x0F,
-    0x03, 0xC3, 0x84, 0xFF, 0xFF, 0xFB, 0x19, 0x18, 0x18, 0xBE, 0xFF, 0xFF, 0xCF, 0xCA, 0xC0, 0xE0,
-    0xF0, 0xEF, 0xBF, 0x3E, 0x90, 0x73, 0xE8, 0xFF, 0x7B, 0x46, 0x20, 0xF5, 0xF3, 0x3F, 0x37, 0x03,
-    0x0A, 0xF8, 0xF0, 0xFF, 0x3F, 0xD7, 0x40, 0x91, 0x00, 0x5C, 0xF2, 0x4E, 0x94, 0x78, 0x9C, 0x63,
-    0x60, 0xF8, 0xF2, 0xFF, 0xBF, 0x3D, 0x83, 0xC0, 0xBF, 0xFF, 0xEF, 0x99, 0x19, 0x0E, 0xFC, 0xFF,
-    0xAF, 0xCB, 0xC0, 0xF0, 0xF3, 0xFF, 0x7A, 0x06, 0x86, 0x82, 0xFF, 0xFF, 0xD9, 0x19, 0x18, 0x3E,
-    0xFF, 0xB7, 0x63, 0x40, 0x05, 0x1F, 0xFE, 0xFF, 0xE7, 0x1A, 0x38, 0x12, 0x00, 0xF5, 0x5C, 0x4E,
-    0xC0, 0x78, 0x9C, 0x63, 0x60, 0xB8, 0xF0, 0xFF, 0xFF, 0x7F, 0x76, 0x06, 0x20, 0xF8, 0x09, 0x64,
-    0xD8, 0x03, 0xE9, 0x04, 0x20, 0xFD, 0xFF, 0x3D, 0x13, 0x03, 0xC3, 0xD7, 0xFF, 0xF7, 0x9B, 0xFE,
-    0xFF, 0x97, 0x65, 0x70, 0xF8, 0xFF, 0x9F, 0x8B, 0xE1, 0xE9, 0xFF, 0xF3, 0x8C, 0x9F, 0xFE, 0xC7,
-    0x31, 0x30, 0x08, 0xFC, 0xFA, 0xCF, 0xCD, 0x80, 0x0D, 0xFC, 0xFF, 0xBF, 0x7E, 0x88, 0x32, 0x00,
-    0x9E, 0x5A, 0x54, 0x57, 0x78, 0x9C, 0x6B, 0x78, 0xC7, 0xC1, 0x70, 0xE8, 0x1C, 0xF3, 0xD7, 0xFF,
-    0xF9, 0x0C, 0x7F, 0xFF, 0xF3, 0xFD, 0xF8, 0x3F, 0x9F, 0xE1, 0xFF, 0x7F, 0x7D, 0x28, 0xAF, 0xE1,
-    0x1D, 0x27, 0xC3, 0xE1, 0xFB, 0x2C, 0x0C, 0xD8, 0xC1, 0xFF, 0xFF, 0xEB, 0x07, 0x17, 0x05, 0x00,
-    0xA9, 0xFB, 0x4B, 0xF5, 0x78, 0x9C, 0x45, 0x8F, 0xBB, 0x0E, 0x01, 0x51, 0x10, 0x86, 0xC7, 0x12,
-    0x97, 0x75, 0xC9, 0x56, 0x6A, 0x8F, 0x20, 0x51, 0xA9, 0xA8, 0x55, 0x7A, 0x05, 0x6F, 0xE0, 0x11,
-    0xD6, 0x1B, 0xD0, 0x28, 0x25, 0x5E, 0x40, 0x6C, 0xA1, 0xD7, 0xEA, 0xF0, 0x04, 0x5B, 0x89, 0x4A,
-    0x88, 0x4B, 0x56, 0x0E, 0x7B, 0x7E, 0x33, 0xE7, 0xEC, 0xC6, 0x14, 0x73, 0xBE, 0x33, 0x99, 0xF9,
-    0xE7, 0x1F, 0x22, 0x0A, 0x0A, 0x44, 0xDD, 0x12, 0x49, 0xBC, 0xAE, 0x79, 0x4F, 0x8D, 0x0D, 0x6A,
-    0xEC, 0x23, 0x5C, 0x33, 0x4C, 0xDE, 0x17, 0x1C, 0xBE, 0xA9, 0x8E, 0x98, 0xF6, 0x8E, 0xC1, 0xBE,
-    0x06, 0xB6, 0x86, 0x1A, 0x1F, 0x69, 0x70, 0x05, 0x27, 0xC0, 0x22, 0xED, 0x8D, 0x7D, 0x52, 0x80,
-    0x69, 0xDE, 0x38, 0x74, 0x00, 0xCA, 0x64, 0xA3, 0x09, 0x74, 0x64, 0x6C, 0xA7, 0xC3, 0xB6, 0xC2,
-    0x9A, 0x51, 0x89, 0x00, 0x27, 0xA2, 0x23, 0x92, 0xC8, 0xD1, 0x27, 0xC5, 0x42, 0x9F, 0x53, 0xAF,
-    0x75, 0x96, 0x25, 0x01, 0xC0, 0xFE, 0xBC, 0x98, 0xD5, 0x6E, 0x40, 0x55, 0x3C, 0x03, 0x95, 0x3B,
-    0x20, 0x07, 0x70, 0xA5, 0xF2, 0x04, 0x8A, 0x16, 0xCB, 0x7F, 0x74, 0xEF, 0xD6, 0xDF, 0x83, 0xC5,
-    0xF8, 0x5B, 0x63, 0x8C, 0x80, 0xEC, 0x12, 0x98, 0xB2, 0x98, 0x46, 0x28, 0x9E, 0x30, 0x90, 0x15,
-    0x43, 0xA2, 0x77, 0xB2, 0x97, 0x27, 0x66, 0x96, 0xCC, 0x9D, 0x27, 0x6B, 0xC6, 0x9C, 0x30, 0xBF,
-    0x60, 0x55, 0xE7, 0xF7, 0x07, 0xC2, 0x30, 0xA3, 0x86, 0x78, 0x9C, 0xC5, 0xCE, 0xBD, 0x0D, 0x82,
-    0x50, 0x14, 0x05, 0xE0, 0xF3, 0xC0, 0xC4, 0x04, 0xE3, 0x0C, 0x8E, 0x22, 0x1B, 0xE8, 0x00, 0x14,
-    0x6C, 0xC0, 0x08, 0x38, 0x01, 0x09, 0xA5, 0x85, 0x33, 0x3C, 0x37, 0xD0, 0x0D, 0x18, 0xC4, 0xE2,
-    0x11, 0xA5, 0x40, 0x02, 0x1C, 0xCF, 0x55, 0x5B, 0x6B, 0x4F, 0x73, 0xBF, 0xE2, 0xFE, 0x01, 0xFB,
-    0xB1, 0x72, 0xB8, 0xD2, 0x01, 0xE8, 0xC9, 0x12, 0x5D, 0x90, 0x52, 0x2A, 0x0D, 0xBD, 0x78, 0x56,
-    0x55, 0xB6, 0x62, 0xCB, 0xF8, 0x20, 0x2E, 0xC5, 0xFB, 0x05, 0xA8, 0xE7, 0x0C, 0xBF, 0xD2, 0xB2,
-    0x40, 0x7E, 0xE3, 0x29, 0x36, 0xFA, 0x74, 0xD2, 0x98, 0x37, 0x86, 0x87, 0x2D, 0x63, 0x22, 0x7E,
-    0xB3, 0x7B, 0xB3, 0x39, 0x8E, 0xD6, 0x61, 0x5C, 0x40, 0x47, 0x82, 0xB1, 0xD4, 0xA2, 0x99, 0x34,
-    0x6E, 0xC4, 0x81, 0x74, 0xE2, 0x5A, 0x7C, 0x92, 0x91, 0xB8, 0xFA, 0x3C, 0x6D, 0x4C, 0xFE, 0xC2,
-    0x17, 0x23, 0xDA, 0xA8, 0x54, 0x78, 0x9C, 0x7D, 0x8F, 0x4B, 0x0E, 0x01, 0x51, 0x10, 0x45, 0xAF,
-    0x47, 0xF4, 0x0B, 0x6D, 0x6A, 0x1D, 0x76, 0xC0, 0x0E, 0xDA, 0x0E, 0xF4, 0x0E, 0x58, 0x82, 0x84,
-    0x4D, 0x18, 0x19, 0x9B, 0x89, 0xB9, 0x48, 0x58, 0x88, 0x0D, 0x48, 0x5A, 0xFC, 0x06, 0x7E, 0xD7,
-    0x7D, 0x9F, 0x0E, 0x23, 0x35, 0xA8, 0x3A, 0xA9, 0xCF, 0xAD, 0x2A, 0xE4, 0x24, 0x0D, 0x82, 0xDD,
-    0xC8, 0x34, 0x62, 0xE7, 0xCD, 0x79, 0x44, 0x6C, 0xC9, 0x7A, 0xC9, 0x77, 0x66, 0x25, 0xE6, 0x2C,
-    0xF0, 0xCF, 0xA6, 0x07, 0xAE, 0xC3, 0xDC, 0x8E, 0xCE, 0x12, 0x51, 0xDF, 0x13, 0x37, 0xC2, 0x73,
-    0x40, 0x36, 0x80, 0x97, 0x32, 0x0B, 0xB9, 0x81, 0xAB, 0xEF, 0x0D, 0xC6, 0xF2, 0x58, 0x92, 0x5D,
-    0xB5, 0x3D, 0xC8, 0xEA, 0x91, 0x6C, 0x09, 0xAF, 0xA4, 0x3D, 0xF9, 0x01, 0xB8, 0x20, 0x01, 0x2B,
-    0x54, 0x31, 0xBD, 0x04, 0xF5, 0x88, 0x65, 0xF6, 0xA7, 0xF7, 0xAB, 0x90, 0x48, 0x37, 0x0B, 0xBA,
-    0x35, 0x6D, 0x2B, 0x0C, 0x46, 0x6E, 0x1B, 0x9E, 0xBA, 0x61, 0xA6, 0x1B, 0x86, 0x7E, 0xC0, 0x5B,
-    0x13, 0xE8, 0xC5, 0x7B, 0x2B, 0x9A, 0x58, 0x79, 0xB4, 0xFE, 0xA3, 0x89, 0x7E, 0x6B, 0x2B, 0x7E,
-    0x00, 0xD9, 0xF4, 0x92, 0x85, 0x78, 0x9C, 0x75, 0x90, 0x4D, 0x0E, 0x01, 0x41, 0x10, 0x85, 0xCB,
-    0x10, 0xD3, 0xF1, 0xB3, 0x75, 0x0E, 0x27, 0xC0, 0x0D, 0xB8, 0x81, 0x23, 0x70, 0x03, 0x12, 0x2E,
-    0x61, 0x67, 0x6B, 0x27, 0xF6, 0x93, 0x59, 0x38, 0x80, 0x23, 0x88, 0xBD, 0x64, 0xC4, 0x4F, 0x2C,
-    0x90, 0xE7, 0x55, 0x57, 0x09, 0x1B, 0x6F, 0xD1, 0xF5, 0xA5, 0xBA, 0xFA, 0x55, 0x55, 0x8B, 0x50,
-    0x03, 0x00, 0x65, 0x89, 0x3A, 0x00, 0x1D, 0x23, 0x79, 0x62, 0x57, 0x32, 0x5A, 0x02, 0x35, 0x4F,
-    0xDE, 0x31, 0x71, 0x6A, 0xA3, 0xF0, 0x37, 0x7F, 0x34, 0x3F, 0x22, 0xAB, 0x46, 0xDA, 0x42, 0x95,
-    0x7A, 0x27, 0x2A, 0x27, 0x5E, 0x0C, 0xD5, 0xF9, 0xC5, 0xCC, 0x8A, 0xC7, 0x50, 0xEF, 0xF7, 0x89,
-    0x4C, 0x79, 0xCA, 0x1A, 0xE8, 0xB2, 0xEC, 0xC1, 0xD1, 0x4E, 0x40, 0x93, 0x78, 0x03, 0xC2, 0xD9,
-    0x46, 0xD1, 0x40, 0x83, 0x40, 0xE4, 0x65, 0xE3, 0x6A, 0xEE, 0x8E, 0x9F, 0xEC, 0x4F, 0xED, 0xD7,
-    0x21, 0xA5, 0x6F, 0xDF, 0x7C, 0x2B, 0xEC, 0x56, 0x24, 0x32, 0xD6, 0x6E, 0xDC, 0x16, 0xF9, 0x82,
-    0x33, 0x8C, 0xE2, 0x83, 0xA8, 0xBA, 0x48, 0xCF, 0xE7, 0xD5, 0x8F, 0xD8, 0x44, 0x0C, 0x71, 0xA3,
-    0x19, 0x77, 0x6B, 0x31, 0xBE, 0x01, 0xAB, 0x45, 0x92, 0x74, 0x78, 0x9C, 0x75, 0x90, 0x4D, 0x0E,
-    0xC1, 0x50, 0x14, 0x85, 0x8F, 0x12, 0x6D, 0xA8, 0xC4, 0xC8, 0x36, 0x2C, 0x81, 0x1D, 0xB0, 0x02,
-    0x96, 0xC0, 0x12, 0x08, 0x9B, 0xB0, 0x04, 0x33, 0x31, 0x6F, 0x0C, 0x2C, 0x80, 0x1D, 0x74, 0x03,
-    0x92, 0x0A, 0x6A, 0x50, 0xE4, 0x38, 0xEF, 0xBE, 0x0A, 0x13, 0x67, 0xF0, 0xDE, 0xD7, 0xF7, 0xF3,
-    0xBD, 0x7B, 0x0B, 0xE0, 0x48, 0xB2, 0x0E, 0x4B, 0x21, 0xEC, 0x1A, 0x4D, 0x45, 0xCC, 0x2A, 0x0E,
-    0xEF, 0x4C, 0xE7, 0x64, 0x2C, 0x1A, 0x92, 0x0D, 0xE4, 0x3C, 0x08, 0xAF, 0x1C, 0x01, 0xED, 0x42,
-    0xDF, 0x7F, 0xB3, 0x3C, 0x31, 0xF1, 0xDE, 0xBD, 0x93, 0x31, 0xF4, 0x06, 0x97, 0x9D, 0x19, 0x7C,
-    0x64, 0x78, 0x69, 0x65, 0xAD, 0x61, 0xEC, 0xF6, 0xD3, 0x00, 0x33, 0x8D, 0xD8, 0x90, 0x3D, 0x1D,
-    0x7B, 0x90, 0xD5, 0x33, 0xD9, 0x12, 0xE6, 0x64, 0x74, 0xB1, 0x0B, 0x70, 0x93, 0x04, 0x91, 0x50,
-    0x9B, 0xF1, 0xCD, 0xDB, 0x4B, 0xFC, 0xAC, 0xFE, 0x9C, 0xFD, 0x1A, 0x42, 0x79, 0x07, 0xDE, 0x5B,
-    0xD3, 0x6B, 0x59, 0xE0, 0x5A, 0x4D, 0x81, 0xA7, 0x6A, 0x58, 0xA9, 0x86, 0x89, 0x5D, 0xB0, 0x34,
-    0x81, 0x7E, 0x59, 0xAF, 0xFB, 0x11, 0x5B, 0xC3, 0xC8, 0x3A, 0x5A, 0xA8, 0xB7, 0x8E, 0xE6, 0x37,
-    0x97, 0xEC, 0x9E, 0x30, 0x78, 0x9C, 0x7D, 0x8F, 0x4D, 0x0E, 0x01, 0x41, 0x10, 0x85, 0xDF, 0x18,
-    0x4C, 0xC7, 0x4F, 0x62, 0xE5, 0x1C, 0x6E, 0xC0, 0x0D, 0xCC, 0x0D, 0xB8, 0x81, 0xB9, 0x80, 0x90,
-    0x70, 0x09, 0x2B, 0x6B, 0x2B, 0x62, 0x2F, 0xB3, 0x70, 0x00, 0x6E, 0x20, 0xF6, 0x12, 0xC2, 0x58,
-    0x8D, 0xF1, 0xBC, 0xEE, 0x21, 0xAC, 0xD4, 0xA2, 0xFA, 0xEB, 0xFA, 0x79, 0x55, 0x05, 0xB4, 0xD2,
-    0x65, 0x01, 0x11, 0x4B, 0x00, 0x12, 0x72, 0xEE, 0x1D, 0xE9, 0x03, 0x8D, 0x27, 0xC9, 0x1D, 0xCF,
-    0x0A, 0xF6, 0x79, 0xB0, 0x9F, 0x91, 0x70, 0x45, 0x13, 0x66, 0x64, 0x55, 0xB8, 0x27, 0x10, 0x65,
-    0x43, 0xFC, 0xB1, 0xE9, 0x89, 0x9B, 0xB2, 0xA3, 0x2D, 0xAD, 0x05, 0xA2, 0xD0, 0x11, 0x63, 0xE1,
-    0x2D, 0x47, 0x56, 0x00, 0x69, 0xC6, 0x0B, 0xB9, 0x9E, 0xCD, 0x1F, 0x0A, 0x18, 0xCB, 0x6B, 0x18,
-    0xDB, 0x2A, 0x4B, 0x49, 0xFF, 0x42, 0xD6, 0x85, 0x77, 0xD2, 0x5C, 0x5D, 0x03, 0xEC, 0x23, 0x01,
-    0x23, 0x54, 0xB2, 0x96, 0xE4, 0xEA, 0x6F, 0xFC, 0x44, 0x7F, 0x6A, 0xBF, 0x0A, 0x81, 0x74, 0xBB,
-    0xB9, 0x6E, 0x51, 0xD3, 0xCE, 0xF6, 0x76, 0x4D, 0xC3, 0x43, 0x3B, 0xCC, 0xB4, 0xC3, 0xC0, 0x35,
-    0x38, 0xD3, 0x9D, 0x9D, 0xF7, 0xBE, 0x9E, 0x3A, 0xD6, 0x0E, 0x8D, 0xBB, 0x68, 0xA2, 0xDB, 0x9A,
-    0x7A, 0x5F, 0xE3, 0x87, 0xA1, 0x09, 0x78, 0x9C, 0x85, 0x8F, 0x3B, 0x0E, 0x01, 0x71, 0x10, 0xC6,
-    0x3F, 0xBB, 0xC2, 0xC6, 0x2B, 0x2A, 0xAD, 0xA3, 0x70, 0x03, 0x6E, 0xB0, 0x47, 0xE0, 0x08, 0x9B,
-    0xD0, 0xD3, 0x3A, 0x82, 0x4E, 0xF4, 0xA2, 0xD8, 0x9E, 0x46, 0xEF, 0x02, 0x82, 0x78, 0x25, 0xE2,
-    0xF1, 0xF9, 0xFE, 0xB3, 0x2B, 0x44, 0x63, 0x8A, 0x99, 0x5F, 0xE6, 0xF1, 0xCD, 0x0C, 0x10, 0x6D,
-    0x03, 0xC4, 0x0B, 0x1F, 0xB2, 0x0B, 0x43, 0x3C, 0x59, 0x71, 0x78, 0xE5, 0xA0, 0x4A, 0xD6, 0x7F,
-    0xB2, 0x43, 0xF5, 0xAE, 0x96, 0xD6, 0xFB, 0xDF, 0xFA, 0x1B, 0xCE, 0x72, 0x46, 0x31, 0x9D, 0xE5,
-    0x45, 0x6D, 0x23, 0xCE, 0x85, 0xC7, 0x04, 0x59, 0x00, 0x1E, 0xCA, 0x8C, 0xE5, 0x42, 0x57, 0x5F,
-    0x7B, 0x88, 0xE4, 0x31, 0x21, 0x1B, 0x6A, 0xBB, 0x91, 0xFE, 0x9E, 0x2C, 0x0B, 0xCF, 0x64, 0x70,
-    0xB0, 0x01, 0xB8, 0x20, 0x81, 0x40, 0xA8, 0x62, 0xE9, 0x94, 0xA8, 0xA7, 0xF8, 0xCE, 0x7E, 0xF5,
-    0x7E, 0x14, 0xF2, 0xD2, 0x6D, 0x25, 0xBA, 0x59, 0x6D, 0xDB, 0x79, 0xE8, 0xBA, 0x6D, 0xB8, 0xEB,
-    0x86, 0x91, 0x6E, 0xE8, 0xD8, 0x80, 0x59, 0x11, 0x68, 0xA6, 0xF7, 0x66, 0x34, 0x31, 0x35, 0x0C,
-    0xEC, 0xA3, 0x9E, 0x7E, 0xAB, 0x29, 0xBE, 0x00, 0x8F, 0x66, 0x95, 0xA6, 0x78, 0x9C, 0x63, 0x60,
-    0x60, 0x60, 0xF8, 0x95, 0xC7, 0x00, 0x01, 0x0D, 0xFF, 0xFF, 0x33, 0x41, 0x58, 0x1B, 0xFE, 0xFF,
-    0x67, 0x85, 0xB0, 0x16, 0xC0, 0x59, 0x0E, 0xFF, 0xDF, 0x43, 0xD5, 0x31, 0xB4, 0x88, 0x33, 0xA0,
-    0x80, 0xAF, 0xFF, 0xA1, 0x40, 0x1E, 0x3F, 0x4B, 0x40, 0x10, 0x0A, 0x18, 0x51, 0xF5, 0x93, 0xEE,
-    0x82, 0x29, 0x12, 0x20, 0x12, 0x00, 0xA6, 0x57, 0x3C, 0xE9, 0x78, 0x9C, 0x65, 0x8F, 0x3D, 0x12,
-    0x01, 0x41, 0x10, 0x85, 0x9F, 0x35, 0xCA, 0xFA, 0x4B, 0x85, 0xEB, 0x28, 0xAE, 0x20, 0x11, 0x73,
-    0x03, 0x52, 0x39, 0x89, 0x44, 0x2C, 0x93, 0x0A, 0xB6, 0xEC, 0x05, 0xD4, 0x06, 0x0E, 0xE0, 0x08,
-    0x4A, 0x95, 0x70, 0xAB, 0x28, 0x56, 0x95, 0xF2, 0xB3, 0x4F, 0x77, 0x8F, 0xCC, 0x0B, 0x7A, 0xBE,
-    0x99, 0xEE, 0x7E, 0x3D, 0x0D, 0x78, 0x39, 0x8B, 0xD3, 0xEC, 0x1C, 0xF7, 0xF7, 0x81, 0xD0, 0x8E,
-    0xA6, 0x0E, 0xD0, 0xF3, 0xC4, 0x2A, 0x70, 0xFB, 0x61, 0x0D, 0xF8, 0x90, 0xE9, 0xBA, 0x20, 0x07,
-    0x9A, 0x3F, 0x04, 0x78, 0x4A, 0x44, 0x42, 0x76, 0x7D, 0x7D, 0xF9, 0x42, 0xB6, 0x70, 0xB4, 0xBE,
-    0x2B, 0x59, 0xC7, 0x8B, 0x0F, 0x39, 0xC4, 0x20, 0x1C, 0x32, 0x95, 0x64, 0x33, 0xB7, 0x4C, 0xA4,
-    0xA8, 0xAF, 0x6F, 0x56, 0x14, 0xA5, 0x76, 0xCE, 0x0D, 0xB4, 0x45, 0xAE, 0x05, 0x23, 0xDC, 0xA5,
-    0x2E, 0x51, 0x1F, 0x27, 0x1E, 0x74, 0xEA, 0xBE, 0xC0, 0x58, 0xA7, 0xD9, 0x1F, 0x96, 0x12, 0x46,
-    0xD0, 0x06, 0x53, 0x03, 0x58, 0x79, 0x4A, 0x4B, 0x40, 0xEE, 0x31, 0x94, 0x7D, 0x4E, 0x9C, 0x65,
-    0xDC, 0xB6, 0x6D, 0xCB, 0x09, 0xFE, 0xF5, 0x05, 0xE4, 0x68, 0x9A, 0xCE, 0x78, 0x9C, 0xB5, 0xCE,
-    0xCB, 0x0D, 0x82, 0x50, 0x10, 0x85, 0xE1, 0xC3, 0xC6, 0x18, 0x49, 0x0C, 0x9D, 0x58, 0x81, 0x91,
-    0x7E, 0xD8, 0xD0, 0x81, 0x16, 0x60, 0x42, 0x13, 0x16, 0x60, 0x1B, 0x6E, 0xAD, 0x81, 0x3D, 0xEF,
-    0x0D, 0x37, 0xF2, 0x33, 0xDC, 0x0B, 0x3B, 0xB6, 0x9E, 0x64, 0x66, 0xBE, 0x64, 0x32, 0xC9, 0xA8,
-    0x87, 0x9B, 0x7C, 0x52, 0xA8, 0xA2, 0xC0, 0x2F, 0xC4, 0x41, 0x89, 0xA3, 0x08, 0xD2, 0x03, 0x0E,
-    0x2B, 0x4B, 0x2E, 0xDA, 0x4F, 0x0B, 0x47, 0x1B, 0x23, 0xFC, 0x5D, 0x6E, 0x47, 0x93, 0xD7, 0xC9,
-    0xFE, 0x06, 0x1A, 0x38, 0xFB, 0xB7, 0xA9, 0xE1, 0x2E, 0x0D, 0xA6, 0xB7, 0xD5, 0xF3, 0x63, 0x8D,
-    0x94, 0x2D, 0xCB, 0xBD, 0xA5, 0x33, 0x2D, 0x6B, 0xAE, 0xD6, 0xA5, 0xD7, 0xAF, 0xCA, 0x94, 0xC3,
-    0x0C, 0x1B, 0xC2, 0x99, 0x9C, 0x78, 0x9C, 0xB5, 0x8F, 0xB1, 0x09, 0xC2, 0x50, 0x14, 0x45, 0x6F,
-    0x23, 0x48, 0x0A, 0xC9, 0x22, 0x8E, 0x20, 0xFC, 0x7D, 0x6C, 0xDC, 0x20, 0x19, 0x20, 0x90, 0x15,
-    0x2C, 0xEC, 0xCD, 0x06, 0xD6, 0xAE, 0xE1, 0x02, 0x6A, 0x82, 0x08, 0x91, 0xEF, 0xF1, 0xFE, 0x1F,
-    0xEC, 0x62, 0xE9, 0x29, 0xDE, 0x3B, 0xDC, 0xC7, 0x2B, 0xAE, 0x64, 0x3A, 0x38, 0x29, 0xF3, 0x84,
-    0x22, 0x4B, 0x80, 0x76, 0x8A, 0x2E, 0xB0, 0xC8, 0x52, 0x46, 0xD6, 0x53, 0xB4, 0xE7, 0xA8, 0x1F,
-    0xF4, 0xB0, 0xF4, 0x1A, 0xE1, 0xEF, 0xF6, 0x9A, 0xB1, 0x77, 0x36, 0x57, 0x28, 0x81, 0x3B, 0xAC,
-    0xA4, 0xDA, 0x76, 0x83, 0x4A, 0x7A, 0xD8, 0x5C, 0x95, 0xE6, 0xEC, 0x41, 0xE0, 0x4B, 0xFA, 0x37,
-    0x83, 0x2D, 0x9D, 0xD9, 0x78, 0x4A, 0x87, 0x78, 0xDD, 0x6A, 0x07, 0x1F, 0x36, 0x30, 0x99, 0xD8,
-    0x78, 0x9C, 0xB5, 0xD0, 0xCD, 0x09, 0xC2, 0x40, 0x18, 0x84, 0xE1, 0x41, 0x50, 0x24, 0x04, 0xB1,
-    0x10, 0x5B, 0x10, 0xD2, 0x4F, 0x2E, 0xE9, 0x20, 0x29, 0xC0, 0x1E, 0xF4, 0xE0, 0x3D, 0x96, 0xA0,
-    0x47, 0xAB, 0xF1, 0x27, 0x08, 0xC6, 0x90, 0xBC, 0xCE, 0x17, 0xF0, 0x96, 0xAB, 0x03, 0xBB, 0x3C,
-    0xB0, 0xBB, 0xF0, 0xCD, 0x4A, 0x6A, 0x80, 0x99, 0x9C, 0xF5, 0x60, 0xA5, 0xA1, 0xB3, 0x41, 0x1D,
-    0xEA, 0xD8, 0x5F, 0x60, 0x29, 0x1D, 0x60, 0xA1, 0x96, 0x52, 0x7A, 0xB3, 0x91, 0xB2, 0x9E, 0xB9,
-    0x26, 0xF2, 0x1C, 0x2F, 0xEB, 0x03, 0x7F, 0x57, 0x37, 0xA1, 0x61, 0x54, 0xE2, 0x2E, 0x2E, 0xF0,
-    0x80, 0x95, 0x54, 0x59, 0x77, 0x62, 0xF0, 0x97, 0x75, 0xF2, 0xDA, 0x5D, 0xA3, 0x5E, 0xC6, 0x2F,
-    0xF1, 0xDE, 0xF1, 0x3F, 0x28, 0x8E, 0xD9, 0x7A, 0x97, 0x8E, 0xFD, 0x2D, 0x57, 0x01, 0x5F, 0xE7,
-    0xAD, 0xA5, 0x86, 0x78, 0x9C, 0x63, 0x60, 0xD8, 0x74, 0x8E, 0x85, 0xE1, 0xFA, 0x3C, 0x06, 0x20,
-    0xF8, 0xFD, 0x9F, 0xDF, 0xE0, 0xFF, 0x7F, 0x0E, 0x20, 0xEB, 0xDF, 0x7F, 0xFB, 0x84, 0xFF, 0xFF,
-    0xB9, 0x81, 0xAC, 0x3F, 0xFF, 0xE5, 0x1D, 0x20, 0x62, 0x87, 0xEE, 0xB3, 0x30, 0x3C, 0x5F, 0xCF,
-    0x40, 0x00, 0x7C, 0x82, 0x28, 0xFE, 0xF5, 0xFF, 0x3F, 0xCD, 0x59, 0xBF, 0xB1, 0xB0, 0xFE, 0x81,
-    0x59, 0x5C, 0x0C, 0x0C, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0x3F, 0x1F, 0x03, 0x43, 0x03,
-    0x90, 0xF5, 0xE1, 0xFF, 0xFF, 0x7A, 0x06, 0x86, 0xAF, 0x40, 0xD6, 0x06, 0x20, 0xEE, 0x39, 0x09,
-    0x24, 0xFE, 0x3B, 0xFC, 0x87, 0x01, 0x90, 0x7E, 0x20, 0xF8, 0x0C, 0x64, 0x81, 0xA4, 0xFF, 0xDB,
-    0x02, 0x49, 0x06, 0x86, 0x25, 0x7F, 0xDF, 0x67, 0x33, 0x14, 0xFC, 0xFF, 0x0F, 0x00, 0x58, 0xF4,
-    0x9C, 0xAB, 0x78, 0x9C, 0x75, 0x90, 0xC1, 0x4D, 0x02, 0x51, 0x14, 0x45, 0xAF, 0x41, 0x43, 0xC0,
-    0xA8, 0x74, 0x00, 0x0D, 0x98, 0xD8, 0x01, 0x76, 0x20, 0x15, 0x60, 0x01, 0x2E, 0x5C, 0x50, 0x00,
-    0xD3, 0x81, 0xAC, 0xD9, 0x0C, 0x1D, 0xE8, 0x8E, 0xA5, 0x25, 0x68, 0x07, 0xE0, 0x96, 0xCD, 0x88,
-    0x31, 0xA2, 0x01, 0xE6, 0xF8, 0xDE, 0xBC, 0xCF, 0xEC, 0x78, 0xAB, 0x93, 0x9F, 0x7F, 0xCF, 0xBB,
-    0xFF, 0x4B, 0x36, 0x2F, 0xF0, 0xA6, 0x98, 0x1F, 0x38, 0x0F, 0xBA, 0x81, 0xA7, 0x74, 0xF8, 0x01,
-    0x67, 0x09, 0xF7, 0x5C, 0x27, 0x9A, 0xF0, 0xAC, 0xE3, 0xB3, 0x8B, 0xC8, 0x04, 0x1E, 0x93, 0x72,
-    0x09, 0xDD, 0x4F, 0xB8, 0x32, 0xFC, 0x86, 0xF6, 0x0C, 0xEE, 0x0D, 0xFF, 0xE0, 0xD4, 0x36, 0xB9,
-    0xAA, 0xA4, 0x70, 0x3F, 0xD5, 0xEA, 0x5C, 0xDA, 0xB8, 0x22, 0x83, 0xBE, 0xB4, 0xB6, 0x80, 0xDE,
-    0xE1, 0x42, 0x9A, 0xB9, 0xE2, 0x0B, 0x9A, 0xD2, 0x2D, 0xDC, 0xE9, 0x17, 0x4E, 0xAA, 0x70, 0x6E,
-    0xD9, 0x57, 0x5F, 0xBD, 0xA1, 0xE8, 0x85, 0xDC, 0x73, 0x23, 0xB8, 0x4C, 0x6F, 0x9C, 0x43, 0xCB,
-    0x71, 0x00, 0x2B, 0x68, 0x54, 0x3D, 0x4B, 0xF6, 0x2C, 0xA2, 0xB2, 0x99, 0x18, 0x07, 0x9A, 0x9F,
-    0x6E, 0xA0, 0xE5, 0x0E, 0x3F, 0x62, 0xB9, 0xFA, 0x1F, 0x4A, 0xEF, 0x79, 0xC0, 0x5C, 0xF5, 0x85,
-    0x7E, 0xC2, 0x28, 0xEB, 0xD3, 0xD9, 0x55, 0x65, 0xA5, 0x6C, 0xBA, 0xC5, 0x9F, 0x98, 0xA4, 0xD1,
-    0x30, 0xB0, 0x59, 0xE3, 0x30, 0x42, 0x59, 0x59, 0x3C, 0x24, 0xD3, 0x3F, 0xBA, 0x25, 0x9D, 0x96,
-    0x78, 0x9C, 0xFB, 0xF0, 0xFF, 0x3F, 0x17, 0x03, 0x04, 0x7C, 0xA0, 0x06, 0x93, 0x13, 0x89, 0x99,
-    0xF0, 0xFA, 0x7D, 0x36, 0x84, 0xA9, 0xF1, 0xF7, 0xFF, 0xFF, 0xFF, 0xBA, 0x60, 0xE6, 0x75, 0x20,
-    0xEB, 0xFF, 0x7B, 0x46, 0x10, 0x13, 0x02, 0xB8, 0xC0, 0xCC, 0xF5, 0x2B, 0xFE, 0xFD, 0xFF, 0x6F,
-    0x0F, 0x62, 0xDE, 0x67, 0x64, 0x38, 0xF8, 0xFF, 0xFF, 0x7C, 0x10, 0xD3, 0x9E, 0x81, 0x41, 0x01,
-    0xA8, 0x18, 0xC4, 0xE4, 0x03, 0x1A, 0xF4, 0xE7, 0xFF, 0x7F, 0x46, 0x20, 0x93, 0x1B, 0xC8, 0xFC,
-    0xF9, 0xFF, 0x3F, 0x33, 0xD4, 0xE2, 0xEF, 0xFF, 0xFF, 0xB3, 0x20, 0x98, 0xAC, 0xA8, 0xA2, 0x3C,
-    0x08, 0xB5, 0xFC, 0x08, 0x13, 0xE2, 0x11, 0xE6, 0xBE, 0x67, 0x66, 0xB8, 0x08, 0xB5, 0xED, 0xFF,
-    0xFE, 0x95, 0xFF, 0xA1, 0x6E, 0x80, 0x00, 0x6E, 0x10, 0xF3, 0x0F, 0xC2, 0xBD, 0xE1, 0xFF, 0xE1,
-    0xBE, 0xE0, 0x68, 0x7C, 0x03, 0xF3, 0x1B, 0x27, 0xA1, 0x20, 0xA1, 0x90, 0x09, 0x00, 0xA9, 0x9F,
-    0xC5, 0xAF, 0x78, 0x9C, 0x85, 0x90, 0xCF, 0x4D, 0x02, 0x61, 0x10, 0xC5, 0x9F, 0x11, 0x43, 0x80,
-    0x28, 0x76, 0x80, 0x25, 0xD8, 0x01, 0x76, 0xA0, 0x15, 0x68, 0x01, 0x1E, 0x24, 0xA1, 0x00, 0xB7,
-    0x04, 0xCE, 0x5E, 0x96, 0x0E, 0x34, 0x5E, 0x38, 0x92, 0x58, 0x80, 0xA1, 0x03, 0x3C, 0x7B, 0x60,
-    0xD5, 0x10, 0xFF, 0x84, 0x65, 0x7F, 0xCC, 0x37, 0xB3, 0xEC, 0xD5, 0xB9, 0x7C, 0xBF, 0x4C, 0xE6,
-    0xBD, 0x79, 0xF3, 0x49, 0xA3, 0x55, 0x47, 0xCF, 0xAF, 0x2D, 0x59, 0xAD, 0xB9, 0x57, 0x49, 0x3F,
-    0xE1, 0x0F, 0x8F, 0x82, 0xE1, 0xBE, 0xBB, 0x8D, 0x6E, 0xB6, 0xEA, 0xEA, 0x65, 0xE9, 0xB3, 0xFF,
-    0x54, 0x09, 0x47, 0xF6, 0x4C, 0xE0, 0xEE, 0x1B, 0x7A, 0x86, 0x6F, 0x30, 0xF8, 0xC0, 0x7D, 0xD6,
-    0xD0, 0x9D, 0xC2, 0x8D, 0xE1, 0x1F, 0xB4, 0xCE, 0xB1, 0x65, 0x52, 0x45, 0x21, 0x5B, 0x84, 0x64,
-    0x8D, 0x3C, 0x45, 0x30, 0x8B, 0xCC, 0x43, 0x7C, 0x9A, 0x40, 0x0B, 0x38, 0x96, 0xA6, 0xC9, 0xE2,
-    0x0B, 0xDA, 0xD2, 0x05, 0x5C, 0xEA, 0x17, 0x0E, 0x5C, 0x9C, 0x9B, 0x76, 0x1E, 0xD1, 0x8B, 0xB3,
-    0x30, 0x4F, 0xBA, 0x31, 0x9C, 0x24, 0x7C, 0x82, 0x19, 0x74, 0x12, 0x5E, 0xC1, 0x3B, 0x1C, 0x7A,
-    0xCE, 0x8A, 0x2D, 0xCB, 0x88, 0x6C, 0x4E, 0x76, 0xA9, 0x97, 0xF9, 0x33, 0x08, 0x34, 0x9D, 0xC7,
-    0x0F, 0x9D, 0x1F, 0x15, 0x3A, 0xD4, 0x60, 0xAE, 0x66, 0x60, 0x58, 0x63, 0x84, 0x4D, 0x75, 0x5A,
-    0x7A, 0x58, 0xFB, 0xBC, 0x87, 0x0D, 0xE9, 0xC4, 0xDA, 0x34, 0x12, 0x06, 0xB6, 0x1B, 0xBC, 0x0E,
-    0x51, 0x56, 0x15, 0xB7, 0xB5, 0xD3, 0x0E, 0x17, 0x7C, 0xA0, 0xF5,
-};
-const GFXglyph OpenSans18BGlyphs[] = {
-    { 0, 0, 10, 0, 0, 8, 0 }, //  
-    { 7, 27, 11, 2, 27, 90, 8 }, // !
-    { 14, 10, 18, 2, 27, 77, 98 }, // "
-    { 24, 27, 25, 0, 27, 167, 175 }, // #
-    { 20, 31, 22, 1, 29, 182, 342 }, // $
-    { 33, 27, 34, 1, 27, 274, 524 }, // %
-    { 28, 27, 29, 1, 27, 229, 798 }, // &
-    { 6, 10, 10, 2, 27, 41, 1027 }, // '
-    { 11, 33, 13, 1, 27, 129, 1068 }, // (
-    { 11, 33, 13, 1, 27, 131, 1197 }, // )
-    { 19, 19, 21, 1, 29, 137, 1328 }, // *
-    { 20, 20, 22, 1, 23, 46, 1465 }, // +
-    { 8, 9, 11, 1, 4, 47, 1511 }, // ,
-    { 11, 5, 12, 1, 13, 20, 1558 }, // -
-    { 7, 7, 11, 2, 7, 36, 1578 }, // .
-    { 16, 27, 16, 0, 27, 108, 1614 }, // /
-    { 20, 27, 22, 1, 27, 180, 1722 }, // 0
-    { 14, 27, 22, 2, 27, 66, 1902 }, // 1
-    { 20, 27, 22, 1, 27, 153, 1968 }, // 2
-    { 20, 27, 22, 1, 27, 183, 2121 }, // 3
-    { 22, 27, 22, 0, 27, 113, 2304 }, // 4
-    { 19, 27, 22, 1, 27, 159, 2417 }, // 5
-    { 20, 27, 22, 1, 27, 192, 2576 }, // 6
-    { 20, 27, 22, 1, 27, 131, 2768 }, // 7
-    { 20, 27, 22, 1, 27, 199, 2899 }, // 8
-    { 20, 27, 22, 1, 27, 197, 3098 }, // 9
-    { 7, 21, 11, 2, 21, 55, 3295 }, // :
-    { 8, 26, 11, 1, 21, 72, 3350 }, // ;
-    { 20, 21, 22, 1, 24, 107, 3422 }, // <
-    { 20, 11, 22, 1, 19, 28, 3529 }, // =
-    { 20, 21, 22, 1, 24, 99, 3557 }, // >
-    { 18, 27, 18, 0, 27, 151, 3656 }, // ?
-    { 32, 30, 34, 1, 27, 319, 3807 }, // @
-    { 27, 27, 26, 0, 27, 194, 4126 }, // A
-    { 21, 27, 26, 3, 27, 148, 4320 }, // B
-    { 21, 27, 24, 2, 27, 170, 4468 }, // C
-    { 23, 27, 28, 3, 27, 156, 4638 }, // D
-    { 17, 27, 21, 3, 27, 44, 4794 }, // E
-    { 16, 27, 21, 3, 27, 36, 4838 }, // F
-    { 23, 27, 28, 2, 27, 192, 4874 }, // G
-    { 23, 27, 29, 3, 27, 36, 5066 }, // H
-    { 7, 27, 13, 3, 27, 15, 5102 }, // I
-    { 13, 35, 13, -3, 27, 67, 5117 }, // J
-    { 23, 27, 25, 3, 27, 149, 5184 }, // K
-    { 18, 27, 21, 3, 27, 28, 5333 }, // L
-    { 30, 27, 36, 3, 27, 196, 5361 }, // M
-    { 25, 27, 31, 3, 27, 144, 5557 }, // N
-    { 27, 27, 30, 2, 27, 186, 5701 }, // O
-    { 20, 27, 24, 3, 27, 108, 5887 }, // P
-    { 27, 33, 30, 2, 27, 214, 5995 }, // Q
-    { 23, 27, 25, 3, 27, 152, 6209 }, // R
-    { 19, 27, 21, 1, 27, 178, 6361 }, // S
-    { 22, 27, 22, 0, 27, 35, 6539 }, // T
-    { 23, 27, 29, 3, 27, 109, 6574 }, // U
-    { 25, 27, 25, 0, 27, 201, 6683 }, // V
-    { 37, 27, 37, 0, 27, 298, 6884 }, // W
-    { 26, 27, 25, 0, 27, 195, 7182 }, // X
-    { 24, 27, 24, 0, 27, 139, 7377 }, // Y
-    { 22, 27, 22, 0, 27, 137, 7516 }, // Z
-    { 10, 33, 13, 2, 27, 31, 7653 }, // [
-    { 16, 27, 16, 0, 27, 90, 7684 }, // <backslash>
-    { 10, 33, 13, 0, 27, 33, 7774 }, // ]
-    { 21, 17, 20, 0, 27, 130, 7807 }, // ^
-    { 17, 3, 16, -1, -3, 19, 7937 }, // _
-    { 11, 6, 23, 6, 29, 43, 7956 }, // `
-    { 20, 21, 23, 1, 21, 158, 7999 }, // a
-    { 21, 29, 24, 2, 29, 151, 8157 }, // b
-    { 18, 21, 20, 1, 21, 121, 8308 }, // c
-    { 21, 29, 24, 1, 29, 164, 8429 }, // d
-    { 20, 21, 22, 1, 21, 151, 8593 }, // e
-    { 17, 29, 15, 0, 29, 87, 8744 }, // f
-    { 22, 30, 21, 0, 21, 220, 8831 }, // g
-    { 21, 29, 25, 2, 29, 96, 9051 }, // h
-    { 7, 29, 12, 2, 29, 41, 9147 }, // i
-    { 12, 38, 12, -3, 29, 87, 9188 }, // j
-    { 22, 29, 24, 2, 29, 143, 9275 }, // k
-    { 7, 29, 12, 2, 29, 15, 9418 }, // l
-    { 33, 21, 37, 2, 21, 137, 9433 }, // m
-    { 21, 21, 25, 2, 21, 92, 9570 }, // n
-    { 21, 21, 24, 1, 21, 149, 9662 }, // o
-    { 21, 30, 24, 2, 21, 162, 9811 }, // p
-    { 21, 30, 24, 1, 21, 163, 9973 }, // q
-    { 15, 21, 17, 2, 21, 66, 10136 }, // r
-    { 17, 21, 19, 1, 21, 145, 10202 }, // s
-    { 16, 26, 17, 0, 26, 88, 10347 }, // t
-    { 20, 21, 25, 2, 21, 87, 10435 }, // u
-    { 22, 21, 22, 0, 21, 155, 10522 }, // v
-    { 33, 21, 33, 0, 21, 226, 10677 }, // w
-    { 22, 21, 22, 0, 21, 146, 10903 }, // x
-    { 22, 30, 22, 0, 21, 194, 11049 }, // y
-    { 17, 21, 19, 1, 21, 107, 11243 }, // z
-    { 14, 33, 15, 0, 27, 115, 11350 }, // {
-    { 5, 38, 21, 8, 29, 14, 11465 }, // |
-    { 14, 33, 15, 1, 27, 111, 11479 }, // }
-    { 20, 9, 22, 1, 18, 68, 11590 }, // ~
-    { 0, 0, 10, 0, 0, 8, 11658 }, // �
-    { 7, 28, 11, 2, 21, 91, 11666 }, // �
-    { 18, 27, 22, 2, 27, 129, 11757 }, // �
-    { 20, 27, 22, 1, 27, 125, 11886 }, // �
-    { 18, 19, 22, 2, 23, 110, 12011 }, // �
-    { 22, 27, 22, 0, 27, 139, 12121 }, // �
-    { 5, 38, 21, 8, 29, 21, 12260 }, // �
-    { 16, 29, 18, 1, 29, 181, 12281 }, // �
-    { 13, 5, 23, 5, 29, 41, 12462 }, // �
-    { 29, 27, 32, 1, 27, 266, 12503 }, // �
-    { 13, 13, 15, 0, 27, 94, 12769 }, // �
-    { 21, 17, 23, 1, 19, 128, 12863 }, // �
-    { 20, 11, 22, 1, 15, 28, 12991 }, // �
-    { 11, 5, 12, 1, 13, 20, 13019 }, // �
-    { 29, 27, 32, 1, 27, 267, 13039 }, // �
-    { 21, 4, 19, -1, 33, 18, 13306 }, // �
-    { 14, 13, 16, 1, 28, 83, 13324 }, // �
-    { 20, 25, 22, 1, 25, 53, 13407 }, // �
-    { 14, 16, 14, 0, 27, 91, 13460 }, // �
-    { 12, 16, 14, 1, 27, 93, 13551 }, // �
-    { 11, 6, 23, 6, 29, 47, 13644 }, // �
-    { 21, 30, 25, 2, 21, 85, 13691 }, // �
-    { 20, 34, 25, 2, 29, 87, 13776 }, // �
-    { 7, 7, 11, 2, 17, 36, 13863 }, // �
-    { 9, 9, 8, -1, 0, 54, 13899 }, // �
-    { 10, 16, 14, 1, 27, 42, 13953 }, // �
-    { 13, 13, 15, 1, 27, 86, 13995 }, // �
-    { 21, 17, 23, 1, 19, 126, 14081 }, // �
-    { 32, 27, 33, 0, 27, 213, 14207 }, // �
-    { 32, 27, 33, 0, 27, 221, 14420 }, // �
-    { 31, 27, 33, 1, 27, 259, 14641 }, // �
-    { 18, 28, 18, 1, 21, 145, 14900 }, // �
-    { 27, 35, 26, 0, 35, 228, 15045 }, // �
-    { 27, 35, 26, 0, 35, 228, 15273 }, // �
-    { 27, 35, 26, 0, 35, 236, 15501 }, // �
-    { 27, 35, 26, 0, 35, 244, 15737 }, // �
-    { 27, 35, 26, 0, 35, 236, 15981 }, // �
-    { 27, 34, 26, 0, 34, 235, 16217 }, // �
-    { 34, 27, 36, 0, 27, 171, 16452 }, // �
-    { 21, 36, 24, 2, 27, 209, 16623 }, // �
-    { 17, 35, 21, 3, 35, 79, 16832 }, // �
-    { 17, 35, 21, 3, 35, 79, 16911 }, // �
-    { 17, 35, 21, 3, 35, 93, 16990 }, // �
-    { 17, 35, 21, 3, 35, 84, 17083 }, // �
-    { 12, 35, 13, -2, 35, 52, 17167 }, // �
-    { 11, 35, 13, 3, 35, 52, 17219 }, // �
-    { 17, 35, 13, -2, 35, 66, 17271 }, // �
-    { 14, 35, 13, -1, 35, 52, 17337 }, // �
-    { 26, 27, 28, 0, 27, 169, 17389 }, // �
-    { 25, 35, 31, 3, 35, 190, 17558 }, // �
-    { 27, 35, 30, 2, 35, 208, 17748 }, // �
-    { 27, 35, 30, 2, 35, 209, 17956 }, // �
-    { 27, 35, 30, 2, 35, 225, 18165 }, // �
-    { 27, 35, 30, 2, 35, 225, 18390 }, // �
-    { 27, 35, 30, 2, 35, 218, 18615 }, // �
-    { 18, 17, 22, 2, 22, 103, 18833 }, // �
-    { 27, 31, 30, 2, 29, 251, 18936 }, // �
-    { 23, 35, 29, 3, 35, 139, 19187 }, // �
-    { 23, 35, 29, 3, 35, 142, 19326 }, // �
-    { 23, 35, 29, 3, 35, 154, 19468 }, // �
-    { 23, 35, 29, 3, 35, 147, 19622 }, // �
-    { 24, 35, 24, 0, 35, 169, 19769 }, // �
-    { 20, 27, 24, 3, 27, 107, 19938 }, // �
-    { 24, 29, 27, 2, 29, 196, 20045 }, // �
-    { 20, 29, 23, 1, 29, 186, 20241 }, // �
-    { 20, 29, 23, 1, 29, 188, 20427 }, // �
-    { 20, 29, 23, 1, 29, 199, 20615 }, // �
-    { 20, 29, 23, 1, 29, 199, 20814 }, // �
-    { 20, 29, 23, 1, 29, 194, 21013 }, // �
-    { 20, 32, 23, 1, 32, 203, 21207 }, // �
-    { 33, 21, 35, 1, 21, 226, 21410 }, // �
-    { 18, 30, 20, 1, 21, 168, 21636 }, // �
-    { 20, 29, 22, 1, 29, 180, 21804 }, // �
-    { 20, 29, 22, 1, 29, 179, 21984 }, // �
-    { 20, 29, 22, 1, 29, 190, 22163 }, // �
-    { 20, 29, 22, 1, 29, 184, 22353 }, // �
-    { 11, 29, 12, -2, 29, 52, 22537 }, // �
-    { 12, 29, 12, 2, 29, 52, 22589 }, // �
-    { 17, 29, 12, -3, 29, 67, 22641 }, // �
-    { 14, 29, 12, -1, 29, 48, 22708 }, // �
-    { 21, 29, 24, 1, 29, 213, 22756 }, // �
-    { 21, 29, 25, 2, 29, 140, 22969 }, // �
-    { 21, 29, 24, 1, 29, 176, 23109 }, // �
-    { 21, 29, 24, 1, 29, 181, 23285 }, // �
-    { 21, 29, 24, 1, 29, 186, 23466 }, // �
-    { 21, 29, 24, 1, 29, 194, 23652 }, // �
-    { 21, 29, 24, 1, 29, 182, 23846 }, // �
-    { 20, 19, 22, 1, 22, 62, 24028 }, // �
-    { 21, 24, 24, 1, 22, 178, 24090 }, // �
-    { 20, 29, 25, 2, 29, 121, 24268 }, // �
-    { 20, 29, 25, 2, 29, 123, 24389 }, // �
-    { 20, 29, 25, 2, 29, 131, 24512 }, // �
-    { 20, 29, 25, 2, 29, 127, 24643 }, // �
-    { 22, 38, 22, 0, 29, 222, 24770 }, // �
-    { 21, 38, 24, 2, 29, 146, 24992 }, // �
-    { 22, 38, 22, 0, 29, 233, 25138 }, // �
-};
-const UnicodeInterval OpenSans18BIntervals[] = {
-    { 0x20, 0x7E, 0x0 },
-    { 0xA0, 0xFF, 0x5F },
-};
-const GFXfont OpenSans18B = {
-    (uint8_t*)OpenSans18BBitmaps,
-    (GFXglyph*)OpenSans18BGlyphs,
-    (UnicodeInterval*)OpenSans18BIntervals,
-    2,
-    1,
-    51,
-    41,
-    -11,
-};
@@ -0,0 +1,63 @@
+#include "profiler.h"
+
+#include "canvas.h"
+#include <cstring>
+
+#ifdef ESP_PLATFORM
+#include "soc/cpu.h"
+static inline uint32_t CycleCount() { return esp_cpu_get_ccount(); }
+#else
+#include <chrono>
+static inline uint32_t CycleCount() {
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+#endif
+
+uint32_t primitiveCount[(int)Primitive::Count];
+Section_profile_type sectionProfile[(int)WakePhase::Count];
+
+void ProfileReset() { memset(sectionProfile, 0, sizeof(sectionProfile)); }
+
+const Section_profile_type &ProfileSection(WakePhase section) { return sectionProfile[(int)section]; }
+
+ProfileScope::ProfileScope(WakePhase section)
+    : timeline(section), section(section), startCycles(CycleCount()), startBytes(CanvasBytesTouched()) {
+    memcpy(startPrimitives, primitiveCount, sizeof(startPrimitives));
+}
+
+ProfileScope::~ProfileScope() {
+    // the 32 bit cycle counter wraps after 17 s at 240 MHz, far longer than any section takes
+    Section_profile_type &profile = sectionProfile[(int)section];
+    profile.Cycles += CycleCount() - startCycles;
+    profile.Runs++;
+    profile.Bytes += CanvasBytesTouched() - startBytes;
+    for(int i = 0; i < (int)Primitive::Count; i++)
+        profile.Primitives[i] += primitiveCount[i] - startPrimitives[i];
+}
+
+void ProfileDump() {
+    constexpr const char *Columns[] = {"pixel", "hline", "vline", "line", "circle", "fcircle",
+                                       "rect",  "frect", "tri",   "image", "text"};
+    static_assert(sizeof(Columns) / sizeof(Columns[0]) == (int)Primitive::Count, "a column per primitive");
+    char line[40 + (int)Primitive::Count * 8];
+    int n = snprintf(line, sizeof(line), "%-12s %4s %8s %8s", "Section", "runs", "kcycles", "bytes");
+    for(const char *column : Columns)
+        n += snprintf(line + n, sizeof(line) - n, " %7s", column);
+    log_d("%s", line);
+    uint64_t cycles = 0;
+    uint32_t bytes = 0;
+    for(int i = 0; i < (int)WakePhase::Count; i++) {
+        const Section_profile_type &p = sectionProfile[i];
+        if(!p.Runs)
+            continue;
+        n = snprintf(line, sizeof(line), "%-12s %4u %8u %8u", WakePhaseName((WakePhase)i), p.Runs,
+                     (uint32_t)(p.Cycles / 1000), p.Bytes);
+        for(uint32_t count : p.Primitives)
+            n += snprintf(line + n, sizeof(line) - n, " %7u", count);
+        log_d("%s", line);
+        cycles += p.Cycles;
+        bytes += p.Bytes;
+    }
+    log_d("%-12s %4s %8u %8u", "total", "", (uint32_t)(cycles / 1000), bytes);
+}
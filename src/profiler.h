@@ -0,0 +1,51 @@
+#pragma once
+
+#include "timeline.h"
+#include <Arduino.h>
+
+// Cost of each drawing section of the weather screen: CPU cycles, the primitives its layout code issued
+// and the framebuffer bytes they wrote, summed over every band of a frame. Cycles come from the CPU cycle
+// counter on the ESP32 and are nanoseconds on the host. Sections do not nest.
+enum class Primitive : uint8_t {
+    Pixel,
+    HLine,
+    VLine,
+    Line,
+    Circle,
+    FillCircle,
+    Rect,
+    FillRect,
+    Triangle,
+    Image,
+    Text,
+    Count
+};
+
+typedef struct {
+    uint64_t Cycles;
+    uint32_t Runs; // once per band the section was drawn in
+    uint32_t Bytes;
+    uint32_t Primitives[(int)Primitive::Count];
+} Section_profile_type;
+
+extern uint32_t primitiveCount[(int)Primitive::Count];
+
+inline void ProfileCount(Primitive primitive) { primitiveCount[(int)primitive]++; }
+
+void ProfileReset();
+const Section_profile_type &ProfileSection(WakePhase section);
+void ProfileDump();
+
+// Profiles the section until the end of the scope, and adds its time to the wake timeline
+class ProfileScope {
+  public:
+    explicit ProfileScope(WakePhase section);
+    ~ProfileScope();
+
+  private:
+    TimelineScope timeline;
+    WakePhase section;
+    uint32_t startCycles;
+    uint32_t startBytes;
+    uint32_t startPrimitives[(int)Primitive::Count];
+};
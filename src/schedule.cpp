@@ -0,0 +1,182 @@
+#include "schedule.h"
+
+#include "config.h"
+#include <esp_timer.h>
+
+constexpr time_t ValidTimeEpoch = 1609459200; // 2021-01-01, anything before means the clock was never set
+constexpr time_t MinSleep = 60;               // a wake closer than this to the next slot skips that slot
+constexpr int64_t MinDriftSpan = 3600;        // shortest sync interval in seconds to learn the drift from
+constexpr int32_t MaxDriftPpm = 100000;       // larger errors are clock steps, not oscillator drift
+
+typedef struct {
+    time_t LastData;                                 // time of the last successful data wake, 0 if none
+    Radio_report_type Days[RadioReportDays];         // ring of per-day radio reports, Days[Today] is current
+    uint8_t Today;
+    int64_t SyncUs;                                  // true time of the last sync in us, 0 if never synced
+    int64_t AppliedUs;                               // drift corrections and steps applied to the clock since
+    int64_t StepUs;                                  // steps of the clock since then by coarse time sources
+    int32_t DriftPpm;                                // learned RTC slow clock error, > 0 runs fast
+    uint8_t DriftSamples;
+} Schedule_state_type;
+
+RTC_DATA_ATTR Schedule_state_type scheduleState = {0, {}, 0, 0, 0, 0, 0, 0};
+
+// system time and esp_timer at boot, after the drift correction, to tell the time a sync replaced
+int64_t bootClockUs = 0;
+int64_t bootTimerUs = 0;
+
+int64_t ClockUs() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static void SetClockUs(int64_t us) {
+    struct timeval tv = {.tv_sec = (time_t)(us / 1000000), .tv_usec = (suseconds_t)(us % 1000000)};
+    settimeofday(&tv, nullptr);
+}
+
+bool TimeIsValid(time_t now) { return now >= ValidTimeEpoch; }
+
+void CorrectClockDrift() {
+    int64_t now = ClockUs();
+    if(scheduleState.SyncUs != 0 && scheduleState.DriftSamples > 0 && TimeIsValid(now / 1000000)) {
+        // the RTC kept time with the same drifting oscillator that timed the sleep
+        int64_t raw = now - scheduleState.AppliedUs - scheduleState.SyncUs;
+        int64_t elapsed = raw * 1000000 / (1000000 + scheduleState.DriftPpm);
+        int64_t correction = scheduleState.SyncUs + scheduleState.StepUs + elapsed - now;
+        if(correction != 0) {
+            SetClockUs(now + correction);
+            scheduleState.AppliedUs += correction;
+            now += correction;
+        }
+        log_d("Clock corrected by %d ms for %d ppm drift", (int)(correction / 1000), scheduleState.DriftPpm);
+    }
+    bootClockUs = now;
+    bootTimerUs = esp_timer_get_time();
+}
+
+void ClockSynced(const struct timeval &truth) {
+    int64_t trueUs = (int64_t)truth.tv_sec * 1000000 + truth.tv_usec;
+    // what the clock said just before the sync replaced it
+    int64_t estimateUs = bootClockUs + (esp_timer_get_time() - bootTimerUs);
+    int64_t span = trueUs - scheduleState.SyncUs;
+    if(scheduleState.SyncUs != 0 && TimeIsValid(bootClockUs / 1000000) && span >= MinDriftSpan * 1000000) {
+        int64_t rawError = estimateUs - scheduleState.AppliedUs - trueUs;
+        // per whole second of the span, so a clock set years off cannot overflow it
+        int64_t ppm = rawError / (span / 1000000);
+        log_d("Clock was off by %d ms (%d ms uncorrected) after %d s, %d ppm",
+              (int)((estimateUs - trueUs) / 1000), (int)(rawError / 1000), (int)(span / 1000000), (int)ppm);
+        if(llabs(ppm) < MaxDriftPpm) {
+            if(scheduleState.DriftSamples == 0)
+                scheduleState.DriftPpm = ppm;
+            else
+                scheduleState.DriftPpm = (scheduleState.DriftPpm * 3 + ppm) / 4;
+            if(scheduleState.DriftSamples < UINT8_MAX)
+                scheduleState.DriftSamples++;
+        }
+    }
+    scheduleState.SyncUs = trueUs;
+    scheduleState.AppliedUs = 0;
+    scheduleState.StepUs = 0;
+    bootClockUs = trueUs;
+    bootTimerUs = esp_timer_get_time();
+}
+
+void ClockStepped(const struct timeval &truth) {
+    // the drift correction keeps the step, the drift learned at the next sync leaves it out
+    int64_t step = (int64_t)truth.tv_sec * 1000000 + truth.tv_usec - ClockUs();
+    settimeofday(&truth, nullptr);
+    scheduleState.AppliedUs += step;
+    scheduleState.StepUs += step;
+    bootClockUs += step;
+}
+
+int32_t ClockDriftPpm() { return scheduleState.DriftPpm; }
+
+int64_t ClockErrorBound() {
+    if(scheduleState.SyncUs == 0)
+        return INT64_MAX;
+    // the largest drift still learned, over the time the oscillator ran since the sync
+    int64_t span = ClockUs() - scheduleState.AppliedUs - scheduleState.SyncUs;
+    return std::max<int64_t>(span, 0) / 1000000 * MaxDriftPpm / 1000000 + 1;
+}
+
+time_t NextDataWake() {
+    if(scheduleState.LastData == 0)
+        return 0;
+    // align to the provider's update cadence, not to the time of the last fetch; a fetch that woke a
+    // little early belongs to the slot it woke for
+    time_t slot = (scheduleState.LastData + MinSleep - DataOffset) / DataInterval;
+    return (slot + 1) * DataInterval + DataOffset;
+}
+
+WakeKind PlanWake(time_t now) {
+    if(!TimeIsValid(now) || scheduleState.LastData == 0) {
+        log_d("No valid time or cached data, data wake");
+        return WakeKind::Data;
+    }
+    time_t next = NextDataWake();
+    // the timer and the drift correction can wake us a moment before the slot, which then is this wake
+    if(now + MinSleep >= next) {
+        log_d("Data due since %ld s, data wake", now - next);
+        return WakeKind::Data;
+    }
+    log_d("Next data wake in %ld s, render wake", next - now);
+    return WakeKind::Render;
+}
+
+time_t NextWake(time_t now) {
+    // render wakes land on multiples of SleepDuration, data wakes on the provider's cadence
+    time_t next = ((now + MinSleep) / SleepDuration + 1) * SleepDuration;
+    time_t data = NextDataWake();
+    if(data > now + MinSleep && data < next)
+        next = data;
+    return next;
+}
+
+time_t WakeSlot(time_t now) {
+    time_t slot = (now + MinSleep) / SleepDuration * SleepDuration;
+    return slot > now ? slot : now;
+}
+
+uint64_t SleepTimeUs(time_t target) {
+    int64_t sleep = (int64_t)target * 1000000 - ClockUs();
+    if(sleep < 0)
+        sleep = 0;
+    // the timer counts on the drifting RTC slow clock as well
+    return sleep * (1000000 + scheduleState.DriftPpm) / 1000000;
+}
+
+void ScheduleDataReceived(time_t now) { scheduleState.LastData = now; }
+
+static void LogRadioReport(const Radio_report_type &day) {
+    log_i("Radio report day %d: %u ms on, %u data / %u render wakes", day.Yday, day.RadioOnMs, day.DataWakes,
+          day.RenderWakes);
+}
+
+void ScheduleRecordWake(time_t now, WakeKind kind, uint32_t radioOnMs) {
+    struct tm local;
+    localtime_r(&now, &local);
+
+    Radio_report_type *day = &scheduleState.Days[scheduleState.Today];
+    if(day->Yday != local.tm_yday) {
+        if(day->DataWakes || day->RenderWakes)
+            LogRadioReport(*day);
+        scheduleState.Today = (scheduleState.Today + 1) % RadioReportDays;
+        day = &scheduleState.Days[scheduleState.Today];
+        *day = {static_cast<int16_t>(local.tm_yday), 0, 0, 0};
+    }
+    if(kind == WakeKind::Data)
+        day->DataWakes++;
+    else
+        day->RenderWakes++;
+    day->RadioOnMs += radioOnMs;
+    log_d("Radio on for %u ms this wake, %u ms today", radioOnMs, day->RadioOnMs);
+}
+
+const Radio_report_type *RadioReport(int daysAgo) {
+    if(daysAgo < 0 || daysAgo >= RadioReportDays)
+        return nullptr;
+    return &scheduleState.Days[(scheduleState.Today + RadioReportDays - daysAgo) % RadioReportDays];
+}
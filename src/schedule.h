@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Arduino.h>
+#include <sys/time.h>
+#include <time.h>
+
+// A data wake brings up the radio and fetches fresh weather data, a render wake only redraws the
+// parts of the screen that change without new data (clock, battery and moon) from the RTC cache.
+enum class WakeKind : uint8_t { Data, Render };
+
+typedef struct { // radio usage of one local calendar day
+    int16_t Yday;
+    uint16_t DataWakes;
+    uint16_t RenderWakes;
+    uint32_t RadioOnMs;
+} Radio_report_type;
+
+constexpr int RadioReportDays = 7;
+
+WakeKind PlanWake(time_t now);
+time_t NextDataWake();
+time_t NextWake(time_t now);
+time_t WakeSlot(time_t now); // the slot a wake that fired a moment early was aimed at, else now
+uint64_t SleepTimeUs(time_t target);
+int64_t ClockUs(); // the system time in microseconds
+void CorrectClockDrift();
+void ClockSynced(const struct timeval &truth); // after an NTP sync, learns the drift
+void ClockStepped(const struct timeval &truth); // sets the clock from a source too coarse to learn the drift
+int32_t ClockDriftPpm();
+int64_t ClockErrorBound(); // seconds the clock can be off since the last sync, INT64_MAX if never synced
+void ScheduleDataReceived(time_t now);
+void ScheduleRecordWake(time_t now, WakeKind kind, uint32_t radioOnMs);
+const Radio_report_type *RadioReport(int daysAgo);
+bool TimeIsValid(time_t now);
@@ -1,44 +1,44 @@
-const uint32_t sunset_width = 48;
-const uint32_t sunset_height = 40;
-const uint8_t sunset_data[(48*40)/2] = {
-0xEF, 0xEF, 0xEE, 0xFE, 0xFE, 0xEE, 0xEF, 0xEE, 0xEF, 0xEF, 0xFE, 0x3D, 0xE4, 0xFE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEF, 0xEF, 0xEE, 0xFE, 0xFE, 0xFE, 
-  0xFE, 0xEE, 0xEF, 0xEF, 0xEE, 0xEE, 0xFE, 0xEF, 0xEE, 0xFE, 0xFE, 0x09, 0xB0, 0xEF, 0xEF, 0xEE, 0xEF, 0xEF, 0xFE, 0xFE, 0xEE, 0xEF, 0xEF, 0xEE, 
-  0xEF, 0xEE, 0xFE, 0xFE, 0xEF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0x09, 0xB0, 0xEF, 0xFE, 0xFE, 0xEF, 0xEE, 0xFE, 0xEE, 0xEF, 0xFE, 0xEE, 0xEF, 
-  0xEE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFE, 0xEE, 0xFE, 0x09, 0xB0, 0xEF, 0xFE, 0xEE, 0xEE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 
-  0xFE, 0xEE, 0xEF, 0xEE, 0xEE, 0xEE, 0xFE, 0xFE, 0xEE, 0xFE, 0xFE, 0x09, 0xB0, 0xEF, 0xEE, 0xEE, 0xEF, 0xEE, 0xEE, 0xFE, 0xFE, 0xEF, 0xFE, 0xFE, 
-  0xEE, 0xEE, 0xEF, 0xFE, 0xFF, 0xEE, 0xEF, 0xEE, 0xEE, 0xEF, 0xFE, 0x09, 0xC0, 0xEF, 0xEF, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xEF, 0xFE, 0xEE, 0xFE, 
-  0xEE, 0xEE, 0xEE, 0xCF, 0xFC, 0xEF, 0xEE, 0xEE, 0xFE, 0xFE, 0xFE, 0x09, 0xB0, 0xEF, 0xEF, 0xEF, 0xFE, 0xEE, 0xFE, 0xBE, 0xFC, 0xEF, 0xEF, 0xEF, 
-  0xEF, 0xEF, 0xFE, 0x0B, 0xA0, 0xFF, 0xEE, 0xEE, 0xEF, 0xEE, 0xEF, 0x7E, 0xE8, 0xFE, 0xFE, 0xFE, 0xEE, 0xFE, 0xFF, 0x08, 0xD1, 0xEF, 0xFE, 0xFE, 
-  0xEE, 0xEE, 0xFE, 0x0C, 0x00, 0xFA, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xEF, 0xEF, 0xEF, 0xFF, 0xFF, 0xFE, 0x8F, 0x00, 0xD2, 0xEF, 0xEF, 0xEF, 
-  0xEF, 0xEF, 0xFE, 0xAF, 0x00, 0xA0, 0xEF, 0xEF, 0xEF, 0xEF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0x08, 0x10, 0xFC, 0xFE, 0xEE, 0xFE, 
-  0xFE, 0xEE, 0xEE, 0xFF, 0x0A, 0x00, 0xFA, 0xFE, 0xFE, 0xDF, 0x58, 0x22, 0x21, 0x74, 0xEB, 0xFF, 0xEE, 0x8F, 0x00, 0xC1, 0xEF, 0xEE, 0xEF, 0xEE, 
-  0xEF, 0xEE, 0xEE, 0xFE, 0xAF, 0x00, 0xF5, 0xFE, 0xBF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF9, 0xEF, 0x3E, 0x20, 0xFC, 0xEE, 0xFE, 0xFE, 0xEE, 
-  0xEE, 0xEE, 0xFE, 0xEF, 0xFF, 0x5B, 0xFB, 0xEF, 0x05, 0x00, 0x20, 0x65, 0x57, 0x03, 0x00, 0x30, 0xFC, 0x9F, 0xC5, 0xEF, 0xFE, 0xEE, 0xFE, 0xEE, 
-  0xFE, 0xEE, 0xFF, 0xFE, 0xEE, 0xFF, 0xFF, 0x3D, 0x00, 0x70, 0xFB, 0xFF, 0xFF, 0xDF, 0x29, 0x00, 0xA1, 0xFF, 0xFF, 0xEE, 0xEF, 0xEF, 0xEF, 0xEE, 
-  0xEF, 0xEE, 0xEF, 0xEF, 0xFE, 0xFE, 0xDF, 0x02, 0x50, 0xFD, 0xFF, 0xFE, 0xEE, 0xFF, 0xEF, 0x07, 0x00, 0xFA, 0xEF, 0xEF, 0xEE, 0xFE, 0xFE, 0xFE, 
-  0xEE, 0xEE, 0xEE, 0xEF, 0xEF, 0xFF, 0x3F, 0x00, 0xF7, 0xEF, 0xEE, 0xEF, 0xEF, 0xEE, 0xFE, 0xBF, 0x01, 0xC1, 0xFF, 0xEE, 0xFE, 0xEE, 0xEF, 0xEF, 
-  0xEF, 0xEF, 0xEE, 0xEE, 0xFE, 0xFE, 0x07, 0x70, 0xFF, 0xEE, 0xEF, 0xEE, 0xEE, 0xFE, 0xEE, 0xFF, 0x0B, 0x30, 0xFF, 0xEE, 0xFE, 0xFE, 0xFE, 0xFE, 
-  0xFE, 0xEE, 0xEE, 0xEF, 0xEF, 0xCF, 0x00, 0xF4, 0xFF, 0xFE, 0xEE, 0xFE, 0xEF, 0xEF, 0xEF, 0xFE, 0x8F, 0x00, 0xF8, 0xEE, 0xEF, 0xEF, 0xEF, 0xEF, 
-  0xEF, 0xEF, 0xFE, 0xEE, 0xFE, 0x7F, 0x00, 0xFC, 0xEE, 0xEF, 0xEF, 0xEE, 0xFE, 0xFE, 0xFE, 0xEE, 0xEF, 0x03, 0xE3, 0xEF, 0xEE, 0xFE, 0xEF, 0xEE, 
-  0xEF, 0xFE, 0xEE, 0xEF, 0xEF, 0x1E, 0x50, 0xFF, 0xEE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xEF, 0xFE, 0x09, 0xB0, 0xFF, 0xFE, 0xEF, 0xEF, 0xEF, 
-  0xFE, 0xEE, 0xEE, 0xEE, 0xFE, 0x0A, 0x90, 0xEF, 0xFE, 0xEE, 0xFE, 0xEE, 0xEF, 0xEF, 0xEF, 0xEE, 0xFF, 0x1D, 0x70, 0xEF, 0xEE, 0xFE, 0xEE, 0xEF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xD0, 0xEF, 0xEE, 0xEF, 0xEF, 0xEF, 0xEE, 0xFE, 0xEE, 0xFE, 0xEE, 0x3F, 0x40, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x7B, 0x77, 0x77, 0xD7, 0xFF, 0x06, 0xE1, 0xFE, 0xEE, 0xFE, 0xFE, 0xEE, 0xEE, 0xEF, 0xEF, 0xEF, 0xEE, 0x6F, 0x20, 0xFE, 0x9E, 0x77, 0x77, 0xB7, 
-  0x01, 0x00, 0x00, 0x70, 0xFF, 0x04, 0xE2, 0xEF, 0xEE, 0xEF, 0xEF, 0xEE, 0xEE, 0xFE, 0xFE, 0xEE, 0xEE, 0x7F, 0x10, 0xFE, 0x08, 0x00, 0x00, 0x10, 
-  0x04, 0x01, 0x01, 0x90, 0xFF, 0x04, 0xE3, 0xEF, 0xEE, 0xEE, 0xFE, 0xEE, 0xEF, 0xEF, 0xEF, 0xEF, 0xFE, 0x7F, 0x20, 0xFE, 0x0A, 0x10, 0x10, 0x40, 
-  0xDF, 0xDD, 0xDD, 0xFE, 0xFE, 0xEE, 0xFD, 0xFE, 0xEE, 0xEE, 0xEF, 0xEF, 0xEE, 0xFE, 0xFE, 0xEE, 0xEE, 0xEF, 0xDE, 0xEF, 0xEF, 0xED, 0xDD, 0xFD, 
-  0xFE, 0xFF, 0xFF, 0xEF, 0xEE, 0xFF, 0xEF, 0xEF, 0xFE, 0xEE, 0xFE, 0xFE, 0xEF, 0xEE, 0xEE, 0xEF, 0xFE, 0xFE, 0xFF, 0xEE, 0xFE, 0xEF, 0xEF, 0xEF, 
-  0xEF, 0xEF, 0xEE, 0xFE, 0xFE, 0xEF, 0xEF, 0xEE, 0xEF, 0xEF, 0xEE, 0xEF, 0xFE, 0xEE, 0xEF, 0xEE, 0xEE, 0xEF, 0xEF, 0xEE, 0xEE, 0xFE, 0xFE, 0xFE, 
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xEF, 0xFE, 0xEF, 0xFE, 0xFE, 0xEE, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 
-  0xDF, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xFE, 0xEE, 0xFE, 0xEF, 0xEF, 0xEF, 0xFE, 0xDF, 0xDD, 0xDE, 0xDE, 0xDE, 0xDD, 0xDD, 0xDD, 0xFD, 
-  0x15, 0x10, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0xA1, 0xEF, 0xEE, 0xFE, 0xFE, 0xEE, 0xFF, 0x08, 0x11, 0x10, 0x01, 0x10, 0x11, 0x01, 0x01, 0x71, 
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xEF, 0xEE, 0xEF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
-  0x7B, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x37, 0x00, 0x60, 0xFF, 0xFE, 0xFE, 0xEF, 0x04, 0x00, 0x75, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0xE5, 0xEF, 0xFE, 0x2C, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xEF, 0xEF, 0xEF, 0xFE, 0xEE, 0xEF, 0xEE, 0xFF, 0x7F, 0x00, 0x40, 0xFE, 0xAF, 0x01, 0x00, 0xF9, 0xEF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFE, 0xFE, 0xEE, 
-  0xEE, 0xFE, 0xEE, 0xEF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0x08, 0x00, 0xE4, 0x08, 0x00, 0xB1, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFE, 0xEF, 0xEF, 0xEE, 
-  0xEE, 0xEF, 0xFE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xAF, 0x00, 0x10, 0x00, 0x20, 0xFC, 0xEE, 0xEF, 0xEE, 0xFE, 0xEE, 0xEF, 0xEF, 0xEE, 0xEF, 
-  0xEE, 0xEE, 0xEF, 0xEE, 0xEE, 0xFE, 0xEE, 0xEE, 0xEE, 0xFF, 0x1C, 0x00, 0x00, 0xD3, 0xEF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFE, 0xEF, 0xFE, 0xEE, 0xFE, 
-  0xEE, 0xFE, 0xEE, 0xEF, 0xEE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDF, 0x03, 0x50, 0xFF, 0xEF, 0xEE, 0xEE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xEE, 
-  0xEF, 0xEE, 0xFE, 0xEE, 0xEE, 0xEE, 0xFE, 0xEE, 0xEF, 0xFF, 0xFE, 0x4E, 0xF7, 0xFE, 0xFE, 0xEE, 0xFE, 0xEE, 0xEE, 0xEF, 0xFE, 0xEE, 0xFE, 0xEE, 
-  };
+const uint32_t sunset_width = 48;
+const uint32_t sunset_height = 40;
+const uint8_t sunset_data[(48*40)/2] = {
+0xEF, 0xEF, 0xEE, 0xFE, 0xFE, 0xEE, 0xEF, 0xEE, 0xEF, 0xEF, 0xFE, 0x3D, 0xE4, 0xFE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEF, 0xEF, 0xEE, 0xFE, 0xFE, 0xFE, 
+  0xFE, 0xEE, 0xEF, 0xEF, 0xEE, 0xEE, 0xFE, 0xEF, 0xEE, 0xFE, 0xFE, 0x09, 0xB0, 0xEF, 0xEF, 0xEE, 0xEF, 0xEF, 0xFE, 0xFE, 0xEE, 0xEF, 0xEF, 0xEE, 
+  0xEF, 0xEE, 0xFE, 0xFE, 0xEF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0x09, 0xB0, 0xEF, 0xFE, 0xFE, 0xEF, 0xEE, 0xFE, 0xEE, 0xEF, 0xFE, 0xEE, 0xEF, 
+  0xEE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFE, 0xEE, 0xFE, 0x09, 0xB0, 0xEF, 0xFE, 0xEE, 0xEE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 
+  0xFE, 0xEE, 0xEF, 0xEE, 0xEE, 0xEE, 0xFE, 0xFE, 0xEE, 0xFE, 0xFE, 0x09, 0xB0, 0xEF, 0xEE, 0xEE, 0xEF, 0xEE, 0xEE, 0xFE, 0xFE, 0xEF, 0xFE, 0xFE, 
+  0xEE, 0xEE, 0xEF, 0xFE, 0xFF, 0xEE, 0xEF, 0xEE, 0xEE, 0xEF, 0xFE, 0x09, 0xC0, 0xEF, 0xEF, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xEF, 0xFE, 0xEE, 0xFE, 
+  0xEE, 0xEE, 0xEE, 0xCF, 0xFC, 0xEF, 0xEE, 0xEE, 0xFE, 0xFE, 0xFE, 0x09, 0xB0, 0xEF, 0xEF, 0xEF, 0xFE, 0xEE, 0xFE, 0xBE, 0xFC, 0xEF, 0xEF, 0xEF, 
+  0xEF, 0xEF, 0xFE, 0x0B, 0xA0, 0xFF, 0xEE, 0xEE, 0xEF, 0xEE, 0xEF, 0x7E, 0xE8, 0xFE, 0xFE, 0xFE, 0xEE, 0xFE, 0xFF, 0x08, 0xD1, 0xEF, 0xFE, 0xFE, 
+  0xEE, 0xEE, 0xFE, 0x0C, 0x00, 0xFA, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xEF, 0xEF, 0xEF, 0xFF, 0xFF, 0xFE, 0x8F, 0x00, 0xD2, 0xEF, 0xEF, 0xEF, 
+  0xEF, 0xEF, 0xFE, 0xAF, 0x00, 0xA0, 0xEF, 0xEF, 0xEF, 0xEF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0x08, 0x10, 0xFC, 0xFE, 0xEE, 0xFE, 
+  0xFE, 0xEE, 0xEE, 0xFF, 0x0A, 0x00, 0xFA, 0xFE, 0xFE, 0xDF, 0x58, 0x22, 0x21, 0x74, 0xEB, 0xFF, 0xEE, 0x8F, 0x00, 0xC1, 0xEF, 0xEE, 0xEF, 0xEE, 
+  0xEF, 0xEE, 0xEE, 0xFE, 0xAF, 0x00, 0xF5, 0xFE, 0xBF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF9, 0xEF, 0x3E, 0x20, 0xFC, 0xEE, 0xFE, 0xFE, 0xEE, 
+  0xEE, 0xEE, 0xFE, 0xEF, 0xFF, 0x5B, 0xFB, 0xEF, 0x05, 0x00, 0x20, 0x65, 0x57, 0x03, 0x00, 0x30, 0xFC, 0x9F, 0xC5, 0xEF, 0xFE, 0xEE, 0xFE, 0xEE, 
+  0xFE, 0xEE, 0xFF, 0xFE, 0xEE, 0xFF, 0xFF, 0x3D, 0x00, 0x70, 0xFB, 0xFF, 0xFF, 0xDF, 0x29, 0x00, 0xA1, 0xFF, 0xFF, 0xEE, 0xEF, 0xEF, 0xEF, 0xEE, 
+  0xEF, 0xEE, 0xEF, 0xEF, 0xFE, 0xFE, 0xDF, 0x02, 0x50, 0xFD, 0xFF, 0xFE, 0xEE, 0xFF, 0xEF, 0x07, 0x00, 0xFA, 0xEF, 0xEF, 0xEE, 0xFE, 0xFE, 0xFE, 
+  0xEE, 0xEE, 0xEE, 0xEF, 0xEF, 0xFF, 0x3F, 0x00, 0xF7, 0xEF, 0xEE, 0xEF, 0xEF, 0xEE, 0xFE, 0xBF, 0x01, 0xC1, 0xFF, 0xEE, 0xFE, 0xEE, 0xEF, 0xEF, 
+  0xEF, 0xEF, 0xEE, 0xEE, 0xFE, 0xFE, 0x07, 0x70, 0xFF, 0xEE, 0xEF, 0xEE, 0xEE, 0xFE, 0xEE, 0xFF, 0x0B, 0x30, 0xFF, 0xEE, 0xFE, 0xFE, 0xFE, 0xFE, 
+  0xFE, 0xEE, 0xEE, 0xEF, 0xEF, 0xCF, 0x00, 0xF4, 0xFF, 0xFE, 0xEE, 0xFE, 0xEF, 0xEF, 0xEF, 0xFE, 0x8F, 0x00, 0xF8, 0xEE, 0xEF, 0xEF, 0xEF, 0xEF, 
+  0xEF, 0xEF, 0xFE, 0xEE, 0xFE, 0x7F, 0x00, 0xFC, 0xEE, 0xEF, 0xEF, 0xEE, 0xFE, 0xFE, 0xFE, 0xEE, 0xEF, 0x03, 0xE3, 0xEF, 0xEE, 0xFE, 0xEF, 0xEE, 
+  0xEF, 0xFE, 0xEE, 0xEF, 0xEF, 0x1E, 0x50, 0xFF, 0xEE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xEF, 0xFE, 0x09, 0xB0, 0xFF, 0xFE, 0xEF, 0xEF, 0xEF, 
+  0xFE, 0xEE, 0xEE, 0xEE, 0xFE, 0x0A, 0x90, 0xEF, 0xFE, 0xEE, 0xFE, 0xEE, 0xEF, 0xEF, 0xEF, 0xEE, 0xFF, 0x1D, 0x70, 0xEF, 0xEE, 0xFE, 0xEE, 0xEF, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xD0, 0xEF, 0xEE, 0xEF, 0xEF, 0xEF, 0xEE, 0xFE, 0xEE, 0xFE, 0xEE, 0x3F, 0x40, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 
+  0x7B, 0x77, 0x77, 0xD7, 0xFF, 0x06, 0xE1, 0xFE, 0xEE, 0xFE, 0xFE, 0xEE, 0xEE, 0xEF, 0xEF, 0xEF, 0xEE, 0x6F, 0x20, 0xFE, 0x9E, 0x77, 0x77, 0xB7, 
+  0x01, 0x00, 0x00, 0x70, 0xFF, 0x04, 0xE2, 0xEF, 0xEE, 0xEF, 0xEF, 0xEE, 0xEE, 0xFE, 0xFE, 0xEE, 0xEE, 0x7F, 0x10, 0xFE, 0x08, 0x00, 0x00, 0x10, 
+  0x04, 0x01, 0x01, 0x90, 0xFF, 0x04, 0xE3, 0xEF, 0xEE, 0xEE, 0xFE, 0xEE, 0xEF, 0xEF, 0xEF, 0xEF, 0xFE, 0x7F, 0x20, 0xFE, 0x0A, 0x10, 0x10, 0x40, 
+  0xDF, 0xDD, 0xDD, 0xFE, 0xFE, 0xEE, 0xFD, 0xFE, 0xEE, 0xEE, 0xEF, 0xEF, 0xEE, 0xFE, 0xFE, 0xEE, 0xEE, 0xEF, 0xDE, 0xEF, 0xEF, 0xED, 0xDD, 0xFD, 
+  0xFE, 0xFF, 0xFF, 0xEF, 0xEE, 0xFF, 0xEF, 0xEF, 0xFE, 0xEE, 0xFE, 0xFE, 0xEF, 0xEE, 0xEE, 0xEF, 0xFE, 0xFE, 0xFF, 0xEE, 0xFE, 0xEF, 0xEF, 0xEF, 
+  0xEF, 0xEF, 0xEE, 0xFE, 0xFE, 0xEF, 0xEF, 0xEE, 0xEF, 0xEF, 0xEE, 0xEF, 0xFE, 0xEE, 0xEF, 0xEE, 0xEE, 0xEF, 0xEF, 0xEE, 0xEE, 0xFE, 0xFE, 0xFE, 
+  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xEF, 0xFE, 0xEF, 0xFE, 0xFE, 0xEE, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 
+  0xDF, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xFE, 0xEE, 0xFE, 0xEF, 0xEF, 0xEF, 0xFE, 0xDF, 0xDD, 0xDE, 0xDE, 0xDE, 0xDD, 0xDD, 0xDD, 0xFD, 
+  0x15, 0x10, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0xA1, 0xEF, 0xEE, 0xFE, 0xFE, 0xEE, 0xFF, 0x08, 0x11, 0x10, 0x01, 0x10, 0x11, 0x01, 0x01, 0x71, 
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xEF, 0xEE, 0xEF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+  0x7B, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x37, 0x00, 0x60, 0xFF, 0xFE, 0xFE, 0xEF, 0x04, 0x00, 0x75, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xC7, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0xE5, 0xEF, 0xFE, 0x2C, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+  0xEF, 0xEF, 0xEF, 0xFE, 0xEE, 0xEF, 0xEE, 0xFF, 0x7F, 0x00, 0x40, 0xFE, 0xAF, 0x01, 0x00, 0xF9, 0xEF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFE, 0xFE, 0xEE, 
+  0xEE, 0xFE, 0xEE, 0xEF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0x08, 0x00, 0xE4, 0x08, 0x00, 0xB1, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFE, 0xEF, 0xEF, 0xEE, 
+  0xEE, 0xEF, 0xFE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xAF, 0x00, 0x10, 0x00, 0x20, 0xFC, 0xEE, 0xEF, 0xEE, 0xFE, 0xEE, 0xEF, 0xEF, 0xEE, 0xEF, 
+  0xEE, 0xEE, 0xEF, 0xEE, 0xEE, 0xFE, 0xEE, 0xEE, 0xEE, 0xFF, 0x1C, 0x00, 0x00, 0xD3, 0xEF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFE, 0xEF, 0xFE, 0xEE, 0xFE, 
+  0xEE, 0xFE, 0xEE, 0xEF, 0xEE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDF, 0x03, 0x50, 0xFF, 0xEF, 0xEE, 0xEE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xEE, 
+  0xEF, 0xEE, 0xFE, 0xEE, 0xEE, 0xEE, 0xFE, 0xEE, 0xEF, 0xFF, 0xFE, 0x4E, 0xF7, 0xFE, 0xFE, 0xEE, 0xFE, 0xEE, 0xEE, 0xEF, 0xFE, 0xEE, 0xFE, 0xEE, 
+  };
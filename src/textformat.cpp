@@ -0,0 +1,61 @@
+#include "textformat.h"
+
+#include <math.h>
+
+constexpr float Scale[FormatMaxDecimals + 1] = {1.0f, 10.0f, 100.0f, 1000.0f};
+
+char *FormatText(char *out, char *end, const char *text) {
+    if(out >= end)
+        return out;
+    char *start = out;
+    while(*text && out < end - 1)
+        *out++ = *text++;
+    // a cut inside a UTF-8 sequence drops the part of the character that was copied
+    if(((unsigned char)*text & 0xC0) == 0x80) {
+        while(out > start && ((unsigned char)out[-1] & 0xC0) == 0x80)
+            out--;
+        if(out > start)
+            out--;
+    }
+    *out = '\0';
+    return out;
+}
+
+// magnitude with a decimal point before the last decimals digits, at least one digit before the point
+static char *FormatScaled(char *out, char *end, bool negative, uint32_t magnitude, int decimals) {
+    char digits[12];
+    int count = 0;
+    do {
+        digits[count++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while(magnitude || count <= decimals);
+    if(out >= end)
+        return out;
+    if(negative && out < end - 1)
+        *out++ = '-';
+    while(count && out < end - 1) {
+        if(count == decimals)
+            *out++ = '.';
+        if(out < end - 1)
+            *out++ = digits[--count];
+    }
+    *out = '\0';
+    return out;
+}
+
+char *FormatInt(char *out, char *end, int32_t value, const char *suffix) {
+    uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : value;
+    out = FormatScaled(out, end, value < 0, magnitude, 0);
+    return FormatText(out, end, suffix);
+}
+
+char *FormatFixed(char *out, char *end, float value, int decimals, const char *suffix) {
+    decimals = constrain(decimals, 0, FormatMaxDecimals);
+    float scaled = roundf(fabsf(value) * Scale[decimals]);
+    if(!(scaled < 4294967296.0f)) // also catches NaN
+        return FormatText(FormatText(out, end, "-"), end, suffix);
+    uint32_t magnitude = scaled;
+    // no "-0" for values that round to zero
+    out = FormatScaled(out, end, value < 0 && magnitude, magnitude, decimals);
+    return FormatText(out, end, suffix);
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <Arduino.h>
+#include <iterator>
+
+// Number formatting for the display labels into a caller buffer, without the heap allocation of
+// String(value, decimals) or the dtoa of printf's %f. Every function writes at out, never past end - 1,
+// NUL terminates and returns the position of the terminator, so labels are built by chaining calls:
+//
+//   char label[24];
+//   char *p = FormatFixed(label, std::end(label), temperature, 1, "°   ");
+//   FormatFixed(p, std::end(label), humidity, 0, "%");
+//
+// Values are rounded half away from zero; one that does not fit in 32 bits once scaled prints as "-". Text
+// that does not fit is cut between UTF-8 characters.
+constexpr int FormatMaxDecimals = 3;
+
+char *FormatText(char *out, char *end, const char *text);
+char *FormatInt(char *out, char *end, int32_t value, const char *suffix = "");
+char *FormatFixed(char *out, char *end, float value, int decimals, const char *suffix = "");
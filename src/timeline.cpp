@@ -0,0 +1,199 @@
+#include "timeline.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <atomic>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+
+constexpr const char *PhaseNames[] = {"InitialiseSystem", "InitialiseDisplay", "StartWiFi", "SetupTime",
+                                      "Connect", "Tls", "Headers", "Body", "Decode", "Clear", "Title",
+                                      "CompassRose", "GraphFrames", "Status", "GeneralInfo", "Wind",
+                                      "Astronomy", "MainWeather", "Icon", "Forecast", "Graphs", "Update"};
+static_assert(sizeof(PhaseNames) / sizeof(PhaseNames[0]) == (int)WakePhase::Count, "a name for every phase");
+
+typedef struct {
+    const char *Stage;
+    uint32_t StartUs;
+    uint32_t EndUs;
+    uint8_t Core;
+    WakePhase Phase; // WakePhase::Count for a stage that is no phase
+    Heap_start_type Heap;
+} Timeline_entry_type;
+
+Timeline_entry_type timeline[TimelineStages];
+std::atomic<int> timelineUsed(0);
+
+static int TimelineStart(const char *stage, WakePhase phase) {
+    int slot = timelineUsed.fetch_add(1);
+    if(slot >= TimelineStages) {
+        log_w("No timeline slot for %s", stage);
+        return -1;
+    }
+    Timeline_entry_type &e = timeline[slot];
+    e = {stage, 0, 0, (uint8_t)xPortGetCoreID(), phase, {}};
+    if(phase != WakePhase::Count)
+        e.Heap = HeapStart();
+    e.StartUs = esp_timer_get_time();
+    return slot;
+}
+
+int TimelineBegin(const char *stage) { return TimelineStart(stage, WakePhase::Count); }
+
+int TimelineBegin(WakePhase phase) { return TimelineStart(PhaseNames[(int)phase], phase); }
+
+void TimelineEnd(int slot) {
+    if(slot < 0 || slot >= TimelineStages)
+        return;
+    Timeline_entry_type &e = timeline[slot];
+    e.EndUs = esp_timer_get_time();
+    if(e.Phase != WakePhase::Count) {
+        TimelineAdd(e.Phase, e.EndUs - e.StartUs);
+        HeapAdd(e.Phase, e.Heap);
+    }
+}
+
+void TimelineDump() {
+    int used = std::min(timelineUsed.load(), TimelineStages);
+    log_d("Stage                 core   start     end  (ms)");
+    for(int i = 0; i < used; i++) {
+        const Timeline_entry_type &e = timeline[i];
+        if(e.EndUs)
+            log_d("%-20s   %d  %7.1f %7.1f  %6.1f", e.Stage, e.Core, e.StartUs / 1000.0, e.EndUs / 1000.0,
+                  (e.EndUs - e.StartUs) / 1000.0);
+        else
+            log_d("%-20s   %d  %7.1f     ---", e.Stage, e.Core, e.StartUs / 1000.0);
+    }
+}
+
+typedef struct {
+    Wake_record_type Wakes[TimelineWakes];
+    uint8_t Next;
+    uint8_t Count;
+} Wake_history_type;
+
+typedef struct {
+    bool Sampled;
+    uint32_t MinFree;
+    uint32_t Largest;
+    uint32_t PsramFree;
+    uint32_t Allocations;
+} Heap_sample_type;
+
+RTC_DATA_ATTR Wake_history_type wakeHistory = {{}, 0, 0};
+std::atomic<uint32_t> phaseUs[(int)WakePhase::Count];
+Heap_sample_type phaseHeap[(int)WakePhase::Count];
+std::atomic<uint32_t> allocations(0);
+
+#ifdef ESP_PLATFORM
+// counted through the --wrap linker flags in platformio.ini, heap_caps_malloc() calls are not
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    if(size)
+        allocations.fetch_add(1, std::memory_order_relaxed);
+    return __real_realloc(ptr, size);
+}
+}
+#endif
+
+uint32_t HeapAllocations() { return allocations.load(std::memory_order_relaxed); }
+
+Heap_start_type HeapStart() {
+    Heap_start_type start;
+    start.Free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    start.Lowest = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+    start.Psram = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    start.PsramLowest = heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM);
+    start.Allocations = HeapAllocations();
+    return start;
+}
+
+// the all time low only moves when a phase goes below it, otherwise the phase stayed above it and its ends
+// are the best estimate there is
+static uint32_t PhaseLow(uint32_t startFree, uint32_t startLowest, uint32_t free, uint32_t lowest) {
+    return lowest < startLowest ? lowest : std::min(startFree, free);
+}
+
+void HeapAdd(WakePhase phase, const Heap_start_type &start) {
+    uint32_t free = PhaseLow(start.Free, start.Lowest, heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+                             heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL));
+    uint32_t psram = PhaseLow(start.Psram, start.PsramLowest, heap_caps_get_free_size(MALLOC_CAP_SPIRAM),
+                              heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM));
+    uint32_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+    Heap_sample_type &sample = phaseHeap[(int)phase];
+    if(!sample.Sampled)
+        sample = {true, free, largest, psram, 0};
+    sample.MinFree = std::min(sample.MinFree, free);
+    sample.Largest = std::min(sample.Largest, largest);
+    sample.PsramFree = std::min(sample.PsramFree, psram);
+    sample.Allocations += HeapAllocations() - start.Allocations;
+}
+
+const char *WakePhaseName(WakePhase phase) { return PhaseNames[(int)phase]; }
+
+void TimelineAdd(WakePhase phase, uint32_t us) { phaseUs[(int)phase].fetch_add(us); }
+
+void TimelineCommit(time_t start, uint32_t awakeMs) {
+    Wake_record_type &wake = wakeHistory.Wakes[wakeHistory.Next];
+    wake.Start = start;
+    wake.AwakeMs = awakeMs;
+    for(int i = 0; i < (int)WakePhase::Count; i++)
+        wake.PhaseMs[i] = std::min<uint32_t>((phaseUs[i].load() + 500) / 1000, UINT16_MAX);
+    for(int i = 0; i < (int)WakePhase::Count; i++)
+        wake.MinFreeKB[i] = phaseHeap[i].Sampled ? phaseHeap[i].MinFree / 1024 : HeapUnsampled;
+    wakeHistory.Next = (wakeHistory.Next + 1) % TimelineWakes;
+    if(wakeHistory.Count < TimelineWakes)
+        wakeHistory.Count++;
+}
+
+const Wake_record_type *WakeHistory(int wakesAgo) {
+    if(wakesAgo < 0 || wakesAgo >= wakeHistory.Count)
+        return nullptr;
+    return &wakeHistory.Wakes[(wakeHistory.Next + TimelineWakes - 1 - wakesAgo) % TimelineWakes];
+}
+
+void WakeHistoryDump() {
+    // one column per wake, newest first
+    char line[24 + TimelineWakes * 7];
+    int n = snprintf(line, sizeof(line), "%-17s", "Phase (ms)");
+    for(int w = 0; w < wakeHistory.Count; w++)
+        n += snprintf(line + n, sizeof(line) - n, " %6d", -w);
+    log_d("%s", line);
+    for(int i = 0; i <= (int)WakePhase::Count; i++) {
+        bool awake = i == (int)WakePhase::Count;
+        n = snprintf(line, sizeof(line), "%-17s", awake ? "awake" : PhaseNames[i]);
+        for(int w = 0; w < wakeHistory.Count; w++) {
+            const Wake_record_type *wake = WakeHistory(w);
+            n += snprintf(line + n, sizeof(line) - n, " %6u", awake ? wake->AwakeMs : wake->PhaseMs[i]);
+        }
+        log_d("%s", line);
+    }
+
+    // this wake, with the lowest free heap of every wake kept to spot a shrinking headroom
+    log_d("%-17s %6s %7s %6s %6s %6s", "Heap (KB)", "free", "largest", "psram", "allocs", "lowest");
+    for(int i = 0; i < (int)WakePhase::Count; i++) {
+        const Heap_sample_type &sample = phaseHeap[i];
+        if(!sample.Sampled)
+            continue;
+        uint16_t lowest = sample.MinFree / 1024;
+        for(int w = 0; w < wakeHistory.Count; w++)
+            lowest = std::min(lowest, WakeHistory(w)->MinFreeKB[i]);
+        log_d("%-17s %6u %7u %6u %6u %6u", PhaseNames[i], (unsigned)(sample.MinFree / 1024),
+              (unsigned)(sample.Largest / 1024), (unsigned)(sample.PsramFree / 1024),
+              (unsigned)sample.Allocations, lowest);
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <time.h>
+
+// Phases of a wake. Their time is summed over the wake (a section drawn once per band counts every band),
+// the last TimelineWakes wakes are kept in RTC memory and survive deep sleep.
+enum class WakePhase : uint8_t {
+    InitialiseSystem,
+    InitialiseDisplay,
+    StartWiFi,
+    SetupTime,
+    Connect, // DNS lookup
+    Tls,     // TCP connect and TLS handshake
+    Headers, // request sent until the response headers are in
+    Body,    // waiting for the response body
+    Decode,  // JSON parsing of the body as it arrives
+    Clear,
+    Title,
+    CompassRose,
+    GraphFrames,
+    Status,
+    GeneralInfo,
+    Wind,
+    Astronomy,
+    MainWeather,
+    Icon,
+    Forecast,
+    Graphs,
+    Update, // pushing the image to the panel
+    Count
+};
+
+// Start and end times of the boot stages of one wake, relative to boot, with the core they ran on.
+// Stages may overlap when they run on different cores. A stage begun for a phase is named after it and adds
+// its time and heap to the phase, phases entered more than once a wake use a TimelineScope instead.
+constexpr int TimelineStages = 24;
+
+int TimelineBegin(const char *stage);
+int TimelineBegin(WakePhase phase);
+void TimelineEnd(int slot);
+void TimelineDump();
+
+// Heap during the phases, sampled at the ends of their stages and scopes: the lowest free internal heap,
+// the smallest largest free internal block, the lowest free PSRAM and the number of malloc, calloc and
+// realloc calls. The lowest free heap is exact when a phase set a new all time low and taken at its start
+// and end otherwise. Phases running on the other core at the same time share the allocations and may share
+// the low. Only the lowest free heap goes into the RTC record, phases never sampled hold HeapUnsampled.
+constexpr uint16_t HeapUnsampled = UINT16_MAX;
+
+constexpr int TimelineWakes = 8;
+
+typedef struct {
+    time_t Start; // wall clock at boot, 0 if the clock was not set
+    uint32_t AwakeMs;
+    uint16_t PhaseMs[(int)WakePhase::Count];
+    uint16_t MinFreeKB[(int)WakePhase::Count];
+} Wake_record_type;
+
+typedef struct {
+    uint32_t Free;
+    uint32_t Lowest;
+    uint32_t Psram;
+    uint32_t PsramLowest;
+    uint32_t Allocations;
+} Heap_start_type;
+
+const char *WakePhaseName(WakePhase phase);
+void TimelineAdd(WakePhase phase, uint32_t us);
+void TimelineCommit(time_t start, uint32_t awakeMs);
+const Wake_record_type *WakeHistory(int wakesAgo);
+void WakeHistoryDump();
+uint32_t HeapAllocations();
+Heap_start_type HeapStart();
+void HeapAdd(WakePhase phase, const Heap_start_type &start);
+
+class HeapScope {
+  public:
+    explicit HeapScope(WakePhase phase) : phase(phase), start(HeapStart()) {}
+    ~HeapScope() { HeapAdd(phase, start); }
+
+  private:
+    WakePhase phase;
+    Heap_start_type start;
+};
+
+// the heap is sampled outside of the time measured
+class TimelineScope {
+  public:
+    explicit TimelineScope(WakePhase phase) : phase(phase), heap(phase), startUs(esp_timer_get_time()) {}
+    ~TimelineScope() { TimelineAdd(phase, esp_timer_get_time() - startUs); }
+
+  private:
+    WakePhase phase;
+    HeapScope heap;
+    int64_t startUs;
+};
@@ -0,0 +1,80 @@
+#include "timesource.h"
+
+#include "config.h"
+#include "schedule.h"
+
+RTC_DATA_ATTR Time_report_type timeReport = {0, 0, 0};
+
+bool dateSynced = false; // the clock was set from a Date header during this wake
+
+const Time_report_type &TimeReport() { return timeReport; }
+
+bool NtpSyncDue(time_t now) {
+    return !UseHttpDate || !TimeIsValid(now) || timeReport.LastNtp == 0 || now - timeReport.LastNtp >= NtpInterval;
+}
+
+void NtpSynced(const struct timeval &tv) {
+    timeReport.LastNtp = tv.tv_sec;
+    ClockSynced(tv);
+}
+
+static constexpr int64_t DaysFromCivil(int y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    const int era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097LL + static_cast<int64_t>(doe) - 719468;
+}
+
+time_t ParseHttpDate(const char *date) {
+    // IMF-fixdate, e.g. "Sun, 06 Nov 1994 08:49:37 GMT"
+    static const char *months = "JanFebMarAprMayJunJulAugSepOctNovDec";
+    char month[4];
+    int day, year, hour, minute, second;
+    if(!date || sscanf(date, "%*3s, %2d %3s %4d %2d:%2d:%2d GMT", &day, month, &year, &hour, &minute, &second) != 6)
+        return 0;
+    const char *m = strstr(months, month);
+    if(!m || (m - months) % 3)
+        return 0;
+    int64_t days = DaysFromCivil(year, (m - months) / 3 + 1, day);
+    return days * 86400 + hour * 3600 + minute * 60 + second;
+}
+
+void HttpDateReceived(const char *date) {
+    time_t t = ParseHttpDate(date);
+    if(!t) {
+        log_w("No usable Date header: '%s'", date ? date : "");
+        return;
+    }
+    // the header is truncated to whole seconds, assume we are half way into it
+    int64_t trueUs = (int64_t)t * 1000000 + 500000;
+    int64_t offset = trueUs - ClockUs();
+    timeReport.DateOffsetMs = offset / 1000;
+    log_i("Date header is %d ms off the clock", timeReport.DateOffsetMs);
+    if(UseHttpDate && !dateSynced && (!TimeIsValid(time(NULL)) || llabs(offset) >= 1000000)) {
+        struct timeval tv = {.tv_sec = (time_t)(trueUs / 1000000), .tv_usec = (suseconds_t)(trueUs % 1000000)};
+        // whole seconds are too coarse to learn the drift from, NTP teaches it
+        ClockStepped(tv);
+        dateSynced = true;
+        log_i("Clock set from the Date header");
+    }
+}
+
+void ObservationTimeReceived(time_t dt) {
+    // a damaged response could set the clock anywhere, the observation cannot be ahead of the clock by more
+    // than the clock may have drifted since the last sync
+    time_t now = time(NULL);
+    if(!TimeIsValid(dt) || (TimeIsValid(now) && (int64_t)dt - now > ClockErrorBound())) {
+        log_w("Ignoring current.dt %lld", (long long)dt);
+        return;
+    }
+    timeReport.ObservationLag = now - dt;
+    log_i("OWM current.dt is %d s behind the clock", timeReport.ObservationLag);
+    // the observation time is only a lower bound of the true time, use it if the clock is clearly behind
+    if(UseHttpDate && !dateSynced && dt > now) {
+        struct timeval tv = {.tv_sec = dt, .tv_usec = 0};
+        ClockStepped(tv);
+        log_i("Clock set from current.dt");
+    }
+}
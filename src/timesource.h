@@ -0,0 +1,18 @@
+#pragma once
+
+#include <Arduino.h>
+#include <sys/time.h>
+#include <time.h>
+
+typedef struct { // offsets between the time sources, for monitoring
+    time_t LastNtp;          // last NTP sync, 0 if none since cold boot
+    int32_t DateOffsetMs;    // HTTP Date header minus the system clock
+    int32_t ObservationLag;  // system clock minus OWM current.dt in seconds
+} Time_report_type;
+
+bool NtpSyncDue(time_t now);
+void NtpSynced(const struct timeval &tv);
+void HttpDateReceived(const char *date);
+void ObservationTimeReceived(time_t dt);
+time_t ParseHttpDate(const char *date);
+const Time_report_type &TimeReport();
@@ -0,0 +1,157 @@
+#include "bench.h"
+#include "fixtures.h"
+#include "forecast_record.h"
+#include "host.h"
+#include <Arduino.h>
+#include <unity.h>
+
+// Throughput and peak heap of DecodeWeather() on the recorded responses of every fixture, written to
+// .pio/bench/decode.json for tools/bench_compare.py. Besides the responses as OWM sends them, the rain
+// forecast is also decoded pretty printed and cut to the 24 periods the firmware uses, which must decode
+// to the same weather. That comparison is the one a replacement decoder has to pass as well:
+//
+//     pio test -e native -f bench_decode
+
+// from the firmware
+constexpr int max_readings = 24;
+bool DecodeWeather(Stream &json, const bool forecast);
+extern Forecast_record_type WxConditions;
+extern Forecast_record_type WxForecast[max_readings];
+
+namespace {
+
+// everything DecodeWeather() sets, one line per record
+std::string DecodedWeather() {
+    std::string text;
+    char line[256];
+    const Forecast_record_type &c = WxConditions;
+    snprintf(line, sizeof(line), "now %s \"%s\" %d %g %g %g %g %g %g %g %g %g %d %d %d %d %d %g\n",
+             c.Icon.c_str(), c.Forecast0.c_str(), (int)c.Trend, c.Temperature, c.FeelsLike, c.DewPoint,
+             c.Humidity, c.High, c.Low, c.Winddir, c.Windspeed, c.Pressure, c.Cloudcover, c.Visibility,
+             c.Sunrise, c.Sunset, c.FTimezone, c.UVI);
+    text += line;
+    for(const Forecast_record_type &f : WxForecast) {
+        snprintf(line, sizeof(line), "%d %s %g %g %g %g %g %g %g\n", f.Dt, f.Icon.c_str(), f.Temperature,
+                 f.Low, f.High, f.Pressure, f.Humidity, f.Rainfall, f.Snowfall);
+        text += line;
+    }
+    return text;
+}
+
+// a line per value with two spaces of indent per level, about what a browser saves
+std::string PrettyPrint(const std::string &json) {
+    std::string pretty;
+    int depth = 0;
+    bool quoted = false;
+    for(size_t i = 0; i < json.size(); i++) {
+        char c = json[i];
+        if(quoted) {
+            pretty += c;
+            if(c == '\\')
+                pretty += json[++i];
+            else if(c == '"')
+                quoted = false;
+            continue;
+        }
+        if(c == '}' || c == ']')
+            pretty += "\n" + std::string(2 * --depth, ' ');
+        pretty += c;
+        if(c == '"')
+            quoted = true;
+        else if(c == ':')
+            pretty += ' ';
+        else if(c == '{' || c == '[')
+            pretty += "\n" + std::string(2 * ++depth, ' ');
+        else if(c == ',')
+            pretty += "\n" + std::string(2 * depth, ' ');
+    }
+    return pretty;
+}
+
+// the forecast with only the first periods of "list", as the cnt parameter of the request would return it
+std::string CutList(const std::string &json, int periods) {
+    size_t start = json.find("\"list\":[");
+    if(start == std::string::npos)
+        return json;
+    int depth = 0, count = 0;
+    bool quoted = false;
+    for(size_t i = start + 8; i < json.size(); i++) {
+        char c = json[i];
+        if(quoted) {
+            i += c == '\\';
+            quoted = c != '"';
+        } else if(c == '"') {
+            quoted = true;
+        } else if(c == '{' || c == '[') {
+            depth++;
+        } else if(c == ']' && depth == 0) {
+            return json; // fewer periods than that
+        } else if((c == '}' || c == ']') && --depth == 0 && ++count == periods) {
+            size_t end = i + 1, close = end;
+            for(int level = 0; close < json.size() && !(json[close] == ']' && level == 0); close++)
+                level += json[close] == '[' ? 1 : json[close] == ']' ? -1 : 0;
+            return json.substr(0, end) + json.substr(close);
+        }
+    }
+    return json;
+}
+
+bool Decode(const std::string &json, bool forecast) {
+    FixtureStream stream(json);
+    return DecodeWeather(stream, forecast);
+}
+
+void BenchDecode(const std::string &name, const std::string &json, bool forecast) {
+    TEST_ASSERT_TRUE_MESSAGE(Decode(json, forecast), name.c_str());
+    BenchRun("DecodeWeather/" + name, [&json, forecast] { Decode(json, forecast); }, 0, json.size());
+}
+
+} // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_fixtures() {
+    for(const std::string &fixture : FixtureNames()) {
+        std::string directory = ProjectPath("test/fixtures/owm/" + fixture + "/");
+        BenchDecode(fixture + "/onecall", ReadFile(directory + "onecall.json"), false);
+        BenchDecode(fixture + "/forecast", ReadFile(directory + "forecast.json"), true);
+    }
+}
+
+void test_variants_decode_alike() {
+    std::string forecast = ReadFile(ProjectPath("test/fixtures/owm/rain/forecast.json"));
+    TEST_ASSERT_TRUE(Decode(forecast, true));
+    std::string expected = DecodedWeather();
+    std::string pretty = PrettyPrint(forecast), cut = CutList(forecast, max_readings);
+    TEST_ASSERT_TRUE(cut.size() < forecast.size());
+
+    BenchDecode("rain/forecast/pretty", pretty, true);
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), DecodedWeather().c_str());
+    BenchDecode("rain/forecast/cnt24", cut, true);
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), DecodedWeather().c_str());
+}
+
+void test_short_forecast_is_rejected() {
+    std::string forecast = ReadFile(ProjectPath("test/fixtures/owm/rain/forecast.json"));
+    TEST_ASSERT_FALSE(Decode(CutList(forecast, max_readings - 1), true));
+}
+
+void test_truncated_forecast_is_rejected() {
+    std::string forecast = ReadFile(ProjectPath("test/fixtures/owm/rain/forecast.json"));
+    TEST_ASSERT_FALSE(Decode(forecast.substr(0, forecast.size() / 2), true));
+}
+
+int main(int argc, char **argv) {
+    HostFreezeClock(true);
+    UNITY_BEGIN();
+    RUN_TEST(test_fixtures);
+    RUN_TEST(test_variants_decode_alike);
+    RUN_TEST(test_short_forecast_is_rejected);
+    RUN_TEST(test_truncated_forecast_is_rejected);
+    std::string path = ProjectPath(".pio/bench/decode.json");
+    bool written = BenchWriteJson(path);
+    printf(written ? "Results in %s\n" : "Could not write %s\n", path.c_str());
+    return UNITY_END() || !written;
+}
@@ -0,0 +1,172 @@
+#include "bench.h"
+#include "canvas.h"
+#include "fixtures.h"
+#include "fonts/opensans10b.h"
+#include "fonts/opensans12b.h"
+#include "fonts/opensans18b.h"
+#include "fonts/opensans24b.h"
+#include "fonts/opensans8b.h"
+#include "host.h"
+#include "textformat.h"
+#include <Arduino.h>
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <unity.h>
+
+// Timings of the drawing primitives and of the whole weather screen, each in isolation on a full
+// framebuffer, written to .pio/bench/render.json for tools/bench_compare.py:
+//
+//     pio test -e native -f bench_render
+//     python3 tools/bench_compare.py old/render.json .pio/bench/render.json
+
+// from the firmware
+enum class Alignment { LEFT, RIGHT, CENTER };
+enum class Color : uint8_t { White = 0xFF, LightGrey = 0xBB, Grey = 0x88, DarkGrey = 0x44, Black = 0x00 };
+void setFont(const Canvas_font_type &font);
+void drawString(int x, int y, const char *text, Alignment align);
+void fillCircle(int x, int y, int r, Color color);
+void addcloud(int x, int y, int scale, int linesize);
+void DrawGraph(int x_pos, int y_pos, int gwidth, int gheight, float Y1Min, float Y1Max, const char *title,
+               float DataArray[], int readings, bool auto_scale, bool barchart_mode);
+void DrawMoon(int x, int y, int diameter, int dd, int mm, int yy, bool northenHemisphere);
+void arrow(int x, int y, int asize, float aangle, int pwidth, int plength);
+void DisplayWeather();
+
+namespace {
+
+// the fonts of the firmware, without the fallback of the forecast text
+constexpr Canvas_font_type Fonts[] = {
+    CanvasFont(OpenSans8B, OpenSans8BIntervals),   CanvasFont(OpenSans10B, OpenSans10BIntervals),
+    CanvasFont(OpenSans12B, OpenSans12BIntervals), CanvasFont(OpenSans18B, OpenSans18BIntervals),
+    CanvasFont(OpenSans24B, OpenSans24BIntervals),
+};
+const char *const FontNames[] = {"OpenSans8B", "OpenSans10B", "OpenSans12B", "OpenSans18B", "OpenSans24B"};
+constexpr char Text[] = "Thunderstorm with heavy rain 1013hPa";
+constexpr int BandHeight = 60;
+
+uint8_t frame[CanvasRowBytes(CanvasFormat::Gray4) * EPD_HEIGHT];
+
+void FullFrame() {
+    memset(frame, 0xFF, sizeof(frame));
+    CanvasSetTarget(frame, 0, EPD_HEIGHT);
+}
+
+// the walk over the Unicode intervals that every character took before the direct table
+const GFXglyph *IntervalGlyph(const GFXfont &font, uint32_t cp) {
+    for(uint32_t i = 0; i < font.interval_count; i++) {
+        if(cp < font.intervals[i].first)
+            return nullptr;
+        if(cp <= font.intervals[i].last)
+            return &font.glyph[font.intervals[i].offset + (cp - font.intervals[i].first)];
+    }
+    return nullptr;
+}
+
+// 24 readings are the 3 days of forecast the firmware keeps, 40 the 5 days OWM sends
+void GraphReadings(float *readings, int count) {
+    for(int i = 0; i < count; i++)
+        readings[i] = 1005 + 8 * sinf(i * 0.4f);
+}
+
+} // namespace
+
+void setUp() { FullFrame(); }
+
+void tearDown() {}
+
+void test_text() {
+    for(size_t f = 0; f < std::size(Fonts); f++) {
+        BenchRun(std::string("drawString/") + FontNames[f], [f] {
+            setFont(Fonts[f]);
+            drawString(480, 270, Text, Alignment::CENTER);
+        }, strlen(Text));
+    }
+}
+
+void test_glyph_lookup() {
+    const Canvas_font_type &font = Fonts[2];
+    BenchRun("GlyphLookup/intervals", [&font] {
+        for(const char *c = Text; *c; c++)
+            BenchKeep(IntervalGlyph(*font.Font, (uint8_t)*c));
+    }, strlen(Text));
+    BenchRun("GlyphLookup/direct", [&font] {
+        for(const char *c = Text; *c; c++)
+            BenchKeep(&font.Font->glyph[font.Direct[(uint8_t)*c - DirectFirst]]);
+    }, strlen(Text));
+}
+
+void test_format() {
+    float value = 1013.25f;
+    Bench_result_type *fixed = BenchRun("Format/FormatFixed", [&value] {
+        char label[16];
+        FormatFixed(label, std::end(label), value, 1, "hPa");
+        BenchKeep(label);
+    });
+    BenchRun("Format/String", [&value] {
+        String label = String(value, 1) + "hPa";
+        BenchKeep(label);
+    });
+    if(fixed)
+        TEST_ASSERT_EQUAL_INT(0, (int)fixed->Allocations);
+
+    // a cut never leaves half a UTF-8 character behind
+    char cut[4];
+    FormatText(cut, std::end(cut), "ab\xC3\xA4");
+    TEST_ASSERT_EQUAL_STRING("ab", cut);
+    FormatText(cut, std::end(cut), "a\xC3\xA4");
+    TEST_ASSERT_EQUAL_STRING("a\xC3\xA4", cut);
+}
+
+void test_shapes() {
+    BenchRun("fillCircle/r20", [] { fillCircle(480, 270, 20, Color::Grey); });
+    BenchRun("fillCircle/r60", [] { fillCircle(480, 270, 60, Color::Grey); });
+    BenchRun("addcloud/large", [] { addcloud(835, 140, 20, 5); });
+    BenchRun("addcloud/small", [] { addcloud(480, 300, 7, 2); });
+    BenchRun("arrow", [] { arrow(137, 150, 78, 118, 18, 33); });
+    BenchRun("DrawMoon", [] { DrawMoon(5 - 28, 252 - 15, 75, 15, 7, 2024, true); });
+}
+
+void test_graph() {
+    static float readings[40];
+    for(int count : {24, 40}) {
+        GraphReadings(readings, count);
+        BenchRun("DrawGraph/lines/" + std::to_string(count), [count] {
+            DrawGraph(42, 410, 175, 100, 900, 1050, "Pressure", readings, count, true, false);
+        }, count);
+        BenchRun("DrawGraph/bars/" + std::to_string(count), [count] {
+            DrawGraph(42, 410, 175, 100, 0, 30, "Rainfall", readings, count, true, true);
+        }, count);
+    }
+}
+
+void test_display_weather() {
+    TEST_ASSERT_TRUE_MESSAGE(LoadFixture("rain"), "fixture rain");
+    BenchRun("DisplayWeather/full", [] {
+        FullFrame();
+        DisplayWeather();
+    });
+    BenchRun("DisplayWeather/bands", [] {
+        static uint8_t band[CanvasRowBytes(CanvasFormat::Gray4) * BandHeight];
+        for(int top = 0; top < EPD_HEIGHT; top += BandHeight) {
+            memset(band, 0xFF, sizeof(band));
+            CanvasSetTarget(band, top, std::min(BandHeight, EPD_HEIGHT - top));
+            DisplayWeather();
+        }
+    });
+}
+
+int main(int argc, char **argv) {
+    HostFreezeClock(true);
+    UNITY_BEGIN();
+    RUN_TEST(test_text);
+    RUN_TEST(test_glyph_lookup);
+    RUN_TEST(test_format);
+    RUN_TEST(test_shapes);
+    RUN_TEST(test_graph);
+    RUN_TEST(test_display_weather);
+    std::string path = ProjectPath(".pio/bench/render.json");
+    bool written = BenchWriteJson(path);
+    printf(written ? "Results in %s\n" : "Could not write %s\n", path.c_str());
+    return UNITY_END() || !written;
+}
@@ -0,0 +1,28 @@
+#include "fixtures.h"
+#include <Arduino.h>
+#include <algorithm>
+#include <string>
+
+// libFuzzer target of DecodeWeather(), built and run by tools/fuzz_decode.sh with the responses of
+// test/fixtures/owm as the seed corpus. An input with a "list" goes in as a forecast, anything else as
+// the current conditions. The decoded strings then go through SaveWeatherCache(), as after a wake, so
+// reads past what the decoder set up show up too. Not a PlatformIO test, platformio.ini ignores it.
+
+// from the firmware
+bool DecodeWeather(Stream &json, const bool forecast);
+void SaveWeatherCache();
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    static const std::string list = "\"list\"";
+    bool forecast = std::search(data, data + size, list.begin(), list.end()) != data + size;
+    FixtureStream stream((const char *)data, size);
+    if(DecodeWeather(stream, forecast))
+        SaveWeatherCache();
+    return 0;
+}
+
+// the shim's main() would run the firmware, so start libFuzzer here
+extern "C" int LLVMFuzzerRunDriver(int *argc, char ***argv,
+                                   int (*callback)(const uint8_t *data, size_t size));
+
+int main(int argc, char **argv) { return LLVMFuzzerRunDriver(&argc, &argv, LLVMFuzzerTestOneInput); }
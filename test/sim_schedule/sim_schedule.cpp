@@ -0,0 +1,534 @@
+#include "fixtures.h"
+#include "host.h"
+#include "schedule.h"
+#include "config.h" // after the Arduino types
+#include <Arduino.h>
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <random>
+#include <string>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <unity.h>
+#include <vector>
+
+// Weeks of deep sleep and wakes in seconds: every wake runs setup() of the firmware in a child process,
+// which keeps the RTC memory of the previous wake and starts everything else afresh like the reset out of
+// deep sleep does. Between wakes the virtual clock moves over the sleep the firmware asked for, on an RTC
+// that drifts, so the schedule, the quiet hours, the daylight saving changes of Timezone and the clock
+// corrections all run as on the device. The weather comes from a stand-in server for the fixture, which
+// can be taken down for a while, along with the WiFi, or lose requests at random.
+//
+// Every wake goes to .pio/sim/wakes.csv, the totals and an energy estimate to .pio/sim/summary.json, so a
+// change to the schedule can be measured over a month before it ships:
+//
+//     pio test -e native -f sim_schedule
+//
+// Environment variables set up the run:
+//
+//     SIM_START        UTC time of the first power on, 2024-03-25T12:00 (after the observation time of
+//                      the fixture, else its current.dt can set the clock ahead)
+//     SIM_DAYS         how long to run, 30
+//     SIM_DRIFT_PPM    how much faster the RTC runs than the world, 300
+//     SIM_WIFI_DOWN    outages of the WiFi as START:HOURS pairs separated by commas, START in hours after
+//                      SIM_START, 50:6 by default
+//     SIM_SERVER_DOWN  outages of the server the same way, it answers 503; 150:3 by default
+//     SIM_LOSS         percent of the requests that fail with 503 at random, 0
+//     SIM_SEED         of the random losses, 1
+//     SIM_REQUEST_MS   how long a request takes on the device, round trips and download, 600
+//     SIM_FIXTURE      the weather served, rain
+//     SIM_BATTERY_MAH  the capacity the battery life is estimated for, 2000
+//     SIM_VERBOSE      set to see the log of every wake
+
+// from the firmware
+extern WakeKind wakeKind;
+extern uint32_t radioOnMs;
+extern bool weatherReceived;
+extern struct tm timeinfo;
+bool IsAwakeTime(time_t now);
+void SetupTimezone();
+
+namespace {
+
+// Rough currents of the board on battery, measure yours and change them to match it
+constexpr double SleepMa = 0.17; // deep sleep, RTC and the regulator
+constexpr double AwakeMa = 45;   // CPU and PSRAM, all of the time awake
+constexpr double RadioMa = 95;   // on top while the WiFi is on, averaged over the transmit bursts
+constexpr double PanelMa = 70;   // on top while the panel is driven
+
+constexpr int MaxClockErrorMs = 1500;
+
+typedef struct {
+    int64_t StartUs; // world time
+    int64_t EndUs;
+} Outage_type;
+
+typedef struct {
+    time_t Start;
+    double Days;
+    int DriftPpm;
+    std::vector<Outage_type> WifiDown;
+    std::vector<Outage_type> ServerDown;
+    int LossPercent;
+    unsigned Seed;
+    int RequestMs;
+    std::string Fixture;
+    double BatteryMah;
+    bool Verbose;
+} Sim_config_type;
+
+// What a wake tells the simulation before its process ends, the RTC memory follows it down the pipe
+typedef struct {
+    Host_clock_state_type Clock;
+    uint64_t SleepUs;
+    time_t Target;        // device time the sleep aims at, 0 without a valid clock
+    uint32_t AwakeMs;     // from reset, the bootloader included
+    uint32_t RadioMs;
+    uint32_t PanelMs;
+    int32_t ClockErrorMs; // device clock minus world time at sleep
+    uint16_t Requests;
+    uint16_t Failed;      // requests the stand-in network failed on purpose
+    WakeKind Kind;
+    bool Quiet;           // outside of wake hours
+    bool Fetched;
+} Wake_report_type;
+
+typedef struct {
+    int64_t WorldUs;      // at the reset
+    bool WifiDown;
+    bool ServerDown;
+    Wake_report_type Report;
+    int64_t LateMs;       // after the slot the previous sleep aimed at, in world time
+    int64_t SleptUs;      // world time of the sleep that follows
+    double AwakeMah;
+    double RadioMah;
+    double PanelMah;
+    double SleepMah;
+} Wake_type;
+
+Sim_config_type config;
+std::string onecall, forecast;
+std::vector<Wake_type> wakes;
+
+// the process of a wake
+int reportPipe = -1;
+bool bootTimeValid = false;
+std::atomic<int> requests{0}, failed{0};
+
+const char *Env(const char *name, const char *fallback) {
+    const char *value = getenv(name);
+    return value ? value : fallback;
+}
+
+std::vector<Outage_type> ParseOutages(const char *list) {
+    std::vector<Outage_type> outages;
+    for(const char *p = list; *p;) {
+        double start, hours;
+        if(sscanf(p, "%lf:%lf", &start, &hours) == 2)
+            outages.push_back({config.Start * 1000000LL + (int64_t)(start * 3600e6),
+                               config.Start * 1000000LL + (int64_t)((start + hours) * 3600e6)});
+        const char *comma = strchr(p, ',');
+        p = comma ? comma + 1 : p + strlen(p);
+    }
+    return outages;
+}
+
+bool ReadConfig() {
+    struct tm start = {};
+    if(sscanf(Env("SIM_START", "2024-03-25T12:00"), "%d-%d-%dT%d:%d", &start.tm_year, &start.tm_mon,
+              &start.tm_mday, &start.tm_hour, &start.tm_min) < 3) {
+        printf("SIM_START is not YYYY-MM-DD[THH:MM]\n");
+        return false;
+    }
+    start.tm_year -= 1900;
+    start.tm_mon -= 1;
+    config.Start = timegm(&start);
+    config.Days = atof(Env("SIM_DAYS", "30"));
+    config.DriftPpm = atoi(Env("SIM_DRIFT_PPM", "300"));
+    config.WifiDown = ParseOutages(Env("SIM_WIFI_DOWN", "50:6"));
+    config.ServerDown = ParseOutages(Env("SIM_SERVER_DOWN", "150:3"));
+    config.LossPercent = atoi(Env("SIM_LOSS", "0"));
+    config.Seed = strtoul(Env("SIM_SEED", "1"), nullptr, 10);
+    config.RequestMs = atoi(Env("SIM_REQUEST_MS", "600"));
+    config.Fixture = Env("SIM_FIXTURE", "rain");
+    config.BatteryMah = atof(Env("SIM_BATTERY_MAH", "2000"));
+    config.Verbose = getenv("SIM_VERBOSE") != nullptr;
+
+    std::string directory = ProjectPath("test/fixtures/owm/" + config.Fixture);
+    onecall = ReadFile(directory + "/onecall.json");
+    forecast = ReadFile(directory + "/forecast.json");
+    if(onecall.empty() || forecast.empty()) {
+        printf("No onecall.json and forecast.json in %s\n", directory.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool InOutage(const std::vector<Outage_type> &outages, int64_t worldUs) {
+    for(const Outage_type &outage : outages)
+        if(worldUs >= outage.StartUs && worldUs < outage.EndUs)
+            return true;
+    return false;
+}
+
+bool WriteAll(int fd, const void *data, size_t size) {
+    for(size_t done = 0; done < size;) {
+        ssize_t n = write(fd, (const uint8_t *)data + done, size - done);
+        if(n <= 0)
+            return false;
+        done += n;
+    }
+    return true;
+}
+
+bool ReadAll(int fd, void *data, size_t size) {
+    for(size_t done = 0; done < size;) {
+        ssize_t n = read(fd, (uint8_t *)data + done, size - done);
+        if(n <= 0)
+            return false;
+        done += n;
+    }
+    return true;
+}
+
+void Respond(int fd, const std::string &path, bool fail) {
+    const std::string *body = path == "/data/2.5/onecall" ? &onecall
+        : path == "/data/2.5/forecast"                    ? &forecast
+                                                          : nullptr;
+    int status = !body ? 404 : fail ? 503 : 200;
+    std::string error = "{\"cod\":" + std::to_string(status) + ",\"message\":\"stand-in error\"}";
+    if(status != 200)
+        body = &error;
+    // like a delay of the firmware, so it overlaps with what the other task does meanwhile
+    delay(config.RequestMs);
+
+    // the firmware sets its clock from the Date header
+    char date[64];
+    time_t now = HostWorldTime();
+    struct tm utc;
+    gmtime_r(&now, &utc);
+    strftime(date, sizeof(date), "%a, %d %b %Y %H:%M:%S GMT", &utc);
+    char head[256];
+    int length = snprintf(head, sizeof(head),
+                          "HTTP/1.1 %d %s\r\nDate: %s\r\nContent-Type: application/json; charset=utf-8\r\n"
+                          "Content-Length: %zu\r\n\r\n",
+                          status, status == 200 ? "OK" : "Error", date, body->size());
+    // in one write, Nagle would hold back the body until the delayed ACK of the headers
+    std::string response = std::string(head, length) + *body;
+    WriteAll(fd, response.data(), response.size());
+}
+
+// One connection at a time with keep-alive, the firmware reuses it for both requests
+void Serve(int listener, bool down, unsigned seed) {
+    std::minstd_rand random(seed);
+    for(;;) {
+        int fd = accept(listener, nullptr, nullptr);
+        if(fd < 0)
+            return;
+        std::string received;
+        char buffer[4096];
+        for(;;) {
+            size_t end;
+            ssize_t n = 1;
+            while((end = received.find("\r\n\r\n")) == std::string::npos &&
+                  (n = read(fd, buffer, sizeof(buffer))) > 0)
+                received.append(buffer, n);
+            if(end == std::string::npos)
+                break;
+            // "GET /data/2.5/onecall?lat=... HTTP/1.1"
+            size_t first = received.find(' ') + 1;
+            std::string path = received.substr(first, received.find_first_of("? ", first) - first);
+            received.erase(0, end + 4);
+            bool fail = down || (int)(random() % 100) < config.LossPercent;
+            requests++;
+            if(fail)
+                failed++;
+            Respond(fd, path, fail);
+        }
+        close(fd);
+    }
+}
+
+void ReportAndExit(uint64_t sleepUs) {
+    Wake_report_type report = {};
+    report.Clock = HostClockState();
+    report.SleepUs = sleepUs;
+    time_t now = time(nullptr);
+    report.Target = TimeIsValid(now) ? NextWake(now) : 0;
+    report.AwakeMs = HostUptimeUs() / 1000;
+    report.RadioMs = radioOnMs;
+    report.PanelMs = HostPanelBusyUs() / 1000;
+    report.ClockErrorMs = (report.Clock.DeviceUs - report.Clock.WorldUs) / 1000;
+    report.Requests = requests;
+    report.Failed = failed;
+    report.Kind = wakeKind;
+    // setup() decided on the wake hours with the time it put in timeinfo, a quiet wake leaves it at that
+    struct tm woke = timeinfo;
+    report.Quiet = bootTimeValid && !IsAwakeTime(mktime(&woke));
+    report.Fetched = weatherReceived;
+    uint8_t *rtc;
+    size_t size;
+    HostRtcMemory(&rtc, &size);
+    _exit(WriteAll(reportPipe, &report, sizeof(report)) && WriteAll(reportPipe, rtc, size) ? 0 : 1);
+}
+
+__attribute__((noreturn)) void RunWake(bool coldBoot, int listener, int pipe, bool serverDown,
+                                       unsigned seed) {
+    if(!config.Verbose) {
+        int null = open("/dev/null", O_WRONLY);
+        dup2(null, STDOUT_FILENO);
+        dup2(null, STDERR_FILENO);
+    }
+    reportPipe = pipe;
+    std::thread(Serve, listener, serverDown, seed).detach();
+    HostBoot(coldBoot);
+    bootTimeValid = TimeIsValid(time(nullptr));
+    setup();
+    _exit(3); // setup() ends in deep sleep
+}
+
+int Listen(uint16_t *port) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(address);
+    if(fd < 0 || bind(fd, (sockaddr *)&address, sizeof(address)) != 0 || listen(fd, 4) != 0 ||
+       getsockname(fd, (sockaddr *)&address, &length) != 0)
+        return -1;
+    *port = ntohs(address.sin_port);
+    return fd;
+}
+
+const char *KindName(const Wake_report_type &report) {
+    return report.Quiet ? "quiet" : report.Kind == WakeKind::Data ? "data" : "render";
+}
+
+// The drift of the RTC is learned from the second NTP sync, on the first data wake NtpInterval after the
+// cold boot; until then the clock runs off between the Date headers
+bool DriftLearned(const Wake_type &wake) {
+    return wake.WorldUs - wakes.front().WorldUs >= (int64_t)(NtpInterval + DataInterval) * 1000000;
+}
+
+void WriteWakeLog() {
+    std::string csv = "wake,utc,local,kind,fetched,requests,failed,awake_ms,radio_ms,panel_ms,sleep_s,"
+                      "late_ms,clock_error_ms,wifi,server,mah\n";
+    for(size_t i = 0; i < wakes.size(); i++) {
+        const Wake_type &wake = wakes[i];
+        const Wake_report_type &r = wake.Report;
+        time_t world = wake.WorldUs / 1000000;
+        struct tm tm;
+        char utc[32], local[32], line[256];
+        strftime(utc, sizeof(utc), "%Y-%m-%dT%H:%M:%SZ", gmtime_r(&world, &tm));
+        strftime(local, sizeof(local), "%Y-%m-%d %H:%M:%S %Z", localtime_r(&world, &tm));
+        snprintf(line, sizeof(line), "%zu,%s,%s,%s,%d,%u,%u,%u,%u,%u,%.1f,%lld,%d,%s,%s,%.4f\n", i, utc,
+                 local, KindName(r), r.Fetched, r.Requests, r.Failed, r.AwakeMs, r.RadioMs, r.PanelMs,
+                 wake.SleptUs / 1e6, (long long)wake.LateMs, (int)r.ClockErrorMs,
+                 wake.WifiDown ? "down" : "up", wake.ServerDown ? "down" : "up",
+                 wake.AwakeMah + wake.RadioMah + wake.PanelMah + wake.SleepMah);
+        csv += line;
+    }
+    WriteFile(ProjectPath(".pio/sim/wakes.csv"), csv);
+}
+
+void WriteSummary() {
+    int counts[3] = {0, 0, 0}, fetches = 0, missed = 0;
+    double awakeS = 0, radioS = 0, panelS = 0, awakeMah = 0, radioMah = 0, panelMah = 0, sleepMah = 0;
+    int64_t lastFetchUs = -1, maxAgeUs = 0, maxLateMs = 0, maxErrorMs = 0;
+    for(const Wake_type &wake : wakes) {
+        const Wake_report_type &r = wake.Report;
+        counts[r.Quiet ? 2 : r.Kind == WakeKind::Data ? 0 : 1]++;
+        fetches += r.Fetched;
+        missed += !r.Quiet && r.Kind == WakeKind::Data && !r.Fetched;
+        awakeS += r.AwakeMs / 1000.0;
+        radioS += r.RadioMs / 1000.0;
+        panelS += r.PanelMs / 1000.0;
+        awakeMah += wake.AwakeMah;
+        radioMah += wake.RadioMah;
+        panelMah += wake.PanelMah;
+        sleepMah += wake.SleepMah;
+        if(!r.Quiet && lastFetchUs >= 0)
+            maxAgeUs = std::max(maxAgeUs, wake.WorldUs - lastFetchUs);
+        if(r.Fetched)
+            lastFetchUs = wake.WorldUs;
+        maxLateMs = std::max<int64_t>(maxLateMs, llabs(wake.LateMs));
+        maxErrorMs = std::max<int64_t>(maxErrorMs, llabs(r.ClockErrorMs));
+    }
+    double days = (wakes.back().WorldUs + wakes.back().SleptUs - wakes.front().WorldUs) / 86400e6;
+    double totalMah = awakeMah + radioMah + panelMah + sleepMah;
+    double perDay = totalMah / days;
+
+    printf("%.1f days: %zu wakes, %d data, %d render, %d quiet; %d fetches, %d data wakes without data\n",
+           days, wakes.size(), counts[0], counts[1], counts[2], fetches, missed);
+    printf("awake %.0f s, radio %.0f s, panel %.0f s; data at most %.1f h old when awake\n", awakeS, radioS,
+           panelS, maxAgeUs / 3600e6);
+    printf("wakes at most %lld ms off their slot, clock at most %lld ms off\n", (long long)maxLateMs,
+           (long long)maxErrorMs);
+    printf("%.1f mAh a day: awake %.1f, radio %.1f, panel %.1f, sleep %.1f; %.0f days on %.0f mAh\n", perDay,
+           awakeMah / days, radioMah / days, panelMah / days, sleepMah / days, config.BatteryMah / perDay,
+           config.BatteryMah);
+
+    char json[1024];
+    snprintf(json, sizeof(json),
+             "{\n  \"days\": %.2f,\n  \"wakes\": {\"data\": %d, \"render\": %d, \"quiet\": %d},\n"
+             "  \"fetches\": %d,\n  \"data_wakes_without_data\": %d,\n  \"max_data_age_h\": %.2f,\n"
+             "  \"max_late_ms\": %lld,\n  \"max_clock_error_ms\": %lld,\n"
+             "  \"seconds\": {\"awake\": %.1f, \"radio\": %.1f, \"panel\": %.1f},\n"
+             "  \"mah_per_day\": {\"awake\": %.3f, \"radio\": %.3f, \"panel\": %.3f, \"sleep\": %.3f, "
+             "\"total\": %.3f},\n  \"battery_mah\": %.0f,\n  \"battery_days\": %.1f\n}\n",
+             days, counts[0], counts[1], counts[2], fetches, missed, maxAgeUs / 3600e6, (long long)maxLateMs,
+             (long long)maxErrorMs, awakeS, radioS, panelS, awakeMah / days, radioMah / days, panelMah / days,
+             sleepMah / days, perDay, config.BatteryMah, config.BatteryMah / perDay);
+    WriteFile(ProjectPath(".pio/sim/summary.json"), json);
+}
+
+} // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_simulation_completes() {
+    uint16_t port;
+    int listener = Listen(&port);
+    TEST_ASSERT_TRUE_MESSAGE(listener >= 0, "cannot listen on the loopback interface");
+    HostRedirect("api.openweathermap.org:443", ("127.0.0.1:" + std::to_string(port)).c_str());
+    HostFreezeClock(true);
+    HostSetWorldTime(config.Start);
+    HostSetDriftPpm(config.DriftPpm);
+    HostOnDeepSleep(ReportAndExit);
+    SetupTimezone();
+
+    uint8_t *rtc;
+    size_t rtcSize;
+    HostRtcMemory(&rtc, &rtcSize);
+    int64_t endUs = (config.Start + (int64_t)(config.Days * 86400)) * 1000000LL;
+    time_t target = 0;
+    while(HostClockState().WorldUs < endUs) {
+        Wake_type wake = {};
+        wake.WorldUs = HostClockState().WorldUs;
+        wake.WifiDown = InOutage(config.WifiDown, wake.WorldUs);
+        wake.ServerDown = InOutage(config.ServerDown, wake.WorldUs);
+        HostSetWifiAvailable(!wake.WifiDown);
+
+        int fds[2];
+        TEST_ASSERT_TRUE(pipe(fds) == 0);
+        fflush(stdout);
+        fflush(stderr);
+        pid_t child = fork();
+        if(child == 0) {
+            close(fds[0]);
+            RunWake(wakes.empty(), listener, fds[1], wake.ServerDown, config.Seed * 7919 + wakes.size());
+        }
+        close(fds[1]);
+        bool reported = ReadAll(fds[0], &wake.Report, sizeof(wake.Report)) && ReadAll(fds[0], rtc, rtcSize);
+        close(fds[0]);
+        int status = 0;
+        waitpid(child, &status, 0);
+        if(!reported) {
+            char message[128];
+            snprintf(message, sizeof(message), "wake %zu ended without going to sleep, status 0x%x",
+                     wakes.size(), status);
+            TEST_FAIL_MESSAGE(message);
+        }
+        if(wake.Report.SleepUs == 0) {
+            TEST_FAIL_MESSAGE("the firmware went to sleep for 0 us, it would wake at once forever");
+        }
+
+        const Wake_report_type &r = wake.Report;
+        wake.LateMs = target ? wake.WorldUs / 1000 - target * 1000LL : 0;
+        target = r.Target;
+        // the sleep timer counts on the drifting RTC too
+        wake.SleptUs = (r.SleepUs * 1000000 + (1000000 + config.DriftPpm) / 2) / (1000000 + config.DriftPpm);
+        wake.AwakeMah = r.AwakeMs * AwakeMa / 3600e3;
+        wake.RadioMah = r.RadioMs * RadioMa / 3600e3;
+        wake.PanelMah = r.PanelMs * PanelMa / 3600e3;
+        wake.SleepMah = wake.SleptUs * SleepMa / 3600e6;
+        wakes.push_back(wake);
+        HostRestoreClockState(r.Clock);
+        HostAdvanceUs(wake.SleptUs);
+    }
+    close(listener);
+}
+
+void test_every_sleep_ends_at_a_slot() {
+    for(size_t i = 0; i < wakes.size(); i++) {
+        // at most the slot after the next one, when the next is closer than a minute
+        TEST_ASSERT_TRUE(wakes[i].Report.SleepUs <= (SleepDuration + 120) * 1000000ULL);
+        if(DriftLearned(wakes[i]) && llabs(wakes[i].LateMs) > MaxClockErrorMs) {
+            char message[96];
+            snprintf(message, sizeof(message), "wake %zu is %lld ms off its slot", i,
+                     (long long)wakes[i].LateMs);
+            TEST_FAIL_MESSAGE(message);
+        }
+    }
+}
+
+void test_no_radio_in_quiet_hours() {
+    for(const Wake_type &wake : wakes)
+        if(wake.Report.Quiet) {
+            TEST_ASSERT_EQUAL_INT(0, wake.Report.RadioMs);
+            TEST_ASSERT_EQUAL_INT(0, wake.Report.Requests);
+        }
+}
+
+void test_data_wakes_fetch_when_the_network_is_up() {
+    for(size_t i = 0; i < wakes.size(); i++) {
+        const Wake_type &wake = wakes[i];
+        const Wake_report_type &r = wake.Report;
+        if(r.Quiet || r.Kind != WakeKind::Data || wake.WifiDown || wake.ServerDown || r.Failed)
+            continue;
+        if(!r.Fetched) {
+            char message[64];
+            snprintf(message, sizeof(message), "wake %zu fetched no data", i);
+            TEST_FAIL_MESSAGE(message);
+        }
+    }
+}
+
+void test_data_slots_are_not_skipped() {
+    // a wake on a slot of the provider's cadence fetches, even when it fired a moment early
+    for(size_t i = 1; i < wakes.size(); i++) {
+        const Wake_type &wake = wakes[i];
+        int64_t fromSlotUs = (wake.WorldUs - DataOffset * 1000000LL) % (DataInterval * 1000000LL);
+        bool onSlot = fromSlotUs < 60000000 || fromSlotUs > (DataInterval - 60) * 1000000LL;
+        if(onSlot && !wake.Report.Quiet && wake.Report.Kind != WakeKind::Data) {
+            char message[64];
+            snprintf(message, sizeof(message), "wake %zu is on a data slot but renders", i);
+            TEST_FAIL_MESSAGE(message);
+        }
+    }
+}
+
+void test_clock_follows_the_world() {
+    // the Date headers and the learned drift keep the clock within a second and a bit
+    for(size_t i = 0; i < wakes.size(); i++)
+        if(DriftLearned(wakes[i]) && abs(wakes[i].Report.ClockErrorMs) > MaxClockErrorMs) {
+            char message[64];
+            snprintf(message, sizeof(message), "the clock is %d ms off after wake %zu",
+                     (int)wakes[i].Report.ClockErrorMs, i);
+            TEST_FAIL_MESSAGE(message);
+        }
+}
+
+int main(int argc, char **argv) {
+    if(!ReadConfig())
+        return 1;
+    UNITY_BEGIN();
+    RUN_TEST(test_simulation_completes);
+    if(!wakes.empty()) {
+        WriteWakeLog();
+        WriteSummary();
+        RUN_TEST(test_every_sleep_ends_at_a_slot);
+        RUN_TEST(test_no_radio_in_quiet_hours);
+        RUN_TEST(test_data_wakes_fetch_when_the_network_is_up);
+        RUN_TEST(test_data_slots_are_not_skipped);
+        RUN_TEST(test_clock_follows_the_world);
+    }
+    return UNITY_END();
+}
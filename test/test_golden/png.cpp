@@ -0,0 +1,146 @@
+#include "png.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <zlib.h>
+
+namespace {
+
+constexpr uint8_t Signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+void PutU32(std::string &out, uint32_t value) {
+    for(int shift = 24; shift >= 0; shift -= 8)
+        out += (char)(value >> shift);
+}
+
+uint32_t GetU32(const uint8_t *data) {
+    return (uint32_t)data[0] << 24 | (uint32_t)data[1] << 16 | (uint32_t)data[2] << 8 | data[3];
+}
+
+void PutChunk(std::string &out, const char *type, const std::string &data) {
+    PutU32(out, data.size());
+    std::string body = std::string(type, 4) + data;
+    out += body;
+    PutU32(out, crc32(0, (const Bytef *)body.data(), body.size()));
+}
+
+bool Write(const char *path, const uint8_t *pixels, int width, int height, int channels) {
+    std::string header;
+    PutU32(header, width);
+    PutU32(header, height);
+    header += (char)8;                          // bit depth
+    header += (char)(channels == 1 ? 0 : 2);    // grayscale or RGB
+    header += std::string(3, '\0');             // deflate, adaptive filters, no interlace
+
+    // every row without a filter, the deflate does well enough on the large flat areas of the screen
+    size_t rowBytes = (size_t)width * channels;
+    std::string raw;
+    for(int y = 0; y < height; y++) {
+        raw += '\0';
+        raw.append((const char *)pixels + y * rowBytes, rowBytes);
+    }
+    uLongf size = compressBound(raw.size());
+    std::string packed(size, '\0');
+    if(compress2((Bytef *)&packed[0], &size, (const Bytef *)raw.data(), raw.size(), 9) != Z_OK)
+        return false;
+    packed.resize(size);
+
+    std::string file((const char *)Signature, sizeof(Signature));
+    PutChunk(file, "IHDR", header);
+    PutChunk(file, "IDAT", packed);
+    PutChunk(file, "IEND", "");
+    FILE *out = fopen(path, "wb");
+    if(!out)
+        return false;
+    bool written = fwrite(file.data(), 1, file.size(), out) == file.size();
+    return fclose(out) == 0 && written;
+}
+
+uint8_t Paeth(int a, int b, int c) {
+    int p = a + b - c;
+    int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+    return (pa <= pb && pa <= pc) ? a : (pb <= pc) ? b : c;
+}
+
+} // namespace
+
+bool PngWriteGray(const char *path, const uint8_t *pixels, int width, int height) {
+    return Write(path, pixels, width, height, 1);
+}
+
+bool PngWriteRgb(const char *path, const uint8_t *pixels, int width, int height) {
+    return Write(path, pixels, width, height, 3);
+}
+
+bool PngReadGray(const char *path, std::vector<uint8_t> &pixels, int *width, int *height) {
+    FILE *in = fopen(path, "rb");
+    if(!in)
+        return false;
+    std::string file;
+    char block[65536];
+    size_t n;
+    while((n = fread(block, 1, sizeof(block), in)) > 0)
+        file.append(block, n);
+    fclose(in);
+    const uint8_t *data = (const uint8_t *)file.data();
+    if(file.size() < sizeof(Signature) || memcmp(data, Signature, sizeof(Signature)) != 0)
+        return false;
+
+    std::string packed;
+    bool header = false;
+    for(size_t at = sizeof(Signature); at + 12 <= file.size();) {
+        uint32_t length = GetU32(data + at);
+        if(at + 12 + length > file.size())
+            return false;
+        const uint8_t *type = data + at + 4, *body = data + at + 8;
+        if(memcmp(type, "IHDR", 4) == 0) {
+            *width = GetU32(body);
+            *height = GetU32(body + 4);
+            if(length < 13 || body[8] != 8 || body[9] != 0 || body[12] != 0)
+                return false;
+            header = true;
+        } else if(memcmp(type, "IDAT", 4) == 0) {
+            packed.append((const char *)body, length);
+        }
+        at += 12 + length;
+    }
+    if(!header)
+        return false;
+
+    size_t rowBytes = *width;
+    uLongf size = (rowBytes + 1) * *height;
+    std::vector<uint8_t> raw(size);
+    if(uncompress(raw.data(), &size, (const Bytef *)packed.data(), packed.size()) != Z_OK
+       || size != raw.size())
+        return false;
+    pixels.assign(rowBytes * *height, 0);
+    for(int y = 0; y < *height; y++) {
+        const uint8_t *src = &raw[y * (rowBytes + 1)];
+        uint8_t *row = &pixels[y * rowBytes];
+        const uint8_t *up = y ? row - rowBytes : nullptr;
+        for(size_t x = 0; x < rowBytes; x++) {
+            int a = x ? row[x - 1] : 0, b = up ? up[x] : 0, c = (x && up) ? up[x - 1] : 0;
+            switch(src[0]) {
+            case 0:
+                row[x] = src[1 + x];
+                break;
+            case 1:
+                row[x] = src[1 + x] + a;
+                break;
+            case 2:
+                row[x] = src[1 + x] + b;
+                break;
+            case 3:
+                row[x] = src[1 + x] + (a + b) / 2;
+                break;
+            case 4:
+                row[x] = src[1 + x] + Paeth(a, b, c);
+                break;
+            default:
+                return false;
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// 8 bit PNG files for the golden images and their diffs. Reading only takes what PngWriteGray() writes,
+// or any other non-interlaced 8 bit grayscale PNG.
+bool PngWriteGray(const char *path, const uint8_t *pixels, int width, int height);
+bool PngWriteRgb(const char *path, const uint8_t *pixels, int width, int height);
+bool PngReadGray(const char *path, std::vector<uint8_t> &pixels, int *width, int *height);
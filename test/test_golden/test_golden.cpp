@@ -0,0 +1,173 @@
+#include "canvas.h"
+#include "fixtures.h"
+#include "host.h"
+#include "png.h"
+#include <Arduino.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <unity.h>
+#include <vector>
+
+// The weather screen of every fixture in test/fixtures/owm, rendered on the host and compared pixel by
+// pixel with test/golden/<fixture>.png. The screen is drawn into a full framebuffer and again in bands,
+// as on a board without PSRAM; both have to match the golden. A mismatch leaves the render and a heatmap
+// of the differences in .pio/golden. With GOLDEN_UPDATE=1 the renders become the new goldens instead.
+//
+// The best render time of each fixture goes to .pio/golden/render_times.json, so a change to the drawing
+// code can be checked for being both faster and pixel identical in one run:
+//
+//     pio test -e native -f test_golden
+
+// from the firmware
+void DisplayWeather();
+
+namespace {
+
+constexpr int Width = EPD_WIDTH;
+constexpr int Height = EPD_HEIGHT;
+constexpr size_t FrameBytes = CanvasRowBytes(CanvasFormat::Gray4) * Height;
+constexpr int BandHeight = 60; // as the firmware renders without PSRAM
+constexpr int RenderRuns = 5;
+
+typedef struct {
+    std::string Name;
+    int64_t FullUs;
+    int64_t BandedUs;
+} Render_time_type;
+
+std::string currentFixture;
+std::vector<Render_time_type> renderTimes;
+
+void RenderFull(uint8_t *frame) {
+    memset(frame, 0xFF, FrameBytes);
+    CanvasSetTarget(frame, 0, Height);
+    DisplayWeather();
+}
+
+void RenderInBands(uint8_t *frame) {
+    static uint8_t band[CanvasRowBytes(CanvasFormat::Gray4) * BandHeight];
+    for(int top = 0; top < Height; top += BandHeight) {
+        int rows = std::min(BandHeight, Height - top);
+        memset(band, 0xFF, sizeof(band));
+        CanvasSetTarget(band, top, rows);
+        DisplayWeather();
+        memcpy(frame + top * sizeof(band) / BandHeight, band, rows * sizeof(band) / BandHeight);
+    }
+}
+
+int64_t BestOf(void (*render)(uint8_t *), uint8_t *frame) {
+    using namespace std::chrono;
+    int64_t best = INT64_MAX;
+    for(int run = 0; run < RenderRuns; run++) {
+        auto start = steady_clock::now();
+        render(frame);
+        best = std::min<int64_t>(best, duration_cast<microseconds>(steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+// 16 shades to 8 bit gray, even x in the low nibble
+std::vector<uint8_t> ToGray(const uint8_t *frame) {
+    std::vector<uint8_t> gray(Width * Height);
+    for(int i = 0; i < Width * Height; i++)
+        gray[i] = ((i & 1) ? frame[i / 2] >> 4 : frame[i / 2] & 0x0F) * 17;
+    return gray;
+}
+
+// the golden faded to the background, differences from yellow (one shade) to red (black against white)
+std::vector<uint8_t> Heatmap(const std::vector<uint8_t> &golden, const std::vector<uint8_t> &render) {
+    std::vector<uint8_t> rgb(Width * Height * 3);
+    for(int i = 0; i < Width * Height; i++) {
+        uint8_t *pixel = &rgb[i * 3];
+        int delta = abs(golden[i] - render[i]) / 17;
+        if(delta) {
+            pixel[0] = 255;
+            pixel[1] = 255 - delta * 17;
+            pixel[2] = 0;
+        } else {
+            pixel[0] = pixel[1] = pixel[2] = 255 - (255 - golden[i]) / 4;
+        }
+    }
+    return rgb;
+}
+
+void CheckGolden(const char *variant, const uint8_t *frame) {
+    std::string goldenPath = ProjectPath("test/golden/" + currentFixture + ".png");
+    std::string outPath = ProjectPath(".pio/golden/" + currentFixture + "-" + variant);
+    std::vector<uint8_t> render = ToGray(frame);
+
+    if(getenv("GOLDEN_UPDATE")) {
+        TEST_ASSERT_TRUE_MESSAGE(PngWriteGray(goldenPath.c_str(), render.data(), Width, Height),
+                                 goldenPath.c_str());
+        return;
+    }
+    std::vector<uint8_t> golden;
+    int width, height;
+    std::string message = "no golden " + goldenPath + ", GOLDEN_UPDATE=1 creates it";
+    TEST_ASSERT_TRUE_MESSAGE(PngReadGray(goldenPath.c_str(), golden, &width, &height), message.c_str());
+    TEST_ASSERT_EQUAL_INT(Width, width);
+    TEST_ASSERT_EQUAL_INT(Height, height);
+
+    int differ = 0, x0 = Width, y0 = Height, x1 = -1, y1 = -1;
+    for(int i = 0; i < Width * Height; i++)
+        if(golden[i] != render[i]) {
+            differ++;
+            x0 = std::min(x0, i % Width), x1 = std::max(x1, i % Width);
+            y0 = std::min(y0, i / Width), y1 = std::max(y1, i / Width);
+        }
+    if(!differ)
+        return;
+    CreateDirectories(outPath);
+    PngWriteGray((outPath + ".png").c_str(), render.data(), Width, Height);
+    PngWriteRgb((outPath + "-diff.png").c_str(), Heatmap(golden, render).data(), Width, Height);
+    char text[256];
+    snprintf(text, sizeof(text), "%s: %d pixels differ in (%d,%d)-(%d,%d), see %s-diff.png", variant, differ,
+             x0, y0, x1, y1, outPath.c_str());
+    TEST_FAIL_MESSAGE(text);
+}
+
+void WriteRenderTimes() {
+    std::string json = "{\n";
+    for(size_t i = 0; i < renderTimes.size(); i++) {
+        char line[128];
+        snprintf(line, sizeof(line), "  \"%s\": {\"full_us\": %lld, \"banded_us\": %lld}%s\n",
+                 renderTimes[i].Name.c_str(), (long long)renderTimes[i].FullUs,
+                 (long long)renderTimes[i].BandedUs, i + 1 < renderTimes.size() ? "," : "");
+        json += line;
+    }
+    WriteFile(ProjectPath(".pio/golden/render_times.json"), json + "}\n");
+}
+
+} // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_render_matches_golden() {
+    static uint8_t full[FrameBytes], banded[FrameBytes];
+    TEST_ASSERT_TRUE_MESSAGE(LoadFixture(currentFixture), currentFixture.c_str());
+    Render_time_type time = {currentFixture, BestOf(RenderFull, full), BestOf(RenderInBands, banded)};
+    renderTimes.push_back(time);
+    printf("%-8s render %6.2f ms, in bands %6.2f ms\n", time.Name.c_str(), time.FullUs / 1000.0,
+           time.BandedUs / 1000.0);
+    CheckGolden("full", full);
+    CheckGolden("banded", banded);
+}
+
+int main(int argc, char **argv) {
+    HostFreezeClock(true);
+    std::vector<std::string> fixtures = FixtureNames();
+    if(fixtures.empty()) {
+        printf("No fixtures in %s\n", ProjectPath("test/fixtures/owm").c_str());
+        return 1;
+    }
+    UNITY_BEGIN();
+    for(const std::string &fixture : fixtures) {
+        currentFixture = fixture;
+        UnityDefaultTestRun(test_render_matches_golden, fixture.c_str(), __LINE__);
+    }
+    WriteRenderTimes();
+    return UNITY_END();
+}
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+"""Compare two benchmark results of the native environment, e.g. .pio/bench/render.json of two commits.
+
+Prints the time of every benchmark in both runs and the change. Exits with 1 when one got slower by more
+than the threshold or allocates more per call, so a script or CI job can stop a regression. Benchmarks
+that are only in one of the files are listed but not judged. The files use the JSON format of Google
+Benchmark, whose own compare.py reads them too.
+"""
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        data = json.load(f)
+    return data.get("context", {}), {b["name"]: b for b in data["benchmarks"]}
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("old")
+    parser.add_argument("new")
+    parser.add_argument("--threshold", type=float, default=10, help="percent slower that fails, default 10")
+    args = parser.parse_args(argv)
+
+    old_context, old = load(args.old)
+    new_context, new = load(args.new)
+    print("%s (%s) against %s (%s)" % (args.new, new_context.get("commit", "?"), args.old,
+                                       old_context.get("commit", "?")))
+    width = max(len(name) for name in list(old) + list(new))
+    print("%-*s %12s %12s %8s  %s" % (width, "benchmark", "old ns", "new ns", "change", "allocs"))
+    failed = []
+    for name in list(new) + [name for name in old if name not in new]:
+        if name not in old or name not in new:
+            print("%-*s %s" % (width, name, "only new" if name in new else "only old"))
+            continue
+        before, after = old[name], new[name]
+        change = (after["real_time"] / before["real_time"] - 1) * 100
+        allocs = "%g -> %g" % (before.get("allocs_per_iter", 0), after.get("allocs_per_iter", 0))
+        verdict = ""
+        if change > args.threshold:
+            verdict = "  SLOWER"
+        if after.get("allocs_per_iter", 0) > before.get("allocs_per_iter", 0):
+            verdict += "  MORE ALLOCATIONS"
+        if verdict:
+            failed.append(name)
+        print("%-*s %12.0f %12.0f %+7.1f%%  %s%s" % (width, name, before["real_time"], after["real_time"],
+                                                     change, allocs, verdict))
+    if failed:
+        print("%d regressed: %s" % (len(failed), ", ".join(failed)))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
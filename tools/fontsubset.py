@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+"""Subset the fontconvert headers in src/Font Files to the glyphs the display can show.
+
+The manifest (tools/fonts.json) lists the fonts the firmware includes and, per font, the characters it
+needs. Every font is rewritten with just those glyphs into the output directory, in the same format
+fontconvert produces. Fonts marked "uncompressed" get raw glyph bitmaps, trading flash for not having to
+inflate every glyph when it is drawn.
+
+The headers are checked in so the sketch also builds in the Arduino IDE. A header is only rewritten when
+its content changes, so it is cheap to run before every build (see tools/pio_fonts.py); --check reports
+headers that are out of date without touching them. A character the scanned sources use but the source
+font lacks is an error.
+"""
+import argparse
+import glob
+import json
+import os
+import re
+import sys
+import zlib
+
+GLYPH_STRUCT_SIZE = 16  # sizeof(GFXglyph) on the ESP32
+INTERVAL_STRUCT_SIZE = 12  # sizeof(UnicodeInterval)
+
+NAMED_SETS = {
+    "ascii": range(0x20, 0x7F),
+    "latin1": range(0xA0, 0x100),
+    "digits": [ord(c) for c in "0123456789"],
+}
+
+
+class Font:
+    def __init__(self, name, glyphs, compressed, advance_y, ascender, descender):
+        self.name = name
+        self.glyphs = glyphs  # codepoint -> (width, height, advance_x, left, top, data)
+        self.compressed = compressed
+        self.advance_y = advance_y
+        self.ascender = ascender
+        self.descender = descender
+
+    def flash_size(self):
+        intervals = len(make_intervals(sorted(self.glyphs)))
+        data = sum(len(g[5]) for g in self.glyphs.values())
+        return data + len(self.glyphs) * GLYPH_STRUCT_SIZE + intervals * INTERVAL_STRUCT_SIZE
+
+
+def parse_font(path):
+    text = open(path, encoding="utf-8").read()
+    bitmap = re.search(r"const uint8_t (\w+)Bitmaps\[\d*\] = \{(.*?)\};", text, re.S)
+    name = bitmap.group(1)
+    data = bytes(int(b, 16) for b in re.findall(r"0x([0-9A-Fa-f]{2})", bitmap.group(2)))
+    glyph_block = re.search(r"GFXglyph \w+Glyphs\[\] = \{(.*?)\};", text, re.S).group(1)
+    metrics = [tuple(int(v) for v in m.split(","))
+               for m in re.findall(r"\{\s*(-?\d+(?:\s*,\s*-?\d+){6})\s*\}", glyph_block)]
+    interval_block = re.search(r"UnicodeInterval \w+Intervals\[\] = \{(.*?)\};", text, re.S).group(1)
+    intervals = [tuple(int(v, 16) for v in m)
+                 for m in re.findall(r"\{\s*0x([0-9A-Fa-f]+),\s*0x([0-9A-Fa-f]+),\s*0x([0-9A-Fa-f]+)\s*\}",
+                                     interval_block)]
+    font_block = re.search(r"GFXfont %s = \{(.*?)\};" % name, text, re.S).group(1)
+    fields = [f.strip() for f in font_block.split(",") if f.strip()]
+    compressed, advance_y, ascender, descender = (int(f) for f in fields[4:8])
+
+    glyphs = {}
+    for first, last, offset in intervals:
+        for cp in range(first, last + 1):
+            width, height, advance_x, left, top, size, start = metrics[offset + cp - first]
+            if not compressed:
+                size = (width + 1) // 2 * height
+            glyphs[cp] = (width, height, advance_x, left, top, data[start:start + size])
+    return Font(name, glyphs, compressed, advance_y, ascender, descender)
+
+
+def string_literal_chars(path):
+    text = open(path, encoding="utf-8").read()
+    chars = set()
+    for literal in re.findall(r'"((?:[^"\\\n]|\\.)*)"', text):
+        chars.update(ord(c) for c in literal)
+    return chars
+
+
+def scanned_files(spec, base):
+    # "files" entries are glob patterns relative to the manifest, e.g. every lang_*.h
+    paths = []
+    for pattern in spec.get("files", []):
+        matches = sorted(glob.glob(os.path.join(base, pattern)))
+        if not matches:
+            raise SystemExit("fonts.json: %s matches no file" % pattern)
+        paths += matches
+    return paths
+
+
+def charset(spec, base):
+    chars = {0x20}
+    for name in spec.get("sets", []):
+        chars.update(NAMED_SETS[name])
+    for path in scanned_files(spec, base):
+        chars.update(string_literal_chars(path))
+    chars.update(ord(c) for c in spec.get("text", ""))
+    return chars
+
+
+def make_intervals(codepoints):
+    intervals = []
+    for cp in codepoints:
+        if intervals and intervals[-1][1] == cp - 1:
+            intervals[-1][1] = cp
+        else:
+            intervals.append([cp, cp])
+    return intervals
+
+
+def subset(font, codepoints, uncompressed):
+    glyphs = {}
+    for cp in sorted(codepoints):
+        if cp not in font.glyphs:
+            continue
+        width, height, advance_x, left, top, data = font.glyphs[cp]
+        size = (width + 1) // 2 * height
+        if uncompressed and font.compressed:
+            data = zlib.decompress(data) if data else b""
+            assert len(data) == size, "%s U+%04X inflates to %d bytes" % (font.name, cp, len(data))
+        glyphs[cp] = (width, height, advance_x, left, top, data)
+    return Font(font.name, glyphs, font.compressed and not uncompressed, font.advance_y, font.ascender,
+                font.descender)
+
+
+def glyph_comment(cp):
+    # a trailing backslash would continue the comment onto the next glyph
+    if cp == ord("\\"):
+        return "<backslash>"
+    return chr(cp) if cp >= 0x20 else "\\x%02x" % cp
+
+
+def font_source(font, source):
+    codepoints = sorted(font.glyphs)
+    data = b"".join(font.glyphs[cp][5] for cp in codepoints)
+    out = ["// Generated by tools/fontsubset.py from %s, do not edit" % source, "#pragma once",
+           '#include "epd_driver.h"', "const uint8_t %sBitmaps[%d] = {" % (font.name, max(len(data), 1))]
+    for i in range(0, len(data), 16):
+        out.append("    " + " ".join("0x%02X," % b for b in data[i:i + 16]))
+    if not data:
+        out.append("    0x00,")
+    out.append("};")
+    out.append("const GFXglyph %sGlyphs[] = {" % font.name)
+    offset = 0
+    for cp in codepoints:
+        width, height, advance_x, left, top, glyph = font.glyphs[cp]
+        out.append("    { %d, %d, %d, %d, %d, %d, %d }, // %s"
+                   % (width, height, advance_x, left, top, len(glyph), offset, glyph_comment(cp)))
+        offset += len(glyph)
+    out.append("};")
+    # constexpr so CanvasFont() can build the direct index table at compile time
+    out.append("constexpr UnicodeInterval %sIntervals[] = {" % font.name)
+    index = 0
+    intervals = make_intervals(codepoints)
+    for first, last in intervals:
+        out.append("    { 0x%X, 0x%X, 0x%X }," % (first, last, index))
+        index += last - first + 1
+    out.append("};")
+    out.append("const GFXfont %s = {" % font.name)
+    out += ["    (uint8_t*)%sBitmaps," % font.name, "    (GFXglyph*)%sGlyphs," % font.name,
+            "    (UnicodeInterval*)%sIntervals," % font.name]
+    out += ["    %d," % v for v in (len(intervals), int(font.compressed), font.advance_y, font.ascender,
+                                     font.descender)]
+    out.append("};")
+    return "\n".join(out) + "\n"
+
+
+def read_header(path):
+    # compare without line endings, git may check the headers out with CRLF
+    if not os.path.exists(path):
+        return None
+    return open(path, encoding="utf-8").read().replace("\r\n", "\n")
+
+
+def main(argv=None):
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--manifest", default=os.path.join(here, "fonts.json"))
+    parser.add_argument("--check", action="store_true", help="only report headers that are out of date")
+    args = parser.parse_args(argv)
+
+    base = os.path.dirname(os.path.abspath(args.manifest))
+    manifest = json.load(open(args.manifest, encoding="utf-8"))
+    source_dir = os.path.join(base, manifest["source_dir"])
+    output_dir = os.path.join(base, manifest["output_dir"])
+    if not args.check:
+        os.makedirs(output_dir, exist_ok=True)
+
+    failed = False
+    total_before = total_after = 0
+    for header, spec in manifest["fonts"].items():
+        source = os.path.join(source_dir, header)
+        target = os.path.join(output_dir, header)
+        font = parse_font(source)
+        wanted = charset(spec, base)
+        missing = sorted(cp for cp in wanted if cp not in font.glyphs)
+        if missing:
+            print("%s: no glyph for %s" % (font.name, " ".join("U+%04X %s" % (cp, glyph_comment(cp))
+                                                                for cp in missing)))
+            failed = True
+            continue
+        small = subset(font, wanted, spec.get("uncompressed", False))
+        text = font_source(small, os.path.relpath(source, os.path.dirname(target)).replace(os.sep, "/"))
+        if read_header(target) == text:
+            continue
+        if args.check:
+            print("%s is out of date, run tools/fontsubset.py" % os.path.relpath(target))
+            failed = True
+            continue
+        with open(target, "w", encoding="utf-8", newline="\n") as f:
+            f.write(text)
+
+        before, after = font.flash_size(), small.flash_size()
+        total_before += before
+        total_after += after
+        print("%-12s %3d of %3d glyphs, %6d -> %6d bytes (%5.1f%% saved)%s"
+              % (font.name, len(small.glyphs), len(font.glyphs), before, after, 100.0 * (before - after) / before,
+                 ", uncompressed" if not small.compressed else ""))
+    if total_before:
+        print("%-12s %6d -> %6d bytes of flash" % ("total", total_before, total_after))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
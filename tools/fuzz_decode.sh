@@ -0,0 +1,24 @@
+#!/bin/sh
+# Fuzzes DecodeWeather() with libFuzzer, starting from the recorded responses of test/fixtures/owm.
+#
+#   tools/fuzz_decode.sh [libFuzzer options, e.g. -max_total_time=600]
+#
+# Needs clang. The native environment is built first for ArduinoJson and the fonts. New inputs that reach
+# more code are kept in .pio/fuzz/corpus, crashes are saved to .pio/fuzz as crash-<hash>; run the target
+# with one of them as the argument to reproduce it. The shim's malloc counting is left out, AddressSanitizer
+# brings its own.
+set -e
+cd "$(dirname "$0")/.."
+pio run -e native
+
+out=.pio/fuzz
+mkdir -p $out/corpus
+shim=$(ls lib/host_shim/src/*.cpp | grep -v host_heap.cpp)
+${CXX:-clang++} -std=gnu++17 -g -O1 -fsanitize=fuzzer,address,undefined \
+    -DCORE_DEBUG_LEVEL=0 -DARDUINO=10805 -DARDUINOJSON_ENABLE_PROGMEM=0 -Wno-format \
+    -Isrc -Iinclude -Ilib/host_shim/src -Ilib/host_test/src -I.pio/libdeps/native/ArduinoJson/src \
+    src/*.cpp $shim lib/host_test/src/fixtures.cpp test/fuzz_decode/fuzz_decode.cpp \
+    -pthread -lz -o $out/fuzz_decode
+
+cd $out
+./fuzz_decode -artifact_prefix=./ corpus ../../test/fixtures/owm/*/ "$@"
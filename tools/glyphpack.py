@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""Build a glyph pack for the "glyphs" data partition from a fontconvert header.
+
+The compiled fonts only cover Latin-1. For an OWM language in another script, convert a font that has it
+with fontconvert.py (LilyGo-EPD47) at the size of the font the description uses (OpenSans12B), then pack
+the glyphs the descriptions can need:
+
+    python3 tools/glyphpack.py noto12.h --range 0x3040-0x30FF --range 0x4E00-0x9FFF -o glyphs.bin
+    esptool.py write_flash 0xDF0000 glyphs.bin
+
+The layout matches src/glyphpack.cpp: a header, an index sorted by codepoint and the glyph bitmaps.
+"""
+import argparse
+import struct
+import sys
+
+from fontsubset import parse_font, string_literal_chars, subset
+
+HEADER = struct.Struct("<4sIIHhhBB")  # Glyph_pack_header_type
+ENTRY = struct.Struct("<IBBBBhhHHI")  # Glyph_pack_entry_type
+
+
+def parse_range(text):
+    first, _, last = text.partition("-")
+    return range(int(first, 0), int(last or first, 0) + 1)
+
+
+def write_pack(font, path):
+    codepoints = sorted(font.glyphs)
+    index = bytearray()
+    bitmaps = bytearray()
+    for cp in codepoints:
+        width, height, advance_x, left, top, data = font.glyphs[cp]
+        assert len(data) < 0x10000, "U+%04X has %d bytes of bitmap" % (cp, len(data))
+        index += ENTRY.pack(cp, width, height, advance_x, 0, left, top, len(data), 0, len(bitmaps))
+        bitmaps += data
+    bitmap_offset = HEADER.size + len(index)
+    header = HEADER.pack(b"GPK1", len(codepoints), bitmap_offset, font.advance_y, font.ascender,
+                         font.descender, int(bool(font.compressed)), 0)
+    with open(path, "wb") as f:
+        f.write(header + index + bitmaps)
+    return len(index), len(bitmaps)
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("header", help="fontconvert output with the glyphs to pack")
+    parser.add_argument("--range", action="append", default=[], type=parse_range,
+                        help="codepoints to keep, like 0x0370-0x03FF (default: every glyph)")
+    parser.add_argument("--strings", action="append", default=[],
+                        help="also keep the characters of the string literals in this file")
+    parser.add_argument("--uncompressed", action="store_true", help="store raw bitmaps")
+    parser.add_argument("-o", "--output", default="glyphs.bin")
+    args = parser.parse_args(argv)
+
+    font = parse_font(args.header)
+    wanted = set()
+    for r in args.range:
+        wanted.update(r)
+    for path in args.strings:
+        wanted.update(string_literal_chars(path))
+    # Latin-1 comes from the compiled fonts
+    wanted = {cp for cp in (wanted or font.glyphs) if cp > 0xFF}
+    pack = subset(font, wanted, args.uncompressed)
+    if not pack.glyphs:
+        print("%s has none of the requested glyphs beyond Latin-1" % args.header)
+        return 1
+    index_size, bitmap_size = write_pack(pack, args.output)
+    print("%s: %d glyphs, %d bytes of index, %d bytes of bitmaps%s"
+          % (args.output, len(pack.glyphs), index_size, bitmap_size,
+             ", uncompressed" if not pack.compressed else ""))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""Stand in for api.openweathermap.org, serving recorded responses with optional network faults.
+
+/data/2.5/onecall and /data/2.5/forecast are answered from onecall.json and forecast.json of a fixture
+directory (test/fixtures/owm/<name>), whatever the query string asks for. Point the firmware at it with
+server, serverPort and serverTls in src/config.h, e.g. the address of this machine, 8080 and false.
+
+The faults apply to every response unless --fail-first limits the error status to the first requests, so
+retries can be tested against a server that recovers. Every request is logged with the time it took.
+"""
+import argparse
+import email.utils
+import gzip
+import http.server
+import os
+import ssl
+import sys
+import threading
+import time
+
+ENDPOINTS = {"/data/2.5/onecall": "onecall.json", "/data/2.5/forecast": "forecast.json"}
+
+
+class Faults:
+    def __init__(self, args):
+        self.latency = args.latency / 1000.0
+        self.first_byte = args.first_byte / 1000.0
+        self.bandwidth = args.bandwidth
+        self.chunked = args.chunked
+        self.gzip = args.gzip
+        self.truncate = args.truncate
+        self.status = args.status
+        self.fail_first = args.fail_first
+        self.date = args.date
+        self.requests = 0
+        self.lock = threading.Lock()
+
+    def next_status(self):
+        with self.lock:
+            self.requests += 1
+            if self.status and (self.fail_first == 0 or self.requests <= self.fail_first):
+                return self.status
+        return 200
+
+
+class Handler(http.server.BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"  # keep-alive, the firmware reuses the connection for both requests
+    fixtures = None
+    faults = None
+
+    def do_GET(self):
+        start = time.monotonic()
+        path = self.path.split("?", 1)[0]
+        name = ENDPOINTS.get(path)
+        status = self.faults.next_status() if name else 404
+        body = b'{"cod":%d,"message":"stand-in error"}' % status
+        if status == 200:
+            with open(os.path.join(self.fixtures, name), "rb") as f:
+                body = f.read()
+        if self.faults.gzip:
+            body = gzip.compress(body)
+
+        time.sleep(self.faults.first_byte)
+        self.send_response(status)
+        self.send_header("Content-Type", "application/json; charset=utf-8")
+        if status == 429:
+            self.send_header("Retry-After", "1")
+        if self.faults.gzip:
+            self.send_header("Content-Encoding", "gzip")
+        if self.faults.chunked:
+            self.send_header("Transfer-Encoding", "chunked")
+        else:
+            self.send_header("Content-Length", str(len(body)))
+        truncated = self.faults.truncate is not None and self.faults.truncate < len(body)
+        if truncated:
+            body = body[:self.faults.truncate]
+            self.send_header("Connection", "close")
+            self.close_connection = True
+        self.end_headers()
+        self.send_body(body, final=not truncated)
+        self.wfile.flush()
+        self.log_message('"%s" %d, %d bytes in %.0f ms%s', path, status, len(body),
+                         (time.monotonic() - start) * 1000, ", truncated" if truncated else "")
+
+    def send_body(self, body, final):
+        # segments of about a TCP packet, each delayed by the latency and paced to the bandwidth
+        segment = 1460
+        for i in range(0, len(body), segment):
+            data = body[i:i + segment]
+            if self.faults.chunked:
+                data = b"%X\r\n%s\r\n" % (len(data), data)
+            self.write_paced(data)
+        if self.faults.chunked and final:
+            self.write_paced(b"0\r\n\r\n")
+
+    def write_paced(self, data):
+        time.sleep(self.faults.latency)
+        if self.faults.bandwidth:
+            time.sleep(len(data) / float(self.faults.bandwidth))
+        self.wfile.write(data)
+
+    def date_time_string(self, timestamp=None):
+        # the firmware sets its clock from the Date header
+        return email.utils.formatdate(self.faults.date or time.time(), usegmt=True)
+
+    def log_request(self, code="-", size="-"):
+        pass  # do_GET logs with the timing instead
+
+
+def main(argv=None):
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--fixtures", default=os.path.join(here, "..", "test", "fixtures", "owm", "rain"),
+                        help="directory with onecall.json and forecast.json")
+    parser.add_argument("--host", default="0.0.0.0")
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--cert", help="PEM certificate, serves HTTPS with --key")
+    parser.add_argument("--key", help="PEM private key of the certificate")
+    parser.add_argument("--latency", type=float, default=0, help="ms before every segment of the body")
+    parser.add_argument("--first-byte", type=float, default=0, help="ms before the status line")
+    parser.add_argument("--bandwidth", type=int, default=0, help="bytes per second, 0 for unlimited")
+    parser.add_argument("--chunked", action="store_true", help="chunked transfer encoding")
+    parser.add_argument("--gzip", action="store_true", help="gzip the body, whatever the client accepts")
+    parser.add_argument("--truncate", type=int, help="close the connection after this many body bytes")
+    parser.add_argument("--status", type=int, default=0, help="answer with this status, e.g. 429 or 503")
+    parser.add_argument("--fail-first", type=int, default=0, help="only the first N requests get --status")
+    parser.add_argument("--date", type=int, help="Unix time sent in the Date header instead of now")
+    args = parser.parse_args(argv)
+
+    for name in ENDPOINTS.values():
+        if not os.path.exists(os.path.join(args.fixtures, name)):
+            parser.error("%s has no %s" % (args.fixtures, name))
+    Handler.fixtures = args.fixtures
+    Handler.faults = Faults(args)
+    server = http.server.ThreadingHTTPServer((args.host, args.port), Handler)
+    scheme = "http"
+    if args.cert:
+        context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+        context.load_cert_chain(args.cert, args.key)
+        server.socket = context.wrap_socket(server.socket, server_side=True)
+        scheme = "https"
+    print("Serving %s on %s://%s:%d" % (os.path.relpath(args.fixtures), scheme, args.host, args.port))
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,11 @@
+# PlatformIO pre-build step: refresh the checked-in font headers in src/fonts when their inputs changed
+import os
+import sys
+
+Import("env")
+
+sys.path.insert(0, os.path.join(env["PROJECT_DIR"], "tools"))
+import fontsubset
+
+if fontsubset.main([]) != 0:
+    env.Exit(1)